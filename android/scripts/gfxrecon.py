@@ -91,8 +91,15 @@ def CreateReplayParser():
     parser.add_argument('--quit-after-measurement-range', action='store_true', default=False, help='If this is specified the replayer will abort when it reaches the <end_frame> specified in the --measurement-frame-range argument. (forwarded to replay tool)')
     parser.add_argument('--flush-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at the start and end of the measurement range. (forwarded to replay tool)')
     parser.add_argument('--flush-inside-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at end of each frame inside the measurement range. (forwarded to replay tool)')
+    parser.add_argument('--preload-measurement-range', action='store_true', default=False, help='If this is specified the replayer will read and decompress all blocks of the measurement range into memory before measuring the first frame. (forwarded to replay tool)')
+    parser.add_argument('--loop-measurement-range', metavar='COUNT', help='Replay the measurement range COUNT times, preloading it into memory. Default is 1 (forwarded to replay tool)')
     parser.add_argument('--sgfs', '--skip-get-fence-status', metavar='STATUS', default=0, help='Specify behaviour to skip calls to vkWaitForFences and vkGetFenceStatus. Default is 0 - No skip (forwarded to replay tool)')
     parser.add_argument('--sgfr', '--skip-get-fence-ranges', metavar='FRAME-RANGES', default='', help='Frame ranges where --sgfs applies. Default is all frames (forwarded to replay tool)')
+    parser.add_argument('--threaded-recording', action='store_true', default=False, help='Replay the calls that record command buffers on one thread for each thread that recorded them during capture, up to the number of hardware threads. (forwarded to replay tool)')
+    parser.add_argument('--prefetch-pipelines', metavar='BLOCKS', help='Compile the pipelines of vkCreateGraphicsPipelines and vkCreateComputePipelines calls on worker threads, up to the specified number of capture file blocks ahead of replay. Default is 0 (forwarded to replay tool)')
+    parser.add_argument('--pipeline-cache-dir', metavar='DEVICE_DIR', help='Load the pipeline cache of each device from a file in the specified directory on the device, and save it when the device is destroyed, so later replays of the same capture do not compile the pipelines again (forwarded to replay tool)')
+    parser.add_argument('--read-ahead', metavar='MIB', help='Read and decompress up to the specified amount of capture file data ahead of replay on a separate thread. Default is 0 (forwarded to replay tool)')
+    parser.add_argument('--mmap-input', action='store_true', default=False, help='Map the capture file into memory and decode blocks directly from the mapping instead of reading them into a buffer. Disabled by default. (forwarded to replay tool)')
     parser.add_argument('-m', '--memory-translation', metavar='MODE', choices=['none', 'remap', 'realign', 'rebind'], help='Enable memory translation for replay on GPUs with memory types that are not compatible with the capture GPU\'s memory types.  Available modes are: none, remap, realign, rebind (forwarded to replay tool)')
     parser.add_argument('--swapchain', metavar='MODE', choices=['virtual', 'captured', 'offscreen'], help='Choose a swapchain mode to replay. Available modes are: virtual, captured, offscreen (forwarded to replay tool)')
     parser.add_argument('--vssb', '--virtual-swapchain-skip-blit', action='store_true', default=False, help='Skip blit to real swapchain to gain performance during replay.')
@@ -195,6 +202,13 @@ def MakeExtrasString(args):
         arg_list.append('--flush-inside-measurement-range')
         arg_list.append('{}'.format(args.flush_inside_measurement_range))
 
+    if args.preload_measurement_range:
+        arg_list.append('--preload-measurement-range')
+
+    if args.loop_measurement_range:
+        arg_list.append('--loop-measurement-range')
+        arg_list.append('{}'.format(args.loop_measurement_range))
+
     if args.swapchain:
         arg_list.append('--swapchain')
         arg_list.append('{}'.format(args.swapchain))
@@ -213,6 +227,24 @@ def MakeExtrasString(args):
         arg_list.append('--sgfr')
         arg_list.append('{}'.format(args.sgfr))
 
+    if args.threaded_recording:
+        arg_list.append('--threaded-recording')
+
+    if args.prefetch_pipelines:
+        arg_list.append('--prefetch-pipelines')
+        arg_list.append('{}'.format(args.prefetch_pipelines))
+
+    if args.pipeline_cache_dir:
+        arg_list.append('--pipeline-cache-dir')
+        arg_list.append('{}'.format(args.pipeline_cache_dir))
+
+    if args.read_ahead:
+        arg_list.append('--read-ahead')
+        arg_list.append('{}'.format(args.read_ahead))
+
+    if args.mmap_input:
+        arg_list.append('--mmap-input')
+
     if args.memory_translation:
         arg_list.append('-m')
         arg_list.append('{}'.format(args.memory_translation))
@@ -135,6 +135,10 @@ void Application::Run()
         // Only process the next frame if a quit event was not processed or not paused.
         if (running_ && !paused_)
         {
+            // Rewind a looped frame range before the next frame is timed, so that restoring the state modified by the
+            // previous repetition is not measured.
+            file_processor_->RestartFrameLoop();
+
             // Add one to match "trim frame range semantic"
             uint32_t frame_number = file_processor_->GetCurrentFrameNumber() + 1;
 
@@ -146,6 +150,24 @@ void Application::Run()
                     break;
                 }
 
+                if (fps_info_->ShouldPreloadFrames(frame_number))
+                {
+                    // Move file I/O and decompression for the measurement range out of the measured frame times.
+                    uint32_t frame_count = static_cast<uint32_t>(
+                        std::min(fps_info_->GetMeasurementFrameCount(),
+                                 static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+                    uint32_t loop_count = fps_info_->GetMeasurementLoopCount();
+
+                    if (loop_count > 1)
+                    {
+                        file_processor_->LoopFrames(frame_count, loop_count);
+                    }
+                    else
+                    {
+                        file_processor_->PreloadFrames(frame_count);
+                    }
+                }
+
                 if (fps_info_->ShouldWaitIdleBeforeFrame(frame_number))
                 {
                     file_processor_->WaitDecodersIdle();
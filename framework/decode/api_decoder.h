@@ -78,6 +78,14 @@ class ApiDecoder
 
     virtual void DispatchFrameEndMarker(uint64_t frame_number) = 0;
 
+    virtual void DispatchFrameLoopBegin(uint64_t frame_number) = 0;
+
+    virtual void DispatchFrameLoopRestart(uint64_t frame_number) = 0;
+
+    // Returns false if the function call cannot be processed again by the next repetition of a looped frame range,
+    // such as a call that creates or destroys objects.
+    virtual bool SupportsFrameLoop(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size) = 0;
+
     virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) = 0;
 
     virtual void DispatchDriverInfo(format::ThreadId thread_id, format::DriverInfoBlock& info) = 0;
@@ -190,6 +198,10 @@ class ApiDecoder
 
     virtual void SetCurrentBlockIndex(uint64_t block_index){};
 
+    // Returns true if the function call, which was selected by the filter of a ThreadedCallDispatcher, may be decoded
+    // on a worker thread while the calls selected for other queues are decoded concurrently.
+    virtual bool SupportsThreadedDecoding(format::ApiCallId call_id) { return false; }
+
     virtual void DispatchSetTlasToBlasDependencyCommand(format::HandleId                     tlas,
                                                         const std::vector<format::HandleId>& blases){};
 };
@@ -0,0 +1,337 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_read_ahead.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limit on the blocks retained for reuse by the reader thread, to avoid holding on to the memory from occasional large
+// blocks such as fill memory commands.
+const size_t kMaxFreeBlocks        = 64;
+const size_t kMaxFreeBlockCapacity = 1024 * 1024;
+
+BlockReadAhead::BlockReadAhead(ReadFunction            read_function,
+                               format::CompressionType compression_type,
+                               size_t                  max_queue_bytes) :
+    read_function_(read_function),
+    compressor_(format::CreateCompressor(compression_type)), queued_bytes_(0), max_queue_bytes_(max_queue_bytes),
+    stop_(false)
+{}
+
+BlockReadAhead::~BlockReadAhead()
+{
+    Stop();
+
+    if (statistics_.blocks_read > 0)
+    {
+        GFXRECON_LOG_INFO("Block read-ahead: read %" PRIu64 " blocks (%" PRIu64 " bytes), decompressed %" PRIu64
+                          " blocks; decoding waited for the reader %" PRIu64 " times for %.3f ms, reader waited for "
+                          "the decoder %" PRIu64 " times",
+                          statistics_.blocks_read,
+                          statistics_.bytes_read,
+                          statistics_.blocks_decompressed,
+                          statistics_.consumer_wait_count,
+                          util::datetime::ConvertTimestampToMilliseconds(statistics_.consumer_wait_time),
+                          statistics_.reader_stall_count);
+    }
+}
+
+void BlockReadAhead::Start()
+{
+    GFXRECON_ASSERT(!reader_thread_.joinable());
+
+    stop_          = false;
+    reader_thread_ = std::thread(&BlockReadAhead::ReaderThreadMain, this);
+}
+
+void BlockReadAhead::Stop()
+{
+    if (reader_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            stop_ = true;
+        }
+
+        queue_not_full_.notify_one();
+        reader_thread_.join();
+    }
+
+    while (!queue_.empty())
+    {
+        RecycleBlock(&queue_.front());
+        queue_.pop_front();
+    }
+
+    RecycleBlock(&current_block_);
+    queued_bytes_ = 0;
+}
+
+const BlockReadAhead::Block* BlockReadAhead::NextBlock()
+{
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+
+    RecycleBlock(&current_block_);
+
+    if (queue_.empty())
+    {
+        if (!reader_thread_.joinable())
+        {
+            current_block_.end_of_file = true;
+            return &current_block_;
+        }
+
+        int64_t start_time = util::datetime::GetTimestamp();
+
+        queue_not_empty_.wait(lock, [this]() { return !queue_.empty(); });
+
+        ++statistics_.consumer_wait_count;
+        statistics_.consumer_wait_time += util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+    }
+
+    if (queue_.front().end_of_file)
+    {
+        // Leave the end of file block in the queue, so that it is also returned by subsequent calls.
+        current_block_.end_of_file = true;
+        return &current_block_;
+    }
+
+    current_block_ = std::move(queue_.front());
+    queue_.pop_front();
+    queued_bytes_ -= (current_block_.data.size() + current_block_.uncompressed_data.size());
+
+    lock.unlock();
+    queue_not_full_.notify_one();
+
+    return &current_block_;
+}
+
+void BlockReadAhead::SetCompressionDictionary(const uint8_t* dictionary, size_t dictionary_size)
+{
+    GFXRECON_ASSERT(!reader_thread_.joinable());
+
+    if (compressor_ != nullptr)
+    {
+        compressor_->SetDictionary(dictionary, dictionary_size);
+    }
+}
+
+BlockReadAhead::Statistics BlockReadAhead::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return statistics_;
+}
+
+void BlockReadAhead::ReaderThreadMain()
+{
+    bool end_of_file = false;
+
+    while (!end_of_file)
+    {
+        Block block;
+
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+
+            if (!stop_ && (queued_bytes_ >= max_queue_bytes_))
+            {
+                ++statistics_.reader_stall_count;
+                queue_not_full_.wait(lock, [this]() { return stop_ || (queued_bytes_ < max_queue_bytes_); });
+            }
+
+            if (stop_)
+            {
+                break;
+            }
+
+            if (!free_blocks_.empty())
+            {
+                block = std::move(free_blocks_.back());
+                free_blocks_.pop_back();
+            }
+        }
+
+        // The end of file block is queued after the last block, including a block that was only partially read.
+        end_of_file = !ReadBlock(read_function_, compressor_.get(), &block);
+
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+
+            if (!block.end_of_file)
+            {
+                ++statistics_.blocks_read;
+                statistics_.bytes_read += sizeof(block.header) + block.data.size();
+
+                if (block.decompressed)
+                {
+                    ++statistics_.blocks_decompressed;
+                }
+            }
+
+            queued_bytes_ += block.data.size() + block.uncompressed_data.size();
+            queue_.emplace_back(std::move(block));
+
+            if (end_of_file && !queue_.back().end_of_file)
+            {
+                Block end_block;
+                end_block.end_of_file = true;
+                queue_.emplace_back(std::move(end_block));
+            }
+        }
+
+        queue_not_empty_.notify_one();
+    }
+}
+
+bool BlockReadAhead::ReadBlock(const ReadFunction& read_function, util::Compressor* compressor, Block* block)
+{
+    assert(block != nullptr);
+
+    if (read_function(&block->header, sizeof(block->header)) != sizeof(block->header))
+    {
+        block->end_of_file = true;
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block->header.size);
+    const size_t block_size = static_cast<size_t>(block->header.size);
+
+    block->data.resize(block_size);
+    size_t bytes_read = read_function(block->data.data(), block_size);
+
+    if (bytes_read < block_size)
+    {
+        block->data.resize(bytes_read);
+        return false;
+    }
+
+    DecompressBlock(compressor, block);
+
+    return true;
+}
+
+void BlockReadAhead::DecompressBlock(util::Compressor* compressor, Block* block)
+{
+    assert(block != nullptr);
+
+    if ((compressor == nullptr) || !format::IsBlockCompressed(block->header.type))
+    {
+        return;
+    }
+
+    // Determine the size of the uncompressed fields that precede the uncompressed size and compressed data.
+    size_t prefix_size = 0;
+
+    switch (format::RemoveCompressedBlockBit(block->header.type))
+    {
+        case format::BlockType::kFunctionCallBlock:
+            prefix_size = sizeof(format::ApiCallId) + sizeof(format::ThreadId);
+            break;
+        case format::BlockType::kMethodCallBlock:
+            prefix_size = sizeof(format::ApiCallId) + sizeof(format::HandleId) + sizeof(format::ThreadId);
+            break;
+        case format::BlockType::kMetaDataBlock:
+        {
+            format::MetaDataId meta_data_id = 0;
+
+            if (block->data.size() >= sizeof(meta_data_id))
+            {
+                memcpy(&meta_data_id, block->data.data(), sizeof(meta_data_id));
+
+                if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand)
+                {
+                    // The memory size field of the fill memory command header is the uncompressed size.
+                    prefix_size = sizeof(meta_data_id) + sizeof(format::ThreadId) + sizeof(format::HandleId) +
+                                  sizeof(uint64_t);
+                }
+                else if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryBlobCommand)
+                {
+                    // The blob command header has the blob ID before the fill memory command fields.
+                    prefix_size = sizeof(meta_data_id) + sizeof(format::ThreadId) + sizeof(uint64_t) +
+                                  sizeof(format::HandleId) + sizeof(uint64_t);
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    uint64_t uncompressed_size = 0;
+
+    if ((prefix_size == 0) || (block->data.size() <= (prefix_size + sizeof(uncompressed_size))))
+    {
+        return;
+    }
+
+    memcpy(&uncompressed_size, block->data.data() + prefix_size, sizeof(uncompressed_size));
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+    const size_t expected_size = static_cast<size_t>(uncompressed_size);
+
+    block->compressed_offset = prefix_size + sizeof(uncompressed_size);
+    block->uncompressed_data.resize(expected_size);
+
+    size_t actual_size = compressor->Decompress(block->data.size() - block->compressed_offset,
+                                                block->data.data() + block->compressed_offset,
+                                                expected_size,
+                                                &block->uncompressed_data);
+
+    // On failure, the decoding thread decompresses the block itself and reports the error.
+    block->decompressed = ((actual_size > 0) && (actual_size == expected_size));
+
+    if (!block->decompressed)
+    {
+        block->uncompressed_data.clear();
+    }
+}
+
+void BlockReadAhead::RecycleBlock(Block* block)
+{
+    assert(block != nullptr);
+
+    if ((free_blocks_.size() < kMaxFreeBlocks) && (block->data.capacity() <= kMaxFreeBlockCapacity) &&
+        (block->uncompressed_data.capacity() <= kMaxFreeBlockCapacity))
+    {
+        // Only the buffers are reused.
+        Block free_block;
+        free_block.data              = std::move(block->data);
+        free_block.uncompressed_data = std::move(block->uncompressed_data);
+        free_block.data.clear();
+        free_block.uncompressed_data.clear();
+        free_blocks_.emplace_back(std::move(free_block));
+    }
+
+    *block = Block();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,133 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+/// @file Reading and decompressing capture file blocks ahead of decoding.
+
+#ifndef GFXRECON_DECODE_BLOCK_READ_AHEAD_H
+#define GFXRECON_DECODE_BLOCK_READ_AHEAD_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+/// @brief Reads capture file blocks on a dedicated thread into a bounded queue of ready-to-decode buffers.
+///
+/// The reader thread stays up to a configured number of bytes ahead of the decoding thread. Compressed function call,
+/// method call, and fill memory blocks are also decompressed by the reader thread, so the decoding thread only has to
+/// work with data that is already in memory. Statistics record how often the decoding thread had to wait for the
+/// reader, which indicates whether replay is limited by file I/O and decompression or by decoding and the GPU.
+class BlockReadAhead
+{
+  public:
+    /// @brief Reads up to size bytes from the capture file into buffer. Returns the number of bytes read.
+    typedef std::function<size_t(void* buffer, size_t size)> ReadFunction;
+
+    struct Block
+    {
+        format::BlockHeader  header{};
+        std::vector<uint8_t> data;                   // Block body. Shorter than header.size if the file is truncated.
+        std::vector<uint8_t> uncompressed_data;      // Decompressed parameter data, when decompressed is true.
+        size_t               compressed_offset{ 0 }; // Offset of the compressed parameter data in data.
+        bool                 decompressed{ false };
+        bool                 end_of_file{ false }; // No block was read because the end of the file was reached.
+
+        bool IsComplete() const { return (!end_of_file && (data.size() == header.size)); }
+    };
+
+    struct Statistics
+    {
+        uint64_t blocks_read{ 0 };
+        uint64_t bytes_read{ 0 };
+        uint64_t blocks_decompressed{ 0 };
+        uint64_t consumer_wait_count{ 0 };
+        int64_t  consumer_wait_time{ 0 }; // Nanoseconds the decoding thread spent waiting for the reader thread.
+        uint64_t reader_stall_count{ 0 }; // Number of times the reader thread waited for space in the queue.
+    };
+
+    static const size_t kDefaultMaxQueueBytes = 16 * 1024 * 1024;
+
+    /// @param compression_type Compression type of the capture file, used to decompress blocks on the reader thread.
+    /// @param max_queue_bytes Amount of block data that the reader thread may read ahead of the decoding thread.
+    BlockReadAhead(ReadFunction read_function, format::CompressionType compression_type, size_t max_queue_bytes);
+
+    ~BlockReadAhead();
+
+    /// @brief Start reading blocks from the current file position.
+    void Start();
+
+    /// @brief Stop the reader thread and discard all blocks that have not been retrieved with NextBlock(). The file
+    /// must be repositioned before calling Start() again.
+    void Stop();
+
+    /// @brief Retrieve the next block, waiting for the reader thread if necessary. The returned block remains valid
+    /// until the next call to NextBlock() or Stop().
+    const Block* NextBlock();
+
+    Statistics GetStatistics();
+
+    /// @brief Read the next block from the file and decompress it if it is compressed and compressor is not null.
+    /// @return False if the end of the file was reached before a complete block could be read. The block is marked as
+    /// end_of_file if no part of the block could be read.
+    static bool ReadBlock(const ReadFunction& read_function, util::Compressor* compressor, Block* block);
+
+    /// @brief Load a compression dictionary into the reader thread's compressor. May only be called while the reader
+    /// thread is stopped.
+    void SetCompressionDictionary(const uint8_t* dictionary, size_t dictionary_size);
+
+  private:
+    void ReaderThreadMain();
+
+    static void DecompressBlock(util::Compressor* compressor, Block* block);
+
+    void RecycleBlock(Block* block);
+
+  private:
+    ReadFunction                      read_function_;
+    std::unique_ptr<util::Compressor> compressor_;
+    std::mutex                        queue_mutex_;
+    std::condition_variable           queue_not_empty_;
+    std::condition_variable           queue_not_full_;
+    std::deque<Block>                 queue_;
+    std::vector<Block>                free_blocks_;
+    Block                             current_block_;
+    size_t                            queued_bytes_;
+    size_t                            max_queue_bytes_;
+    bool                              stop_;
+    std::thread                       reader_thread_;
+    Statistics                        statistics_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_READ_AHEAD_H
@@ -400,5 +400,534 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
     }
 }
 
+void FieldToJson(util::JsonStreamWriter&                               jdata,
+                 VkGeometryTypeKHR                                     discriminant,
+                 const Decoded_VkAccelerationStructureGeometryDataKHR* data,
+                 const JsonOptions&                                    options)
+{
+    if (data)
+    {
+        switch (discriminant)
+        {
+            case VkGeometryTypeKHR::VK_GEOMETRY_TYPE_TRIANGLES_KHR:
+                jdata.BeginObject();
+                jdata.Key("triangles");
+                FieldToJson(jdata, data->triangles, options);
+                jdata.EndObject();
+                break;
+            case VkGeometryTypeKHR::VK_GEOMETRY_TYPE_AABBS_KHR:
+                jdata.BeginObject();
+                jdata.Key("aabbs");
+                FieldToJson(jdata, data->aabbs, options);
+                jdata.EndObject();
+                break;
+            case VkGeometryTypeKHR::VK_GEOMETRY_TYPE_INSTANCES_KHR:
+                jdata.BeginObject();
+                jdata.Key("instances");
+                FieldToJson(jdata, data->instances, options);
+                jdata.EndObject();
+                break;
+            default:
+                jdata.String("Unknown GeometryType: " + std::to_string(discriminant));
+        }
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter&                           jdata,
+                 const Decoded_VkAccelerationStructureGeometryKHR* data,
+                 const JsonOptions&                                options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("sType");
+        FieldToJson(jdata, decoded_value.sType, options);
+        jdata.Key("geometryType");
+        FieldToJson(jdata, decoded_value.geometryType, options);
+        jdata.Key("geometry");
+        FieldToJson(jdata, decoded_value.geometryType, meta_struct.geometry, options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_VkClearValue* data, const JsonOptions& options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("color");
+        FieldToJson(jdata, meta_struct.color, options);
+        jdata.Key("depthStencil");
+        jdata.BeginObject();
+        jdata.Key("depth");
+        FieldToJson(jdata, decoded_value.depthStencil.depth, options);
+        jdata.Key("stencil");
+        FieldToJson(jdata, decoded_value.depthStencil.stencil, options);
+        jdata.EndObject();
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_VkClearColorValue* data, const JsonOptions& options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        jdata.BeginObject();
+        jdata.Key("float32");
+        FieldToJson(jdata, decoded_value.float32, 4, options);
+        jdata.Key("int32");
+        FieldToJson(jdata, decoded_value.int32, 4, options);
+        jdata.Key("uint32");
+        FieldToJson(jdata, decoded_value.uint32, 4, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter&                      jdata,
+                 int                                          discriminant,
+                 const Decoded_VkDeviceOrHostAddressConstKHR* data,
+                 const JsonOptions&                           options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        switch (discriminant)
+        {
+            case 0:
+                jdata.BeginObject();
+                jdata.Key("deviceAddress");
+                FieldToJsonAsHex(jdata, decoded_value.deviceAddress, options);
+                jdata.EndObject();
+                return;
+            case 1:
+                jdata.BeginObject();
+                jdata.Key("hostAddress");
+                FieldToJsonAsHex(jdata, decoded_value.hostAddress, options);
+                jdata.EndObject();
+                return;
+        }
+    }
+
+    jdata.Null();
+}
+
+void FieldToJson(util::JsonStreamWriter&                      jdata,
+                 const Decoded_VkDeviceOrHostAddressConstKHR* data,
+                 const JsonOptions&                           options)
+{
+    FieldToJson(jdata, 0, data, options);
+}
+
+void FieldToJson(util::JsonStreamWriter&                 jdata,
+                 int                                     discriminant,
+                 const Decoded_VkDeviceOrHostAddressKHR* data,
+                 const JsonOptions&                      options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        switch (discriminant)
+        {
+            case 0:
+                jdata.BeginObject();
+                jdata.Key("deviceAddress");
+                FieldToJsonAsHex(jdata, decoded_value.deviceAddress, options);
+                jdata.EndObject();
+                return;
+            case 1:
+                jdata.BeginObject();
+                jdata.Key("hostAddress");
+                FieldToJsonAsHex(jdata, decoded_value.hostAddress, options);
+                jdata.EndObject();
+                return;
+        }
+    }
+
+    jdata.Null();
+}
+
+void FieldToJson(util::JsonStreamWriter&                 jdata,
+                 const Decoded_VkDeviceOrHostAddressKHR* data,
+                 const JsonOptions&                      options)
+{
+    FieldToJson(jdata, 0, data, options);
+}
+
+void FieldToJson(util::JsonStreamWriter&                              jdata,
+                 VkPipelineExecutableStatisticFormatKHR               discriminant,
+                 const Decoded_VkPipelineExecutableStatisticValueKHR* data,
+                 const JsonOptions&                                   options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        switch (discriminant)
+        {
+            case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_BOOL32_KHR:
+                jdata.BeginObject();
+                jdata.Key("b32");
+                jdata.Bool(static_cast<bool>(decoded_value.b32));
+                jdata.EndObject();
+                return;
+            case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_INT64_KHR:
+                jdata.BeginObject();
+                jdata.Key("i64");
+                jdata.Int(decoded_value.i64);
+                jdata.EndObject();
+                return;
+            case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_UINT64_KHR:
+                jdata.BeginObject();
+                jdata.Key("u64");
+                jdata.Uint(decoded_value.u64);
+                jdata.EndObject();
+                return;
+            case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_FLOAT64_KHR:
+                jdata.BeginObject();
+                jdata.Key("f64");
+                jdata.Double(decoded_value.f64);
+                jdata.EndObject();
+                return;
+            case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_MAX_ENUM_KHR:
+                GFXRECON_LOG_WARNING("Invalid format: VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_MAX_ENUM_KHR");
+        }
+    }
+
+    jdata.Null();
+}
+
+void FieldToJson(util::JsonStreamWriter&                         jdata,
+                 const Decoded_VkPipelineExecutableStatisticKHR* data,
+                 const JsonOptions&                              options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("sType");
+        FieldToJson(jdata, decoded_value.sType, options);
+        jdata.Key("name");
+        FieldToJson(jdata, &meta_struct.name, options);
+        jdata.Key("description");
+        FieldToJson(jdata, &meta_struct.description, options);
+        jdata.Key("format");
+        FieldToJson(jdata, decoded_value.format, options);
+        jdata.Key("value");
+        FieldToJson(jdata, decoded_value.format, meta_struct.value, options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_VkDescriptorImageInfo* data, const JsonOptions& options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("sampler");
+        HandleToJson(jdata, meta_struct.sampler, options);
+        jdata.Key("imageView");
+        HandleToJson(jdata, meta_struct.imageView, options);
+        jdata.Key("imageLayout");
+        HandleToJson(jdata, decoded_value.imageLayout, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_VkWriteDescriptorSet* data, const JsonOptions& options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("sType");
+        FieldToJson(jdata, decoded_value.sType, options);
+        jdata.Key("dstSet");
+        HandleToJson(jdata, meta_struct.dstSet, options);
+        jdata.Key("dstBinding");
+        FieldToJson(jdata, decoded_value.dstBinding, options);
+        jdata.Key("dstArrayElement");
+        FieldToJson(jdata, decoded_value.dstArrayElement, options);
+        jdata.Key("descriptorCount");
+        FieldToJson(jdata, decoded_value.descriptorCount, options);
+        jdata.Key("descriptorType");
+        FieldToJson(jdata, decoded_value.descriptorType, options);
+        switch (decoded_value.descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            case VK_DESCRIPTOR_TYPE_SAMPLE_WEIGHT_IMAGE_QCOM:
+            case VK_DESCRIPTOR_TYPE_BLOCK_MATCH_IMAGE_QCOM:
+                jdata.Key("pImageInfo");
+                FieldToJson(jdata, meta_struct.pImageInfo, options);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                jdata.Key("pBufferInfo");
+                FieldToJson(jdata, meta_struct.pBufferInfo, options);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                jdata.Key("pTexelBufferView");
+                HandleToJson(jdata, &meta_struct.pTexelBufferView, options);
+                break;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                // Nothing to do here for acceleration structures as the rest of the data is stored
+                // in the pNext chain
+                break;
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            case VK_DESCRIPTOR_TYPE_MUTABLE_EXT:
+                GFXRECON_LOG_WARNING("Descriptor type not supported at " __FILE__ ", line: %d.", __LINE__);
+                break;
+            case VK_DESCRIPTOR_TYPE_MAX_ENUM:
+                GFXRECON_LOG_WARNING("Invalid descriptor type: VK_DESCRIPTOR_TYPE_MAX_ENUM");
+        }
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter&                    jdata,
+                 const VkPerformanceValueTypeINTEL          discriminant,
+                 const Decoded_VkPerformanceValueDataINTEL* data,
+                 const JsonOptions&                         options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        switch (discriminant)
+        {
+            case VK_PERFORMANCE_VALUE_TYPE_UINT32_INTEL:
+                jdata.BeginObject();
+                jdata.Key("value32");
+                FieldToJson(jdata, decoded_value.value32, options);
+                jdata.EndObject();
+                return;
+            case VK_PERFORMANCE_VALUE_TYPE_UINT64_INTEL:
+                jdata.BeginObject();
+                jdata.Key("value64");
+                FieldToJson(jdata, decoded_value.value64, options);
+                jdata.EndObject();
+                return;
+            case VK_PERFORMANCE_VALUE_TYPE_FLOAT_INTEL:
+                jdata.BeginObject();
+                jdata.Key("valueFloat");
+                FieldToJson(jdata, decoded_value.valueFloat, options);
+                jdata.EndObject();
+                return;
+            case VK_PERFORMANCE_VALUE_TYPE_BOOL_INTEL:
+                jdata.BeginObject();
+                jdata.Key("valueBool");
+                FieldToJson(jdata, decoded_value.valueBool, options);
+                jdata.EndObject();
+                return;
+            case VK_PERFORMANCE_VALUE_TYPE_STRING_INTEL:
+                jdata.BeginObject();
+                jdata.Key("valueString");
+                FieldToJson(jdata, meta_struct.valueString, options);
+                jdata.EndObject();
+                return;
+            case VK_PERFORMANCE_VALUE_TYPE_MAX_ENUM_INTEL:
+                GFXRECON_LOG_WARNING("Invalid performance value type: VK_PERFORMANCE_VALUE_TYPE_MAX_ENUM_INTEL");
+        }
+    }
+
+    jdata.Null();
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_VkPerformanceValueINTEL* data, const JsonOptions& options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("type");
+        FieldToJson(jdata, decoded_value.type, options);
+        jdata.Key("data");
+        FieldToJson(jdata, decoded_value.type, meta_struct.data, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter&                 jdata,
+                 const Decoded_VkShaderModuleCreateInfo* data,
+                 const JsonOptions&                      options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("sType");
+        FieldToJson(jdata, decoded_value.sType, options);
+        jdata.Key("flags");
+        FieldToJson(VkShaderModuleCreateFlags_t(), jdata, decoded_value.flags, options);
+        jdata.Key("codeSize");
+        FieldToJson(jdata, decoded_value.codeSize, options);
+        // Use "[Binary data]" as placeholder. It will be replaced with a file path if the JSON
+        // consumer decides to dump binaries in separate files.
+        jdata.Key("pCode");
+        FieldToJson(jdata, "[Binary data]", options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_SECURITY_ATTRIBUTES* data, const JsonOptions& options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("bInheritHandle");
+        jdata.Bool(static_cast<bool>(decoded_value.bInheritHandle));
+        jdata.Key("nLength");
+        FieldToJson(jdata, decoded_value.nLength, options);
+        jdata.Key("lpSecurityDescriptor");
+        FieldToJson(jdata, meta_struct.lpSecurityDescriptor->GetAddress(), options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter&                  jdata,
+                 const Decoded_VkPipelineCacheCreateInfo* data,
+                 const JsonOptions&                       options)
+{
+    if (data && data->decoded_value)
+    {
+        const auto& decoded_value = *data->decoded_value;
+        const auto& meta_struct   = *data;
+        jdata.BeginObject();
+        jdata.Key("sType");
+        FieldToJson(jdata, decoded_value.sType, options);
+        jdata.Key("flags");
+        FieldToJson(VkPipelineCacheCreateFlags_t(), jdata, decoded_value.flags, options);
+        jdata.Key("initialDataSize");
+        FieldToJson(jdata, decoded_value.initialDataSize, options);
+        // Use "[Binary data]" as placeholder. It will be replaced with a file path if the JSON
+        // consumer decides to dump binaries in separate files.
+        jdata.Key("pInitialData");
+        FieldToJson(jdata, "[Binary data]", options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter&                      jdata,
+                 const DescriptorUpdateTemplateDecoder* const pData,
+                 const JsonOptions&                           options)
+{
+    if (pData)
+    {
+        jdata.BeginObject();
+
+        const size_t image_info_count = pData->GetImageInfoCount();
+        jdata.Key("imageInfos");
+        jdata.BeginArray();
+        for (size_t image_info_index = 0; image_info_index < image_info_count; ++image_info_index)
+        {
+            FieldToJson(jdata, pData->GetImageInfoMetaStructPointer() + image_info_index, options);
+        }
+        jdata.EndArray();
+
+        const size_t buffer_info_count = pData->GetBufferInfoCount();
+        jdata.Key("bufferInfos");
+        jdata.BeginArray();
+        for (size_t buffer_info_index = 0; buffer_info_index < buffer_info_count; ++buffer_info_index)
+        {
+            FieldToJson(jdata, pData->GetBufferInfoMetaStructPointer() + buffer_info_index, options);
+        }
+        jdata.EndArray();
+
+        const size_t texel_buffer_view_count = pData->GetTexelBufferViewCount();
+        if (texel_buffer_view_count > 0)
+        {
+            jdata.Key("bufferViews");
+            HandleToJson(jdata, pData->GetTexelBufferViewHandleIdsPointer(), texel_buffer_view_count, options);
+        }
+
+        const size_t acceleration_structure_count = pData->GetAccelerationStructureKHRCount();
+        if (acceleration_structure_count > 0)
+        {
+            jdata.Key("accelStructViews");
+            HandleToJson(
+                jdata, pData->GetAccelerationStructureKHRHandleIdsPointer(), acceleration_structure_count, options);
+        }
+
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -111,6 +111,77 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
                  const DescriptorUpdateTemplateDecoder* const pData,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
+void FieldToJson(util::JsonStreamWriter&     jdata,
+                 const Decoded_VkClearValue* data,
+                 const util::JsonOptions&    options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&          jdata,
+                 const Decoded_VkClearColorValue* data,
+                 const util::JsonOptions&         options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                      jdata,
+                 int                                          discriminant,
+                 const Decoded_VkDeviceOrHostAddressConstKHR* data,
+                 const util::JsonOptions&                     options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                      jdata,
+                 const Decoded_VkDeviceOrHostAddressConstKHR* data,
+                 const util::JsonOptions&                     options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                 jdata,
+                 int                                     discriminant,
+                 const Decoded_VkDeviceOrHostAddressKHR* data,
+                 const util::JsonOptions&                options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                 jdata,
+                 const Decoded_VkDeviceOrHostAddressKHR* data,
+                 const util::JsonOptions&                options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                              jdata,
+                 VkPipelineExecutableStatisticFormatKHR               discriminant,
+                 const Decoded_VkPipelineExecutableStatisticValueKHR* data,
+                 const util::JsonOptions&                             options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                         jdata,
+                 const Decoded_VkPipelineExecutableStatisticKHR* data,
+                 const util::JsonOptions&                        options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&            jdata,
+                 const Decoded_SECURITY_ATTRIBUTES* data,
+                 const util::JsonOptions&           options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                               jdata,
+                 const Decoded_VkAccelerationStructureGeometryDataKHR* data,
+                 const util::JsonOptions&                              options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                           jdata,
+                 const Decoded_VkAccelerationStructureGeometryKHR* data,
+                 const util::JsonOptions&                          options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&              jdata,
+                 const Decoded_VkDescriptorImageInfo* data,
+                 const util::JsonOptions&             options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&             jdata,
+                 const Decoded_VkWriteDescriptorSet* data,
+                 const util::JsonOptions&            options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                jdata,
+                 const Decoded_VkPerformanceValueINTEL* data,
+                 const util::JsonOptions&               options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                 jdata,
+                 const Decoded_VkShaderModuleCreateInfo* data,
+                 const util::JsonOptions&                options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                  jdata,
+                 const Decoded_VkPipelineCacheCreateInfo* data,
+                 const util::JsonOptions&                 options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&                      jdata,
+                 const DescriptorUpdateTemplateDecoder* const pData,
+                 const util::JsonOptions&                     options = util::JsonOptions());
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
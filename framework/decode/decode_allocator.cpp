@@ -26,13 +26,13 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+thread_local std::unique_ptr<DecodeAllocator> DecodeAllocator::instance_;
 
 void DecodeAllocator::Begin()
 {
     if (instance_ == nullptr)
     {
-        instance_ = new DecodeAllocator();
+        instance_.reset(new DecodeAllocator());
     }
     assert(!instance_->can_allocate_);
     instance_->can_allocate_ = true;
@@ -66,8 +66,7 @@ void DecodeAllocator::FreeSystemMemory()
 
 void DecodeAllocator::DestroyInstance()
 {
-    delete instance_;
-    instance_ = nullptr;
+    instance_.reset();
 }
 
 GFXRECON_END_NAMESPACE(decode)
@@ -27,14 +27,19 @@
 #include "util/defines.h"
 #include "util/monotonic_allocator.h"
 
+#include <memory>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Each thread has its own allocator instance, with its own Begin/End scope, so that blocks can be decoded on several
+// threads at the same time. Memory allocated by one thread may be read by other threads until that thread calls End.
 class DecodeAllocator
 {
   public:
     // Begin must be called before any calls to Allocate (either initially or since End was called). This ensures
-    // allocations are not made outside the intended scope. Also creates the allocator instance if it is nullptr.
+    // allocations are not made outside the intended scope. Also creates the calling thread's allocator instance if it
+    // does not exist.
     static void Begin();
 
     template <typename T>
@@ -55,15 +60,19 @@ class DecodeAllocator
     // Free system memory blocks. Must not be called between Begin and End
     static void FreeSystemMemory();
 
-    // Destroy the allocator instance. This will also frees all allocated memory.
+    // Destroy the calling thread's allocator instance. This will also frees all allocated memory. Instances of other
+    // threads are destroyed when the thread exits.
     static void DestroyInstance();
 
   private:
-    DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false), end_can_clear_(true) {}
+    DecodeAllocator() :
+        allocator_(kAllocatorBlockSize, kMaxAllocatorBlockSize), can_allocate_(false), end_can_clear_(true)
+    {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t                                  kAllocatorBlockSize{ 64 * 1024 };
+    static const size_t                                  kMaxAllocatorBlockSize{ 4 * 1024 * 1024 };
+    static thread_local std::unique_ptr<DecodeAllocator> instance_;
 
     util::MonotonicAllocator allocator_;
     bool                     can_allocate_;
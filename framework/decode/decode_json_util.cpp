@@ -154,5 +154,181 @@ void Bool32ToJson(nlohmann::ordered_json& jdata, const PointerDecoder<int, int>*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const StringDecoder& data, const JsonOptions& options)
+{
+    const char* const decoded_data = data.GetPointer();
+    if (decoded_data)
+    {
+        FieldToJson(jdata, decoded_data, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const StringDecoder* data, const JsonOptions& options)
+{
+    if (data)
+    {
+        FieldToJson(jdata, *data, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const StringArrayDecoder& data, const JsonOptions& options)
+{
+    FieldToJson(jdata, &data, options);
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const StringArrayDecoder* data, const JsonOptions& options)
+{
+    if (data && data->GetPointer() && (data->GetLength() > 0))
+    {
+        const auto decoded_data = data->GetPointer();
+        jdata.BeginArray();
+        for (size_t i = 0; i < data->GetLength(); ++i)
+        {
+            jdata.String(decoded_data[i]);
+        }
+        jdata.EndArray();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const WStringDecoder& data, const JsonOptions& options)
+{
+    const wchar_t* const decoded_data = data.GetPointer();
+    if (decoded_data)
+    {
+        FieldToJson(jdata, decoded_data, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const WStringDecoder* data, const JsonOptions& options)
+{
+    if (data)
+    {
+        FieldToJson(jdata, *data, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const WStringArrayDecoder& data, const JsonOptions& options)
+{
+    const auto decoded_data = data.GetPointer();
+    if (decoded_data && (data.GetLength() > 0))
+    {
+        jdata.BeginArray();
+        for (size_t i = 0; i < data.GetLength(); ++i)
+        {
+            FieldToJson(jdata, decoded_data[i], options);
+        }
+        jdata.EndArray();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+template <>
+void FieldToJson(util::JsonStreamWriter&                   jdata,
+                 const PointerDecoder<uint64_t, uint64_t>& data,
+                 const JsonOptions&                        options)
+{
+    if (data.GetPointer())
+    {
+        const auto decoded_value = data.GetPointer();
+        const auto length        = data.GetLength();
+        if (length > 1)
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                jdata.Uint(decoded_value[i]);
+            }
+            jdata.EndArray();
+        }
+        else
+        {
+            jdata.Uint(*decoded_value);
+        }
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void Bool32ToJson(util::JsonStreamWriter&                   jdata,
+                  const PointerDecoder<uint32_t, uint32_t>* data,
+                  const util::JsonOptions&                  options)
+{
+    if (data && data->GetPointer())
+    {
+        const auto decoded_value = data->GetPointer();
+        const auto length        = data->GetLength();
+
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                util::Bool32ToJson(jdata, decoded_value[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            util::Bool32ToJson(jdata, *decoded_value, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+void Bool32ToJson(util::JsonStreamWriter& jdata, const PointerDecoder<int, int>* data, const util::JsonOptions& options)
+{
+    if (data && data->GetPointer())
+    {
+        const auto decoded_value = data->GetPointer();
+        const auto length        = data->GetLength();
+
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                util::Bool32ToJson(jdata, decoded_value[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            util::Bool32ToJson(jdata, *decoded_value, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
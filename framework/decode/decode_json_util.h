@@ -289,6 +289,292 @@ void Bool32ToJson(nlohmann::ordered_json&         jdata,
                   const PointerDecoder<int, int>* data,
                   const util::JsonOptions&        options = util::JsonOptions());
 
+/// @defgroup DecodeJsonStream Versions of the conversions above which write straight to a
+/// util::JsonStreamWriter. Each writes exactly one value, with a null standing in for the node
+/// that the tree version leaves untouched.
+/// @{
+
+void FieldToJson(util::JsonStreamWriter&  jdata,
+                 const StringDecoder&     data,
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&  jdata,
+                 const StringDecoder*     data,
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&   jdata,
+                 const StringArrayDecoder& data,
+                 const util::JsonOptions&  options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&   jdata,
+                 const StringArrayDecoder* data,
+                 const util::JsonOptions&  options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&  jdata,
+                 const WStringDecoder&    data,
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&  jdata,
+                 const WStringDecoder*    data,
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void FieldToJson(util::JsonStreamWriter&    jdata,
+                 const WStringArrayDecoder& data,
+                 const util::JsonOptions&   options = util::JsonOptions());
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJson(util::JsonStreamWriter&                               jdata,
+                 const PointerDecoder<DecodedType, OutputDecodedType>* data,
+                 const util::JsonOptions&                              options = util::JsonOptions())
+{
+    if (data && data->GetPointer())
+    {
+        const auto decoded_value = data->GetPointer();
+        const auto length        = data->GetLength();
+
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                FieldToJson(jdata, decoded_value[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            FieldToJson(jdata, *decoded_value, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJson(util::JsonStreamWriter&                               jdata,
+                 const PointerDecoder<DecodedType, OutputDecodedType>& data,
+                 const util::JsonOptions&                              options = util::JsonOptions())
+{
+    FieldToJson(jdata, &data, options);
+}
+
+template <>
+void FieldToJson(util::JsonStreamWriter&                   jdata,
+                 const PointerDecoder<uint64_t, uint64_t>& data,
+                 const util::JsonOptions&                  options);
+
+template <typename DecodedType>
+void FieldToJson(util::JsonStreamWriter&                  jdata,
+                 const StructPointerDecoder<DecodedType>* data,
+                 const util::JsonOptions&                 options = util::JsonOptions())
+{
+    if (data)
+    {
+        const auto meta_struct = data->GetMetaStructPointer();
+        const auto length      = data->GetLength();
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                FieldToJson(jdata, &meta_struct[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            FieldToJson(jdata, meta_struct, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+template <typename DecodedType>
+void FieldToJson(util::JsonStreamWriter&                   jdata,
+                 const StructPointerDecoder<DecodedType*>* data,
+                 const util::JsonOptions&                  options = util::JsonOptions())
+{
+    if (data)
+    {
+        const auto meta_struct = data->GetMetaStructPointer();
+        const auto length      = data->GetLength();
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                FieldToJson(jdata, meta_struct[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            FieldToJson(jdata, *meta_struct, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+template <typename THandle>
+void HandleToJson(util::JsonStreamWriter&              jdata,
+                  const HandlePointerDecoder<THandle>* data,
+                  const util::JsonOptions&             options = util::JsonOptions())
+{
+    if (data && data->GetPointer())
+    {
+        const auto decoded_value = data->GetPointer();
+        const auto length        = data->GetLength();
+
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                HandleToJson(jdata, decoded_value[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            HandleToJson(jdata, *decoded_value, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+template <typename THandle>
+void FieldToJson(util::JsonStreamWriter&              jdata,
+                 const HandlePointerDecoder<THandle>* data,
+                 const util::JsonOptions&             options = util::JsonOptions())
+{
+    HandleToJson(jdata, data, options);
+}
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJsonAsHex(util::JsonStreamWriter&                               jdata,
+                      const PointerDecoder<DecodedType, OutputDecodedType>* data,
+                      const util::JsonOptions&                              options = util::JsonOptions())
+{
+    if (data && data->GetPointer())
+    {
+        const auto decoded_value = data->GetPointer();
+        const auto length        = data->GetLength();
+
+        if (data->IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                FieldToJsonAsHex(jdata, decoded_value[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data->IsArray() && (length == 1))
+        {
+            FieldToJsonAsHex(jdata, *decoded_value, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJsonAsHex(util::JsonStreamWriter&                               jdata,
+                      const PointerDecoder<DecodedType, OutputDecodedType>& data,
+                      const util::JsonOptions&                              options = util::JsonOptions())
+{
+    FieldToJsonAsHex(jdata, &data, options);
+}
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJsonAsFixedWidthBinary(util::JsonStreamWriter&                               jdata,
+                                   const PointerDecoder<DecodedType, OutputDecodedType>& data,
+                                   const util::JsonOptions&                              options = util::JsonOptions())
+{
+    if (data.GetPointer())
+    {
+        const auto decoded_value = data.GetPointer();
+        const auto length        = data.GetLength();
+
+        if (data.IsArray() && (length > 0))
+        {
+            jdata.BeginArray();
+            for (size_t i = 0; i < length; ++i)
+            {
+                FieldToJsonAsFixedWidthBinary(jdata, decoded_value[i], options);
+            }
+            jdata.EndArray();
+            return;
+        }
+        else if (!data.IsArray() && (length == 1))
+        {
+            FieldToJsonAsFixedWidthBinary(jdata, *decoded_value, options);
+            return;
+        }
+    }
+
+    jdata.Null();
+}
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJsonAsFixedWidthBinary(util::JsonStreamWriter&                               jdata,
+                                   const PointerDecoder<DecodedType, OutputDecodedType>* data,
+                                   const util::JsonOptions&                              options = util::JsonOptions())
+{
+    if (data)
+    {
+        FieldToJsonAsFixedWidthBinary(jdata, *data, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+template <typename DecodedType, typename OutputDecodedType = DecodedType>
+void FieldToJsonAsFixedWidthBinary(util::JsonStreamWriter&                         jdata,
+                                   PointerDecoder<DecodedType, OutputDecodedType>* data,
+                                   const util::JsonOptions&                        options = util::JsonOptions())
+{
+    if (data)
+    {
+        FieldToJsonAsFixedWidthBinary(jdata, *data, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+inline void
+FieldToJsonAsHex(util::JsonStreamWriter& jdata, PointerDecoder<uint64_t, void*>* data, const util::JsonOptions& options)
+{
+    FieldToJsonAsHex<uint64_t, void*>(jdata, data, options);
+}
+
+void Bool32ToJson(util::JsonStreamWriter&                   jdata,
+                  const PointerDecoder<uint32_t, uint32_t>* data,
+                  const util::JsonOptions&                  options = util::JsonOptions());
+
+void Bool32ToJson(util::JsonStreamWriter&         jdata,
+                  const PointerDecoder<int, int>* data,
+                  const util::JsonOptions&        options = util::JsonOptions());
+
+/// @}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -87,6 +87,16 @@ class Dx12DecoderBase : public ApiDecoder
 
     virtual void DispatchFrameEndMarker(uint64_t frame_number) override;
 
+    virtual void DispatchFrameLoopBegin(uint64_t frame_number) override {}
+
+    virtual void DispatchFrameLoopRestart(uint64_t frame_number) override {}
+
+    virtual bool
+    SupportsFrameLoop(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size) override
+    {
+        return true;
+    }
+
     virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override;
 
     virtual void DispatchDriverInfo(format::ThreadId thread_id, format::DriverInfoBlock& info)
@@ -0,0 +1,458 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/file_index.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Matches the frame numbering used by FileProcessor.
+const uint32_t kFirstFrame = 0;
+
+const uint32_t kIndexFileFourCC       = GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'I');
+const uint32_t kIndexFileVersion      = 2;
+const uint32_t kIndexUsesFrameMarkers = 0x1;
+
+struct IndexFileHeader
+{
+    uint32_t fourcc;
+    uint32_t version;
+    uint64_t capture_file_size;
+    uint64_t block_count;
+    uint32_t flags;
+    uint32_t reserved;
+    uint64_t entry_count;
+    uint64_t fill_memory_blob_count; // Fill memory blob entries follow the entries.
+};
+
+static bool GetCaptureFileSize(const std::string& capture_filename, uint64_t* file_size)
+{
+    assert(file_size != nullptr);
+
+    FILE*   file    = nullptr;
+    int32_t result  = util::platform::FileOpen(&file, capture_filename.c_str(), "rb");
+    bool    success = false;
+
+    if ((result == 0) && (file != nullptr))
+    {
+        if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+        {
+            int64_t size = util::platform::FileTell(file);
+            if (size >= 0)
+            {
+                *file_size = static_cast<uint64_t>(size);
+                success    = true;
+            }
+        }
+
+        util::platform::FileClose(file);
+    }
+
+    return success;
+}
+
+static bool IsFrameEndingApiCall(format::ApiCallId call_id)
+{
+    // Same set of calls as FileProcessor::IsFrameDelimiter(), for captures without frame markers.
+    return ((call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR) ||
+            (call_id == format::ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
+            (call_id == format::ApiCallId::ApiCall_IDXGISwapChain_Present) ||
+            (call_id == format::ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+}
+
+FileIndex::FileIndex() : capture_file_size_(0), block_count_(0), uses_frame_markers_(false), valid_(false) {}
+
+void FileIndex::Clear()
+{
+    entries_.clear();
+    frames_.clear();
+    fill_memory_blobs_.clear();
+    capture_file_size_  = 0;
+    block_count_        = 0;
+    uses_frame_markers_ = false;
+    valid_              = false;
+}
+
+bool FileIndex::Build(const std::string& capture_filename)
+{
+    Clear();
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, capture_filename.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", capture_filename.c_str());
+        return false;
+    }
+
+    format::FileHeader file_header;
+    bool               success = (util::platform::FileRead(&file_header, sizeof(file_header), 1, file) == 1);
+
+    success = success && format::ValidateFileHeader(file_header);
+
+    if (success)
+    {
+        // Skip the file options.
+        success = util::platform::FileSeek(
+            file, file_header.num_options * sizeof(format::FileOptionPair), util::platform::FileSeekCurrent);
+    }
+
+    uint64_t block_index        = 0;
+    uint32_t frame_number       = kFirstFrame;
+    bool     frame_start_needed = true;
+
+    while (success)
+    {
+        const int64_t       block_offset = util::platform::FileTell(file);
+        format::BlockHeader block_header;
+
+        if (util::platform::FileRead(&block_header, sizeof(block_header), 1, file) != 1)
+        {
+            // End of file, or an incomplete block header that FileProcessor would also stop at.
+            break;
+        }
+
+        if (frame_start_needed)
+        {
+            AddEntry(kFrameStart, block_offset, block_index, frame_number);
+            frame_start_needed = false;
+        }
+        else if ((block_index % kBlockCheckpointInterval) == 0)
+        {
+            AddEntry(kBlockCheckpoint, block_offset, block_index, frame_number);
+        }
+
+        // Most blocks only need their first field after the block header to be classified.
+        format::BlockType base_type  = format::RemoveCompressedBlockBit(block_header.type);
+        uint64_t          skip_size  = block_header.size;
+        bool              end_frame  = false;
+        uint32_t          first_word = 0;
+
+        if ((base_type == format::BlockType::kFunctionCallBlock) ||
+            (base_type == format::BlockType::kMethodCallBlock) || (base_type == format::BlockType::kMetaDataBlock) ||
+            (block_header.type == format::BlockType::kFrameMarkerBlock) ||
+            (block_header.type == format::BlockType::kStateMarkerBlock))
+        {
+            if ((block_header.size < sizeof(first_word)) ||
+                (util::platform::FileRead(&first_word, sizeof(first_word), 1, file) != 1))
+            {
+                GFXRECON_LOG_WARNING("Incomplete block at end of file");
+                break;
+            }
+
+            skip_size -= sizeof(first_word);
+        }
+
+        if ((base_type == format::BlockType::kFunctionCallBlock) || (base_type == format::BlockType::kMethodCallBlock))
+        {
+            end_frame = !uses_frame_markers_ && IsFrameEndingApiCall(static_cast<format::ApiCallId>(first_word));
+        }
+        else if (block_header.type == format::BlockType::kFrameMarkerBlock)
+        {
+            if (first_word == format::MarkerType::kEndMarker)
+            {
+                if (!uses_frame_markers_)
+                {
+                    // Once a frame marker is found, FileProcessor ignores frame-ending API calls and restarts its
+                    // frame count, so the blocks preceding the first frame marker all belong to the first frame.
+                    uses_frame_markers_ = true;
+                    frame_number        = kFirstFrame;
+
+                    auto first_frame = std::find_if(
+                        entries_.begin(), entries_.end(), [](const Entry& entry) { return entry.type == kFrameStart; });
+                    entries_.erase(std::remove_if(std::next(first_frame),
+                                                  entries_.end(),
+                                                  [](const Entry& entry) { return entry.type == kFrameStart; }),
+                                   entries_.end());
+
+                    for (auto& entry : entries_)
+                    {
+                        entry.frame_number = kFirstFrame;
+                    }
+                }
+
+                end_frame = true;
+            }
+        }
+        else if ((base_type == format::BlockType::kMetaDataBlock) &&
+                 (format::GetMetaDataType(first_word) == format::MetaDataType::kFillMemoryBlobCommand))
+        {
+            // Only the uncompressed blob size is needed from the fields that follow the meta-data ID.
+            format::FillMemoryBlobCommandHeader header;
+            const size_t                        fields_size = sizeof(header) - sizeof(header.meta_header);
+
+            if ((skip_size < fields_size) ||
+                (util::platform::FileRead(&header.thread_id, sizeof(header.thread_id), 1, file) != 1) ||
+                (util::platform::FileRead(&header.blob_id, sizeof(header.blob_id), 1, file) != 1) ||
+                (util::platform::FileRead(&header.memory_id, sizeof(header.memory_id), 1, file) != 1) ||
+                (util::platform::FileRead(&header.memory_offset, sizeof(header.memory_offset), 1, file) != 1) ||
+                (util::platform::FileRead(&header.memory_size, sizeof(header.memory_size), 1, file) != 1))
+            {
+                GFXRECON_LOG_WARNING("Incomplete block at end of file");
+                break;
+            }
+
+            skip_size -= fields_size;
+            fill_memory_blobs_.push_back({ static_cast<uint64_t>(block_offset), header.memory_size });
+        }
+        else if (block_header.type == format::BlockType::kStateMarkerBlock)
+        {
+            if (first_word == format::MarkerType::kBeginMarker)
+            {
+                AddEntry(kStateBegin, block_offset, block_index, frame_number);
+            }
+            else if (first_word == format::MarkerType::kEndMarker)
+            {
+                AddEntry(kStateEnd, block_offset, block_index, frame_number);
+            }
+        }
+
+        if (skip_size > 0)
+        {
+            success = util::platform::FileSeek(file, skip_size, util::platform::FileSeekCurrent);
+        }
+
+        if (success)
+        {
+            ++block_index;
+
+            if (end_frame)
+            {
+                ++frame_number;
+                frame_start_needed = true;
+            }
+        }
+    }
+
+    int64_t file_size = util::platform::FileTell(file);
+    if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+    {
+        file_size = util::platform::FileTell(file);
+    }
+
+    util::platform::FileClose(file);
+
+    if (success && (file_size >= 0))
+    {
+        capture_file_size_ = static_cast<uint64_t>(file_size);
+        block_count_       = block_index;
+        valid_             = true;
+
+        UpdateFrameLookup();
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to build index for capture file %s", capture_filename.c_str());
+        Clear();
+    }
+
+    return valid_;
+}
+
+bool FileIndex::Load(const std::string& index_filename, const std::string& capture_filename)
+{
+    Clear();
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, index_filename.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        return false;
+    }
+
+    IndexFileHeader header{};
+    uint64_t        capture_file_size = 0;
+    bool            success           = (util::platform::FileRead(&header, sizeof(header), 1, file) == 1);
+
+    success = success && (header.fourcc == kIndexFileFourCC) && (header.version == kIndexFileVersion);
+
+    if (!success)
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid capture file index %s", index_filename.c_str());
+    }
+    else if (!GetCaptureFileSize(capture_filename, &capture_file_size) ||
+             (capture_file_size != header.capture_file_size))
+    {
+        GFXRECON_LOG_WARNING("Ignoring capture file index %s, which does not match the capture file",
+                             index_filename.c_str());
+        success = false;
+    }
+    else
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.entry_count);
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.fill_memory_blob_count);
+
+        entries_.resize(static_cast<size_t>(header.entry_count));
+        fill_memory_blobs_.resize(static_cast<size_t>(header.fill_memory_blob_count));
+        success = (entries_.empty() ||
+                   (util::platform::FileRead(entries_.data(), sizeof(Entry), entries_.size(), file) ==
+                    entries_.size())) &&
+                  (fill_memory_blobs_.empty() ||
+                   (util::platform::FileRead(fill_memory_blobs_.data(),
+                                             sizeof(FillMemoryBlobEntry),
+                                             fill_memory_blobs_.size(),
+                                             file) == fill_memory_blobs_.size()));
+
+        if (!success)
+        {
+            GFXRECON_LOG_WARNING("Failed to read capture file index %s", index_filename.c_str());
+        }
+    }
+
+    util::platform::FileClose(file);
+
+    if (success)
+    {
+        capture_file_size_  = header.capture_file_size;
+        block_count_        = header.block_count;
+        uses_frame_markers_ = ((header.flags & kIndexUsesFrameMarkers) != 0);
+        valid_              = true;
+
+        UpdateFrameLookup();
+    }
+    else
+    {
+        Clear();
+    }
+
+    return valid_;
+}
+
+bool FileIndex::Write(const std::string& index_filename) const
+{
+    if (!valid_)
+    {
+        return false;
+    }
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, index_filename.c_str(), "wb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", index_filename.c_str());
+        return false;
+    }
+
+    IndexFileHeader header{};
+    header.fourcc                 = kIndexFileFourCC;
+    header.version                = kIndexFileVersion;
+    header.capture_file_size      = capture_file_size_;
+    header.block_count            = block_count_;
+    header.flags                  = uses_frame_markers_ ? kIndexUsesFrameMarkers : 0;
+    header.entry_count            = entries_.size();
+    header.fill_memory_blob_count = fill_memory_blobs_.size();
+
+    bool success = (util::platform::FileWrite(&header, sizeof(header), 1, file) == 1);
+
+    if (success && !entries_.empty())
+    {
+        success = (util::platform::FileWrite(entries_.data(), sizeof(Entry), entries_.size(), file) == entries_.size());
+    }
+
+    if (success && !fill_memory_blobs_.empty())
+    {
+        success = (util::platform::FileWrite(fill_memory_blobs_.data(),
+                                             sizeof(FillMemoryBlobEntry),
+                                             fill_memory_blobs_.size(),
+                                             file) == fill_memory_blobs_.size());
+    }
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write capture file index %s", index_filename.c_str());
+    }
+
+    return success;
+}
+
+const FileIndex::Entry* FileIndex::FindFrame(uint32_t frame_number) const
+{
+    if (frame_number < frames_.size())
+    {
+        return &entries_[frames_[frame_number]];
+    }
+
+    return nullptr;
+}
+
+const FileIndex::Entry* FileIndex::FindBlock(uint64_t block_index) const
+{
+    const Entry* found = nullptr;
+
+    // Entries are ordered by block index.
+    auto iter = std::upper_bound(entries_.begin(), entries_.end(), block_index, [](uint64_t index, const Entry& entry) {
+        return index < entry.block_index;
+    });
+
+    while (iter != entries_.begin())
+    {
+        --iter;
+        if ((iter->type == kFrameStart) || (iter->type == kBlockCheckpoint))
+        {
+            found = &(*iter);
+            break;
+        }
+    }
+
+    return found;
+}
+
+std::string FileIndex::GetIndexFilename(const std::string& capture_filename)
+{
+    return capture_filename + ".index";
+}
+
+void FileIndex::AddEntry(EntryType type, uint64_t file_offset, uint64_t block_index, uint32_t frame_number)
+{
+    entries_.push_back({ file_offset, block_index, frame_number, type });
+}
+
+void FileIndex::UpdateFrameLookup()
+{
+    frames_.clear();
+
+    for (size_t i = 0; i < entries_.size(); ++i)
+    {
+        if (entries_[i].type == kFrameStart)
+        {
+            assert(entries_[i].frame_number == frames_.size());
+            frames_.push_back(i);
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,125 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+/// @file Frame and block offset index for capture files.
+
+#ifndef GFXRECON_DECODE_FILE_INDEX_H
+#define GFXRECON_DECODE_FILE_INDEX_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+/// @brief Maps frame numbers, state snapshot boundaries, and block indices of a capture file to file offsets, so that
+/// the file can be positioned at the start of a frame without reading the blocks that precede it.
+///
+/// The index is built by scanning block headers, without decompressing or decoding block data, and can be stored in
+/// a sidecar file next to the capture file (see GetIndexFilename()). Frame numbers and block indices follow the
+/// numbering used by FileProcessor. The index also lists the fill memory blob blocks, so that the blobs a reader
+/// retains at a seek position can be loaded without scanning the blocks that precede it.
+class FileIndex
+{
+  public:
+    enum EntryType : uint32_t
+    {
+        kFrameStart      = 1, // First block of a frame.
+        kStateBegin      = 2, // State snapshot begin marker block.
+        kStateEnd        = 3, // State snapshot end marker block.
+        kBlockCheckpoint = 4  // Periodic entry for mapping block indices to offsets.
+    };
+
+    struct Entry
+    {
+        uint64_t  file_offset;
+        uint64_t  block_index;
+        uint32_t  frame_number;
+        EntryType type;
+    };
+
+    struct FillMemoryBlobEntry
+    {
+        uint64_t file_offset; // Offset of the block header of the fill memory blob command.
+        uint64_t data_size;   // Uncompressed size of the blob data.
+    };
+
+    /// Number of blocks between kBlockCheckpoint entries.
+    static const uint64_t kBlockCheckpointInterval = 4096;
+
+  public:
+    FileIndex();
+
+    /// @brief Build the index by scanning the block headers of a capture file.
+    bool Build(const std::string& capture_filename);
+
+    /// @brief Load an index file. Fails if the index does not match the size of the capture file it describes.
+    bool Load(const std::string& index_filename, const std::string& capture_filename);
+
+    bool Write(const std::string& index_filename) const;
+
+    void Clear();
+
+    bool IsValid() const { return valid_; }
+
+    bool UsesFrameMarkers() const { return uses_frame_markers_; }
+
+    /// @return The number of frames delimited in the capture file, including a final unterminated frame.
+    uint32_t GetFrameCount() const { return static_cast<uint32_t>(frames_.size()); }
+
+    uint64_t GetBlockCount() const { return block_count_; }
+
+    const std::vector<Entry>& GetEntries() const { return entries_; }
+
+    /// @return The fill memory blob blocks of the capture file, ordered by file offset.
+    const std::vector<FillMemoryBlobEntry>& GetFillMemoryBlobs() const { return fill_memory_blobs_; }
+
+    /// @return The entry for the start of the specified frame, or nullptr if the frame is not in the index.
+    const Entry* FindFrame(uint32_t frame_number) const;
+
+    /// @return The last frame start or block checkpoint entry at or before the specified block index.
+    const Entry* FindBlock(uint64_t block_index) const;
+
+    static std::string GetIndexFilename(const std::string& capture_filename);
+
+  private:
+    void AddEntry(EntryType type, uint64_t file_offset, uint64_t block_index, uint32_t frame_number);
+
+    void UpdateFrameLookup();
+
+  private:
+    std::vector<Entry>               entries_;
+    std::vector<size_t>              frames_; // Positions in entries_ of the kFrameStart entries, by frame number.
+    std::vector<FillMemoryBlobEntry> fill_memory_blobs_;
+    uint64_t                         capture_file_size_;
+    uint64_t                         block_count_;
+    bool                             uses_frame_markers_;
+    bool                             valid_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FILE_INDEX_H
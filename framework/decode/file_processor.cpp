@@ -30,7 +30,11 @@
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -39,10 +43,17 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 // TODO GH #1195: frame numbering should be 1-based.
 const uint32_t kFirstFrame = 0;
 
+// Amount of a mapped capture file to request read-ahead for, ahead of the current read position.
+const size_t kMappedPrefetchSize = 32 * 1024 * 1024;
+
 FileProcessor::FileProcessor() :
     file_header_{}, file_descriptor_(nullptr), current_frame_number_(kFirstFrame), bytes_read_(0),
-    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr), block_index_(0),
-    api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false), first_frame_(kFirstFrame + 1)
+    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), parameter_data_(nullptr),
+    compressor_(nullptr), block_index_(0), api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false),
+    first_frame_(kFirstFrame + 1), use_file_mapping_(false), mapped_data_(nullptr), mapped_size_(0),
+    mapped_offset_(0), mapped_prefetch_offset_(0), mapped_eof_(false), read_ahead_size_(0), memory_block_(nullptr),
+    memory_block_offset_(0), memory_block_eof_(false), loop_block_index_(0), loop_count_remaining_(0),
+    loop_start_frame_(kFirstFrame), loop_start_block_index_(0), loop_begin_pending_(false), state_end_processed_(false)
 {}
 
 FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
@@ -52,12 +63,20 @@ FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
 
 FileProcessor::~FileProcessor()
 {
+    // Calls that are still queued on worker threads when replay is aborted are discarded.
+    threaded_calls_.reset();
+
+    // The read-ahead thread must be stopped before the file is closed.
+    read_ahead_.reset();
+
     if (nullptr != compressor_)
     {
         delete compressor_;
         compressor_ = nullptr;
     }
 
+    UnmapFile();
+
     if (file_descriptor_)
     {
         fclose(file_descriptor_);
@@ -68,6 +87,8 @@ FileProcessor::~FileProcessor()
 
 void FileProcessor::WaitDecodersIdle()
 {
+    WaitThreadedCalls();
+
     for (auto decoder : decoders_)
     {
         decoder->WaitIdle();
@@ -82,15 +103,43 @@ bool FileProcessor::Initialize(const std::string& filename)
 
     if ((result == 0) && (file_descriptor_ != nullptr))
     {
-        success = ProcessFileHeader();
+        if (use_file_mapping_ && !MapFile())
+        {
+            GFXRECON_LOG_DEBUG("Failed to map file %s into memory; using buffered file reads", filename.c_str());
+        }
+
+        success = ProcessFileHeader() && LoadCompressionDictionary();
 
         if (success)
         {
             filename_    = filename;
             error_state_ = kErrorNone;
+
+            // Use the sidecar index for seeking when one has been created for the file.
+            if (file_index_.Load(FileIndex::GetIndexFilename(filename), filename))
+            {
+                GFXRECON_LOG_INFO("Loaded capture file index with %u frames", file_index_.GetFrameCount());
+            }
+
+            if (read_ahead_size_ > 0)
+            {
+                read_ahead_ = std::make_unique<BlockReadAhead>(
+                    [this](void* buffer, size_t buffer_size) { return ReadFileBytes(buffer, buffer_size); },
+                    enabled_options_.compression_type,
+                    read_ahead_size_);
+
+                if (!compression_dictionary_.empty())
+                {
+                    read_ahead_->SetCompressionDictionary(compression_dictionary_.data(),
+                                                          compression_dictionary_.size());
+                }
+
+                read_ahead_->Start();
+            }
         }
         else
         {
+            UnmapFile();
             fclose(file_descriptor_);
             file_descriptor_ = nullptr;
         }
@@ -106,6 +155,8 @@ bool FileProcessor::Initialize(const std::string& filename)
 
 bool FileProcessor::ProcessNextFrame()
 {
+    RestartFrameLoop();
+
     bool success = IsFileValid();
 
     if (success)
@@ -119,7 +170,7 @@ bool FileProcessor::ProcessNextFrame()
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
-        else if (ferror(file_descriptor_))
+        else if (IsFileError())
         {
             error_state_ = kErrorReadingFile;
         }
@@ -145,6 +196,436 @@ bool FileProcessor::ProcessAllFrames()
     return (error_state_ == kErrorNone);
 }
 
+bool FileProcessor::SeekToFrame(uint32_t frame_number)
+{
+    if (file_descriptor_ == nullptr)
+    {
+        error_state_ = kErrorInvalidFileDescriptor;
+        return false;
+    }
+
+    if (!file_index_.IsValid())
+    {
+        GFXRECON_LOG_INFO("Building capture file index for %s", filename_.c_str());
+
+        if (!file_index_.Build(filename_))
+        {
+            return false;
+        }
+    }
+
+    const FileIndex::Entry* entry = file_index_.FindFrame(frame_number);
+    if (entry == nullptr)
+    {
+        GFXRECON_LOG_ERROR(
+            "Cannot seek to frame %u, which is past the last frame (%u)", frame_number, file_index_.GetFrameCount());
+        return false;
+    }
+
+    // Blocks that were read ahead of the current position are discarded.
+    if (read_ahead_ != nullptr)
+    {
+        read_ahead_->Stop();
+    }
+
+    preloaded_blocks_.clear();
+    loop_blocks_.clear();
+    loop_fill_memory_blobs_.Clear();
+    loop_block_index_     = 0;
+    loop_count_remaining_ = 0;
+    loop_begin_pending_   = false;
+    memory_block_         = nullptr;
+    memory_block_offset_  = 0;
+    memory_block_eof_     = false;
+
+    bool success = true;
+
+    if (mapped_data_ != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, entry->file_offset);
+        mapped_offset_          = static_cast<size_t>(entry->file_offset);
+        mapped_prefetch_offset_ = mapped_offset_;
+        mapped_eof_             = false;
+    }
+    else if (!util::platform::FileSeek(
+                 file_descriptor_, static_cast<int64_t>(entry->file_offset), util::platform::FileSeekSet))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to frame %u", frame_number);
+        error_state_ = kErrorReadingFile;
+        success      = false;
+    }
+
+    // Load the data blobs that the blocks after the new position can reference.
+    success = success && LoadFillMemoryBlobs(entry->file_offset);
+
+    if (success)
+    {
+        current_frame_number_       = entry->frame_number;
+        block_index_                = entry->block_index;
+        bytes_read_                 = entry->file_offset;
+        capture_uses_frame_markers_ = file_index_.UsesFrameMarkers();
+
+        if (read_ahead_ != nullptr)
+        {
+            read_ahead_->Start();
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::LoadFillMemoryBlobs(uint64_t end_offset)
+{
+    // Only the most recently written blobs that fit in the reader's budget are retained by a reader that processes the
+    // file from its start, so only the blobs at the end of the index entries that precede end_offset are read.
+    const auto& blob_entries = file_index_.GetFillMemoryBlobs();
+    auto        end_entry    = std::lower_bound(
+        blob_entries.begin(),
+        blob_entries.end(),
+        end_offset,
+        [](const FileIndex::FillMemoryBlobEntry& entry, uint64_t offset) { return entry.file_offset < offset; });
+    auto   first_entry = end_entry;
+    size_t total_size  = 0;
+
+    fill_memory_blobs_.Clear();
+
+    // Find the oldest blob that is still retained after the last blob is added.
+    while ((first_entry != blob_entries.begin()) &&
+           ((total_size + std::prev(first_entry)->data_size) <= format::kFillMemoryBlobCacheSize))
+    {
+        --first_entry;
+        total_size += static_cast<size_t>(first_entry->data_size);
+    }
+
+    if (first_entry == end_entry)
+    {
+        return true;
+    }
+
+    // Read the blobs with a separate file handle, so that the processing position is not affected.
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename_.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", filename_.c_str());
+        error_state_ = kErrorOpeningFile;
+        return false;
+    }
+
+    bool                 success = true;
+    std::vector<uint8_t> compressed_data;
+    std::vector<uint8_t> data;
+
+    for (auto entry = first_entry; success && (entry != end_entry); ++entry)
+    {
+        format::BlockHeader                 block_header = {};
+        format::MetaDataId                  meta_data_id = 0;
+        format::FillMemoryBlobCommandHeader header       = {};
+        const uint64_t                      base_size    = format::GetMetaDataBlockBaseSize(header);
+        const size_t                        data_size    = static_cast<size_t>(entry->data_size);
+
+        // The index entry must still describe a blob block of the same size.
+        success =
+            util::platform::FileSeek(file, static_cast<int64_t>(entry->file_offset), util::platform::FileSeekSet) &&
+            (util::platform::FileRead(&block_header, sizeof(block_header), 1, file) == 1) &&
+            (util::platform::FileRead(&meta_data_id, sizeof(meta_data_id), 1, file) == 1) &&
+            (util::platform::FileRead(&header.thread_id, sizeof(header.thread_id), 1, file) == 1) &&
+            (util::platform::FileRead(&header.blob_id, sizeof(header.blob_id), 1, file) == 1) &&
+            (util::platform::FileRead(&header.memory_id, sizeof(header.memory_id), 1, file) == 1) &&
+            (util::platform::FileRead(&header.memory_offset, sizeof(header.memory_offset), 1, file) == 1) &&
+            (util::platform::FileRead(&header.memory_size, sizeof(header.memory_size), 1, file) == 1) &&
+            (block_header.size >= base_size) &&
+            (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryBlobCommand) &&
+            (header.memory_size == entry->data_size);
+
+        if (success && format::IsBlockCompressed(block_header.type))
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size - base_size);
+            compressed_data.resize(static_cast<size_t>(block_header.size - base_size));
+            data.resize(data_size);
+
+            success = (compressor_ != nullptr) &&
+                      (util::platform::FileRead(compressed_data.data(), compressed_data.size(), 1, file) == 1) &&
+                      (compressor_->Decompress(compressed_data.size(), compressed_data.data(), data_size, &data) ==
+                       data_size);
+        }
+        else if (success)
+        {
+            data.resize(data_size);
+            success = (util::platform::FileRead(data.data(), data_size, 1, file) == 1);
+        }
+
+        if (success)
+        {
+            fill_memory_blobs_.AddBlob(header.blob_id, data.data(), data_size);
+        }
+    }
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to load the fill memory data blobs that precede the seek position");
+        error_state_ = kErrorReadingBlockData;
+    }
+
+    return success;
+}
+
+uint32_t FileProcessor::PreloadFrames(uint32_t frame_count)
+{
+    uint32_t frames_loaded      = 0;
+    uint64_t bytes_loaded       = 0;
+    size_t   blocks_loaded      = 0;
+    bool     uses_frame_markers = capture_uses_frame_markers_;
+
+    // Stop if the end of the file has already been reached, or preloaded by an earlier call.
+    if (!IsFileValid() || (!preloaded_blocks_.empty() && !preloaded_blocks_.back().IsComplete()))
+    {
+        return 0;
+    }
+
+    while (frames_loaded < frame_count)
+    {
+        BlockReadAhead::Block block;
+
+        bool complete = ReadMemoryBlock(&block);
+
+        if (!block.end_of_file)
+        {
+            ++blocks_loaded;
+            bytes_loaded += sizeof(block.header) + block.data.size() + block.uncompressed_data.size();
+        }
+
+        if (!complete)
+        {
+            // Queue the truncated or end of file block, so that block processing reports the end of the file.
+            preloaded_blocks_.emplace_back(std::move(block));
+            break;
+        }
+
+        // Count frames with the same frame delimiters as ProcessBlocks().
+        bool                    end_of_frame = false;
+        const format::BlockType block_type   = format::RemoveCompressedBlockBit(block.header.type);
+
+        if (((block_type == format::BlockType::kFunctionCallBlock) ||
+             (block_type == format::BlockType::kMethodCallBlock)) &&
+            (block.data.size() >= sizeof(format::ApiCallId)))
+        {
+            format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+            memcpy(&call_id, block.data.data(), sizeof(call_id));
+
+            end_of_frame = !uses_frame_markers && IsFrameDelimiter(call_id);
+        }
+        else if ((block_type == format::BlockType::kFrameMarkerBlock) &&
+                 (block.data.size() >= sizeof(format::MarkerType)))
+        {
+            format::MarkerType marker_type = format::MarkerType::kUnknownMarker;
+            memcpy(&marker_type, block.data.data(), sizeof(marker_type));
+
+            end_of_frame = IsFrameDelimiter(block_type, marker_type);
+            uses_frame_markers |= end_of_frame;
+        }
+
+        preloaded_blocks_.emplace_back(std::move(block));
+
+        if (end_of_frame)
+        {
+            ++frames_loaded;
+        }
+    }
+
+    GFXRECON_LOG_INFO("Preloaded %u frames (%" PRIuPTR " blocks, %" PRIu64 " bytes) into memory",
+                      frames_loaded,
+                      blocks_loaded,
+                      bytes_loaded);
+
+    return frames_loaded;
+}
+
+uint32_t FileProcessor::LoopFrames(uint32_t frame_count, uint32_t loop_count)
+{
+    // The looped frames must start at the current frame, so blocks that were preloaded by an earlier call, or that
+    // belong to an earlier loop, must be processed first.
+    if (!preloaded_blocks_.empty() || (loop_block_index_ < loop_blocks_.size()))
+    {
+        return 0;
+    }
+
+    uint32_t frames_loaded = PreloadFrames(frame_count);
+
+    if ((frames_loaded > 0) && (frames_loaded == frame_count) && (loop_count > 1))
+    {
+        // Before each repetition, decoders re-apply the memory contents from the state snapshot of a trimmed capture,
+        // which are only the memory contents at the start of the loop when no frames were processed in between.
+        if (state_end_processed_)
+        {
+            GFXRECON_LOG_ERROR("Frames that follow the state snapshot of a trimmed capture cannot be looped, because "
+                               "the memory contents at the start of the loop cannot be restored. The looped frame "
+                               "range must start with the first frame of the capture file. The %u frames will be "
+                               "processed once.",
+                               frames_loaded);
+            return frames_loaded;
+        }
+
+        // The state snapshot of a trimmed capture is processed once, and the loop begins after its end marker.
+        auto loop_begin =
+            std::find_if(preloaded_blocks_.begin(), preloaded_blocks_.end(), [](const BlockReadAhead::Block& block) {
+                format::MarkerType marker_type = format::MarkerType::kUnknownMarker;
+
+                if ((block.header.type == format::BlockType::kStateMarkerBlock) &&
+                    (block.data.size() >= sizeof(marker_type)))
+                {
+                    memcpy(&marker_type, block.data.data(), sizeof(marker_type));
+                }
+
+                return (marker_type == format::MarkerType::kEndMarker);
+            });
+
+        loop_begin = (loop_begin != preloaded_blocks_.end()) ? std::next(loop_begin) : preloaded_blocks_.begin();
+
+        if (!SupportsFrameLoop(loop_begin, preloaded_blocks_.end()))
+        {
+            GFXRECON_LOG_WARNING("The %u frames will be processed once.", frames_loaded);
+            return frames_loaded;
+        }
+
+        loop_blocks_.clear();
+        loop_blocks_.reserve(static_cast<size_t>(std::distance(loop_begin, preloaded_blocks_.end())));
+        std::move(loop_begin, preloaded_blocks_.end(), std::back_inserter(loop_blocks_));
+        preloaded_blocks_.erase(loop_begin, preloaded_blocks_.end());
+
+        loop_block_index_     = 0;
+        loop_count_remaining_ = loop_count - 1;
+        loop_begin_pending_   = true;
+
+        if (preloaded_blocks_.empty())
+        {
+            BeginFrameLoop();
+        }
+    }
+
+    return frames_loaded;
+}
+
+bool FileProcessor::SupportsFrameLoop(std::deque<BlockReadAhead::Block>::const_iterator begin,
+                                      std::deque<BlockReadAhead::Block>::const_iterator end)
+{
+    const size_t prefix_size = sizeof(format::ApiCallId) + sizeof(format::ThreadId);
+    uint64_t     block_index = block_index_ + static_cast<uint64_t>(std::distance(preloaded_blocks_.cbegin(), begin));
+
+    for (auto block = begin; block != end; ++block, ++block_index)
+    {
+        if ((format::RemoveCompressedBlockBit(block->header.type) != format::BlockType::kFunctionCallBlock) ||
+            (block->data.size() < prefix_size))
+        {
+            continue;
+        }
+
+        format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+        memcpy(&call_id, block->data.data(), sizeof(call_id));
+
+        // Compressed parameter data is decompressed when the block is preloaded, unless there is no compressor.
+        const uint8_t* parameter_buffer = nullptr;
+        size_t         buffer_size      = 0;
+
+        if (block->decompressed)
+        {
+            parameter_buffer = block->uncompressed_data.data();
+            buffer_size      = block->uncompressed_data.size();
+        }
+        else if (!format::IsBlockCompressed(block->header.type))
+        {
+            parameter_buffer = block->data.data() + prefix_size;
+            buffer_size      = block->data.size() - prefix_size;
+        }
+
+        bool supported = (parameter_buffer != nullptr);
+
+        DecodeAllocator::Begin();
+
+        for (auto decoder : decoders_)
+        {
+            if (supported && decoder->SupportsApiCall(call_id))
+            {
+                supported = decoder->SupportsFrameLoop(call_id, parameter_buffer, buffer_size);
+            }
+        }
+
+        DecodeAllocator::End();
+
+        if (!supported)
+        {
+            GFXRECON_LOG_WARNING("Frames cannot be looped, because the function call of block %" PRIu64
+                                 " creates or destroys objects, or signals a timeline semaphore, and cannot be "
+                                 "processed again.",
+                                 block_index);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FileProcessor::BeginFrameLoop()
+{
+    loop_begin_pending_ = false;
+
+    // Blobs added by the looped frames can release blobs that the frames reference, so each repetition restarts
+    // from the blobs that were retained at the start of the loop.
+    loop_fill_memory_blobs_ = fill_memory_blobs_;
+
+    loop_start_frame_       = current_frame_number_;
+    loop_start_block_index_ = block_index_;
+
+    // Decoders record the state that the loop begins with, which must include the calls on worker threads.
+    WaitThreadedCalls();
+
+    for (auto decoder : decoders_)
+    {
+        decoder->DispatchFrameLoopBegin(current_frame_number_);
+    }
+}
+
+bool FileProcessor::RestartFrameLoop()
+{
+    if ((loop_count_remaining_ == 0) || (loop_block_index_ < loop_blocks_.size()))
+    {
+        return false;
+    }
+
+    --loop_count_remaining_;
+
+    WaitThreadedCalls();
+
+    for (auto decoder : decoders_)
+    {
+        decoder->DispatchFrameLoopRestart(loop_start_frame_);
+    }
+
+    loop_block_index_     = 0;
+    current_frame_number_ = loop_start_frame_;
+    block_index_          = loop_start_block_index_;
+    fill_memory_blobs_    = loop_fill_memory_blobs_;
+
+    return true;
+}
+
+void FileProcessor::SetThreadedCallFilter(ThreadedCallDispatcher::Filter filter)
+{
+    WaitThreadedCalls();
+
+    if (filter)
+    {
+        threaded_calls_ = std::make_unique<ThreadedCallDispatcher>(filter);
+    }
+    else
+    {
+        threaded_calls_.reset();
+    }
+}
+
 bool FileProcessor::ContinueDecoding()
 {
     bool early_exit = false;
@@ -236,6 +717,68 @@ bool FileProcessor::ProcessFileHeader()
     return success;
 }
 
+bool FileProcessor::LoadCompressionDictionary()
+{
+    // A compression dictionary is stored in the first block after the file header. It is loaded when the file is
+    // opened, instead of when the block is processed, so that seeking past the block does not prevent the blocks that
+    // follow it from being decompressed. The file is returned to its position after the header.
+    if (compressor_ == nullptr)
+    {
+        return true;
+    }
+
+    bool                success      = true;
+    format::BlockHeader block_header = {};
+    format::MetaDataId  meta_data_id = 0;
+    const size_t        prefix_size  = sizeof(meta_data_id) + sizeof(format::ThreadId) + sizeof(uint64_t);
+
+    if ((ReadFileBytes(&block_header, sizeof(block_header)) == sizeof(block_header)) &&
+        (block_header.type == format::BlockType::kMetaDataBlock) && (block_header.size >= prefix_size) &&
+        (ReadFileBytes(&meta_data_id, sizeof(meta_data_id)) == sizeof(meta_data_id)) &&
+        (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kSetCompressionDictionaryCommand))
+    {
+        format::SetCompressionDictionaryCommandHeader header;
+
+        success = (ReadFileBytes(&header.thread_id, sizeof(header.thread_id)) == sizeof(header.thread_id)) &&
+                  (ReadFileBytes(&header.dictionary_size, sizeof(header.dictionary_size)) ==
+                   sizeof(header.dictionary_size));
+        success = success && (header.dictionary_size == (block_header.size - prefix_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.dictionary_size);
+            const size_t dictionary_size = static_cast<size_t>(header.dictionary_size);
+
+            compression_dictionary_.resize(dictionary_size);
+            success = (ReadFileBytes(compression_dictionary_.data(), dictionary_size) == dictionary_size) &&
+                      compressor_->SetDictionary(compression_dictionary_.data(), dictionary_size);
+        }
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to load the compression dictionary");
+            compression_dictionary_.clear();
+            error_state_ = kErrorReadingBlockData;
+        }
+    }
+
+    if (mapped_data_ != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, bytes_read_);
+        mapped_offset_ = static_cast<size_t>(bytes_read_);
+        mapped_eof_    = false;
+    }
+    else if (!util::platform::FileSeek(
+                 file_descriptor_, static_cast<int64_t>(bytes_read_), util::platform::FileSeekSet))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to the first block of the file");
+        error_state_ = kErrorReadingFile;
+        success      = false;
+    }
+
+    return success;
+}
+
 bool FileProcessor::ProcessBlocks()
 {
     format::BlockHeader block_header;
@@ -249,6 +792,14 @@ bool FileProcessor::ProcessBlocks()
         {
             success = ReadBlockHeader(&block_header);
 
+            // Function calls that were dispatched to worker threads must complete before any block other than a
+            // function call is processed. Function calls that are not dispatched wait in ProcessFunctionCall().
+            if (success &&
+                (format::RemoveCompressedBlockBit(block_header.type) != format::BlockType::kFunctionCallBlock))
+            {
+                WaitThreadedCalls();
+            }
+
             for (auto decoder : decoders_)
             {
                 decoder->SetCurrentBlockIndex(block_index_);
@@ -409,7 +960,7 @@ bool FileProcessor::ProcessBlocks()
             }
             else
             {
-                if (!feof(file_descriptor_))
+                if (!IsEndOfFile())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
                     // assumes that the block header has been successfully read and will print an incomplete block at
@@ -426,6 +977,8 @@ bool FileProcessor::ProcessBlocks()
         ++block_index_;
     }
 
+    WaitThreadedCalls();
+
     return success;
 }
 
@@ -435,7 +988,51 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 
     bool success = false;
 
-    if (ReadBytes(block_header, sizeof(*block_header)))
+    memory_block_ = nullptr;
+
+    // Release the looped frames after their last repetition.
+    if ((loop_count_remaining_ == 0) && !loop_blocks_.empty() && (loop_block_index_ == loop_blocks_.size()))
+    {
+        loop_blocks_.clear();
+        loop_blocks_.shrink_to_fit();
+        loop_block_index_ = 0;
+        loop_fill_memory_blobs_.Clear();
+    }
+
+    // Preloaded blocks precede the looped frames when they hold the state snapshot that is processed before the loop.
+    if (!preloaded_blocks_.empty())
+    {
+        preloaded_block_ = std::move(preloaded_blocks_.front());
+        preloaded_blocks_.pop_front();
+        memory_block_ = &preloaded_block_;
+    }
+    else if (loop_block_index_ < loop_blocks_.size())
+    {
+        if (loop_begin_pending_)
+        {
+            BeginFrameLoop();
+        }
+
+        memory_block_ = &loop_blocks_[loop_block_index_++];
+    }
+    else if (read_ahead_ != nullptr)
+    {
+        memory_block_ = read_ahead_->NextBlock();
+    }
+
+    if (memory_block_ != nullptr)
+    {
+        memory_block_offset_ = 0;
+        memory_block_eof_    = memory_block_->end_of_file;
+
+        if (!memory_block_eof_)
+        {
+            *block_header = memory_block_->header;
+            bytes_read_ += sizeof(*block_header);
+            success = true;
+        }
+    }
+    else if (ReadBytes(block_header, sizeof(*block_header)))
     {
         success = true;
     }
@@ -443,13 +1040,68 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
     return success;
 }
 
+bool FileProcessor::MapFile()
+{
+    assert((file_descriptor_ != nullptr) && (mapped_data_ == nullptr));
+
+    if (!util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekEnd))
+    {
+        return false;
+    }
+
+    int64_t file_size = util::platform::FileTell(file_descriptor_);
+    bool    rewound   = util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekSet);
+
+    if (!rewound || (file_size <= 0) || (static_cast<uint64_t>(file_size) > std::numeric_limits<size_t>::max()))
+    {
+        return false;
+    }
+
+    mapped_size_ = static_cast<size_t>(file_size);
+    mapped_data_ = reinterpret_cast<uint8_t*>(util::platform::MapFile(file_descriptor_, mapped_size_));
+
+    if (mapped_data_ == nullptr)
+    {
+        mapped_size_ = 0;
+        return false;
+    }
+
+    mapped_offset_          = 0;
+    mapped_prefetch_offset_ = 0;
+    mapped_eof_             = false;
+
+    util::platform::AdviseSequentialAccess(mapped_data_, mapped_size_);
+
+    return true;
+}
+
+void FileProcessor::UnmapFile()
+{
+    if (mapped_data_ != nullptr)
+    {
+        util::platform::UnmapFile(mapped_data_, mapped_size_);
+        mapped_data_ = nullptr;
+        mapped_size_ = 0;
+    }
+}
+
 bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
 {
+    // Decode directly from the file mapping or read-ahead block when possible.
+    parameter_data_ = ReadBytesInPlace(buffer_size);
+
+    if (parameter_data_ != nullptr)
+    {
+        return true;
+    }
+
     if (buffer_size > parameter_buffer_.size())
     {
         parameter_buffer_.resize(buffer_size);
     }
 
+    parameter_data_ = parameter_buffer_.data();
+
     return ReadBytes(parameter_buffer_.data(), buffer_size);
 }
 
@@ -460,12 +1112,34 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
     // This should only be null if initialization failed.
     assert(compressor_ != nullptr);
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    if ((memory_block_ != nullptr) && memory_block_->decompressed &&
+        (memory_block_offset_ == memory_block_->compressed_offset) &&
+        ((memory_block_offset_ + compressed_buffer_size) == memory_block_->data.size()) &&
+        (expected_uncompressed_size == memory_block_->uncompressed_data.size()))
     {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
+        // The block was already decompressed by the read-ahead thread.
+        parameter_data_           = memory_block_->uncompressed_data.data();
+        *uncompressed_buffer_size = expected_uncompressed_size;
+        return SkipBytes(compressed_buffer_size);
     }
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    // Decompress directly from the file mapping or read-ahead block when possible.
+    const uint8_t* compressed_data = ReadBytesInPlace(compressed_buffer_size);
+
+    if (compressed_data == nullptr)
+    {
+        if (compressed_buffer_size > compressed_parameter_buffer_.size())
+        {
+            compressed_parameter_buffer_.resize(compressed_buffer_size);
+        }
+
+        if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+        {
+            compressed_data = compressed_parameter_buffer_.data();
+        }
+    }
+
+    if (compressed_data != nullptr)
     {
         if (parameter_buffer_.size() < expected_uncompressed_size)
         {
@@ -473,9 +1147,10 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
         }
 
         size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
+            compressed_buffer_size, compressed_data, expected_uncompressed_size, &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
+            parameter_data_           = parameter_buffer_.data();
             *uncompressed_buffer_size = uncompressed_size;
             return true;
         }
@@ -485,14 +1160,56 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
 
 bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
-    size_t bytes_read = util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
+    size_t bytes_read = 0;
+
+    if (IsReadingFromMemoryBlock())
+    {
+        if (memory_block_ != nullptr)
+        {
+            const std::vector<uint8_t>& data = memory_block_->data;
+
+            size_t available = (memory_block_offset_ < data.size()) ? (data.size() - memory_block_offset_) : 0;
+            bytes_read       = std::min(buffer_size, available);
+
+            if (bytes_read > 0)
+            {
+                memcpy(buffer, data.data() + memory_block_offset_, bytes_read);
+                memory_block_offset_ += bytes_read;
+            }
+        }
+
+        // Reading past the end of a block is only an end of file condition when the block was truncated.
+        memory_block_eof_ = (bytes_read < buffer_size) && (memory_block_ != nullptr) &&
+                          (memory_block_->data.size() < memory_block_->header.size);
+    }
+    else
+    {
+        bytes_read = ReadFileBytes(buffer, buffer_size);
+    }
+
     bytes_read_ += bytes_read;
     return (bytes_read == buffer_size);
 }
 
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    bool success = true;
+
+    if (IsReadingFromMemoryBlock())
+    {
+        memory_block_offset_ += skip_size;
+    }
+    else if (mapped_data_ != nullptr)
+    {
+        // As with fseek(), skipping past the end of the file succeeds and the next read reports EOF.
+        mapped_offset_ += skip_size;
+        mapped_eof_ = false;
+        PrefetchMappedData();
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    }
 
     if (success)
     {
@@ -503,10 +1220,79 @@ bool FileProcessor::SkipBytes(size_t skip_size)
     return success;
 }
 
+bool FileProcessor::ReadMemoryBlock(BlockReadAhead::Block* block)
+{
+    assert(block != nullptr);
+
+    if (read_ahead_ != nullptr)
+    {
+        // The read-ahead thread owns the file, so take the block from its queue.
+        *block = *read_ahead_->NextBlock();
+        return block->IsComplete();
+    }
+
+    return BlockReadAhead::ReadBlock(
+        [this](void* buffer, size_t buffer_size) { return ReadFileBytes(buffer, buffer_size); }, compressor_, block);
+}
+
+size_t FileProcessor::ReadFileBytes(void* buffer, size_t buffer_size)
+{
+    size_t bytes_read = 0;
+
+    if (mapped_data_ != nullptr)
+    {
+        size_t available = (mapped_offset_ < mapped_size_) ? (mapped_size_ - mapped_offset_) : 0;
+        bytes_read       = std::min(buffer_size, available);
+
+        if (bytes_read > 0)
+        {
+            memcpy(buffer, mapped_data_ + mapped_offset_, bytes_read);
+            mapped_offset_ += bytes_read;
+            PrefetchMappedData();
+        }
+
+        // Matches the stdio behavior of only reporting EOF after an attempt to read past the end of the file.
+        mapped_eof_ = (bytes_read < buffer_size);
+    }
+    else
+    {
+        bytes_read = util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
+    }
+
+    return bytes_read;
+}
+
+const uint8_t* FileProcessor::ReadBytesInPlace(size_t size)
+{
+    const uint8_t* data = nullptr;
+
+    if (IsReadingFromMemoryBlock())
+    {
+        if ((memory_block_ != nullptr) && (memory_block_offset_ <= memory_block_->data.size()) &&
+            (size <= (memory_block_->data.size() - memory_block_offset_)))
+        {
+            data = memory_block_->data.data() + memory_block_offset_;
+        }
+    }
+    else if ((mapped_data_ != nullptr) && (mapped_offset_ <= mapped_size_) && (size <= (mapped_size_ - mapped_offset_)))
+    {
+        data = mapped_data_ + mapped_offset_;
+    }
+
+    if (data != nullptr)
+    {
+        SkipBytes(size);
+    }
+
+    // When the data is not available in memory, the caller falls back to ReadBytes(), which consumes the remainder
+    // of the file and reports the incomplete block.
+    return data;
+}
+
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(file_descriptor_) && !ferror(file_descriptor_))
+    if (IsEndOfFile() && !IsFileError())
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -517,6 +1303,56 @@ void FileProcessor::HandleBlockReadError(Error error_code, const char* error_mes
     }
 }
 
+bool FileProcessor::IsEndOfFile() const
+{
+    if (IsReadingFromMemoryBlock())
+    {
+        return memory_block_eof_;
+    }
+
+    if (mapped_data_ != nullptr)
+    {
+        return mapped_eof_;
+    }
+
+    return (feof(file_descriptor_) != 0);
+}
+
+bool FileProcessor::IsFileError() const
+{
+    // The read-ahead thread owns the file until it reaches the end of the file.
+    if (IsReadingFromMemoryBlock() && !memory_block_eof_)
+    {
+        return false;
+    }
+
+    // Errors accessing a file mapping are reported with signals rather than through the stream.
+    if (mapped_data_ != nullptr)
+    {
+        return false;
+    }
+
+    return (ferror(file_descriptor_) != 0);
+}
+
+void FileProcessor::PrefetchMappedData()
+{
+    // Keep read-ahead requests a window ahead of the read position. Issue them in large steps to limit the number of
+    // system calls.
+    if ((mapped_offset_ >= mapped_prefetch_offset_) && (mapped_prefetch_offset_ < mapped_size_))
+    {
+        size_t start = std::max(mapped_offset_, mapped_prefetch_offset_);
+        size_t size  = std::min(kMappedPrefetchSize, mapped_size_ - std::min(start, mapped_size_));
+
+        if (size > 0)
+        {
+            util::platform::AdviseWillNeed(mapped_data_ + start, size);
+        }
+
+        mapped_prefetch_offset_ = start + (kMappedPrefetchSize / 2);
+    }
+}
+
 bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
 {
     size_t      parameter_buffer_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
@@ -568,14 +1404,18 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
             }
         }
 
-        if (success)
+        if (success &&
+            ((threaded_calls_ == nullptr) ||
+             !threaded_calls_->Dispatch(decoders_, call_id, call_info, parameter_data_, parameter_buffer_size)))
         {
+            WaitThreadedCalls();
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
                 {
                     DecodeAllocator::Begin();
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeFunctionCall(call_id, call_info, parameter_data_, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
@@ -651,7 +1491,7 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header, f
                 {
                     DecodeAllocator::Begin();
                     decoder->DecodeMethodCall(
-                        call_id, object_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                        call_id, object_id, call_info, parameter_data_, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
@@ -710,7 +1550,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.memory_id,
                                                            header.memory_offset,
                                                            header.memory_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data_);
                     }
                 }
             }
@@ -732,6 +1572,115 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryBlobCommand)
+    {
+        format::FillMemoryBlobCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.blob_id, sizeof(header.blob_id));
+        success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+        success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+        success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
+
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+                size_t compressed_size =
+                    static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+                success = ReadCompressedParameterBuffer(
+                    compressed_size, static_cast<size_t>(header.memory_size), &uncompressed_size);
+            }
+            else
+            {
+                success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+            }
+
+            if (success)
+            {
+                fill_memory_blobs_.AddBlob(header.blob_id, parameter_data_, static_cast<size_t>(header.memory_size));
+
+                for (auto decoder : decoders_)
+                {
+                    if (decoder->SupportsMetaDataId(meta_data_id))
+                    {
+                        decoder->DispatchFillMemoryCommand(header.thread_id,
+                                                           header.memory_id,
+                                                           header.memory_offset,
+                                                           header.memory_size,
+                                                           parameter_data_);
+                    }
+                }
+            }
+            else
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                         "Failed to read fill memory blob meta-data block");
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory blob meta-data block");
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory blob meta-data block header");
+        }
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryFromBlobCommand)
+    {
+        format::FillMemoryBlobCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.blob_id, sizeof(header.blob_id));
+        success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+        success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+        success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+        if (success)
+        {
+            const std::vector<uint8_t>* blob = fill_memory_blobs_.GetBlob(header.blob_id);
+
+            if ((blob != nullptr) && (blob->size() == header.memory_size))
+            {
+                for (auto decoder : decoders_)
+                {
+                    if (decoder->SupportsMetaDataId(meta_data_id))
+                    {
+                        decoder->DispatchFillMemoryCommand(header.thread_id,
+                                                           header.memory_id,
+                                                           header.memory_offset,
+                                                           header.memory_size,
+                                                           blob->data());
+                    }
+                }
+            }
+            else
+            {
+                // Blobs written before the block that processing started from are loaded by SeekToFrame(), so an
+                // unavailable blob means that the file is invalid.
+                GFXRECON_LOG_ERROR("Fill memory command for memory %" PRIu64
+                                   " references unavailable data blob %" PRIu64 " (frame %u block %" PRIu64 ")",
+                                   header.memory_id,
+                                   header.blob_id,
+                                   current_frame_number_,
+                                   block_index_);
+                error_state_ = kErrorReadingBlockData;
+                success      = false;
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory blob reference block header");
+        }
+    }
     else if (meta_data_type == format::MetaDataType::kFillMemoryResourceValueCommand)
     {
         format::FillMemoryResourceValueCommandHeader header;
@@ -763,7 +1712,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchFillMemoryResourceValueCommand(header, parameter_buffer_.data());
+                        decoder->DispatchFillMemoryResourceValueCommand(header, parameter_data_);
                     }
                 }
             }
@@ -898,7 +1847,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
             if (success)
             {
-                auto        message_start = parameter_buffer_.begin();
+                auto        message_start = parameter_data_;
                 std::string message(message_start, std::next(message_start, static_cast<size_t>(message_size)));
 
                 for (auto decoder : decoders_)
@@ -1287,7 +2236,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                                             header.device_id,
                                                                             header.pipeline_id,
                                                                             static_cast<size_t>(header.data_size),
-                                                                            parameter_buffer_.data());
+                                                                            parameter_data_);
                 }
             }
         }
@@ -1443,7 +2392,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.device_id,
                                                            header.buffer_id,
                                                            header.data_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data_);
                     }
                 }
             }
@@ -1518,7 +2467,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                       header.aspect,
                                                       header.layout,
                                                       level_sizes,
-                                                      parameter_buffer_.data());
+                                                      parameter_data_);
                 }
             }
         }
@@ -1572,7 +2521,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchInitSubresourceCommand(header, parameter_buffer_.data());
+                        decoder->DispatchInitSubresourceCommand(header, parameter_data_);
                     }
                 }
             }
@@ -1668,7 +2617,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
                         decoder->DispatchInitDx12AccelerationStructureCommand(
-                            header, geom_descs, parameter_buffer_.data());
+                            header, geom_descs, parameter_data_);
                     }
                 }
             }
@@ -1751,6 +2700,26 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockData, "Failed to read runtime info meta-data block");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        // This command does not support compression.
+        assert(block_header.type != format::BlockType::kCompressedMetaDataBlock);
+
+        // The dictionary was loaded by LoadCompressionDictionary() when the file was opened.
+        format::SetCompressionDictionaryCommandHeader header;
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.dictionary_size, sizeof(header.dictionary_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.dictionary_size);
+            success = SkipBytes(static_cast<size_t>(header.dictionary_size));
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read set compression dictionary meta-data block");
+        }
+    }
     else if (meta_data_type == format::MetaDataType::kParentToChildDependency)
     {
         // This command does not support compression.
@@ -1866,7 +2835,8 @@ bool FileProcessor::ProcessStateMarker(const format::BlockHeader& block_header,
         else if (marker_type == format::kEndMarker)
         {
             GFXRECON_LOG_INFO("Finished loading state for captured frame %" PRId64, frame_number);
-            first_frame_ = frame_number;
+            first_frame_         = frame_number;
+            state_end_processed_ = true;
         }
 
         for (auto decoder : decoders_)
@@ -1916,13 +2886,13 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
             {
                 if (label_length > 0)
                 {
-                    auto label_start = parameter_buffer_.begin();
+                    auto label_start = parameter_data_;
                     label.assign(label_start, std::next(label_start, label_length));
                 }
 
                 if (data_length > 0)
                 {
-                    auto data_start = std::next(parameter_buffer_.begin(), label_length);
+                    auto data_start = std::next(parameter_data_, label_length);
                     GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_length);
                     data.assign(data_start, std::next(data_start, static_cast<size_t>(data_length)));
                 }
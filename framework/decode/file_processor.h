@@ -25,14 +25,20 @@
 #define GFXRECON_DECODE_FILE_PROCESSOR_H
 
 #include "format/api_call_id.h"
+#include "format/fill_memory_blob.h"
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "decode/block_read_ahead.h"
+#include "decode/file_index.h"
+#include "decode/threaded_call_dispatcher.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <deque>
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -69,10 +75,15 @@ class FileProcessor
 
     void SetAnnotationProcessor(AnnotationHandler* handler) { annotation_handler_ = handler; }
 
-    void AddDecoder(ApiDecoder* decoder) { decoders_.push_back(decoder); }
+    void AddDecoder(ApiDecoder* decoder)
+    {
+        WaitThreadedCalls();
+        decoders_.push_back(decoder);
+    }
 
     void RemoveDecoder(ApiDecoder* decoder)
     {
+        WaitThreadedCalls();
         decoders_.erase(std::remove(decoders_.begin(), decoders_.end(), decoder), decoders_.end());
     }
 
@@ -95,7 +106,57 @@ class FileProcessor
 
     Error GetErrorState() const { return error_state_; }
 
-    bool EntireFileWasProcessed() const { return (feof(file_descriptor_) != 0); }
+    bool EntireFileWasProcessed() const { return IsEndOfFile(); }
+
+    // Returns the index loaded from the capture file's sidecar index file, or built by SeekToFrame().
+    const FileIndex& GetFileIndex() const { return file_index_; }
+
+    // Provides an index for the capture file, so that processors converting different parts of the same file do not
+    // each need to build it.
+    void SetFileIndex(const FileIndex& file_index) { file_index_ = file_index; }
+
+    // Positions the file at the start of the specified frame, so that the next call to ProcessNextFrame() processes
+    // that frame. Blocks from the skipped frames are not read or decoded. If the capture file does not have an index
+    // file, the index is built by scanning the block headers of the file.
+    bool SeekToFrame(uint32_t frame_number);
+
+    // Controls whether Initialize() maps the capture file into memory. When mapped, uncompressed blocks are decoded
+    // directly from the mapping without being copied and compressed blocks are decompressed directly from the
+    // mapping. Falls back to buffered file reads if the file cannot be mapped. Mapping is disabled by default, because
+    // it reserves address space for the whole file. Must be called before Initialize().
+    void SetUseFileMapping(bool use_file_mapping) { use_file_mapping_ = use_file_mapping; }
+
+    bool IsFileMapped() const { return (mapped_data_ != nullptr); }
+
+    // Sets the amount of block data to read and decompress ahead of decoding on a dedicated thread. A value of 0,
+    // which is the default, reads blocks on the decoding thread. Must be called before Initialize().
+    void SetReadAheadSize(size_t read_ahead_size) { read_ahead_size_ = read_ahead_size; }
+
+    // Reads and decompresses the blocks of the next frame_count frames into memory, so that the subsequent calls to
+    // ProcessNextFrame() for those frames do not perform file I/O or decompression. Returns the number of frames that
+    // were loaded, which is less than frame_count if the end of the file was reached.
+    uint32_t PreloadFrames(uint32_t frame_count);
+
+    // Preloads the next frame_count frames, as PreloadFrames() does, and processes them loop_count times. Decoders are
+    // notified when the loop begins and before each repetition, so that they can restore the state that the frames
+    // modify. Frames are only looped when all frame_count frames were loaded. Returns the number of frames that were
+    // loaded.
+    // For a trimmed capture, the frames must include the end of the state snapshot, which is processed once. The loop
+    // then begins with the block that follows the state end marker, so that re-applying the state snapshot's memory
+    // contents restores the memory contents at the start of the loop. Frames that follow a processed state snapshot
+    // are rejected with an error, and processed once.
+    uint32_t LoopFrames(uint32_t frame_count, uint32_t loop_count);
+
+    // Rewinds to the first frame of the LoopFrames() range when the current repetition has been processed and
+    // repetitions remain. Returns true if the frames were rewound. ProcessNextFrame() calls this, but it may be called
+    // before ProcessNextFrame() to keep the decoders' state restoration out of frame timing.
+    bool RestartFrameLoop();
+
+    // Enables decoding of the function calls that are selected by the filter on worker threads, with one worker for
+    // each thread that was recorded in the capture file. Calls that are not selected by the filter, and all other
+    // blocks, are processed after the worker threads have decoded all calls that precede them in the capture file.
+    // Passing an empty filter restores decoding on the calling thread.
+    void SetThreadedCallFilter(ThreadedCallDispatcher::Filter filter);
 
   protected:
     bool ContinueDecoding();
@@ -118,6 +179,10 @@ class FileProcessor
 
     void HandleBlockReadError(Error error_code, const char* error_message);
 
+    bool IsEndOfFile() const;
+
+    bool IsFileError() const;
+
     bool ProcessFrameMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
     bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
@@ -137,8 +202,36 @@ class FileProcessor
   private:
     bool ProcessFileHeader();
 
+    bool LoadCompressionDictionary();
+
+    // Loads the data blobs that a reader processing the file from its start would retain at end_offset.
+    bool LoadFillMemoryBlobs(uint64_t end_offset);
+
     virtual bool ProcessBlocks();
 
+    bool MapFile();
+
+    void UnmapFile();
+
+    void PrefetchMappedData();
+
+    size_t ReadFileBytes(void* buffer, size_t buffer_size);
+
+    const uint8_t* ReadBytesInPlace(size_t size);
+
+    // True when block data is read from read-ahead or preloaded blocks instead of from the file.
+    bool IsReadingFromMemoryBlock() const { return ((memory_block_ != nullptr) || (read_ahead_ != nullptr)); }
+
+    bool ReadMemoryBlock(BlockReadAhead::Block* block);
+
+    // Returns false, with a warning, if the decoders cannot process the function calls of the preloaded blocks from
+    // begin to end again for another repetition of a looped frame range.
+    bool SupportsFrameLoop(std::deque<BlockReadAhead::Block>::const_iterator begin,
+                           std::deque<BlockReadAhead::Block>::const_iterator end);
+
+    // Records the position that RestartFrameLoop() rewinds to, and notifies the decoders that the loop begins.
+    void BeginFrameLoop();
+
     bool ReadParameterBuffer(size_t buffer_size);
 
     bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
@@ -147,21 +240,58 @@ class FileProcessor
 
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
 
-    bool IsFileValid() const { return (file_descriptor_ && !feof(file_descriptor_) && !ferror(file_descriptor_)); }
+    bool IsFileValid() const { return (file_descriptor_ && !IsEndOfFile() && !IsFileError()); }
+
+    // Waits for the function calls that were dispatched to worker threads to be decoded.
+    void WaitThreadedCalls()
+    {
+        if (threaded_calls_ != nullptr)
+        {
+            threaded_calls_->WaitIdle();
+        }
+    }
 
   private:
-    std::string                         filename_;
-    format::FileHeader                  file_header_;
-    std::vector<format::FileOptionPair> file_options_;
-    format::EnabledOptions              enabled_options_;
-    uint64_t                            bytes_read_;
-    std::vector<uint8_t>                parameter_buffer_;
-    std::vector<uint8_t>                compressed_parameter_buffer_;
-    util::Compressor*                   compressor_;
-    uint64_t                            api_call_index_;
-    uint64_t                            block_limit_;
-    bool                                capture_uses_frame_markers_;
-    uint64_t                            first_frame_;
+    std::string                             filename_;
+    format::FileHeader                      file_header_;
+    std::vector<format::FileOptionPair>     file_options_;
+    format::EnabledOptions                  enabled_options_;
+    uint64_t                                bytes_read_;
+    std::vector<uint8_t>                    parameter_buffer_;
+    std::vector<uint8_t>                    compressed_parameter_buffer_;
+    const uint8_t*                          parameter_data_; // Points to parameter_buffer_ or into the file mapping.
+    util::Compressor*                       compressor_;
+    std::vector<uint8_t>                    compression_dictionary_;
+    format::FillMemoryBlobCache             fill_memory_blobs_; // Data referenced by kFillMemoryFromBlobCommand.
+    uint64_t                                api_call_index_;
+    uint64_t                                block_limit_;
+    bool                                    capture_uses_frame_markers_;
+    uint64_t                                first_frame_;
+    FileIndex                               file_index_;
+    bool                                    use_file_mapping_;
+    uint8_t*                                mapped_data_;
+    size_t                                  mapped_size_;
+    size_t                                  mapped_offset_;
+    size_t                                  mapped_prefetch_offset_;
+    bool                                    mapped_eof_;
+    size_t                                  read_ahead_size_;
+    std::unique_ptr<BlockReadAhead>         read_ahead_;
+    const BlockReadAhead::Block*            memory_block_; // Block currently being processed.
+    size_t                                  memory_block_offset_;
+    bool                                    memory_block_eof_;
+    std::deque<BlockReadAhead::Block>       preloaded_blocks_;
+    BlockReadAhead::Block                   preloaded_block_;
+    std::vector<BlockReadAhead::Block>      loop_blocks_; // Blocks of the frames that are processed by LoopFrames().
+    size_t                                  loop_block_index_;
+    format::FillMemoryBlobCache             loop_fill_memory_blobs_; // Blobs retained at the start of the loop.
+    uint32_t                                loop_count_remaining_;
+    uint32_t                                loop_start_frame_;
+    uint64_t                                loop_start_block_index_;
+    // The loop begins when the preloaded blocks before it, such as a state snapshot, have been processed.
+    bool                                    loop_begin_pending_;
+    // A state end marker was processed, so frames that are looped later cannot be restored by the state snapshot.
+    bool                                    state_end_processed_;
+    std::unique_ptr<ThreadedCallDispatcher> threaded_calls_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -27,10 +27,14 @@
 #include "util/platform.h"
 
 #include <cassert>
+#include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+const size_t kOutputStreamBufferSize = 256 * 1024;
+const size_t kCopyBufferSize         = 4 * 1024 * 1024;
+
 FileTransformer::FileTransformer() :
     file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
     error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
@@ -57,9 +61,25 @@ bool FileTransformer::Initialize(const std::string& input_filename, const std::s
 
     if ((result == 0) && (input_file_ != nullptr))
     {
-        result = util::platform::FileOpen(&output_file_, output_filename.c_str(), "wb");
+        if (processing_worker_count_ > 0)
+        {
+            output_stream_ = std::make_unique<util::AsyncFileOutputStream>(output_filename, kOutputStreamBufferSize);
+
+            if (output_stream_->IsValid())
+            {
+                output_stream_->EnableBlockProcessing(processing_worker_count_, processor_factory_);
+            }
+            else
+            {
+                output_stream_.reset();
+            }
+        }
+        else
+        {
+            result = util::platform::FileOpen(&output_file_, output_filename.c_str(), "wb");
+        }
 
-        if ((result == 0) && (output_file_ != nullptr))
+        if ((result == 0) && ((output_file_ != nullptr) || (output_stream_ != nullptr)))
         {
             success = ProcessFileHeader();
         }
@@ -92,6 +112,8 @@ bool FileTransformer::Initialize(const std::string& input_filename, const std::s
             fclose(output_file_);
             output_file_ = nullptr;
         }
+
+        output_stream_.reset();
     }
 
     return success;
@@ -106,13 +128,47 @@ bool FileTransformer::Process()
     while (success)
     {
         success = ProcessNextBlock();
+
+        if (success)
+        {
+            CommitPendingBlock();
+
+            if (copy_after_state_ && state_snapshot_ended_ && (output_stream_ == nullptr))
+            {
+                success = CopyRemainingBytes();
+                break;
+            }
+        }
+
         block_index_++;
     }
 
+    if (IsHoldingOutputBlocks() && (error_state_ == kErrorNone))
+    {
+        // The end of the file was reached before the hold size.
+        ReleaseHeldBlocks();
+    }
+
+    if (output_stream_ != nullptr)
+    {
+        // Wait for the remaining blocks to be processed and written, so that the output size and any write errors can
+        // be reported.
+        output_stream_->WaitForIdle();
+
+        util::AsyncFileOutputStream::Statistics statistics = output_stream_->GetStatistics();
+
+        bytes_written_ = statistics.bytes_written;
+
+        if ((statistics.write_errors > 0) && (error_state_ == kErrorNone))
+        {
+            error_state_ = kErrorWritingFile;
+        }
+    }
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
-        if ((input_file_ == nullptr) || (output_file_ == nullptr))
+        if ((input_file_ == nullptr) || ((output_file_ == nullptr) && (output_stream_ == nullptr)))
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
@@ -120,7 +176,7 @@ bool FileTransformer::Process()
         {
             error_state_ = kErrorReadingFile;
         }
-        else if (ferror(output_file_))
+        else if ((output_file_ != nullptr) && ferror(output_file_))
         {
             error_state_ = kErrorWritingFile;
         }
@@ -167,6 +223,11 @@ bool FileTransformer::ProcessFileHeader()
             {
                 // Write header to output file.
                 success = WriteFileHeader(file_header_, file_options_);
+
+                if (success && (output_stream_ != nullptr))
+                {
+                    SubmitPendingBlock(false);
+                }
             }
         }
         else
@@ -217,7 +278,14 @@ bool FileTransformer::ProcessNextBlock()
 
             if (success)
             {
-                success = ProcessMetaData(block_header, meta_data_id);
+                if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kSetCompressionDictionaryCommand)
+                {
+                    success = ProcessCompressionDictionary(block_header, meta_data_id);
+                }
+                else
+                {
+                    success = ProcessMetaData(block_header, meta_data_id);
+                }
             }
             else
             {
@@ -234,6 +302,11 @@ bool FileTransformer::ProcessNextBlock()
             if (success)
             {
                 success = ProcessStateMarker(block_header, marker_type);
+
+                if (success && (marker_type == format::kEndMarker))
+                {
+                    state_snapshot_ended_ = true;
+                }
             }
             else
             {
@@ -285,6 +358,43 @@ bool FileTransformer::ProcessNextBlock()
     return success;
 }
 
+bool FileTransformer::CopyRemainingBytes()
+{
+    if (IsHoldingOutputBlocks() && !ReleaseHeldBlocks())
+    {
+        return false;
+    }
+
+    // Try an in-kernel copy first. Any bytes that it does not copy are copied through a buffer.
+    uint64_t copied = util::platform::FileCopyRange(input_file_, output_file_, std::numeric_limits<uint64_t>::max());
+    bytes_read_ += copied;
+    bytes_written_ += copied;
+
+    std::vector<uint8_t> buffer(kCopyBufferSize);
+    size_t               bytes_read = 0;
+
+    do
+    {
+        bytes_read = util::platform::FileRead(buffer.data(), 1, buffer.size(), input_file_);
+        bytes_read_ += bytes_read;
+
+        if ((bytes_read > 0) && !WriteBytes(buffer.data(), bytes_read))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to copy block data");
+            return false;
+        }
+    } while (bytes_read == buffer.size());
+
+    if (ferror(input_file_))
+    {
+        GFXRECON_LOG_ERROR("Failed to read block data");
+        error_state_ = kErrorReadingBlockData;
+        return false;
+    }
+
+    return true;
+}
+
 bool FileTransformer::ReadBlockHeader(format::BlockHeader* block_header)
 {
     assert(block_header != nullptr);
@@ -297,6 +407,91 @@ bool FileTransformer::ReadBlockHeader(format::BlockHeader* block_header)
     return false;
 }
 
+void FileTransformer::SubmitPendingBlock(bool process)
+{
+    if (!pending_block_.empty())
+    {
+        if (process)
+        {
+            output_stream_->WriteAndProcess(pending_block_.data(), pending_block_.size());
+        }
+        else
+        {
+            output_stream_->Write(pending_block_.data(), pending_block_.size());
+        }
+
+        pending_block_.clear();
+    }
+}
+
+void FileTransformer::CommitPendingBlock()
+{
+    if (IsHoldingOutputBlocks())
+    {
+        if (!pending_block_.empty())
+        {
+            held_bytes_ += pending_block_.size();
+            held_blocks_.emplace_back(std::move(pending_block_));
+            pending_block_.clear();
+        }
+
+        if (held_bytes_ >= hold_size_)
+        {
+            ReleaseHeldBlocks();
+        }
+    }
+    else if (output_stream_ != nullptr)
+    {
+        SubmitPendingBlock(true);
+    }
+}
+
+bool FileTransformer::ReleaseHeldBlocks()
+{
+    std::vector<std::vector<uint8_t>> blocks;
+    blocks.swap(held_blocks_);
+
+    hold_size_  = 0;
+    held_bytes_ = 0;
+
+    bool success = ProcessHeldBlocks(&blocks);
+
+    if (output_stream_ != nullptr)
+    {
+        // Blocks written by ProcessHeldBlocks() are not passed to the block processors.
+        SubmitPendingBlock(false);
+
+        for (const auto& block : blocks)
+        {
+            output_stream_->WriteAndProcess(block.data(), block.size());
+        }
+    }
+    else
+    {
+        for (const auto& block : blocks)
+        {
+            if (success && !WriteBytes(block.data(), block.size()))
+            {
+                HandleBlockWriteError(kErrorWritingBlockData, "Failed to write held block data");
+                success = false;
+            }
+        }
+    }
+
+    return success;
+}
+
+void FileTransformer::HoldOutputBlocks(size_t hold_size)
+{
+    hold_size_ = hold_size;
+}
+
+bool FileTransformer::ProcessHeldBlocks(std::vector<std::vector<uint8_t>>* blocks)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(blocks);
+    return true;
+}
+
 bool FileTransformer::WriteBlockHeader(const format::BlockHeader& block_header)
 {
     if (!WriteBytes(&block_header, sizeof(block_header)))
@@ -338,8 +533,10 @@ bool FileTransformer::ReadCompressedParameterBuffer(size_t  compressed_buffer_si
             parameter_buffer_.resize(expected_uncompressed_size);
         }
 
-        size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
+        size_t uncompressed_size = compressor_->Decompress(compressed_buffer_size,
+                                                           compressed_parameter_buffer_.data(),
+                                                           expected_uncompressed_size,
+                                                           &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
             *uncompressed_buffer_size = uncompressed_size;
@@ -359,6 +556,15 @@ bool FileTransformer::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileTransformer::WriteBytes(const void* buffer, size_t buffer_size)
 {
+    if ((output_stream_ != nullptr) || IsHoldingOutputBlocks())
+    {
+        // The output for the current block is collected and written as a single unit when the block is complete, so
+        // that it can be processed on a worker thread. The written byte count is updated from the stream.
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buffer);
+        pending_block_.insert(pending_block_.end(), bytes, bytes + buffer_size);
+        return true;
+    }
+
     size_t bytes_written = util::platform::FileWrite(buffer, 1, buffer_size, output_file_);
     bytes_written_ += bytes_written;
     return (bytes_written == buffer_size);
@@ -413,7 +619,7 @@ void FileTransformer::HandleBlockWriteError(Error error_code, const char* error_
 
 void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_message)
 {
-    if (ferror(output_file_))
+    if ((output_file_ != nullptr) && ferror(output_file_))
     {
         HandleBlockWriteError(error_code, error_message);
     }
@@ -424,12 +630,19 @@ void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_m
 }
 
 bool FileTransformer::CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor)
+{
+    return CreateCompressor(type, format::GetDefaultCompressionLevel(type), compressor);
+}
+
+bool FileTransformer::CreateCompressor(format::CompressionType            type,
+                                       int32_t                            compression_level,
+                                       std::unique_ptr<util::Compressor>* compressor)
 {
     assert(compressor != nullptr);
 
     if (type != format::CompressionType::kNone)
     {
-        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type));
+        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type, compression_level));
 
         if ((*compressor) == nullptr)
         {
@@ -444,6 +657,15 @@ bool FileTransformer::CreateCompressor(format::CompressionType type, std::unique
     return true;
 }
 
+void FileTransformer::EnableBlockProcessing(
+    uint32_t worker_count, const util::AsyncFileOutputStream::BlockProcessorFactory& processor_factory)
+{
+    assert(input_file_ == nullptr);
+
+    processing_worker_count_ = worker_count;
+    processor_factory_       = processor_factory;
+}
+
 bool FileTransformer::WriteFileHeader(const format::FileHeader&                  header,
                                       const std::vector<format::FileOptionPair>& options)
 {
@@ -530,6 +752,64 @@ bool FileTransformer::ProcessMetaData(const format::BlockHeader& block_header, f
     return true;
 }
 
+bool FileTransformer::ReadCompressionDictionary(format::SetCompressionDictionaryCommandHeader* header,
+                                                std::vector<uint8_t>*                          dictionary)
+{
+    assert((header != nullptr) && (dictionary != nullptr));
+
+    bool success = ReadBytes(&header->thread_id, sizeof(header->thread_id));
+    success      = success && ReadBytes(&header->dictionary_size, sizeof(header->dictionary_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read set compression dictionary meta-data block");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header->dictionary_size);
+    dictionary->resize(static_cast<size_t>(header->dictionary_size));
+
+    if (!ReadBytes(dictionary->data(), dictionary->size()))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary");
+        return false;
+    }
+
+    if ((compressor_ != nullptr) && !compressor_->SetDictionary(dictionary->data(), dictionary->size()))
+    {
+        GFXRECON_LOG_ERROR("Failed to load the compression dictionary");
+        error_state_ = kErrorReadingBlockData;
+        return false;
+    }
+
+    return true;
+}
+
+bool FileTransformer::ProcessCompressionDictionary(const format::BlockHeader& block_header,
+                                                   format::MetaDataId         meta_data_id)
+{
+    // The block is written unchanged, so that the compressed blocks that are copied to the output file can be
+    // decompressed with the same dictionary.
+    format::SetCompressionDictionaryCommandHeader header;
+    std::vector<uint8_t>                          dictionary;
+
+    if (!ReadCompressionDictionary(&header, &dictionary))
+    {
+        return false;
+    }
+
+    header.meta_header.block_header = block_header;
+    header.meta_header.meta_data_id = meta_data_id;
+
+    if (!WriteBytes(&header, sizeof(header)) || !WriteBytes(dictionary.data(), dictionary.size()))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write set compression dictionary meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
 bool FileTransformer::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
 {
     // Copy marker data from old file to new file.
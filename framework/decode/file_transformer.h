@@ -24,6 +24,7 @@
 #define GFXRECON_DECODE_FILE_TRANSFORMER_H
 
 #include "format/format.h"
+#include "util/async_file_output_stream.h"
 #include "util/defines.h"
 #include "util/compressor.h"
 
@@ -125,8 +126,39 @@ class FileTransformer
 
     bool CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor);
 
+    bool CreateCompressor(format::CompressionType            type,
+                          int32_t                            compression_level,
+                          std::unique_ptr<util::Compressor>* compressor);
+
+    // Write the output file from a separate writer thread. Each block that is written to the output file is passed
+    // through a BlockProcessor on one of worker_count worker threads, and the processed blocks are written in their
+    // original order. Must be called before Initialize().
+    void EnableBlockProcessing(uint32_t                                                 worker_count,
+                               const util::AsyncFileOutputStream::BlockProcessorFactory& processor_factory);
+
+    // Hold the output blocks in memory, instead of writing them, until hold_size bytes of blocks have been collected or
+    // the end of the input file is reached. The held blocks are then passed to ProcessHeldBlocks() before they are
+    // written. Blocks written by ProcessHeldBlocks() precede the held blocks in the output file.
+    void HoldOutputBlocks(size_t hold_size);
+
+    bool IsHoldingOutputBlocks() const { return (hold_size_ > 0); }
+
+    // Stop processing blocks after the end of the trimmed state snapshot, and copy the remainder of the input file to
+    // the output file unchanged, for transforms that only modify the state snapshot. Ignored in block processing mode,
+    // where every block is passed through a BlockProcessor. Must be called before Process().
+    void SetCopyAfterStateSnapshot(bool copy_after_state) { copy_after_state_ = copy_after_state; }
+
+    // Read the remainder of a set compression dictionary meta-data block and load the dictionary into the input file's
+    // compressor.
+    bool ReadCompressionDictionary(format::SetCompressionDictionaryCommandHeader* header,
+                                   std::vector<uint8_t>*                          dictionary);
+
     virtual bool WriteFileHeader(const format::FileHeader& header, const std::vector<format::FileOptionPair>& options);
 
+    virtual bool ProcessHeldBlocks(std::vector<std::vector<uint8_t>>* blocks);
+
+    virtual bool ProcessCompressionDictionary(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
     virtual bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
 
     virtual bool
@@ -145,6 +177,14 @@ class FileTransformer
 
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
+    void SubmitPendingBlock(bool process);
+
+    void CommitPendingBlock();
+
+    bool ReleaseHeldBlocks();
+
+    bool CopyRemainingBytes();
+
   private:
     FILE*                               input_file_;
     FILE*                               output_file_;
@@ -159,6 +199,19 @@ class FileTransformer
     std::vector<uint8_t>                compressed_parameter_buffer_;
     std::unique_ptr<util::Compressor>   compressor_;
     uint64_t                            block_index_{ 0 };
+    bool                                copy_after_state_{ false };
+    bool                                state_snapshot_ended_{ false };
+
+    // Block processing mode.
+    uint32_t                                           processing_worker_count_{ 0 };
+    util::AsyncFileOutputStream::BlockProcessorFactory processor_factory_;
+    std::unique_ptr<util::AsyncFileOutputStream>       output_stream_;
+    std::vector<uint8_t>                               pending_block_; // Output of the block being transformed.
+
+    // Held output blocks.
+    size_t                            hold_size_{ 0 };
+    size_t                            held_bytes_{ 0 };
+    std::vector<std::vector<uint8_t>> held_blocks_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,309 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Map from capture handle IDs to object info structures, using paged
+/// arrays indexed by ID in place of hashing.
+
+#ifndef GFXRECON_DECODE_HANDLE_ID_MAP_H
+#define GFXRECON_DECODE_HANDLE_ID_MAP_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+/// @brief Associative container for object info structures, keyed by the capture ID of the object.
+///
+/// Capture IDs are assigned from a single counter that is shared by all handle types, so they are dense and
+/// monotonic across the whole capture, but the IDs of a single handle type are spread out over that range. Rather
+/// than storing the info structures in an array indexed by ID, which would mostly hold empty slots, the ID is used to
+/// index pages of 32-bit entry indices, and the entries are stored in fixed size chunks that are allocated as the
+/// table grows. A lookup is two array loads with no hashing, and entries never move once inserted, so pointers to
+/// them remain valid until they are erased. Erased entries are reused by later insertions.
+///
+/// The interface is the subset of std::unordered_map that the object info tables use. Iteration order is entry
+/// order, which is not related to the order of the IDs.
+template <typename T>
+class HandleIdMap
+{
+  public:
+    struct value_type
+    {
+        format::HandleId first;
+        T                second;
+    };
+
+  private:
+    // Pages are kept small, because the IDs of one handle type are interleaved with the IDs of all other types and
+    // a page is allocated for every range of IDs that holds at least one object of the type.
+    static constexpr size_t   kPageBits     = 8;
+    static constexpr size_t   kPageSize     = size_t{ 1 } << kPageBits;
+    static constexpr size_t   kChunkBits    = 6;
+    static constexpr size_t   kChunkSize    = size_t{ 1 } << kChunkBits;
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+    static constexpr uint64_t kMaxPagedId   = uint64_t{ 1 } << 32;
+
+    using Page  = std::array<uint32_t, kPageSize>;
+    using Chunk = std::array<std::optional<value_type>, kChunkSize>;
+
+    template <typename Chunks, typename Value>
+    class IteratorBase
+    {
+      public:
+        IteratorBase(Chunks* chunks, size_t index, size_t end) : chunks_(chunks), index_(index), end_(end) {}
+
+        Value& operator*() const { return *(*(*chunks_)[index_ >> kChunkBits])[index_ & (kChunkSize - 1)]; }
+
+        Value* operator->() const { return &**this; }
+
+        IteratorBase& operator++()
+        {
+            ++index_;
+            SkipEmpty();
+            return *this;
+        }
+
+        bool operator==(const IteratorBase& other) const { return index_ == other.index_; }
+
+        bool operator!=(const IteratorBase& other) const { return index_ != other.index_; }
+
+        void SkipEmpty()
+        {
+            while ((index_ < end_) && !(*(*chunks_)[index_ >> kChunkBits])[index_ & (kChunkSize - 1)].has_value())
+            {
+                ++index_;
+            }
+        }
+
+      private:
+        Chunks* chunks_;
+        size_t  index_;
+        size_t  end_;
+    };
+
+  public:
+    using iterator       = IteratorBase<std::vector<std::unique_ptr<Chunk>>, value_type>;
+    using const_iterator = IteratorBase<const std::vector<std::unique_ptr<Chunk>>, const value_type>;
+
+    HandleIdMap() = default;
+
+    HandleIdMap(HandleIdMap&&) = default;
+
+    HandleIdMap& operator=(HandleIdMap&&) = default;
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    iterator begin()
+    {
+        iterator iter(&chunks_, 0, entry_count_);
+        iter.SkipEmpty();
+        return iter;
+    }
+
+    iterator end() { return iterator(&chunks_, entry_count_, entry_count_); }
+
+    const_iterator begin() const
+    {
+        const_iterator iter(&chunks_, 0, entry_count_);
+        iter.SkipEmpty();
+        return iter;
+    }
+
+    const_iterator end() const { return const_iterator(&chunks_, entry_count_, entry_count_); }
+
+    iterator find(format::HandleId id)
+    {
+        uint32_t index = FindIndex(id);
+        return (index != kInvalidIndex) ? iterator(&chunks_, index, entry_count_) : end();
+    }
+
+    const_iterator find(format::HandleId id) const
+    {
+        uint32_t index = FindIndex(id);
+        return (index != kInvalidIndex) ? const_iterator(&chunks_, index, entry_count_) : end();
+    }
+
+    std::pair<iterator, bool> emplace(format::HandleId id, T&& value)
+    {
+        uint32_t* slot = GetIndexSlot(id);
+
+        if (*slot != kInvalidIndex)
+        {
+            return std::make_pair(iterator(&chunks_, *slot, entry_count_), false);
+        }
+
+        uint32_t index = 0;
+        if (!free_entries_.empty())
+        {
+            index = free_entries_.back();
+            free_entries_.pop_back();
+        }
+        else
+        {
+            if ((entry_count_ & (kChunkSize - 1)) == 0)
+            {
+                chunks_.emplace_back(std::make_unique<Chunk>());
+            }
+
+            index = static_cast<uint32_t>(entry_count_++);
+        }
+
+        GetEntry(index).emplace(value_type{ id, std::move(value) });
+        *slot = index;
+        ++size_;
+
+        return std::make_pair(iterator(&chunks_, index, entry_count_), true);
+    }
+
+    size_t erase(format::HandleId id)
+    {
+        uint32_t* slot = FindIndexSlot(id);
+
+        if ((slot == nullptr) || (*slot == kInvalidIndex))
+        {
+            return 0;
+        }
+
+        GetEntry(*slot).reset();
+        free_entries_.push_back(*slot);
+        --size_;
+
+        if (id < kMaxPagedId)
+        {
+            *slot = kInvalidIndex;
+        }
+        else
+        {
+            unpaged_indices_.erase(id);
+        }
+
+        return 1;
+    }
+
+    void clear()
+    {
+        pages_.clear();
+        unpaged_indices_.clear();
+        chunks_.clear();
+        free_entries_.clear();
+        entry_count_ = 0;
+        size_        = 0;
+    }
+
+  private:
+    std::optional<value_type>& GetEntry(uint32_t index)
+    {
+        return (*chunks_[index >> kChunkBits])[index & (kChunkSize - 1)];
+    }
+
+    uint32_t FindIndex(format::HandleId id) const
+    {
+        if (id < kMaxPagedId)
+        {
+            size_t page = static_cast<size_t>(id >> kPageBits);
+            if ((page < pages_.size()) && (pages_[page] != nullptr))
+            {
+                return (*pages_[page])[static_cast<size_t>(id) & (kPageSize - 1)];
+            }
+        }
+        else
+        {
+            // IDs outside of the paged range are not expected from the capture ID counter, but are still supported.
+            auto entry = unpaged_indices_.find(id);
+            if (entry != unpaged_indices_.end())
+            {
+                return entry->second;
+            }
+        }
+
+        return kInvalidIndex;
+    }
+
+    uint32_t* FindIndexSlot(format::HandleId id)
+    {
+        if (id < kMaxPagedId)
+        {
+            size_t page = static_cast<size_t>(id >> kPageBits);
+            if ((page < pages_.size()) && (pages_[page] != nullptr))
+            {
+                return &(*pages_[page])[static_cast<size_t>(id) & (kPageSize - 1)];
+            }
+        }
+        else
+        {
+            auto entry = unpaged_indices_.find(id);
+            if (entry != unpaged_indices_.end())
+            {
+                return &entry->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    uint32_t* GetIndexSlot(format::HandleId id)
+    {
+        if (id < kMaxPagedId)
+        {
+            size_t page = static_cast<size_t>(id >> kPageBits);
+
+            if (page >= pages_.size())
+            {
+                pages_.resize(page + 1);
+            }
+
+            if (pages_[page] == nullptr)
+            {
+                pages_[page] = std::make_unique<Page>();
+                pages_[page]->fill(kInvalidIndex);
+            }
+
+            return &(*pages_[page])[static_cast<size_t>(id) & (kPageSize - 1)];
+        }
+
+        return &unpaged_indices_.emplace(id, kInvalidIndex).first->second;
+    }
+
+  private:
+    std::vector<std::unique_ptr<Page>>             pages_;
+    std::unordered_map<format::HandleId, uint32_t> unpaged_indices_;
+    std::vector<std::unique_ptr<Chunk>>            chunks_;
+    std::vector<uint32_t>                          free_entries_;
+    size_t                                         entry_count_{ 0 };
+    size_t                                         size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_HANDLE_ID_MAP_H
@@ -29,9 +29,15 @@
 #include "util/logging.h"
 #include "decode/api_decoder.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Maximum number of blocks per serializer thread that may be waiting to be serialized or written before
+// WriteBlockEnd() blocks, to bound the memory used by pending trees when the output cannot keep up.
+const size_t kMaxPendingBlocksPerThread = 64;
+
 JsonWriter::JsonWriter(const util::JsonOptions& options,
                        const std::string_view   gfxrVersion,
                        const std::string_view   inputFilepath) :
@@ -39,16 +45,29 @@ JsonWriter::JsonWriter(const util::JsonOptions& options,
 {
     header_["source-path"]      = inputFilepath;
     header_["gfxrecon-version"] = std::string(gfxrVersion);
+    block_stream_.SetIndent(GetIndent());
 }
 
 JsonWriter::~JsonWriter()
 {
+    StopSerializers();
+
     if (os_)
     {
         os_->Flush();
     }
 }
 
+void JsonWriter::EnableSerializerThreads(uint32_t thread_count)
+{
+    GFXRECON_ASSERT(serializer_threads_.empty());
+
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        serializer_threads_.emplace_back(&JsonWriter::SerializerThreadMain, this);
+    }
+}
+
 void JsonWriter::StartStream(util::OutputStream* os)
 {
     GFXRECON_ASSERT(os);
@@ -72,6 +91,8 @@ void JsonWriter::EndStream()
 {
     if (os_ != nullptr)
     {
+        WaitForSerializers();
+
         if (json_options_.format == util::JsonFormat::JSON)
         {
             Write(*os_, "\n]\n");
@@ -103,21 +124,210 @@ nlohmann::ordered_json& JsonWriter::WriteBlockStart()
 }
 
 void JsonWriter::WriteBlockEnd()
+{
+    if (!serializer_threads_.empty())
+    {
+        std::unique_lock<std::mutex>   lock(serializer_mutex_);
+        std::unique_ptr<SerializerJob> job = AcquireSerializerJob(lock);
+
+        // Hand the tree over to the serializer threads, leaving an empty tree for the next block.
+        job->tree.swap(json_data_);
+        job->serialized = false;
+
+        EnqueueSerializerJob(lock, std::move(job));
+        return;
+    }
+
+    // Dominates profiling (2/2), and can be moved to background threads with EnableSerializerThreads():
+    block_stream_.Clear();
+    block_stream_.Json(json_data_);
+    WriteBlockText(block_stream_.GetText());
+}
+
+util::JsonStreamWriter& JsonWriter::WriteStreamBlockStart()
+{
+    block_stream_.Clear();
+    return block_stream_;
+}
+
+void JsonWriter::WriteStreamBlockEnd()
+{
+    block_stream_.EndScopes();
+
+    if (!serializer_threads_.empty())
+    {
+        std::unique_lock<std::mutex>   lock(serializer_mutex_);
+        std::unique_ptr<SerializerJob> job = AcquireSerializerJob(lock);
+
+        // The block is already text, so it only needs to take its place in the output order.
+        job->text.assign(block_stream_.GetText());
+        job->serialized = true;
+
+        EnqueueSerializerJob(lock, std::move(job));
+        return;
+    }
+
+    WriteBlockText(block_stream_.GetText());
+}
+
+int JsonWriter::GetIndent() const
+{
+    return json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth;
+}
+
+std::unique_ptr<JsonWriter::SerializerJob> JsonWriter::AcquireSerializerJob(std::unique_lock<std::mutex>& lock)
+{
+    serializer_space_.wait(lock, [this]() {
+        return serializer_jobs_.size() < (serializer_threads_.size() * kMaxPendingBlocksPerThread);
+    });
+
+    std::unique_ptr<SerializerJob> job;
+    if (!free_serializer_jobs_.empty())
+    {
+        job = std::move(free_serializer_jobs_.back());
+        free_serializer_jobs_.pop_back();
+    }
+    else
+    {
+        job = std::make_unique<SerializerJob>();
+    }
+
+    return job;
+}
+
+void JsonWriter::EnqueueSerializerJob(std::unique_lock<std::mutex>& lock, std::unique_ptr<SerializerJob> job)
+{
+    job->first = first_;
+    first_     = false;
+
+    serializer_jobs_.emplace_back(std::move(job));
+    lock.unlock();
+
+    serializer_work_.notify_one();
+}
+
+void JsonWriter::WriteBlockText(const std::string& text)
 {
     if (!first_)
     {
         Write(*os_, json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
     }
     first_ = false;
-    /// @todo Hand the tree over to a backend thread which dumps it to a string and streams it
-    /// while the main thread gets on with building the tree for the next block.
-    // Dominates profiling (2/2):
-    const std::string block =
-        json_data_.dump(json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
-    Write(*os_, block);
+    Write(*os_, text);
     os_->Flush();
 }
 
+void JsonWriter::WaitForSerializers()
+{
+    if (!serializer_threads_.empty())
+    {
+        std::unique_lock<std::mutex> lock(serializer_mutex_);
+        serializer_space_.wait(lock, [this]() { return serializer_jobs_.empty() && !serializer_writing_; });
+    }
+}
+
+void JsonWriter::StopSerializers()
+{
+    if (!serializer_threads_.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(serializer_mutex_);
+            stop_serializers_ = true;
+        }
+
+        serializer_work_.notify_all();
+
+        for (auto& thread : serializer_threads_)
+        {
+            thread.join();
+        }
+
+        serializer_threads_.clear();
+    }
+}
+
+void JsonWriter::SerializerThreadMain()
+{
+    util::JsonStreamWriter stream(GetIndent());
+
+    std::unique_lock<std::mutex> lock(serializer_mutex_);
+
+    for (;;)
+    {
+        if (!serializer_writing_ && !serializer_jobs_.empty() && serializer_jobs_.front()->serialized)
+        {
+            // Write the serialized blocks at the front of the queue. Only one thread writes at a time, which keeps the
+            // blocks in order while the other threads continue serializing.
+            std::vector<std::unique_ptr<SerializerJob>> ready_jobs;
+            while (!serializer_jobs_.empty() && serializer_jobs_.front()->serialized)
+            {
+                ready_jobs.emplace_back(std::move(serializer_jobs_.front()));
+                serializer_jobs_.pop_front();
+            }
+
+            // Blocks that were streamed are queued already serialized, and may be written before being claimed.
+            next_serializer_job_ -= std::min(next_serializer_job_, ready_jobs.size());
+            serializer_writing_ = true;
+            lock.unlock();
+
+            for (const auto& job : ready_jobs)
+            {
+                if (!job->first)
+                {
+                    Write(*os_, json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+                }
+                Write(*os_, job->text);
+            }
+            os_->Flush();
+
+            lock.lock();
+            serializer_writing_ = false;
+
+            for (auto& job : ready_jobs)
+            {
+                job->text.clear();
+                free_serializer_jobs_.emplace_back(std::move(job));
+            }
+
+            serializer_space_.notify_all();
+            serializer_work_.notify_all();
+        }
+        else if (next_serializer_job_ < serializer_jobs_.size())
+        {
+            SerializerJob* job = serializer_jobs_[next_serializer_job_].get();
+            ++next_serializer_job_;
+
+            if (job->serialized)
+            {
+                continue;
+            }
+
+            lock.unlock();
+
+            stream.Clear();
+            stream.Json(job->tree);
+            job->text.assign(stream.GetText());
+            job->tree.clear();
+
+            lock.lock();
+            job->serialized = true;
+
+            if (job == serializer_jobs_.front().get())
+            {
+                serializer_work_.notify_all();
+            }
+        }
+        else if (stop_serializers_ && serializer_jobs_.empty())
+        {
+            break;
+        }
+        else
+        {
+            serializer_work_.wait(lock);
+        }
+    }
+}
+
 nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
 {
     auto& json_data = WriteBlockStart();
@@ -151,19 +361,69 @@ nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo&     cal
     return method;
 }
 
+util::JsonStreamWriter& JsonWriter::WriteStreamApiCallStart(const ApiCallInfo&     call_info,
+                                                            const std::string_view command_name)
+{
+    auto& stream = WriteStreamBlockStart();
+
+    stream.BeginObject();
+    stream.Key(format::kNameIndex);
+    stream.Uint(call_info.index);
+
+    stream.Key(format::kNameFunction);
+    stream.BeginObject();
+    stream.Key(format::kNameName);
+    stream.String(command_name);
+    stream.Key(format::kNameThread);
+    stream.Uint(call_info.thread_id);
+
+    return stream;
+}
+
+util::JsonStreamWriter& JsonWriter::WriteStreamApiCallStart(const ApiCallInfo&     call_info,
+                                                            const std::string_view object_type,
+                                                            const format::HandleId object_id,
+                                                            const std::string_view command_name)
+{
+    auto& stream = WriteStreamBlockStart();
+
+    stream.BeginObject();
+    stream.Key(format::kNameIndex);
+    stream.Uint(call_info.index);
+
+    stream.Key(format::kNameMethod);
+    stream.BeginObject();
+    stream.Key(format::kNameName);
+    stream.String(command_name);
+    stream.Key(format::kNameThread);
+    stream.Uint(call_info.thread_id);
+
+    stream.Key(format::kNameObject);
+    stream.BeginObject();
+    stream.Key(format::kNameObjectType);
+    stream.String(object_type);
+    stream.Key(format::kNameObjectHandle);
+    FieldToJson(stream, object_id, GetOptions());
+    stream.EndObject();
+
+    return stream;
+}
+
 void JsonWriter::WriteMarker(const char* const name, const std::string_view marker_type, uint64_t frame_number)
 {
     // Markers are dispatched to all decoders and consumers so de-duplicate them for JSON
     // output in case the build has multiple JSON consumers for different APIs enabled.
     if (frame_number != last_frame_number_ || name != last_marker_name_ || marker_type != last_marker_type_)
     {
-        auto& json_data = WriteBlockStart();
-
-        nlohmann::ordered_json& state = json_data[name];
-        state["marker_type"]          = marker_type;
-        state["frame_number"]         = frame_number;
-
-        WriteBlockEnd();
+        auto& stream = WriteStreamBlockStart();
+        stream.BeginObject();
+        stream.Key(name);
+        stream.BeginObject();
+        stream.Key("marker_type");
+        stream.String(marker_type);
+        stream.Key("frame_number");
+        stream.Uint(frame_number);
+        WriteStreamBlockEnd();
 
         last_marker_name_  = name;
         last_marker_type_  = marker_type;
@@ -181,18 +441,40 @@ nlohmann::ordered_json& JsonWriter::WriteMetaCommandStart(const std::string_view
     return meta[format::kNameArgs];
 }
 
+util::JsonStreamWriter& JsonWriter::WriteStreamMetaCommandStart(const std::string_view command_name)
+{
+    auto& stream = WriteStreamBlockStart();
+
+    stream.BeginObject();
+    stream.Key(format::kNameIndex);
+    stream.Uint(block_index_);
+    stream.Key(format::kNameMeta);
+    stream.BeginObject();
+    stream.Key(format::kNameName);
+    stream.String(command_name);
+    stream.Key(format::kNameArgs);
+    stream.BeginObject();
+    return stream;
+}
+
 void JsonWriter::ProcessAnnotation(uint64_t               block_index,
                                    format::AnnotationType type,
                                    const std::string&     label,
                                    const std::string&     data)
 {
-    auto& json_data     = WriteBlockStart();
-    json_data["index"]  = block_index;
-    auto& annotation    = json_data["annotation"];
-    annotation["type"]  = util::AnnotationTypeToString(type);
-    annotation["label"] = label;
-    annotation["data"]  = data;
-    WriteBlockEnd();
+    auto& stream = WriteStreamBlockStart();
+    stream.BeginObject();
+    stream.Key("index");
+    stream.Uint(block_index);
+    stream.Key("annotation");
+    stream.BeginObject();
+    stream.Key("type");
+    stream.String(util::AnnotationTypeToString(type));
+    stream.Key("label");
+    stream.String(label);
+    stream.Key("data");
+    stream.String(data);
+    WriteStreamBlockEnd();
 }
 
 std::string JsonWriter::GenerateFilename(const std::string_view filename)
@@ -213,11 +495,9 @@ bool JsonWriter::WriteBinaryFile(const std::string& filename, uint64_t data_size
     return false;
 }
 
-void RepresentBinaryFile(JsonWriter&             writer,
-                         nlohmann::ordered_json& jdata,
-                         std::string_view        filename_base,
-                         const uint64_t          data_size,
-                         const uint8_t* const    data)
+/// Write the binary file if enabled, returning the text to represent the data with.
+static std::string
+RepresentBinaryFileText(JsonWriter& writer, std::string_view filename_base, uint64_t data_size, const uint8_t* data)
 {
     const util::JsonOptions& json_options = writer.GetOptions();
     if (json_options.dump_binaries)
@@ -227,18 +507,36 @@ void RepresentBinaryFile(JsonWriter&             writer,
         std::string filepath = gfxrecon::util::filepath::Join(json_options.root_dir, basename);
         if (writer.WriteBinaryFile(filepath, data_size, data))
         {
-            FieldToJson(jdata, basename, json_options);
+            return basename;
         }
         else
         {
-            FieldToJson(jdata, format::kValWriteFailed, json_options);
+            return format::kValWriteFailed;
         }
     }
     else
     {
-        FieldToJson(jdata, format::kValBinary, json_options);
+        return format::kValBinary;
     }
 }
 
+void RepresentBinaryFile(JsonWriter&             writer,
+                         nlohmann::ordered_json& jdata,
+                         std::string_view        filename_base,
+                         const uint64_t          data_size,
+                         const uint8_t* const    data)
+{
+    FieldToJson(jdata, RepresentBinaryFileText(writer, filename_base, data_size, data), writer.GetOptions());
+}
+
+void RepresentBinaryFile(JsonWriter&             writer,
+                         util::JsonStreamWriter& stream,
+                         std::string_view        filename_base,
+                         const uint64_t          data_size,
+                         const uint8_t* const    data)
+{
+    FieldToJson(stream, RepresentBinaryFileText(writer, filename_base, data_size, data), writer.GetOptions());
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -28,6 +28,7 @@
 #define GFXRECON_DECODE_JSON_WRITER_H
 
 #include "annotation_handler.h"
+#include "util/json_stream_writer.h"
 #include "util/json_util.h"
 #include "util/platform.h"
 #include "util/defines.h"
@@ -35,6 +36,13 @@
 
 #include "nlohmann/json.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 class OutputStream;
@@ -52,6 +60,11 @@ class JsonWriter : public AnnotationHandler
                const std::string_view   inputFilepath);
     ~JsonWriter();
 
+    /// Serialize blocks to strings and write them to the stream on thread_count background
+    /// threads, while the calling thread builds the tree for the following blocks. Blocks are
+    /// written in the order that WriteBlockEnd() was called. Must be called before StartStream().
+    void EnableSerializerThreads(uint32_t thread_count);
+
     /// Output any data associated with the start of a logical stream such as a header object.
     void StartStream(util::OutputStream* os);
     /// Output data at end of stream such as closing the JSON array.
@@ -67,6 +80,15 @@ class JsonWriter : public AnnotationHandler
     /// Finalise the current block and stream it out.
     void WriteBlockEnd();
 
+    /// Get a cleared stream writer to write a block's representation to directly,
+    /// without building a tree. Users write the tokens of the top-level object,
+    /// starting with BeginObject(), before calling WriteStreamBlockEnd(), which
+    /// closes any scopes that are still open.
+    util::JsonStreamWriter& WriteStreamBlockStart();
+
+    /// Finalise the current streamed block and write it out.
+    void WriteStreamBlockEnd();
+
     /// Start the JSON tree for a function call, building the top-level object
     /// with index and function fields, adding name and thread to the function.
     /// @return The "function" object field for the caller to populate further
@@ -82,12 +104,28 @@ class JsonWriter : public AnnotationHandler
                                               const format::HandleId object_id,
                                               const std::string_view command_name);
 
+    /// Stream the start of a function call in the same form as WriteApiCallStart(),
+    /// leaving the "function" object open for the caller to write the return value
+    /// if any and the arguments to before calling WriteStreamBlockEnd().
+    util::JsonStreamWriter& WriteStreamApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name);
+
+    /// Stream the start of a method call in the same form as WriteApiCallStart(),
+    /// leaving the "method" object open for the caller to write to.
+    util::JsonStreamWriter& WriteStreamApiCallStart(const ApiCallInfo&     call_info,
+                                                    const std::string_view object_type,
+                                                    const format::HandleId object_id,
+                                                    const std::string_view command_name);
+
     void WriteMarker(const char* name, const std::string_view marker_type, uint64_t frame_number);
 
     /// @brief Output the boilerplate for representing a metadata block in JSON,
     /// returning the root of the empty "args" JSON sub-tree for the caller to populate.
     nlohmann::ordered_json& WriteMetaCommandStart(const std::string_view command_name);
 
+    /// @brief Stream the boilerplate for representing a metadata block in JSON,
+    /// leaving the "args" object open for the caller to write its keys and values to.
+    util::JsonStreamWriter& WriteStreamMetaCommandStart(const std::string_view command_name);
+
     /// Get the JSON object used to output the per-stream header
     /// Consumers can add their own fields to it.
     nlohmann::ordered_json& GetHeaderJson() { return header_; }
@@ -110,11 +148,36 @@ class JsonWriter : public AnnotationHandler
 
     inline void SetCurrentBlockIndex(uint64_t block_index) { block_index_ = block_index; }
 
+  private:
+    struct SerializerJob
+    {
+        nlohmann::ordered_json tree;
+        std::string            text;
+        bool                   first{ false };
+        bool                   serialized{ false };
+    };
+
+  private:
+    int GetIndent() const;
+
+    void EnqueueSerializerJob(std::unique_lock<std::mutex>& lock, std::unique_ptr<SerializerJob> job);
+
+    std::unique_ptr<SerializerJob> AcquireSerializerJob(std::unique_lock<std::mutex>& lock);
+
+    void WriteBlockText(const std::string& text);
+
+    void WaitForSerializers();
+
+    void StopSerializers();
+
+    void SerializerThreadMain();
+
   private:
     util::OutputStream*    os_;
     nlohmann::ordered_json header_;
     util::JsonOptions      json_options_;
     nlohmann::ordered_json json_data_;
+    util::JsonStreamWriter block_stream_; // Reused for every block, so its buffer only grows to the largest block.
     uint64_t               block_index_;
     uint32_t               num_streams_{ 0 };
     /// Number of side-files generated for dumping binary blobs etc.
@@ -127,6 +190,16 @@ class JsonWriter : public AnnotationHandler
     uint64_t    last_frame_number_{ 0 };
 
     bool first_{ true };
+
+    std::vector<std::thread>                    serializer_threads_;
+    std::mutex                                  serializer_mutex_;
+    std::condition_variable                     serializer_work_;
+    std::condition_variable                     serializer_space_;
+    std::deque<std::unique_ptr<SerializerJob>>  serializer_jobs_; // Blocks in output order.
+    std::vector<std::unique_ptr<SerializerJob>> free_serializer_jobs_;
+    size_t                                      next_serializer_job_{ 0 }; // Index of the first unclaimed job.
+    bool                                        serializer_writing_{ false };
+    bool                                        stop_serializers_{ false };
 };
 
 /// Either write the binary data to a file, and put the filename in the tree or
@@ -137,6 +210,13 @@ void RepresentBinaryFile(JsonWriter&             writer,
                          const uint64_t          data_size,
                          const uint8_t* const    data);
 
+/// Stream version of RepresentBinaryFile() writing the filename or tag as the next value.
+void RepresentBinaryFile(JsonWriter&             writer,
+                         util::JsonStreamWriter& stream,
+                         const std::string_view  filename_base,
+                         const uint64_t          data_size,
+                         const uint8_t* const    data);
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -55,6 +55,12 @@ class MetadataJsonConsumer : public Base
         return this->writer_->WriteMetaCommandStart(command_name);
     }
     inline void WriteBlockEnd() { this->writer_->WriteBlockEnd(); }
+    inline util::JsonStreamWriter& WriteStreamMetaCommandStart(const std::string& command_name) const
+    {
+        this->writer_->SetCurrentBlockIndex(this->block_index_);
+        return this->writer_->WriteStreamMetaCommandStart(command_name);
+    }
+    inline void WriteStreamBlockEnd() { this->writer_->WriteStreamBlockEnd(); }
 
   public:
     /// @defGroup ApiAgnosticMetaBlocks Metablocks used by both Vulkan and DX12.
@@ -69,13 +75,18 @@ class MetadataJsonConsumer : public Base
     virtual void
     ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override
     {
+        // Fill memory commands are among the most frequent blocks, so they are streamed without building a tree.
         const util::JsonOptions& json_options = GetOptions();
-        auto&                    jdata        = WriteMetaCommandStart("FillMemoryCommand");
-        HandleToJson(jdata["memory_id"], memory_id, json_options);
-        FieldToJson(jdata["offset"], offset, json_options);
-        FieldToJson(jdata["size"], size, json_options);
-        RepresentBinaryFile(*(this->writer_), jdata[format::kNameData], "fill_memory.bin", size, data);
-        WriteBlockEnd();
+        auto&                    stream       = WriteStreamMetaCommandStart("FillMemoryCommand");
+        stream.Key("memory_id");
+        HandleToJson(stream, memory_id, json_options);
+        stream.Key("offset");
+        FieldToJson(stream, offset, json_options);
+        stream.Key("size");
+        FieldToJson(stream, size, json_options);
+        stream.Key(format::kNameData);
+        RepresentBinaryFile(*(this->writer_), stream, "fill_memory.bin", size, data);
+        WriteStreamBlockEnd();
     }
 
     virtual void ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height) override
@@ -48,6 +48,8 @@ struct ReplayOptions
     bool     quit_after_measurement_frame_range{ false };
     bool     flush_measurement_frame_range{ false };
     bool     flush_inside_measurement_range{ false };
+    bool     preload_measurement_range{ false };
+    uint32_t measurement_range_loop_count{ 1 };
     bool     force_windowed{ false };
     uint32_t windowed_width{ 0 };
     uint32_t windowed_height{ 0 };
@@ -24,16 +24,44 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
+#include "decode/decode_allocator.h"
+#include "decode/file_processor.h"
+#include "decode/handle_id_map.h"
+#include "decode/json_writer.h"
+#include "decode/threaded_call_dispatcher.h"
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_object_info_table.h"
+#include "format/fill_memory_blob.h"
 #include "format/format.h"
 #include "format/format_util.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_enum_to_json.h"
+#include "generated/generated_vulkan_json_consumer.h"
+#include "generated/generated_vulkan_struct_to_json.h"
+#include "util/memory_output_stream.h"
+
+#if defined(D3D12_SUPPORT)
+#include "generated/generated_dx12_json_consumer.h"
+#include "generated/generated_dx12_struct_decoders_to_json.h"
+#endif
 
 #include "vulkan/vulkan.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 const VkBuffer                   kBufferHandles[] = { gfxrecon::format::FromHandleId<VkBuffer>(0xabcd),
@@ -147,3 +175,777 @@ TEST_CASE("handle IDs need to be mapped to valid handles", "[wrapper]")
 
     gfxrecon::util::Log::Release();
 }
+
+TEST_CASE("DecodeAllocator scopes are independent between threads", "[allocator]")
+{
+    const size_t kThreadCount    = 4;
+    const size_t kIterationCount = 1000;
+
+    std::vector<std::thread> threads;
+    std::vector<int>         results(kThreadCount, 0);
+
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        threads.emplace_back([i, &results]() {
+            const uint64_t thread_bits = static_cast<uint64_t>(i) << 32;
+            bool           success     = true;
+
+            for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                gfxrecon::decode::DecodeAllocator::Begin();
+
+                const size_t count  = 1 + ((i + iteration) % 256);
+                uint64_t*    values = gfxrecon::decode::DecodeAllocator::Allocate<uint64_t>(count, false);
+                for (size_t j = 0; j < count; ++j)
+                {
+                    values[j] = thread_bits | iteration;
+                }
+
+                // Give the other threads a chance to allocate and end their scopes before the values are checked.
+                std::this_thread::yield();
+
+                for (size_t j = 0; j < count; ++j)
+                {
+                    success = success && (values[j] == (thread_bits | iteration));
+                }
+
+                gfxrecon::decode::DecodeAllocator::End();
+            }
+
+            gfxrecon::decode::DecodeAllocator::DestroyInstance();
+            results[i] = success ? 1 : 0;
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        REQUIRE(results[i] == 1);
+    }
+}
+
+// Records the order of the vkCmdSetLineWidth calls for each command buffer.
+class LineWidthConsumer : public gfxrecon::decode::VulkanConsumer
+{
+  public:
+    virtual bool SupportsThreadedDecoding(gfxrecon::format::ApiCallId call_id) override { return true; }
+
+    virtual void Process_vkCmdSetLineWidth(const gfxrecon::decode::ApiCallInfo& call_info,
+                                           gfxrecon::format::HandleId           commandBuffer,
+                                           float                                lineWidth) override
+    {
+        if (lineWidth == fail_width)
+        {
+            throw std::runtime_error("Failed to replay vkCmdSetLineWidth");
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        line_widths[commandBuffer].push_back(lineWidth);
+    }
+
+    std::mutex                                               mutex;
+    std::map<gfxrecon::format::HandleId, std::vector<float>> line_widths;
+    float                                                    fail_width{ -1.0f };
+};
+
+static std::vector<uint8_t> EncodeSetLineWidth(gfxrecon::format::HandleId command_buffer, float line_width)
+{
+    std::vector<uint8_t> buffer(sizeof(command_buffer) + sizeof(line_width));
+    memcpy(buffer.data(), &command_buffer, sizeof(command_buffer));
+    memcpy(buffer.data() + sizeof(command_buffer), &line_width, sizeof(line_width));
+    return buffer;
+}
+
+TEST_CASE("ThreadedCallDispatcher preserves the order of calls for each queue", "[threading]")
+{
+    const uint32_t kCallCount          = 10000;
+    const uint32_t kThreadCount        = 6;
+    const uint32_t kCommandBufferCount = 8;
+
+    LineWidthConsumer               consumer;
+    gfxrecon::decode::VulkanDecoder decoder;
+    decoder.AddConsumer(&consumer);
+
+    std::vector<gfxrecon::decode::ApiDecoder*> decoders = { &decoder };
+
+    // Two command buffers share each pool, and the calls for each pool are made from several threads.
+    gfxrecon::decode::ThreadedCallDispatcher dispatcher([](gfxrecon::format::ApiCallId call_id,
+                                                           const uint8_t*              parameter_buffer,
+                                                           size_t                      buffer_size,
+                                                           gfxrecon::format::HandleId* queue_key) {
+        if (call_id != gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth)
+        {
+            return false;
+        }
+
+        gfxrecon::format::HandleId command_buffer = 0;
+        memcpy(&command_buffer, parameter_buffer, sizeof(command_buffer));
+        (*queue_key) = 1 + (command_buffer / 2);
+        return true;
+    });
+
+    for (uint32_t i = 0; i < kCallCount; ++i)
+    {
+        gfxrecon::decode::ApiCallInfo call_info{ i, (i / 3) % kThreadCount };
+        std::vector<uint8_t>          buffer = EncodeSetLineWidth(i % kCommandBufferCount, static_cast<float>(i));
+
+        REQUIRE(dispatcher.Dispatch(decoders,
+                                    gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth,
+                                    call_info,
+                                    buffer.data(),
+                                    buffer.size()));
+    }
+
+    // Calls that are not selected by the filter are left to the caller.
+    gfxrecon::decode::ApiCallInfo queue_call_info{ kCallCount, 0 };
+    REQUIRE(!dispatcher.Dispatch(
+        decoders, gfxrecon::format::ApiCallId::ApiCall_vkQueueWaitIdle, queue_call_info, nullptr, 0));
+
+    dispatcher.WaitIdle();
+
+    REQUIRE(consumer.line_widths.size() == kCommandBufferCount);
+    for (const auto& entry : consumer.line_widths)
+    {
+        const std::vector<float>& line_widths = entry.second;
+        REQUIRE(line_widths.size() == (kCallCount / kCommandBufferCount));
+
+        for (size_t i = 1; i < line_widths.size(); ++i)
+        {
+            REQUIRE(line_widths[i - 1] < line_widths[i]);
+        }
+    }
+
+    // Errors are reported to the dispatching thread.
+    consumer.fail_width = 1.0f;
+    for (uint32_t i = 0; i < kThreadCount; ++i)
+    {
+        gfxrecon::decode::ApiCallInfo call_info{ i, i };
+        std::vector<uint8_t>          buffer = EncodeSetLineWidth(kCommandBufferCount + i, static_cast<float>(i));
+
+        dispatcher.Dispatch(decoders,
+                            gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth,
+                            call_info,
+                            buffer.data(),
+                            buffer.size());
+    }
+
+    REQUIRE_THROWS_AS(dispatcher.WaitIdle(), std::runtime_error);
+    REQUIRE_NOTHROW(dispatcher.WaitIdle());
+}
+
+TEST_CASE("ThreadedCallDispatcher leaves calls for consumers without threading support to the caller", "[threading]")
+{
+    LineWidthConsumer                thread_safe_consumer;
+    gfxrecon::decode::VulkanConsumer shared_state_consumer;
+    gfxrecon::decode::VulkanDecoder  decoder;
+    decoder.AddConsumer(&thread_safe_consumer);
+
+    std::vector<gfxrecon::decode::ApiDecoder*> decoders = { &decoder };
+
+    gfxrecon::decode::ThreadedCallDispatcher dispatcher([](gfxrecon::format::ApiCallId call_id,
+                                                           const uint8_t*              parameter_buffer,
+                                                           size_t                      buffer_size,
+                                                           gfxrecon::format::HandleId* queue_key) {
+        (*queue_key) = 1;
+        return true;
+    });
+
+    gfxrecon::decode::ApiCallInfo call_info{ 0, 0 };
+    std::vector<uint8_t>          buffer = EncodeSetLineWidth(1, 1.0f);
+
+    REQUIRE(dispatcher.Dispatch(
+        decoders, gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth, call_info, buffer.data(), buffer.size()));
+
+    // The consumers may only be changed while no calls are being decoded.
+    dispatcher.WaitIdle();
+
+    // A consumer that does not support threaded decoding excludes the call, even though it is selected by the filter.
+    decoder.AddConsumer(&shared_state_consumer);
+    REQUIRE(!dispatcher.Dispatch(
+        decoders, gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth, call_info, buffer.data(), buffer.size()));
+
+    decoder.RemoveConsumer(&shared_state_consumer);
+    REQUIRE(dispatcher.Dispatch(
+        decoders, gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth, call_info, buffer.data(), buffer.size()));
+
+    dispatcher.WaitIdle();
+
+    REQUIRE(thread_safe_consumer.line_widths[1].size() == 2);
+
+    // A decoder without consumers does not support threaded decoding.
+    decoder.RemoveConsumer(&thread_safe_consumer);
+    REQUIRE(!dispatcher.Dispatch(
+        decoders, gfxrecon::format::ApiCallId::ApiCall_vkCmdSetLineWidth, call_info, buffer.data(), buffer.size()));
+}
+
+class FillMemoryConsumer : public gfxrecon::decode::VulkanConsumer
+{
+  public:
+    struct Fill
+    {
+        uint64_t memory_id;
+        uint64_t size;
+        uint8_t  value;
+    };
+
+  public:
+    virtual void
+    ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override
+    {
+        fills.push_back({ memory_id, size, (size > 0) ? data[0] : uint8_t{ 0 } });
+    }
+
+    std::vector<Fill> fills;
+};
+
+static void WriteFrameEndMarker(std::ofstream& file, uint64_t frame_number)
+{
+    gfxrecon::format::Marker marker;
+    marker.header.size  = sizeof(marker.marker_type) + sizeof(marker.frame_number);
+    marker.header.type  = gfxrecon::format::BlockType::kFrameMarkerBlock;
+    marker.marker_type  = gfxrecon::format::MarkerType::kEndMarker;
+    marker.frame_number = frame_number;
+    file.write(reinterpret_cast<const char*>(&marker), sizeof(marker));
+}
+
+static void WriteFillMemoryBlob(std::ofstream&                 file,
+                                gfxrecon::format::MetaDataType type,
+                                uint64_t                       blob_id,
+                                uint64_t                       memory_id,
+                                const std::vector<uint8_t>&    data)
+{
+    const bool has_data = (type == gfxrecon::format::MetaDataType::kFillMemoryBlobCommand);
+
+    gfxrecon::format::FillMemoryBlobCommandHeader header;
+    header.meta_header.block_header.size =
+        gfxrecon::format::GetMetaDataBlockBaseSize(header) + (has_data ? data.size() : 0);
+    header.meta_header.block_header.type = gfxrecon::format::BlockType::kMetaDataBlock;
+    header.meta_header.meta_data_id =
+        gfxrecon::format::MakeMetaDataId(gfxrecon::format::ApiFamilyId::ApiFamily_Vulkan, type);
+    header.thread_id     = 1;
+    header.blob_id       = blob_id;
+    header.memory_id     = memory_id;
+    header.memory_offset = 0;
+    header.memory_size   = data.size();
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (has_data)
+    {
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+}
+
+TEST_CASE("Looped frames can reference fill memory blobs that the loop releases", "[loop]")
+{
+    const char* kFilename = "gfxrecon_decode_test_loop.gfxr";
+
+    // The looped frame references a blob from before the loop, and then adds a blob that releases it.
+    const std::vector<uint8_t> kPreLoopData(gfxrecon::format::kMinFillMemoryBlobSize, 0xa1);
+    const std::vector<uint8_t> kLoopData(gfxrecon::format::kFillMemoryBlobCacheSize, 0xb2);
+
+    {
+        std::ofstream file(kFilename, std::ios::binary);
+
+        gfxrecon::format::FileHeader file_header{ GFXRECON_FOURCC, 0, 1, 0 };
+        file.write(reinterpret_cast<const char*>(&file_header), sizeof(file_header));
+
+        WriteFillMemoryBlob(file, gfxrecon::format::MetaDataType::kFillMemoryBlobCommand, 1, 10, kPreLoopData);
+        WriteFrameEndMarker(file, 1);
+        WriteFillMemoryBlob(file, gfxrecon::format::MetaDataType::kFillMemoryFromBlobCommand, 1, 20, kPreLoopData);
+        WriteFillMemoryBlob(file, gfxrecon::format::MetaDataType::kFillMemoryBlobCommand, 2, 30, kLoopData);
+        WriteFrameEndMarker(file, 2);
+        WriteFrameEndMarker(file, 3);
+    }
+
+    const uint32_t kLoopCount = 3;
+
+    FillMemoryConsumer              consumer;
+    gfxrecon::decode::VulkanDecoder decoder;
+    decoder.AddConsumer(&consumer);
+
+    {
+        gfxrecon::decode::FileProcessor file_processor;
+        REQUIRE(file_processor.Initialize(kFilename));
+        file_processor.AddDecoder(&decoder);
+
+        REQUIRE(file_processor.ProcessNextFrame());
+        REQUIRE(file_processor.LoopFrames(1, kLoopCount) == 1);
+        while (file_processor.ProcessNextFrame())
+        {
+        }
+
+        REQUIRE(file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+    }
+
+    std::remove(kFilename);
+
+    REQUIRE(consumer.fills.size() == (1 + (2 * kLoopCount)));
+    REQUIRE(consumer.fills[0].memory_id == 10);
+
+    for (uint32_t i = 0; i < kLoopCount; ++i)
+    {
+        const FillMemoryConsumer::Fill& pre_loop_fill = consumer.fills[1 + (2 * i)];
+        REQUIRE(pre_loop_fill.memory_id == 20);
+        REQUIRE(pre_loop_fill.size == kPreLoopData.size());
+        REQUIRE(pre_loop_fill.value == kPreLoopData[0]);
+
+        const FillMemoryConsumer::Fill& loop_fill = consumer.fills[2 + (2 * i)];
+        REQUIRE(loop_fill.memory_id == 30);
+        REQUIRE(loop_fill.size == kLoopData.size());
+        REQUIRE(loop_fill.value == kLoopData[0]);
+    }
+}
+
+template <typename T>
+static void AppendValue(std::vector<uint8_t>* buffer, T value)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer->insert(buffer->end(), bytes, bytes + sizeof(value));
+}
+
+// Appends the pointer attributes and address that precede pointer data in the capture file format, and the length of
+// an array.
+static void AppendPointer(std::vector<uint8_t>* buffer, uint32_t attributes, uint64_t address, uint64_t length = 0)
+{
+    AppendValue<uint32_t>(buffer, attributes | gfxrecon::format::PointerAttributes::kHasAddress);
+    AppendValue<uint64_t>(buffer, address);
+
+    if ((attributes & gfxrecon::format::PointerAttributes::kIsArray) == gfxrecon::format::PointerAttributes::kIsArray)
+    {
+        AppendValue<uint64_t>(buffer, length);
+    }
+}
+
+// Encodes a VkBufferCreateInfo pointer with two queue family indices in the capture file format, optionally with a
+// pNext chain of VkExternalMemoryBufferCreateInfo and VkBufferOpaqueCaptureAddressCreateInfo.
+static std::vector<uint8_t> EncodeBufferCreateInfo(bool has_pnext)
+{
+    using gfxrecon::format::PointerAttributes;
+
+    const uint32_t kStruct = PointerAttributes::kIsSingle | PointerAttributes::kIsStruct | PointerAttributes::kHasData;
+
+    std::vector<uint8_t> buffer;
+    AppendPointer(&buffer, kStruct, 0x1000);
+    AppendValue<uint32_t>(&buffer, VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO);
+
+    if (has_pnext)
+    {
+        AppendPointer(&buffer, kStruct, 0x1100);
+        AppendValue<uint32_t>(&buffer, VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO);
+        AppendPointer(&buffer, kStruct, 0x1200);
+        AppendValue<uint32_t>(&buffer, VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO);
+        AppendValue<uint32_t>(&buffer, PointerAttributes::kIsNull); // pNext
+        AppendValue<uint64_t>(&buffer, 0xfedcba9876543210ull);
+        AppendValue<uint32_t>(&buffer, VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT);
+    }
+    else
+    {
+        AppendValue<uint32_t>(&buffer, PointerAttributes::kIsNull); // pNext
+    }
+
+    AppendValue<uint32_t>(&buffer, VK_BUFFER_CREATE_SPARSE_BINDING_BIT);
+    AppendValue<uint64_t>(&buffer, 65536);
+    AppendValue<uint32_t>(&buffer, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    AppendValue<uint32_t>(&buffer, VK_SHARING_MODE_CONCURRENT);
+    AppendValue<uint32_t>(&buffer, 2);
+    AppendPointer(&buffer, PointerAttributes::kIsArray | PointerAttributes::kHasData, 0x2000, 2);
+    AppendValue<uint32_t>(&buffer, 0);
+    AppendValue<uint32_t>(&buffer, 3);
+    return buffer;
+}
+
+template <typename Decoder>
+static void DecodePointer(Decoder* decoder, const std::vector<uint8_t>& buffer)
+{
+    REQUIRE(decoder->Decode(buffer.data(), buffer.size()) == buffer.size());
+}
+
+static std::string GetText(const gfxrecon::util::MemoryOutputStream& stream)
+{
+    return std::string(reinterpret_cast<const char*>(stream.GetData()), stream.GetDataSize());
+}
+
+// Writes an API call block with a JSON consumer, which streams it, and builds the same block as a tree, the way the
+// consumers did before they wrote to the stream. The text must match in both formats, with every option that changes
+// how values are written, and with and without serializer threads.
+template <typename Consumer, typename InitializeConsumer, typename WriteStreamBlock, typename WriteTreeBlock>
+static void RequireStreamMatchesTree(InitializeConsumer initialize_consumer,
+                                     WriteStreamBlock   write_stream_block,
+                                     WriteTreeBlock     write_tree_block)
+{
+    for (uint32_t serializer_threads : { 0u, 2u })
+    {
+        for (auto format : { gfxrecon::util::JsonFormat::JSON, gfxrecon::util::JsonFormat::JSONL })
+        {
+            for (uint32_t option_bits = 0; option_bits < 4; ++option_bits)
+            {
+                gfxrecon::util::JsonOptions options;
+                options.format       = format;
+                options.expand_flags = (option_bits & 1) != 0;
+                options.hex_handles  = (option_bits & 2) != 0;
+
+                gfxrecon::util::MemoryOutputStream stream_output;
+                gfxrecon::decode::JsonWriter       stream_writer(options, "test", "test.gfxr");
+                Consumer                           consumer;
+                initialize_consumer(&consumer, &stream_writer);
+                stream_writer.EnableSerializerThreads(serializer_threads);
+                stream_writer.StartStream(&stream_output);
+                write_stream_block(&consumer);
+                stream_writer.EndStream();
+
+                gfxrecon::util::MemoryOutputStream tree_output;
+                gfxrecon::decode::JsonWriter       tree_writer(options, "test", "test.gfxr");
+                Consumer                           tree_consumer;
+                initialize_consumer(&tree_consumer, &tree_writer);
+                tree_writer.EnableSerializerThreads(serializer_threads);
+                tree_writer.StartStream(&tree_output);
+                write_tree_block(&tree_writer, options);
+                tree_writer.WriteBlockEnd();
+                tree_writer.EndStream();
+
+                REQUIRE(GetText(stream_output) == GetText(tree_output));
+            }
+        }
+    }
+}
+
+// Struct conversions also match on their own.
+template <typename Decoder>
+static void RequireStructStreamMatchesTree(const Decoder* decoder)
+{
+    for (uint32_t option_bits = 0; option_bits < 4; ++option_bits)
+    {
+        gfxrecon::util::JsonOptions options;
+        options.expand_flags = (option_bits & 1) != 0;
+        options.hex_handles  = (option_bits & 2) != 0;
+
+        gfxrecon::util::JsonStreamWriter struct_stream;
+        gfxrecon::decode::FieldToJson(struct_stream, decoder, options);
+        nlohmann::ordered_json struct_tree;
+        gfxrecon::decode::FieldToJson(struct_tree, decoder, options);
+        REQUIRE(struct_stream.GetText() == struct_tree.dump());
+    }
+}
+
+TEST_CASE("Streamed JSON blocks match the serialized JSON tree", "[json]")
+{
+    using gfxrecon::decode::FieldToJson;
+    using gfxrecon::decode::HandleToJson;
+    using gfxrecon::util::FieldToJson;
+    using gfxrecon::util::HandleToJson;
+    using gfxrecon::format::PointerAttributes;
+
+    auto initialize_vulkan_consumer = [](gfxrecon::decode::VulkanExportJsonConsumer* consumer,
+                                         gfxrecon::decode::JsonWriter*               writer) {
+        consumer->Initialize(writer, "1.3");
+    };
+
+    gfxrecon::decode::ApiCallInfo call_info;
+    call_info.index     = 42;
+    call_info.thread_id = 7;
+
+    gfxrecon::decode::DecodeAllocator::Begin();
+
+    SECTION("vkCreateBuffer")
+    {
+        for (bool has_pnext : { false, true })
+        {
+            gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBufferCreateInfo> create_info;
+            DecodePointer(&create_info, EncodeBufferCreateInfo(has_pnext));
+            REQUIRE((create_info.GetPointer()->pNext != nullptr) == has_pnext);
+
+            std::vector<uint8_t> allocator_data;
+            AppendValue<uint32_t>(&allocator_data, PointerAttributes::kIsNull);
+            gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks> allocator;
+            DecodePointer(&allocator, allocator_data);
+
+            std::vector<uint8_t> buffer_data;
+            AppendPointer(&buffer_data, PointerAttributes::kIsSingle | PointerAttributes::kHasData, 0x3000);
+            AppendValue<gfxrecon::format::HandleId>(&buffer_data, kBufferIds[0]);
+            gfxrecon::decode::HandlePointerDecoder<VkBuffer> buffer;
+            DecodePointer(&buffer, buffer_data);
+
+            RequireStreamMatchesTree<gfxrecon::decode::VulkanExportJsonConsumer>(
+                initialize_vulkan_consumer,
+                [&](gfxrecon::decode::VulkanExportJsonConsumer* consumer) {
+                    consumer->Process_vkCreateBuffer(
+                        call_info, VK_SUCCESS, kDeviceId, &create_info, &allocator, &buffer);
+                },
+                [&](gfxrecon::decode::JsonWriter* writer, const gfxrecon::util::JsonOptions& options) {
+                    nlohmann::ordered_json& jdata = writer->WriteApiCallStart(call_info, "vkCreateBuffer");
+                    FieldToJson(jdata[gfxrecon::format::kNameReturn], VK_SUCCESS, options);
+                    auto& args = jdata[gfxrecon::format::kNameArgs];
+                    HandleToJson(args["device"], kDeviceId, options);
+                    FieldToJson(args["pCreateInfo"], &create_info, options);
+                    FieldToJson(args["pAllocator"], &allocator, options);
+                    HandleToJson(args["pBuffer"], &buffer, options);
+                });
+
+            RequireStructStreamMatchesTree(&create_info);
+        }
+    }
+
+    SECTION("vkCmdBindVertexBuffers")
+    {
+        const gfxrecon::format::HandleId kCommandBufferId = 8;
+
+        std::vector<uint8_t> buffers_data;
+        AppendPointer(&buffers_data, PointerAttributes::kIsArray | PointerAttributes::kHasData, 0x4000, 3);
+        AppendValue<gfxrecon::format::HandleId>(&buffers_data, kBufferIds[1]);
+        AppendValue<gfxrecon::format::HandleId>(&buffers_data, 0);
+        AppendValue<gfxrecon::format::HandleId>(&buffers_data, kBufferIds[2]);
+        gfxrecon::decode::HandlePointerDecoder<VkBuffer> buffers;
+        DecodePointer(&buffers, buffers_data);
+
+        std::vector<uint8_t> offsets_data;
+        AppendPointer(&offsets_data, PointerAttributes::kIsArray | PointerAttributes::kHasData, 0x5000, 3);
+        AppendValue<uint64_t>(&offsets_data, 0);
+        AppendValue<uint64_t>(&offsets_data, 256);
+        AppendValue<uint64_t>(&offsets_data, 0x100000000ull);
+        gfxrecon::decode::PointerDecoder<VkDeviceSize> offsets;
+        DecodePointer(&offsets, offsets_data);
+
+        RequireStreamMatchesTree<gfxrecon::decode::VulkanExportJsonConsumer>(
+            initialize_vulkan_consumer,
+            [&](gfxrecon::decode::VulkanExportJsonConsumer* consumer) {
+                consumer->Process_vkCmdBindVertexBuffers(call_info, kCommandBufferId, 1, 3, &buffers, &offsets);
+            },
+            [&](gfxrecon::decode::JsonWriter* writer, const gfxrecon::util::JsonOptions& options) {
+                nlohmann::ordered_json& jdata = writer->WriteApiCallStart(call_info, "vkCmdBindVertexBuffers");
+                FieldToJson(jdata["cmd_index"], uint32_t{ 1 }, options);
+                auto& args = jdata[gfxrecon::format::kNameArgs];
+                HandleToJson(args["commandBuffer"], kCommandBufferId, options);
+                FieldToJson(args["firstBinding"], uint32_t{ 1 }, options);
+                FieldToJson(args["bindingCount"], uint32_t{ 3 }, options);
+                HandleToJson(args["pBuffers"], &buffers, options);
+                FieldToJson(args["pOffsets"], &offsets, options);
+            });
+    }
+
+    SECTION("vkCmdClearColorImage")
+    {
+        // VkClearColorValue is converted by a hand-written overload, and the ranges are an array of structs.
+        const gfxrecon::format::HandleId kCommandBufferId = 9;
+        const gfxrecon::format::HandleId kImageId         = 10;
+
+        std::vector<uint8_t> color_data;
+        AppendPointer(&color_data,
+                      PointerAttributes::kIsSingle | PointerAttributes::kIsStruct | PointerAttributes::kHasData,
+                      0x6000);
+        AppendPointer(&color_data, PointerAttributes::kIsArray | PointerAttributes::kHasData, 0x6000, 4);
+        AppendValue<float>(&color_data, 0.25f);
+        AppendValue<float>(&color_data, 0.5f);
+        AppendValue<float>(&color_data, 1.0f);
+        AppendValue<uint32_t>(&color_data, 0xffffffff);
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkClearColorValue> color;
+        DecodePointer(&color, color_data);
+
+        std::vector<uint8_t> ranges_data;
+        AppendPointer(&ranges_data,
+                      PointerAttributes::kIsArray | PointerAttributes::kIsStruct | PointerAttributes::kHasData,
+                      0x7000,
+                      2);
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            AppendValue<uint32_t>(&ranges_data, VK_IMAGE_ASPECT_COLOR_BIT);
+            AppendValue<uint32_t>(&ranges_data, i);
+            AppendValue<uint32_t>(&ranges_data, 1);
+            AppendValue<uint32_t>(&ranges_data, 0);
+            AppendValue<uint32_t>(&ranges_data, VK_REMAINING_ARRAY_LAYERS);
+        }
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkImageSubresourceRange> ranges;
+        DecodePointer(&ranges, ranges_data);
+
+        RequireStreamMatchesTree<gfxrecon::decode::VulkanExportJsonConsumer>(
+            initialize_vulkan_consumer,
+            [&](gfxrecon::decode::VulkanExportJsonConsumer* consumer) {
+                consumer->Process_vkCmdClearColorImage(
+                    call_info, kCommandBufferId, kImageId, VK_IMAGE_LAYOUT_GENERAL, &color, 2, &ranges);
+            },
+            [&](gfxrecon::decode::JsonWriter* writer, const gfxrecon::util::JsonOptions& options) {
+                nlohmann::ordered_json& jdata = writer->WriteApiCallStart(call_info, "vkCmdClearColorImage");
+                FieldToJson(jdata["cmd_index"], uint32_t{ 1 }, options);
+                auto& args = jdata[gfxrecon::format::kNameArgs];
+                HandleToJson(args["commandBuffer"], kCommandBufferId, options);
+                HandleToJson(args["image"], kImageId, options);
+                FieldToJson(args["imageLayout"], VK_IMAGE_LAYOUT_GENERAL, options);
+                FieldToJson(args["pColor"], &color, options);
+                FieldToJson(args["rangeCount"], uint32_t{ 2 }, options);
+                FieldToJson(args["pRanges"], &ranges, options);
+            });
+
+        RequireStructStreamMatchesTree(&color);
+    }
+
+#if defined(D3D12_SUPPORT)
+    SECTION("ID3D12GraphicsCommandList::RSSetViewports")
+    {
+        const gfxrecon::format::HandleId kCommandListId = 11;
+
+        std::vector<uint8_t> viewports_data;
+        AppendPointer(&viewports_data,
+                      PointerAttributes::kIsArray | PointerAttributes::kIsStruct | PointerAttributes::kHasData,
+                      0x8000,
+                      2);
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            AppendValue<float>(&viewports_data, 64.0f * i);
+            AppendValue<float>(&viewports_data, 0.0f);
+            AppendValue<float>(&viewports_data, 64.0f);
+            AppendValue<float>(&viewports_data, 48.5f);
+            AppendValue<float>(&viewports_data, 0.0f);
+            AppendValue<float>(&viewports_data, 1.0f);
+        }
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_D3D12_VIEWPORT> viewports;
+        DecodePointer(&viewports, viewports_data);
+
+        RequireStreamMatchesTree<gfxrecon::decode::Dx12JsonConsumer>(
+            [](gfxrecon::decode::Dx12JsonConsumer* consumer, gfxrecon::decode::JsonWriter* writer) {
+                consumer->Initialize(writer);
+            },
+            [&](gfxrecon::decode::Dx12JsonConsumer* consumer) {
+                consumer->Process_ID3D12GraphicsCommandList_RSSetViewports(call_info, kCommandListId, 2, &viewports);
+            },
+            [&](gfxrecon::decode::JsonWriter* writer, const gfxrecon::util::JsonOptions& options) {
+                nlohmann::ordered_json& method =
+                    writer->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", kCommandListId, "RSSetViewports");
+                auto& args = method[gfxrecon::format::kNameArgs];
+                FieldToJson(args["NumViewports"], UINT{ 2 }, options);
+                FieldToJson(args["pViewports"], &viewports, options);
+            });
+    }
+#endif
+
+    gfxrecon::decode::DecodeAllocator::End();
+}
+
+TEST_CASE("HandleIdMap matches the behavior of std::unordered_map", "[table]")
+{
+    gfxrecon::decode::HandleIdMap<gfxrecon::decode::BufferInfo>                  dense_map;
+    std::unordered_map<gfxrecon::format::HandleId, gfxrecon::decode::BufferInfo> hashed_map;
+
+    // Interleaved IDs spanning several pages, plus an ID that is too large to be paged.
+    std::vector<gfxrecon::format::HandleId> ids;
+    for (gfxrecon::format::HandleId id = 1; id < 5000; id += 3)
+    {
+        ids.push_back(id);
+    }
+    ids.push_back(0x123456789abcull);
+
+    for (auto id : ids)
+    {
+        gfxrecon::decode::BufferInfo info;
+        info.capture_id = id;
+        info.size       = id * 2;
+
+        auto dense_result  = dense_map.emplace(id, gfxrecon::decode::BufferInfo(info));
+        auto hashed_result = hashed_map.emplace(id, std::move(info));
+        REQUIRE(dense_result.second == hashed_result.second);
+        REQUIRE(dense_result.first->first == id);
+    }
+
+    // Duplicate insertions keep the existing entry.
+    gfxrecon::decode::BufferInfo duplicate;
+    duplicate.capture_id = ids[0];
+    REQUIRE(!dense_map.emplace(ids[0], std::move(duplicate)).second);
+    REQUIRE(dense_map.find(ids[0])->second.size == ids[0] * 2);
+
+    const gfxrecon::decode::BufferInfo* stable = &dense_map.find(ids[1])->second;
+
+    // Remove every other entry, then insert new IDs into the released entries.
+    for (size_t i = 0; i < ids.size(); i += 2)
+    {
+        REQUIRE(dense_map.erase(ids[i]) == hashed_map.erase(ids[i]));
+    }
+    REQUIRE(dense_map.erase(ids[0]) == 0);
+
+    for (gfxrecon::format::HandleId id = 10000; id < 10500; ++id)
+    {
+        gfxrecon::decode::BufferInfo info;
+        info.capture_id = id;
+        info.size       = id * 2;
+
+        dense_map.emplace(id, gfxrecon::decode::BufferInfo(info));
+        hashed_map.emplace(id, std::move(info));
+    }
+
+    REQUIRE(&dense_map.find(ids[1])->second == stable);
+    REQUIRE(dense_map.size() == hashed_map.size());
+
+    for (gfxrecon::format::HandleId id = 0; id < 11000; ++id)
+    {
+        auto dense_entry  = dense_map.find(id);
+        auto hashed_entry = hashed_map.find(id);
+        REQUIRE((dense_entry == dense_map.end()) == (hashed_entry == hashed_map.end()));
+        if (dense_entry != dense_map.end())
+        {
+            REQUIRE(dense_entry->second.size == hashed_entry->second.size);
+        }
+    }
+
+    size_t visited = 0;
+    for (const auto& entry : dense_map)
+    {
+        REQUIRE(hashed_map.count(entry.first) == 1);
+        REQUIRE(entry.second.capture_id == entry.first);
+        ++visited;
+    }
+    REQUIRE(visited == hashed_map.size());
+}
+
+TEST_CASE("Object info table lookup benchmark", "[.][benchmark]")
+{
+    // Models the handle lookups of a draw heavy frame: buffer IDs are interleaved with the IDs of other object types,
+    // and each command looks up a few of them in no particular order.
+    const size_t kObjectCount = 100000;
+    const size_t kLookupCount = 200000;
+
+    gfxrecon::decode::HandleIdMap<gfxrecon::decode::BufferInfo>                  dense_map;
+    std::unordered_map<gfxrecon::format::HandleId, gfxrecon::decode::BufferInfo> hashed_map;
+    std::vector<gfxrecon::format::HandleId>                                      ids;
+
+    std::mt19937_64            random(42);
+    gfxrecon::format::HandleId next_id = 1;
+    for (size_t i = 0; i < kObjectCount; ++i)
+    {
+        next_id += 1 + (random() % 4);
+
+        gfxrecon::decode::BufferInfo info;
+        info.capture_id = next_id;
+        info.handle     = gfxrecon::format::FromHandleId<VkBuffer>(next_id);
+
+        dense_map.emplace(next_id, gfxrecon::decode::BufferInfo(info));
+        hashed_map.emplace(next_id, std::move(info));
+        ids.push_back(next_id);
+    }
+
+    std::vector<gfxrecon::format::HandleId> lookups(kLookupCount);
+    for (auto& id : lookups)
+    {
+        id = ids[random() % ids.size()];
+    }
+
+    BENCHMARK("std::unordered_map")
+    {
+        uint64_t result = 0;
+        for (auto id : lookups)
+        {
+            result += gfxrecon::format::ToHandleId(hashed_map.find(id)->second.handle);
+        }
+        return result;
+    };
+
+    BENCHMARK("HandleIdMap")
+    {
+        uint64_t result = 0;
+        for (auto id : lookups)
+        {
+            result += gfxrecon::format::ToHandleId(dense_map.find(id)->second.handle);
+        }
+        return result;
+    };
+}
@@ -0,0 +1,269 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/threaded_call_dispatcher.h"
+
+#include "decode/decode_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+ThreadedCallDispatcher::ThreadedCallDispatcher(Filter filter) :
+    filter_(filter), max_workers_(std::max(1u, std::thread::hardware_concurrency()))
+{}
+
+ThreadedCallDispatcher::~ThreadedCallDispatcher()
+{
+    // Calls that are still queued when the dispatcher is destroyed, which only happens when replay is aborted, are
+    // discarded by the worker destructors.
+    workers_.clear();
+}
+
+bool ThreadedCallDispatcher::Dispatch(const std::vector<ApiDecoder*>& decoders,
+                                      format::ApiCallId               call_id,
+                                      const ApiCallInfo&              call_info,
+                                      const uint8_t*                  parameter_buffer,
+                                      size_t                          buffer_size)
+{
+    format::HandleId queue_key = format::kNullHandleId;
+
+    if (!filter_ || !filter_(call_id, parameter_buffer, buffer_size, &queue_key))
+    {
+        return false;
+    }
+
+    for (auto decoder : decoders)
+    {
+        if (decoder->SupportsApiCall(call_id) && !decoder->SupportsThreadedDecoding(call_id))
+        {
+            return false;
+        }
+    }
+
+    Worker* worker = GetWorker(call_info.thread_id);
+
+    if (queue_key != format::kNullHandleId)
+    {
+        Worker*& owner = queue_owners_[queue_key];
+
+        if ((owner != nullptr) && (owner != worker))
+        {
+            // The queue was last used from a different thread, whose calls must be decoded before this one.
+            std::exception_ptr error = owner->WaitIdle();
+            if (error)
+            {
+                // Stop the other workers before reporting the error, so that no calls are decoded while the decoders
+                // are being destroyed.
+                WaitIdle();
+                std::rethrow_exception(error);
+            }
+        }
+
+        owner = worker;
+    }
+
+    std::unique_ptr<Call> call = worker->AcquireCall();
+    call->call_id              = call_id;
+    call->call_info            = call_info;
+    call->parameters.assign(parameter_buffer, parameter_buffer + buffer_size);
+    call->decoders.clear();
+
+    for (auto decoder : decoders)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            call->decoders.push_back(decoder);
+        }
+    }
+
+    worker->Enqueue(std::move(call));
+
+    return true;
+}
+
+void ThreadedCallDispatcher::WaitIdle()
+{
+    std::exception_ptr first_error;
+
+    for (auto& worker : workers_)
+    {
+        std::exception_ptr error = worker->WaitIdle();
+        if (error && !first_error)
+        {
+            first_error = error;
+        }
+    }
+
+    if (first_error)
+    {
+        std::rethrow_exception(first_error);
+    }
+}
+
+ThreadedCallDispatcher::Worker* ThreadedCallDispatcher::GetWorker(format::ThreadId thread_id)
+{
+    auto entry = thread_workers_.find(thread_id);
+    if (entry != thread_workers_.end())
+    {
+        return entry->second;
+    }
+
+    // Threads are assigned to workers in the order that they first appear in the capture. When the capture has more
+    // threads than the system has hardware threads, workers are shared by several captured threads.
+    Worker* worker = nullptr;
+    if (workers_.size() < max_workers_)
+    {
+        workers_.push_back(std::make_unique<Worker>());
+        worker = workers_.back().get();
+    }
+    else
+    {
+        worker = workers_[thread_workers_.size() % max_workers_].get();
+    }
+
+    thread_workers_.emplace(thread_id, worker);
+
+    return worker;
+}
+
+ThreadedCallDispatcher::Worker::Worker() : busy_(false), exit_(false), thread_(&Worker::Run, this) {}
+
+ThreadedCallDispatcher::Worker::~Worker()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exit_ = true;
+    }
+
+    work_available_.notify_one();
+    thread_.join();
+}
+
+std::unique_ptr<ThreadedCallDispatcher::Call> ThreadedCallDispatcher::Worker::AcquireCall()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_calls_.empty())
+        {
+            std::unique_ptr<Call> call = std::move(free_calls_.back());
+            free_calls_.pop_back();
+            return call;
+        }
+    }
+
+    return std::make_unique<Call>();
+}
+
+void ThreadedCallDispatcher::Worker::Enqueue(std::unique_ptr<Call> call)
+{
+    bool notify = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        notify = queue_.empty();
+        queue_.push_back(std::move(call));
+    }
+
+    // The worker only waits for work when its queue is empty.
+    if (notify)
+    {
+        work_available_.notify_one();
+    }
+}
+
+std::exception_ptr ThreadedCallDispatcher::Worker::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return (queue_.empty() && !busy_); });
+
+    return std::exchange(error_, nullptr);
+}
+
+void ThreadedCallDispatcher::Worker::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        work_available_.wait(lock, [this]() { return (exit_ || !queue_.empty()); });
+
+        if (exit_)
+        {
+            break;
+        }
+
+        std::unique_ptr<Call> call = std::move(queue_.front());
+        queue_.pop_front();
+
+        // After a decoder has failed, the remaining calls are discarded until the error is retrieved by WaitIdle().
+        if (!error_)
+        {
+            busy_ = true;
+            lock.unlock();
+
+            std::exception_ptr error;
+
+            try
+            {
+                for (auto decoder : call->decoders)
+                {
+                    DecodeAllocator::Begin();
+                    decoder->DecodeFunctionCall(
+                        call->call_id, call->call_info, call->parameters.data(), call->parameters.size());
+                    DecodeAllocator::End();
+                }
+            }
+            catch (...)
+            {
+                DecodeAllocator::End();
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            busy_  = false;
+            error_ = error;
+        }
+
+        free_calls_.push_back(std::move(call));
+
+        if (error_)
+        {
+            while (!queue_.empty())
+            {
+                free_calls_.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+        }
+
+        if (queue_.empty())
+        {
+            idle_.notify_all();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
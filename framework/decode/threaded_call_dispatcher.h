@@ -0,0 +1,137 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Replay of function calls on worker threads that correspond to the threads of the captured application.
+
+#ifndef GFXRECON_DECODE_THREADED_CALL_DISPATCHER_H
+#define GFXRECON_DECODE_THREADED_CALL_DISPATCHER_H
+
+#include "decode/api_decoder.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+/// @brief Decodes selected function calls on worker threads, with one worker for each thread ID that was recorded in
+/// the capture file, up to the number of hardware threads.
+///
+/// A filter selects the calls that may be decoded on a worker thread and provides a queue key for each call. Calls
+/// with the same thread ID are decoded in capture order by the same worker. Calls with the same nonzero queue key are
+/// also decoded in capture order: when a call is dispatched to a different worker than the previous call with the same
+/// key, the dispatcher waits for the previous worker to become idle first. All other calls must be decoded by the
+/// calling thread after WaitIdle() returns, so that every call that is not selected by the filter acts as a barrier
+/// for the calls that were dispatched before it. A call is also left to the calling thread when any decoder that
+/// supports it returns false from ApiDecoder::SupportsThreadedDecoding(), so that consumers that keep state shared by
+/// all calls only receive calls from one thread.
+class ThreadedCallDispatcher
+{
+  public:
+    /// @brief Returns true if the function call may be decoded on a worker thread, and writes the key of the queue
+    /// that the call must be ordered with to queue_key. A key of 0 orders the call only with the calls from the same
+    /// captured thread.
+    typedef std::function<bool(
+        format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size, format::HandleId* queue_key)>
+        Filter;
+
+    ThreadedCallDispatcher(Filter filter);
+
+    ~ThreadedCallDispatcher();
+
+    /// @brief Queue the function call for decoding on the worker thread that corresponds to its captured thread ID. The
+    /// parameter buffer is copied, so it may be reused when Dispatch returns.
+    /// @return False if the call was not selected, in which case the caller must call WaitIdle() and then decode the
+    /// call itself.
+    bool Dispatch(const std::vector<ApiDecoder*>& decoders,
+                  format::ApiCallId               call_id,
+                  const ApiCallInfo&              call_info,
+                  const uint8_t*                  parameter_buffer,
+                  size_t                          buffer_size);
+
+    /// @brief Wait for the worker threads to decode all queued calls. Rethrows the first exception that was thrown
+    /// while a worker thread was decoding, after which the calls that the worker had queued are discarded.
+    void WaitIdle();
+
+  private:
+    struct Call
+    {
+        format::ApiCallId        call_id{ format::ApiCallId::ApiCall_Unknown };
+        ApiCallInfo              call_info{};
+        std::vector<uint8_t>     parameters;
+        std::vector<ApiDecoder*> decoders;
+    };
+
+    class Worker
+    {
+      public:
+        Worker();
+
+        ~Worker();
+
+        /// @brief Retrieve an unused call structure to fill in and pass to Enqueue().
+        std::unique_ptr<Call> AcquireCall();
+
+        void Enqueue(std::unique_ptr<Call> call);
+
+        /// @brief Wait for the queue to drain. Returns the exception thrown by a decoder, if any.
+        std::exception_ptr WaitIdle();
+
+      private:
+        void Run();
+
+      private:
+        std::mutex                         mutex_;
+        std::condition_variable            work_available_;
+        std::condition_variable            idle_;
+        std::deque<std::unique_ptr<Call>>  queue_;
+        std::vector<std::unique_ptr<Call>> free_calls_;
+        std::exception_ptr                 error_;
+        bool                               busy_;
+        bool                               exit_;
+        std::thread                        thread_; // Declared last, so that it starts after the other members exist.
+    };
+
+    Worker* GetWorker(format::ThreadId thread_id);
+
+  private:
+    Filter                                        filter_;
+    std::vector<std::unique_ptr<Worker>>          workers_;
+    std::unordered_map<format::ThreadId, Worker*> thread_workers_;
+    std::unordered_map<format::HandleId, Worker*> queue_owners_;
+    size_t                                        max_workers_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_THREADED_CALL_DISPATCHER_H
@@ -54,8 +54,17 @@ class VulkanConsumerBase : public MetadataConsumerBase, public MarkerConsumerBas
 
     virtual void WaitDevicesIdle() {}
 
+    virtual void ProcessFrameLoopBegin(uint64_t frame_number) {}
+
+    virtual void ProcessFrameLoopRestart(uint64_t frame_number) {}
+
     virtual bool IsComplete(uint64_t block_index) { return false; }
 
+    // Returns true if the Process_ function for the command recording call may be invoked from a worker thread, while
+    // the calls that record to command buffers from other command pools are processed concurrently. Consumers that
+    // keep state shared by all calls must return false, which keeps the calls on the thread that reads the file.
+    virtual bool SupportsThreadedDecoding(format::ApiCallId call_id) { return false; }
+
     virtual void Process_ExeFileInfo(util::filepath::FileInfo& info_record) {}
 
     virtual void Process_vkUpdateDescriptorSetWithTemplate(const ApiCallInfo&               call_info,
@@ -25,7 +25,9 @@
 
 #include "decode/descriptor_update_template_decoder.h"
 #include "decode/pointer_decoder.h"
+#include "decode/struct_pointer_decoder.h"
 #include "decode/value_decoder.h"
+#include "generated/generated_vulkan_struct_decoders.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -62,6 +64,242 @@ void VulkanDecoderBase::DispatchFrameEndMarker(uint64_t frame_number)
     }
 }
 
+void VulkanDecoderBase::DispatchFrameLoopBegin(uint64_t frame_number)
+{
+    for (auto consumer : consumers_)
+    {
+        consumer->ProcessFrameLoopBegin(frame_number);
+    }
+}
+
+void VulkanDecoderBase::DispatchFrameLoopRestart(uint64_t frame_number)
+{
+    for (auto consumer : consumers_)
+    {
+        consumer->ProcessFrameLoopRestart(frame_number);
+    }
+}
+
+// Returns true if the pNext chain has a VkTimelineSemaphoreSubmitInfo with signal values. Binary semaphores ignore the
+// values, which are expected to be zero for them.
+static bool HasTimelineSemaphoreSignal(const void* next)
+{
+    for (auto base = reinterpret_cast<const VkBaseInStructure*>(next); base != nullptr; base = base->pNext)
+    {
+        if (base->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+        {
+            auto timeline_info = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(base);
+
+            if (timeline_info->pSignalSemaphoreValues != nullptr)
+            {
+                for (uint32_t i = 0; i < timeline_info->signalSemaphoreValueCount; ++i)
+                {
+                    if (timeline_info->pSignalSemaphoreValues[i] != 0)
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+bool VulkanDecoderBase::SupportsFrameLoop(format::ApiCallId call_id,
+                                          const uint8_t*    parameter_buffer,
+                                          size_t            buffer_size)
+{
+    size_t           bytes_read = 0;
+    format::HandleId queue      = format::kNullHandleId;
+    uint32_t         count      = 0;
+
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCreateInstance:
+        case format::ApiCallId::ApiCall_vkDestroyInstance:
+        case format::ApiCallId::ApiCall_vkCreateDevice:
+        case format::ApiCallId::ApiCall_vkDestroyDevice:
+        case format::ApiCallId::ApiCall_vkAllocateMemory:
+        case format::ApiCallId::ApiCall_vkFreeMemory:
+        case format::ApiCallId::ApiCall_vkCreateFence:
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+        case format::ApiCallId::ApiCall_vkCreateSemaphore:
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+        case format::ApiCallId::ApiCall_vkCreateEvent:
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+        case format::ApiCallId::ApiCall_vkCreateQueryPool:
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+        case format::ApiCallId::ApiCall_vkCreateBuffer:
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+        case format::ApiCallId::ApiCall_vkCreateBufferView:
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+        case format::ApiCallId::ApiCall_vkCreateImage:
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+        case format::ApiCallId::ApiCall_vkCreateImageView:
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkCreatePipelineCache:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
+        case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+        case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+        case format::ApiCallId::ApiCall_vkDestroyPipeline:
+        case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
+        case format::ApiCallId::ApiCall_vkAllocateDescriptorSets:
+        case format::ApiCallId::ApiCall_vkFreeDescriptorSets:
+        case format::ApiCallId::ApiCall_vkCreateFramebuffer:
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass:
+        case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+        case format::ApiCallId::ApiCall_vkCreateCommandPool:
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+        case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
+        case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroySurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateSwapchainKHR:
+        case format::ApiCallId::ApiCall_vkDestroySwapchainKHR:
+        case format::ApiCallId::ApiCall_vkCreateDisplayModeKHR:
+        case format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
+        case format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateMirSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
+        case format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
+        case format::ApiCallId::ApiCall_vkCreateViSurfaceNN:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNVX:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNVX:
+        case format::ApiCallId::ApiCall_vkCreateObjectTableNVX:
+        case format::ApiCallId::ApiCall_vkDestroyObjectTableNVX:
+        case format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
+        case format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
+        case format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
+        case format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
+        case format::ApiCallId::ApiCall_vkCreateValidationCacheEXT:
+        case format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
+        case format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
+        case format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
+        case format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+        case format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
+        case format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
+        case format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateScreenSurfaceQNX:
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlot:
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot:
+        case format::ApiCallId::ApiCall_vkCreateMicromapEXT:
+        case format::ApiCallId::ApiCall_vkDestroyMicromapEXT:
+        case format::ApiCallId::ApiCall_vkCreateOpticalFlowSessionNV:
+        case format::ApiCallId::ApiCall_vkDestroyOpticalFlowSessionNV:
+        case format::ApiCallId::ApiCall_vkCreateVideoSessionKHR:
+        case format::ApiCallId::ApiCall_vkDestroyVideoSessionKHR:
+        case format::ApiCallId::ApiCall_vkCreateVideoSessionParametersKHR:
+        case format::ApiCallId::ApiCall_vkDestroyVideoSessionParametersKHR:
+        case format::ApiCallId::ApiCall_vkCreateShadersEXT:
+        case format::ApiCallId::ApiCall_vkDestroyShaderEXT:
+        case format::ApiCallId::ApiCall_vkSignalSemaphore:
+        case format::ApiCallId::ApiCall_vkSignalSemaphoreKHR:
+            return false;
+        case format::ApiCallId::ApiCall_vkQueueSubmit:
+        {
+            StructPointerDecoder<Decoded_VkSubmitInfo> submits;
+
+            bytes_read += ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &queue);
+            bytes_read +=
+                ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &count);
+            submits.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+            const VkSubmitInfo* submit_infos = submits.GetPointer();
+            for (size_t i = 0; (submit_infos != nullptr) && (i < submits.GetLength()); ++i)
+            {
+                if (HasTimelineSemaphoreSignal(submit_infos[i].pNext))
+                {
+                    return false;
+                }
+            }
+            break;
+        }
+        case format::ApiCallId::ApiCall_vkQueueSubmit2:
+        case format::ApiCallId::ApiCall_vkQueueSubmit2KHR:
+        {
+            StructPointerDecoder<Decoded_VkSubmitInfo2> submits;
+
+            bytes_read += ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &queue);
+            bytes_read +=
+                ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &count);
+            submits.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+            const VkSubmitInfo2* submit_infos = submits.GetPointer();
+            for (size_t i = 0; (submit_infos != nullptr) && (i < submits.GetLength()); ++i)
+            {
+                const VkSemaphoreSubmitInfo* signal_infos = submit_infos[i].pSignalSemaphoreInfos;
+                for (uint32_t j = 0; (signal_infos != nullptr) && (j < submit_infos[i].signalSemaphoreInfoCount); ++j)
+                {
+                    if (signal_infos[j].value != 0)
+                    {
+                        return false;
+                    }
+                }
+            }
+            break;
+        }
+        case format::ApiCallId::ApiCall_vkQueueBindSparse:
+        {
+            StructPointerDecoder<Decoded_VkBindSparseInfo> bind_infos;
+
+            bytes_read += ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &queue);
+            bytes_read +=
+                ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &count);
+            bind_infos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+            const VkBindSparseInfo* bind_sparse_infos = bind_infos.GetPointer();
+            for (size_t i = 0; (bind_sparse_infos != nullptr) && (i < bind_infos.GetLength()); ++i)
+            {
+                if (HasTimelineSemaphoreSignal(bind_sparse_infos[i].pNext))
+                {
+                    return false;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return true;
+}
+
 void VulkanDecoderBase::DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message)
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
@@ -515,6 +753,24 @@ void VulkanDecoderBase::DispatchSetTlasToBlasDependencyCommand(format::HandleId
     }
 }
 
+bool VulkanDecoderBase::SupportsThreadedDecoding(format::ApiCallId call_id)
+{
+    if (consumers_.empty())
+    {
+        return false;
+    }
+
+    for (auto consumer : consumers_)
+    {
+        if (!consumer->SupportsThreadedDecoding(call_id))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void VulkanDecoderBase::SetCurrentBlockIndex(uint64_t block_index)
 {
     for (auto consumer : consumers_)
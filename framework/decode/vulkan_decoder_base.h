@@ -62,6 +62,8 @@ class VulkanDecoderBase : public ApiDecoder
         return decode::IsComplete<VulkanConsumer*>(consumers_, block_index);
     }
 
+    virtual bool SupportsThreadedDecoding(format::ApiCallId call_id) override;
+
     virtual bool SupportsApiCall(format::ApiCallId call_id) override
     {
         return (format::GetApiCallFamily(call_id) == format::ApiFamilyId::ApiFamily_Vulkan);
@@ -85,6 +87,16 @@ class VulkanDecoderBase : public ApiDecoder
 
     virtual void DispatchFrameEndMarker(uint64_t frame_number) override;
 
+    virtual void DispatchFrameLoopBegin(uint64_t frame_number) override;
+
+    virtual void DispatchFrameLoopRestart(uint64_t frame_number) override;
+
+    // Calls that create or destroy objects, or that signal timeline semaphores, cannot be processed again. Objects
+    // would be created again for the same capture IDs, destroyed objects would be used by later repetitions, and
+    // timeline semaphores would be signaled with values that are not greater than their current values.
+    virtual bool
+    SupportsFrameLoop(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size) override;
+
     virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override;
 
     virtual void DispatchFillMemoryCommand(
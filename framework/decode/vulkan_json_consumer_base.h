@@ -105,6 +105,9 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
     /// Output the current in-memory json tree to the destination file.
     void WriteBlockEnd() { writer_->WriteBlockEnd(); }
 
+    /// Output the block written to the stream returned by WriteStreamApiCallStart().
+    void WriteStreamBlockEnd() { writer_->WriteStreamBlockEnd(); }
+
     // Wrappers for json field names allowing change without code gen and
     // leaving door open for switching output based on internal state.
     /// @todo Just use the constants directly: the requirement to be able to have
@@ -134,6 +137,11 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
         return writer_->WriteApiCallStart(call_info, command_name);
     }
 
+    util::JsonStreamWriter& WriteStreamApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
+    {
+        return writer_->WriteStreamApiCallStart(call_info, command_name);
+    }
+
     /// A utility wrapper so that manual output functions can provide a lambda which only needs to output
     /// the fields unique to their call and this tops and tails with the standard boilerplate, defining it
     /// once here. Generated functions avoid the indirection through this.
@@ -271,6 +271,11 @@ struct DeviceInfo : public VulkanObjectInfo<VkDevice>
     std::vector<bool>                                      queue_family_index_enabled;
 
     std::vector<VkPhysicalDevice> replay_device_group;
+
+    // Pipeline cache created by replay, which receives the pipelines that are compiled ahead of replay. When pipeline
+    // cache files are enabled, it is loaded from and saved to the file at replay_pipeline_cache_path.
+    VkPipelineCache replay_pipeline_cache{ VK_NULL_HANDLE };
+    std::string     replay_pipeline_cache_path;
 };
 
 struct QueueInfo : public VulkanObjectInfo<VkQueue>
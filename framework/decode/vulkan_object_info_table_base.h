@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_BASE_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_BASE_H
 
+#include "decode/handle_id_map.h"
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -37,11 +38,17 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Container used to store the object info structures of each handle type. HandleIdMap replaces the hash lookups of
+// std::unordered_map with direct indexing by capture ID. The AddObjectInfo() and GetObjectInfo() helpers accept either
+// container, so a table can be switched back to std::unordered_map by changing its declaration.
+template <typename T>
+using VulkanObjectInfoMap = HandleIdMap<T>;
+
 class VulkanObjectInfoTableBase
 {
   protected:
-    template <typename T>
-    void AddObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
+    template <typename T, typename Map>
+    void AddObjectInfo(T&& info, Map* map)
     {
         assert(map != nullptr);
 
@@ -82,8 +89,8 @@ class VulkanObjectInfoTableBase
     //
     // Note: the "dummy" template parameter is here for the sole purpose of working around a gcc issue which does
     // not allow full specialization in non-namespace scope (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=85282)
-    template <typename dummy>
-    void AddObjectInfo(SurfaceKHRInfo&& info, std::unordered_map<format::HandleId, SurfaceKHRInfo>* map)
+    template <typename dummy, typename Map>
+    void AddObjectInfo(SurfaceKHRInfo&& info, Map* map)
     {
         assert(map != nullptr);
 
@@ -110,8 +117,8 @@ class VulkanObjectInfoTableBase
         }
     }
 
-    template <typename T>
-    const T* GetObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
+    template <typename T, typename Map>
+    const T* GetObjectInfo(format::HandleId id, const Map* map) const
     {
         assert(map != nullptr);
 
@@ -130,8 +137,8 @@ class VulkanObjectInfoTableBase
         return object_info;
     }
 
-    template <typename T>
-    T* GetObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    template <typename T, typename Map>
+    T* GetObjectInfo(format::HandleId id, Map* map)
     {
         assert(map != nullptr);
 
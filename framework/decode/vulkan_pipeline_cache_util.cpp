@@ -0,0 +1,181 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pipeline_cache_util.h"
+
+#include "decode/file_processor.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/file_path.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <random>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+GFXRECON_BEGIN_NAMESPACE(pipeline_cache_util)
+
+// Chains the hashes of the encoded parameters of the calls, without decoding them.
+class PipelineHashDecoder : public VulkanDecoder
+{
+  public:
+    const util::hash::Hash128& GetHash() const { return hash_; }
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override
+    {
+        return (call_id == format::ApiCallId::ApiCall_vkCreateShaderModule) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateGraphicsPipelines) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateComputePipelines) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV);
+    }
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return false; }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override
+    {
+        hash_ = util::hash::GenerateHash128(parameter_buffer, buffer_size, hash_.low ^ hash_.high);
+    }
+
+  private:
+    util::hash::Hash128 hash_;
+};
+
+bool ComputeCapturePipelineHash(const std::string& filename, util::hash::Hash128* hash)
+{
+    assert(hash != nullptr);
+
+    FileProcessor       file_processor;
+    PipelineHashDecoder decoder;
+
+    if (!file_processor.Initialize(filename))
+    {
+        return false;
+    }
+
+    file_processor.AddDecoder(&decoder);
+    file_processor.ProcessAllFrames();
+    file_processor.RemoveDecoder(&decoder);
+
+    (*hash) = decoder.GetHash();
+
+    return true;
+}
+
+std::string GetPipelineCacheFilePath(const std::string&                directory,
+                                     const VkPhysicalDeviceProperties& properties,
+                                     const util::hash::Hash128&        capture_hash)
+{
+    std::string name = "pipeline_cache_";
+
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+    {
+        char digits[3];
+        snprintf(digits, sizeof(digits), "%02x", properties.pipelineCacheUUID[i]);
+        name += digits;
+    }
+
+    char suffix[96];
+    snprintf(suffix,
+             sizeof(suffix),
+             "_%08x_%04x_%04x_%016" PRIx64 "%016" PRIx64 ".bin",
+             properties.driverVersion,
+             properties.vendorID,
+             properties.deviceID,
+             capture_hash.high,
+             capture_hash.low);
+    name += suffix;
+
+    return util::filepath::Join(directory, name);
+}
+
+bool ReadPipelineCacheFile(const std::string& path, std::vector<uint8_t>* data)
+{
+    assert(data != nullptr);
+
+    FILE* file = nullptr;
+
+    if (util::platform::FileOpen(&file, path.c_str(), "rb") != 0)
+    {
+        return false;
+    }
+
+    bool success = false;
+
+    if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+    {
+        int64_t file_size = util::platform::FileTell(file);
+
+        if ((file_size > 0) && util::platform::FileSeek(file, 0, util::platform::FileSeekSet))
+        {
+            data->resize(static_cast<size_t>(file_size));
+            success = (util::platform::FileRead(data->data(), 1, data->size(), file) == data->size());
+        }
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+bool WritePipelineCacheFile(const std::string& path, const std::vector<uint8_t>& data)
+{
+    // The temporary file name is unique to this process and thread, so that concurrent replays never write the same
+    // temporary file.
+    std::random_device random;
+    std::string        temp_path = path;
+    temp_path += "." + std::to_string(util::platform::GetCurrentProcessId());
+    temp_path += "." + std::to_string(util::platform::GetCurrentThreadId());
+    temp_path += "." + std::to_string(random()) + ".tmp";
+
+    FILE* file = nullptr;
+
+    if (util::platform::FileOpen(&file, temp_path.c_str(), "wb") != 0)
+    {
+        return false;
+    }
+
+    bool success = (util::platform::FileWrite(data.data(), 1, data.size(), file) == data.size());
+    success      = (util::platform::FileClose(file) == 0) && success;
+
+    if (success)
+    {
+        success = util::platform::FileReplace(temp_path.c_str(), path.c_str());
+    }
+
+    if (!success)
+    {
+        std::remove(temp_path.c_str());
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(pipeline_cache_util)
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
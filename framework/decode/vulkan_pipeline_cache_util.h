@@ -0,0 +1,60 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PIPELINE_CACHE_UTIL_H
+#define GFXRECON_DECODE_VULKAN_PIPELINE_CACHE_UTIL_H
+
+#include "util/defines.h"
+#include "util/hash.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+GFXRECON_BEGIN_NAMESPACE(pipeline_cache_util)
+
+// Hashes the encoded parameters of the calls that create shader modules and pipelines in a capture file, identifying
+// the pipelines that are compiled by replay of the capture. Returns false if the file could not be opened.
+bool ComputeCapturePipelineHash(const std::string& filename, util::hash::Hash128* hash);
+
+// Returns the path of the pipeline cache file for a capture and a replay device. The name of the file includes the
+// pipeline cache UUID, driver version, vendor ID and device ID of the device, so that the data is only loaded by
+// devices that can use it.
+std::string GetPipelineCacheFilePath(const std::string&                directory,
+                                     const VkPhysicalDeviceProperties& properties,
+                                     const util::hash::Hash128&        capture_hash);
+
+bool ReadPipelineCacheFile(const std::string& path, std::vector<uint8_t>* data);
+
+// The data is written to a temporary file that replaces the existing file, so that concurrent replays of the same
+// capture never read a partially written file.
+bool WritePipelineCacheFile(const std::string& path, const std::vector<uint8_t>& data);
+
+GFXRECON_END_NAMESPACE(pipeline_cache_util)
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PIPELINE_CACHE_UTIL_H
@@ -0,0 +1,801 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pipeline_prefetcher.h"
+
+#include "decode/decode_allocator.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Returns true if every structure in the pNext chain is known to contain no handles, which would need to be mapped by
+// the replay thread. Calls with other structures, including structures added by newer extensions, are not prefetched.
+static bool IsPNextChainPrefetchable(const void* next)
+{
+    auto current = reinterpret_cast<const VkBaseInStructure*>(next);
+
+    while (current != nullptr)
+    {
+        switch (current->sType)
+        {
+            // VkGraphicsPipelineCreateInfo and VkComputePipelineCreateInfo extensions.
+            case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD:
+            case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+            case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX:
+            case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD:
+            case VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV:
+            case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV:
+            case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_LOCATION_INFO_KHR:
+            case VK_STRUCTURE_TYPE_RENDERING_INPUT_ATTACHMENT_INDEX_INFO_KHR:
+            // VkPipelineShaderStageCreateInfo extensions.
+            case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
+                break;
+            default:
+                return false;
+        }
+
+        current = current->pNext;
+    }
+
+    return true;
+}
+
+// Decodes the calls that are recorded by the scanning thread, and the calls that create and destroy the objects that
+// they use.
+class VulkanPipelinePrefetcher::ScanDecoder : public VulkanDecoder
+{
+  public:
+    ScanDecoder(VulkanPipelinePrefetcher* prefetcher, ScanConsumer* consumer) :
+        prefetcher_(prefetcher), consumer_(consumer)
+    {}
+
+    virtual bool IsComplete(uint64_t block_index) override { return prefetcher_->WaitForScanWindow(block_index); }
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override
+    {
+        return (call_id == format::ApiCallId::ApiCall_vkCreateGraphicsPipelines) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateComputePipelines) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateShaderModule) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreatePipelineLayout) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateRenderPass) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateRenderPass2) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateRenderPass2KHR) ||
+               (call_id == format::ApiCallId::ApiCall_vkCreateDevice) ||
+               (call_id == format::ApiCallId::ApiCall_vkDestroyShaderModule) ||
+               (call_id == format::ApiCallId::ApiCall_vkDestroyPipelineLayout) ||
+               (call_id == format::ApiCallId::ApiCall_vkDestroyRenderPass) ||
+               (call_id == format::ApiCallId::ApiCall_vkDestroyDevice);
+    }
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return false; }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override;
+
+  private:
+    VulkanPipelinePrefetcher* prefetcher_;
+    ScanConsumer*             consumer_;
+};
+
+class VulkanPipelinePrefetcher::ScanConsumer : public VulkanConsumer
+{
+  public:
+    ScanConsumer(VulkanPipelinePrefetcher* prefetcher) :
+        prefetcher_(prefetcher), parameter_buffer_(nullptr), buffer_size_(0)
+    {}
+
+    void SetParameterBuffer(const uint8_t* parameter_buffer, size_t buffer_size)
+    {
+        parameter_buffer_ = parameter_buffer;
+        buffer_size_      = buffer_size;
+    }
+
+    virtual void Process_vkCreateGraphicsPipelines(
+        const ApiCallInfo&                                          call_info,
+        VkResult                                                    returnValue,
+        format::HandleId                                            device,
+        format::HandleId                                            pipelineCache,
+        uint32_t                                                    createInfoCount,
+        StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+        HandlePointerDecoder<VkPipeline>*                           pPipelines) override
+    {
+        if ((returnValue != VK_SUCCESS) || (pCreateInfos == nullptr) || pCreateInfos->IsNull())
+        {
+            return;
+        }
+
+        auto job = CreateJob(format::ApiCallId::ApiCall_vkCreateGraphicsPipelines, call_info, device);
+
+        const Decoded_VkGraphicsPipelineCreateInfo* create_infos = pCreateInfos->GetMetaStructPointer();
+        size_t                                      count        = pCreateInfos->GetLength();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Decoded_VkGraphicsPipelineCreateInfo& create_info = create_infos[i];
+
+            if ((create_info.basePipelineHandle != format::kNullHandleId) ||
+                !IsPNextChainPrefetchable(create_info.decoded_value->pNext))
+            {
+                return;
+            }
+
+            AddHandleId(create_info.layout, &job->pipeline_layouts, job.get());
+            AddHandleId(create_info.renderPass, &job->render_passes, job.get());
+
+            if ((create_info.pStages != nullptr) && !create_info.pStages->IsNull())
+            {
+                const Decoded_VkPipelineShaderStageCreateInfo* stages = create_info.pStages->GetMetaStructPointer();
+                size_t                                         stage_count = create_info.pStages->GetLength();
+
+                for (size_t j = 0; j < stage_count; ++j)
+                {
+                    if (!IsPNextChainPrefetchable(stages[j].decoded_value->pNext))
+                    {
+                        return;
+                    }
+
+                    AddHandleId(stages[j].module, &job->shader_modules, job.get());
+                }
+            }
+        }
+
+        prefetcher_->AddJob(std::move(job));
+    }
+
+    virtual void Process_vkCreateComputePipelines(
+        const ApiCallInfo&                                         call_info,
+        VkResult                                                   returnValue,
+        format::HandleId                                           device,
+        format::HandleId                                           pipelineCache,
+        uint32_t                                                   createInfoCount,
+        StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+        HandlePointerDecoder<VkPipeline>*                          pPipelines) override
+    {
+        if ((returnValue != VK_SUCCESS) || (pCreateInfos == nullptr) || pCreateInfos->IsNull())
+        {
+            return;
+        }
+
+        auto job = CreateJob(format::ApiCallId::ApiCall_vkCreateComputePipelines, call_info, device);
+
+        const Decoded_VkComputePipelineCreateInfo* create_infos = pCreateInfos->GetMetaStructPointer();
+        size_t                                     count        = pCreateInfos->GetLength();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Decoded_VkComputePipelineCreateInfo& create_info = create_infos[i];
+
+            if ((create_info.basePipelineHandle != format::kNullHandleId) ||
+                !IsPNextChainPrefetchable(create_info.decoded_value->pNext) || (create_info.stage == nullptr) ||
+                !IsPNextChainPrefetchable(create_info.stage->decoded_value->pNext))
+            {
+                return;
+            }
+
+            AddHandleId(create_info.layout, &job->pipeline_layouts, job.get());
+            AddHandleId(create_info.stage->module, &job->shader_modules, job.get());
+        }
+
+        prefetcher_->AddJob(std::move(job));
+    }
+
+    virtual void Process_vkCreateShaderModule(
+        const ApiCallInfo&                                      call_info,
+        VkResult                                                returnValue,
+        format::HandleId                                        device,
+        StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
+        HandlePointerDecoder<VkShaderModule>*                   pShaderModule) override
+    {
+        AddCreatedHandleId(call_info, pShaderModule);
+    }
+
+    virtual void Process_vkCreatePipelineLayout(
+        const ApiCallInfo&                                        call_info,
+        VkResult                                                  returnValue,
+        format::HandleId                                          device,
+        StructPointerDecoder<Decoded_VkPipelineLayoutCreateInfo>* pCreateInfo,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*      pAllocator,
+        HandlePointerDecoder<VkPipelineLayout>*                   pPipelineLayout) override
+    {
+        AddCreatedHandleId(call_info, pPipelineLayout);
+    }
+
+    virtual void Process_vkCreateRenderPass(const ApiCallInfo&                                    call_info,
+                                            VkResult                                              returnValue,
+                                            format::HandleId                                      device,
+                                            StructPointerDecoder<Decoded_VkRenderPassCreateInfo>* pCreateInfo,
+                                            StructPointerDecoder<Decoded_VkAllocationCallbacks>*  pAllocator,
+                                            HandlePointerDecoder<VkRenderPass>*                   pRenderPass) override
+    {
+        AddCreatedHandleId(call_info, pRenderPass);
+    }
+
+    virtual void Process_vkCreateRenderPass2(
+        const ApiCallInfo&                                     call_info,
+        VkResult                                               returnValue,
+        format::HandleId                                       device,
+        StructPointerDecoder<Decoded_VkRenderPassCreateInfo2>* pCreateInfo,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*   pAllocator,
+        HandlePointerDecoder<VkRenderPass>*                    pRenderPass) override
+    {
+        AddCreatedHandleId(call_info, pRenderPass);
+    }
+
+    virtual void Process_vkCreateRenderPass2KHR(
+        const ApiCallInfo&                                     call_info,
+        VkResult                                               returnValue,
+        format::HandleId                                       device,
+        StructPointerDecoder<Decoded_VkRenderPassCreateInfo2>* pCreateInfo,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*   pAllocator,
+        HandlePointerDecoder<VkRenderPass>*                    pRenderPass) override
+    {
+        AddCreatedHandleId(call_info, pRenderPass);
+    }
+
+    virtual void Process_vkCreateDevice(const ApiCallInfo&                                   call_info,
+                                        VkResult                                             returnValue,
+                                        format::HandleId                                     physicalDevice,
+                                        StructPointerDecoder<Decoded_VkDeviceCreateInfo>*    pCreateInfo,
+                                        StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+                                        HandlePointerDecoder<VkDevice>*                      pDevice) override
+    {
+        AddCreatedHandleId(call_info, pDevice);
+    }
+
+    virtual void Process_vkDestroyShaderModule(const ApiCallInfo&                                   call_info,
+                                               format::HandleId                                     device,
+                                               format::HandleId                                     shaderModule,
+                                               StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator) override
+    {
+        block_indices_[shaderModule] = call_info.index;
+    }
+
+    virtual void Process_vkDestroyPipelineLayout(
+        const ApiCallInfo&                                   call_info,
+        format::HandleId                                     device,
+        format::HandleId                                     pipelineLayout,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator) override
+    {
+        block_indices_[pipelineLayout] = call_info.index;
+    }
+
+    virtual void Process_vkDestroyRenderPass(const ApiCallInfo&                                   call_info,
+                                             format::HandleId                                     device,
+                                             format::HandleId                                     renderPass,
+                                             StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator) override
+    {
+        block_indices_[renderPass] = call_info.index;
+    }
+
+    virtual void Process_vkDestroyDevice(const ApiCallInfo&                                   call_info,
+                                         format::HandleId                                     device,
+                                         StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator) override
+    {
+        block_indices_[device] = call_info.index;
+    }
+
+  private:
+    std::unique_ptr<Job> CreateJob(format::ApiCallId call_id, const ApiCallInfo& call_info, format::HandleId device)
+    {
+        auto job       = std::make_unique<Job>();
+        job->call_id   = call_id;
+        job->call_info = call_info;
+        job->device_id = device;
+        job->parameters.assign(parameter_buffer_, parameter_buffer_ + buffer_size_);
+
+        UpdateFirstUsableBlockIndex(device, job.get());
+
+        return job;
+    }
+
+    template <typename Handle>
+    void AddCreatedHandleId(const ApiCallInfo& call_info, HandlePointerDecoder<Handle>* handle)
+    {
+        if ((handle != nullptr) && !handle->IsNull())
+        {
+            block_indices_[*handle->GetPointer()] = call_info.index;
+        }
+    }
+
+    template <typename Handle>
+    void AddHandleId(format::HandleId id, ResolvedHandles<Handle>* handles, Job* job)
+    {
+        if ((id != format::kNullHandleId) &&
+            std::none_of(handles->begin(), handles->end(), [id](const std::pair<format::HandleId, Handle>& entry) {
+                return entry.first == id;
+            }))
+        {
+            handles->emplace_back(id, VK_NULL_HANDLE);
+            UpdateFirstUsableBlockIndex(id, job);
+        }
+    }
+
+    void UpdateFirstUsableBlockIndex(format::HandleId id, Job* job)
+    {
+        auto entry = block_indices_.find(id);
+        if (entry != block_indices_.end())
+        {
+            job->first_usable_block_index = std::max(job->first_usable_block_index, entry->second + 1);
+        }
+    }
+
+  private:
+    VulkanPipelinePrefetcher* prefetcher_;
+    const uint8_t*            parameter_buffer_;
+    size_t                    buffer_size_;
+
+    // Block index of the last call that created or destroyed an object, by capture ID.
+    std::unordered_map<format::HandleId, uint64_t> block_indices_;
+};
+
+void VulkanPipelinePrefetcher::ScanDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                                               const ApiCallInfo& call_info,
+                                                               const uint8_t*     parameter_buffer,
+                                                               size_t             buffer_size)
+{
+    // The jobs keep a copy of the encoded parameters, which the compile threads decode again.
+    consumer_->SetParameterBuffer(parameter_buffer, buffer_size);
+    VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+}
+
+// Replaces the capture IDs of the decoded create infos with the handles that were resolved by the replay thread, and
+// compiles the pipelines into the replay pipeline cache.
+class VulkanPipelinePrefetcher::CompileConsumer : public VulkanConsumer
+{
+  public:
+    CompileConsumer() : job_(nullptr), result_(VK_ERROR_INITIALIZATION_FAILED) {}
+
+    void SetJob(Job* job)
+    {
+        job_    = job;
+        result_ = VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    VkResult GetResult() const { return result_; }
+
+    virtual void Process_vkCreateGraphicsPipelines(
+        const ApiCallInfo&                                          call_info,
+        VkResult                                                    returnValue,
+        format::HandleId                                            device,
+        format::HandleId                                            pipelineCache,
+        uint32_t                                                    createInfoCount,
+        StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+        HandlePointerDecoder<VkPipeline>*                           pPipelines) override
+    {
+        assert((job_ != nullptr) && (pCreateInfos != nullptr));
+
+        Decoded_VkGraphicsPipelineCreateInfo* create_infos = pCreateInfos->GetMetaStructPointer();
+        uint32_t                              count        = static_cast<uint32_t>(pCreateInfos->GetLength());
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            VkGraphicsPipelineCreateInfo* value = create_infos[i].decoded_value;
+
+            value->flags &= ~VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
+            value->layout     = FindHandle(job_->pipeline_layouts, create_infos[i].layout);
+            value->renderPass = FindHandle(job_->render_passes, create_infos[i].renderPass);
+
+            if ((create_infos[i].pStages != nullptr) && !create_infos[i].pStages->IsNull())
+            {
+                Decoded_VkPipelineShaderStageCreateInfo* stages = create_infos[i].pStages->GetMetaStructPointer();
+                size_t                                   stage_count = create_infos[i].pStages->GetLength();
+
+                for (size_t j = 0; j < stage_count; ++j)
+                {
+                    stages[j].decoded_value->module = FindHandle(job_->shader_modules, stages[j].module);
+                }
+            }
+        }
+
+        std::vector<VkPipeline> pipelines(count, VK_NULL_HANDLE);
+        result_ = job_->device_table->CreateGraphicsPipelines(
+            job_->device, job_->pipeline_cache, count, pCreateInfos->GetPointer(), nullptr, pipelines.data());
+
+        DestroyPipelines(pipelines);
+    }
+
+    virtual void Process_vkCreateComputePipelines(
+        const ApiCallInfo&                                         call_info,
+        VkResult                                                   returnValue,
+        format::HandleId                                           device,
+        format::HandleId                                           pipelineCache,
+        uint32_t                                                   createInfoCount,
+        StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+        HandlePointerDecoder<VkPipeline>*                          pPipelines) override
+    {
+        assert((job_ != nullptr) && (pCreateInfos != nullptr));
+
+        Decoded_VkComputePipelineCreateInfo* create_infos = pCreateInfos->GetMetaStructPointer();
+        uint32_t                             count        = static_cast<uint32_t>(pCreateInfos->GetLength());
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            VkComputePipelineCreateInfo* value = create_infos[i].decoded_value;
+
+            value->flags &= ~VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
+            value->layout       = FindHandle(job_->pipeline_layouts, create_infos[i].layout);
+            value->stage.module = FindHandle(job_->shader_modules, create_infos[i].stage->module);
+        }
+
+        std::vector<VkPipeline> pipelines(count, VK_NULL_HANDLE);
+        result_ = job_->device_table->CreateComputePipelines(
+            job_->device, job_->pipeline_cache, count, pCreateInfos->GetPointer(), nullptr, pipelines.data());
+
+        DestroyPipelines(pipelines);
+    }
+
+  private:
+    void DestroyPipelines(const std::vector<VkPipeline>& pipelines)
+    {
+        for (VkPipeline pipeline : pipelines)
+        {
+            if (pipeline != VK_NULL_HANDLE)
+            {
+                job_->device_table->DestroyPipeline(job_->device, pipeline, nullptr);
+            }
+        }
+    }
+
+  private:
+    Job*     job_;
+    VkResult result_;
+};
+
+VulkanPipelinePrefetcher::VulkanPipelinePrefetcher(const VulkanObjectInfoTable* object_info_table,
+                                                   GetDeviceTableFunc           get_device_table) :
+    object_info_table_(object_info_table),
+    get_device_table_(get_device_table), block_distance_(0), replay_block_index_(0), stopping_(false),
+    prefetched_count_(0), late_count_(0), missed_count_(0)
+{
+    assert(object_info_table_ != nullptr);
+}
+
+VulkanPipelinePrefetcher::~VulkanPipelinePrefetcher()
+{
+    Stop();
+
+    uint64_t call_count = prefetched_count_ + late_count_ + missed_count_;
+    if (call_count > 0)
+    {
+        GFXRECON_LOG_INFO("Pipeline prefetch: %" PRIu64 " of %" PRIu64
+                          " pipeline creation calls were compiled ahead of replay, %" PRIu64
+                          " were not compiled in time, and %" PRIu64 " could not be prefetched",
+                          prefetched_count_,
+                          call_count,
+                          late_count_,
+                          missed_count_);
+    }
+}
+
+bool VulkanPipelinePrefetcher::Start(const std::string& filename, uint64_t block_distance)
+{
+    assert(file_processor_ == nullptr);
+
+    file_processor_ = std::make_unique<FileProcessor>();
+
+    if (!file_processor_->Initialize(filename))
+    {
+        // Replay has not started decoding, so it is not affected by the release of the decode allocator of this thread
+        // by the FileProcessor destructor.
+        file_processor_.reset();
+        return false;
+    }
+
+    block_distance_ = block_distance;
+
+    // The replay thread and the scanning thread are also busy, so half of the hardware threads are used to compile.
+    uint32_t compile_thread_count = std::max(1u, std::thread::hardware_concurrency() / 2);
+    for (uint32_t i = 0; i < compile_thread_count; ++i)
+    {
+        compile_threads_.emplace_back(&VulkanPipelinePrefetcher::Compile, this);
+    }
+
+    scan_thread_ = std::thread(&VulkanPipelinePrefetcher::Scan, this);
+
+    return true;
+}
+
+void VulkanPipelinePrefetcher::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+
+    scan_window_.notify_all();
+    work_available_.notify_all();
+
+    if (scan_thread_.joinable())
+    {
+        scan_thread_.join();
+    }
+
+    for (auto& thread : compile_threads_)
+    {
+        thread.join();
+    }
+
+    compile_threads_.clear();
+    compile_queue_.clear();
+    pending_jobs_.clear();
+    jobs_.clear();
+}
+
+void VulkanPipelinePrefetcher::SetReplayBlockIndex(uint64_t block_index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (stopping_)
+    {
+        return;
+    }
+
+    replay_block_index_ = block_index;
+
+    // Only the calls whose dependencies have been created by replay are resolved, once. Calls that cannot be resolved
+    // then are left for replay to compile. A call is always usable by its own block, so all of the calls that are
+    // released below have been removed from the pending calls.
+    bool queued = false;
+
+    while (!pending_jobs_.empty() && (pending_jobs_.begin()->first <= block_index))
+    {
+        Job* job = pending_jobs_.begin()->second;
+        pending_jobs_.erase(pending_jobs_.begin());
+
+        if ((job->call_info.index > block_index) && ResolveJob(job))
+        {
+            job->state = JobState::kQueued;
+            compile_queue_.push_back(job);
+            queued = true;
+        }
+    }
+
+    // Calls from blocks that were replayed without being claimed are no longer needed. Their compilations must not
+    // run past their blocks, as replay may now destroy the objects that they use.
+    while (!jobs_.empty() && (jobs_.front()->call_info.index < block_index))
+    {
+        ReleaseJob(jobs_.front().get(), &lock);
+        jobs_.pop_front();
+    }
+
+    lock.unlock();
+
+    if (queued)
+    {
+        work_available_.notify_all();
+    }
+
+    scan_window_.notify_one();
+}
+
+bool VulkanPipelinePrefetcher::ClaimPipelines(uint64_t block_index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (stopping_)
+    {
+        return false;
+    }
+
+    if (jobs_.empty() || (jobs_.front()->call_info.index != block_index))
+    {
+        // The call was not recorded because it uses objects that the compile threads cannot resolve, or because the
+        // scanning thread had not reached it.
+        ++missed_count_;
+        return false;
+    }
+
+    Job* job = jobs_.front().get();
+    ReleaseJob(job, &lock);
+
+    bool prefetched = (job->state == JobState::kCompiled);
+
+    if (prefetched)
+    {
+        ++prefetched_count_;
+    }
+    else if (job->state == JobState::kFailed)
+    {
+        ++missed_count_;
+    }
+    else
+    {
+        ++late_count_;
+    }
+
+    jobs_.pop_front();
+
+    return prefetched;
+}
+
+void VulkanPipelinePrefetcher::Scan()
+{
+    ScanConsumer consumer(this);
+    ScanDecoder  decoder(this, &consumer);
+
+    decoder.AddConsumer(&consumer);
+    file_processor_->AddDecoder(&decoder);
+    file_processor_->ProcessAllFrames();
+    file_processor_->RemoveDecoder(&decoder);
+
+    // The FileProcessor destructor releases the decode allocator of the thread that it runs on.
+    file_processor_.reset();
+}
+
+void VulkanPipelinePrefetcher::Compile()
+{
+    CompileConsumer consumer;
+    VulkanDecoder   decoder;
+
+    decoder.AddConsumer(&consumer);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        work_available_.wait(lock, [this]() { return stopping_ || !compile_queue_.empty(); });
+
+        if (stopping_)
+        {
+            break;
+        }
+
+        Job* job = compile_queue_.front();
+        compile_queue_.pop_front();
+        job->state = JobState::kCompiling;
+
+        lock.unlock();
+
+        consumer.SetJob(job);
+
+        DecodeAllocator::Begin();
+        decoder.DecodeFunctionCall(job->call_id, job->call_info, job->parameters.data(), job->parameters.size());
+        DecodeAllocator::End();
+
+        lock.lock();
+
+        job->state = (consumer.GetResult() == VK_SUCCESS) ? JobState::kCompiled : JobState::kFailed;
+        job_complete_.notify_all();
+    }
+}
+
+bool VulkanPipelinePrefetcher::WaitForScanWindow(uint64_t block_index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    scan_window_.wait(lock, [this, block_index]() {
+        return stopping_ || (block_index <= (replay_block_index_ + block_distance_));
+    });
+    return stopping_;
+}
+
+void VulkanPipelinePrefetcher::AddJob(std::unique_ptr<Job> job)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Calls that replay has already reached, when the scanning thread has fallen behind, are discarded.
+    if (job->call_info.index > replay_block_index_)
+    {
+        pending_jobs_.emplace(job->first_usable_block_index, job.get());
+        jobs_.emplace_back(std::move(job));
+    }
+}
+
+bool VulkanPipelinePrefetcher::ResolveJob(Job* job) const
+{
+    assert(job != nullptr);
+
+    const DeviceInfo* device_info = object_info_table_->GetDeviceInfo(job->device_id);
+
+    if ((device_info == nullptr) || (device_info->handle == VK_NULL_HANDLE) ||
+        (device_info->replay_pipeline_cache == VK_NULL_HANDLE))
+    {
+        return false;
+    }
+
+    job->device         = device_info->handle;
+    job->device_table   = get_device_table_(device_info->handle);
+    job->pipeline_cache = device_info->replay_pipeline_cache;
+
+    return (job->device_table != nullptr) &&
+           ResolveHandles(&job->shader_modules, &VulkanObjectInfoTable::GetShaderModuleInfo) &&
+           ResolveHandles(&job->pipeline_layouts, &VulkanObjectInfoTable::GetPipelineLayoutInfo) &&
+           ResolveHandles(&job->render_passes, &VulkanObjectInfoTable::GetRenderPassInfo);
+}
+
+template <typename T>
+bool VulkanPipelinePrefetcher::ResolveHandles(ResolvedHandles<typename T::HandleType>* handles,
+                                              const T* (VulkanObjectInfoTable::*GetInfoFunc)(format::HandleId)
+                                                  const) const
+{
+    assert(handles != nullptr);
+
+    for (auto& entry : *handles)
+    {
+        const T* info = (object_info_table_->*GetInfoFunc)(entry.first);
+
+        if ((info == nullptr) || (info->handle == VK_NULL_HANDLE))
+        {
+            // The object has not been created yet.
+            return false;
+        }
+
+        entry.second = info->handle;
+    }
+
+    return true;
+}
+
+template <typename Handle>
+Handle VulkanPipelinePrefetcher::FindHandle(const ResolvedHandles<Handle>& handles, format::HandleId id)
+{
+    for (const auto& entry : handles)
+    {
+        if (entry.first == id)
+        {
+            return entry.second;
+        }
+    }
+
+    return VK_NULL_HANDLE;
+}
+
+void VulkanPipelinePrefetcher::ReleaseJob(Job* job, std::unique_lock<std::mutex>* lock)
+{
+    assert((job != nullptr) && (lock != nullptr));
+
+    if (job->state == JobState::kQueued)
+    {
+        compile_queue_.erase(std::find(compile_queue_.begin(), compile_queue_.end(), job));
+        job->state = JobState::kScanned;
+    }
+    else if (job->state == JobState::kCompiling)
+    {
+        job_complete_.wait(*lock, [job]() { return job->state != JobState::kCompiling; });
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
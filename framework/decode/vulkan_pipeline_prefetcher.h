@@ -0,0 +1,175 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Compilation of pipelines on worker threads, ahead of the replay of the calls that create them.
+
+#ifndef GFXRECON_DECODE_VULKAN_PIPELINE_PREFETCHER_H
+#define GFXRECON_DECODE_VULKAN_PIPELINE_PREFETCHER_H
+
+#include "decode/api_decoder.h"
+#include "decode/file_processor.h"
+#include "decode/vulkan_object_info_table.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+/// @brief Compiles the pipelines of upcoming vkCreateGraphicsPipelines and vkCreateComputePipelines calls on worker
+/// threads, so that the replay of the calls retrieves the pipelines from a pipeline cache instead of compiling them.
+///
+/// A scanning thread reads the capture file with a separate FileProcessor, up to a fixed number of blocks ahead of
+/// replay, and records the pipeline creation calls that it finds. Only the replay thread accesses the object info
+/// table: before each block is replayed, it resolves the handles of the shader modules, pipeline layouts and render
+/// passes of the recorded calls whose dependencies were created by the replayed blocks, and queues the calls for
+/// compilation into the replay pipeline cache of the device. The compiled pipelines are destroyed, leaving their data
+/// in the cache.
+///
+/// The objects that a compilation uses are not destroyed while it runs, because replay waits for the compilation of a
+/// call to complete before it moves past the call's block, and the capture cannot destroy the objects before the call
+/// that uses them. Calls are not compiled before replay has passed the last destruction of an object with the same
+/// capture ID as one of their dependencies, which the trimmed state setup can reuse for temporary objects.
+class VulkanPipelinePrefetcher
+{
+  public:
+    typedef std::function<const encode::VulkanDeviceTable*(const void*)> GetDeviceTableFunc;
+
+    VulkanPipelinePrefetcher(const VulkanObjectInfoTable* object_info_table, GetDeviceTableFunc get_device_table);
+
+    ~VulkanPipelinePrefetcher();
+
+    /// @brief Opens the capture file and starts scanning it for pipeline creation calls, up to block_distance blocks
+    /// ahead of the replay thread.
+    /// @return False if the capture file could not be opened.
+    bool Start(const std::string& filename, uint64_t block_distance);
+
+    /// @brief Stops scanning the capture file and waits for the compilations that are running to complete. Calls
+    /// that were not compiled are discarded.
+    void Stop();
+
+    /// @brief Called by the replay thread before a block is replayed. Discards the calls from the blocks that were
+    /// replayed, and queues the calls that are within block_distance blocks for compilation once their dependencies
+    /// have been created.
+    void SetReplayBlockIndex(uint64_t block_index);
+
+    /// @brief Called by the replay thread when it replays a pipeline creation call. Waits for the compilation of the
+    /// call to complete if it is running, or cancels it if it has not started.
+    /// @return True if the pipelines of the call were compiled into the replay pipeline cache of the device.
+    bool ClaimPipelines(uint64_t block_index);
+
+  private:
+    class ScanDecoder;
+    class ScanConsumer;
+    class CompileConsumer;
+
+    template <typename Handle>
+    using ResolvedHandles = std::vector<std::pair<format::HandleId, Handle>>;
+
+    enum class JobState
+    {
+        kScanned,
+        kQueued,
+        kCompiling,
+        kCompiled,
+        kFailed
+    };
+
+    struct Job
+    {
+        format::ApiCallId                 call_id{ format::ApiCallId::ApiCall_Unknown };
+        ApiCallInfo                       call_info{};
+        std::vector<uint8_t>              parameters;
+        JobState                          state{ JobState::kScanned };
+        uint64_t                          first_usable_block_index{ 0 };
+        format::HandleId                  device_id{ format::kNullHandleId };
+        VkDevice                          device{ VK_NULL_HANDLE };
+        const encode::VulkanDeviceTable*  device_table{ nullptr };
+        VkPipelineCache                   pipeline_cache{ VK_NULL_HANDLE };
+        ResolvedHandles<VkShaderModule>   shader_modules;
+        ResolvedHandles<VkPipelineLayout> pipeline_layouts;
+        ResolvedHandles<VkRenderPass>     render_passes;
+    };
+
+    void Scan();
+
+    void Compile();
+
+    /// @brief Called by the scanning thread before each block is read. Blocks until the block is within block_distance
+    /// blocks of the replay thread.
+    /// @return True if scanning should stop.
+    bool WaitForScanWindow(uint64_t block_index);
+
+    void AddJob(std::unique_ptr<Job> job);
+
+    bool ResolveJob(Job* job) const;
+
+    template <typename T>
+    bool ResolveHandles(ResolvedHandles<typename T::HandleType>* handles,
+                        const T* (VulkanObjectInfoTable::*GetInfoFunc)(format::HandleId) const) const;
+
+    template <typename Handle>
+    static Handle FindHandle(const ResolvedHandles<Handle>& handles, format::HandleId id);
+
+    /// @brief Removes a job that has not started compiling from the compile queue, or waits for it to complete.
+    void ReleaseJob(Job* job, std::unique_lock<std::mutex>* lock);
+
+  private:
+    const VulkanObjectInfoTable*      object_info_table_;
+    GetDeviceTableFunc                get_device_table_;
+    std::unique_ptr<FileProcessor>    file_processor_;
+    uint64_t                          block_distance_;
+    uint64_t                          replay_block_index_;
+    std::mutex                        mutex_;
+    std::condition_variable           scan_window_;
+    std::condition_variable           work_available_;
+    std::condition_variable           job_complete_;
+    std::deque<std::unique_ptr<Job>>  jobs_;
+    std::multimap<uint64_t, Job*>     pending_jobs_; ///< Scanned jobs, by the first block that can resolve them.
+    std::deque<Job*>                  compile_queue_;
+    bool                              stopping_;
+    uint64_t                          prefetched_count_;
+    uint64_t                          late_count_;
+    uint64_t                          missed_count_;
+    std::thread                       scan_thread_;
+    std::vector<std::thread>          compile_threads_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PIPELINE_PREFETCHER_H
@@ -32,6 +32,7 @@
 #include "decode/vulkan_enum_util.h"
 #include "decode/vulkan_feature_util.h"
 #include "decode/vulkan_object_cleanup_util.h"
+#include "decode/vulkan_pipeline_cache_util.h"
 #include "format/format_util.h"
 #include "generated/generated_vulkan_struct_handle_mappers.h"
 #include "generated/generated_vulkan_constant_maps.h"
@@ -196,6 +197,9 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(std::shared_ptr<application::
 
 VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
 {
+    // Stop compiling pipelines ahead of replay before the devices are destroyed.
+    pipeline_prefetcher_.reset();
+
     // Idle all devices before destroying other resources.
     WaitDevicesIdle();
 
@@ -211,6 +215,8 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
         {
             screenshot_handler_->DestroyDeviceResources(device, device_table);
         }
+
+        DestroyReplayPipelineCache(info);
     });
 
     object_cleanup::FreeAllLiveObjects(
@@ -237,6 +243,49 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
     }
 }
 
+void VulkanReplayConsumerBase::StartPipelinePrefetch(const std::string& filename)
+{
+    GFXRECON_ASSERT(options_.pipeline_prefetch_distance > 0);
+
+    pipeline_prefetcher_ = std::make_unique<VulkanPipelinePrefetcher>(
+        &object_info_table_, [this](const void* handle) { return GetDeviceTable(handle); });
+
+    if (!pipeline_prefetcher_->Start(filename, options_.pipeline_prefetch_distance))
+    {
+        GFXRECON_LOG_WARNING("Failed to open %s for pipeline prefetching; pipelines will only be compiled by replay",
+                             filename.c_str());
+        pipeline_prefetcher_.reset();
+    }
+}
+
+void VulkanReplayConsumerBase::EnablePipelineCacheFiles(const std::string& filename)
+{
+    GFXRECON_ASSERT(!options_.pipeline_cache_dir.empty());
+
+    GFXRECON_WRITE_CONSOLE("Reading the pipeline creation calls of the capture file for pipeline cache files. This "
+                           "may take some time. Please wait...");
+
+    if (pipeline_cache_util::ComputeCapturePipelineHash(filename, &capture_pipeline_hash_))
+    {
+        use_pipeline_cache_files_ = true;
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to open %s for pipeline cache files; pipeline cache files will not be used",
+                             filename.c_str());
+    }
+}
+
+void VulkanReplayConsumerBase::SetCurrentBlockIndex(uint64_t block_index)
+{
+    VulkanConsumer::SetCurrentBlockIndex(block_index);
+
+    if (pipeline_prefetcher_ != nullptr)
+    {
+        pipeline_prefetcher_->SetReplayBlockIndex(block_index);
+    }
+}
+
 void VulkanReplayConsumerBase::WaitDevicesIdle()
 {
     object_info_table_.VisitDeviceInfo([this](const DeviceInfo* info) {
@@ -250,6 +299,188 @@ void VulkanReplayConsumerBase::WaitDevicesIdle()
     });
 }
 
+bool VulkanReplayConsumerBase::GetCommandBufferCallPool(format::ApiCallId call_id,
+                                                        const uint8_t*    parameter_buffer,
+                                                        size_t            buffer_size,
+                                                        format::HandleId* pool_id) const
+{
+    assert(pool_id != nullptr);
+
+    // The functions that record commands all take the command buffer as their first parameter. Functions without a
+    // handle as their first parameter are excluded, so that their parameter data is not interpreted as a handle ID.
+    // The calls that access state shared with other command buffers are excluded by SupportsThreadedDecoding().
+    if ((format::GetApiCallFamily(call_id) != format::ApiFamilyId::ApiFamily_Vulkan) ||
+        (buffer_size < sizeof(format::HandleId)) || (call_id == format::ApiCallId::ApiCall_vkCreateInstance) ||
+        (call_id == format::ApiCallId::ApiCall_vkEnumerateInstanceVersion) ||
+        (call_id == format::ApiCallId::ApiCall_vkEnumerateInstanceExtensionProperties) ||
+        (call_id == format::ApiCallId::ApiCall_vkEnumerateInstanceLayerProperties))
+    {
+        return false;
+    }
+
+    // Handle IDs are unique across all handle types, so only command buffer IDs will be found in the command buffer
+    // table.
+    format::HandleId command_buffer_id = format::kNullHandleId;
+    memcpy(&command_buffer_id, parameter_buffer, sizeof(command_buffer_id));
+
+    const CommandBufferInfo* command_buffer_info = object_info_table_.GetCommandBufferInfo(command_buffer_id);
+    if ((command_buffer_info == nullptr) || (command_buffer_info->handle == VK_NULL_HANDLE))
+    {
+        return false;
+    }
+
+    (*pool_id) = command_buffer_info->pool_id;
+
+    return true;
+}
+
+bool VulkanReplayConsumerBase::SupportsThreadedDecoding(format::ApiCallId call_id)
+{
+    // vkCmdExecuteCommands reads the CommandBufferInfo of the secondary command buffers, which may be recorded by
+    // other threads. The overrides for the other command recording calls only modify the CommandBufferInfo of the
+    // command buffer that they record to, and only read object info that is modified by the calls that are replayed on
+    // this thread while the worker threads are idle.
+    return (call_id != format::ApiCallId::ApiCall_vkCmdExecuteCommands);
+}
+
+void VulkanReplayConsumerBase::ProcessFrameLoopBegin(uint64_t frame_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(frame_number);
+
+    // The block indices of the looped frames are processed again, and would not match the calls that are scanned ahead
+    // of replay.
+    pipeline_prefetcher_.reset();
+
+    // Record the fence and event status after all work submitted before the loop has completed, which is the state
+    // that each repetition of the loop must begin with.
+    WaitDevicesIdle();
+
+    frame_loop_fence_signaled_.clear();
+    frame_loop_event_set_.clear();
+
+    object_info_table_.VisitFenceInfo([this](const FenceInfo* info) {
+        assert(info != nullptr);
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(info->parent_id);
+
+        if (device_info != nullptr)
+        {
+            auto device_table = GetDeviceTable(device_info->handle);
+            assert(device_table != nullptr);
+
+            frame_loop_fence_signaled_[info->capture_id] =
+                (device_table->GetFenceStatus(device_info->handle, info->handle) == VK_SUCCESS);
+        }
+    });
+
+    object_info_table_.VisitEventInfo([this](const EventInfo* info) {
+        assert(info != nullptr);
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(info->parent_id);
+
+        if (device_info != nullptr)
+        {
+            auto device_table = GetDeviceTable(device_info->handle);
+            assert(device_table != nullptr);
+
+            frame_loop_event_set_[info->capture_id] =
+                (device_table->GetEventStatus(device_info->handle, info->handle) == VK_EVENT_SET);
+        }
+    });
+}
+
+void VulkanReplayConsumerBase::ProcessFrameLoopRestart(uint64_t frame_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(frame_number);
+
+    // The previous repetition must complete before the state that it modified is restored.
+    WaitDevicesIdle();
+
+    for (const auto& entry : frame_loop_fence_signaled_)
+    {
+        const FenceInfo*  fence_info  = object_info_table_.GetFenceInfo(entry.first);
+        const DeviceInfo* device_info = nullptr;
+
+        if (fence_info != nullptr)
+        {
+            device_info = object_info_table_.GetDeviceInfo(fence_info->parent_id);
+        }
+
+        if (device_info != nullptr)
+        {
+            VkDevice device       = device_info->handle;
+            VkFence  fence        = fence_info->handle;
+            auto     device_table = GetDeviceTable(device);
+            assert(device_table != nullptr);
+
+            bool signaled = (device_table->GetFenceStatus(device, fence) == VK_SUCCESS);
+
+            if (signaled && !entry.second)
+            {
+                device_table->ResetFences(device, 1, &fence);
+            }
+            else if (!signaled && entry.second)
+            {
+                // Fences can only be signaled by a queue, so an empty batch is submitted to signal the fence.
+                VkQueue queue = VK_NULL_HANDLE;
+
+                object_info_table_.VisitQueueInfo([&](const QueueInfo* info) {
+                    if ((queue == VK_NULL_HANDLE) && (info->parent_id == device_info->capture_id))
+                    {
+                        queue = info->handle;
+                    }
+                });
+
+                if (queue != VK_NULL_HANDLE)
+                {
+                    device_table->QueueSubmit(queue, 0, nullptr, fence);
+                    device_table->QueueWaitIdle(queue);
+                }
+                else
+                {
+                    GFXRECON_LOG_WARNING("Failed to restore the signaled state of VkFence object (ID = %" PRIu64
+                                         ") for a looped frame range",
+                                         entry.first);
+                }
+            }
+        }
+    }
+
+    for (const auto& entry : frame_loop_event_set_)
+    {
+        const EventInfo*  event_info  = object_info_table_.GetEventInfo(entry.first);
+        const DeviceInfo* device_info = nullptr;
+
+        if (event_info != nullptr)
+        {
+            device_info = object_info_table_.GetDeviceInfo(event_info->parent_id);
+        }
+
+        if (device_info != nullptr)
+        {
+            VkDevice device       = device_info->handle;
+            VkEvent  event        = event_info->handle;
+            auto     device_table = GetDeviceTable(device);
+            assert(device_table != nullptr);
+
+            if (entry.second)
+            {
+                device_table->SetEvent(device, event);
+            }
+            else
+            {
+                device_table->ResetEvent(device, event);
+            }
+        }
+    }
+
+    // Re-apply the memory and resource contents from the state snapshot.
+    for (const auto& command : frame_loop_state_commands_)
+    {
+        command();
+    }
+
+    WaitDevicesIdle();
+}
+
 void VulkanReplayConsumerBase::ProcessStateBeginMarker(uint64_t frame_number)
 {
     GFXRECON_UNREFERENCED_PARAMETER(frame_number);
@@ -279,6 +510,14 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
                                                         uint64_t       size,
                                                         const uint8_t* data)
 {
+    if (IsKeepingFrameLoopState())
+    {
+        frame_loop_state_commands_.emplace_back(
+            [this, memory_id, offset, contents = std::vector<uint8_t>(data, data + size)]() {
+                ProcessFillMemoryCommand(memory_id, offset, contents.size(), contents.data());
+            });
+    }
+
     VkResult result = VK_ERROR_INITIALIZATION_FAILED;
 
     // We need to find the device memory associated with this ID, and then lookup its mapped pointer.
@@ -735,6 +974,13 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
 {
     GFXRECON_UNREFERENCED_PARAMETER(max_resource_size);
 
+    if (IsKeepingFrameLoopState())
+    {
+        frame_loop_state_commands_.emplace_back([this, device_id, max_resource_size, max_copy_size]() {
+            ProcessBeginResourceInitCommand(device_id, max_resource_size, max_copy_size);
+        });
+    }
+
     DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
     if (device_info != nullptr)
@@ -778,10 +1024,25 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
 
 void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId device_id)
 {
+    if (IsKeepingFrameLoopState())
+    {
+        frame_loop_state_commands_.emplace_back([this, device_id]() { ProcessEndResourceInitCommand(device_id); });
+    }
+
     DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
     if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
     {
+        // Wait for the initialization copies that are still pending.
+        VkResult result = device_info->resource_initializer->Flush();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING(
+                "State snapshot resource initialization failed to complete for VkDevice object (ID = %" PRIu64 ")",
+                device_id);
+        }
+
         device_info->resource_initializer.reset();
     }
 }
@@ -791,6 +1052,14 @@ void VulkanReplayConsumerBase::ProcessInitBufferCommand(format::HandleId device_
                                                         uint64_t         data_size,
                                                         const uint8_t*   data)
 {
+    if (IsKeepingFrameLoopState())
+    {
+        frame_loop_state_commands_.emplace_back(
+            [this, device_id, buffer_id, contents = std::vector<uint8_t>(data, data + data_size)]() {
+                ProcessInitBufferCommand(device_id, buffer_id, contents.size(), contents.data());
+            });
+    }
+
     DeviceInfo*       device_info = object_info_table_.GetDeviceInfo(device_id);
     const BufferInfo* buffer_info = object_info_table_.GetBufferInfo(buffer_id);
 
@@ -868,6 +1137,19 @@ void VulkanReplayConsumerBase::ProcessInitImageCommand(format::HandleId
                                                        const std::vector<uint64_t>& level_sizes,
                                                        const uint8_t*               data)
 {
+    if (IsKeepingFrameLoopState())
+    {
+        frame_loop_state_commands_.emplace_back([this,
+                                                 device_id,
+                                                 image_id,
+                                                 aspect,
+                                                 layout,
+                                                 level_sizes,
+                                                 contents = std::vector<uint8_t>(data, data + data_size)]() {
+            ProcessInitImageCommand(device_id, image_id, contents.size(), aspect, layout, level_sizes, contents.data());
+        });
+    }
+
     DeviceInfo*      device_info = object_info_table_.GetDeviceInfo(device_id);
     const ImageInfo* image_info  = object_info_table_.GetImageInfo(image_id);
 
@@ -2688,6 +2970,11 @@ VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_resu
 
             device_info->allocator = std::unique_ptr<VulkanResourceAllocator>(allocator);
 
+            if ((pipeline_prefetcher_ != nullptr) || use_pipeline_cache_files_)
+            {
+                CreateReplayPipelineCache(physical_device_info, *replay_device, device_info);
+            }
+
             // Track state of physical device properties and features at device creation
             device_info->property_feature_info = property_feature_info;
 
@@ -2739,6 +3026,8 @@ void VulkanReplayConsumerBase::OverrideDestroyDevice(
         }
 
         device_info->allocator->Destroy();
+
+        DestroyReplayPipelineCache(device_info);
     }
 
     func(device, GetAllocationCallbacks(pAllocator));
@@ -5201,6 +5490,184 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
     }
 }
 
+VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
+    PFN_vkCreateGraphicsPipelines                                     func,
+    VkResult                                                          original_result,
+    const DeviceInfo*                                                 device_info,
+    const PipelineCacheInfo*                                          pipeline_cache_info,
+    uint32_t                                                          createInfoCount,
+    const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                 pPipelines)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    GFXRECON_ASSERT((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr));
+
+    const VkGraphicsPipelineCreateInfo* create_infos = pCreateInfos->GetPointer();
+
+    if (omitted_pipeline_cache_data_)
+    {
+        AllowCompileDuringPipelineCreation(createInfoCount, create_infos);
+    }
+
+    return func(device_info->handle,
+                GetPipelineCreationCache(device_info, pipeline_cache_info),
+                createInfoCount,
+                create_infos,
+                GetAllocationCallbacks(pAllocator),
+                pPipelines->GetHandlePointer());
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
+    PFN_vkCreateComputePipelines                                     func,
+    VkResult                                                         original_result,
+    const DeviceInfo*                                                device_info,
+    const PipelineCacheInfo*                                         pipeline_cache_info,
+    uint32_t                                                         createInfoCount,
+    const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                pPipelines)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    GFXRECON_ASSERT((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr));
+
+    const VkComputePipelineCreateInfo* create_infos = pCreateInfos->GetPointer();
+
+    if (omitted_pipeline_cache_data_)
+    {
+        AllowCompileDuringPipelineCreation(createInfoCount, create_infos);
+    }
+
+    return func(device_info->handle,
+                GetPipelineCreationCache(device_info, pipeline_cache_info),
+                createInfoCount,
+                create_infos,
+                GetAllocationCallbacks(pAllocator),
+                pPipelines->GetHandlePointer());
+}
+
+VkPipelineCache VulkanReplayConsumerBase::GetPipelineCreationCache(const DeviceInfo*        device_info,
+                                                                   const PipelineCacheInfo* pipeline_cache_info)
+{
+    GFXRECON_ASSERT(device_info != nullptr);
+
+    VkPipelineCache pipeline_cache   = (pipeline_cache_info != nullptr) ? pipeline_cache_info->handle : VK_NULL_HANDLE;
+    bool            use_replay_cache = use_pipeline_cache_files_ || (pipeline_cache == VK_NULL_HANDLE);
+
+    if (pipeline_prefetcher_ != nullptr)
+    {
+        // Every call is claimed, so that the prefetcher can release it.
+        use_replay_cache = pipeline_prefetcher_->ClaimPipelines(block_index_) || use_replay_cache;
+    }
+
+    // When the replay cache is used instead of the application's cache, the application's cache does not receive the
+    // pipelines. Only the cache data retrieved by replay is affected by this.
+    if (use_replay_cache && (device_info->replay_pipeline_cache != VK_NULL_HANDLE))
+    {
+        pipeline_cache = device_info->replay_pipeline_cache;
+    }
+
+    return pipeline_cache;
+}
+
+void VulkanReplayConsumerBase::CreateReplayPipelineCache(const PhysicalDeviceInfo* physical_device_info,
+                                                         VkDevice                  device,
+                                                         DeviceInfo*               device_info)
+{
+    GFXRECON_ASSERT((physical_device_info != nullptr) && (device_info != nullptr));
+
+    VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+    std::vector<uint8_t>      initial_data;
+
+    if (use_pipeline_cache_files_)
+    {
+        auto replay_device_info = physical_device_info->replay_device_info;
+        GFXRECON_ASSERT(replay_device_info != nullptr);
+
+        if (replay_device_info->properties == nullptr)
+        {
+            auto table = GetInstanceTable(physical_device_info->handle);
+            GFXRECON_ASSERT(table != nullptr);
+
+            replay_device_info->properties = std::make_unique<VkPhysicalDeviceProperties>();
+            table->GetPhysicalDeviceProperties(physical_device_info->handle, replay_device_info->properties.get());
+        }
+
+        device_info->replay_pipeline_cache_path = pipeline_cache_util::GetPipelineCacheFilePath(
+            options_.pipeline_cache_dir, *replay_device_info->properties, capture_pipeline_hash_);
+
+        // The driver validates the header of the data, and ignores data that it cannot use.
+        if (pipeline_cache_util::ReadPipelineCacheFile(device_info->replay_pipeline_cache_path, &initial_data))
+        {
+            GFXRECON_LOG_INFO("Loaded pipeline cache file %s", device_info->replay_pipeline_cache_path.c_str());
+
+            create_info.initialDataSize = initial_data.size();
+            create_info.pInitialData    = initial_data.data();
+        }
+    }
+
+    auto device_table = GetDeviceTable(device);
+    GFXRECON_ASSERT(device_table != nullptr);
+
+    if (device_table->CreatePipelineCache(device, &create_info, nullptr, &device_info->replay_pipeline_cache) !=
+        VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING("Failed to create the replay pipeline cache");
+        device_info->replay_pipeline_cache = VK_NULL_HANDLE;
+    }
+}
+
+void VulkanReplayConsumerBase::DestroyReplayPipelineCache(const DeviceInfo* device_info)
+{
+    GFXRECON_ASSERT(device_info != nullptr);
+
+    if (device_info->replay_pipeline_cache == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    VkDevice device       = device_info->handle;
+    auto     device_table = GetDeviceTable(device);
+    GFXRECON_ASSERT(device_table != nullptr);
+
+    if (!device_info->replay_pipeline_cache_path.empty())
+    {
+        // The cache was created with the data from the file, so the data that is saved also includes the pipelines of
+        // previous replays that were not compiled by this replay.
+        size_t               data_size = 0;
+        std::vector<uint8_t> data;
+
+        VkResult result =
+            device_table->GetPipelineCacheData(device, device_info->replay_pipeline_cache, &data_size, nullptr);
+
+        if ((result == VK_SUCCESS) && (data_size > 0))
+        {
+            data.resize(data_size);
+            result = device_table->GetPipelineCacheData(
+                device, device_info->replay_pipeline_cache, &data_size, data.data());
+            data.resize(data_size);
+        }
+
+        if ((result == VK_SUCCESS) && !data.empty())
+        {
+            if (!util::filepath::IsDirectory(options_.pipeline_cache_dir))
+            {
+                util::filepath::MakeDirectory(options_.pipeline_cache_dir);
+            }
+
+            if (!pipeline_cache_util::WritePipelineCacheFile(device_info->replay_pipeline_cache_path, data))
+            {
+                GFXRECON_LOG_WARNING("Failed to write pipeline cache file %s",
+                                     device_info->replay_pipeline_cache_path.c_str());
+            }
+        }
+    }
+
+    device_table->DestroyPipelineCache(device, device_info->replay_pipeline_cache, nullptr);
+}
+
 VkResult VulkanReplayConsumerBase::OverrideResetDescriptorPool(PFN_vkResetDescriptorPool  func,
                                                                VkResult                   original_result,
                                                                const DeviceInfo*          device_info,
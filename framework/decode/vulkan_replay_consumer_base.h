@@ -32,6 +32,7 @@
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_object_info_table.h"
+#include "decode/vulkan_pipeline_prefetcher.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_tracking_consumer.h"
@@ -43,6 +44,7 @@
 #include "generated/generated_vulkan_consumer.h"
 #include "graphics/fps_info.h"
 #include "util/defines.h"
+#include "util/hash.h"
 #include "util/logging.h"
 
 #include "application/application.h"
@@ -82,8 +84,37 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
 
+    // Returns true if the function call only records commands to a command buffer, and retrieves the ID of the command
+    // pool that the command buffer was allocated from. These calls may be replayed on a separate thread for each
+    // captured thread, as long as the calls for each command pool are replayed in order and complete before the command
+    // buffer is submitted. Used as the FileProcessor threaded call filter.
+    bool GetCommandBufferCallPool(format::ApiCallId call_id,
+                                  const uint8_t*    parameter_buffer,
+                                  size_t            buffer_size,
+                                  format::HandleId* pool_id) const;
+
+    // Returns false for the command recording calls that access replay state that is not owned by the command buffer
+    // that the call records to, which must be replayed on the thread that reads the capture file.
+    virtual bool SupportsThreadedDecoding(format::ApiCallId call_id) override;
+
+    // Start compiling the pipelines of upcoming pipeline creation calls from the capture file on worker threads, up to
+    // VulkanReplayOptions::pipeline_prefetch_distance blocks ahead of replay. Must be called before the first device
+    // is created.
+    void StartPipelinePrefetch(const std::string& filename);
+
+    // Load the replay pipeline cache of each device from VulkanReplayOptions::pipeline_cache_dir when the device is
+    // created, and save it when the device is destroyed. The cache files are keyed by the pipeline creation calls of
+    // the capture file, which are read before replay. Must be called before the first device is created.
+    void EnablePipelineCacheFiles(const std::string& filename);
+
+    virtual void SetCurrentBlockIndex(uint64_t block_index) override;
+
     virtual void WaitDevicesIdle() override;
 
+    virtual void ProcessFrameLoopBegin(uint64_t frame_number) override;
+
+    virtual void ProcessFrameLoopRestart(uint64_t frame_number) override;
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) override;
@@ -744,6 +775,26 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          const StructPointerDecoder<Decoded_VkAllocationCallbacks>*     pAllocator,
                                          HandlePointerDecoder<VkPipelineCache>*                         pPipelineCache);
 
+    VkResult OverrideCreateGraphicsPipelines(
+        PFN_vkCreateGraphicsPipelines                                     func,
+        VkResult                                                          original_result,
+        const DeviceInfo*                                                 device_info,
+        const PipelineCacheInfo*                                          pipeline_cache_info,
+        uint32_t                                                          createInfoCount,
+        const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                 pPipelines);
+
+    VkResult OverrideCreateComputePipelines(
+        PFN_vkCreateComputePipelines                                     func,
+        VkResult                                                         original_result,
+        const DeviceInfo*                                                device_info,
+        const PipelineCacheInfo*                                         pipeline_cache_info,
+        uint32_t                                                         createInfoCount,
+        const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                pPipelines);
+
     VkResult OverrideResetDescriptorPool(PFN_vkResetDescriptorPool  func,
                                          VkResult                   original_result,
                                          const DeviceInfo*          device_info,
@@ -1042,6 +1093,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
   private:
     void RaiseFatalError(const char* message) const;
 
+    // Returns true when state snapshot commands must be kept, so they can be processed again for a looped frame range.
+    bool IsKeepingFrameLoopState() const
+    {
+        return (loading_trim_state_ && (options_.measurement_range_loop_count > 1));
+    }
+
     void InitializeLoader();
 
     void AddInstanceTable(VkInstance instance);
@@ -1138,6 +1195,18 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                   VkImage*                 image,
                                   ImageInfo*               image_info);
 
+    // Returns the pipeline cache that a pipeline creation call should use: the replay pipeline cache of the device when
+    // the pipelines of the call were compiled into it ahead of replay, or when the call does not use a pipeline cache.
+    VkPipelineCache GetPipelineCreationCache(const DeviceInfo*        device_info,
+                                             const PipelineCacheInfo* pipeline_cache_info);
+
+    void CreateReplayPipelineCache(const PhysicalDeviceInfo* physical_device_info,
+                                   VkDevice                  device,
+                                   DeviceInfo*               device_info);
+
+    // Saves the replay pipeline cache of the device to its cache file before destroying it.
+    void DestroyReplayPipelineCache(const DeviceInfo* device_info);
+
     void ProcessCreateInstanceDebugCallbackInfo(const Decoded_VkInstanceCreateInfo* instance_info);
 
     void ProcessSwapchainFullScreenExclusiveInfo(const Decoded_VkSwapchainCreateInfoKHR* swapchain_info);
@@ -1197,6 +1266,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     HardwareBufferMemoryMap                                          hardware_buffer_memory_info_;
     std::unique_ptr<ScreenshotHandler>                               screenshot_handler_;
     std::unique_ptr<VulkanSwapchain>                                 swapchain_;
+    std::unique_ptr<VulkanPipelinePrefetcher>                        pipeline_prefetcher_;
     std::string                                                      screenshot_file_prefix_;
     graphics::FpsInfo*                                               fps_info_;
 
@@ -1211,6 +1281,13 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     std::unordered_set<VkSemaphore> shadow_semaphores_;
     std::unordered_set<VkFence>     shadow_fences_;
 
+    // State that is restored before each repetition of a looped frame range. The fence and event status is recorded
+    // when the loop begins. The memory and resource contents from the state snapshot of a trimmed capture are kept
+    // while it is loaded, as commands that are processed again.
+    std::unordered_map<format::HandleId, bool> frame_loop_fence_signaled_;
+    std::unordered_map<format::HandleId, bool> frame_loop_event_set_;
+    std::vector<std::function<void()>>         frame_loop_state_commands_;
+
     // Used to track allocated external memory if replay uses VkImportMemoryHostPointerInfoEXT
     std::unordered_map<VkDeviceMemory, std::pair<void*, size_t>> external_memory_;
 
@@ -1244,6 +1321,10 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     void*                capture_pipeline_cache_data_;
     bool                 matched_replay_cache_data_exist_ = false;
     std::vector<uint8_t> matched_replay_cache_data_;
+
+    // Key of the replay pipeline cache files, which are used when the pipeline cache directory option is set.
+    bool                use_pipeline_cache_files_ = false;
+    util::hash::Hash128 capture_pipeline_hash_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -59,6 +59,8 @@ struct VulkanReplayOptions : public ReplayOptions
     bool                         offscreen_swapchain_frame_boundary{ false };
     util::SwapchainOption        swapchain_option{ util::SwapchainOption::kVirtual };
     bool                         virtual_swapchain_skip_blit{ false };
+    bool                         threaded_command_recording{ false };
+    uint32_t                     pipeline_prefetch_distance{ 0 };
     int32_t                      override_gpu_group_index{ -1 };
     int32_t                      surface_index{ -1 };
     CreateResourceAllocator      create_resource_allocator;
@@ -69,6 +71,7 @@ struct VulkanReplayOptions : public ReplayOptions
     uint32_t                     screenshot_width, screenshot_height;
     float                        screenshot_scale;
     std::string                  replace_dir;
+    std::string                  pipeline_cache_dir;
     SkipGetFenceStatus           skip_get_fence_status{ SkipGetFenceStatus::NoSkip };
     std::vector<util::UintRange> skip_get_fence_ranges;
 };
@@ -26,13 +26,22 @@
 #include "decode/copy_shaders.h"
 #include "util/platform.h"
 
+#include "Vulkan-Utility-Libraries/vk_format_utils.h"
+
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Resource data is written to a persistently mapped staging ring, and the copies from the ring are recorded to shared
+// command buffers.  The command buffers are submitted each time kStagingRingSubmitCount-th of the ring has been
+// written, and replay only waits for the copies to complete when the ring wraps or resource initialization ends.
+const VkDeviceSize kMinStagingRingSize     = 32 * 1024 * 1024;
+const VkDeviceSize kStagingRingSubmitCount = 4;
+
 VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*                       device_info,
                                                      VkDeviceSize                            max_copy_size,
                                                      const VkPhysicalDeviceMemoryProperties& memory_properties,
@@ -41,8 +50,9 @@ VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*
                                                      const encode::VulkanDeviceTable*        device_table) :
     device_(device_info->handle),
     staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
-    draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
-    draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
+    staging_data_(nullptr), staging_size_(std::max(max_copy_size, kMinStagingRingSize)), staging_offset_(0),
+    staging_submit_offset_(0), staging_coherent_(false), draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE),
+    draw_set_layout_(VK_NULL_HANDLE), draw_set_(VK_NULL_HANDLE), have_shader_stencil_write_(have_shader_stencil_write),
     resource_allocator_(resource_allocator), device_table_(device_table), device_info_(device_info)
 {
     assert((device_info != nullptr) && (device_info->handle != VK_NULL_HANDLE) &&
@@ -61,11 +71,24 @@ VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    // Copies that are still pending must complete before the staging ring and command buffers are destroyed.
+    Flush();
+
     for (const auto& entry : command_exec_objects_)
     {
+        for (const auto& batch : entry.second.available_batches)
+        {
+            device_table_->DestroyFence(device_, batch.fence, nullptr);
+        }
+
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
     }
 
+    if (staging_data_ != nullptr)
+    {
+        resource_allocator_->UnmapResourceMemoryDirect(staging_buffer_data_);
+    }
+
     if (staging_buffer_ != VK_NULL_HANDLE)
     {
         resource_allocator_->DestroyBufferDirect(staging_buffer_, nullptr, staging_buffer_data_);
@@ -110,33 +133,68 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkResult result = VK_SUCCESS;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    if (data_size <= staging_size_)
+    {
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        VkDeviceSize    staging_offset = 0;
 
-    if (result == VK_SUCCESS)
+        result = AcquireStagingRange(data_size, sizeof(uint32_t), &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(staging_data_ + staging_offset, copy_size, data, copy_size);
+
+            std::vector<VkBufferCopy> staging_regions(regions, regions + region_count);
+            for (auto& region : staging_regions)
+            {
+                region.srcOffset += staging_offset;
+            }
+
+            device_table_->CmdCopyBuffer(command_buffer, staging_buffer_, buffer, region_count, staging_regions.data());
+
+            result = SubmitStagingBudget();
+        }
+    }
+    else
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        // The data does not fit in the staging ring, and is copied with a temporary staging buffer.
+        VkQueue                               queue               = VK_NULL_HANDLE;
+        VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
 
             if (result == VK_SUCCESS)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
+                result = BeginCommandBuffer(command_buffer);
 
-                result = ExecuteCommandBuffer(queue, command_buffer);
-            }
+                if (result == VK_SUCCESS)
+                {
+                    device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
+                    device_table_->EndCommandBuffer(command_buffer);
 
-            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+                    result = ExecuteCommandBuffer(queue, command_buffer);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            }
         }
     }
 
@@ -159,34 +217,85 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                                     uint32_t                 level_count,
                                                     const VkBufferImageCopy* level_copies)
 {
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                        (sample_count == VK_SAMPLE_COUNT_1_BIT);
+    bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                           (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+    bool use_depth_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+    bool use_stencil_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+    bool use_pixel_shader =
+        !use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D);
 
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+    VkResult result = VK_SUCCESS;
 
-    if (result == VK_SUCCESS)
+    if (!use_pixel_shader && (data_size <= staging_size_))
     {
-        result = LoadData(data_size, data, staging_buffer_data);
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        VkDeviceSize    staging_offset = 0;
+
+        // Buffer offsets for image copies must be a multiple of both the texel block size and 4.
+        VkDeviceSize alignment =
+            std::lcm(static_cast<VkDeviceSize>(std::max(1u, vkuFormatElementSizeWithAspect(format, aspect))),
+                     static_cast<VkDeviceSize>(4));
+
+        result = AcquireStagingRange(data_size, alignment, &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+        }
 
         if (result == VK_SUCCESS)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(staging_data_ + staging_offset, copy_size, data, copy_size);
+
+            std::vector<VkBufferImageCopy> staging_copies(level_copies, level_copies + level_count);
+            for (auto& copy : staging_copies)
+            {
+                copy.bufferOffset += staging_offset;
+            }
+
+            RecordBufferToImageCopy(command_buffer,
+                                    staging_buffer_,
+                                    image,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    staging_copies.data());
+
+            result = SubmitStagingBudget();
+        }
+    }
+    else
+    {
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        // The copy is submitted immediately, and must be ordered after any pending copies to the same image, which
+        // may have been recorded for the other aspect of a depth-stencil image.  This also makes the staging ring
+        // available to the copy when the data fits.
+        result = Flush();
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            if (use_pixel_shader)
             {
                 result = PixelShaderImageCopy(queue_family_index,
                                               staging_buffer,
@@ -215,9 +324,9 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                            level_count,
                                            level_copies);
             }
-        }
 
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+        }
     }
 
     return result;
@@ -232,52 +341,60 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
                                                     uint32_t              layer_count,
                                                     uint32_t              level_count)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
     if (result == VK_SUCCESS)
     {
-        result = BeginCommandBuffer(command_buffer);
+        VkImageLayout      old_layout        = initial_layout;
+        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
 
-        if (result == VK_SUCCESS)
-        {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
+        VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = 0;
+        memory_barrier.dstAccessMask                   = 0;
+        memory_barrier.oldLayout                       = old_layout;
+        memory_barrier.newLayout                       = final_layout;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = image;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = level_count;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = layer_count;
+
+        // Transfer stages order the transition with the other initialization commands recorded for the same image.
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+    }
 
-            device_table_->EndCommandBuffer(command_buffer);
+    return result;
+}
 
-            result = ExecuteCommandBuffer(queue, command_buffer);
-        }
+VkResult VulkanResourceInitializer::Flush()
+{
+    VkResult result      = SubmitBatches();
+    VkResult wait_result = WaitBatches();
+
+    if (result == VK_SUCCESS)
+    {
+        result = wait_result;
     }
 
+    // All copies from the staging ring have completed, so it can be reused from the start.
+    staging_offset_        = 0;
+    staging_submit_offset_ = 0;
+
     return result;
 }
 
@@ -347,6 +464,170 @@ VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue
     return result;
 }
 
+VkResult VulkanResourceInitializer::GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer)
+{
+    assert(command_buffer != nullptr);
+
+    VkQueue         queue               = VK_NULL_HANDLE;
+    VkCommandBuffer exec_command_buffer = VK_NULL_HANDLE;
+
+    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &exec_command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        CommandExecObjects& exec_objects = command_exec_objects_[queue_family_index];
+
+        if (exec_objects.recording_batch.command_buffer == VK_NULL_HANDLE)
+        {
+            BatchCommands batch = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+
+            if (!exec_objects.available_batches.empty())
+            {
+                batch = exec_objects.available_batches.back();
+                exec_objects.available_batches.pop_back();
+            }
+            else
+            {
+                VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+                alloc_info.pNext                       = nullptr;
+                alloc_info.commandPool                 = exec_objects.command_pool;
+                alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+                alloc_info.commandBufferCount          = 1;
+
+                result = device_table_->AllocateCommandBuffers(device_, &alloc_info, &batch.command_buffer);
+
+                if (result == VK_SUCCESS)
+                {
+                    VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+                    fence_info.pNext             = nullptr;
+                    fence_info.flags             = 0;
+
+                    result = device_table_->CreateFence(device_, &fence_info, nullptr, &batch.fence);
+
+                    if (result != VK_SUCCESS)
+                    {
+                        device_table_->FreeCommandBuffers(device_, exec_objects.command_pool, 1, &batch.command_buffer);
+                    }
+                }
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                result = BeginCommandBuffer(batch.command_buffer);
+
+                if (result == VK_SUCCESS)
+                {
+                    exec_objects.recording_batch = batch;
+                }
+                else
+                {
+                    exec_objects.available_batches.push_back(batch);
+                }
+            }
+        }
+
+        (*command_buffer) = exec_objects.recording_batch.command_buffer;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitBatches()
+{
+    VkResult result  = VK_SUCCESS;
+    bool     flushed = false;
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& exec_objects = entry.second;
+        BatchCommands       batch        = exec_objects.recording_batch;
+
+        if (batch.command_buffer != VK_NULL_HANDLE)
+        {
+            exec_objects.recording_batch = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+
+            if (!flushed)
+            {
+                FlushStagingData();
+                flushed = true;
+            }
+
+            VkResult submit_result = device_table_->EndCommandBuffer(batch.command_buffer);
+
+            if (submit_result == VK_SUCCESS)
+            {
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.pNext                = nullptr;
+                submit_info.waitSemaphoreCount   = 0;
+                submit_info.pWaitSemaphores      = nullptr;
+                submit_info.pWaitDstStageMask    = nullptr;
+                submit_info.commandBufferCount   = 1;
+                submit_info.pCommandBuffers      = &batch.command_buffer;
+                submit_info.signalSemaphoreCount = 0;
+                submit_info.pSignalSemaphores    = nullptr;
+
+                submit_result = device_table_->QueueSubmit(exec_objects.queue, 1, &submit_info, batch.fence);
+            }
+
+            if (submit_result == VK_SUCCESS)
+            {
+                exec_objects.submitted_batches.push_back(batch);
+            }
+            else
+            {
+                // The command buffer is reset when it is next recorded.
+                exec_objects.available_batches.push_back(batch);
+                result = submit_result;
+            }
+        }
+    }
+
+    staging_submit_offset_ = staging_offset_;
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::WaitBatches()
+{
+    VkResult result = VK_SUCCESS;
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& exec_objects = entry.second;
+
+        if (!exec_objects.submitted_batches.empty())
+        {
+            std::vector<VkFence> fences;
+            for (const auto& batch : exec_objects.submitted_batches)
+            {
+                fences.push_back(batch.fence);
+            }
+
+            uint32_t fence_count = static_cast<uint32_t>(fences.size());
+
+            VkResult wait_result = device_table_->WaitForFences(
+                device_, fence_count, fences.data(), VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+            if (wait_result == VK_SUCCESS)
+            {
+                wait_result = device_table_->ResetFences(device_, fence_count, fences.data());
+            }
+
+            if (wait_result != VK_SUCCESS)
+            {
+                result = wait_result;
+            }
+
+            exec_objects.available_batches.insert(exec_objects.available_batches.end(),
+                                                  exec_objects.submitted_batches.begin(),
+                                                  exec_objects.submitted_batches.end());
+            exec_objects.submitted_batches.clear();
+        }
+    }
+
+    return result;
+}
+
 VkResult VulkanResourceInitializer::GetDrawDescriptorObjects(VkSampler*             sampler,
                                                              VkDescriptorSetLayout* set_layout,
                                                              VkDescriptorSet*       set)
@@ -921,97 +1202,215 @@ void VulkanResourceInitializer::DestroyFramebufferResources(VkImageView view, Vk
     device_table_->DestroyImageView(device_, view, nullptr);
 }
 
-VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
-                                                         VkBuffer*                              buffer,
-                                                         VkDeviceSize                           size,
-                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
-                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+VkResult VulkanResourceInitializer::CreateStagingBuffer(VkDeviceSize                           size,
+                                                        VkDeviceMemory*                        memory,
+                                                        VkBuffer*                              buffer,
+                                                        VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                        VulkanResourceAllocator::ResourceData* allocator_buffer_data,
+                                                        VkMemoryPropertyFlags*                 memory_property_flags)
 {
     assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
-           (allocator_buffer_data != nullptr));
+           (allocator_buffer_data != nullptr) && (memory_property_flags != nullptr));
 
-    VkResult result = VK_SUCCESS;
+    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-    // Create the reusable staging_buffer_ object, with size equal to max_copy_size_, on first acquire, if the requested
-    // size is less than or equal to max_copy_size_.  It the requested size is larger than max_copy_size_, create a
-    // temporary staging buffer that will be destroyed on release.
-    if ((staging_buffer_ == VK_NULL_HANDLE) || (size > max_copy_size_))
-    {
-        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
 
-        VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
-        create_info.pNext                 = nullptr;
-        create_info.flags                 = 0;
-        create_info.size                  = std::max(size, max_copy_size_);
-        create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        create_info.queueFamilyIndexCount = 0;
-        create_info.pQueueFamilyIndices   = nullptr;
+    VkResult result =
+        resource_allocator_->CreateBufferDirect(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
 
-        result = resource_allocator_->CreateBufferDirect(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements memory_requirements;
+        device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
 
-        if (result == VK_SUCCESS)
-        {
-            VkMemoryRequirements memory_requirements;
-            device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
+        // Prefer coherent memory, which does not need to be flushed after the staging data is written.
+        uint32_t memory_type_index =
+            GetMemoryTypeIndex(memory_requirements.memoryTypeBits,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-            uint32_t memory_type_index =
+        if (memory_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            memory_type_index =
                 GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
+
+        assert(memory_type_index != std::numeric_limits<uint32_t>::max());
 
-            assert(memory_type_index != std::numeric_limits<uint32_t>::max());
+        // Allocate the memory for the buffer.
+        VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData staging_memory_data = 0;
 
-            // Allocate the memory for the buffer.
-            VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
-            VulkanResourceAllocator::MemoryData staging_memory_data = 0;
+        VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        alloc_info.pNext                = nullptr;
+        alloc_info.allocationSize       = memory_requirements.size;
+        alloc_info.memoryTypeIndex      = memory_type_index;
 
-            VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
-            alloc_info.pNext                = nullptr;
-            alloc_info.allocationSize       = memory_requirements.size;
-            alloc_info.memoryTypeIndex      = memory_type_index;
+        result = resource_allocator_->AllocateMemoryDirect(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
 
-            result =
-                resource_allocator_->AllocateMemoryDirect(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
+        if (result == VK_SUCCESS)
+        {
+            result = resource_allocator_->BindBufferMemoryDirect(
+                staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, memory_property_flags);
+        }
 
-            if (result == VK_SUCCESS)
+        if (result == VK_SUCCESS)
+        {
+            (*memory)                = staging_memory;
+            (*buffer)                = staging_buffer;
+            (*allocator_memory_data) = staging_memory_data;
+            (*allocator_buffer_data) = staging_buffer_data;
+        }
+        else
+        {
+            resource_allocator_->DestroyBufferDirect(staging_buffer, nullptr, staging_buffer_data);
+
+            if (staging_memory != VK_NULL_HANDLE)
             {
-                VkMemoryPropertyFlags flags;
-                result = resource_allocator_->BindBufferMemoryDirect(
-                    staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
+                resource_allocator_->FreeMemoryDirect(staging_memory, nullptr, staging_memory_data);
             }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::CreateStagingRing()
+{
+    VkResult result = VK_SUCCESS;
+
+    if (staging_buffer_ == VK_NULL_HANDLE)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = CreateStagingBuffer(
+            staging_size_, &staging_memory_, &staging_buffer_, &staging_memory_data_, &staging_buffer_data_, &flags);
+
+        if (result == VK_SUCCESS)
+        {
+            staging_coherent_ =
+                ((flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+            void* mapped_memory = nullptr;
+            result =
+                resource_allocator_->MapResourceMemoryDirect(staging_size_, 0, &mapped_memory, staging_buffer_data_);
 
             if (result == VK_SUCCESS)
             {
-                (*memory)                = staging_memory;
-                (*buffer)                = staging_buffer;
-                (*allocator_memory_data) = staging_memory_data;
-                (*allocator_buffer_data) = staging_buffer_data;
-
-                if (size <= max_copy_size_)
-                {
-                    staging_memory_      = staging_memory;
-                    staging_buffer_      = staging_buffer;
-                    staging_memory_data_ = staging_memory_data;
-                    staging_buffer_data_ = staging_buffer_data;
-                }
+                staging_data_ = static_cast<uint8_t*>(mapped_memory);
             }
             else
             {
-                resource_allocator_->DestroyBufferDirect(staging_buffer, nullptr, staging_buffer_data);
+                resource_allocator_->DestroyBufferDirect(staging_buffer_, nullptr, staging_buffer_data_);
+                resource_allocator_->FreeMemoryDirect(staging_memory_, nullptr, staging_memory_data_);
 
-                if ((*memory) != VK_NULL_HANDLE)
-                {
-                    resource_allocator_->FreeMemoryDirect(staging_memory, nullptr, staging_memory_data);
-                }
+                staging_memory_      = VK_NULL_HANDLE;
+                staging_memory_data_ = 0;
+                staging_buffer_      = VK_NULL_HANDLE;
+                staging_buffer_data_ = 0;
             }
         }
     }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::AcquireStagingRange(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* offset)
+{
+    assert((size <= staging_size_) && (alignment > 0) && (offset != nullptr));
+
+    VkResult result = CreateStagingRing();
+
+    if (result == VK_SUCCESS)
+    {
+        VkDeviceSize aligned_offset = ((staging_offset_ + alignment - 1) / alignment) * alignment;
+
+        if ((aligned_offset + size) > staging_size_)
+        {
+            // The ring wraps, and its start can only be reused after all of the pending copies have completed.
+            result         = Flush();
+            aligned_offset = 0;
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            (*offset)       = aligned_offset;
+            staging_offset_ = aligned_offset + size;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitStagingBudget()
+{
+    VkResult result = VK_SUCCESS;
+
+    // Submit the recorded copies without waiting for them, so that the GPU copies the staged data while the following
+    // resources are loaded to the ring.
+    if ((staging_offset_ - staging_submit_offset_) >= (staging_size_ / kStagingRingSubmitCount))
+    {
+        result = SubmitBatches();
+    }
+
+    return result;
+}
+
+void VulkanResourceInitializer::FlushStagingData()
+{
+    if ((staging_data_ != nullptr) && !staging_coherent_)
+    {
+        VkMappedMemoryRange range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        range.pNext               = nullptr;
+        range.memory              = staging_memory_;
+        range.offset              = 0;
+        range.size                = VK_WHOLE_SIZE;
+
+        resource_allocator_->FlushMappedMemoryRangesDirect(1, &range, &staging_memory_data_);
+    }
+}
+
+VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
+                                                         VkBuffer*                              buffer,
+                                                         VkDeviceSize                           size,
+                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+{
+    assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
+           (allocator_buffer_data != nullptr));
+
+    VkResult result = VK_SUCCESS;
+
+    // Use the start of the staging ring, which must not have pending copies, if the requested size is less than or
+    // equal to the ring size.  If the requested size is larger than the ring, create a temporary staging buffer that
+    // will be destroyed on release.
+    if (size > staging_size_)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = CreateStagingBuffer(size, memory, buffer, allocator_memory_data, allocator_buffer_data, &flags);
+    }
     else
     {
-        (*memory)                = staging_memory_;
-        (*buffer)                = staging_buffer_;
-        (*allocator_memory_data) = staging_memory_data_;
-        (*allocator_buffer_data) = staging_buffer_data_;
+        assert((staging_offset_ == 0) && (staging_submit_offset_ == 0));
+
+        result = CreateStagingRing();
+
+        if (result == VK_SUCCESS)
+        {
+            (*memory)                = staging_memory_;
+            (*buffer)                = staging_buffer_;
+            (*allocator_memory_data) = staging_memory_data_;
+            (*allocator_buffer_data) = staging_buffer_data_;
+        }
     }
 
     return result;
@@ -1032,7 +1431,18 @@ VulkanResourceInitializer::AcquireInitializedStagingBuffer(VkDeviceSize
     {
         assert((staging_memory != nullptr) && (staging_memory_data != nullptr));
 
-        result = LoadData(data_size, data, *staging_buffer_data);
+        if ((*staging_buffer) == staging_buffer_)
+        {
+            // The staging ring is persistently mapped.
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(staging_data_, copy_size, data, copy_size);
+            FlushStagingData();
+        }
+        else
+        {
+            result = LoadData(data_size, data, *staging_buffer_data);
+        }
     }
 
     return result;
@@ -1165,6 +1575,74 @@ uint32_t VulkanResourceInitializer::GetMemoryTypeIndex(uint32_t type_bits, VkMem
     return memory_type_index;
 }
 
+void VulkanResourceInitializer::RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                                        VkBuffer                 source,
+                                                        VkImage                  destination,
+                                                        VkFormat                 format,
+                                                        VkImageAspectFlagBits    aspect,
+                                                        VkImageLayout            initial_layout,
+                                                        VkImageLayout            final_layout,
+                                                        uint32_t                 layer_count,
+                                                        uint32_t                 level_count,
+                                                        const VkBufferImageCopy* level_copies)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = 0;
+    memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = destination;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    // The barriers use transfer stages, instead of the top and bottom of the pipe, to order the copy with the other
+    // initialization commands recorded for the same image, such as the copy to the other aspect of a depth-stencil
+    // image.
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+
+    device_table_->CmdCopyBufferToImage(
+        command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+
+    if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+        (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+    {
+        memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask = 0;
+        memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        memory_barrier.newLayout     = final_layout;
+
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+    }
+}
+
 VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 queue_family_index,
                                                       VkBuffer                 source,
                                                       VkImage                  destination,
@@ -1183,62 +1661,20 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
 
     if (result == VK_SUCCESS)
     {
-        VkImageLayout      old_layout        = initial_layout;
-        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
         result = BeginCommandBuffer(command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = destination;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
-
-            device_table_->CmdCopyBufferToImage(
-                command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
-
-            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
-            {
-                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                memory_barrier.dstAccessMask = 0;
-                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                memory_barrier.newLayout     = final_layout;
-
-                device_table_->CmdPipelineBarrier(command_buffer,
-                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                  0,
-                                                  0,
-                                                  nullptr,
-                                                  0,
-                                                  nullptr,
-                                                  1,
-                                                  &memory_barrier);
-            }
+            RecordBufferToImageCopy(command_buffer,
+                                    source,
+                                    destination,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    level_copies);
 
             device_table_->EndCommandBuffer(command_buffer);
 
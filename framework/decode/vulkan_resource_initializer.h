@@ -84,9 +84,18 @@ class VulkanResourceInitializer
                              uint32_t              layer_count,
                              uint32_t              level_count);
 
+    // Submit all recorded initialization commands and wait for them to complete.
+    VkResult Flush();
+
   private:
     VkResult GetCommandExecObjects(uint32_t queue_family_index, VkQueue* queue, VkCommandBuffer* command_buffer);
 
+    VkResult GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
+    VkResult SubmitBatches();
+
+    VkResult WaitBatches();
+
     VkResult GetDrawDescriptorObjects(VkSampler* sampler, VkDescriptorSetLayout* set_layout, VkDescriptorSet* set);
 
     VkResult CreateDrawObjects(VkFormat              format,
@@ -122,6 +131,21 @@ class VulkanResourceInitializer
 
     void DestroyFramebufferResources(VkImageView view, VkFramebuffer framebuffer);
 
+    VkResult CreateStagingBuffer(VkDeviceSize                           size,
+                                 VkDeviceMemory*                        memory,
+                                 VkBuffer*                              buffer,
+                                 VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                 VulkanResourceAllocator::ResourceData* allocator_buffer_data,
+                                 VkMemoryPropertyFlags*                 memory_property_flags);
+
+    VkResult CreateStagingRing();
+
+    VkResult AcquireStagingRange(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* offset);
+
+    VkResult SubmitStagingBudget();
+
+    void FlushStagingData();
+
     VkResult AcquireStagingBuffer(VkDeviceMemory*                        memory,
                                   VkBuffer*                              buffer,
                                   VkDeviceSize                           size,
@@ -151,6 +175,17 @@ class VulkanResourceInitializer
 
     uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags);
 
+    void RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                 VkBuffer                 source,
+                                 VkImage                  destination,
+                                 VkFormat                 format,
+                                 VkImageAspectFlagBits    aspect,
+                                 VkImageLayout            initial_layout,
+                                 VkImageLayout            final_layout,
+                                 uint32_t                 layer_count,
+                                 uint32_t                 level_count,
+                                 const VkBufferImageCopy* level_copies);
+
     VkResult BufferToImageCopy(uint32_t                 queue_family_index,
                                VkBuffer                 source,
                                VkImage                  destination,
@@ -177,11 +212,20 @@ class VulkanResourceInitializer
                                   const VkBufferImageCopy* level_copies);
 
   private:
-    struct CommandExecObjects
+    struct BatchCommands
     {
-        VkQueue         queue;
-        VkCommandPool   command_pool;
         VkCommandBuffer command_buffer;
+        VkFence         fence;
+    };
+
+    struct CommandExecObjects
+    {
+        VkQueue                    queue;
+        VkCommandPool              command_pool;
+        VkCommandBuffer            command_buffer;
+        BatchCommands              recording_batch{ VK_NULL_HANDLE, VK_NULL_HANDLE };
+        std::vector<BatchCommands> submitted_batches;
+        std::vector<BatchCommands> available_batches;
     };
 
     // Map queue family index to command pool, command buffer, and queue objects for command processing.
@@ -194,11 +238,15 @@ class VulkanResourceInitializer
     VulkanResourceAllocator::MemoryData   staging_memory_data_;
     VkBuffer                              staging_buffer_;
     VulkanResourceAllocator::ResourceData staging_buffer_data_;
+    uint8_t*                              staging_data_;
+    VkDeviceSize                          staging_size_;
+    VkDeviceSize                          staging_offset_;
+    VkDeviceSize                          staging_submit_offset_;
+    bool                                  staging_coherent_;
     VkSampler                             draw_sampler_;
     VkDescriptorPool                      draw_pool_;
     VkDescriptorSetLayout                 draw_set_layout_;
     VkDescriptorSet                       draw_set_;
-    VkDeviceSize                          max_copy_size_;
     VkPhysicalDeviceMemoryProperties      memory_properties_;
     bool                                  have_shader_stencil_write_;
     VulkanResourceAllocator*              resource_allocator_;
@@ -29,10 +29,12 @@
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
 #include "format/format_util.h"
+#include "util/async_file_output_stream.h"
 #include "util/compressor.h"
 #include "util/file_path.h"
 #include "util/date_time.h"
 #include "util/driver_info.h"
+#include "util/hash.h"
 #include "util/logging.h"
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
@@ -47,6 +49,25 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const uint32_t kFirstFrame           = 1;
 const size_t   kFileStreamBufferSize = 256 * 1024;
 
+// Compresses blocks that were queued for compression by the capture file writer's worker threads.
+class BlockCompressor : public util::AsyncFileOutputStream::BlockProcessor
+{
+  public:
+    BlockCompressor(format::CompressionType type) : compressor_(format::CreateCompressor(type)) {}
+
+    virtual void Process(std::vector<uint8_t>* block) override
+    {
+        if (compressor_ != nullptr)
+        {
+            format::CompressBlock(compressor_.get(), block, &compressed_block_);
+        }
+    }
+
+  private:
+    std::unique_ptr<util::Compressor> compressor_;
+    std::vector<uint8_t>              compressed_block_;
+};
+
 std::mutex                                     CaptureManager::ThreadData::count_lock_;
 format::ThreadId                               CaptureManager::ThreadData::thread_count_ = 0;
 std::unordered_map<uint64_t, format::ThreadId> CaptureManager::ThreadData::id_map_;
@@ -90,12 +111,14 @@ format::ThreadId CaptureManager::ThreadData::GetThreadId()
 }
 
 CaptureManager::CaptureManager(format::ApiFamilyId api_family) :
-    api_family_(api_family), force_file_flush_(false), timestamp_filename_(true),
-    memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
-    page_guard_track_ahb_memory_(false), page_guard_unblock_sigsegv_(false), page_guard_signal_handler_watcher_(false),
+    api_family_(api_family), force_file_flush_(false), async_write_(false), async_write_queue_size_(0),
+    compression_threads_(0), compression_threshold_(0), defer_compression_(false), dedup_fill_memory_(false),
+    timestamp_filename_(true), memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard),
+    page_guard_align_buffer_sizes_(false), page_guard_track_ahb_memory_(false), page_guard_unblock_sigsegv_(false),
+    page_guard_signal_handler_watcher_(false), page_guard_diff_pages_(false),
     page_guard_memory_mode_(kMemoryModeShadowInternal), trim_enabled_(false),
-    trim_boundary_(CaptureSettings::TrimBoundary::kUnknown), trim_current_range_(0), current_frame_(kFirstFrame),
-    queue_submit_count_(0), capture_mode_(kModeWrite), previous_hotkey_state_(false),
+    trim_boundary_(CaptureSettings::TrimBoundary::kUnknown), trim_readback_batch_size_(0), trim_current_range_(0),
+    current_frame_(kFirstFrame), queue_submit_count_(0), capture_mode_(kModeWrite), previous_hotkey_state_(false),
     previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed), debug_layer_(false),
     debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false), disable_dxr_(false),
     accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false), queue_zero_only_(false),
@@ -252,6 +275,11 @@ bool CaptureManager::Initialize(std::string base_filename, const CaptureSettings
     timestamp_filename_              = trace_settings.time_stamp_file;
     memory_tracking_mode_            = trace_settings.memory_tracking_mode;
     force_file_flush_                = trace_settings.force_flush;
+    async_write_                     = trace_settings.async_write;
+    async_write_queue_size_          = static_cast<size_t>(trace_settings.async_write_queue_size) * 1024 * 1024;
+    compression_threads_             = trace_settings.compression_threads;
+    compression_threshold_           = trace_settings.compression_threshold;
+    dedup_fill_memory_               = trace_settings.dedup_fill_memory;
     debug_layer_                     = trace_settings.debug_layer;
     debug_device_lost_               = trace_settings.debug_device_lost;
     screenshots_enabled_             = !trace_settings.screenshot_ranges.empty();
@@ -264,6 +292,7 @@ bool CaptureManager::Initialize(std::string base_filename, const CaptureSettings
     force_command_serialization_     = trace_settings.force_command_serialization;
     queue_zero_only_                 = trace_settings.queue_zero_only;
     allow_pipeline_compile_required_ = trace_settings.allow_pipeline_compile_required;
+    trim_readback_batch_size_        = static_cast<size_t>(trace_settings.trim_readback_batch_size) * 1024 * 1024;
 
     rv_annotation_info_.gpuva_mask      = trace_settings.rv_anotation_info.gpuva_mask;
     rv_annotation_info_.descriptor_mask = trace_settings.rv_anotation_info.descriptor_mask;
@@ -284,6 +313,15 @@ bool CaptureManager::Initialize(std::string base_filename, const CaptureSettings
             rv_annotation_info_.descriptor_mask);
     }
 
+    if (dedup_fill_memory_ && (memory_tracking_mode_ == CaptureSettings::kUserfaultfd))
+    {
+        // The userfaultfd signal handler parks application threads while modified memory is written to the file, which
+        // could deadlock with a parked thread that holds the lock used to order blob writes.
+        dedup_fill_memory_ = false;
+        GFXRECON_LOG_WARNING("Ignoring fill memory deduplication option, which is not supported with the userfaultfd "
+                             "memory tracking mode");
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::kPageGuard || memory_tracking_mode_ == CaptureSettings::kUserfaultfd)
     {
         page_guard_align_buffer_sizes_                  = trace_settings.page_guard_align_buffer_sizes;
@@ -292,6 +330,7 @@ bool CaptureManager::Initialize(std::string base_filename, const CaptureSettings
         page_guard_signal_handler_watcher_              = trace_settings.page_guard_signal_handler_watcher;
         page_guard_copy_on_map_                         = trace_settings.page_guard_copy_on_map;
         page_guard_signal_handler_watcher_max_restores_ = trace_settings.page_guard_signal_handler_watcher_max_restores;
+        page_guard_diff_pages_                          = trace_settings.page_guard_diff_pages;
         page_guard_separate_read_                       = trace_settings.page_guard_separate_read;
 
         bool use_external_memory = trace_settings.page_guard_external_memory;
@@ -425,6 +464,7 @@ bool CaptureManager::Initialize(std::string base_filename, const CaptureSettings
                                            trace_settings.page_guard_unblock_sigsegv,
                                            trace_settings.page_guard_signal_handler_watcher,
                                            trace_settings.page_guard_signal_handler_watcher_max_restores,
+                                           trace_settings.page_guard_diff_pages,
                                            mem_prot_mode);
         }
 
@@ -477,7 +517,10 @@ void CaptureManager::EndApiCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
-        if (compressor_ != nullptr)
+        // Small blocks rarely compress well enough to be worth the cost of compression.
+        bool compress = (compressor_ != nullptr) && (uncompressed_size >= compression_threshold_);
+
+        if (compress && !defer_compression_)
         {
             size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
             size_t compressed_size = compressor_->Compress(
@@ -515,7 +558,8 @@ void CaptureManager::EndApiCallCapture()
                 sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + uncompressed_size;
 
             WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize(),
+                        compress);
         }
     }
 }
@@ -533,7 +577,9 @@ void CaptureManager::EndMethodCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
-        if (compressor_ != nullptr)
+        bool compress = (compressor_ != nullptr) && (uncompressed_size >= compression_threshold_);
+
+        if (compress && !defer_compression_)
         {
             size_t header_size     = sizeof(format::CompressedMethodCallHeader);
             size_t compressed_size = compressor_->Compress(
@@ -575,7 +621,8 @@ void CaptureManager::EndMethodCallCapture()
                                                      sizeof(uncompressed_header->thread_id) + uncompressed_size;
 
             WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize(),
+                        compress);
         }
     }
 }
@@ -858,7 +905,43 @@ bool CaptureManager::CreateCaptureFile(const std::string& base_filename)
         capture_filename = util::filepath::GenerateTimestampedFilename(capture_filename);
     }
 
-    file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+    defer_compression_ = false;
+
+    {
+        // Blob IDs only refer to blobs that were written to the same file.
+        std::lock_guard<std::mutex> lock(fill_memory_blob_lock_);
+        fill_memory_blobs_.Reset();
+    }
+
+    InvalidatePageGuardSnapshots();
+
+    // The compressor has not been created yet when the first capture file is opened, so check the file options.
+    const bool compression_workers =
+        (compression_threads_ > 0) && (file_options_.compression_type != format::CompressionType::kNone);
+
+    if (async_write_ || compression_workers)
+    {
+        // Blocks are handed off to a writer thread so that disk latency is not added to the API call overhead.
+        auto async_stream = std::make_unique<util::AsyncFileOutputStream>(
+            capture_filename, kFileStreamBufferSize, async_write_queue_size_);
+
+        if (compression_workers && async_stream->IsValid())
+        {
+            // Compression is performed by worker threads, with the writer thread restoring the original block order.
+            const format::CompressionType compression_type = file_options_.compression_type;
+            async_stream->EnableBlockProcessing(compression_threads_, [compression_type]() {
+                return std::make_unique<BlockCompressor>(compression_type);
+            });
+
+            defer_compression_ = true;
+        }
+
+        file_stream_ = std::move(async_stream);
+    }
+    else
+    {
+        file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+    }
 
     if (file_stream_->IsValid())
     {
@@ -909,12 +992,28 @@ void CaptureManager::ActivateTrimming()
 {
     capture_mode_ |= kModeWrite;
 
+    // Modified memory that was processed while only tracking was not written to the file.
+    InvalidatePageGuardSnapshots();
+
     auto thread_data = GetThreadData();
     assert(thread_data != nullptr);
 
     WriteTrackedState(file_stream_.get(), thread_data->thread_id_);
 }
 
+void CaptureManager::InvalidatePageGuardSnapshots()
+{
+    if (page_guard_diff_pages_)
+    {
+        util::PageGuardManager* manager = util::PageGuardManager::Get();
+        if (manager != nullptr)
+        {
+            // Page snapshots only describe data that was written to the current capture file.
+            manager->InvalidatePageSnapshots();
+        }
+    }
+}
+
 void CaptureManager::DeactivateTrimming()
 {
     capture_mode_ &= ~kModeWrite;
@@ -1034,59 +1133,144 @@ void CaptureManager::WriteResizeWindowCmd(format::HandleId surface_id, uint32_t
     }
 }
 
+template <typename CommandHeader>
+CaptureManager::FillMemoryBlock CaptureManager::BuildFillMemoryBlock(CommandHeader* command,
+                                                                     const uint8_t* data,
+                                                                     size_t         size,
+                                                                     ThreadData*    thread_data)
+{
+    const size_t    header_size = sizeof(CommandHeader);
+    FillMemoryBlock block;
+
+    block.compress = (compressor_ != nullptr) && (size >= compression_threshold_);
+
+    if (block.compress && !defer_compression_)
+    {
+        size_t compressed_size = compressor_->Compress(size, data, &thread_data->compressed_buffer_, header_size);
+
+        if ((compressed_size > 0) && (compressed_size < size))
+        {
+            // We don't have a special header for compressed fill commands because the header always includes
+            // the uncompressed size, so we just change the type to indicate the data is compressed.
+            command->meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+            // Calculate size of packet with uncompressed data size.
+            command->meta_header.block_header.size = format::GetMetaDataBlockBaseSize(*command) + compressed_size;
+
+            block.buffer = &thread_data->compressed_buffer_;
+            block.size   = header_size + compressed_size;
+        }
+    }
+
+    if (block.buffer == nullptr)
+    {
+        // Calculate size of packet with compressed data size.
+        command->meta_header.block_header.size = format::GetMetaDataBlockBaseSize(*command) + size;
+
+        std::vector<uint8_t>& scratch_buffer = thread_data->GetScratchBuffer();
+        scratch_buffer.clear();
+        scratch_buffer.resize(header_size);
+        scratch_buffer.insert(scratch_buffer.end(), data, data + size);
+
+        block.buffer = &scratch_buffer;
+        block.size   = header_size + size;
+    }
+
+    return block;
+}
+
+template <typename CommandHeader>
+void CaptureManager::WriteFillMemoryBlock(const CommandHeader& command, const FillMemoryBlock& block)
+{
+    assert((block.buffer != nullptr) && (block.size >= sizeof(command)));
+
+    // Copy header to beginning of the block.
+    util::platform::MemoryCopy(block.buffer->data(), sizeof(command), &command, sizeof(command));
+
+    WriteToFile(block.buffer->data(), block.size, block.compress);
+}
+
 void CaptureManager::WriteFillMemoryCmd(format::HandleId memory_id, uint64_t offset, uint64_t size, const void* data)
 {
     if ((capture_mode_ & kModeWrite) == kModeWrite)
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
 
-        format::FillMemoryCommandHeader fill_cmd;
-        size_t                          header_size       = sizeof(format::FillMemoryCommandHeader);
-        const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
-        size_t                          uncompressed_size = static_cast<size_t>(size);
+        const uint8_t* uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
+        size_t         uncompressed_size = static_cast<size_t>(size);
 
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
-        fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
-        fill_cmd.meta_header.meta_data_id =
-            format::MakeMetaDataId(api_family_, format::MetaDataType::kFillMemoryCommand);
-        fill_cmd.thread_id     = thread_data->thread_id_;
-        fill_cmd.memory_id     = memory_id;
-        fill_cmd.memory_offset = offset;
-        fill_cmd.memory_size   = size;
+        if (dedup_fill_memory_ && format::FillMemoryBlobWriter::IsBlobSize(uncompressed_size))
+        {
+            // The data is hashed and compressed before acquiring the lock, which only needs to keep the blob IDs
+            // assigned by the writer in the same order as the blocks in the file.
+            util::hash::Hash128 hash = util::hash::GenerateHash128(uncompressed_data, uncompressed_size);
+
+            format::FillMemoryBlobCommandHeader blob_cmd;
+            blob_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+            blob_cmd.meta_header.meta_data_id =
+                format::MakeMetaDataId(api_family_, format::MetaDataType::kFillMemoryBlobCommand);
+            blob_cmd.thread_id     = thread_data->thread_id_;
+            blob_cmd.blob_id       = 0;
+            blob_cmd.memory_id     = memory_id;
+            blob_cmd.memory_offset = offset;
+            blob_cmd.memory_size   = size;
+
+            bool is_written = false;
 
-        bool not_compressed = true;
+            {
+                std::lock_guard<std::mutex> lock(fill_memory_blob_lock_);
+                is_written = fill_memory_blobs_.HasBlob(hash, uncompressed_size);
+            }
 
-        if (compressor_ != nullptr)
-        {
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+            FillMemoryBlock block;
 
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+            if (!is_written)
             {
-                not_compressed = false;
+                block = BuildFillMemoryBlock(&blob_cmd, uncompressed_data, uncompressed_size, thread_data);
+            }
 
-                // We don't have a special header for compressed fill commands because the header always includes
-                // the uncompressed size, so we just change the type to indicate the data is compressed.
-                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            std::lock_guard<std::mutex> lock(fill_memory_blob_lock_);
 
-                // Calculate size of packet with uncompressed data size.
-                fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+            bool is_new      = false;
+            blob_cmd.blob_id = fill_memory_blobs_.AddBlob(hash, uncompressed_size, &is_new);
 
-                // Copy header to beginning of compressed_buffer_
-                util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &fill_cmd, header_size);
+            if (is_new)
+            {
+                if (block.buffer == nullptr)
+                {
+                    // The blob was released by another thread after it was checked.
+                    block = BuildFillMemoryBlock(&blob_cmd, uncompressed_data, uncompressed_size, thread_data);
+                }
 
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+                WriteFillMemoryBlock(blob_cmd, block);
             }
-        }
+            else
+            {
+                // The data was written by an earlier blob command, so only the header is needed.
+                blob_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+                blob_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(blob_cmd);
+                blob_cmd.meta_header.meta_data_id =
+                    format::MakeMetaDataId(api_family_, format::MetaDataType::kFillMemoryFromBlobCommand);
 
-        if (not_compressed)
+                WriteToFile(&blob_cmd, sizeof(blob_cmd));
+            }
+        }
+        else
         {
-            // Calculate size of packet with compressed data size.
-            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
-
-            CombineAndWriteToFile({ { &fill_cmd, header_size }, { uncompressed_data, uncompressed_size } });
+            format::FillMemoryCommandHeader fill_cmd;
+            fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+            fill_cmd.meta_header.meta_data_id =
+                format::MakeMetaDataId(api_family_, format::MetaDataType::kFillMemoryCommand);
+            fill_cmd.thread_id     = thread_data->thread_id_;
+            fill_cmd.memory_id     = memory_id;
+            fill_cmd.memory_offset = offset;
+            fill_cmd.memory_size   = size;
+
+            FillMemoryBlock block = BuildFillMemoryBlock(&fill_cmd, uncompressed_data, uncompressed_size, thread_data);
+            WriteFillMemoryBlock(fill_cmd, block);
         }
     }
 }
@@ -1112,7 +1296,7 @@ void CaptureManager::WriteCreateHeapAllocationCmd(uint64_t allocation_id, uint64
     }
 }
 
-void CaptureManager::WriteToFile(const void* data, size_t size)
+void CaptureManager::WriteToFile(const void* data, size_t size, bool compress)
 {
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -1123,12 +1307,22 @@ void CaptureManager::WriteToFile(const void* data, size_t size)
             // of a write to the capture file and the uffd mechanism interupts it, it will cause
             // a deadlock as uffd will also try to write to the capture file as well. For this
             // reason RT signal needs to be disabled while writing.
-            // This can be removed once writing to the capture file(s) is delegated to a separate thread.
+            // The asynchronous writer only performs a copy into a per-thread buffer on this thread, but waits on a
+            // mutex when its queue is full, which the uffd mechanism could also attempt to acquire, so the signal must
+            // still be blocked.
             manager->UffdBlockRtSignal();
         }
     }
 
-    file_stream_->Write(data, size);
+    if (compress && defer_compression_)
+    {
+        static_cast<util::AsyncFileOutputStream*>(file_stream_.get())->WriteAndProcess(data, size);
+    }
+    else
+    {
+        file_stream_->Write(data, size);
+    }
+
     if (force_file_flush_)
     {
         file_stream_->Flush();
@@ -1163,6 +1357,32 @@ void CaptureManager::WriteCaptureOptions(std::string& operation_annotation)
         buffer += force_file_flush_ ? "true," : "false,";
     }
 
+    if (async_write_ != default_settings.async_write)
+    {
+        buffer += "\n    \"capture-file-async-write\": ";
+        buffer += async_write_ ? "true," : "false,";
+    }
+
+    if (compression_threads_ != default_settings.compression_threads)
+    {
+        buffer += "\n    \"capture-compression-threads\": ";
+        buffer += std::to_string(compression_threads_);
+        buffer += ",";
+    }
+
+    if (compression_threshold_ != default_settings.compression_threshold)
+    {
+        buffer += "\n    \"capture-compression-threshold\": ";
+        buffer += std::to_string(compression_threshold_);
+        buffer += ",";
+    }
+
+    if (dedup_fill_memory_ != default_settings.dedup_fill_memory)
+    {
+        buffer += "\n    \"capture-dedup-fill-memory\": ";
+        buffer += dedup_fill_memory_ ? "true," : "false,";
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
         buffer += "\n    \"memory-tracking-mode\": \"unassisted\",";
@@ -1216,6 +1436,11 @@ void CaptureManager::WriteCaptureOptions(std::string& operation_annotation)
             page_guard_options_buffer += "\n    \"page-guard-signal-handler-watcher-max-restores\": " +
                                          std::to_string(page_guard_signal_handler_watcher_max_restores_) + ',';
         }
+        if (page_guard_diff_pages_ != default_settings.page_guard_diff_pages)
+        {
+            page_guard_options_buffer += "\n    \"page-guard-diff-pages\": ";
+            page_guard_options_buffer += page_guard_diff_pages_ ? "true," : "false,";
+        }
 
         if (!page_guard_options_buffer.empty())
         {
@@ -1236,6 +1461,13 @@ void CaptureManager::WriteCaptureOptions(std::string& operation_annotation)
         buffer += queue_zero_only_ ? "true," : "false,";
     }
 
+    if (trim_readback_batch_size_ != (static_cast<size_t>(default_settings.trim_readback_batch_size) * 1024 * 1024))
+    {
+        buffer += "\n    \"capture-trim-readback-batch-size\": ";
+        buffer += std::to_string(trim_readback_batch_size_ / (1024 * 1024));
+        buffer += ",";
+    }
+
     if (buffer.empty())
     {
         return;
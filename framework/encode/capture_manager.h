@@ -30,6 +30,7 @@
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
 #include "format/api_call_id.h"
+#include "format/fill_memory_blob.h"
 #include "format/format.h"
 #include "format/platform_types.h"
 #include "util/compressor.h"
@@ -155,6 +156,7 @@ class CaptureManager
     auto GetForceCommandSerialization() const { return force_command_serialization_; }
     auto GetQueueZeroOnly() const { return queue_zero_only_; }
     auto GetAllowPipelineCompileRequired() const { return allow_pipeline_compile_required_; }
+    auto GetTrimReadbackBatchSize() const { return trim_readback_batch_size_; }
 
     bool     IsAnnotated() const { return rv_annotation_info_.rv_annotation; }
     uint16_t GetGPUVAMask() const { return rv_annotation_info_.gpuva_mask; }
@@ -263,6 +265,7 @@ class CaptureManager
     void        WriteCaptureOptions(std::string& operation_annotation);
     void        ActivateTrimming();
     void        DeactivateTrimming();
+    void        InvalidatePageGuardSnapshots();
 
     void WriteFileHeader();
     void BuildOptionList(const format::EnabledOptions&        enabled_options,
@@ -286,10 +289,12 @@ class CaptureManager
     util::ScreenshotFormat            screenshot_format_;
     static std::atomic<uint64_t>      block_index_;
 
-    void WriteToFile(const void* data, size_t size);
+    // When compress is true and compression worker threads are enabled, the uncompressed block is queued for
+    // compression on a worker thread instead of being written as-is.
+    void WriteToFile(const void* data, size_t size, bool compress = false);
 
     template <size_t N>
-    void CombineAndWriteToFile(const std::pair<const void*, size_t> (&buffers)[N])
+    void CombineAndWriteToFile(const std::pair<const void*, size_t> (&buffers)[N], bool compress = false)
     {
         static_assert(N != 1, "Use WriteToFile(void*, size) when writing a single buffer.");
 
@@ -303,7 +308,7 @@ class CaptureManager
             scratch_buffer.insert(scratch_buffer.end(), data, data + size);
         }
 
-        WriteToFile(scratch_buffer.data(), scratch_buffer.size());
+        WriteToFile(scratch_buffer.data(), scratch_buffer.size(), compress);
     }
 
   private:
@@ -316,6 +321,25 @@ class CaptureManager
         }
     }
 
+    // A fill memory command block that has been built in a per-thread buffer, with space for the command header at the
+    // start of the buffer.
+    struct FillMemoryBlock
+    {
+        std::vector<uint8_t>* buffer{ nullptr };
+        size_t                size{ 0 };
+        bool                  compress{ false }; // Passed to WriteToFile() for deferred compression.
+    };
+
+    // Builds the block for a fill memory command, with its data compressed when it is large enough, and sets the block
+    // type and size of the command header.
+    template <typename CommandHeader>
+    FillMemoryBlock
+    BuildFillMemoryBlock(CommandHeader* command, const uint8_t* data, size_t size, ThreadData* thread_data);
+
+    // Copies the command header to the start of the block and writes the block to the file.
+    template <typename CommandHeader>
+    void WriteFillMemoryBlock(const CommandHeader& command, const FillMemoryBlock& block);
+
   private:
     static uint32_t                                 instance_count_;
     static std::mutex                               instance_lock_;
@@ -330,12 +354,21 @@ class CaptureManager
     std::string                             base_filename_;
     bool                                    timestamp_filename_;
     bool                                    force_file_flush_;
+    bool                                    async_write_;
+    size_t                                  async_write_queue_size_;
+    uint32_t                                compression_threads_;
+    size_t                                  compression_threshold_;
+    bool                                    defer_compression_;
+    bool                                    dedup_fill_memory_;
+    format::FillMemoryBlobWriter            fill_memory_blobs_;
+    std::mutex                              fill_memory_blob_lock_; // Keeps blob IDs in the order they are written.
     CaptureSettings::MemoryTrackingMode     memory_tracking_mode_;
     bool                                    page_guard_align_buffer_sizes_;
     bool                                    page_guard_track_ahb_memory_;
     bool                                    page_guard_unblock_sigsegv_;
     bool                                    page_guard_signal_handler_watcher_;
     uint32_t                                page_guard_signal_handler_watcher_max_restores_;
+    bool                                    page_guard_diff_pages_;
     PageGuardMemoryMode                     page_guard_memory_mode_;
     bool                                    page_guard_separate_read_;
     bool                                    page_guard_copy_on_map_;
@@ -345,6 +378,7 @@ class CaptureManager
     std::vector<util::UintRange>            trim_ranges_;
     std::string                             trim_key_;
     uint32_t                                trim_key_frames_;
+    size_t                                  trim_readback_batch_size_;
     uint32_t                                trim_key_first_frame_;
     size_t                                  trim_current_range_;
     uint32_t                                current_frame_;
@@ -44,12 +44,22 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // clang-format off
 #define CAPTURE_COMPRESSION_TYPE_LOWER                       "capture_compression_type"
 #define CAPTURE_COMPRESSION_TYPE_UPPER                       "CAPTURE_COMPRESSION_TYPE"
+#define CAPTURE_COMPRESSION_THREADS_LOWER                    "capture_compression_threads"
+#define CAPTURE_COMPRESSION_THREADS_UPPER                    "CAPTURE_COMPRESSION_THREADS"
+#define CAPTURE_COMPRESSION_THRESHOLD_LOWER                  "capture_compression_threshold"
+#define CAPTURE_COMPRESSION_THRESHOLD_UPPER                  "CAPTURE_COMPRESSION_THRESHOLD"
 #define CAPTURE_FILE_NAME_LOWER                              "capture_file"
 #define CAPTURE_FILE_NAME_UPPER                              "CAPTURE_FILE"
 #define CAPTURE_FILE_USE_TIMESTAMP_LOWER                     "capture_file_timestamp"
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER                     "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER                             "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER                             "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_ASYNC_WRITE_LOWER                       "capture_file_async_write"
+#define CAPTURE_FILE_ASYNC_WRITE_UPPER                       "CAPTURE_FILE_ASYNC_WRITE"
+#define CAPTURE_FILE_ASYNC_QUEUE_SIZE_LOWER                  "capture_file_async_queue_size"
+#define CAPTURE_FILE_ASYNC_QUEUE_SIZE_UPPER                  "CAPTURE_FILE_ASYNC_QUEUE_SIZE"
+#define CAPTURE_DEDUP_FILL_MEMORY_LOWER                      "capture_dedup_fill_memory"
+#define CAPTURE_DEDUP_FILL_MEMORY_UPPER                      "CAPTURE_DEDUP_FILL_MEMORY"
 #define LOG_ALLOW_INDENTS_LOWER                              "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER                              "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER                             "log_break_on_error"
@@ -94,6 +104,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_IUNKNOWN_WRAPPING_UPPER                      "CAPTURE_IUNKNOWN_WRAPPING"
 #define CAPTURE_QUEUE_SUBMITS_LOWER                          "capture_queue_submits"
 #define CAPTURE_QUEUE_SUBMITS_UPPER                          "CAPTURE_QUEUE_SUBMITS"
+#define CAPTURE_TRIM_READBACK_BATCH_SIZE_LOWER               "capture_trim_readback_batch_size"
+#define CAPTURE_TRIM_READBACK_BATCH_SIZE_UPPER               "CAPTURE_TRIM_READBACK_BATCH_SIZE"
 #define PAGE_GUARD_COPY_ON_MAP_LOWER                         "page_guard_copy_on_map"
 #define PAGE_GUARD_COPY_ON_MAP_UPPER                         "PAGE_GUARD_COPY_ON_MAP"
 #define PAGE_GUARD_SEPARATE_READ_LOWER                       "page_guard_separate_read"
@@ -112,6 +124,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER              "PAGE_GUARD_SIGNAL_HANDLER_WATCHER"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER "page_guard_signal_handler_watcher_max_restores"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER "PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES"
+#define PAGE_GUARD_DIFF_PAGES_LOWER                          "page_guard_diff_pages"
+#define PAGE_GUARD_DIFF_PAGES_UPPER                          "PAGE_GUARD_DIFF_PAGES"
 #define DEBUG_LAYER_LOWER                                    "debug_layer"
 #define DEBUG_LAYER_UPPER                                    "DEBUG_LAYER"
 #define DEBUG_DEVICE_LOST_LOWER                              "debug_device_lost"
@@ -142,7 +156,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_LOWER;
+const char kCaptureCompressionThresholdEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THRESHOLD_LOWER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileAsyncWriteEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_LOWER;
+const char kCaptureFileAsyncQueueSizeEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_QUEUE_SIZE_LOWER;
+const char kCaptureDedupFillMemoryEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUP_FILL_MEMORY_LOWER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
@@ -166,6 +185,7 @@ const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_LOWER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_LOWER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_LOWER;
+const char kCaptureTrimReadbackBatchSizeEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_READBACK_BATCH_SIZE_LOWER;
 const char kPageGuardCopyOnMapEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
 const char kPageGuardSeparateReadEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
 const char kPageGuardPersistentMemoryEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
@@ -175,6 +195,7 @@ const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER;
+const char kPageGuardDiffPagesEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_DIFF_PAGES_LOWER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_LOWER;
 const char kDebugDeviceLostEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX DEBUG_DEVICE_LOST_LOWER;
 const char kCaptureAndroidTriggerEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_ANDROID_TRIGGER_LOWER;
@@ -195,7 +216,12 @@ const char kAnnotationDescriptorEnvVar[]                     = GFXRECON_ENV_VAR_
 const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_UPPER;
+const char kCaptureCompressionThresholdEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THRESHOLD_UPPER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileAsyncWriteEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_UPPER;
+const char kCaptureFileAsyncQueueSizeEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_QUEUE_SIZE_UPPER;
+const char kCaptureDedupFillMemoryEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUP_FILL_MEMORY_UPPER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
@@ -224,10 +250,12 @@ const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_UPPER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER;
+const char kPageGuardDiffPagesEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_DIFF_PAGES_UPPER;
 const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_UPPER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_UPPER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_UPPER;
+const char kCaptureTrimReadbackBatchSizeEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_READBACK_BATCH_SIZE_UPPER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_UPPER;
 const char kDebugDeviceLostEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX DEBUG_DEVICE_LOST_UPPER;
 const char kDisableDxrEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DISABLE_DXR_UPPER;
@@ -246,8 +274,13 @@ const char kAnnotationDescriptorEnvVar[]                     = GFXRECON_ENV_VAR_
 const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 
 const std::string kOptionKeyCaptureCompressionType                   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
+const std::string kOptionKeyCaptureCompressionThreads                = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THREADS_LOWER);
+const std::string kOptionKeyCaptureCompressionThreshold              = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THRESHOLD_LOWER);
 const std::string kOptionKeyCaptureFile                              = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileAsyncWrite                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_ASYNC_WRITE_LOWER);
+const std::string kOptionKeyCaptureFileAsyncQueueSize                = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_ASYNC_QUEUE_SIZE_LOWER);
+const std::string kOptionKeyCaptureDedupFillMemory                   = std::string(kSettingsFilter) + std::string(CAPTURE_DEDUP_FILL_MEMORY_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp                  = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
 const std::string kOptionKeyLogAllowIndents                          = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError                          = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
@@ -270,6 +303,7 @@ const std::string kOptionKeyCaptureTrigger                           = std::stri
 const std::string kOptionKeyCaptureTriggerFrames                     = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_FRAMES_LOWER);
 const std::string kOptionKeyCaptureIUnknownWrapping                  = std::string(kSettingsFilter) + std::string(CAPTURE_IUNKNOWN_WRAPPING_LOWER);
 const std::string kOptionKeyCaptureQueueSubmits                      = std::string(kSettingsFilter) + std::string(CAPTURE_QUEUE_SUBMITS_LOWER);
+const std::string kOptionKeyCaptureTrimReadbackBatchSize             = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_READBACK_BATCH_SIZE_LOWER);
 const std::string kOptionKeyPageGuardCopyOnMap                       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
 const std::string kOptionKeyPageGuardSeparateRead                    = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
 const std::string kOptionKeyPageGuardPersistentMemory                = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
@@ -279,6 +313,7 @@ const std::string kOptionKeyPageGuardExternalMemory                  = std::stri
 const std::string kOptionKeyPageGuardUnblockSigSegV                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcher            = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcherMaxRestores = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER);
+const std::string kOptionKeyPageGuardDiffPages                       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_DIFF_PAGES_LOWER);
 const std::string kDebugLayer                                        = std::string(kSettingsFilter) + std::string(DEBUG_LAYER_LOWER);
 const std::string kDebugDeviceLost                                   = std::string(kSettingsFilter) + std::string(DEBUG_DEVICE_LOST_LOWER);
 const std::string kOptionDisableDxr                                  = std::string(kSettingsFilter) + std::string(DISABLE_DXR_LOWER);
@@ -383,7 +418,12 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileNameEnvVar, kOptionKeyCaptureFile);
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThreadsEnvVar, kOptionKeyCaptureCompressionThreads);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThresholdEnvVar, kOptionKeyCaptureCompressionThreshold);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileAsyncWriteEnvVar, kOptionKeyCaptureFileAsyncWrite);
+    LoadSingleOptionEnvVar(options, kCaptureFileAsyncQueueSizeEnvVar, kOptionKeyCaptureFileAsyncQueueSize);
+    LoadSingleOptionEnvVar(options, kCaptureDedupFillMemoryEnvVar, kOptionKeyCaptureDedupFillMemory);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -407,6 +447,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureTriggerEnvVar, kOptionKeyCaptureTrigger);
     LoadSingleOptionEnvVar(options, kCaptureTriggerFramesEnvVar, kOptionKeyCaptureTriggerFrames);
     LoadSingleOptionEnvVar(options, kCaptureQueueSubmitsEnvVar, kOptionKeyCaptureQueueSubmits);
+    LoadSingleOptionEnvVar(options, kCaptureTrimReadbackBatchSizeEnvVar, kOptionKeyCaptureTrimReadbackBatchSize);
 
     // Page guard environment variables
     LoadSingleOptionEnvVar(options, kPageGuardCopyOnMapEnvVar, kOptionKeyPageGuardCopyOnMap);
@@ -419,6 +460,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kPageGuardSignalHandlerWatcherEnvVar, kOptionKeyPageGuardSignalHandlerWatcher);
     LoadSingleOptionEnvVar(
         options, kPageGuardSignalHandlerWatcherMaxRestoresEnvVar, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores);
+    LoadSingleOptionEnvVar(options, kPageGuardDiffPagesEnvVar, kOptionKeyPageGuardDiffPages);
 
     // Debug environment variables
     LoadSingleOptionEnvVar(options, kDebugLayerEnvVar, kDebugLayer);
@@ -477,12 +519,22 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     // Capture file options
     settings->trace_settings_.capture_file_options.compression_type =
         ParseCompressionTypeString(FindOption(options, kOptionKeyCaptureCompressionType), kDefaultCompressionType);
+    settings->trace_settings_.compression_threads = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureCompressionThreads), settings->trace_settings_.compression_threads);
+    settings->trace_settings_.compression_threshold = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureCompressionThreshold), settings->trace_settings_.compression_threshold);
     settings->trace_settings_.capture_file =
         FindOption(options, kOptionKeyCaptureFile, settings->trace_settings_.capture_file);
     settings->trace_settings_.time_stamp_file = ParseBoolString(FindOption(options, kOptionKeyCaptureFileUseTimestamp),
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.async_write = ParseBoolString(FindOption(options, kOptionKeyCaptureFileAsyncWrite),
+                                                            settings->trace_settings_.async_write);
+    settings->trace_settings_.async_write_queue_size = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureFileAsyncQueueSize), settings->trace_settings_.async_write_queue_size);
+    settings->trace_settings_.dedup_fill_memory = ParseBoolString(FindOption(options, kOptionKeyCaptureDedupFillMemory),
+                                                                  settings->trace_settings_.dedup_fill_memory);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
@@ -543,6 +595,9 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
 
     settings->trace_settings_.quit_after_frame_ranges = ParseBoolString(
         FindOption(options, kOptionKeyQuitAfterCaptureFrames), settings->trace_settings_.quit_after_frame_ranges);
+    settings->trace_settings_.trim_readback_batch_size =
+        gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureTrimReadbackBatchSize),
+                                        settings->trace_settings_.trim_readback_batch_size);
 
     // Page guard environment variables
     settings->trace_settings_.page_guard_copy_on_map = ParseBoolString(
@@ -567,6 +622,8 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.page_guard_signal_handler_watcher_max_restores =
         ParseIntegerString(FindOption(options, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores),
                            settings->trace_settings_.page_guard_signal_handler_watcher_max_restores);
+    settings->trace_settings_.page_guard_diff_pages = ParseBoolString(FindOption(options, kOptionKeyPageGuardDiffPages),
+                                                                      settings->trace_settings_.page_guard_diff_pages);
 
     // Debug options
     settings->trace_settings_.debug_layer =
@@ -91,8 +91,13 @@ class CaptureSettings
     {
         std::string                  capture_file{ kDefaultCaptureFileName };
         format::EnabledOptions       capture_file_options;
+        uint32_t                     compression_threads{ 0 };    // Worker threads for compression, 0 to compress inline.
+        uint32_t                     compression_threshold{ 64 }; // Blocks smaller than this are not compressed.
         bool                         time_stamp_file{ true };
         bool                         force_flush{ false };
+        bool                         async_write{ false };
+        uint32_t                     async_write_queue_size{ 64 }; // Size limit in MiB for pending async writes.
+        bool                         dedup_fill_memory{ false };
         MemoryTrackingMode           memory_tracking_mode{ kPageGuard };
         std::string                  screenshot_dir;
         std::vector<util::UintRange> screenshot_ranges;
@@ -101,6 +106,7 @@ class CaptureSettings
         std::vector<util::UintRange> trim_ranges;
         std::string                  trim_key;
         uint32_t                     trim_key_frames{ 0 };
+        uint32_t                     trim_readback_batch_size{ 32 }; // Size in MiB of trim state readback batches.
         RuntimeTriggerState          runtime_capture_trigger{ kNotUsed };
         int                          page_guard_signal_handler_watcher_max_restores{ 1 };
         bool                         page_guard_copy_on_map{ util::PageGuardManager::kDefaultEnableCopyOnMap };
@@ -110,6 +116,7 @@ class CaptureSettings
         bool                         page_guard_track_ahb_memory{ false };
         bool                         page_guard_unblock_sigsegv{ false };
         bool                         page_guard_signal_handler_watcher{ false };
+        bool                         page_guard_diff_pages{ util::PageGuardManager::kDefaultEnablePageDiffing };
         bool                         debug_layer{ false };
         bool                         debug_device_lost{ false };
         bool                         disable_dxr{ false };
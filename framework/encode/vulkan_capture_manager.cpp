@@ -87,7 +87,10 @@ void VulkanCaptureManager::DestroyInstance()
 
 void VulkanCaptureManager::WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
 {
-    VulkanStateWriter state_writer(file_stream, compressor_.get(), thread_id);
+    GFXRECON_LOG_INFO("Command buffer data retained for trimming: %" PRIu64 " bytes",
+                      util::MemoryChunkArena::GetTotalRetainedBytes());
+
+    VulkanStateWriter state_writer(file_stream, compressor_.get(), thread_id, GetTrimReadbackBatchSize());
     uint64_t          n_blocks = state_tracker_->WriteState(&state_writer, GetCurrentFrame());
     block_index_ += n_blocks;
 
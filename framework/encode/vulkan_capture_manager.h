@@ -901,12 +901,15 @@ class VulkanCaptureManager : public CaptureManager
         }
     }
 
-    void PostProcess_vkResetCommandPool(VkResult result, VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags)
+    void PostProcess_vkResetCommandPool(VkResult result,
+                                        VkDevice,
+                                        VkCommandPool           commandPool,
+                                        VkCommandPoolResetFlags flags)
     {
         if (((GetCaptureMode() & kModeTrack) == kModeTrack) && (result == VK_SUCCESS))
         {
             assert(state_tracker_ != nullptr);
-            state_tracker_->TrackResetCommandPool(commandPool);
+            state_tracker_->TrackResetCommandPool(commandPool, flags);
         }
     }
 
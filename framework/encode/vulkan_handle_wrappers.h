@@ -30,6 +30,7 @@
 #include "format/format.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "graphics/vulkan_device_util.h"
+#include "util/chunked_output_stream.h"
 #include "util/defines.h"
 #include "util/memory_output_stream.h"
 #include "util/page_guard_manager.h"
@@ -284,7 +285,7 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
 
     // Members for trimming state tracking.
     VkCommandBufferLevel       level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
-    util::MemoryOutputStream   command_data;
+    util::ChunkedOutputStream  command_data;
     std::set<format::HandleId> command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
 
     // Image layout info tracked for image barriers recorded to the command buffer. To be updated on calls to
@@ -407,6 +408,10 @@ struct CommandPoolWrapper : public HandleWrapper<VkCommandPool>
 
     DeviceWrapper* device{ nullptr };
     bool           trim_command_pool{ false };
+
+    // Storage for the command data recorded to the pool's command buffers. Chunks are recycled when the command
+    // buffers are reset, and freed when the pool is trimmed or reset with VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT.
+    util::MemoryChunkArena command_data_arena;
 };
 
 // For vkGetPhysicalDeviceSurfaceCapabilitiesKHR
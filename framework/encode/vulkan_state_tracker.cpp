@@ -77,9 +77,12 @@ void VulkanStateTracker::TrackTrimCommandPool(VkDevice device, VkCommandPool com
 
     auto device_wrapper = GetVulkanWrapper<vulkan_wrappers::DeviceWrapper>(device);
     wrapper->device     = device_wrapper;
+
+    // Return the command data chunks that are not in use to the system, as the driver does with the pool's memory.
+    wrapper->command_data_arena.Trim();
 }
 
-void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool)
+void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool, VkCommandPoolResetFlags flags)
 {
     assert(command_pool != VK_NULL_HANDLE);
 
@@ -97,6 +100,11 @@ void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool)
             entry.second->command_handles[i].clear();
         }
     }
+
+    if ((flags & VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT) == VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT)
+    {
+        wrapper->command_data_arena.Trim();
+    }
 }
 
 void VulkanStateTracker::TrackPhysicalDeviceMemoryProperties(VkPhysicalDevice                        physical_device,
@@ -253,7 +253,7 @@ class VulkanStateTracker
 
     void TrackTrimCommandPool(VkDevice device, VkCommandPool command_pool);
 
-    void TrackResetCommandPool(VkCommandPool command_pool);
+    void TrackResetCommandPool(VkCommandPool command_pool, VkCommandPoolResetFlags flags);
 
     void TrackPhysicalDeviceMemoryProperties(VkPhysicalDevice                        physical_device,
                                              const VkPhysicalDeviceMemoryProperties* properties);
@@ -79,9 +79,11 @@ static bool IsImageReadable(VkMemoryPropertyFlags                       property
 
 VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
                                      util::Compressor*       compressor,
-                                     format::ThreadId        thread_id) :
+                                     format::ThreadId        thread_id,
+                                     VkDeviceSize            readback_batch_size) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_),
+    readback_batch_size_(readback_batch_size)
 {
     assert(output_stream != nullptr);
 }
@@ -1266,7 +1268,8 @@ void VulkanStateWriter::ProcessHardwareBuffer(format::HandleId memory_id,
 
 void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                                             const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                                            graphics::VulkanResourcesUtil&         resource_util)
+                                            graphics::VulkanResourcesUtil&         resource_util,
+                                            bool                                   use_readback_batches)
 {
     assert(device_wrapper != nullptr);
 
@@ -1283,6 +1286,30 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
 
         if (snapshot_entry.need_staging_copy)
         {
+            if (use_readback_batches && (buffer_wrapper->created_size <= readback_batch_size_))
+            {
+                uint64_t staging_offset = 0;
+                VkResult result         = resource_util.RecordBufferReadback(
+                    buffer_wrapper->handle, buffer_wrapper->created_size, &staging_offset);
+
+                if (result == VK_INCOMPLETE)
+                {
+                    SubmitReadbackBatch(device_wrapper, resource_util);
+
+                    result = resource_util.RecordBufferReadback(
+                        buffer_wrapper->handle, buffer_wrapper->created_size, &staging_offset);
+                }
+
+                if (result == VK_SUCCESS)
+                {
+                    PendingReadback pending;
+                    pending.buffer_info    = &snapshot_entry;
+                    pending.staging_offset = staging_offset;
+                    recorded_readbacks_.emplace_back(pending);
+                    continue;
+                }
+            }
+
             VkResult result = resource_util.ReadFromBufferResource(
                 buffer_wrapper->handle, buffer_wrapper->created_size, buffer_wrapper->queue_family_index, data);
 
@@ -1324,57 +1351,19 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
             }
         }
 
-        if (bytes != nullptr)
-        {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
-
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->created_size);
-            format::InitBufferCommandHeader upload_cmd;
+        WriteInitBufferCommand(device_wrapper->handle_id, buffer_wrapper, bytes);
 
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.buffer_id = buffer_wrapper->handle_id;
-            upload_cmd.data_size = data_size;
-
-            if (compressor_ != nullptr)
-            {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
-            }
-
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
-
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
-            ++blocks_written_;
-
-            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
-            {
-                device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
-            }
-        }
-        else
+        if ((bytes != nullptr) && !snapshot_entry.need_staging_copy && (memory_wrapper->mapped_data == nullptr))
         {
-            GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
-                               buffer_wrapper->handle_id);
+            device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
         }
     }
 }
 
 void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                            const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                                           graphics::VulkanResourcesUtil&        resource_util)
+                                           graphics::VulkanResourcesUtil&        resource_util,
+                                           bool                                  use_readback_batches)
 {
     assert(device_wrapper != nullptr);
 
@@ -1392,6 +1381,31 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
 
         if (snapshot_entry.need_staging_copy)
         {
+            if (use_readback_batches && !image_wrapper->is_swapchain_image &&
+                (snapshot_entry.resource_size <= readback_batch_size_) &&
+                graphics::VulkanResourcesUtil::IsReadbackBatchSupported(
+                    image_wrapper->format, image_wrapper->samples, snapshot_entry.aspect))
+            {
+                uint64_t staging_offset = 0;
+                VkResult result         = RecordImageReadback(snapshot_entry, resource_util, &staging_offset);
+
+                if (result == VK_INCOMPLETE)
+                {
+                    SubmitReadbackBatch(device_wrapper, resource_util);
+
+                    result = RecordImageReadback(snapshot_entry, resource_util, &staging_offset);
+                }
+
+                if (result == VK_SUCCESS)
+                {
+                    PendingReadback pending;
+                    pending.image_info     = &snapshot_entry;
+                    pending.staging_offset = staging_offset;
+                    recorded_readbacks_.emplace_back(pending);
+                    continue;
+                }
+            }
+
             std::vector<uint64_t> subresource_offsets;
             std::vector<uint64_t> subresource_sizes;
             VkResult              result = resource_util.ReadFromImageResourceStaging(image_wrapper->handle,
@@ -1451,71 +1465,177 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
 
         if (!image_wrapper->is_swapchain_image)
         {
-            format::InitImageCommandHeader upload_cmd;
-
-            // Packet size without the resource data.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.image_id  = image_wrapper->handle_id;
-            upload_cmd.aspect    = snapshot_entry.aspect;
-            upload_cmd.layout    = image_wrapper->current_layout;
+            WriteInitImageCommand(device_wrapper->handle_id, snapshot_entry, bytes);
 
-            if (bytes != nullptr)
+            if ((bytes != nullptr) && !snapshot_entry.need_staging_copy && (memory_wrapper->mapped_data == nullptr))
             {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
+                device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
+            }
+        }
+    }
+}
 
-                size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
+VkResult VulkanStateWriter::RecordImageReadback(const ImageSnapshotInfo&       snapshot_entry,
+                                                graphics::VulkanResourcesUtil& resource_util,
+                                                uint64_t*                      staging_offset)
+{
+    const vulkan_wrappers::ImageWrapper* image_wrapper = snapshot_entry.image_wrapper;
 
-                // Store uncompressed data size in packet.
-                upload_cmd.data_size   = data_size;
-                upload_cmd.level_count = image_wrapper->mip_levels;
+    return resource_util.RecordImageReadback(image_wrapper->handle,
+                                             image_wrapper->format,
+                                             image_wrapper->extent,
+                                             image_wrapper->mip_levels,
+                                             image_wrapper->array_layers,
+                                             image_wrapper->current_layout,
+                                             snapshot_entry.aspect,
+                                             snapshot_entry.level_sizes,
+                                             staging_offset);
+}
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+void VulkanStateWriter::SubmitReadbackBatch(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                            graphics::VulkanResourcesUtil&        resource_util)
+{
+    assert(device_wrapper != nullptr);
 
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    // Submit the recorded copies, then write the data from the previous submission while the new copies execute. A
+    // submit failure is reported when the batch data is retrieved.
+    resource_util.SubmitReadbackBatch();
 
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
+    const uint8_t* batch_data = resource_util.WaitReadbackBatch();
 
-                // Calculate size of packet with compressed or uncompressed data size.
-                assert(!snapshot_entry.level_sizes.empty() &&
-                       (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
-                size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
+    for (const PendingReadback& pending : submitted_readbacks_)
+    {
+        const uint8_t* bytes = (batch_data != nullptr) ? (batch_data + pending.staging_offset) : nullptr;
 
-                upload_cmd.meta_header.block_header.size += levels_size + data_size;
+        if (pending.buffer_info != nullptr)
+        {
+            WriteInitBufferCommand(device_wrapper->handle_id, pending.buffer_info->buffer_wrapper, bytes);
+        }
+        else
+        {
+            assert(pending.image_info != nullptr);
+            WriteInitImageCommand(device_wrapper->handle_id, *pending.image_info, bytes);
+        }
+    }
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                output_stream_->Write(bytes, data_size);
+    submitted_readbacks_.clear();
+    std::swap(recorded_readbacks_, submitted_readbacks_);
+}
 
-                if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
-                {
-                    device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
-                }
-            }
-            else
+void VulkanStateWriter::WriteInitBufferCommand(format::HandleId                      device_id,
+                                               const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                                               const uint8_t*                        bytes)
+{
+    assert(buffer_wrapper != nullptr);
+
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
+
+        size_t                          data_size = static_cast<size_t>(buffer_wrapper->created_size);
+        format::InitBufferCommandHeader upload_cmd;
+
+        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+        upload_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+        upload_cmd.thread_id = thread_id_;
+        upload_cmd.device_id = device_id;
+        upload_cmd.buffer_id = buffer_wrapper->handle_id;
+        upload_cmd.data_size = data_size;
+
+        // Buffer contents are written once per state snapshot, so they are not deduplicated with fill memory blobs.
+        // Contents that repeat across buffers, such as zero-filled buffers, are left to compression.
+        if (compressor_ != nullptr)
+        {
+            size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+
+            if ((compressed_size > 0) && (compressed_size < data_size))
             {
-                // Write a packet without resource data; replay must still perform a layout transition at image
-                // initialization.
-                upload_cmd.data_size   = 0;
-                upload_cmd.level_count = 0;
+                upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                bytes     = compressed_parameter_buffer_.data();
+                data_size = compressed_size;
             }
+        }
 
-            ++blocks_written_;
+        // Calculate size of packet with compressed or uncompressed data size.
+        upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+
+        output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+        output_stream_->Write(bytes, data_size);
+        ++blocks_written_;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                           buffer_wrapper->handle_id);
+    }
+}
+
+void VulkanStateWriter::WriteInitImageCommand(format::HandleId         device_id,
+                                              const ImageSnapshotInfo& snapshot_entry,
+                                              const uint8_t*           bytes)
+{
+    const vulkan_wrappers::ImageWrapper* image_wrapper = snapshot_entry.image_wrapper;
+    format::InitImageCommandHeader       upload_cmd;
+
+    assert(image_wrapper != nullptr);
+
+    // Packet size without the resource data.
+    upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
+    upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+    upload_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
+    upload_cmd.thread_id = thread_id_;
+    upload_cmd.device_id = device_id;
+    upload_cmd.image_id  = image_wrapper->handle_id;
+    upload_cmd.aspect    = snapshot_entry.aspect;
+    upload_cmd.layout    = image_wrapper->current_layout;
+
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
+
+        size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
+
+        // Store uncompressed data size in packet.
+        upload_cmd.data_size   = data_size;
+        upload_cmd.level_count = image_wrapper->mip_levels;
+
+        if (compressor_ != nullptr)
+        {
+            size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+
+            if ((compressed_size > 0) && (compressed_size < data_size))
+            {
+                upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+                bytes     = compressed_parameter_buffer_.data();
+                data_size = compressed_size;
+            }
         }
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        assert(!snapshot_entry.level_sizes.empty() && (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
+        size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
+
+        upload_cmd.meta_header.block_header.size += levels_size + data_size;
+
+        output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+        output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
+        output_stream_->Write(bytes, data_size);
+    }
+    else
+    {
+        // Write a packet without resource data; replay must still perform a layout transition at image
+        // initialization.
+        upload_cmd.data_size   = 0;
+        upload_cmd.level_count = 0;
+
+        output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
     }
+
+    ++blocks_written_;
 }
 
 void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_table,
@@ -1792,6 +1912,27 @@ void VulkanStateWriter::WriteImageSubresourceLayouts(const vulkan_wrappers::Imag
     }
 }
 
+bool VulkanStateWriter::NeedsStagingCopy(const ResourceSnapshotInfo& snapshot_info)
+{
+    for (const auto& buffer_entry : snapshot_info.buffers)
+    {
+        if (buffer_entry.need_staging_copy)
+        {
+            return true;
+        }
+    }
+
+    for (const auto& image_entry : snapshot_info.images)
+    {
+        if (image_entry.need_staging_copy)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_table)
 {
     DeviceResourceTables resources;
@@ -1810,7 +1951,8 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
         graphics::VulkanResourcesUtil resource_util(
             device_wrapper->handle, device_wrapper->layer_table, device_wrapper->physical_device->memory_properties);
 
-        if (max_staging_copy_size > 0)
+        // Resources that fit in a readback batch do not use the individual staging buffer.
+        if (max_staging_copy_size > readback_batch_size_)
         {
             assert(device_wrapper != nullptr);
 
@@ -1834,8 +1976,29 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
 
             for (const auto& queue_family_entry : resource_entry.second)
             {
-                ProcessBufferMemory(device_wrapper, queue_family_entry.second.buffers, resource_util);
-                ProcessImageMemory(device_wrapper, queue_family_entry.second.images, resource_util);
+                bool use_readback_batches = false;
+
+                if ((readback_batch_size_ > 0) && NeedsStagingCopy(queue_family_entry.second))
+                {
+                    use_readback_batches = (resource_util.CreateReadbackBatches(queue_family_entry.first,
+                                                                                readback_batch_size_) == VK_SUCCESS);
+                }
+
+                ProcessBufferMemory(
+                    device_wrapper, queue_family_entry.second.buffers, resource_util, use_readback_batches);
+                ProcessImageMemory(
+                    device_wrapper, queue_family_entry.second.images, resource_util, use_readback_batches);
+
+                if (use_readback_batches)
+                {
+                    // Submit the final batch, then retrieve the data for both batches.
+                    SubmitReadbackBatch(device_wrapper, resource_util);
+                    SubmitReadbackBatch(device_wrapper, resource_util);
+
+                    assert(recorded_readbacks_.empty() && submitted_readbacks_.empty());
+
+                    resource_util.DestroyReadbackBatches();
+                }
             }
 
             format::EndResourceInitCommand end_cmd;
@@ -2302,23 +2465,23 @@ void VulkanStateWriter::WriteCommandBufferCommands(const vulkan_wrappers::Comman
 
     if (CheckCommandHandles(wrapper, state_table))
     {
-        // Replay each of the commands that was recorded for the command buffer.
-        size_t         offset    = 0;
-        size_t         data_size = wrapper->command_data.GetDataSize();
-        const uint8_t* data      = wrapper->command_data.GetData();
+        // Replay each of the commands that was recorded for the command buffer. The command data is stored in chunks,
+        // so a command may be split between chunks and is copied out rather than accessed in place.
+        const util::ChunkedOutputStream& command_data = wrapper->command_data;
+        size_t                           offset       = 0;
+        size_t                           data_size    = command_data.GetDataSize();
 
         while (offset < data_size)
         {
-            const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
-            const format::ApiCallId* call_id =
-                reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
-            const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
+            size_t            parameter_size = 0;
+            format::ApiCallId call_id        = format::ApiCallId::ApiCall_Unknown;
 
-            parameter_stream_.Write(parameter_data, (*parameter_size));
-            WriteFunctionCall((*call_id), &parameter_stream_);
-            parameter_stream_.Clear();
+            offset += command_data.Read(offset, &parameter_size, sizeof(parameter_size));
+            offset += command_data.Read(offset, &call_id, sizeof(call_id));
+            offset += command_data.WriteTo(offset, parameter_size, &parameter_stream_);
 
-            offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
+            WriteFunctionCall(call_id, &parameter_stream_);
+            parameter_stream_.Clear();
         }
 
         assert(offset == data_size);
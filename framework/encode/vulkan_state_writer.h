@@ -47,7 +47,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    VulkanStateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    // Resources that require a staging copy are read in batches of up to readback_batch_size bytes, or individually
+    // when readback_batch_size is 0.
+    VulkanStateWriter(util::FileOutputStream* output_stream,
+                      util::Compressor*       compressor,
+                      format::ThreadId        thread_id,
+                      VkDeviceSize            readback_batch_size);
 
     ~VulkanStateWriter();
 
@@ -81,6 +86,14 @@ class VulkanStateWriter
         std::vector<ImageSnapshotInfo>  images;
     };
 
+    // Staging copy recorded to a readback batch, with the offset of its data in the batch.
+    struct PendingReadback
+    {
+        const BufferSnapshotInfo* buffer_info{ nullptr };
+        const ImageSnapshotInfo*  image_info{ nullptr };
+        uint64_t                  staging_offset{ 0 };
+    };
+
     typedef std::unordered_map<uint32_t, ResourceSnapshotInfo> ResourceSnapshotQueueFamilyTable;
     typedef std::unordered_map<const vulkan_wrappers::DeviceWrapper*, ResourceSnapshotQueueFamilyTable>
         DeviceResourceTables;
@@ -147,11 +160,30 @@ class VulkanStateWriter
 
     void ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                              const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                             graphics::VulkanResourcesUtil&         resource_util);
+                             graphics::VulkanResourcesUtil&         resource_util,
+                             bool                                   use_readback_batches);
 
     void ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                            graphics::VulkanResourcesUtil&        resource_util);
+                            graphics::VulkanResourcesUtil&        resource_util,
+                            bool                                  use_readback_batches);
+
+    VkResult RecordImageReadback(const ImageSnapshotInfo&       snapshot_entry,
+                                 graphics::VulkanResourcesUtil& resource_util,
+                                 uint64_t*                      staging_offset);
+
+    // Submits the current readback batch, and writes the data for the previously submitted batch.
+    void SubmitReadbackBatch(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                             graphics::VulkanResourcesUtil&        resource_util);
+
+    void WriteInitBufferCommand(format::HandleId                      device_id,
+                                const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                                const uint8_t*                        bytes);
+
+    void
+    WriteInitImageCommand(format::HandleId device_id, const ImageSnapshotInfo& snapshot_entry, const uint8_t* bytes);
+
+    bool NeedsStagingCopy(const ResourceSnapshotInfo& snapshot_info);
 
     void WriteBufferMemoryState(const VulkanStateTable& state_table,
                                 DeviceResourceTables*   resources,
@@ -347,13 +379,16 @@ class VulkanStateWriter
     void WriteTlasToBlasDependenciesMetadata(const VulkanStateTable& state_table);
 
   private:
-    util::FileOutputStream*  output_stream_;
-    util::Compressor*        compressor_;
-    std::vector<uint8_t>     compressed_parameter_buffer_;
-    format::ThreadId         thread_id_;
-    util::MemoryOutputStream parameter_stream_;
-    ParameterEncoder         encoder_;
-    uint64_t                 blocks_written_;
+    util::FileOutputStream*      output_stream_;
+    util::Compressor*            compressor_;
+    std::vector<uint8_t>         compressed_parameter_buffer_;
+    format::ThreadId             thread_id_;
+    util::MemoryOutputStream     parameter_stream_;
+    ParameterEncoder             encoder_;
+    uint64_t                     blocks_written_;
+    VkDeviceSize                 readback_batch_size_;
+    std::vector<PendingReadback> recorded_readbacks_;  // Copies recorded to the current readback batch.
+    std::vector<PendingReadback> submitted_readbacks_; // Copies submitted with the other readback batch.
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -0,0 +1,116 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "format/fill_memory_blob.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+uint64_t FillMemoryBlobWriter::AddBlob(const util::hash::Hash128& hash, size_t size, bool* is_new)
+{
+    assert(IsBlobSize(size) && (is_new != nullptr));
+
+    BlobKey key{ hash, size };
+
+    auto entry = blob_ids_.find(key);
+    if (entry != blob_ids_.end())
+    {
+        (*is_new) = false;
+        return entry->second;
+    }
+
+    uint64_t blob_id = next_blob_id_++;
+
+    blob_ids_.emplace(key, blob_id);
+    blob_order_.push_back(key);
+    total_size_ += size;
+
+    // Release blobs in the same order as FillMemoryBlobCache.
+    while (total_size_ > kFillMemoryBlobCacheSize)
+    {
+        const BlobKey& oldest = blob_order_.front();
+        total_size_ -= oldest.size;
+        blob_ids_.erase(oldest);
+        blob_order_.pop_front();
+    }
+
+    (*is_new) = true;
+    return blob_id;
+}
+
+void FillMemoryBlobWriter::Reset()
+{
+    blob_ids_.clear();
+    blob_order_.clear();
+    total_size_   = 0;
+    next_blob_id_ = 1;
+}
+
+void FillMemoryBlobCache::AddBlob(uint64_t blob_id, const uint8_t* data, size_t size)
+{
+    auto entry = blobs_.find(blob_id);
+    if (entry != blobs_.end())
+    {
+        // The same blob command was read again, such as when replay loops over a range of frames.
+        total_size_ -= entry->second.size();
+        entry->second.assign(data, data + size);
+        total_size_ += size;
+        return;
+    }
+
+    blobs_.emplace(blob_id, std::vector<uint8_t>(data, data + size));
+    blob_order_.push_back(blob_id);
+    total_size_ += size;
+
+    while ((total_size_ > kFillMemoryBlobCacheSize) && (blob_order_.size() > 1))
+    {
+        auto oldest = blobs_.find(blob_order_.front());
+        assert(oldest != blobs_.end());
+
+        total_size_ -= oldest->second.size();
+        blobs_.erase(oldest);
+        blob_order_.pop_front();
+    }
+}
+
+const std::vector<uint8_t>* FillMemoryBlobCache::GetBlob(uint64_t blob_id) const
+{
+    auto entry = blobs_.find(blob_id);
+    if (entry != blobs_.end())
+    {
+        return &entry->second;
+    }
+
+    return nullptr;
+}
+
+void FillMemoryBlobCache::Clear()
+{
+    blobs_.clear();
+    blob_order_.clear();
+    total_size_ = 0;
+}
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
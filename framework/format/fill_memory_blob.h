@@ -0,0 +1,111 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+/// @file Tracking of the fill memory data blobs referenced by kFillMemoryFromBlobCommand.
+
+#ifndef GFXRECON_FORMAT_FILL_MEMORY_BLOB_H
+#define GFXRECON_FORMAT_FILL_MEMORY_BLOB_H
+
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/hash.h"
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+// Readers retain at most this much blob data. When a new blob exceeds the limit, the oldest blobs are released in the
+// order that they were written to the file. Writers apply the same rule, so that they never reference a released blob.
+const size_t kFillMemoryBlobCacheSize = 64 * 1024 * 1024;
+
+// Data smaller than this is written with kFillMemoryCommand, because it saves too little to be worth tracking.
+const size_t kMinFillMemoryBlobSize = 256;
+
+/// @brief Assigns blob IDs to fill memory data when writing a capture file.
+///
+/// Data is identified by its size and 128-bit hash, without retaining a copy of the data.
+class FillMemoryBlobWriter
+{
+  public:
+    static bool IsBlobSize(size_t size)
+    {
+        return (size >= kMinFillMemoryBlobSize) && (size <= kFillMemoryBlobCacheSize);
+    }
+
+    /// @brief Returns the ID of the blob for data with the specified hash and size. is_new is set to true when the data
+    /// must be written with kFillMemoryBlobCommand, because it has not been written before or its blob was released.
+    uint64_t AddBlob(const util::hash::Hash128& hash, size_t size, bool* is_new);
+
+    /// @brief Returns true if data with the specified hash and size has a blob that has not been released.
+    bool HasBlob(const util::hash::Hash128& hash, size_t size) const
+    {
+        return (blob_ids_.find(BlobKey{ hash, size }) != blob_ids_.end());
+    }
+
+    /// @brief Forget all blobs, for a writer that is starting a new file.
+    void Reset();
+
+  private:
+    struct BlobKey
+    {
+        util::hash::Hash128 hash;
+        size_t              size;
+
+        bool operator==(const BlobKey& other) const { return (hash == other.hash) && (size == other.size); }
+    };
+
+    struct BlobKeyHash
+    {
+        size_t operator()(const BlobKey& key) const { return static_cast<size_t>(key.hash.low); }
+    };
+
+  private:
+    std::unordered_map<BlobKey, uint64_t, BlobKeyHash> blob_ids_;
+    std::deque<BlobKey>                                blob_order_; // Blobs that the reader retains, oldest first.
+    size_t                                             total_size_{ 0 };
+    uint64_t                                           next_blob_id_{ 1 };
+};
+
+/// @brief Retains blob data for kFillMemoryFromBlobCommand when reading a capture file.
+class FillMemoryBlobCache
+{
+  public:
+    void AddBlob(uint64_t blob_id, const uint8_t* data, size_t size);
+
+    /// @brief Returns nullptr if the blob has not been read, or has been released.
+    const std::vector<uint8_t>* GetBlob(uint64_t blob_id) const;
+
+    void Clear();
+
+  private:
+    std::unordered_map<uint64_t, std::vector<uint8_t>> blobs_;
+    std::deque<uint64_t>                               blob_order_;
+    size_t                                             total_size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FORMAT_FILL_MEMORY_BLOB_H
@@ -145,6 +145,9 @@ enum class MetaDataType : uint16_t
     kReserved25                             = 25,
     kDx12RuntimeInfoCommand                 = 26,
     kParentToChildDependency                = 27,
+    kSetCompressionDictionaryCommand        = 28,
+    kFillMemoryBlobCommand                  = 29,
+    kFillMemoryFromBlobCommand              = 30,
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -317,6 +320,19 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Fill memory command for data that is written to memory more than once. The kFillMemoryBlobCommand header is followed
+// by memory_size bytes of data, which are retained by the reader and identified by blob_id. The
+// kFillMemoryFromBlobCommand header has no data, and fills memory with the data of the blob identified by blob_id.
+struct FillMemoryBlobCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint64_t         blob_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Uncompressed size of the blob data.
+};
+
 struct FillMemoryResourceValueCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -640,6 +656,16 @@ struct ParentToChildDependencyHeader
     uint32_t                    child_count;
 };
 
+// Dictionary used to compress the blocks of the capture file, which is followed by dictionary_size bytes of dictionary
+// data. The block is not compressed, and must be the first block after the file header, so that it is loaded before
+// any compressed block is read, including when the file is positioned at a later frame.
+struct SetCompressionDictionaryCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint64_t         dictionary_size;
+};
+
 // Restore size_t to normal behavior.
 #undef size_t
 
@@ -25,6 +25,7 @@
 
 #include "util/logging.h"
 #include "util/lz4_compressor.h"
+#include "util/platform.h"
 #include "util/zlib_compressor.h"
 #include "util/zstd_compressor.h"
 
@@ -46,7 +47,29 @@ bool ValidateFileHeader(const FileHeader& header)
     return valid;
 }
 
+int32_t GetDefaultCompressionLevel(CompressionType type)
+{
+    switch (type)
+    {
+        case kLz4:
+            return util::Lz4Compressor::kDefaultCompressionLevel;
+        case kZlib:
+            return util::ZlibCompressor::kDefaultCompressionLevel;
+        case kZstd:
+            return util::ZstdCompressor::kDefaultCompressionLevel;
+        default:
+            break;
+    }
+
+    return 0;
+}
+
 util::Compressor* CreateCompressor(CompressionType type)
+{
+    return CreateCompressor(type, GetDefaultCompressionLevel(type));
+}
+
+util::Compressor* CreateCompressor(CompressionType type, int32_t compression_level)
 {
     util::Compressor* compressor = nullptr;
 
@@ -54,7 +77,7 @@ util::Compressor* CreateCompressor(CompressionType type)
     {
         case kLz4:
 #if defined(GFXRECON_ENABLE_LZ4_COMPRESSION)
-            compressor = new util::Lz4Compressor();
+            compressor = new util::Lz4Compressor(compression_level);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with LZ4 compression disabled.");
@@ -62,7 +85,7 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
         case kZlib:
 #if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
-            compressor = new util::ZlibCompressor();
+            compressor = new util::ZlibCompressor(compression_level);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with zlib compression disabled.");
@@ -70,7 +93,7 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
         case kZstd:
 #if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
-            compressor = new util::ZstdCompressor();
+            compressor = new util::ZstdCompressor(compression_level);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with Zstandard compression disabled.");
@@ -106,5 +129,180 @@ std::string GetCompressionTypeName(CompressionType type)
     return "";
 }
 
+// Returns the size of the data that precedes the resource data of a meta-data block with compressible contents, or 0
+// if the block does not support compression.
+static size_t GetCompressibleMetaDataHeaderSize(const std::vector<uint8_t>& block)
+{
+    MetaDataHeader meta_header;
+
+    if (block.size() < sizeof(meta_header))
+    {
+        return 0;
+    }
+
+    util::platform::MemoryCopy(&meta_header, sizeof(meta_header), block.data(), sizeof(meta_header));
+
+    size_t header_size = 0;
+
+    switch (GetMetaDataType(meta_header.meta_data_id))
+    {
+        case MetaDataType::kFillMemoryCommand:
+            header_size = sizeof(FillMemoryCommandHeader);
+            break;
+        case MetaDataType::kFillMemoryBlobCommand:
+            header_size = sizeof(FillMemoryBlobCommandHeader);
+            break;
+        case MetaDataType::kFillMemoryResourceValueCommand:
+            header_size = sizeof(FillMemoryResourceValueCommandHeader);
+            break;
+        case MetaDataType::kInitBufferCommand:
+            header_size = sizeof(InitBufferCommandHeader);
+            break;
+        case MetaDataType::kInitSubresourceCommand:
+            header_size = sizeof(InitSubresourceCommandHeader);
+            break;
+        case MetaDataType::kInitImageCommand:
+            if (block.size() >= sizeof(InitImageCommandHeader))
+            {
+                // The header is followed by the size of each mip level.
+                InitImageCommandHeader init_cmd;
+                util::platform::MemoryCopy(&init_cmd, sizeof(init_cmd), block.data(), sizeof(init_cmd));
+                header_size = sizeof(init_cmd) + (init_cmd.level_count * sizeof(uint64_t));
+            }
+            break;
+        case MetaDataType::kInitDx12AccelerationStructureCommand:
+            if (block.size() >= sizeof(InitDx12AccelerationStructureCommandHeader))
+            {
+                // The header is followed by the geometry descriptions.
+                InitDx12AccelerationStructureCommandHeader init_cmd;
+                util::platform::MemoryCopy(&init_cmd, sizeof(init_cmd), block.data(), sizeof(init_cmd));
+                header_size = sizeof(init_cmd) + (init_cmd.inputs_num_geometry_descs *
+                                                  sizeof(InitDx12AccelerationStructureGeometryDesc));
+            }
+            break;
+        default:
+            break;
+    }
+
+    return (block.size() >= header_size) ? header_size : 0;
+}
+
+size_t GetCompressibleBlockHeaderSize(const std::vector<uint8_t>& block)
+{
+    BlockHeader block_header;
+
+    if (block.size() < sizeof(block_header))
+    {
+        return 0;
+    }
+
+    util::platform::MemoryCopy(&block_header, sizeof(block_header), block.data(), sizeof(block_header));
+
+    switch (block_header.type)
+    {
+        case BlockType::kFunctionCallBlock:
+            return (block.size() >= sizeof(FunctionCallHeader)) ? sizeof(FunctionCallHeader) : 0;
+        case BlockType::kMethodCallBlock:
+            return (block.size() >= sizeof(MethodCallHeader)) ? sizeof(MethodCallHeader) : 0;
+        case BlockType::kMetaDataBlock:
+            return GetCompressibleMetaDataHeaderSize(block);
+        default:
+            return 0;
+    }
+}
+
+bool CompressBlock(util::Compressor* compressor, std::vector<uint8_t>* block, std::vector<uint8_t>* compressed_block)
+{
+    assert((compressor != nullptr) && (block != nullptr) && (compressed_block != nullptr));
+
+    if (block->size() < sizeof(BlockHeader))
+    {
+        return false;
+    }
+
+    BlockHeader block_header;
+    util::platform::MemoryCopy(&block_header, sizeof(block_header), block->data(), sizeof(block_header));
+
+    const size_t header_size            = GetCompressibleBlockHeaderSize(*block);
+    size_t       compressed_header_size = header_size;
+
+    if (block_header.type == BlockType::kFunctionCallBlock)
+    {
+        compressed_header_size = sizeof(CompressedFunctionCallHeader);
+    }
+    else if (block_header.type == BlockType::kMethodCallBlock)
+    {
+        compressed_header_size = sizeof(CompressedMethodCallHeader);
+    }
+
+    // Compressed meta-data blocks use the same header, which already includes the uncompressed size.
+
+    if ((header_size == 0) || (block->size() <= header_size))
+    {
+        return false;
+    }
+
+    const size_t uncompressed_size = block->size() - header_size;
+    const size_t compressed_size =
+        compressor->Compress(uncompressed_size, block->data() + header_size, compressed_block, compressed_header_size);
+
+    if ((compressed_size == 0) || (compressed_size >= uncompressed_size))
+    {
+        return false;
+    }
+
+    uint8_t* compressed_data = compressed_block->data();
+
+    if (block_header.type == BlockType::kFunctionCallBlock)
+    {
+        FunctionCallHeader           header;
+        CompressedFunctionCallHeader compressed_header;
+        util::platform::MemoryCopy(&header, sizeof(header), block->data(), sizeof(header));
+
+        compressed_header.block_header.type = BlockType::kCompressedFunctionCallBlock;
+        compressed_header.api_call_id       = header.api_call_id;
+        compressed_header.thread_id         = header.thread_id;
+        compressed_header.uncompressed_size = uncompressed_size;
+        compressed_header.block_header.size = sizeof(compressed_header.api_call_id) +
+                                              sizeof(compressed_header.thread_id) +
+                                              sizeof(compressed_header.uncompressed_size) + compressed_size;
+
+        util::platform::MemoryCopy(
+            compressed_data, compressed_header_size, &compressed_header, sizeof(compressed_header));
+    }
+    else if (block_header.type == BlockType::kMethodCallBlock)
+    {
+        MethodCallHeader           header;
+        CompressedMethodCallHeader compressed_header;
+        util::platform::MemoryCopy(&header, sizeof(header), block->data(), sizeof(header));
+
+        compressed_header.block_header.type = BlockType::kCompressedMethodCallBlock;
+        compressed_header.api_call_id       = header.api_call_id;
+        compressed_header.object_id         = header.object_id;
+        compressed_header.thread_id         = header.thread_id;
+        compressed_header.uncompressed_size = uncompressed_size;
+        compressed_header.block_header.size = sizeof(compressed_header.api_call_id) +
+                                              sizeof(compressed_header.object_id) +
+                                              sizeof(compressed_header.uncompressed_size) +
+                                              sizeof(compressed_header.thread_id) + compressed_size;
+
+        util::platform::MemoryCopy(
+            compressed_data, compressed_header_size, &compressed_header, sizeof(compressed_header));
+    }
+    else
+    {
+        block_header.type = BlockType::kCompressedMetaDataBlock;
+        block_header.size = (header_size - sizeof(block_header)) + compressed_size;
+
+        util::platform::MemoryCopy(compressed_data, compressed_header_size, block->data(), header_size);
+        util::platform::MemoryCopy(compressed_data, compressed_header_size, &block_header, sizeof(block_header));
+    }
+
+    compressed_block->resize(compressed_header_size + compressed_size);
+    block->swap(*compressed_block);
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -29,6 +29,7 @@
 #include "util/defines.h"
 
 #include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(format)
@@ -93,8 +94,21 @@ bool ValidateFileHeader(const FileHeader& header);
 // Utilities for object creation.
 util::Compressor* CreateCompressor(CompressionType type);
 
+util::Compressor* CreateCompressor(CompressionType type, int32_t compression_level);
+
+int32_t GetDefaultCompressionLevel(CompressionType type);
+
 std::string GetCompressionTypeName(CompressionType type);
 
+// Returns the size of the headers that precede the compressible data of an uncompressed function call, method call, or
+// resource data meta-data block, or 0 if the block does not support compression.
+size_t GetCompressibleBlockHeaderSize(const std::vector<uint8_t>& block);
+
+// Compress an uncompressed function call, method call, or resource data meta-data block, replacing the contents of
+// block with the equivalent compressed block. Blocks of other types, and blocks that do not shrink when compressed,
+// are left unchanged. The compressed_block vector is used as scratch space and may be reused across calls.
+bool CompressBlock(util::Compressor* compressor, std::vector<uint8_t>* block, std::vector<uint8_t>* compressed_block);
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
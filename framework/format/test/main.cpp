@@ -25,3 +25,82 @@
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
+
+#include "format/fill_memory_blob.h"
+#include "util/hash.h"
+
+#include <random>
+#include <vector>
+
+TEST_CASE("FillMemoryBlobWriter only references blobs that FillMemoryBlobCache retains", "[fill_memory_blob]")
+{
+    using gfxrecon::format::kFillMemoryBlobCacheSize;
+    using gfxrecon::format::kMinFillMemoryBlobSize;
+
+    const size_t   kDataCount = 48;
+    const uint32_t kBlobCount = 400;
+
+    // Data of sizes from the smallest blob to the full budget, and data that is too large to be a blob.
+    std::mt19937                          random(7);
+    std::uniform_int_distribution<size_t> small_size(kMinFillMemoryBlobSize, 64 * 1024);
+    std::uniform_int_distribution<size_t> large_size(1024 * 1024, 16 * 1024 * 1024);
+    std::vector<size_t>                   data_sizes(kDataCount);
+
+    for (size_t i = 0; i < kDataCount; ++i)
+    {
+        data_sizes[i] = ((i % 3) == 0) ? large_size(random) : small_size(random);
+    }
+
+    data_sizes[1] = kMinFillMemoryBlobSize;
+    data_sizes[2] = kFillMemoryBlobCacheSize;
+    data_sizes[4] = kFillMemoryBlobCacheSize + 1;
+
+    gfxrecon::format::FillMemoryBlobWriter writer;
+    gfxrecon::format::FillMemoryBlobCache  cache;
+    std::vector<uint8_t>                   data;
+    uint32_t                               new_blobs = 0;
+
+    // Frequently written data is more likely to be written again while its blob is retained.
+    std::discrete_distribution<size_t> data_index(kDataCount, 0.0, 1.0, [](double x) { return 1.0 / (1.0 + x * 8); });
+
+    for (uint32_t i = 0; i < kBlobCount; ++i)
+    {
+        size_t index = data_index(random);
+        size_t size  = data_sizes[index];
+
+        if (!gfxrecon::format::FillMemoryBlobWriter::IsBlobSize(size))
+        {
+            continue;
+        }
+
+        data.assign(size, static_cast<uint8_t>(index));
+        gfxrecon::util::hash::Hash128 hash = gfxrecon::util::hash::GenerateHash128(data.data(), data.size());
+
+        bool     is_new  = false;
+        uint64_t blob_id = writer.AddBlob(hash, size, &is_new);
+
+        if (is_new)
+        {
+            cache.AddBlob(blob_id, data.data(), data.size());
+            ++new_blobs;
+        }
+        else
+        {
+            const std::vector<uint8_t>* blob = cache.GetBlob(blob_id);
+            REQUIRE(blob != nullptr);
+            REQUIRE(*blob == data);
+        }
+
+        REQUIRE(writer.HasBlob(hash, size));
+    }
+
+    // Both repeated data and released blobs were encountered.
+    REQUIRE(new_blobs > kDataCount);
+    REQUIRE(new_blobs < kBlobCount);
+
+    // A writer that starts a new file assigns blob IDs from the start.
+    bool is_new = false;
+    writer.Reset();
+    REQUIRE(writer.AddBlob(gfxrecon::util::hash::Hash128{}, kMinFillMemoryBlobSize, &is_new) == 1);
+    REQUIRE(is_new);
+}
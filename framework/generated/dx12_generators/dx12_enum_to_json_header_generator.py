@@ -72,7 +72,7 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
         flag_prototypes = ''
 
         for k, v in enum_dict.items():
-            # Generate enum handler for all enums
+            # Generate enum handler for all enums, building a tree node or writing to a stream
             enum_prototypes += format_cpp_code('''inline void FieldToJson(nlohmann::ordered_json& jdata, const {0} value, const JsonOptions& options = JsonOptions())
             {{
                 FieldToJson(jdata, ToString(value), options);
@@ -81,27 +81,36 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
             {{
                 FieldToJson(jdata, *pEnum, options);
             }}
+            inline void FieldToJson(JsonStreamWriter& jdata, const {0} value, const JsonOptions& options = JsonOptions())
+            {{
+                FieldToJson(jdata, ToString(value), options);
+            }}
+            inline void FieldToJson(JsonStreamWriter& jdata, const {0}* pEnum, const JsonOptions& options = JsonOptions())
+            {{
+                FieldToJson(jdata, *pEnum, options);
+            }}
             '''.format(k))
             enum_prototypes += '\n\n'
 
             # Generate flags handler for enums identified as bitmasks
             for bits in self.BITS_LIST:
                 if k.find(bits) >= 0:
-                    flag_prototypes += format_cpp_code('''inline void FieldToJson_{0}(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
-                    {{
-                        std::string representation;
-                        if (!options.expand_flags)
+                    for json_type in ['nlohmann::ordered_json', 'JsonStreamWriter']:
+                        flag_prototypes += format_cpp_code('''inline void FieldToJson_{0}({1}& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
                         {{
-                            representation = to_hex_fixed_width(flags);
+                            std::string representation;
+                            if (!options.expand_flags)
+                            {{
+                                representation = to_hex_fixed_width(flags);
+                            }}
+                            else
+                            {{
+                                representation = ToString_{0}(flags);
+                            }}
+                            FieldToJson(jdata, representation, options);
                         }}
-                        else
-                        {{
-                            representation = ToString_{0}(flags);
-                        }}
-                        FieldToJson(jdata, representation, options);
-                    }}
-                    \n'''.format(k))
-                    flag_prototypes += '\n'
+                        \n'''.format(k, json_type))
+                        flag_prototypes += '\n'
 
         write(enum_prototypes, file=self.outFile)
         write(flag_prototypes, file=self.outFile)
@@ -112,6 +121,10 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
         {
             FieldToJson(jdata, ToString(value), options);
         }
+        inline void FieldToJson(JsonStreamWriter& jdata, const IID& value, const JsonOptions& options = JsonOptions())
+        {
+            FieldToJson(jdata, ToString(value), options);
+        }
         '''), file=self.outFile)
 
     def endFile(self):
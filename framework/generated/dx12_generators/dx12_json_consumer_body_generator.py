@@ -102,82 +102,92 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
         code = "\n" + format_cpp_code(code)
         return code
 
-    ## Generate a FieldToJson appropriate to the return type.
-    ## @param func_type Either "function" or "method" for expected use.
-    def make_return(self, func_type, return_value):
+    ## Generate a FieldToJson appropriate to the return type, writing to the block's stream after its key.
+    def make_return(self, return_value):
         if(None == return_value):
             return ""
         function_name = self.choose_field_to_json_name(return_value)
-        ret_line = "{0}({1}[format::kNameReturn], return_value, options);\n"
+        ret_line = "jdata.Key(format::kNameReturn);\n"
+        ret_line += "{0}(jdata, return_value, options);\n"
         ## if return_type.startswith("HANDLE "):
         ## This is a Windows handle, probably to a waitable object so we output it as a JSON number:
         ## <https://learn.microsoft.com/en-us/windows/win32/sysinfo/handles-and-objects>
         ## <https://learn.microsoft.com/en-us/windows/win32/sync/wait-functions>
-        ret_line = ret_line.format(function_name, func_type)
+        ret_line = ret_line.format(function_name)
         return ret_line
 
     def make_consumer_func_body(self, method_info, return_type, return_value):
         # Deal with the function's returned value:
         if return_type != 'HRESULT WINAPI':
             print ("Warning - Unexpected return type:", return_type)
-        ret_line = self.make_return("function", return_value)
+        ret_line = self.make_return(return_value)
 
         code = '''
-            nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "{}");
+            util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "{}");
             const JsonOptions& options = writer_->GetOptions();
         '''
         code += ret_line
-        code += '''nlohmann::ordered_json& args = function[format::kNameArgs];
-            {{
-        '''
-        # Generate a correct FieldToJson for each argument:
-        for parameter in method_info['parameters']:
-            value = self.get_value_info(parameter)
-            code += "    " + self.make_field_to_json("args", value, "options") + "\n"
+        code += "jdata.Key(format::kNameArgs);\n"
+        if len(method_info['parameters']) > 0:
+            code += '''jdata.BeginObject();
+                {{
+            '''
+            # Generate a correct FieldToJson for each argument:
+            for parameter in method_info['parameters']:
+                value = self.get_value_info(parameter)
+                code += self.make_field_to_json(value, "options")
+            code += "}}\n"
+            code += "jdata.EndObject();\n"
+        else:
+            # Functions always have an args entry, which is null when there are none.
+            code += "jdata.Null();\n"
 
         code += remove_leading_empty_lines('''
-                }}
-            writer_->WriteBlockEnd();
+            writer_->WriteStreamBlockEnd();
         ''')
         code = code.format(method_info['name'])
         return code
 
     def make_consumer_method_body(self, class_name, method_info, return_type, return_value):
         code = '''
-            nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "{0}", object_id, "{1}");
+            util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "{0}", object_id, "{1}");
             const JsonOptions& options = writer_->GetOptions();
         '''
 
         # Deal with the function's returned value:
-        ret_line = self.make_return("method", return_value)
+        ret_line = self.make_return(return_value)
         code += ret_line
 
         # Deal with function argumentS:
         if len(method_info['parameters']) > 0:
-            code += '''nlohmann::ordered_json& args = method[format::kNameArgs];
+            code += '''jdata.Key(format::kNameArgs);
+                jdata.BeginObject();
                 {{
             '''
             # Generate a correct FieldToJson for each argument:
             for parameter in method_info['parameters']:
                 value = self.get_value_info(parameter)
-                code += "    " + self.make_field_to_json("args", value, "options") + "\n"
+                code += self.make_field_to_json(value, "options")
             code += "}}\n"
+            code += "jdata.EndObject();\n"
 
-        code += "writer_->WriteBlockEnd();"
+        code += "writer_->WriteStreamBlockEnd();"
         code = code.format(class_name, method_info['name'])
         return code
 
+    ## Generate the key and FieldToJson for an argument written to the block's stream.
     ## @param value_info A ValueInfo object from base_generator.py.
-    def make_field_to_json(self, parent_name, value_info, options_name):
+    def make_field_to_json(self, value_info, options_name):
         function_name = self.choose_field_to_json_name(value_info)
         src = value_info.name
         ## Special case for pointers to flag sets defined by enums:
         ## (easier than having pointer decoder versions of each flagset type's FieldToString)
         if value_info.is_pointer and function_name.startswith("FieldToJson_"):
             src = "*" + src + "->GetPointer()"
-        field_to_json = '{0}({1}["{2}"], {3}, {4});'.format(function_name, parent_name, value_info.name, src, options_name)
+        field_to_json = '    jdata.Key("{0}");\n'.format(value_info.name)
+        field_to_json += '    {0}(jdata, {1}, {2});'.format(function_name, src, options_name)
         if "anon-union" in value_info.base_type:
             field_to_json += "// [anon-union] "
-            print("ALERT: anon union " + value_info.name + " in " + parent_name)
+            print("ALERT: anon union " + value_info.name + " in args")
 
-        return field_to_json
\ No newline at end of file
+        return field_to_json + "\n"
\ No newline at end of file
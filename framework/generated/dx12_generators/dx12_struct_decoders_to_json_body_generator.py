@@ -51,6 +51,7 @@
 ##       and then have a custom function body for just the FieldToJson calls.
 ##
 
+import re
 import sys
 from base_generator import write
 from dx12_base_generator import Dx12BaseGenerator
@@ -125,12 +126,49 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 FieldToJson(jdata["Depth"], obj.Depth, options);
                 FieldToJson(jdata["Stencil"], obj.Stencil, options);
             }
+
+            static void FieldToJson(util::JsonStreamWriter& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+            {
+                using namespace util;
+                jdata.BeginObject();
+                jdata.Key("AdditionalWidth");
+                FieldToJson(jdata, data.AdditionalWidth, options);
+                jdata.Key("AdditionalHeight");
+                FieldToJson(jdata, data.AdditionalHeight, options);
+                jdata.EndObject();
+            }
+
+            static void FieldToJson(util::JsonStreamWriter& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+            {
+                using namespace util;
+                jdata.BeginObject();
+                jdata.Key("AdditionalWidth");
+                FieldToJson(jdata, data.AdditionalWidth, options);
+                jdata.Key("AdditionalHeight");
+                FieldToJson(jdata, data.AdditionalHeight, options);
+                jdata.EndObject();
+            }
+
+            void FieldToJson(util::JsonStreamWriter& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
+            {
+                jdata.BeginObject();
+                jdata.Key("Depth");
+                FieldToJson(jdata, obj.Depth, options);
+                jdata.Key("Stencil");
+                FieldToJson(jdata, obj.Stencil, options);
+                jdata.EndObject();
+            }
             /** @} */
 
             inline bool RepresentBinaryFile(const util::JsonOptions& json_options, nlohmann::ordered_json& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
             {
                 return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
             }
+
+            inline bool RepresentBinaryFile(const util::JsonOptions& json_options, util::JsonStreamWriter& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
+            {
+                return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
+            }
         ''')
         write(code, file=self.outFile)
         self.newline()
@@ -149,7 +187,8 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                             const Decoded_{0}& meta_struct = *data;
                     '''.format(k))
                 body += '\n'
-                body += self.makeStructBody(k, v)
+                struct_body = self.makeStructBody(k, v)
+                body += struct_body
                 body += format_cpp_code('''
                     }
                 }
@@ -157,6 +196,62 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 body += '\n'
                 write(body, file=self.outFile)
 
+                body = format_cpp_code('''
+                    void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_{0}* data, const JsonOptions& options)
+                    {{
+                        using namespace util;
+                        if (data && data->decoded_value)
+                        {{
+                            const {0}& decoded_value = *data->decoded_value;
+                            const Decoded_{0}& meta_struct = *data;
+                            jdata.BeginObject();
+                    '''.format(k))
+                body += '\n'
+                body += self.make_stream_code(struct_body)
+                body += format_cpp_code('''
+                            jdata.EndObject();
+                        }
+                        else
+                        {
+                            jdata.Null();
+                        }
+                    }
+                ''', 2)
+                body += '\n'
+                write(body, file=self.outFile)
+
+    def make_stream_code(self, code):
+        """Convert lines of a function body which fill in a JSON tree node into the
+        equivalent calls on a JsonStreamWriter so both versions share one source.
+        A call writing to a keyed child writes the key first and is then passed the stream
+        itself. An alias bound to a child node opens an object which is closed at the
+        break of its case."""
+        stream_code = ''
+        alias = None
+        for line in code.splitlines(True):
+            statement = line.lstrip()
+            indent = line[:len(line) - len(statement)]
+            if statement.startswith('//'):
+                stream_code += line
+                continue
+            match = re.match(r'auto& (\w+) = jdata\[(.+)\];$', statement.rstrip())
+            if match:
+                alias = match.group(1)
+                stream_code += indent + 'jdata.Key({0});\n'.format(match.group(2))
+                stream_code += indent + 'jdata.BeginObject();\n'
+                continue
+            if alias and statement.rstrip() == 'break;':
+                stream_code += indent + 'jdata.EndObject();\n'
+                alias = None
+            names = 'jdata|' + alias if alias else 'jdata'
+            match = re.match(r'(.*?)\b(?:' + names + r')\[(.+?)\](.*)$', statement, re.S)
+            if match:
+                stream_code += indent + 'jdata.Key({0});\n'.format(match.group(2))
+                stream_code += indent + match.group(1) + 'jdata' + match.group(3)
+                continue
+            stream_code += line
+        return stream_code
+
     # yapf: disable
     def makeStructBody(self, name, values):
         body = ''
@@ -954,6 +1049,187 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 }
             }
 
+            void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
+            {
+                using namespace util;
+                if (data && data->decoded_value)
+                {
+                    const LARGE_INTEGER& decoded_value = *data->decoded_value;
+                    FieldToJson(jdata, decoded_value.QuadPart, options);
+                }
+                else
+                {
+                    jdata.Null();
+                }
+            }
+
+            void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_GUID* data, const JsonOptions& options)
+            {
+                using namespace util;
+                if (data && data->decoded_value)
+                {
+                    const GUID& decoded_value = *data->decoded_value;
+                    FieldToJson(jdata, decoded_value, options);
+                }
+                else
+                {
+                    jdata.Null();
+                }
+            }
+
+            void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
+            {
+                using namespace util;
+                if (data && data->decoded_value)
+                {
+                    const D3D12_PIPELINE_STATE_STREAM_DESC& decoded_value = *data->decoded_value;
+                    const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC& meta_struct = *data;
+                    jdata.BeginObject();
+                    jdata.Key("SizeInBytes");
+                    FieldToJson(jdata, decoded_value.SizeInBytes, options);
+                    jdata.Key(format::kNameWarning);
+                    FieldToJson(jdata, "D3D12_PIPELINE_STATE_STREAM_DESC.root_signature_ptr is not supported.", options);
+                    jdata.Key("root_signature_ptr");
+                    FieldToJson(jdata, "@todo Get this field to convert cleanly.", options);
+                    jdata.Key("vs_bytecode");
+                    FieldToJson(jdata, meta_struct.vs_bytecode, options);
+                    jdata.Key("ps_bytecode");
+                    FieldToJson(jdata, meta_struct.ps_bytecode, options);
+                    jdata.Key("ds_bytecode");
+                    FieldToJson(jdata, meta_struct.ds_bytecode, options);
+                    jdata.Key("hs_bytecode");
+                    FieldToJson(jdata, meta_struct.hs_bytecode, options);
+                    jdata.Key("gs_bytecode");
+                    FieldToJson(jdata, meta_struct.gs_bytecode, options);
+                    jdata.Key("cs_bytecode");
+                    FieldToJson(jdata, meta_struct.cs_bytecode, options);
+                    jdata.Key("as_bytecode");
+                    FieldToJson(jdata, meta_struct.as_bytecode, options);
+                    jdata.Key("ms_bytecode");
+                    FieldToJson(jdata, meta_struct.ms_bytecode, options);
+                    jdata.Key("stream_output");
+                    FieldToJson(jdata, meta_struct.stream_output, options);
+                    jdata.Key("blend");
+                    FieldToJson(jdata, meta_struct.blend, options);
+                    jdata.Key("rasterizer");
+                    FieldToJson(jdata, meta_struct.rasterizer, options);
+                    jdata.Key("depth_stencil");
+                    FieldToJson(jdata, meta_struct.depth_stencil, options);
+                    jdata.Key("input_layout");
+                    FieldToJson(jdata, meta_struct.input_layout, options);
+                    jdata.Key("render_target_formats");
+                    FieldToJson(jdata, meta_struct.render_target_formats, options);
+                    jdata.Key("sample_desc");
+                    FieldToJson(jdata, meta_struct.sample_desc, options);
+                    jdata.Key("cached_pso");
+                    FieldToJson(jdata, meta_struct.cached_pso, options);
+                    jdata.Key("depth_stencil1");
+                    FieldToJson(jdata, meta_struct.depth_stencil1, options);
+                    jdata.Key("view_instancing");
+                    FieldToJson(jdata, meta_struct.view_instancing, options);
+                    jdata.EndObject();
+                }
+                else
+                {
+                    jdata.Null();
+                }
+            }
+
+            void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
+            {
+                using namespace util;
+                if (data && data->decoded_value)
+                {
+                    const D3D12_STATE_SUBOBJECT& decoded_value = *data->decoded_value;
+                    const Decoded_D3D12_STATE_SUBOBJECT& meta_struct = *data;
+                    jdata.BeginObject();
+                    jdata.Key("Type");
+                    FieldToJson(jdata, decoded_value.Type, options);
+                    switch(decoded_value.Type)
+                    {
+                        case D3D12_STATE_SUBOBJECT_TYPE_STATE_OBJECT_CONFIG:
+                        jdata.Key("state_object_config");
+                        FieldToJson(jdata, meta_struct.state_object_config, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_GLOBAL_ROOT_SIGNATURE:
+                        jdata.Key("global_root_signature");
+                        FieldToJson(jdata, meta_struct.global_root_signature, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_LOCAL_ROOT_SIGNATURE:
+                        jdata.Key("local_root_signature");
+                        FieldToJson(jdata, meta_struct.local_root_signature, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_NODE_MASK:
+                        jdata.Key("node_mask");
+                        FieldToJson(jdata, meta_struct.node_mask, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY:
+                        jdata.Key("dxil_library_desc");
+                        FieldToJson(jdata, meta_struct.dxil_library_desc, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_EXISTING_COLLECTION:
+                        jdata.Key("existing_collection_desc");
+                        FieldToJson(jdata, meta_struct.existing_collection_desc, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
+                        jdata.Key("subobject_to_exports_association");
+                        FieldToJson(jdata, meta_struct.subobject_to_exports_association, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
+                        jdata.Key("dxil_subobject_to_exports_association");
+                        FieldToJson(jdata, meta_struct.dxil_subobject_to_exports_association, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_SHADER_CONFIG:
+                        jdata.Key("raytracing_shader_config");
+                        FieldToJson(jdata, meta_struct.raytracing_shader_config, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG:
+                        jdata.Key("raytracing_pipeline_config");
+                        FieldToJson(jdata, meta_struct.raytracing_pipeline_config, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP:
+                        jdata.Key("hit_group_desc");
+                        FieldToJson(jdata, meta_struct.hit_group_desc, options);
+                        break;
+                        case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG1:
+                        jdata.Key("raytracing_pipeline_config1");
+                        FieldToJson(jdata, meta_struct.raytracing_pipeline_config1, options);
+                        break;
+                        default:
+                        {
+                            jdata.Key(format::kNameWarning);
+                            FieldToJson(jdata, "Unknown D3D12_STATE_SUBOBJECT_TYPE in D3D12_STATE_SUBOBJECT.", options);
+                            break;
+                        }
+                    }
+                    jdata.EndObject();
+                }
+                else
+                {
+                    jdata.Null();
+                }
+            }
+
+            void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+            {
+                using namespace util;
+                if (data && data->decoded_value)
+                {
+                    const D3D12_CPU_DESCRIPTOR_HANDLE& decoded_value = *data->decoded_value;
+                    const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE& meta_struct = *data;
+                    jdata.BeginObject();
+                    jdata.Key("heap_id");
+                    FieldToJson(jdata, meta_struct.heap_id, options);
+                    jdata.Key("index");
+                    FieldToJson(jdata, meta_struct.index, options);
+                    jdata.EndObject();
+                }
+                else
+                {
+                    jdata.Null();
+                }
+            }
+
             /** @} */
         ''') + '\n'
         write(custom_impls, file=self.outFile)
@@ -61,6 +61,7 @@ class Dx12StructDecodersToJsonHeaderGenerator(Dx12BaseGenerator):
             GFXRECON_BEGIN_NAMESPACE(gfxrecon)
             GFXRECON_BEGIN_NAMESPACE(util)
             struct JsonOptions;
+            class JsonStreamWriter;
             GFXRECON_END_NAMESPACE(util)
             GFXRECON_BEGIN_NAMESPACE(decode)
         ''')
@@ -74,9 +75,10 @@ class Dx12StructDecodersToJsonHeaderGenerator(Dx12BaseGenerator):
         '''))
         for k, v in struct_dict.items():
             if not self.is_struct_black_listed(k):
-                body = 'void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* pObj, const util::JsonOptions& options);'.format(k)
-                ref_wrappers += 'inline void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}& obj, const util::JsonOptions& options){{ FieldToJson(jdata, &obj, options); }}\n'.format(k)
-                write(body, file=self.outFile)
+                for json_type in ['nlohmann::ordered_json', 'util::JsonStreamWriter']:
+                    body = 'void FieldToJson({1}& jdata, const Decoded_{0}* pObj, const util::JsonOptions& options);'.format(k, json_type)
+                    ref_wrappers += 'inline void FieldToJson({1}& jdata, const Decoded_{0}& obj, const util::JsonOptions& options){{ FieldToJson(jdata, &obj, options); }}\n'.format(k, json_type)
+                    write(body, file=self.outFile)
         write(ref_wrappers, file=self.outFile)
 
     def endFile(self):
@@ -88,6 +90,8 @@ class Dx12StructDecodersToJsonHeaderGenerator(Dx12BaseGenerator):
         /// <winnt.h> Named union type with two structs and a uint64_t inside.
         void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER* pObj, const util::JsonOptions& options);
         inline void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER& obj, const util::JsonOptions& options){ FieldToJson(jdata, &obj, options); }
+        void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_LARGE_INTEGER* pObj, const util::JsonOptions& options);
+        inline void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_LARGE_INTEGER& obj, const util::JsonOptions& options){ FieldToJson(jdata, &obj, options); }
         '''
         custom_to_fields = format_cpp_code(custom_to_fields)
         write(custom_to_fields, file=self.outFile)
@@ -49,15 +49,20 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "CreateDXGIFactory");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFactory"], ppFactory, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppFactory");
+        FieldToJson(jdata, ppFactory, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -69,15 +74,20 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "CreateDXGIFactory1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFactory"], ppFactory, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppFactory");
+        FieldToJson(jdata, ppFactory, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -91,16 +101,22 @@ void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["DataSize"], DataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, Name, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateDataInterface(
@@ -112,15 +128,20 @@ void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateDataInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateDataInterface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateDataInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["pUnknown"], pUnknown, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, Name, options);
+        jdata.Key("pUnknown");
+        FieldToJson(jdata, pUnknown, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIObject_GetPrivateData(
@@ -133,16 +154,22 @@ void Dx12JsonConsumer::Process_IDXGIObject_GetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetPrivateData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIObject", object_id, "GetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["pDataSize"], pDataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, Name, options);
+        jdata.Key("pDataSize");
+        FieldToJson(jdata, pDataSize, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIObject_GetParent(
@@ -154,15 +181,20 @@ void Dx12JsonConsumer::Process_IDXGIObject_GetParent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetParent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIObject", object_id, "GetParent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppParent"], ppParent, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppParent");
+        FieldToJson(jdata, ppParent, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDeviceSubObject_GetDevice(
@@ -174,15 +206,20 @@ void Dx12JsonConsumer::Process_IDXGIDeviceSubObject_GetDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDeviceSubObject", object_id, "GetDevice");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDeviceSubObject", object_id, "GetDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppDevice"], ppDevice, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppDevice");
+        FieldToJson(jdata, ppDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIResource_GetSharedHandle(
@@ -193,14 +230,18 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetSharedHandle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIResource", object_id, "GetSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pSharedHandle"], pSharedHandle, options);
+        jdata.Key("pSharedHandle");
+        FieldToJson(jdata, pSharedHandle, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIResource_GetUsage(
@@ -211,14 +252,18 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetUsage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetUsage");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIResource", object_id, "GetUsage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pUsage"], pUsage, options);
+        jdata.Key("pUsage");
+        FieldToJson(jdata, pUsage, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIResource_SetEvictionPriority(
@@ -229,14 +274,18 @@ void Dx12JsonConsumer::Process_IDXGIResource_SetEvictionPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "SetEvictionPriority");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIResource", object_id, "SetEvictionPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["EvictionPriority"], EvictionPriority, options);
+        jdata.Key("EvictionPriority");
+        FieldToJson(jdata, EvictionPriority, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIResource_GetEvictionPriority(
@@ -247,14 +296,18 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetEvictionPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetEvictionPriority");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIResource", object_id, "GetEvictionPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pEvictionPriority"], pEvictionPriority, options);
+        jdata.Key("pEvictionPriority");
+        FieldToJson(jdata, pEvictionPriority, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIKeyedMutex_AcquireSync(
@@ -266,15 +319,20 @@ void Dx12JsonConsumer::Process_IDXGIKeyedMutex_AcquireSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "AcquireSync");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "AcquireSync");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Key"], Key, options);
-        FieldToJson(args["dwMilliseconds"], dwMilliseconds, options);
+        jdata.Key("Key");
+        FieldToJson(jdata, Key, options);
+        jdata.Key("dwMilliseconds");
+        FieldToJson(jdata, dwMilliseconds, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIKeyedMutex_ReleaseSync(
@@ -285,14 +343,18 @@ void Dx12JsonConsumer::Process_IDXGIKeyedMutex_ReleaseSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "ReleaseSync");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "ReleaseSync");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Key"], Key, options);
+        jdata.Key("Key");
+        FieldToJson(jdata, Key, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISurface_GetDesc(
@@ -303,14 +365,18 @@ void Dx12JsonConsumer::Process_IDXGISurface_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISurface", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISurface_Map(
@@ -322,15 +388,20 @@ void Dx12JsonConsumer::Process_IDXGISurface_Map(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Map");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISurface", object_id, "Map");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pLockedRect"], pLockedRect, options);
-        FieldToJson(args["MapFlags"], MapFlags, options);
+        jdata.Key("pLockedRect");
+        FieldToJson(jdata, pLockedRect, options);
+        jdata.Key("MapFlags");
+        FieldToJson(jdata, MapFlags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISurface_Unmap(
@@ -340,10 +411,11 @@ void Dx12JsonConsumer::Process_IDXGISurface_Unmap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Unmap");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISurface", object_id, "Unmap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISurface1_GetDC(
@@ -355,15 +427,20 @@ void Dx12JsonConsumer::Process_IDXGISurface1_GetDC(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "GetDC");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISurface1", object_id, "GetDC");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Discard"], Discard, options);
-        FieldToJson(args["phdc"], phdc, options);
+        jdata.Key("Discard");
+        Bool32ToJson(jdata, Discard, options);
+        jdata.Key("phdc");
+        FieldToJson(jdata, phdc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISurface1_ReleaseDC(
@@ -374,14 +451,18 @@ void Dx12JsonConsumer::Process_IDXGISurface1_ReleaseDC(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "ReleaseDC");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISurface1", object_id, "ReleaseDC");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDirtyRect"], pDirtyRect, options);
+        jdata.Key("pDirtyRect");
+        FieldToJson(jdata, pDirtyRect, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter_EnumOutputs(
@@ -393,15 +474,20 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_EnumOutputs(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "EnumOutputs");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter", object_id, "EnumOutputs");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Output"], Output, options);
-        FieldToJson(args["ppOutput"], ppOutput, options);
+        jdata.Key("Output");
+        FieldToJson(jdata, Output, options);
+        jdata.Key("ppOutput");
+        FieldToJson(jdata, ppOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter_GetDesc(
@@ -412,14 +498,18 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter_CheckInterfaceSupport(
@@ -431,15 +521,20 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_CheckInterfaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "CheckInterfaceSupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter", object_id, "CheckInterfaceSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["InterfaceName"], InterfaceName, options);
-        FieldToJson(args["pUMDVersion"], pUMDVersion, options);
+        jdata.Key("InterfaceName");
+        FieldToJson(jdata, InterfaceName, options);
+        jdata.Key("pUMDVersion");
+        FieldToJson(jdata, pUMDVersion, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_GetDesc(
@@ -450,14 +545,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplayModeList(
@@ -471,17 +570,24 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplayModeList(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplayModeList");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplayModeList");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["EnumFormat"], EnumFormat, options);
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["pNumModes"], pNumModes, options);
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("EnumFormat");
+        FieldToJson(jdata, EnumFormat, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
+        jdata.Key("pNumModes");
+        FieldToJson(jdata, pNumModes, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_FindClosestMatchingMode(
@@ -494,16 +600,22 @@ void Dx12JsonConsumer::Process_IDXGIOutput_FindClosestMatchingMode(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "FindClosestMatchingMode");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "FindClosestMatchingMode");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pModeToMatch"], pModeToMatch, options);
-        FieldToJson(args["pClosestMatch"], pClosestMatch, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
+        jdata.Key("pModeToMatch");
+        FieldToJson(jdata, pModeToMatch, options);
+        jdata.Key("pClosestMatch");
+        FieldToJson(jdata, pClosestMatch, options);
+        jdata.Key("pConcernedDevice");
+        FieldToJson(jdata, pConcernedDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_WaitForVBlank(
@@ -513,10 +625,11 @@ void Dx12JsonConsumer::Process_IDXGIOutput_WaitForVBlank(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "WaitForVBlank");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "WaitForVBlank");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_TakeOwnership(
@@ -528,15 +641,20 @@ void Dx12JsonConsumer::Process_IDXGIOutput_TakeOwnership(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "TakeOwnership");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "TakeOwnership");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        Bool32ToJson(args["Exclusive"], Exclusive, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("Exclusive");
+        Bool32ToJson(jdata, Exclusive, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_ReleaseOwnership(
@@ -545,9 +663,9 @@ void Dx12JsonConsumer::Process_IDXGIOutput_ReleaseOwnership(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "ReleaseOwnership");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "ReleaseOwnership");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControlCapabilities(
@@ -558,14 +676,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControlCapabilities(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControlCapabilities");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControlCapabilities");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pGammaCaps"], pGammaCaps, options);
+        jdata.Key("pGammaCaps");
+        FieldToJson(jdata, pGammaCaps, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_SetGammaControl(
@@ -576,14 +698,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_SetGammaControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetGammaControl");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "SetGammaControl");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pArray"], pArray, options);
+        jdata.Key("pArray");
+        FieldToJson(jdata, pArray, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControl(
@@ -594,14 +720,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControl");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControl");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pArray"], pArray, options);
+        jdata.Key("pArray");
+        FieldToJson(jdata, pArray, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_SetDisplaySurface(
@@ -612,14 +742,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_SetDisplaySurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetDisplaySurface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "SetDisplaySurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pScanoutSurface"], pScanoutSurface, options);
+        jdata.Key("pScanoutSurface");
+        FieldToJson(jdata, pScanoutSurface, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplaySurfaceData(
@@ -630,14 +764,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplaySurfaceData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplaySurfaceData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplaySurfaceData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDestination"], pDestination, options);
+        jdata.Key("pDestination");
+        FieldToJson(jdata, pDestination, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput_GetFrameStatistics(
@@ -648,14 +786,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetFrameStatistics(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetFrameStatistics");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput", object_id, "GetFrameStatistics");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pStats"], pStats, options);
+        jdata.Key("pStats");
+        FieldToJson(jdata, pStats, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_Present(
@@ -667,15 +809,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_Present(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "Present");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "Present");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["SyncInterval"], SyncInterval, options);
-        FieldToJson(args["Flags"], Flags, options);
+        jdata.Key("SyncInterval");
+        FieldToJson(jdata, SyncInterval, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_GetBuffer(
@@ -688,16 +835,22 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetBuffer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "GetBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Buffer"], Buffer, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppSurface"], ppSurface, options);
+        jdata.Key("Buffer");
+        FieldToJson(jdata, Buffer, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppSurface");
+        FieldToJson(jdata, ppSurface, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_SetFullscreenState(
@@ -709,15 +862,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_SetFullscreenState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "SetFullscreenState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "SetFullscreenState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Fullscreen"], Fullscreen, options);
-        FieldToJson(args["pTarget"], pTarget, options);
+        jdata.Key("Fullscreen");
+        Bool32ToJson(jdata, Fullscreen, options);
+        jdata.Key("pTarget");
+        FieldToJson(jdata, pTarget, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_GetFullscreenState(
@@ -729,15 +887,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetFullscreenState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFullscreenState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFullscreenState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["pFullscreen"], pFullscreen, options);
-        FieldToJson(args["ppTarget"], ppTarget, options);
+        jdata.Key("pFullscreen");
+        Bool32ToJson(jdata, pFullscreen, options);
+        jdata.Key("ppTarget");
+        FieldToJson(jdata, ppTarget, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_GetDesc(
@@ -748,14 +911,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeBuffers(
@@ -770,18 +937,26 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeBuffers(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeBuffers");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeBuffers");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["BufferCount"], BufferCount, options);
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
-        FieldToJson(args["NewFormat"], NewFormat, options);
-        FieldToJson(args["SwapChainFlags"], SwapChainFlags, options);
+        jdata.Key("BufferCount");
+        FieldToJson(jdata, BufferCount, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, Height, options);
+        jdata.Key("NewFormat");
+        FieldToJson(jdata, NewFormat, options);
+        jdata.Key("SwapChainFlags");
+        FieldToJson(jdata, SwapChainFlags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeTarget(
@@ -792,14 +967,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeTarget(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeTarget");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeTarget");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pNewTargetParameters"], pNewTargetParameters, options);
+        jdata.Key("pNewTargetParameters");
+        FieldToJson(jdata, pNewTargetParameters, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_GetContainingOutput(
@@ -810,14 +989,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetContainingOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetContainingOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "GetContainingOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ppOutput"], ppOutput, options);
+        jdata.Key("ppOutput");
+        FieldToJson(jdata, ppOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_GetFrameStatistics(
@@ -828,14 +1011,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetFrameStatistics(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFrameStatistics");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFrameStatistics");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pStats"], pStats, options);
+        jdata.Key("pStats");
+        FieldToJson(jdata, pStats, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain_GetLastPresentCount(
@@ -846,14 +1033,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetLastPresentCount(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetLastPresentCount");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain", object_id, "GetLastPresentCount");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pLastPresentCount"], pLastPresentCount, options);
+        jdata.Key("pLastPresentCount");
+        FieldToJson(jdata, pLastPresentCount, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory_EnumAdapters(
@@ -865,15 +1056,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory_EnumAdapters(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "EnumAdapters");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory", object_id, "EnumAdapters");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Adapter"], Adapter, options);
-        FieldToJson(args["ppAdapter"], ppAdapter, options);
+        jdata.Key("Adapter");
+        FieldToJson(jdata, Adapter, options);
+        jdata.Key("ppAdapter");
+        FieldToJson(jdata, ppAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory_MakeWindowAssociation(
@@ -885,15 +1081,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory_MakeWindowAssociation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "MakeWindowAssociation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory", object_id, "MakeWindowAssociation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["WindowHandle"], WindowHandle, options);
-        FieldToJson(args["Flags"], Flags, options);
+        jdata.Key("WindowHandle");
+        FieldToJson(jdata, WindowHandle, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory_GetWindowAssociation(
@@ -904,14 +1105,18 @@ void Dx12JsonConsumer::Process_IDXGIFactory_GetWindowAssociation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "GetWindowAssociation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory", object_id, "GetWindowAssociation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pWindowHandle"], pWindowHandle, options);
+        jdata.Key("pWindowHandle");
+        FieldToJson(jdata, pWindowHandle, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory_CreateSwapChain(
@@ -924,16 +1129,22 @@ void Dx12JsonConsumer::Process_IDXGIFactory_CreateSwapChain(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSwapChain");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSwapChain");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("ppSwapChain");
+        FieldToJson(jdata, ppSwapChain, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory_CreateSoftwareAdapter(
@@ -945,15 +1156,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory_CreateSoftwareAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSoftwareAdapter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSoftwareAdapter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Module"], Module, options);
-        FieldToJson(args["ppAdapter"], ppAdapter, options);
+        jdata.Key("Module");
+        FieldToJson(jdata, Module, options);
+        jdata.Key("ppAdapter");
+        FieldToJson(jdata, ppAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice_GetAdapter(
@@ -964,14 +1180,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice_GetAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetAdapter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice", object_id, "GetAdapter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pAdapter"], pAdapter, options);
+        jdata.Key("pAdapter");
+        FieldToJson(jdata, pAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice_CreateSurface(
@@ -986,18 +1206,26 @@ void Dx12JsonConsumer::Process_IDXGIDevice_CreateSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "CreateSurface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice", object_id, "CreateSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["NumSurfaces"], NumSurfaces, options);
-        FieldToJson(args["Usage"], Usage, options);
-        FieldToJson(args["pSharedResource"], pSharedResource, options);
-        FieldToJson(args["ppSurface"], ppSurface, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("NumSurfaces");
+        FieldToJson(jdata, NumSurfaces, options);
+        jdata.Key("Usage");
+        FieldToJson(jdata, Usage, options);
+        jdata.Key("pSharedResource");
+        FieldToJson(jdata, pSharedResource, options);
+        jdata.Key("ppSurface");
+        FieldToJson(jdata, ppSurface, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice_QueryResourceResidency(
@@ -1010,16 +1238,22 @@ void Dx12JsonConsumer::Process_IDXGIDevice_QueryResourceResidency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "QueryResourceResidency");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice", object_id, "QueryResourceResidency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["pResidencyStatus"], pResidencyStatus, options);
-        FieldToJson(args["NumResources"], NumResources, options);
+        jdata.Key("ppResources");
+        FieldToJson(jdata, ppResources, options);
+        jdata.Key("pResidencyStatus");
+        FieldToJson(jdata, pResidencyStatus, options);
+        jdata.Key("NumResources");
+        FieldToJson(jdata, NumResources, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice_SetGPUThreadPriority(
@@ -1030,14 +1264,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice_SetGPUThreadPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "SetGPUThreadPriority");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice", object_id, "SetGPUThreadPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Priority"], Priority, options);
+        jdata.Key("Priority");
+        FieldToJson(jdata, Priority, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice_GetGPUThreadPriority(
@@ -1048,14 +1286,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice_GetGPUThreadPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetGPUThreadPriority");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice", object_id, "GetGPUThreadPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pPriority"], pPriority, options);
+        jdata.Key("pPriority");
+        FieldToJson(jdata, pPriority, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory1_EnumAdapters1(
@@ -1067,15 +1309,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory1_EnumAdapters1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "EnumAdapters1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory1", object_id, "EnumAdapters1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Adapter"], Adapter, options);
-        FieldToJson(args["ppAdapter"], ppAdapter, options);
+        jdata.Key("Adapter");
+        FieldToJson(jdata, Adapter, options);
+        jdata.Key("ppAdapter");
+        FieldToJson(jdata, ppAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory1_IsCurrent(
@@ -1085,10 +1332,11 @@ void Dx12JsonConsumer::Process_IDXGIFactory1_IsCurrent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "IsCurrent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory1", object_id, "IsCurrent");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter1_GetDesc1(
@@ -1099,14 +1347,18 @@ void Dx12JsonConsumer::Process_IDXGIAdapter1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter1", object_id, "GetDesc1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice1_SetMaximumFrameLatency(
@@ -1117,14 +1369,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice1_SetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "SetMaximumFrameLatency");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice1", object_id, "SetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["MaxLatency"], MaxLatency, options);
+        jdata.Key("MaxLatency");
+        FieldToJson(jdata, MaxLatency, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice1_GetMaximumFrameLatency(
@@ -1135,14 +1391,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice1_GetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "GetMaximumFrameLatency");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice1", object_id, "GetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pMaxLatency"], pMaxLatency, options);
+        jdata.Key("pMaxLatency");
+        FieldToJson(jdata, pMaxLatency, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -1156,10 +1416,11 @@ void Dx12JsonConsumer::Process_IDXGIDisplayControl_IsStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "IsStereoEnabled");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDisplayControl", object_id, "IsStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDisplayControl_SetStereoEnabled(
@@ -1169,13 +1430,16 @@ void Dx12JsonConsumer::Process_IDXGIDisplayControl_SetStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "SetStereoEnabled");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDisplayControl", object_id, "SetStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["enabled"], enabled, options);
+        jdata.Key("enabled");
+        Bool32ToJson(jdata, enabled, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetDesc(
@@ -1185,13 +1449,16 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_AcquireNextFrame(
@@ -1204,16 +1471,22 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_AcquireNextFrame(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "AcquireNextFrame");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "AcquireNextFrame");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["TimeoutInMilliseconds"], TimeoutInMilliseconds, options);
-        FieldToJson(args["pFrameInfo"], pFrameInfo, options);
-        FieldToJson(args["ppDesktopResource"], ppDesktopResource, options);
+        jdata.Key("TimeoutInMilliseconds");
+        FieldToJson(jdata, TimeoutInMilliseconds, options);
+        jdata.Key("pFrameInfo");
+        FieldToJson(jdata, pFrameInfo, options);
+        jdata.Key("ppDesktopResource");
+        FieldToJson(jdata, ppDesktopResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameDirtyRects(
@@ -1226,16 +1499,22 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameDirtyRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameDirtyRects");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameDirtyRects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["DirtyRectsBufferSize"], DirtyRectsBufferSize, options);
-        FieldToJson(args["pDirtyRectsBuffer"], pDirtyRectsBuffer, options);
-        FieldToJson(args["pDirtyRectsBufferSizeRequired"], pDirtyRectsBufferSizeRequired, options);
+        jdata.Key("DirtyRectsBufferSize");
+        FieldToJson(jdata, DirtyRectsBufferSize, options);
+        jdata.Key("pDirtyRectsBuffer");
+        FieldToJson(jdata, pDirtyRectsBuffer, options);
+        jdata.Key("pDirtyRectsBufferSizeRequired");
+        FieldToJson(jdata, pDirtyRectsBufferSizeRequired, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameMoveRects(
@@ -1248,16 +1527,22 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameMoveRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameMoveRects");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameMoveRects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["MoveRectsBufferSize"], MoveRectsBufferSize, options);
-        FieldToJson(args["pMoveRectBuffer"], pMoveRectBuffer, options);
-        FieldToJson(args["pMoveRectsBufferSizeRequired"], pMoveRectsBufferSizeRequired, options);
+        jdata.Key("MoveRectsBufferSize");
+        FieldToJson(jdata, MoveRectsBufferSize, options);
+        jdata.Key("pMoveRectBuffer");
+        FieldToJson(jdata, pMoveRectBuffer, options);
+        jdata.Key("pMoveRectsBufferSizeRequired");
+        FieldToJson(jdata, pMoveRectsBufferSizeRequired, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFramePointerShape(
@@ -1271,17 +1556,24 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFramePointerShape(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFramePointerShape");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFramePointerShape");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["PointerShapeBufferSize"], PointerShapeBufferSize, options);
-        FieldToJson(args["pPointerShapeBuffer"], pPointerShapeBuffer, options);
-        FieldToJson(args["pPointerShapeBufferSizeRequired"], pPointerShapeBufferSizeRequired, options);
-        FieldToJson(args["pPointerShapeInfo"], pPointerShapeInfo, options);
+        jdata.Key("PointerShapeBufferSize");
+        FieldToJson(jdata, PointerShapeBufferSize, options);
+        jdata.Key("pPointerShapeBuffer");
+        FieldToJson(jdata, pPointerShapeBuffer, options);
+        jdata.Key("pPointerShapeBufferSizeRequired");
+        FieldToJson(jdata, pPointerShapeBufferSizeRequired, options);
+        jdata.Key("pPointerShapeInfo");
+        FieldToJson(jdata, pPointerShapeInfo, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_MapDesktopSurface(
@@ -1292,14 +1584,18 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_MapDesktopSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "MapDesktopSurface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "MapDesktopSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pLockedRect"], pLockedRect, options);
+        jdata.Key("pLockedRect");
+        FieldToJson(jdata, pLockedRect, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_UnMapDesktopSurface(
@@ -1309,10 +1605,11 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_UnMapDesktopSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "UnMapDesktopSurface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "UnMapDesktopSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutputDuplication_ReleaseFrame(
@@ -1322,10 +1619,11 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_ReleaseFrame(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "ReleaseFrame");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "ReleaseFrame");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISurface2_GetResource(
@@ -1338,16 +1636,22 @@ void Dx12JsonConsumer::Process_IDXGISurface2_GetResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface2", object_id, "GetResource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISurface2", object_id, "GetResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppParentResource"], ppParentResource, options);
-        FieldToJson(args["pSubresourceIndex"], pSubresourceIndex, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppParentResource");
+        FieldToJson(jdata, ppParentResource, options);
+        jdata.Key("pSubresourceIndex");
+        FieldToJson(jdata, pSubresourceIndex, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIResource1_CreateSubresourceSurface(
@@ -1359,15 +1663,20 @@ void Dx12JsonConsumer::Process_IDXGIResource1_CreateSubresourceSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSubresourceSurface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSubresourceSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["index"], index, options);
-        FieldToJson(args["ppSurface"], ppSurface, options);
+        jdata.Key("index");
+        FieldToJson(jdata, index, options);
+        jdata.Key("ppSurface");
+        FieldToJson(jdata, ppSurface, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIResource1_CreateSharedHandle(
@@ -1381,17 +1690,24 @@ void Dx12JsonConsumer::Process_IDXGIResource1_CreateSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSharedHandle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pAttributes"], pAttributes, options);
-        FieldToJson(args["dwAccess"], dwAccess, options);
-        FieldToJson(args["lpName"], lpName, options);
-        FieldToJson(args["pHandle"], pHandle, options);
+        jdata.Key("pAttributes");
+        FieldToJson(jdata, pAttributes, options);
+        jdata.Key("dwAccess");
+        FieldToJson(jdata, dwAccess, options);
+        jdata.Key("lpName");
+        FieldToJson(jdata, lpName, options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice2_OfferResources(
@@ -1404,16 +1720,22 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_OfferResources(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "OfferResources");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice2", object_id, "OfferResources");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["Priority"], Priority, options);
+        jdata.Key("NumResources");
+        FieldToJson(jdata, NumResources, options);
+        jdata.Key("ppResources");
+        FieldToJson(jdata, ppResources, options);
+        jdata.Key("Priority");
+        FieldToJson(jdata, Priority, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice2_ReclaimResources(
@@ -1426,16 +1748,22 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_ReclaimResources(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "ReclaimResources");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice2", object_id, "ReclaimResources");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        Bool32ToJson(args["pDiscarded"], pDiscarded, options);
+        jdata.Key("NumResources");
+        FieldToJson(jdata, NumResources, options);
+        jdata.Key("ppResources");
+        FieldToJson(jdata, ppResources, options);
+        jdata.Key("pDiscarded");
+        Bool32ToJson(jdata, pDiscarded, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice2_EnqueueSetEvent(
@@ -1446,14 +1774,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_EnqueueSetEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "EnqueueSetEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice2", object_id, "EnqueueSetEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetDesc1(
@@ -1464,14 +1796,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetDesc1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetFullscreenDesc(
@@ -1482,14 +1818,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetFullscreenDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetFullscreenDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetFullscreenDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetHwnd(
@@ -1500,14 +1840,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetHwnd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetHwnd");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetHwnd");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHwnd"], pHwnd, options);
+        jdata.Key("pHwnd");
+        FieldToJson(jdata, pHwnd, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetCoreWindow(
@@ -1519,15 +1863,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetCoreWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetCoreWindow");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetCoreWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["refiid"], refiid, options);
-        FieldToJson(args["ppUnk"], ppUnk, options);
+        jdata.Key("refiid");
+        FieldToJson(jdata, refiid, options);
+        jdata.Key("ppUnk");
+        FieldToJson(jdata, ppUnk, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_Present1(
@@ -1540,16 +1889,22 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_Present1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "Present1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "Present1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["SyncInterval"], SyncInterval, options);
-        FieldToJson(args["PresentFlags"], PresentFlags, options);
-        FieldToJson(args["pPresentParameters"], pPresentParameters, options);
+        jdata.Key("SyncInterval");
+        FieldToJson(jdata, SyncInterval, options);
+        jdata.Key("PresentFlags");
+        FieldToJson(jdata, PresentFlags, options);
+        jdata.Key("pPresentParameters");
+        FieldToJson(jdata, pPresentParameters, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_IsTemporaryMonoSupported(
@@ -1559,10 +1914,11 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_IsTemporaryMonoSupported(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "IsTemporaryMonoSupported");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "IsTemporaryMonoSupported");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRestrictToOutput(
@@ -1573,14 +1929,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRestrictToOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRestrictToOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRestrictToOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ppRestrictToOutput"], ppRestrictToOutput, options);
+        jdata.Key("ppRestrictToOutput");
+        FieldToJson(jdata, ppRestrictToOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_SetBackgroundColor(
@@ -1591,14 +1951,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_SetBackgroundColor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetBackgroundColor");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetBackgroundColor");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pColor"], pColor, options);
+        jdata.Key("pColor");
+        FieldToJson(jdata, pColor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetBackgroundColor(
@@ -1609,14 +1973,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetBackgroundColor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetBackgroundColor");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetBackgroundColor");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pColor"], pColor, options);
+        jdata.Key("pColor");
+        FieldToJson(jdata, pColor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_SetRotation(
@@ -1627,14 +1995,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_SetRotation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetRotation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetRotation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Rotation"], Rotation, options);
+        jdata.Key("Rotation");
+        FieldToJson(jdata, Rotation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRotation(
@@ -1645,14 +2017,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRotation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRotation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRotation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRotation"], pRotation, options);
+        jdata.Key("pRotation");
+        FieldToJson(jdata, pRotation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_IsWindowedStereoEnabled(
@@ -1662,10 +2038,11 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_IsWindowedStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "IsWindowedStereoEnabled");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "IsWindowedStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForHwnd(
@@ -1681,19 +2058,28 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForHwnd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForHwnd");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForHwnd");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["hWnd"], hWnd, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pFullscreenDesc"], pFullscreenDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("hWnd");
+        FieldToJson(jdata, hWnd, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pFullscreenDesc");
+        FieldToJson(jdata, pFullscreenDesc, options);
+        jdata.Key("pRestrictToOutput");
+        FieldToJson(jdata, pRestrictToOutput, options);
+        jdata.Key("ppSwapChain");
+        FieldToJson(jdata, ppSwapChain, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForCoreWindow(
@@ -1708,18 +2094,26 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForCoreWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForCoreWindow");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForCoreWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["pWindow"], pWindow, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("pWindow");
+        FieldToJson(jdata, pWindow, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pRestrictToOutput");
+        FieldToJson(jdata, pRestrictToOutput, options);
+        jdata.Key("ppSwapChain");
+        FieldToJson(jdata, ppSwapChain, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_GetSharedResourceAdapterLuid(
@@ -1731,15 +2125,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_GetSharedResourceAdapterLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "GetSharedResourceAdapterLuid");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "GetSharedResourceAdapterLuid");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hResource"], hResource, options);
-        FieldToJson(args["pLuid"], pLuid, options);
+        jdata.Key("hResource");
+        FieldToJson(jdata, hResource, options);
+        jdata.Key("pLuid");
+        FieldToJson(jdata, pLuid, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusWindow(
@@ -1752,16 +2151,22 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusWindow");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["WindowHandle"], WindowHandle, options);
-        FieldToJson(args["wMsg"], wMsg, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("WindowHandle");
+        FieldToJson(jdata, WindowHandle, options);
+        jdata.Key("wMsg");
+        FieldToJson(jdata, wMsg, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusEvent(
@@ -1773,15 +2178,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterStereoStatus(
@@ -1791,13 +2201,16 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterStereoStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterStereoStatus");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterStereoStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        jdata.Key("dwCookie");
+        FieldToJson(jdata, dwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusWindow(
@@ -1810,16 +2223,22 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusWindow");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["WindowHandle"], WindowHandle, options);
-        FieldToJson(args["wMsg"], wMsg, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("WindowHandle");
+        FieldToJson(jdata, WindowHandle, options);
+        jdata.Key("wMsg");
+        FieldToJson(jdata, wMsg, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusEvent(
@@ -1831,15 +2250,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterOcclusionStatus(
@@ -1849,13 +2273,16 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterOcclusionStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterOcclusionStatus");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterOcclusionStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        jdata.Key("dwCookie");
+        FieldToJson(jdata, dwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForComposition(
@@ -1869,17 +2296,24 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForComposition(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForComposition");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForComposition");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pRestrictToOutput");
+        FieldToJson(jdata, pRestrictToOutput, options);
+        jdata.Key("ppSwapChain");
+        FieldToJson(jdata, ppSwapChain, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter2_GetDesc2(
@@ -1890,14 +2324,18 @@ void Dx12JsonConsumer::Process_IDXGIAdapter2_GetDesc2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter2", object_id, "GetDesc2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter2", object_id, "GetDesc2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplayModeList1(
@@ -1911,17 +2349,24 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplayModeList1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplayModeList1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplayModeList1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["EnumFormat"], EnumFormat, options);
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["pNumModes"], pNumModes, options);
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("EnumFormat");
+        FieldToJson(jdata, EnumFormat, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
+        jdata.Key("pNumModes");
+        FieldToJson(jdata, pNumModes, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput1_FindClosestMatchingMode1(
@@ -1934,16 +2379,22 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_FindClosestMatchingMode1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "FindClosestMatchingMode1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput1", object_id, "FindClosestMatchingMode1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pModeToMatch"], pModeToMatch, options);
-        FieldToJson(args["pClosestMatch"], pClosestMatch, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
+        jdata.Key("pModeToMatch");
+        FieldToJson(jdata, pModeToMatch, options);
+        jdata.Key("pClosestMatch");
+        FieldToJson(jdata, pClosestMatch, options);
+        jdata.Key("pConcernedDevice");
+        FieldToJson(jdata, pConcernedDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplaySurfaceData1(
@@ -1954,14 +2405,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplaySurfaceData1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplaySurfaceData1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplaySurfaceData1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDestination"], pDestination, options);
+        jdata.Key("pDestination");
+        FieldToJson(jdata, pDestination, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput1_DuplicateOutput(
@@ -1973,15 +2428,20 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_DuplicateOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "DuplicateOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput1", object_id, "DuplicateOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["ppOutputDuplication"], ppOutputDuplication, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("ppOutputDuplication");
+        FieldToJson(jdata, ppOutputDuplication, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -1997,16 +2457,22 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "CreateDXGIFactory2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFactory"], ppFactory, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppFactory");
+        FieldToJson(jdata, ppFactory, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -2019,16 +2485,22 @@ void Dx12JsonConsumer::Process_DXGIGetDebugInterface1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "DXGIGetDebugInterface1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "DXGIGetDebugInterface1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["pDebug"], pDebug, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("pDebug");
+        FieldToJson(jdata, pDebug, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -2038,9 +2510,9 @@ void Dx12JsonConsumer::Process_IDXGIDevice3_Trim(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice3", object_id, "Trim");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice3", object_id, "Trim");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_SetSourceSize(
@@ -2052,15 +2524,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetSourceSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetSourceSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetSourceSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, Height, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_GetSourceSize(
@@ -2072,15 +2549,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetSourceSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetSourceSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetSourceSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pWidth"], pWidth, options);
-        FieldToJson(args["pHeight"], pHeight, options);
+        jdata.Key("pWidth");
+        FieldToJson(jdata, pWidth, options);
+        jdata.Key("pHeight");
+        FieldToJson(jdata, pHeight, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMaximumFrameLatency(
@@ -2091,14 +2573,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMaximumFrameLatency");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["MaxLatency"], MaxLatency, options);
+        jdata.Key("MaxLatency");
+        FieldToJson(jdata, MaxLatency, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMaximumFrameLatency(
@@ -2109,14 +2595,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMaximumFrameLatency");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pMaxLatency"], pMaxLatency, options);
+        jdata.Key("pMaxLatency");
+        FieldToJson(jdata, pMaxLatency, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_GetFrameLatencyWaitableObject(
@@ -2126,10 +2616,11 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetFrameLatencyWaitableObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetFrameLatencyWaitableObject");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetFrameLatencyWaitableObject");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMatrixTransform(
@@ -2140,14 +2631,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMatrixTransform(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMatrixTransform");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMatrixTransform");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pMatrix"], pMatrix, options);
+        jdata.Key("pMatrix");
+        FieldToJson(jdata, pMatrix, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMatrixTransform(
@@ -2158,14 +2653,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMatrixTransform(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMatrixTransform");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMatrixTransform");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pMatrix"], pMatrix, options);
+        jdata.Key("pMatrix");
+        FieldToJson(jdata, pMatrix, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput2_SupportsOverlays(
@@ -2175,10 +2674,11 @@ void Dx12JsonConsumer::Process_IDXGIOutput2_SupportsOverlays(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput2", object_id, "SupportsOverlays");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput2", object_id, "SupportsOverlays");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory3_GetCreationFlags(
@@ -2188,10 +2688,11 @@ void Dx12JsonConsumer::Process_IDXGIFactory3_GetCreationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory3", object_id, "GetCreationFlags");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory3", object_id, "GetCreationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_PresentBuffer(
@@ -2204,16 +2705,22 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_PresentBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "PresentBuffer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "PresentBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["BufferToPresent"], BufferToPresent, options);
-        FieldToJson(args["SyncInterval"], SyncInterval, options);
-        FieldToJson(args["Flags"], Flags, options);
+        jdata.Key("BufferToPresent");
+        FieldToJson(jdata, BufferToPresent, options);
+        jdata.Key("SyncInterval");
+        FieldToJson(jdata, SyncInterval, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetSourceRect(
@@ -2224,14 +2731,18 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetSourceRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetSourceRect");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetSourceRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        jdata.Key("pRect");
+        FieldToJson(jdata, pRect, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetTargetRect(
@@ -2242,14 +2753,18 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetTargetRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetTargetRect");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetTargetRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        jdata.Key("pRect");
+        FieldToJson(jdata, pRect, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetDestSize(
@@ -2261,15 +2776,20 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetDestSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetDestSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetDestSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, Height, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetSourceRect(
@@ -2280,14 +2800,18 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetSourceRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetSourceRect");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetSourceRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        jdata.Key("pRect");
+        FieldToJson(jdata, pRect, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetTargetRect(
@@ -2298,14 +2822,18 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetTargetRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetTargetRect");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetTargetRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        jdata.Key("pRect");
+        FieldToJson(jdata, pRect, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetDestSize(
@@ -2317,15 +2845,20 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetDestSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetDestSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetDestSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pWidth"], pWidth, options);
-        FieldToJson(args["pHeight"], pHeight, options);
+        jdata.Key("pWidth");
+        FieldToJson(jdata, pWidth, options);
+        jdata.Key("pHeight");
+        FieldToJson(jdata, pHeight, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetColorSpace(
@@ -2336,14 +2869,18 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetColorSpace(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetColorSpace");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetColorSpace");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(args["ColorSpace"], ColorSpace, options);
+        jdata.Key("ColorSpace");
+        FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(jdata, ColorSpace, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetColorSpace(
@@ -2353,10 +2890,11 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetColorSpace(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetColorSpace");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetColorSpace");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateSwapChainForCompositionSurfaceHandle(
@@ -2371,18 +2909,26 @@ void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateSwapChainForCompositionSu
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateSwapChainForCompositionSurfaceHandle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateSwapChainForCompositionSurfaceHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["hSurface"], hSurface, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("hSurface");
+        FieldToJson(jdata, hSurface, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pRestrictToOutput");
+        FieldToJson(jdata, pRestrictToOutput, options);
+        jdata.Key("ppSwapChain");
+        FieldToJson(jdata, ppSwapChain, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateDecodeSwapChainForCompositionSurfaceHandle(
@@ -2398,19 +2944,28 @@ void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateDecodeSwapChainForComposi
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateDecodeSwapChainForCompositionSurfaceHandle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateDecodeSwapChainForCompositionSurfaceHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["hSurface"], hSurface, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pYuvDecodeBuffers"], pYuvDecodeBuffers, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("hSurface");
+        FieldToJson(jdata, hSurface, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pYuvDecodeBuffers");
+        FieldToJson(jdata, pYuvDecodeBuffers, options);
+        jdata.Key("pRestrictToOutput");
+        FieldToJson(jdata, pRestrictToOutput, options);
+        jdata.Key("ppSwapChain");
+        FieldToJson(jdata, ppSwapChain, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChainMedia_GetFrameStatisticsMedia(
@@ -2421,14 +2976,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_GetFrameStatisticsMedia(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "GetFrameStatisticsMedia");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "GetFrameStatisticsMedia");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pStats"], pStats, options);
+        jdata.Key("pStats");
+        FieldToJson(jdata, pStats, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChainMedia_SetPresentDuration(
@@ -2439,14 +2998,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_SetPresentDuration(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "SetPresentDuration");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "SetPresentDuration");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Duration"], Duration, options);
+        jdata.Key("Duration");
+        FieldToJson(jdata, Duration, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChainMedia_CheckPresentDurationSupport(
@@ -2459,16 +3022,22 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_CheckPresentDurationSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "CheckPresentDurationSupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "CheckPresentDurationSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["DesiredPresentDuration"], DesiredPresentDuration, options);
-        FieldToJson(args["pClosestSmallerPresentDuration"], pClosestSmallerPresentDuration, options);
-        FieldToJson(args["pClosestLargerPresentDuration"], pClosestLargerPresentDuration, options);
+        jdata.Key("DesiredPresentDuration");
+        FieldToJson(jdata, DesiredPresentDuration, options);
+        jdata.Key("pClosestSmallerPresentDuration");
+        FieldToJson(jdata, pClosestSmallerPresentDuration, options);
+        jdata.Key("pClosestLargerPresentDuration");
+        FieldToJson(jdata, pClosestLargerPresentDuration, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput3_CheckOverlaySupport(
@@ -2481,16 +3050,22 @@ void Dx12JsonConsumer::Process_IDXGIOutput3_CheckOverlaySupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput3", object_id, "CheckOverlaySupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput3", object_id, "CheckOverlaySupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["EnumFormat"], EnumFormat, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
-        FieldToJson(args["pFlags"], pFlags, options);
+        jdata.Key("EnumFormat");
+        FieldToJson(jdata, EnumFormat, options);
+        jdata.Key("pConcernedDevice");
+        FieldToJson(jdata, pConcernedDevice, options);
+        jdata.Key("pFlags");
+        FieldToJson(jdata, pFlags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -2504,10 +3079,11 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_GetCurrentBackBufferIndex(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "GetCurrentBackBufferIndex");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain3", object_id, "GetCurrentBackBufferIndex");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain3_CheckColorSpaceSupport(
@@ -2519,15 +3095,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_CheckColorSpaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "CheckColorSpaceSupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain3", object_id, "CheckColorSpaceSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ColorSpace"], ColorSpace, options);
-        FieldToJson(args["pColorSpaceSupport"], pColorSpaceSupport, options);
+        jdata.Key("ColorSpace");
+        FieldToJson(jdata, ColorSpace, options);
+        jdata.Key("pColorSpaceSupport");
+        FieldToJson(jdata, pColorSpaceSupport, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain3_SetColorSpace1(
@@ -2538,14 +3119,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_SetColorSpace1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "SetColorSpace1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain3", object_id, "SetColorSpace1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ColorSpace"], ColorSpace, options);
+        jdata.Key("ColorSpace");
+        FieldToJson(jdata, ColorSpace, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain3_ResizeBuffers1(
@@ -2562,20 +3147,30 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_ResizeBuffers1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "ResizeBuffers1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain3", object_id, "ResizeBuffers1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["BufferCount"], BufferCount, options);
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
-        FieldToJson(args["Format"], Format, options);
-        FieldToJson(args["SwapChainFlags"], SwapChainFlags, options);
-        FieldToJsonAsFixedWidthBinary(args["pCreationNodeMask"], pCreationNodeMask, options);
-        FieldToJson(args["ppPresentQueue"], ppPresentQueue, options);
+        jdata.Key("BufferCount");
+        FieldToJson(jdata, BufferCount, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, Height, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, Format, options);
+        jdata.Key("SwapChainFlags");
+        FieldToJson(jdata, SwapChainFlags, options);
+        jdata.Key("pCreationNodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, pCreationNodeMask, options);
+        jdata.Key("ppPresentQueue");
+        FieldToJson(jdata, ppPresentQueue, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput4_CheckOverlayColorSpaceSupport(
@@ -2589,17 +3184,24 @@ void Dx12JsonConsumer::Process_IDXGIOutput4_CheckOverlayColorSpaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput4", object_id, "CheckOverlayColorSpaceSupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput4", object_id, "CheckOverlayColorSpaceSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Format"], Format, options);
-        FieldToJson(args["ColorSpace"], ColorSpace, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
-        FieldToJson(args["pFlags"], pFlags, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, Format, options);
+        jdata.Key("ColorSpace");
+        FieldToJson(jdata, ColorSpace, options);
+        jdata.Key("pConcernedDevice");
+        FieldToJson(jdata, pConcernedDevice, options);
+        jdata.Key("pFlags");
+        FieldToJson(jdata, pFlags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory4_EnumAdapterByLuid(
@@ -2612,16 +3214,22 @@ void Dx12JsonConsumer::Process_IDXGIFactory4_EnumAdapterByLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumAdapterByLuid");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumAdapterByLuid");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["AdapterLuid"], AdapterLuid, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvAdapter"], ppvAdapter, options);
+        jdata.Key("AdapterLuid");
+        FieldToJson(jdata, AdapterLuid, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvAdapter");
+        FieldToJson(jdata, ppvAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory4_EnumWarpAdapter(
@@ -2633,15 +3241,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory4_EnumWarpAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumWarpAdapter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumWarpAdapter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvAdapter"], ppvAdapter, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvAdapter");
+        FieldToJson(jdata, ppvAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterHardwareContentProtectionTeardownStatusEvent(
@@ -2653,15 +3266,20 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterHardwareContentProtectionTe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterHardwareContentProtectionTeardownStatusEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterHardwareContentProtectionTeardownStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterHardwareContentProtectionTeardownStatus(
@@ -2671,13 +3289,16 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterHardwareContentProtection
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterHardwareContentProtectionTeardownStatus");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterHardwareContentProtectionTeardownStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        jdata.Key("dwCookie");
+        FieldToJson(jdata, dwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter3_QueryVideoMemoryInfo(
@@ -2690,16 +3311,22 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_QueryVideoMemoryInfo(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "QueryVideoMemoryInfo");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter3", object_id, "QueryVideoMemoryInfo");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NodeIndex"], NodeIndex, options);
-        FieldToJson(args["MemorySegmentGroup"], MemorySegmentGroup, options);
-        FieldToJson(args["pVideoMemoryInfo"], pVideoMemoryInfo, options);
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, NodeIndex, options);
+        jdata.Key("MemorySegmentGroup");
+        FieldToJson(jdata, MemorySegmentGroup, options);
+        jdata.Key("pVideoMemoryInfo");
+        FieldToJson(jdata, pVideoMemoryInfo, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter3_SetVideoMemoryReservation(
@@ -2712,16 +3339,22 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_SetVideoMemoryReservation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "SetVideoMemoryReservation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter3", object_id, "SetVideoMemoryReservation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NodeIndex"], NodeIndex, options);
-        FieldToJson(args["MemorySegmentGroup"], MemorySegmentGroup, options);
-        FieldToJson(args["Reservation"], Reservation, options);
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, NodeIndex, options);
+        jdata.Key("MemorySegmentGroup");
+        FieldToJson(jdata, MemorySegmentGroup, options);
+        jdata.Key("Reservation");
+        FieldToJson(jdata, Reservation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNotificationEvent(
@@ -2733,15 +3366,20 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNoti
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterVideoMemoryBudgetChangeNotificationEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterVideoMemoryBudgetChangeNotificationEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNotification(
@@ -2751,13 +3389,16 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterVideoMemoryBudgetChangeNotification");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterVideoMemoryBudgetChangeNotification");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        jdata.Key("dwCookie");
+        FieldToJson(jdata, dwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -2776,18 +3417,26 @@ void Dx12JsonConsumer::Process_IDXGIOutput5_DuplicateOutput1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput5", object_id, "DuplicateOutput1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput5", object_id, "DuplicateOutput1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["SupportedFormatsCount"], SupportedFormatsCount, options);
-        FieldToJson(args["pSupportedFormats"], pSupportedFormats, options);
-        FieldToJson(args["ppOutputDuplication"], ppOutputDuplication, options);
+        jdata.Key("pDevice");
+        FieldToJson(jdata, pDevice, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
+        jdata.Key("SupportedFormatsCount");
+        FieldToJson(jdata, SupportedFormatsCount, options);
+        jdata.Key("pSupportedFormats");
+        FieldToJson(jdata, pSupportedFormats, options);
+        jdata.Key("ppOutputDuplication");
+        FieldToJson(jdata, ppOutputDuplication, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGISwapChain4_SetHDRMetaData(
@@ -2800,16 +3449,22 @@ void Dx12JsonConsumer::Process_IDXGISwapChain4_SetHDRMetaData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain4", object_id, "SetHDRMetaData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGISwapChain4", object_id, "SetHDRMetaData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["Size"], Size, options);
-        FieldToJson(args["pMetaData"], pMetaData, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, Size, options);
+        jdata.Key("pMetaData");
+        FieldToJson(jdata, pMetaData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice4_OfferResources1(
@@ -2823,17 +3478,24 @@ void Dx12JsonConsumer::Process_IDXGIDevice4_OfferResources1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "OfferResources1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice4", object_id, "OfferResources1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["Priority"], Priority, options);
-        FieldToJson(args["Flags"], Flags, options);
+        jdata.Key("NumResources");
+        FieldToJson(jdata, NumResources, options);
+        jdata.Key("ppResources");
+        FieldToJson(jdata, ppResources, options);
+        jdata.Key("Priority");
+        FieldToJson(jdata, Priority, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIDevice4_ReclaimResources1(
@@ -2846,16 +3508,22 @@ void Dx12JsonConsumer::Process_IDXGIDevice4_ReclaimResources1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "ReclaimResources1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIDevice4", object_id, "ReclaimResources1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["pResults"], pResults, options);
+        jdata.Key("NumResources");
+        FieldToJson(jdata, NumResources, options);
+        jdata.Key("ppResources");
+        FieldToJson(jdata, ppResources, options);
+        jdata.Key("pResults");
+        FieldToJson(jdata, pResults, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -2868,13 +3536,13 @@ void Dx12JsonConsumer::Process_DXGIDeclareAdapterRemovalSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "DXGIDeclareAdapterRemovalSupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "DXGIDeclareAdapterRemovalSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
-    {
-    }
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.Null();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -2886,14 +3554,18 @@ void Dx12JsonConsumer::Process_IDXGIAdapter4_GetDesc3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter4", object_id, "GetDesc3");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIAdapter4", object_id, "GetDesc3");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput6_GetDesc1(
@@ -2904,14 +3576,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput6_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "GetDesc1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput6", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIOutput6_CheckHardwareCompositionSupport(
@@ -2922,14 +3598,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput6_CheckHardwareCompositionSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "CheckHardwareCompositionSupport");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIOutput6", object_id, "CheckHardwareCompositionSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFlags"], pFlags, options);
+        jdata.Key("pFlags");
+        FieldToJson(jdata, pFlags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory6_EnumAdapterByGpuPreference(
@@ -2943,17 +3623,24 @@ void Dx12JsonConsumer::Process_IDXGIFactory6_EnumAdapterByGpuPreference(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory6", object_id, "EnumAdapterByGpuPreference");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory6", object_id, "EnumAdapterByGpuPreference");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Adapter"], Adapter, options);
-        FieldToJson(args["GpuPreference"], GpuPreference, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvAdapter"], ppvAdapter, options);
+        jdata.Key("Adapter");
+        FieldToJson(jdata, Adapter, options);
+        jdata.Key("GpuPreference");
+        FieldToJson(jdata, GpuPreference, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvAdapter");
+        FieldToJson(jdata, ppvAdapter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory7_RegisterAdaptersChangedEvent(
@@ -2965,15 +3652,20 @@ void Dx12JsonConsumer::Process_IDXGIFactory7_RegisterAdaptersChangedEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "RegisterAdaptersChangedEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory7", object_id, "RegisterAdaptersChangedEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
+        jdata.Key("pdwCookie");
+        FieldToJson(jdata, pdwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IDXGIFactory7_UnregisterAdaptersChangedEvent(
@@ -2984,14 +3676,18 @@ void Dx12JsonConsumer::Process_IDXGIFactory7_UnregisterAdaptersChangedEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "UnregisterAdaptersChangedEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IDXGIFactory7", object_id, "UnregisterAdaptersChangedEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        jdata.Key("dwCookie");
+        FieldToJson(jdata, dwCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -3008,17 +3704,24 @@ void Dx12JsonConsumer::Process_D3D12SerializeRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeRootSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12SerializeRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
-        FieldToJson(args["Version"], Version, options);
-        FieldToJson(args["ppBlob"], ppBlob, options);
-        FieldToJson(args["ppErrorBlob"], ppErrorBlob, options);
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, pRootSignature, options);
+        jdata.Key("Version");
+        FieldToJson(jdata, Version, options);
+        jdata.Key("ppBlob");
+        FieldToJson(jdata, ppBlob, options);
+        jdata.Key("ppErrorBlob");
+        FieldToJson(jdata, ppErrorBlob, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3032,17 +3735,24 @@ void Dx12JsonConsumer::Process_D3D12CreateRootSignatureDeserializer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateRootSignatureDeserializer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12CreateRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["SrcDataSizeInBytes"], SrcDataSizeInBytes, options);
-        FieldToJson(args["pRootSignatureDeserializerInterface"], pRootSignatureDeserializerInterface, options);
-        FieldToJson(args["ppRootSignatureDeserializer"], ppRootSignatureDeserializer, options);
+        jdata.Key("pSrcData");
+        FieldToJson(jdata, pSrcData, options);
+        jdata.Key("SrcDataSizeInBytes");
+        FieldToJson(jdata, SrcDataSizeInBytes, options);
+        jdata.Key("pRootSignatureDeserializerInterface");
+        FieldToJson(jdata, pRootSignatureDeserializerInterface, options);
+        jdata.Key("ppRootSignatureDeserializer");
+        FieldToJson(jdata, ppRootSignatureDeserializer, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3055,16 +3765,22 @@ void Dx12JsonConsumer::Process_D3D12SerializeVersionedRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeVersionedRootSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12SerializeVersionedRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
-        FieldToJson(args["ppBlob"], ppBlob, options);
-        FieldToJson(args["ppErrorBlob"], ppErrorBlob, options);
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, pRootSignature, options);
+        jdata.Key("ppBlob");
+        FieldToJson(jdata, ppBlob, options);
+        jdata.Key("ppErrorBlob");
+        FieldToJson(jdata, ppErrorBlob, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3078,17 +3794,24 @@ void Dx12JsonConsumer::Process_D3D12CreateVersionedRootSignatureDeserializer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateVersionedRootSignatureDeserializer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12CreateVersionedRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["SrcDataSizeInBytes"], SrcDataSizeInBytes, options);
-        FieldToJson(args["pRootSignatureDeserializerInterface"], pRootSignatureDeserializerInterface, options);
-        FieldToJson(args["ppRootSignatureDeserializer"], ppRootSignatureDeserializer, options);
+        jdata.Key("pSrcData");
+        FieldToJson(jdata, pSrcData, options);
+        jdata.Key("SrcDataSizeInBytes");
+        FieldToJson(jdata, SrcDataSizeInBytes, options);
+        jdata.Key("pRootSignatureDeserializerInterface");
+        FieldToJson(jdata, pRootSignatureDeserializerInterface, options);
+        jdata.Key("ppRootSignatureDeserializer");
+        FieldToJson(jdata, ppRootSignatureDeserializer, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3102,17 +3825,24 @@ void Dx12JsonConsumer::Process_D3D12CreateDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateDevice");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12CreateDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pAdapter"], pAdapter, options);
-        FieldToJson(args["MinimumFeatureLevel"], MinimumFeatureLevel, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppDevice"], ppDevice, options);
+        jdata.Key("pAdapter");
+        FieldToJson(jdata, pAdapter, options);
+        jdata.Key("MinimumFeatureLevel");
+        FieldToJson(jdata, MinimumFeatureLevel, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppDevice");
+        FieldToJson(jdata, ppDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3124,15 +3854,20 @@ void Dx12JsonConsumer::Process_D3D12GetDebugInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12GetDebugInterface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12GetDebugInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDebug"], ppvDebug, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvDebug");
+        FieldToJson(jdata, ppvDebug, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3146,17 +3881,24 @@ void Dx12JsonConsumer::Process_D3D12EnableExperimentalFeatures(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12EnableExperimentalFeatures");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12EnableExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumFeatures"], NumFeatures, options);
-        FieldToJson(args["pIIDs"], pIIDs, options);
-        FieldToJson(args["pConfigurationStructs"], pConfigurationStructs, options);
-        FieldToJson(args["pConfigurationStructSizes"], pConfigurationStructSizes, options);
+        jdata.Key("NumFeatures");
+        FieldToJson(jdata, NumFeatures, options);
+        jdata.Key("pIIDs");
+        FieldToJson(jdata, pIIDs, options);
+        jdata.Key("pConfigurationStructs");
+        FieldToJson(jdata, pConfigurationStructs, options);
+        jdata.Key("pConfigurationStructSizes");
+        FieldToJson(jdata, pConfigurationStructSizes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3169,16 +3911,22 @@ void Dx12JsonConsumer::Process_D3D12GetInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12GetInterface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "D3D12GetInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["rclsid"], rclsid, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDebug"], ppvDebug, options);
+        jdata.Key("rclsid");
+        FieldToJson(jdata, rclsid, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvDebug");
+        FieldToJson(jdata, ppvDebug, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 
 }
 
@@ -3192,16 +3940,22 @@ void Dx12JsonConsumer::Process_ID3D12Object_GetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "GetPrivateData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Object", object_id, "GetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
-        FieldToJson(args["pDataSize"], pDataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        jdata.Key("guid");
+        FieldToJson(jdata, guid, options);
+        jdata.Key("pDataSize");
+        FieldToJson(jdata, pDataSize, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateData(
@@ -3214,16 +3968,22 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
-        FieldToJson(args["DataSize"], DataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        jdata.Key("guid");
+        FieldToJson(jdata, guid, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateDataInterface(
@@ -3235,15 +3995,20 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateDataInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateDataInterface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateDataInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
-        FieldToJson(args["pData"], pData, options);
+        jdata.Key("guid");
+        FieldToJson(jdata, guid, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Object_SetName(
@@ -3254,14 +4019,18 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetName");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Object", object_id, "SetName");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, Name, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceChild_GetDevice(
@@ -3273,15 +4042,20 @@ void Dx12JsonConsumer::Process_ID3D12DeviceChild_GetDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceChild", object_id, "GetDevice");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceChild", object_id, "GetDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDevice"], ppvDevice, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvDevice");
+        FieldToJson(jdata, ppvDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12RootSignatureDeserializer_GetRootSignatureDesc(
@@ -3291,10 +4065,11 @@ void Dx12JsonConsumer::Process_ID3D12RootSignatureDeserializer_GetRootSignatureD
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12RootSignatureDeserializer", object_id, "GetRootSignatureDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12RootSignatureDeserializer", object_id, "GetRootSignatureDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetRootSignatureDescAtVersion(
@@ -3306,15 +4081,20 @@ void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetRootS
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetRootSignatureDescAtVersion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetRootSignatureDescAtVersion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["convertToVersion"], convertToVersion, options);
-        FieldToJson(args["ppDesc"], ppDesc, options);
+        jdata.Key("convertToVersion");
+        FieldToJson(jdata, convertToVersion, options);
+        jdata.Key("ppDesc");
+        FieldToJson(jdata, ppDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetUnconvertedRootSignatureDesc(
@@ -3324,10 +4104,11 @@ void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetUncon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetUnconvertedRootSignatureDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetUnconvertedRootSignatureDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Heap_GetDesc(
@@ -3337,10 +4118,11 @@ void Dx12JsonConsumer::Process_ID3D12Heap_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Heap", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource_Map(
@@ -3353,16 +4135,22 @@ void Dx12JsonConsumer::Process_ID3D12Resource_Map(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Map");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource", object_id, "Map");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["pReadRange"], pReadRange, options);
-        FieldToJson(args["ppData"], ppData, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("pReadRange");
+        FieldToJson(jdata, pReadRange, options);
+        jdata.Key("ppData");
+        FieldToJson(jdata, ppData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource_Unmap(
@@ -3373,14 +4161,18 @@ void Dx12JsonConsumer::Process_ID3D12Resource_Unmap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Unmap");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource", object_id, "Unmap");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["pWrittenRange"], pWrittenRange, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("pWrittenRange");
+        FieldToJson(jdata, pWrittenRange, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource_GetDesc(
@@ -3390,10 +4182,11 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource_GetGPUVirtualAddress(
@@ -3403,10 +4196,11 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetGPUVirtualAddress(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetGPUVirtualAddress");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource", object_id, "GetGPUVirtualAddress");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJsonAsHex(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJsonAsHex(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource_ReadFromSubresource(
@@ -3421,18 +4215,26 @@ void Dx12JsonConsumer::Process_ID3D12Resource_ReadFromSubresource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "ReadFromSubresource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource", object_id, "ReadFromSubresource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstData"], pDstData, options);
-        FieldToJson(args["DstRowPitch"], DstRowPitch, options);
-        FieldToJson(args["DstDepthPitch"], DstDepthPitch, options);
-        FieldToJson(args["SrcSubresource"], SrcSubresource, options);
-        FieldToJson(args["pSrcBox"], pSrcBox, options);
+        jdata.Key("pDstData");
+        FieldToJson(jdata, pDstData, options);
+        jdata.Key("DstRowPitch");
+        FieldToJson(jdata, DstRowPitch, options);
+        jdata.Key("DstDepthPitch");
+        FieldToJson(jdata, DstDepthPitch, options);
+        jdata.Key("SrcSubresource");
+        FieldToJson(jdata, SrcSubresource, options);
+        jdata.Key("pSrcBox");
+        FieldToJson(jdata, pSrcBox, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource_GetHeapProperties(
@@ -3444,15 +4246,20 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetHeapProperties(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetHeapProperties");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource", object_id, "GetHeapProperties");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["pHeapFlags"], *pHeapFlags->GetPointer(), options);
+        jdata.Key("pHeapProperties");
+        FieldToJson(jdata, pHeapProperties, options);
+        jdata.Key("pHeapFlags");
+        FieldToJson_D3D12_HEAP_FLAGS(jdata, *pHeapFlags->GetPointer(), options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandAllocator_Reset(
@@ -3462,10 +4269,11 @@ void Dx12JsonConsumer::Process_ID3D12CommandAllocator_Reset(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandAllocator", object_id, "Reset");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandAllocator", object_id, "Reset");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Fence_GetCompletedValue(
@@ -3475,10 +4283,11 @@ void Dx12JsonConsumer::Process_ID3D12Fence_GetCompletedValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "GetCompletedValue");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Fence", object_id, "GetCompletedValue");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Fence_SetEventOnCompletion(
@@ -3490,15 +4299,20 @@ void Dx12JsonConsumer::Process_ID3D12Fence_SetEventOnCompletion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "SetEventOnCompletion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Fence", object_id, "SetEventOnCompletion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Value"], Value, options);
-        FieldToJson(args["hEvent"], hEvent, options);
+        jdata.Key("Value");
+        FieldToJson(jdata, Value, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Fence_Signal(
@@ -3509,14 +4323,18 @@ void Dx12JsonConsumer::Process_ID3D12Fence_Signal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "Signal");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Fence", object_id, "Signal");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Value"], Value, options);
+        jdata.Key("Value");
+        FieldToJson(jdata, Value, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Fence1_GetCreationFlags(
@@ -3526,10 +4344,11 @@ void Dx12JsonConsumer::Process_ID3D12Fence1_GetCreationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence1", object_id, "GetCreationFlags");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Fence1", object_id, "GetCreationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_FENCE_FLAGS(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson_D3D12_FENCE_FLAGS(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineState_GetCachedBlob(
@@ -3540,14 +4359,18 @@ void Dx12JsonConsumer::Process_ID3D12PipelineState_GetCachedBlob(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineState", object_id, "GetCachedBlob");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineState", object_id, "GetCachedBlob");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ppBlob"], ppBlob, options);
+        jdata.Key("ppBlob");
+        FieldToJson(jdata, ppBlob, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetDesc(
@@ -3557,10 +4380,11 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetCPUDescriptorHandleForHeapStart(
@@ -3570,10 +4394,11 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetCPUDescriptorHandleForHea
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetCPUDescriptorHandleForHeapStart");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetCPUDescriptorHandleForHeapStart");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetGPUDescriptorHandleForHeapStart(
@@ -3583,10 +4408,11 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetGPUDescriptorHandleForHea
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetGPUDescriptorHandleForHeapStart");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetGPUDescriptorHandleForHeapStart");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandList_GetType(
@@ -3596,10 +4422,11 @@ void Dx12JsonConsumer::Process_ID3D12CommandList_GetType(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandList", object_id, "GetType");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandList", object_id, "GetType");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Close(
@@ -3609,10 +4436,11 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Close(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Close");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Close");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Reset(
@@ -3624,15 +4452,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Reset(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Reset");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Reset");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pAllocator"], pAllocator, options);
-        FieldToJson(args["pInitialState"], pInitialState, options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, options);
+        jdata.Key("pInitialState");
+        FieldToJson(jdata, pInitialState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearState(
@@ -3642,13 +4475,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearState");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pPipelineState"], pPipelineState, options);
+        jdata.Key("pPipelineState");
+        FieldToJson(jdata, pPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawInstanced(
@@ -3661,16 +4497,22 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawInstanced(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawInstanced");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawInstanced");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["VertexCountPerInstance"], VertexCountPerInstance, options);
-        FieldToJson(args["InstanceCount"], InstanceCount, options);
-        FieldToJson(args["StartVertexLocation"], StartVertexLocation, options);
-        FieldToJson(args["StartInstanceLocation"], StartInstanceLocation, options);
+        jdata.Key("VertexCountPerInstance");
+        FieldToJson(jdata, VertexCountPerInstance, options);
+        jdata.Key("InstanceCount");
+        FieldToJson(jdata, InstanceCount, options);
+        jdata.Key("StartVertexLocation");
+        FieldToJson(jdata, StartVertexLocation, options);
+        jdata.Key("StartInstanceLocation");
+        FieldToJson(jdata, StartInstanceLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawIndexedInstanced(
@@ -3684,17 +4526,24 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawIndexedInstanced(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawIndexedInstanced");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawIndexedInstanced");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["IndexCountPerInstance"], IndexCountPerInstance, options);
-        FieldToJson(args["InstanceCount"], InstanceCount, options);
-        FieldToJson(args["StartIndexLocation"], StartIndexLocation, options);
-        FieldToJson(args["BaseVertexLocation"], BaseVertexLocation, options);
-        FieldToJson(args["StartInstanceLocation"], StartInstanceLocation, options);
+        jdata.Key("IndexCountPerInstance");
+        FieldToJson(jdata, IndexCountPerInstance, options);
+        jdata.Key("InstanceCount");
+        FieldToJson(jdata, InstanceCount, options);
+        jdata.Key("StartIndexLocation");
+        FieldToJson(jdata, StartIndexLocation, options);
+        jdata.Key("BaseVertexLocation");
+        FieldToJson(jdata, BaseVertexLocation, options);
+        jdata.Key("StartInstanceLocation");
+        FieldToJson(jdata, StartInstanceLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Dispatch(
@@ -3706,15 +4555,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Dispatch(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Dispatch");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Dispatch");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ThreadGroupCountX"], ThreadGroupCountX, options);
-        FieldToJson(args["ThreadGroupCountY"], ThreadGroupCountY, options);
-        FieldToJson(args["ThreadGroupCountZ"], ThreadGroupCountZ, options);
+        jdata.Key("ThreadGroupCountX");
+        FieldToJson(jdata, ThreadGroupCountX, options);
+        jdata.Key("ThreadGroupCountY");
+        FieldToJson(jdata, ThreadGroupCountY, options);
+        jdata.Key("ThreadGroupCountZ");
+        FieldToJson(jdata, ThreadGroupCountZ, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyBufferRegion(
@@ -3728,17 +4582,24 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyBufferRegion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyBufferRegion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyBufferRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstBuffer"], pDstBuffer, options);
-        FieldToJson(args["DstOffset"], DstOffset, options);
-        FieldToJson(args["pSrcBuffer"], pSrcBuffer, options);
-        FieldToJson(args["SrcOffset"], SrcOffset, options);
-        FieldToJson(args["NumBytes"], NumBytes, options);
+        jdata.Key("pDstBuffer");
+        FieldToJson(jdata, pDstBuffer, options);
+        jdata.Key("DstOffset");
+        FieldToJson(jdata, DstOffset, options);
+        jdata.Key("pSrcBuffer");
+        FieldToJson(jdata, pSrcBuffer, options);
+        jdata.Key("SrcOffset");
+        FieldToJson(jdata, SrcOffset, options);
+        jdata.Key("NumBytes");
+        FieldToJson(jdata, NumBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTextureRegion(
@@ -3753,18 +4614,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTextureRegion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTextureRegion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTextureRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDst"], pDst, options);
-        FieldToJson(args["DstX"], DstX, options);
-        FieldToJson(args["DstY"], DstY, options);
-        FieldToJson(args["DstZ"], DstZ, options);
-        FieldToJson(args["pSrc"], pSrc, options);
-        FieldToJson(args["pSrcBox"], pSrcBox, options);
+        jdata.Key("pDst");
+        FieldToJson(jdata, pDst, options);
+        jdata.Key("DstX");
+        FieldToJson(jdata, DstX, options);
+        jdata.Key("DstY");
+        FieldToJson(jdata, DstY, options);
+        jdata.Key("DstZ");
+        FieldToJson(jdata, DstZ, options);
+        jdata.Key("pSrc");
+        FieldToJson(jdata, pSrc, options);
+        jdata.Key("pSrcBox");
+        FieldToJson(jdata, pSrcBox, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyResource(
@@ -3775,14 +4644,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyResource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyResource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
+        jdata.Key("pDstResource");
+        FieldToJson(jdata, pDstResource, options);
+        jdata.Key("pSrcResource");
+        FieldToJson(jdata, pSrcResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTiles(
@@ -3797,18 +4670,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTiles(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTiles");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTiles");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pTiledResource"], pTiledResource, options);
-        FieldToJson(args["pTileRegionStartCoordinate"], pTileRegionStartCoordinate, options);
-        FieldToJson(args["pTileRegionSize"], pTileRegionSize, options);
-        FieldToJson(args["pBuffer"], pBuffer, options);
-        FieldToJson(args["BufferStartOffsetInBytes"], BufferStartOffsetInBytes, options);
-        FieldToJson_D3D12_TILE_COPY_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("pTiledResource");
+        FieldToJson(jdata, pTiledResource, options);
+        jdata.Key("pTileRegionStartCoordinate");
+        FieldToJson(jdata, pTileRegionStartCoordinate, options);
+        jdata.Key("pTileRegionSize");
+        FieldToJson(jdata, pTileRegionSize, options);
+        jdata.Key("pBuffer");
+        FieldToJson(jdata, pBuffer, options);
+        jdata.Key("BufferStartOffsetInBytes");
+        FieldToJson(jdata, BufferStartOffsetInBytes, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_TILE_COPY_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveSubresource(
@@ -3822,17 +4703,24 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveSubresource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveSubresource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveSubresource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["DstSubresource"], DstSubresource, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
-        FieldToJson(args["SrcSubresource"], SrcSubresource, options);
-        FieldToJson(args["Format"], Format, options);
+        jdata.Key("pDstResource");
+        FieldToJson(jdata, pDstResource, options);
+        jdata.Key("DstSubresource");
+        FieldToJson(jdata, DstSubresource, options);
+        jdata.Key("pSrcResource");
+        FieldToJson(jdata, pSrcResource, options);
+        jdata.Key("SrcSubresource");
+        FieldToJson(jdata, SrcSubresource, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, Format, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetPrimitiveTopology(
@@ -3842,13 +4730,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetPrimitiveTopology(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetPrimitiveTopology");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetPrimitiveTopology");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["PrimitiveTopology"], PrimitiveTopology, options);
+        jdata.Key("PrimitiveTopology");
+        FieldToJson(jdata, PrimitiveTopology, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetViewports(
@@ -3859,14 +4750,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetViewports(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetViewports");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetViewports");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumViewports"], NumViewports, options);
-        FieldToJson(args["pViewports"], pViewports, options);
+        jdata.Key("NumViewports");
+        FieldToJson(jdata, NumViewports, options);
+        jdata.Key("pViewports");
+        FieldToJson(jdata, pViewports, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetScissorRects(
@@ -3877,14 +4772,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetScissorRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetScissorRects");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetScissorRects");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        jdata.Key("NumRects");
+        FieldToJson(jdata, NumRects, options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetBlendFactor(
@@ -3894,13 +4793,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetBlendFactor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetBlendFactor");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetBlendFactor");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["BlendFactor"], BlendFactor, options);
+        jdata.Key("BlendFactor");
+        FieldToJson(jdata, BlendFactor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetStencilRef(
@@ -3910,13 +4812,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetStencilRef(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetStencilRef");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetStencilRef");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["StencilRef"], StencilRef, options);
+        jdata.Key("StencilRef");
+        FieldToJson(jdata, StencilRef, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPipelineState(
@@ -3926,13 +4831,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPipelineState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pPipelineState"], pPipelineState, options);
+        jdata.Key("pPipelineState");
+        FieldToJson(jdata, pPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResourceBarrier(
@@ -3943,14 +4851,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResourceBarrier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResourceBarrier");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResourceBarrier");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumBarriers"], NumBarriers, options);
-        FieldToJson(args["pBarriers"], pBarriers, options);
+        jdata.Key("NumBarriers");
+        FieldToJson(jdata, NumBarriers, options);
+        jdata.Key("pBarriers");
+        FieldToJson(jdata, pBarriers, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteBundle(
@@ -3960,13 +4872,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteBundle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteBundle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteBundle");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pCommandList"], pCommandList, options);
+        jdata.Key("pCommandList");
+        FieldToJson(jdata, pCommandList, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetDescriptorHeaps(
@@ -3977,14 +4892,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetDescriptorHeaps(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetDescriptorHeaps");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetDescriptorHeaps");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumDescriptorHeaps"], NumDescriptorHeaps, options);
-        FieldToJson(args["ppDescriptorHeaps"], ppDescriptorHeaps, options);
+        jdata.Key("NumDescriptorHeaps");
+        FieldToJson(jdata, NumDescriptorHeaps, options);
+        jdata.Key("ppDescriptorHeaps");
+        FieldToJson(jdata, ppDescriptorHeaps, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootSignature(
@@ -3994,13 +4913,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootSignature
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, pRootSignature, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootSignature(
@@ -4010,13 +4932,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootSignatur
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, pRootSignature, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootDescriptorTable(
@@ -4027,14 +4952,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootDescripto
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootDescriptorTable");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootDescriptorTable");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["BaseDescriptor"], BaseDescriptor, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BaseDescriptor");
+        FieldToJson(jdata, BaseDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootDescriptorTable(
@@ -4045,14 +4974,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootDescript
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootDescriptorTable");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootDescriptorTable");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["BaseDescriptor"], BaseDescriptor, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BaseDescriptor");
+        FieldToJson(jdata, BaseDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitConstant(
@@ -4064,15 +4997,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitCons
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstant");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstant");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["SrcData"], SrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("SrcData");
+        FieldToJson(jdata, SrcData, options);
+        jdata.Key("DestOffsetIn32BitValues");
+        FieldToJson(jdata, DestOffsetIn32BitValues, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstant(
@@ -4084,15 +5022,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitCon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstant");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstant");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["SrcData"], SrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("SrcData");
+        FieldToJson(jdata, SrcData, options);
+        jdata.Key("DestOffsetIn32BitValues");
+        FieldToJson(jdata, DestOffsetIn32BitValues, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitConstants(
@@ -4105,16 +5048,22 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitCons
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstants");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstants");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["Num32BitValuesToSet"], Num32BitValuesToSet, options);
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("Num32BitValuesToSet");
+        FieldToJson(jdata, Num32BitValuesToSet, options);
+        jdata.Key("pSrcData");
+        FieldToJson(jdata, pSrcData, options);
+        jdata.Key("DestOffsetIn32BitValues");
+        FieldToJson(jdata, DestOffsetIn32BitValues, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstants(
@@ -4127,16 +5076,22 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitCon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstants");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstants");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["Num32BitValuesToSet"], Num32BitValuesToSet, options);
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("Num32BitValuesToSet");
+        FieldToJson(jdata, Num32BitValuesToSet, options);
+        jdata.Key("pSrcData");
+        FieldToJson(jdata, pSrcData, options);
+        jdata.Key("DestOffsetIn32BitValues");
+        FieldToJson(jdata, DestOffsetIn32BitValues, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootConstantBufferView(
@@ -4147,14 +5102,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootConstantB
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootConstantBufferView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, BufferLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootConstantBufferView(
@@ -4165,14 +5124,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootConstant
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootConstantBufferView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, BufferLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootShaderResourceView(
@@ -4183,14 +5146,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootShaderRes
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootShaderResourceView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, BufferLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootShaderResourceView(
@@ -4201,14 +5168,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootShaderRe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootShaderResourceView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, BufferLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootUnorderedAccessView(
@@ -4219,14 +5190,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootUnordered
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootUnorderedAccessView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, BufferLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootUnorderedAccessView(
@@ -4237,14 +5212,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootUnordere
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootUnorderedAccessView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        jdata.Key("RootParameterIndex");
+        FieldToJson(jdata, RootParameterIndex, options);
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, BufferLocation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetIndexBuffer(
@@ -4254,13 +5233,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetIndexBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetIndexBuffer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetIndexBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pView"], pView, options);
+        jdata.Key("pView");
+        FieldToJson(jdata, pView, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetVertexBuffers(
@@ -4272,15 +5254,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetVertexBuffers(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetVertexBuffers");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetVertexBuffers");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["StartSlot"], StartSlot, options);
-        FieldToJson(args["NumViews"], NumViews, options);
-        FieldToJson(args["pViews"], pViews, options);
+        jdata.Key("StartSlot");
+        FieldToJson(jdata, StartSlot, options);
+        jdata.Key("NumViews");
+        FieldToJson(jdata, NumViews, options);
+        jdata.Key("pViews");
+        FieldToJson(jdata, pViews, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SOSetTargets(
@@ -4292,15 +5279,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SOSetTargets(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SOSetTargets");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SOSetTargets");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["StartSlot"], StartSlot, options);
-        FieldToJson(args["NumViews"], NumViews, options);
-        FieldToJson(args["pViews"], pViews, options);
+        jdata.Key("StartSlot");
+        FieldToJson(jdata, StartSlot, options);
+        jdata.Key("NumViews");
+        FieldToJson(jdata, NumViews, options);
+        jdata.Key("pViews");
+        FieldToJson(jdata, pViews, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetRenderTargets(
@@ -4313,16 +5305,22 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetRenderTargets(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetRenderTargets");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetRenderTargets");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumRenderTargetDescriptors"], NumRenderTargetDescriptors, options);
-        FieldToJson(args["pRenderTargetDescriptors"], pRenderTargetDescriptors, options);
-        Bool32ToJson(args["RTsSingleHandleToDescriptorRange"], RTsSingleHandleToDescriptorRange, options);
-        FieldToJson(args["pDepthStencilDescriptor"], pDepthStencilDescriptor, options);
+        jdata.Key("NumRenderTargetDescriptors");
+        FieldToJson(jdata, NumRenderTargetDescriptors, options);
+        jdata.Key("pRenderTargetDescriptors");
+        FieldToJson(jdata, pRenderTargetDescriptors, options);
+        jdata.Key("RTsSingleHandleToDescriptorRange");
+        Bool32ToJson(jdata, RTsSingleHandleToDescriptorRange, options);
+        jdata.Key("pDepthStencilDescriptor");
+        FieldToJson(jdata, pDepthStencilDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearDepthStencilView(
@@ -4337,18 +5335,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearDepthStencilView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearDepthStencilView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearDepthStencilView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["DepthStencilView"], DepthStencilView, options);
-        FieldToJson_D3D12_CLEAR_FLAGS(args["ClearFlags"], ClearFlags, options);
-        FieldToJson(args["Depth"], Depth, options);
-        FieldToJson(args["Stencil"], Stencil, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        jdata.Key("DepthStencilView");
+        FieldToJson(jdata, DepthStencilView, options);
+        jdata.Key("ClearFlags");
+        FieldToJson_D3D12_CLEAR_FLAGS(jdata, ClearFlags, options);
+        jdata.Key("Depth");
+        FieldToJson(jdata, Depth, options);
+        jdata.Key("Stencil");
+        FieldToJson(jdata, Stencil, options);
+        jdata.Key("NumRects");
+        FieldToJson(jdata, NumRects, options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearRenderTargetView(
@@ -4361,16 +5367,22 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearRenderTargetView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearRenderTargetView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearRenderTargetView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["RenderTargetView"], RenderTargetView, options);
-        FieldToJson(args["ColorRGBA"], ColorRGBA, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        jdata.Key("RenderTargetView");
+        FieldToJson(jdata, RenderTargetView, options);
+        jdata.Key("ColorRGBA");
+        FieldToJson(jdata, ColorRGBA, options);
+        jdata.Key("NumRects");
+        FieldToJson(jdata, NumRects, options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessViewUint(
@@ -4385,18 +5397,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessVie
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewUint");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewUint");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ViewGPUHandleInCurrentHeap"], ViewGPUHandleInCurrentHeap, options);
-        FieldToJson(args["ViewCPUHandle"], ViewCPUHandle, options);
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Values"], Values, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        jdata.Key("ViewGPUHandleInCurrentHeap");
+        FieldToJson(jdata, ViewGPUHandleInCurrentHeap, options);
+        jdata.Key("ViewCPUHandle");
+        FieldToJson(jdata, ViewCPUHandle, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Values");
+        FieldToJson(jdata, Values, options);
+        jdata.Key("NumRects");
+        FieldToJson(jdata, NumRects, options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessViewFloat(
@@ -4411,18 +5431,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessVie
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewFloat");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewFloat");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ViewGPUHandleInCurrentHeap"], ViewGPUHandleInCurrentHeap, options);
-        FieldToJson(args["ViewCPUHandle"], ViewCPUHandle, options);
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Values"], Values, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        jdata.Key("ViewGPUHandleInCurrentHeap");
+        FieldToJson(jdata, ViewGPUHandleInCurrentHeap, options);
+        jdata.Key("ViewCPUHandle");
+        FieldToJson(jdata, ViewCPUHandle, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Values");
+        FieldToJson(jdata, Values, options);
+        jdata.Key("NumRects");
+        FieldToJson(jdata, NumRects, options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DiscardResource(
@@ -4433,14 +5461,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DiscardResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DiscardResource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DiscardResource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pRegion"], pRegion, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("pRegion");
+        FieldToJson(jdata, pRegion, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginQuery(
@@ -4452,15 +5484,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginQuery(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginQuery");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginQuery");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pQueryHeap"], pQueryHeap, options);
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["Index"], Index, options);
+        jdata.Key("pQueryHeap");
+        FieldToJson(jdata, pQueryHeap, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("Index");
+        FieldToJson(jdata, Index, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndQuery(
@@ -4472,15 +5509,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndQuery(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndQuery");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndQuery");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pQueryHeap"], pQueryHeap, options);
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["Index"], Index, options);
+        jdata.Key("pQueryHeap");
+        FieldToJson(jdata, pQueryHeap, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("Index");
+        FieldToJson(jdata, Index, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveQueryData(
@@ -4495,18 +5537,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveQueryData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveQueryData");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveQueryData");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pQueryHeap"], pQueryHeap, options);
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["StartIndex"], StartIndex, options);
-        FieldToJson(args["NumQueries"], NumQueries, options);
-        FieldToJson(args["pDestinationBuffer"], pDestinationBuffer, options);
-        FieldToJson(args["AlignedDestinationBufferOffset"], AlignedDestinationBufferOffset, options);
+        jdata.Key("pQueryHeap");
+        FieldToJson(jdata, pQueryHeap, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("StartIndex");
+        FieldToJson(jdata, StartIndex, options);
+        jdata.Key("NumQueries");
+        FieldToJson(jdata, NumQueries, options);
+        jdata.Key("pDestinationBuffer");
+        FieldToJson(jdata, pDestinationBuffer, options);
+        jdata.Key("AlignedDestinationBufferOffset");
+        FieldToJson(jdata, AlignedDestinationBufferOffset, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPredication(
@@ -4518,15 +5568,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPredication(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPredication");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPredication");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pBuffer"], pBuffer, options);
-        FieldToJson(args["AlignedBufferOffset"], AlignedBufferOffset, options);
-        FieldToJson(args["Operation"], Operation, options);
+        jdata.Key("pBuffer");
+        FieldToJson(jdata, pBuffer, options);
+        jdata.Key("AlignedBufferOffset");
+        FieldToJson(jdata, AlignedBufferOffset, options);
+        jdata.Key("Operation");
+        FieldToJson(jdata, Operation, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetMarker(
@@ -4538,15 +5593,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetMarker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetMarker");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetMarker");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        jdata.Key("Metadata");
+        FieldToJson(jdata, Metadata, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, Size, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginEvent(
@@ -4558,15 +5618,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginEvent");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        jdata.Key("Metadata");
+        FieldToJson(jdata, Metadata, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, Size, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndEvent(
@@ -4575,9 +5640,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndEvent");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteIndirect(
@@ -4592,18 +5657,26 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteIndirect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteIndirect");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteIndirect");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pCommandSignature"], pCommandSignature, options);
-        FieldToJson(args["MaxCommandCount"], MaxCommandCount, options);
-        FieldToJson(args["pArgumentBuffer"], pArgumentBuffer, options);
-        FieldToJson(args["ArgumentBufferOffset"], ArgumentBufferOffset, options);
-        FieldToJson(args["pCountBuffer"], pCountBuffer, options);
-        FieldToJson(args["CountBufferOffset"], CountBufferOffset, options);
+        jdata.Key("pCommandSignature");
+        FieldToJson(jdata, pCommandSignature, options);
+        jdata.Key("MaxCommandCount");
+        FieldToJson(jdata, MaxCommandCount, options);
+        jdata.Key("pArgumentBuffer");
+        FieldToJson(jdata, pArgumentBuffer, options);
+        jdata.Key("ArgumentBufferOffset");
+        FieldToJson(jdata, ArgumentBufferOffset, options);
+        jdata.Key("pCountBuffer");
+        FieldToJson(jdata, pCountBuffer, options);
+        jdata.Key("CountBufferOffset");
+        FieldToJson(jdata, CountBufferOffset, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT(
@@ -4619,19 +5692,28 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstBuffer"], pDstBuffer, options);
-        FieldToJson(args["DstOffset"], DstOffset, options);
-        FieldToJson(args["pSrcBuffer"], pSrcBuffer, options);
-        FieldToJson(args["SrcOffset"], SrcOffset, options);
-        FieldToJson(args["Dependencies"], Dependencies, options);
-        FieldToJson(args["ppDependentResources"], ppDependentResources, options);
-        FieldToJson(args["pDependentSubresourceRanges"], pDependentSubresourceRanges, options);
+        jdata.Key("pDstBuffer");
+        FieldToJson(jdata, pDstBuffer, options);
+        jdata.Key("DstOffset");
+        FieldToJson(jdata, DstOffset, options);
+        jdata.Key("pSrcBuffer");
+        FieldToJson(jdata, pSrcBuffer, options);
+        jdata.Key("SrcOffset");
+        FieldToJson(jdata, SrcOffset, options);
+        jdata.Key("Dependencies");
+        FieldToJson(jdata, Dependencies, options);
+        jdata.Key("ppDependentResources");
+        FieldToJson(jdata, ppDependentResources, options);
+        jdata.Key("pDependentSubresourceRanges");
+        FieldToJson(jdata, pDependentSubresourceRanges, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64(
@@ -4647,19 +5729,28 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT64");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT64");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstBuffer"], pDstBuffer, options);
-        FieldToJson(args["DstOffset"], DstOffset, options);
-        FieldToJson(args["pSrcBuffer"], pSrcBuffer, options);
-        FieldToJson(args["SrcOffset"], SrcOffset, options);
-        FieldToJson(args["Dependencies"], Dependencies, options);
-        FieldToJson(args["ppDependentResources"], ppDependentResources, options);
-        FieldToJson(args["pDependentSubresourceRanges"], pDependentSubresourceRanges, options);
+        jdata.Key("pDstBuffer");
+        FieldToJson(jdata, pDstBuffer, options);
+        jdata.Key("DstOffset");
+        FieldToJson(jdata, DstOffset, options);
+        jdata.Key("pSrcBuffer");
+        FieldToJson(jdata, pSrcBuffer, options);
+        jdata.Key("SrcOffset");
+        FieldToJson(jdata, SrcOffset, options);
+        jdata.Key("Dependencies");
+        FieldToJson(jdata, Dependencies, options);
+        jdata.Key("ppDependentResources");
+        FieldToJson(jdata, ppDependentResources, options);
+        jdata.Key("pDependentSubresourceRanges");
+        FieldToJson(jdata, pDependentSubresourceRanges, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_OMSetDepthBounds(
@@ -4670,14 +5761,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_OMSetDepthBounds(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "OMSetDepthBounds");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "OMSetDepthBounds");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Min"], Min, options);
-        FieldToJson(args["Max"], Max, options);
+        jdata.Key("Min");
+        FieldToJson(jdata, Min, options);
+        jdata.Key("Max");
+        FieldToJson(jdata, Max, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetSamplePositions(
@@ -4689,15 +5784,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetSamplePositions(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetSamplePositions");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetSamplePositions");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumSamplesPerPixel"], NumSamplesPerPixel, options);
-        FieldToJson(args["NumPixels"], NumPixels, options);
-        FieldToJson(args["pSamplePositions"], pSamplePositions, options);
+        jdata.Key("NumSamplesPerPixel");
+        FieldToJson(jdata, NumSamplesPerPixel, options);
+        jdata.Key("NumPixels");
+        FieldToJson(jdata, NumPixels, options);
+        jdata.Key("pSamplePositions");
+        FieldToJson(jdata, pSamplePositions, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_ResolveSubresourceRegion(
@@ -4715,21 +5815,32 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_ResolveSubresourceRegi
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "ResolveSubresourceRegion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "ResolveSubresourceRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["DstSubresource"], DstSubresource, options);
-        FieldToJson(args["DstX"], DstX, options);
-        FieldToJson(args["DstY"], DstY, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
-        FieldToJson(args["SrcSubresource"], SrcSubresource, options);
-        FieldToJson(args["pSrcRect"], pSrcRect, options);
-        FieldToJson(args["Format"], Format, options);
-        FieldToJson(args["ResolveMode"], ResolveMode, options);
+        jdata.Key("pDstResource");
+        FieldToJson(jdata, pDstResource, options);
+        jdata.Key("DstSubresource");
+        FieldToJson(jdata, DstSubresource, options);
+        jdata.Key("DstX");
+        FieldToJson(jdata, DstX, options);
+        jdata.Key("DstY");
+        FieldToJson(jdata, DstY, options);
+        jdata.Key("pSrcResource");
+        FieldToJson(jdata, pSrcResource, options);
+        jdata.Key("SrcSubresource");
+        FieldToJson(jdata, SrcSubresource, options);
+        jdata.Key("pSrcRect");
+        FieldToJson(jdata, pSrcRect, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, Format, options);
+        jdata.Key("ResolveMode");
+        FieldToJson(jdata, ResolveMode, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetViewInstanceMask(
@@ -4739,13 +5850,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetViewInstanceMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetViewInstanceMask");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetViewInstanceMask");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["Mask"], Mask, options);
+        jdata.Key("Mask");
+        FieldToJsonAsFixedWidthBinary(jdata, Mask, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList2_WriteBufferImmediate(
@@ -4757,15 +5871,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList2_WriteBufferImmediate(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList2", object_id, "WriteBufferImmediate");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList2", object_id, "WriteBufferImmediate");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Count"], Count, options);
-        FieldToJson(args["pParams"], pParams, options);
-        FieldToJson(args["pModes"], pModes, options);
+        jdata.Key("Count");
+        FieldToJson(jdata, Count, options);
+        jdata.Key("pParams");
+        FieldToJson(jdata, pParams, options);
+        jdata.Key("pModes");
+        FieldToJson(jdata, pModes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_UpdateTileMappings(
@@ -4784,22 +5903,34 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_UpdateTileMappings(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "UpdateTileMappings");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "UpdateTileMappings");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["NumResourceRegions"], NumResourceRegions, options);
-        FieldToJson(args["pResourceRegionStartCoordinates"], pResourceRegionStartCoordinates, options);
-        FieldToJson(args["pResourceRegionSizes"], pResourceRegionSizes, options);
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["NumRanges"], NumRanges, options);
-        FieldToJson_D3D12_TILE_RANGE_FLAGS(args["pRangeFlags"], *pRangeFlags->GetPointer(), options);
-        FieldToJson(args["pHeapRangeStartOffsets"], pHeapRangeStartOffsets, options);
-        FieldToJson(args["pRangeTileCounts"], pRangeTileCounts, options);
-        FieldToJson_D3D12_TILE_MAPPING_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("NumResourceRegions");
+        FieldToJson(jdata, NumResourceRegions, options);
+        jdata.Key("pResourceRegionStartCoordinates");
+        FieldToJson(jdata, pResourceRegionStartCoordinates, options);
+        jdata.Key("pResourceRegionSizes");
+        FieldToJson(jdata, pResourceRegionSizes, options);
+        jdata.Key("pHeap");
+        FieldToJson(jdata, pHeap, options);
+        jdata.Key("NumRanges");
+        FieldToJson(jdata, NumRanges, options);
+        jdata.Key("pRangeFlags");
+        FieldToJson_D3D12_TILE_RANGE_FLAGS(jdata, *pRangeFlags->GetPointer(), options);
+        jdata.Key("pHeapRangeStartOffsets");
+        FieldToJson(jdata, pHeapRangeStartOffsets, options);
+        jdata.Key("pRangeTileCounts");
+        FieldToJson(jdata, pRangeTileCounts, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_TILE_MAPPING_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_CopyTileMappings(
@@ -4814,18 +5945,26 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_CopyTileMappings(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "CopyTileMappings");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "CopyTileMappings");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["pDstRegionStartCoordinate"], pDstRegionStartCoordinate, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
-        FieldToJson(args["pSrcRegionStartCoordinate"], pSrcRegionStartCoordinate, options);
-        FieldToJson(args["pRegionSize"], pRegionSize, options);
-        FieldToJson_D3D12_TILE_MAPPING_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("pDstResource");
+        FieldToJson(jdata, pDstResource, options);
+        jdata.Key("pDstRegionStartCoordinate");
+        FieldToJson(jdata, pDstRegionStartCoordinate, options);
+        jdata.Key("pSrcResource");
+        FieldToJson(jdata, pSrcResource, options);
+        jdata.Key("pSrcRegionStartCoordinate");
+        FieldToJson(jdata, pSrcRegionStartCoordinate, options);
+        jdata.Key("pRegionSize");
+        FieldToJson(jdata, pRegionSize, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_TILE_MAPPING_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_ExecuteCommandLists(
@@ -4836,14 +5975,18 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_ExecuteCommandLists(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "ExecuteCommandLists");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "ExecuteCommandLists");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumCommandLists"], NumCommandLists, options);
-        FieldToJson(args["ppCommandLists"], ppCommandLists, options);
+        jdata.Key("NumCommandLists");
+        FieldToJson(jdata, NumCommandLists, options);
+        jdata.Key("ppCommandLists");
+        FieldToJson(jdata, ppCommandLists, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_SetMarker(
@@ -4855,15 +5998,20 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_SetMarker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "SetMarker");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "SetMarker");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        jdata.Key("Metadata");
+        FieldToJson(jdata, Metadata, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, Size, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_BeginEvent(
@@ -4875,15 +6023,20 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_BeginEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "BeginEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "BeginEvent");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        jdata.Key("Metadata");
+        FieldToJson(jdata, Metadata, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, Size, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_EndEvent(
@@ -4892,9 +6045,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_EndEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "EndEvent");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "EndEvent");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_Signal(
@@ -4906,15 +6059,20 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_Signal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Signal");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Signal");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["Value"], Value, options);
+        jdata.Key("pFence");
+        FieldToJson(jdata, pFence, options);
+        jdata.Key("Value");
+        FieldToJson(jdata, Value, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_Wait(
@@ -4926,15 +6084,20 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_Wait(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Wait");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Wait");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["Value"], Value, options);
+        jdata.Key("pFence");
+        FieldToJson(jdata, pFence, options);
+        jdata.Key("Value");
+        FieldToJson(jdata, Value, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetTimestampFrequency(
@@ -4945,14 +6108,18 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetTimestampFrequency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetTimestampFrequency");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetTimestampFrequency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFrequency"], pFrequency, options);
+        jdata.Key("pFrequency");
+        FieldToJson(jdata, pFrequency, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetClockCalibration(
@@ -4964,15 +6131,20 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetClockCalibration(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetClockCalibration");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetClockCalibration");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pGpuTimestamp"], pGpuTimestamp, options);
-        FieldToJson(args["pCpuTimestamp"], pCpuTimestamp, options);
+        jdata.Key("pGpuTimestamp");
+        FieldToJson(jdata, pGpuTimestamp, options);
+        jdata.Key("pCpuTimestamp");
+        FieldToJson(jdata, pCpuTimestamp, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetDesc(
@@ -4982,10 +6154,11 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetNodeCount(
@@ -4995,10 +6168,11 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetNodeCount(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetNodeCount");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetNodeCount");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandQueue(
@@ -5011,16 +6185,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandQueue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandQueue");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandQueue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandQueue"], ppCommandQueue, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppCommandQueue");
+        FieldToJson(jdata, ppCommandQueue, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandAllocator(
@@ -5033,16 +6213,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandAllocator(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandAllocator");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandAllocator");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["type"], type, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandAllocator"], ppCommandAllocator, options);
+        jdata.Key("type");
+        FieldToJson(jdata, type, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppCommandAllocator");
+        FieldToJson(jdata, ppCommandAllocator, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateGraphicsPipelineState(
@@ -5055,16 +6241,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateGraphicsPipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateGraphicsPipelineState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateGraphicsPipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineState");
+        FieldToJson(jdata, ppPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateComputePipelineState(
@@ -5077,16 +6269,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateComputePipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateComputePipelineState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateComputePipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineState");
+        FieldToJson(jdata, ppPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandList(
@@ -5102,19 +6300,28 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandList(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandList");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandList");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["type"], type, options);
-        FieldToJson(args["pCommandAllocator"], pCommandAllocator, options);
-        FieldToJson(args["pInitialState"], pInitialState, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandList"], ppCommandList, options);
+        jdata.Key("nodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, nodeMask, options);
+        jdata.Key("type");
+        FieldToJson(jdata, type, options);
+        jdata.Key("pCommandAllocator");
+        FieldToJson(jdata, pCommandAllocator, options);
+        jdata.Key("pInitialState");
+        FieldToJson(jdata, pInitialState, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppCommandList");
+        FieldToJson(jdata, ppCommandList, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateDescriptorHeap(
@@ -5127,16 +6334,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateDescriptorHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDescriptorHeap");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateDescriptorHeap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDescriptorHeapDesc"], pDescriptorHeapDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        jdata.Key("pDescriptorHeapDesc");
+        FieldToJson(jdata, pDescriptorHeapDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvHeap");
+        FieldToJson(jdata, ppvHeap, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetDescriptorHandleIncrementSize(
@@ -5147,14 +6360,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetDescriptorHandleIncrementSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDescriptorHandleIncrementSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetDescriptorHandleIncrementSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["DescriptorHeapType"], DescriptorHeapType, options);
+        jdata.Key("DescriptorHeapType");
+        FieldToJson(jdata, DescriptorHeapType, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateRootSignature(
@@ -5169,18 +6386,26 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRootSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["pBlobWithRootSignature"], pBlobWithRootSignature, options);
-        FieldToJson(args["blobLengthInBytes"], blobLengthInBytes, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvRootSignature"], ppvRootSignature, options);
+        jdata.Key("nodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, nodeMask, options);
+        jdata.Key("pBlobWithRootSignature");
+        FieldToJson(jdata, pBlobWithRootSignature, options);
+        jdata.Key("blobLengthInBytes");
+        FieldToJson(jdata, blobLengthInBytes, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvRootSignature");
+        FieldToJson(jdata, ppvRootSignature, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateConstantBufferView(
@@ -5191,14 +6416,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateConstantBufferView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateConstantBufferView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateShaderResourceView(
@@ -5210,15 +6439,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateShaderResourceView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateShaderResourceView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateUnorderedAccessView(
@@ -5231,16 +6465,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateUnorderedAccessView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateUnorderedAccessView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pCounterResource"], pCounterResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("pCounterResource");
+        FieldToJson(jdata, pCounterResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateRenderTargetView(
@@ -5252,15 +6492,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateRenderTargetView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRenderTargetView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateRenderTargetView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateDepthStencilView(
@@ -5272,15 +6517,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateDepthStencilView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDepthStencilView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateDepthStencilView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateSampler(
@@ -5291,14 +6541,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateSampler(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSampler");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateSampler");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptors(
@@ -5314,19 +6568,28 @@ void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptors(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptors");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptors");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumDestDescriptorRanges"], NumDestDescriptorRanges, options);
-        FieldToJson(args["pDestDescriptorRangeStarts"], pDestDescriptorRangeStarts, options);
-        FieldToJson(args["pDestDescriptorRangeSizes"], pDestDescriptorRangeSizes, options);
-        FieldToJson(args["NumSrcDescriptorRanges"], NumSrcDescriptorRanges, options);
-        FieldToJson(args["pSrcDescriptorRangeStarts"], pSrcDescriptorRangeStarts, options);
-        FieldToJson(args["pSrcDescriptorRangeSizes"], pSrcDescriptorRangeSizes, options);
-        FieldToJson(args["DescriptorHeapsType"], DescriptorHeapsType, options);
+        jdata.Key("NumDestDescriptorRanges");
+        FieldToJson(jdata, NumDestDescriptorRanges, options);
+        jdata.Key("pDestDescriptorRangeStarts");
+        FieldToJson(jdata, pDestDescriptorRangeStarts, options);
+        jdata.Key("pDestDescriptorRangeSizes");
+        FieldToJson(jdata, pDestDescriptorRangeSizes, options);
+        jdata.Key("NumSrcDescriptorRanges");
+        FieldToJson(jdata, NumSrcDescriptorRanges, options);
+        jdata.Key("pSrcDescriptorRangeStarts");
+        FieldToJson(jdata, pSrcDescriptorRangeStarts, options);
+        jdata.Key("pSrcDescriptorRangeSizes");
+        FieldToJson(jdata, pSrcDescriptorRangeSizes, options);
+        jdata.Key("DescriptorHeapsType");
+        FieldToJson(jdata, DescriptorHeapsType, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptorsSimple(
@@ -5339,16 +6602,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptorsSimple(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptorsSimple");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptorsSimple");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumDescriptors"], NumDescriptors, options);
-        FieldToJson(args["DestDescriptorRangeStart"], DestDescriptorRangeStart, options);
-        FieldToJson(args["SrcDescriptorRangeStart"], SrcDescriptorRangeStart, options);
-        FieldToJson(args["DescriptorHeapsType"], DescriptorHeapsType, options);
+        jdata.Key("NumDescriptors");
+        FieldToJson(jdata, NumDescriptors, options);
+        jdata.Key("DestDescriptorRangeStart");
+        FieldToJson(jdata, DestDescriptorRangeStart, options);
+        jdata.Key("SrcDescriptorRangeStart");
+        FieldToJson(jdata, SrcDescriptorRangeStart, options);
+        jdata.Key("DescriptorHeapsType");
+        FieldToJson(jdata, DescriptorHeapsType, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetResourceAllocationInfo(
@@ -5361,16 +6630,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetResourceAllocationInfo(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceAllocationInfo");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceAllocationInfo");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
+        jdata.Key("visibleMask");
+        FieldToJsonAsFixedWidthBinary(jdata, visibleMask, options);
+        jdata.Key("numResourceDescs");
+        FieldToJson(jdata, numResourceDescs, options);
+        jdata.Key("pResourceDescs");
+        FieldToJson(jdata, pResourceDescs, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetCustomHeapProperties(
@@ -5382,15 +6657,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetCustomHeapProperties(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCustomHeapProperties");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetCustomHeapProperties");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["heapType"], heapType, options);
+        jdata.Key("nodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, nodeMask, options);
+        jdata.Key("heapType");
+        FieldToJson(jdata, heapType, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateCommittedResource(
@@ -5407,20 +6687,30 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommittedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommittedResource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommittedResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialResourceState"], InitialResourceState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeapProperties");
+        FieldToJson(jdata, pHeapProperties, options);
+        jdata.Key("HeapFlags");
+        FieldToJson_D3D12_HEAP_FLAGS(jdata, HeapFlags, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialResourceState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialResourceState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("riidResource");
+        FieldToJson(jdata, riidResource, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateHeap(
@@ -5433,16 +6723,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateHeap");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateHeap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvHeap");
+        FieldToJson(jdata, ppvHeap, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreatePlacedResource(
@@ -5459,20 +6755,30 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreatePlacedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreatePlacedResource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreatePlacedResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["HeapOffset"], HeapOffset, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeap");
+        FieldToJson(jdata, pHeap, options);
+        jdata.Key("HeapOffset");
+        FieldToJson(jdata, HeapOffset, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateReservedResource(
@@ -5487,18 +6793,26 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateReservedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateReservedResource");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateReservedResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateSharedHandle(
@@ -5513,18 +6827,26 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSharedHandle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pObject"], pObject, options);
-        FieldToJson(args["pAttributes"], pAttributes, options);
-        FieldToJson(args["Access"], Access, options);
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["pHandle"], pHandle, options);
+        jdata.Key("pObject");
+        FieldToJson(jdata, pObject, options);
+        jdata.Key("pAttributes");
+        FieldToJson(jdata, pAttributes, options);
+        jdata.Key("Access");
+        FieldToJson(jdata, Access, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, Name, options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandle(
@@ -5537,16 +6859,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandle");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NTHandle"], NTHandle, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvObj"], ppvObj, options);
+        jdata.Key("NTHandle");
+        FieldToJson(jdata, NTHandle, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvObj");
+        FieldToJson(jdata, ppvObj, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandleByName(
@@ -5559,16 +6887,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandleByName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandleByName");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandleByName");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["Access"], Access, options);
-        FieldToJson(args["pNTHandle"], pNTHandle, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, Name, options);
+        jdata.Key("Access");
+        FieldToJson(jdata, Access, options);
+        jdata.Key("pNTHandle");
+        FieldToJson(jdata, pNTHandle, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_MakeResident(
@@ -5580,15 +6914,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_MakeResident(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "MakeResident");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "MakeResident");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
+        jdata.Key("NumObjects");
+        FieldToJson(jdata, NumObjects, options);
+        jdata.Key("ppObjects");
+        FieldToJson(jdata, ppObjects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_Evict(
@@ -5600,15 +6939,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_Evict(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "Evict");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "Evict");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
+        jdata.Key("NumObjects");
+        FieldToJson(jdata, NumObjects, options);
+        jdata.Key("ppObjects");
+        FieldToJson(jdata, ppObjects, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateFence(
@@ -5622,17 +6966,24 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateFence(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateFence");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateFence");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["InitialValue"], InitialValue, options);
-        FieldToJson_D3D12_FENCE_FLAGS(args["Flags"], Flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFence"], ppFence, options);
+        jdata.Key("InitialValue");
+        FieldToJson(jdata, InitialValue, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_FENCE_FLAGS(jdata, Flags, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppFence");
+        FieldToJson(jdata, ppFence, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetDeviceRemovedReason(
@@ -5642,10 +6993,11 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetDeviceRemovedReason(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDeviceRemovedReason");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetDeviceRemovedReason");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetCopyableFootprints(
@@ -5662,20 +7014,30 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetCopyableFootprints(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCopyableFootprints");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetCopyableFootprints");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResourceDesc"], pResourceDesc, options);
-        FieldToJson(args["FirstSubresource"], FirstSubresource, options);
-        FieldToJson(args["NumSubresources"], NumSubresources, options);
-        FieldToJson(args["BaseOffset"], BaseOffset, options);
-        FieldToJson(args["pLayouts"], pLayouts, options);
-        FieldToJson(args["pNumRows"], pNumRows, options);
-        FieldToJson(args["pRowSizeInBytes"], pRowSizeInBytes, options);
-        FieldToJson(args["pTotalBytes"], pTotalBytes, options);
+        jdata.Key("pResourceDesc");
+        FieldToJson(jdata, pResourceDesc, options);
+        jdata.Key("FirstSubresource");
+        FieldToJson(jdata, FirstSubresource, options);
+        jdata.Key("NumSubresources");
+        FieldToJson(jdata, NumSubresources, options);
+        jdata.Key("BaseOffset");
+        FieldToJson(jdata, BaseOffset, options);
+        jdata.Key("pLayouts");
+        FieldToJson(jdata, pLayouts, options);
+        jdata.Key("pNumRows");
+        FieldToJson(jdata, pNumRows, options);
+        jdata.Key("pRowSizeInBytes");
+        FieldToJson(jdata, pRowSizeInBytes, options);
+        jdata.Key("pTotalBytes");
+        FieldToJson(jdata, pTotalBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateQueryHeap(
@@ -5688,16 +7050,22 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateQueryHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateQueryHeap");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateQueryHeap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvHeap");
+        FieldToJson(jdata, ppvHeap, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_SetStablePowerState(
@@ -5708,14 +7076,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_SetStablePowerState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "SetStablePowerState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "SetStablePowerState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandSignature(
@@ -5729,17 +7101,24 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvCommandSignature"], ppvCommandSignature, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, pRootSignature, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvCommandSignature");
+        FieldToJson(jdata, ppvCommandSignature, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetResourceTiling(
@@ -5755,19 +7134,28 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetResourceTiling(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceTiling");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceTiling");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pTiledResource"], pTiledResource, options);
-        FieldToJson(args["pNumTilesForEntireResource"], pNumTilesForEntireResource, options);
-        FieldToJson(args["pPackedMipDesc"], pPackedMipDesc, options);
-        FieldToJson(args["pStandardTileShapeForNonPackedMips"], pStandardTileShapeForNonPackedMips, options);
-        FieldToJson(args["pNumSubresourceTilings"], pNumSubresourceTilings, options);
-        FieldToJson(args["FirstSubresourceTilingToGet"], FirstSubresourceTilingToGet, options);
-        FieldToJson(args["pSubresourceTilingsForNonPackedMips"], pSubresourceTilingsForNonPackedMips, options);
+        jdata.Key("pTiledResource");
+        FieldToJson(jdata, pTiledResource, options);
+        jdata.Key("pNumTilesForEntireResource");
+        FieldToJson(jdata, pNumTilesForEntireResource, options);
+        jdata.Key("pPackedMipDesc");
+        FieldToJson(jdata, pPackedMipDesc, options);
+        jdata.Key("pStandardTileShapeForNonPackedMips");
+        FieldToJson(jdata, pStandardTileShapeForNonPackedMips, options);
+        jdata.Key("pNumSubresourceTilings");
+        FieldToJson(jdata, pNumSubresourceTilings, options);
+        jdata.Key("FirstSubresourceTilingToGet");
+        FieldToJson(jdata, FirstSubresourceTilingToGet, options);
+        jdata.Key("pSubresourceTilingsForNonPackedMips");
+        FieldToJson(jdata, pSubresourceTilingsForNonPackedMips, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device_GetAdapterLuid(
@@ -5777,10 +7165,11 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetAdapterLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetAdapterLuid");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device", object_id, "GetAdapterLuid");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_StorePipeline(
@@ -5792,15 +7181,20 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_StorePipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "StorePipeline");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "StorePipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pPipeline"], pPipeline, options);
+        jdata.Key("pName");
+        FieldToJson(jdata, pName, options);
+        jdata.Key("pPipeline");
+        FieldToJson(jdata, pPipeline, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadGraphicsPipeline(
@@ -5814,17 +7208,24 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadGraphicsPipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadGraphicsPipeline");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadGraphicsPipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        jdata.Key("pName");
+        FieldToJson(jdata, pName, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineState");
+        FieldToJson(jdata, ppPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadComputePipeline(
@@ -5838,17 +7239,24 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadComputePipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadComputePipeline");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadComputePipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        jdata.Key("pName");
+        FieldToJson(jdata, pName, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineState");
+        FieldToJson(jdata, ppPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_GetSerializedSize(
@@ -5858,10 +7266,11 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_GetSerializedSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "GetSerializedSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "GetSerializedSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_Serialize(
@@ -5873,15 +7282,20 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_Serialize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "Serialize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "Serialize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSizeInBytes"], DataSizeInBytes, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSizeInBytes");
+        FieldToJson(jdata, DataSizeInBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12PipelineLibrary1_LoadPipeline(
@@ -5895,17 +7309,24 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary1_LoadPipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary1", object_id, "LoadPipeline");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12PipelineLibrary1", object_id, "LoadPipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        jdata.Key("pName");
+        FieldToJson(jdata, pName, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineState");
+        FieldToJson(jdata, ppPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device1_CreatePipelineLibrary(
@@ -5919,17 +7340,24 @@ void Dx12JsonConsumer::Process_ID3D12Device1_CreatePipelineLibrary(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "CreatePipelineLibrary");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device1", object_id, "CreatePipelineLibrary");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pLibraryBlob"], pLibraryBlob, options);
-        FieldToJson(args["BlobLength"], BlobLength, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineLibrary"], ppPipelineLibrary, options);
+        jdata.Key("pLibraryBlob");
+        FieldToJson(jdata, pLibraryBlob, options);
+        jdata.Key("BlobLength");
+        FieldToJson(jdata, BlobLength, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineLibrary");
+        FieldToJson(jdata, ppPipelineLibrary, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device1_SetEventOnMultipleFenceCompletion(
@@ -5944,18 +7372,26 @@ void Dx12JsonConsumer::Process_ID3D12Device1_SetEventOnMultipleFenceCompletion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetEventOnMultipleFenceCompletion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device1", object_id, "SetEventOnMultipleFenceCompletion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ppFences"], ppFences, options);
-        FieldToJson(args["pFenceValues"], pFenceValues, options);
-        FieldToJson(args["NumFences"], NumFences, options);
-        FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(args["Flags"], Flags, options);
-        FieldToJson(args["hEvent"], hEvent, options);
+        jdata.Key("ppFences");
+        FieldToJson(jdata, ppFences, options);
+        jdata.Key("pFenceValues");
+        FieldToJson(jdata, pFenceValues, options);
+        jdata.Key("NumFences");
+        FieldToJson(jdata, NumFences, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(jdata, Flags, options);
+        jdata.Key("hEvent");
+        FieldToJson(jdata, hEvent, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device1_SetResidencyPriority(
@@ -5968,16 +7404,22 @@ void Dx12JsonConsumer::Process_ID3D12Device1_SetResidencyPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetResidencyPriority");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device1", object_id, "SetResidencyPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
-        FieldToJson(args["pPriorities"], pPriorities, options);
+        jdata.Key("NumObjects");
+        FieldToJson(jdata, NumObjects, options);
+        jdata.Key("ppObjects");
+        FieldToJson(jdata, ppObjects, options);
+        jdata.Key("pPriorities");
+        FieldToJson(jdata, pPriorities, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device2_CreatePipelineState(
@@ -5990,16 +7432,22 @@ void Dx12JsonConsumer::Process_ID3D12Device2_CreatePipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device2", object_id, "CreatePipelineState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device2", object_id, "CreatePipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppPipelineState");
+        FieldToJson(jdata, ppPipelineState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromAddress(
@@ -6012,16 +7460,22 @@ void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromAddress(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromAddress");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromAddress");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pAddress"], pAddress, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        jdata.Key("pAddress");
+        FieldToJson(jdata, pAddress, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvHeap");
+        FieldToJson(jdata, ppvHeap, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromFileMapping(
@@ -6034,16 +7488,22 @@ void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromFileMapping(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromFileMapping");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromFileMapping");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["hFileMapping"], hFileMapping, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        jdata.Key("hFileMapping");
+        FieldToJson(jdata, hFileMapping, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvHeap");
+        FieldToJson(jdata, ppvHeap, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device3_EnqueueMakeResident(
@@ -6058,18 +7518,26 @@ void Dx12JsonConsumer::Process_ID3D12Device3_EnqueueMakeResident(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "EnqueueMakeResident");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device3", object_id, "EnqueueMakeResident");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_RESIDENCY_FLAGS(args["Flags"], Flags, options);
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
-        FieldToJson(args["pFenceToSignal"], pFenceToSignal, options);
-        FieldToJson(args["FenceValueToSignal"], FenceValueToSignal, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RESIDENCY_FLAGS(jdata, Flags, options);
+        jdata.Key("NumObjects");
+        FieldToJson(jdata, NumObjects, options);
+        jdata.Key("ppObjects");
+        FieldToJson(jdata, ppObjects, options);
+        jdata.Key("pFenceToSignal");
+        FieldToJson(jdata, pFenceToSignal, options);
+        jdata.Key("FenceValueToSignal");
+        FieldToJson(jdata, FenceValueToSignal, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetStatusFence(
@@ -6081,15 +7549,20 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetStatusFence(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetStatusFence");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetStatusFence");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFence"], ppFence, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppFence");
+        FieldToJson(jdata, ppFence, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetSessionStatus(
@@ -6099,10 +7572,11 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetSessionStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetSessionStatus");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetSessionStatus");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_PROTECTED_SESSION_STATUS(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson_D3D12_PROTECTED_SESSION_STATUS(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession_GetDesc(
@@ -6112,10 +7586,11 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ProtectedResourceSession", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommandList1(
@@ -6130,18 +7605,26 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommandList1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommandList1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommandList1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["type"], type, options);
-        FieldToJson_D3D12_COMMAND_LIST_FLAGS(args["flags"], flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandList"], ppCommandList, options);
+        jdata.Key("nodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, nodeMask, options);
+        jdata.Key("type");
+        FieldToJson(jdata, type, options);
+        jdata.Key("flags");
+        FieldToJson_D3D12_COMMAND_LIST_FLAGS(jdata, flags, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppCommandList");
+        FieldToJson(jdata, ppCommandList, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device4_CreateProtectedResourceSession(
@@ -6154,16 +7637,22 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateProtectedResourceSession");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device4", object_id, "CreateProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppSession"], ppSession, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppSession");
+        FieldToJson(jdata, ppSession, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommittedResource1(
@@ -6181,21 +7670,32 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommittedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommittedResource1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommittedResource1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialResourceState"], InitialResourceState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeapProperties");
+        FieldToJson(jdata, pHeapProperties, options);
+        jdata.Key("HeapFlags");
+        FieldToJson_D3D12_HEAP_FLAGS(jdata, HeapFlags, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialResourceState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialResourceState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("pProtectedSession");
+        FieldToJson(jdata, pProtectedSession, options);
+        jdata.Key("riidResource");
+        FieldToJson(jdata, riidResource, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device4_CreateHeap1(
@@ -6209,17 +7709,24 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateHeap1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateHeap1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device4", object_id, "CreateHeap1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pProtectedSession");
+        FieldToJson(jdata, pProtectedSession, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvHeap");
+        FieldToJson(jdata, ppvHeap, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device4_CreateReservedResource1(
@@ -6235,19 +7742,28 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateReservedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateReservedResource1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device4", object_id, "CreateReservedResource1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("pProtectedSession");
+        FieldToJson(jdata, pProtectedSession, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device4_GetResourceAllocationInfo1(
@@ -6261,17 +7777,24 @@ void Dx12JsonConsumer::Process_ID3D12Device4_GetResourceAllocationInfo1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "GetResourceAllocationInfo1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device4", object_id, "GetResourceAllocationInfo1");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
-        FieldToJson(args["pResourceAllocationInfo1"], pResourceAllocationInfo1, options);
+        jdata.Key("visibleMask");
+        FieldToJsonAsFixedWidthBinary(jdata, visibleMask, options);
+        jdata.Key("numResourceDescs");
+        FieldToJson(jdata, numResourceDescs, options);
+        jdata.Key("pResourceDescs");
+        FieldToJson(jdata, pResourceDescs, options);
+        jdata.Key("pResourceAllocationInfo1");
+        FieldToJson(jdata, pResourceAllocationInfo1, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12LifetimeOwner_LifetimeStateUpdated(
@@ -6281,13 +7804,16 @@ void Dx12JsonConsumer::Process_ID3D12LifetimeOwner_LifetimeStateUpdated(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeOwner", object_id, "LifetimeStateUpdated");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12LifetimeOwner", object_id, "LifetimeStateUpdated");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NewState"], NewState, options);
+        jdata.Key("NewState");
+        FieldToJson(jdata, NewState, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetLUID(
@@ -6297,10 +7823,11 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetLUID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetLUID");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetLUID");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetSwapChainObject(
@@ -6312,15 +7839,20 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetSwapChainObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetSwapChainObject");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetSwapChainObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppv"], ppv, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppv");
+        FieldToJson(jdata, ppv, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetCurrentResourceAndCommandQueue(
@@ -6334,17 +7866,24 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetCurrentResourceAndCom
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetCurrentResourceAndCommandQueue");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetCurrentResourceAndCommandQueue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
-        FieldToJson(args["riidQueue"], riidQueue, options);
-        FieldToJson(args["ppvQueue"], ppvQueue, options);
+        jdata.Key("riidResource");
+        FieldToJson(jdata, riidResource, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
+        jdata.Key("riidQueue");
+        FieldToJson(jdata, riidQueue, options);
+        jdata.Key("ppvQueue");
+        FieldToJson(jdata, ppvQueue, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_InsertImplicitSync(
@@ -6354,10 +7893,11 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_InsertImplicitSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "InsertImplicitSync");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "InsertImplicitSync");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12LifetimeTracker_DestroyOwnedObject(
@@ -6368,14 +7908,18 @@ void Dx12JsonConsumer::Process_ID3D12LifetimeTracker_DestroyOwnedObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeTracker", object_id, "DestroyOwnedObject");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12LifetimeTracker", object_id, "DestroyOwnedObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pObject"], pObject, options);
+        jdata.Key("pObject");
+        FieldToJson(jdata, pObject, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderIdentifier(
@@ -6386,14 +7930,18 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderIdentifier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderIdentifier");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderIdentifier");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pExportName"], pExportName, options);
+        jdata.Key("pExportName");
+        FieldToJson(jdata, pExportName, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderStackSize(
@@ -6404,14 +7952,18 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderStackSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pExportName"], pExportName, options);
+        jdata.Key("pExportName");
+        FieldToJson(jdata, pExportName, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetPipelineStackSize(
@@ -6421,10 +7973,11 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetPipelineStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetPipelineStackSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetPipelineStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_SetPipelineStackSize(
@@ -6434,13 +7987,16 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_SetPipelineStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "SetPipelineStackSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "SetPipelineStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["PipelineStackSizeInBytes"], PipelineStackSizeInBytes, options);
+        jdata.Key("PipelineStackSizeInBytes");
+        FieldToJson(jdata, PipelineStackSizeInBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_CreateLifetimeTracker(
@@ -6453,16 +8009,22 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateLifetimeTracker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateLifetimeTracker");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "CreateLifetimeTracker");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pOwner"], pOwner, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvTracker"], ppvTracker, options);
+        jdata.Key("pOwner");
+        FieldToJson(jdata, pOwner, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvTracker");
+        FieldToJson(jdata, ppvTracker, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_RemoveDevice(
@@ -6471,9 +8033,9 @@ void Dx12JsonConsumer::Process_ID3D12Device5_RemoveDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "RemoveDevice");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "RemoveDevice");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommands(
@@ -6485,15 +8047,20 @@ void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommands(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommands");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommands");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pNumMetaCommands"], pNumMetaCommands, options);
-        FieldToJson(args["pDescs"], pDescs, options);
+        jdata.Key("pNumMetaCommands");
+        FieldToJson(jdata, pNumMetaCommands, options);
+        jdata.Key("pDescs");
+        FieldToJson(jdata, pDescs, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommandParameters(
@@ -6508,18 +8075,26 @@ void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommandParameters(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommandParameters");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommandParameters");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["CommandId"], CommandId, options);
-        FieldToJson(args["Stage"], Stage, options);
-        FieldToJson(args["pTotalStructureSizeInBytes"], pTotalStructureSizeInBytes, options);
-        FieldToJson(args["pParameterCount"], pParameterCount, options);
-        FieldToJson(args["pParameterDescs"], pParameterDescs, options);
+        jdata.Key("CommandId");
+        FieldToJson(jdata, CommandId, options);
+        jdata.Key("Stage");
+        FieldToJson(jdata, Stage, options);
+        jdata.Key("pTotalStructureSizeInBytes");
+        FieldToJson(jdata, pTotalStructureSizeInBytes, options);
+        jdata.Key("pParameterCount");
+        FieldToJson(jdata, pParameterCount, options);
+        jdata.Key("pParameterDescs");
+        FieldToJson(jdata, pParameterDescs, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_CreateMetaCommand(
@@ -6535,19 +8110,28 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateMetaCommand");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "CreateMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["CommandId"], CommandId, options);
-        FieldToJsonAsFixedWidthBinary(args["NodeMask"], NodeMask, options);
-        FieldToJson(args["pCreationParametersData"], pCreationParametersData, options);
-        FieldToJson(args["CreationParametersDataSizeInBytes"], CreationParametersDataSizeInBytes, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppMetaCommand"], ppMetaCommand, options);
+        jdata.Key("CommandId");
+        FieldToJson(jdata, CommandId, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, NodeMask, options);
+        jdata.Key("pCreationParametersData");
+        FieldToJson(jdata, pCreationParametersData, options);
+        jdata.Key("CreationParametersDataSizeInBytes");
+        FieldToJson(jdata, CreationParametersDataSizeInBytes, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppMetaCommand");
+        FieldToJson(jdata, ppMetaCommand, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_CreateStateObject(
@@ -6560,16 +8144,22 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateStateObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateStateObject");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "CreateStateObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppStateObject"], ppStateObject, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppStateObject");
+        FieldToJson(jdata, ppStateObject, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_GetRaytracingAccelerationStructurePrebuildInfo(
@@ -6580,14 +8170,18 @@ void Dx12JsonConsumer::Process_ID3D12Device5_GetRaytracingAccelerationStructureP
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "GetRaytracingAccelerationStructurePrebuildInfo");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "GetRaytracingAccelerationStructurePrebuildInfo");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pInfo"], pInfo, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device5_CheckDriverMatchingIdentifier(
@@ -6599,15 +8193,20 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CheckDriverMatchingIdentifier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CheckDriverMatchingIdentifier");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device5", object_id, "CheckDriverMatchingIdentifier");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["SerializedDataType"], SerializedDataType, options);
-        FieldToJson(args["pIdentifierToCheck"], pIdentifierToCheck, options);
+        jdata.Key("SerializedDataType");
+        FieldToJson(jdata, SerializedDataType, options);
+        jdata.Key("pIdentifierToCheck");
+        FieldToJson(jdata, pIdentifierToCheck, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetAutoBreadcrumbsEnablement(
@@ -6617,13 +8216,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetAutoBr
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetAutoBreadcrumbsEnablement");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetAutoBreadcrumbsEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        jdata.Key("Enablement");
+        FieldToJson(jdata, Enablement, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetPageFaultEnablement(
@@ -6633,13 +8235,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetPageFa
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetPageFaultEnablement");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetPageFaultEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        jdata.Key("Enablement");
+        FieldToJson(jdata, Enablement, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetWatsonDumpEnablement(
@@ -6649,13 +8254,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetWatson
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetWatsonDumpEnablement");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetWatsonDumpEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        jdata.Key("Enablement");
+        FieldToJson(jdata, Enablement, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings1_SetBreadcrumbContextEnablement(
@@ -6665,13 +8273,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings1_SetBread
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings1", object_id, "SetBreadcrumbContextEnablement");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings1", object_id, "SetBreadcrumbContextEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        jdata.Key("Enablement");
+        FieldToJson(jdata, Enablement, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings2_UseMarkersOnlyAutoBreadcrumbs(
@@ -6681,13 +8292,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings2_UseMarke
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings2", object_id, "UseMarkersOnlyAutoBreadcrumbs");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings2", object_id, "UseMarkersOnlyAutoBreadcrumbs");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["MarkersOnly"], MarkersOnly, options);
+        jdata.Key("MarkersOnly");
+        Bool32ToJson(jdata, MarkersOnly, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumbsOutput(
@@ -6698,14 +8312,18 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumb
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetAutoBreadcrumbsOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetAutoBreadcrumbsOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        jdata.Key("pOutput");
+        FieldToJson(jdata, pOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetPageFaultAllocationOutput(
@@ -6716,14 +8334,18 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetPageFaultAlloc
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetPageFaultAllocationOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetPageFaultAllocationOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        jdata.Key("pOutput");
+        FieldToJson(jdata, pOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrumbsOutput1(
@@ -6734,14 +8356,18 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrum
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetAutoBreadcrumbsOutput1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetAutoBreadcrumbsOutput1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        jdata.Key("pOutput");
+        FieldToJson(jdata, pOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetPageFaultAllocationOutput1(
@@ -6752,14 +8378,18 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetPageFaultAllo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetPageFaultAllocationOutput1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetPageFaultAllocationOutput1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        jdata.Key("pOutput");
+        FieldToJson(jdata, pOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetPageFaultAllocationOutput2(
@@ -6770,14 +8400,18 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetPageFaultAllo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetPageFaultAllocationOutput2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetPageFaultAllocationOutput2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        jdata.Key("pOutput");
+        FieldToJson(jdata, pOutput, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetDeviceState(
@@ -6787,10 +8421,11 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetDeviceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetDeviceState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetDeviceState");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device6_SetBackgroundProcessingMode(
@@ -6804,17 +8439,24 @@ void Dx12JsonConsumer::Process_ID3D12Device6_SetBackgroundProcessingMode(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device6", object_id, "SetBackgroundProcessingMode");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device6", object_id, "SetBackgroundProcessingMode");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Mode"], Mode, options);
-        FieldToJson(args["MeasurementsAction"], MeasurementsAction, options);
-        FieldToJson(args["hEventToSignalUponCompletion"], hEventToSignalUponCompletion, options);
-        Bool32ToJson(args["pbFurtherMeasurementsDesired"], pbFurtherMeasurementsDesired, options);
+        jdata.Key("Mode");
+        FieldToJson(jdata, Mode, options);
+        jdata.Key("MeasurementsAction");
+        FieldToJson(jdata, MeasurementsAction, options);
+        jdata.Key("hEventToSignalUponCompletion");
+        FieldToJson(jdata, hEventToSignalUponCompletion, options);
+        jdata.Key("pbFurtherMeasurementsDesired");
+        Bool32ToJson(jdata, pbFurtherMeasurementsDesired, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession1_GetDesc1(
@@ -6824,10 +8466,11 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession1", object_id, "GetDesc1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ProtectedResourceSession1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device7_AddToStateObject(
@@ -6841,17 +8484,24 @@ void Dx12JsonConsumer::Process_ID3D12Device7_AddToStateObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "AddToStateObject");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device7", object_id, "AddToStateObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pAddition"], pAddition, options);
-        FieldToJson(args["pStateObjectToGrowFrom"], pStateObjectToGrowFrom, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppNewStateObject"], ppNewStateObject, options);
+        jdata.Key("pAddition");
+        FieldToJson(jdata, pAddition, options);
+        jdata.Key("pStateObjectToGrowFrom");
+        FieldToJson(jdata, pStateObjectToGrowFrom, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppNewStateObject");
+        FieldToJson(jdata, ppNewStateObject, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device7_CreateProtectedResourceSession1(
@@ -6864,16 +8514,22 @@ void Dx12JsonConsumer::Process_ID3D12Device7_CreateProtectedResourceSession1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "CreateProtectedResourceSession1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device7", object_id, "CreateProtectedResourceSession1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppSession"], ppSession, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppSession");
+        FieldToJson(jdata, ppSession, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device8_GetResourceAllocationInfo2(
@@ -6887,17 +8543,24 @@ void Dx12JsonConsumer::Process_ID3D12Device8_GetResourceAllocationInfo2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetResourceAllocationInfo2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device8", object_id, "GetResourceAllocationInfo2");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
-        FieldToJson(args["pResourceAllocationInfo1"], pResourceAllocationInfo1, options);
+        jdata.Key("visibleMask");
+        FieldToJsonAsFixedWidthBinary(jdata, visibleMask, options);
+        jdata.Key("numResourceDescs");
+        FieldToJson(jdata, numResourceDescs, options);
+        jdata.Key("pResourceDescs");
+        FieldToJson(jdata, pResourceDescs, options);
+        jdata.Key("pResourceAllocationInfo1");
+        FieldToJson(jdata, pResourceAllocationInfo1, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device8_CreateCommittedResource2(
@@ -6915,21 +8578,32 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreateCommittedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateCommittedResource2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device8", object_id, "CreateCommittedResource2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialResourceState"], InitialResourceState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeapProperties");
+        FieldToJson(jdata, pHeapProperties, options);
+        jdata.Key("HeapFlags");
+        FieldToJson_D3D12_HEAP_FLAGS(jdata, HeapFlags, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialResourceState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialResourceState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("pProtectedSession");
+        FieldToJson(jdata, pProtectedSession, options);
+        jdata.Key("riidResource");
+        FieldToJson(jdata, riidResource, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device8_CreatePlacedResource1(
@@ -6946,20 +8620,30 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreatePlacedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreatePlacedResource1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device8", object_id, "CreatePlacedResource1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["HeapOffset"], HeapOffset, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeap");
+        FieldToJson(jdata, pHeap, options);
+        jdata.Key("HeapOffset");
+        FieldToJson(jdata, HeapOffset, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, InitialState, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device8_CreateSamplerFeedbackUnorderedAccessView(
@@ -6971,15 +8655,20 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreateSamplerFeedbackUnorderedAcces
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateSamplerFeedbackUnorderedAccessView");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device8", object_id, "CreateSamplerFeedbackUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pTargetedResource"], pTargetedResource, options);
-        FieldToJson(args["pFeedbackResource"], pFeedbackResource, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pTargetedResource");
+        FieldToJson(jdata, pTargetedResource, options);
+        jdata.Key("pFeedbackResource");
+        FieldToJson(jdata, pFeedbackResource, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device8_GetCopyableFootprints1(
@@ -6996,20 +8685,30 @@ void Dx12JsonConsumer::Process_ID3D12Device8_GetCopyableFootprints1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetCopyableFootprints1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device8", object_id, "GetCopyableFootprints1");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResourceDesc"], pResourceDesc, options);
-        FieldToJson(args["FirstSubresource"], FirstSubresource, options);
-        FieldToJson(args["NumSubresources"], NumSubresources, options);
-        FieldToJson(args["BaseOffset"], BaseOffset, options);
-        FieldToJson(args["pLayouts"], pLayouts, options);
-        FieldToJson(args["pNumRows"], pNumRows, options);
-        FieldToJson(args["pRowSizeInBytes"], pRowSizeInBytes, options);
-        FieldToJson(args["pTotalBytes"], pTotalBytes, options);
+        jdata.Key("pResourceDesc");
+        FieldToJson(jdata, pResourceDesc, options);
+        jdata.Key("FirstSubresource");
+        FieldToJson(jdata, FirstSubresource, options);
+        jdata.Key("NumSubresources");
+        FieldToJson(jdata, NumSubresources, options);
+        jdata.Key("BaseOffset");
+        FieldToJson(jdata, BaseOffset, options);
+        jdata.Key("pLayouts");
+        FieldToJson(jdata, pLayouts, options);
+        jdata.Key("pNumRows");
+        FieldToJson(jdata, pNumRows, options);
+        jdata.Key("pRowSizeInBytes");
+        FieldToJson(jdata, pRowSizeInBytes, options);
+        jdata.Key("pTotalBytes");
+        FieldToJson(jdata, pTotalBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource1_GetProtectedResourceSession(
@@ -7021,15 +8720,20 @@ void Dx12JsonConsumer::Process_ID3D12Resource1_GetProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource1", object_id, "GetProtectedResourceSession");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource1", object_id, "GetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppProtectedSession"], ppProtectedSession, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppProtectedSession");
+        FieldToJson(jdata, ppProtectedSession, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Resource2_GetDesc1(
@@ -7039,10 +8743,11 @@ void Dx12JsonConsumer::Process_ID3D12Resource2_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource2", object_id, "GetDesc1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Resource2", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Heap1_GetProtectedResourceSession(
@@ -7054,15 +8759,20 @@ void Dx12JsonConsumer::Process_ID3D12Heap1_GetProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap1", object_id, "GetProtectedResourceSession");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Heap1", object_id, "GetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppProtectedSession"], ppProtectedSession, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppProtectedSession");
+        FieldToJson(jdata, ppProtectedSession, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList3_SetProtectedResourceSession(
@@ -7072,13 +8782,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList3_SetProtectedResourceSe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList3", object_id, "SetProtectedResourceSession");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList3", object_id, "SetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pProtectedResourceSession"], pProtectedResourceSession, options);
+        jdata.Key("pProtectedResourceSession");
+        FieldToJson(jdata, pProtectedResourceSession, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12MetaCommand_GetRequiredParameterResourceSize(
@@ -7090,15 +8803,20 @@ void Dx12JsonConsumer::Process_ID3D12MetaCommand_GetRequiredParameterResourceSiz
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12MetaCommand", object_id, "GetRequiredParameterResourceSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12MetaCommand", object_id, "GetRequiredParameterResourceSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Stage"], Stage, options);
-        FieldToJson(args["ParameterIndex"], ParameterIndex, options);
+        jdata.Key("Stage");
+        FieldToJson(jdata, Stage, options);
+        jdata.Key("ParameterIndex");
+        FieldToJson(jdata, ParameterIndex, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BeginRenderPass(
@@ -7111,16 +8829,22 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BeginRenderPass(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BeginRenderPass");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BeginRenderPass");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumRenderTargets"], NumRenderTargets, options);
-        FieldToJson(args["pRenderTargets"], pRenderTargets, options);
-        FieldToJson(args["pDepthStencil"], pDepthStencil, options);
-        FieldToJson_D3D12_RENDER_PASS_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("NumRenderTargets");
+        FieldToJson(jdata, NumRenderTargets, options);
+        jdata.Key("pRenderTargets");
+        FieldToJson(jdata, pRenderTargets, options);
+        jdata.Key("pDepthStencil");
+        FieldToJson(jdata, pDepthStencil, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RENDER_PASS_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EndRenderPass(
@@ -7129,9 +8853,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EndRenderPass(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EndRenderPass");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EndRenderPass");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_InitializeMetaCommand(
@@ -7143,15 +8867,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_InitializeMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "InitializeMetaCommand");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "InitializeMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pMetaCommand"], pMetaCommand, options);
-        FieldToJson(args["pInitializationParametersData"], pInitializationParametersData, options);
-        FieldToJson(args["InitializationParametersDataSizeInBytes"], InitializationParametersDataSizeInBytes, options);
+        jdata.Key("pMetaCommand");
+        FieldToJson(jdata, pMetaCommand, options);
+        jdata.Key("pInitializationParametersData");
+        FieldToJson(jdata, pInitializationParametersData, options);
+        jdata.Key("InitializationParametersDataSizeInBytes");
+        FieldToJson(jdata, InitializationParametersDataSizeInBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_ExecuteMetaCommand(
@@ -7163,15 +8892,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_ExecuteMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "ExecuteMetaCommand");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "ExecuteMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pMetaCommand"], pMetaCommand, options);
-        FieldToJson(args["pExecutionParametersData"], pExecutionParametersData, options);
-        FieldToJson(args["ExecutionParametersDataSizeInBytes"], ExecutionParametersDataSizeInBytes, options);
+        jdata.Key("pMetaCommand");
+        FieldToJson(jdata, pMetaCommand, options);
+        jdata.Key("pExecutionParametersData");
+        FieldToJson(jdata, pExecutionParametersData, options);
+        jdata.Key("ExecutionParametersDataSizeInBytes");
+        FieldToJson(jdata, ExecutionParametersDataSizeInBytes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BuildRaytracingAccelerationStructure(
@@ -7183,15 +8917,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BuildRaytracingAcceler
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BuildRaytracingAccelerationStructure");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BuildRaytracingAccelerationStructure");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["NumPostbuildInfoDescs"], NumPostbuildInfoDescs, options);
-        FieldToJson(args["pPostbuildInfoDescs"], pPostbuildInfoDescs, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("NumPostbuildInfoDescs");
+        FieldToJson(jdata, NumPostbuildInfoDescs, options);
+        jdata.Key("pPostbuildInfoDescs");
+        FieldToJson(jdata, pPostbuildInfoDescs, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EmitRaytracingAccelerationStructurePostbuildInfo(
@@ -7203,15 +8942,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EmitRaytracingAccelera
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EmitRaytracingAccelerationStructurePostbuildInfo");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EmitRaytracingAccelerationStructurePostbuildInfo");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["NumSourceAccelerationStructures"], NumSourceAccelerationStructures, options);
-        FieldToJsonAsHex(args["pSourceAccelerationStructureData"], pSourceAccelerationStructureData, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("NumSourceAccelerationStructures");
+        FieldToJson(jdata, NumSourceAccelerationStructures, options);
+        jdata.Key("pSourceAccelerationStructureData");
+        FieldToJsonAsHex(jdata, pSourceAccelerationStructureData, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_CopyRaytracingAccelerationStructure(
@@ -7223,15 +8967,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_CopyRaytracingAccelera
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "CopyRaytracingAccelerationStructure");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "CopyRaytracingAccelerationStructure");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsHex(args["DestAccelerationStructureData"], DestAccelerationStructureData, options);
-        FieldToJsonAsHex(args["SourceAccelerationStructureData"], SourceAccelerationStructureData, options);
-        FieldToJson(args["Mode"], Mode, options);
+        jdata.Key("DestAccelerationStructureData");
+        FieldToJsonAsHex(jdata, DestAccelerationStructureData, options);
+        jdata.Key("SourceAccelerationStructureData");
+        FieldToJsonAsHex(jdata, SourceAccelerationStructureData, options);
+        jdata.Key("Mode");
+        FieldToJson(jdata, Mode, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_SetPipelineState1(
@@ -7241,13 +8990,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_SetPipelineState1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "SetPipelineState1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "SetPipelineState1");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pStateObject"], pStateObject, options);
+        jdata.Key("pStateObject");
+        FieldToJson(jdata, pStateObject, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_DispatchRays(
@@ -7257,13 +9009,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_DispatchRays(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "DispatchRays");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "DispatchRays");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_FindValue(
@@ -7277,17 +9032,24 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_FindValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "FindValue");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "FindValue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pKey"], pKey, options);
-        FieldToJson(args["KeySize"], KeySize, options);
-        FieldToJson(args["pValue"], pValue, options);
-        FieldToJson(args["pValueSize"], pValueSize, options);
+        jdata.Key("pKey");
+        FieldToJson(jdata, pKey, options);
+        jdata.Key("KeySize");
+        FieldToJson(jdata, KeySize, options);
+        jdata.Key("pValue");
+        FieldToJson(jdata, pValue, options);
+        jdata.Key("pValueSize");
+        FieldToJson(jdata, pValueSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_StoreValue(
@@ -7301,17 +9063,24 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_StoreValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "StoreValue");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "StoreValue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pKey"], pKey, options);
-        FieldToJson(args["KeySize"], KeySize, options);
-        FieldToJson(args["pValue"], pValue, options);
-        FieldToJson(args["ValueSize"], ValueSize, options);
+        jdata.Key("pKey");
+        FieldToJson(jdata, pKey, options);
+        jdata.Key("KeySize");
+        FieldToJson(jdata, KeySize, options);
+        jdata.Key("pValue");
+        FieldToJson(jdata, pValue, options);
+        jdata.Key("ValueSize");
+        FieldToJson(jdata, ValueSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_SetDeleteOnDestroy(
@@ -7320,9 +9089,9 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_SetDeleteOnDestroy(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "SetDeleteOnDestroy");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "SetDeleteOnDestroy");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_GetDesc(
@@ -7332,10 +9101,11 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device9_CreateShaderCacheSession(
@@ -7348,16 +9118,22 @@ void Dx12JsonConsumer::Process_ID3D12Device9_CreateShaderCacheSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateShaderCacheSession");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device9", object_id, "CreateShaderCacheSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvSession"], ppvSession, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvSession");
+        FieldToJson(jdata, ppvSession, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device9_ShaderCacheControl(
@@ -7369,15 +9145,20 @@ void Dx12JsonConsumer::Process_ID3D12Device9_ShaderCacheControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "ShaderCacheControl");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device9", object_id, "ShaderCacheControl");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(args["Kinds"], Kinds, options);
-        FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(args["Control"], Control, options);
+        jdata.Key("Kinds");
+        FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(jdata, Kinds, options);
+        jdata.Key("Control");
+        FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(jdata, Control, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device9_CreateCommandQueue1(
@@ -7391,17 +9172,24 @@ void Dx12JsonConsumer::Process_ID3D12Device9_CreateCommandQueue1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateCommandQueue1");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device9", object_id, "CreateCommandQueue1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["CreatorID"], CreatorID, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandQueue"], ppCommandQueue, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("CreatorID");
+        FieldToJson(jdata, CreatorID, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppCommandQueue");
+        FieldToJson(jdata, ppCommandQueue, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device10_CreateCommittedResource3(
@@ -7421,23 +9209,36 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreateCommittedResource3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateCommittedResource3");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device10", object_id, "CreateCommittedResource3");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["InitialLayout"], InitialLayout, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["NumCastableFormats"], NumCastableFormats, options);
-        FieldToJson(args["pCastableFormats"], pCastableFormats, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeapProperties");
+        FieldToJson(jdata, pHeapProperties, options);
+        jdata.Key("HeapFlags");
+        FieldToJson_D3D12_HEAP_FLAGS(jdata, HeapFlags, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialLayout");
+        FieldToJson(jdata, InitialLayout, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("pProtectedSession");
+        FieldToJson(jdata, pProtectedSession, options);
+        jdata.Key("NumCastableFormats");
+        FieldToJson(jdata, NumCastableFormats, options);
+        jdata.Key("pCastableFormats");
+        FieldToJson(jdata, pCastableFormats, options);
+        jdata.Key("riidResource");
+        FieldToJson(jdata, riidResource, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device10_CreatePlacedResource2(
@@ -7456,22 +9257,34 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreatePlacedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreatePlacedResource2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device10", object_id, "CreatePlacedResource2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["HeapOffset"], HeapOffset, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["InitialLayout"], InitialLayout, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["NumCastableFormats"], NumCastableFormats, options);
-        FieldToJson(args["pCastableFormats"], pCastableFormats, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pHeap");
+        FieldToJson(jdata, pHeap, options);
+        jdata.Key("HeapOffset");
+        FieldToJson(jdata, HeapOffset, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialLayout");
+        FieldToJson(jdata, InitialLayout, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("NumCastableFormats");
+        FieldToJson(jdata, NumCastableFormats, options);
+        jdata.Key("pCastableFormats");
+        FieldToJson(jdata, pCastableFormats, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device10_CreateReservedResource2(
@@ -7489,21 +9302,32 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreateReservedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateReservedResource2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device10", object_id, "CreateReservedResource2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["InitialLayout"], InitialLayout, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["NumCastableFormats"], NumCastableFormats, options);
-        FieldToJson(args["pCastableFormats"], pCastableFormats, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("InitialLayout");
+        FieldToJson(jdata, InitialLayout, options);
+        jdata.Key("pOptimizedClearValue");
+        FieldToJson(jdata, pOptimizedClearValue, options);
+        jdata.Key("pProtectedSession");
+        FieldToJson(jdata, pProtectedSession, options);
+        jdata.Key("NumCastableFormats");
+        FieldToJson(jdata, NumCastableFormats, options);
+        jdata.Key("pCastableFormats");
+        FieldToJson(jdata, pCastableFormats, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvResource");
+        FieldToJson(jdata, ppvResource, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device11_CreateSampler2(
@@ -7514,14 +9338,18 @@ void Dx12JsonConsumer::Process_ID3D12Device11_CreateSampler2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device11", object_id, "CreateSampler2");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device11", object_id, "CreateSampler2");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("DestDescriptor");
+        FieldToJson(jdata, DestDescriptor, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Device12_GetResourceAllocationInfo3(
@@ -7537,19 +9365,28 @@ void Dx12JsonConsumer::Process_ID3D12Device12_GetResourceAllocationInfo3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device12", object_id, "GetResourceAllocationInfo3");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Device12", object_id, "GetResourceAllocationInfo3");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
-        FieldToJson(args["pNumCastableFormats"], pNumCastableFormats, options);
-        FieldToJson(args["ppCastableFormats"], ppCastableFormats, options);
-        FieldToJson(args["pResourceAllocationInfo1"], pResourceAllocationInfo1, options);
+        jdata.Key("visibleMask");
+        FieldToJsonAsFixedWidthBinary(jdata, visibleMask, options);
+        jdata.Key("numResourceDescs");
+        FieldToJson(jdata, numResourceDescs, options);
+        jdata.Key("pResourceDescs");
+        FieldToJson(jdata, pResourceDescs, options);
+        jdata.Key("pNumCastableFormats");
+        FieldToJson(jdata, pNumCastableFormats, options);
+        jdata.Key("ppCastableFormats");
+        FieldToJson(jdata, ppCastableFormats, options);
+        jdata.Key("pResourceAllocationInfo1");
+        FieldToJson(jdata, pResourceAllocationInfo1, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_ShareWithHost(
@@ -7561,15 +9398,20 @@ void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_ShareWithHost(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "ShareWithHost");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "ShareWithHost");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pObject"], pObject, options);
-        FieldToJson(args["pHandle"], pHandle, options);
+        jdata.Key("pObject");
+        FieldToJson(jdata, pObject, options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_CreateFenceFd(
@@ -7582,16 +9424,22 @@ void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_CreateFenceFd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "CreateFenceFd");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "CreateFenceFd");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["FenceValue"], FenceValue, options);
-        FieldToJson(args["pFenceFd"], pFenceFd, options);
+        jdata.Key("pFence");
+        FieldToJson(jdata, pFence, options);
+        jdata.Key("FenceValue");
+        FieldToJson(jdata, FenceValue, options);
+        jdata.Key("pFenceFd");
+        FieldToJson(jdata, pFenceFd, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Tools_EnableShaderInstrumentation(
@@ -7601,13 +9449,16 @@ void Dx12JsonConsumer::Process_ID3D12Tools_EnableShaderInstrumentation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "EnableShaderInstrumentation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Tools", object_id, "EnableShaderInstrumentation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        jdata.Key("bEnable");
+        Bool32ToJson(jdata, bEnable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Tools_ShaderInstrumentationEnabled(
@@ -7617,10 +9468,11 @@ void Dx12JsonConsumer::Process_ID3D12Tools_ShaderInstrumentationEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "ShaderInstrumentationEnabled");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Tools", object_id, "ShaderInstrumentationEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SDKConfiguration_SetSDKVersion(
@@ -7632,15 +9484,20 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration_SetSDKVersion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration", object_id, "SetSDKVersion");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SDKConfiguration", object_id, "SetSDKVersion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["SDKVersion"], SDKVersion, options);
-        FieldToJson(args["SDKPath"], SDKPath, options);
+        jdata.Key("SDKVersion");
+        FieldToJson(jdata, SDKVersion, options);
+        jdata.Key("SDKPath");
+        FieldToJson(jdata, SDKPath, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_CreateDeviceFactory(
@@ -7654,17 +9511,24 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_CreateDeviceFactory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "CreateDeviceFactory");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "CreateDeviceFactory");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["SDKVersion"], SDKVersion, options);
-        FieldToJson(args["SDKPath"], SDKPath, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvFactory"], ppvFactory, options);
+        jdata.Key("SDKVersion");
+        FieldToJson(jdata, SDKVersion, options);
+        jdata.Key("SDKPath");
+        FieldToJson(jdata, SDKPath, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvFactory");
+        FieldToJson(jdata, ppvFactory, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_FreeUnusedSDKs(
@@ -7673,9 +9537,9 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_FreeUnusedSDKs(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "FreeUnusedSDKs");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "FreeUnusedSDKs");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_InitializeFromGlobalState(
@@ -7685,10 +9549,11 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_InitializeFromGlobalState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "InitializeFromGlobalState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "InitializeFromGlobalState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_ApplyToGlobalState(
@@ -7698,10 +9563,11 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_ApplyToGlobalState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "ApplyToGlobalState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "ApplyToGlobalState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_SetFlags(
@@ -7712,14 +9578,18 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_SetFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "SetFlags");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "SetFlags");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(args["flags"], flags, options);
+        jdata.Key("flags");
+        FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(jdata, flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetFlags(
@@ -7729,10 +9599,11 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetFlags");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetFlags");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetConfigurationInterface(
@@ -7745,16 +9616,22 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetConfigurationInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetConfigurationInterface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetConfigurationInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["clsid"], clsid, options);
-        FieldToJson(args["iid"], iid, options);
-        FieldToJson(args["ppv"], ppv, options);
+        jdata.Key("clsid");
+        FieldToJson(jdata, clsid, options);
+        jdata.Key("iid");
+        FieldToJson(jdata, iid, options);
+        jdata.Key("ppv");
+        FieldToJson(jdata, ppv, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_EnableExperimentalFeatures(
@@ -7768,17 +9645,24 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_EnableExperimentalFeatures(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "EnableExperimentalFeatures");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "EnableExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumFeatures"], NumFeatures, options);
-        FieldToJson(args["pIIDs"], pIIDs, options);
-        FieldToJson(args["pConfigurationStructs"], pConfigurationStructs, options);
-        FieldToJson(args["pConfigurationStructSizes"], pConfigurationStructSizes, options);
+        jdata.Key("NumFeatures");
+        FieldToJson(jdata, NumFeatures, options);
+        jdata.Key("pIIDs");
+        FieldToJson(jdata, pIIDs, options);
+        jdata.Key("pConfigurationStructs");
+        FieldToJson(jdata, pConfigurationStructs, options);
+        jdata.Key("pConfigurationStructSizes");
+        FieldToJson(jdata, pConfigurationStructSizes, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceFactory_CreateDevice(
@@ -7792,17 +9676,24 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_CreateDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "CreateDevice");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "CreateDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["adapter"], adapter, options);
-        FieldToJson(args["FeatureLevel"], FeatureLevel, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDevice"], ppvDevice, options);
+        jdata.Key("adapter");
+        FieldToJson(jdata, adapter, options);
+        jdata.Key("FeatureLevel");
+        FieldToJson(jdata, FeatureLevel, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvDevice");
+        FieldToJson(jdata, ppvDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetDesc(
@@ -7812,10 +9703,11 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetDesc");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetEnabledExperimentalFeatures(
@@ -7827,15 +9719,20 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetEnabledExperimentalF
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetEnabledExperimentalFeatures");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetEnabledExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pGuids"], pGuids, options);
-        FieldToJson(args["NumGuids"], NumGuids, options);
+        jdata.Key("pGuids");
+        FieldToJson(jdata, pGuids, options);
+        jdata.Key("NumGuids");
+        FieldToJson(jdata, NumGuids, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_SerializeVersionedRootSignature(
@@ -7848,16 +9745,22 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_SerializeVersionedRootS
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "SerializeVersionedRootSignature");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "SerializeVersionedRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["ppResult"], ppResult, options);
-        FieldToJson(args["ppError"], ppError, options);
+        jdata.Key("pDesc");
+        FieldToJson(jdata, pDesc, options);
+        jdata.Key("ppResult");
+        FieldToJson(jdata, ppResult, options);
+        jdata.Key("ppError");
+        FieldToJson(jdata, ppError, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_CreateVersionedRootSignatureDeserializer(
@@ -7871,17 +9774,24 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_CreateVersionedRootSign
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "CreateVersionedRootSignatureDeserializer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "CreateVersionedRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pBlob"], pBlob, options);
-        FieldToJson(args["Size"], Size, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDeserializer"], ppvDeserializer, options);
+        jdata.Key("pBlob");
+        FieldToJson(jdata, pBlob, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, Size, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvDeserializer");
+        FieldToJson(jdata, ppvDeserializer, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRate(
@@ -7892,14 +9802,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRate(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRate");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRate");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["baseShadingRate"], baseShadingRate, options);
-        FieldToJson(args["combiners"], combiners, options);
+        jdata.Key("baseShadingRate");
+        FieldToJson(jdata, baseShadingRate, options);
+        jdata.Key("combiners");
+        FieldToJson(jdata, combiners, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRateImage(
@@ -7909,13 +9823,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRateImage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRateImage");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRateImage");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["shadingRateImage"], shadingRateImage, options);
+        jdata.Key("shadingRateImage");
+        FieldToJson(jdata, shadingRateImage, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList6_DispatchMesh(
@@ -7927,15 +9844,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList6_DispatchMesh(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList6", object_id, "DispatchMesh");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList6", object_id, "DispatchMesh");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ThreadGroupCountX"], ThreadGroupCountX, options);
-        FieldToJson(args["ThreadGroupCountY"], ThreadGroupCountY, options);
-        FieldToJson(args["ThreadGroupCountZ"], ThreadGroupCountZ, options);
+        jdata.Key("ThreadGroupCountX");
+        FieldToJson(jdata, ThreadGroupCountX, options);
+        jdata.Key("ThreadGroupCountY");
+        FieldToJson(jdata, ThreadGroupCountY, options);
+        jdata.Key("ThreadGroupCountZ");
+        FieldToJson(jdata, ThreadGroupCountZ, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList7_Barrier(
@@ -7946,14 +9868,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList7_Barrier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList7", object_id, "Barrier");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList7", object_id, "Barrier");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["NumBarrierGroups"], NumBarrierGroups, options);
-        FieldToJson(args["pBarrierGroups"], pBarrierGroups, options);
+        jdata.Key("NumBarrierGroups");
+        FieldToJson(jdata, NumBarrierGroups, options);
+        jdata.Key("pBarrierGroups");
+        FieldToJson(jdata, pBarrierGroups, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList8_OMSetFrontAndBackStencilRef(
@@ -7964,14 +9890,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList8_OMSetFrontAndBackStenc
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList8", object_id, "OMSetFrontAndBackStencilRef");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList8", object_id, "OMSetFrontAndBackStencilRef");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["FrontStencilRef"], FrontStencilRef, options);
-        FieldToJson(args["BackStencilRef"], BackStencilRef, options);
+        jdata.Key("FrontStencilRef");
+        FieldToJson(jdata, FrontStencilRef, options);
+        jdata.Key("BackStencilRef");
+        FieldToJson(jdata, BackStencilRef, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_RSSetDepthBias(
@@ -7983,15 +9913,20 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_RSSetDepthBias(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "RSSetDepthBias");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "RSSetDepthBias");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["DepthBias"], DepthBias, options);
-        FieldToJson(args["DepthBiasClamp"], DepthBiasClamp, options);
-        FieldToJson(args["SlopeScaledDepthBias"], SlopeScaledDepthBias, options);
+        jdata.Key("DepthBias");
+        FieldToJson(jdata, DepthBias, options);
+        jdata.Key("DepthBiasClamp");
+        FieldToJson(jdata, DepthBiasClamp, options);
+        jdata.Key("SlopeScaledDepthBias");
+        FieldToJson(jdata, SlopeScaledDepthBias, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_IASetIndexBufferStripCutValue(
@@ -8001,13 +9936,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_IASetIndexBufferStripC
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "IASetIndexBufferStripCutValue");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "IASetIndexBufferStripCutValue");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["IBStripCutValue"], IBStripCutValue, options);
+        jdata.Key("IBStripCutValue");
+        FieldToJson(jdata, IBStripCutValue, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DSRDeviceFactory_CreateDSRDevice(
@@ -8021,17 +9959,24 @@ void Dx12JsonConsumer::Process_ID3D12DSRDeviceFactory_CreateDSRDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DSRDeviceFactory", object_id, "CreateDSRDevice");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DSRDeviceFactory", object_id, "CreateDSRDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pD3D12Device"], pD3D12Device, options);
-        FieldToJsonAsFixedWidthBinary(args["NodeMask"], NodeMask, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDSRDevice"], ppvDSRDevice, options);
+        jdata.Key("pD3D12Device");
+        FieldToJson(jdata, pD3D12Device, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, NodeMask, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvDSRDevice");
+        FieldToJson(jdata, ppvDSRDevice, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -8045,10 +9990,11 @@ void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferPointer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferPointer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferPointer");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferSize(
@@ -8058,10 +10004,11 @@ void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3DDestructionNotifier_RegisterDestructionCallback(
@@ -8074,16 +10021,22 @@ void Dx12JsonConsumer::Process_ID3DDestructionNotifier_RegisterDestructionCallba
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "RegisterDestructionCallback");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "RegisterDestructionCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["callbackFn"], callbackFn, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["pCallbackID"], pCallbackID, options);
+        jdata.Key("callbackFn");
+        FieldToJson(jdata, callbackFn, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("pCallbackID");
+        FieldToJson(jdata, pCallbackID, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3DDestructionNotifier_UnregisterDestructionCallback(
@@ -8094,14 +10047,18 @@ void Dx12JsonConsumer::Process_ID3DDestructionNotifier_UnregisterDestructionCall
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "UnregisterDestructionCallback");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "UnregisterDestructionCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["callbackID"], callbackID, options);
+        jdata.Key("callbackID");
+        FieldToJson(jdata, callbackID, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -8114,9 +10071,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug_EnableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug", object_id, "EnableDebugLayer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug", object_id, "EnableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug1_EnableDebugLayer(
@@ -8125,9 +10082,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_EnableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "EnableDebugLayer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug1", object_id, "EnableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableGPUBasedValidation(
@@ -8137,13 +10094,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableGPUBasedValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableGPUBasedValidation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableGPUBasedValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableSynchronizedCommandQueueValidation(
@@ -8153,13 +10113,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableSynchronizedCommandQueueVal
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableSynchronizedCommandQueueValidation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableSynchronizedCommandQueueValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug2_SetGPUBasedValidationFlags(
@@ -8169,13 +10132,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug2_SetGPUBasedValidationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug2", object_id, "SetGPUBasedValidationFlags");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug2", object_id, "SetGPUBasedValidationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableGPUBasedValidation(
@@ -8185,13 +10151,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableGPUBasedValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableGPUBasedValidation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableGPUBasedValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableSynchronizedCommandQueueValidation(
@@ -8201,13 +10170,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableSynchronizedCommandQueueVal
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableSynchronizedCommandQueueValidation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableSynchronizedCommandQueueValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug3_SetGPUBasedValidationFlags(
@@ -8217,13 +10189,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetGPUBasedValidationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetGPUBasedValidationFlags");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug3", object_id, "SetGPUBasedValidationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug4_DisableDebugLayer(
@@ -8232,9 +10207,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug4_DisableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug4", object_id, "DisableDebugLayer");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug4", object_id, "DisableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug5_SetEnableAutoName(
@@ -8244,13 +10219,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug5_SetEnableAutoName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug5", object_id, "SetEnableAutoName");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug5", object_id, "SetEnableAutoName");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12Debug6_SetForceLegacyBarrierValidation(
@@ -8260,13 +10238,16 @@ void Dx12JsonConsumer::Process_ID3D12Debug6_SetForceLegacyBarrierValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug6", object_id, "SetForceLegacyBarrierValidation");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12Debug6", object_id, "SetForceLegacyBarrierValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        jdata.Key("Enable");
+        Bool32ToJson(jdata, Enable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice1_SetDebugParameter(
@@ -8279,16 +10260,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "SetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice1_GetDebugParameter(
@@ -8301,16 +10288,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "GetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice1_ReportLiveDeviceObjects(
@@ -8321,14 +10314,18 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_ReportLiveDeviceObjects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "ReportLiveDeviceObjects");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "ReportLiveDeviceObjects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_RLDO_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RLDO_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice_SetFeatureMask(
@@ -8339,14 +10336,18 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_SetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "SetFeatureMask");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice", object_id, "SetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Mask"], Mask, options);
+        jdata.Key("Mask");
+        FieldToJson(jdata, Mask, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice_GetFeatureMask(
@@ -8356,10 +10357,11 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_GetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "GetFeatureMask");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice", object_id, "GetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice_ReportLiveDeviceObjects(
@@ -8370,14 +10372,18 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_ReportLiveDeviceObjects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "ReportLiveDeviceObjects");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice", object_id, "ReportLiveDeviceObjects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson_D3D12_RLDO_FLAGS(args["Flags"], Flags, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RLDO_FLAGS(jdata, Flags, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice2_SetDebugParameter(
@@ -8390,16 +10396,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice2_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "SetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugDevice2_GetDebugParameter(
@@ -8412,16 +10424,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice2_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "GetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue_AssertResourceState(
@@ -8434,16 +10452,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue", object_id, "AssertResourceState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandQueue", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["State"], State, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("State");
+        FieldToJson(jdata, State, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertResourceAccess(
@@ -8455,15 +10479,20 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertResourceAccess(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertResourceAccess");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertResourceAccess");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Access"], Access, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("Access");
+        FieldToJson(jdata, Access, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertTextureLayout(
@@ -8475,15 +10504,20 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertTextureLayout(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertTextureLayout");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertTextureLayout");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Layout"], Layout, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("Layout");
+        FieldToJson(jdata, Layout, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_AssertResourceState(
@@ -8496,16 +10530,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "AssertResourceState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["State"], State, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("State");
+        FieldToJson(jdata, State, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_SetDebugParameter(
@@ -8518,16 +10558,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "SetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_GetDebugParameter(
@@ -8540,16 +10586,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "GetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList_AssertResourceState(
@@ -8562,16 +10614,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "AssertResourceState");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["State"], State, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("State");
+        FieldToJson(jdata, State, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList_SetFeatureMask(
@@ -8582,14 +10640,18 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_SetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "SetFeatureMask");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "SetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Mask"], Mask, options);
+        jdata.Key("Mask");
+        FieldToJson(jdata, Mask, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList_GetFeatureMask(
@@ -8599,10 +10661,11 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_GetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "GetFeatureMask");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "GetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_SetDebugParameter(
@@ -8615,16 +10678,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "SetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_GetDebugParameter(
@@ -8637,16 +10706,22 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "GetDebugParameter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, Type, options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, options);
+        jdata.Key("DataSize");
+        FieldToJson(jdata, DataSize, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertResourceAccess(
@@ -8658,15 +10733,20 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertResourceAccess(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertResourceAccess");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertResourceAccess");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Access"], Access, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("Access");
+        FieldToJson(jdata, Access, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertTextureLayout(
@@ -8678,15 +10758,20 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertTextureLayout(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertTextureLayout");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertTextureLayout");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Layout"], Layout, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("Layout");
+        FieldToJson(jdata, Layout, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SharingContract_Present(
@@ -8698,15 +10783,20 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_Present(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "Present");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SharingContract", object_id, "Present");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["window"], window, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("window");
+        FieldToJson(jdata, window, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SharingContract_SharedFenceSignal(
@@ -8717,14 +10807,18 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_SharedFenceSignal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "SharedFenceSignal");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SharingContract", object_id, "SharedFenceSignal");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["FenceValue"], FenceValue, options);
+        jdata.Key("pFence");
+        FieldToJson(jdata, pFence, options);
+        jdata.Key("FenceValue");
+        FieldToJson(jdata, FenceValue, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SharingContract_BeginCapturableWork(
@@ -8734,13 +10828,16 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_BeginCapturableWork(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "BeginCapturableWork");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SharingContract", object_id, "BeginCapturableWork");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
+        jdata.Key("guid");
+        FieldToJson(jdata, guid, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12SharingContract_EndCapturableWork(
@@ -8750,13 +10847,16 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_EndCapturableWork(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "EndCapturableWork");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12SharingContract", object_id, "EndCapturableWork");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
+        jdata.Key("guid");
+        FieldToJson(jdata, guid, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12ManualWriteTrackingResource_TrackWrite(
@@ -8767,14 +10867,18 @@ void Dx12JsonConsumer::Process_ID3D12ManualWriteTrackingResource_TrackWrite(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ManualWriteTrackingResource", object_id, "TrackWrite");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12ManualWriteTrackingResource", object_id, "TrackWrite");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["pWrittenRange"], pWrittenRange, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, Subresource, options);
+        jdata.Key("pWrittenRange");
+        FieldToJson(jdata, pWrittenRange, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMessageCountLimit(
@@ -8785,14 +10889,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMessageCountLimit(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMessageCountLimit");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["MessageCountLimit"], MessageCountLimit, options);
+        jdata.Key("MessageCountLimit");
+        FieldToJson(jdata, MessageCountLimit, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStoredMessages(
@@ -8801,9 +10909,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStoredMessages(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStoredMessages");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStoredMessages");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessage(
@@ -8816,16 +10924,22 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessage");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["MessageIndex"], MessageIndex, options);
-        FieldToJson(args["pMessage"], pMessage, options);
-        FieldToJson(args["pMessageByteLength"], pMessageByteLength, options);
+        jdata.Key("MessageIndex");
+        FieldToJson(jdata, MessageIndex, options);
+        jdata.Key("pMessage");
+        FieldToJson(jdata, pMessage, options);
+        jdata.Key("pMessageByteLength");
+        FieldToJson(jdata, pMessageByteLength, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesAllowedByStorageFilter(
@@ -8835,10 +10949,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesAllowedByStorageFil
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesAllowedByStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesAllowedByStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilter(
@@ -8848,10 +10963,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilt
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDeniedByStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDeniedByStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessages(
@@ -8861,10 +10977,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessages(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessages");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessages");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetrievalFilter(
@@ -8874,10 +10991,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetr
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessagesAllowedByRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessagesAllowedByRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDiscardedByMessageCountLimit(
@@ -8887,10 +11005,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDiscardedByMessageC
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDiscardedByMessageCountLimit");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDiscardedByMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessageCountLimit(
@@ -8900,10 +11019,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessageCountLimit(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessageCountLimit");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddStorageFilterEntries(
@@ -8914,14 +11034,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddStorageFilterEntries(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddStorageFilterEntries");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddStorageFilterEntries");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        jdata.Key("pFilter");
+        FieldToJson(jdata, pFilter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilter(
@@ -8933,15 +11057,20 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
-        FieldToJson(args["pFilterByteLength"], pFilterByteLength, options);
+        jdata.Key("pFilter");
+        FieldToJson(jdata, pFilter, options);
+        jdata.Key("pFilterByteLength");
+        FieldToJson(jdata, pFilterByteLength, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStorageFilter(
@@ -8950,9 +11079,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyStorageFilter(
@@ -8962,10 +11091,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfStorageFilter(
@@ -8975,10 +11105,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushStorageFilter(
@@ -8989,14 +11120,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        jdata.Key("pFilter");
+        FieldToJson(jdata, pFilter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopStorageFilter(
@@ -9005,9 +11140,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopStorageFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilterStackSize(
@@ -9017,10 +11152,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilterStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilterStackSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilterStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddRetrievalFilterEntries(
@@ -9031,14 +11167,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddRetrievalFilterEntries(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddRetrievalFilterEntries");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddRetrievalFilterEntries");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        jdata.Key("pFilter");
+        FieldToJson(jdata, pFilter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilter(
@@ -9050,15 +11190,20 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
-        FieldToJson(args["pFilterByteLength"], pFilterByteLength, options);
+        jdata.Key("pFilter");
+        FieldToJson(jdata, pFilter, options);
+        jdata.Key("pFilterByteLength");
+        FieldToJson(jdata, pFilterByteLength, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearRetrievalFilter(
@@ -9067,9 +11212,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyRetrievalFilter(
@@ -9079,10 +11224,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfRetrievalFilter(
@@ -9092,10 +11238,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushRetrievalFilter(
@@ -9106,14 +11253,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        jdata.Key("pFilter");
+        FieldToJson(jdata, pFilter, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopRetrievalFilter(
@@ -9122,9 +11273,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopRetrievalFilter");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    writer_->WriteBlockEnd();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilterStackSize(
@@ -9134,10 +11285,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilterStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilterStackSize");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilterStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddMessage(
@@ -9151,17 +11303,24 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddMessage");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddMessage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Category"], Category, options);
-        FieldToJson(args["Severity"], Severity, options);
-        FieldToJson(args["ID"], ID, options);
-        FieldToJson(args["pDescription"], pDescription, options);
+        jdata.Key("Category");
+        FieldToJson(jdata, Category, options);
+        jdata.Key("Severity");
+        FieldToJson(jdata, Severity, options);
+        jdata.Key("ID");
+        FieldToJson(jdata, ID, options);
+        jdata.Key("pDescription");
+        FieldToJson(jdata, pDescription, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddApplicationMessage(
@@ -9173,15 +11332,20 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddApplicationMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddApplicationMessage");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddApplicationMessage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Severity"], Severity, options);
-        FieldToJson(args["pDescription"], pDescription, options);
+        jdata.Key("Severity");
+        FieldToJson(jdata, Severity, options);
+        jdata.Key("pDescription");
+        FieldToJson(jdata, pDescription, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnCategory(
@@ -9193,15 +11357,20 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnCategory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnCategory");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnCategory");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Category"], Category, options);
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        jdata.Key("Category");
+        FieldToJson(jdata, Category, options);
+        jdata.Key("bEnable");
+        Bool32ToJson(jdata, bEnable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnSeverity(
@@ -9213,15 +11382,20 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnSeverity(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnSeverity");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnSeverity");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Severity"], Severity, options);
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        jdata.Key("Severity");
+        FieldToJson(jdata, Severity, options);
+        jdata.Key("bEnable");
+        Bool32ToJson(jdata, bEnable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnID(
@@ -9233,15 +11407,20 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnID");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnID");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ID"], ID, options);
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        jdata.Key("ID");
+        FieldToJson(jdata, ID, options);
+        jdata.Key("bEnable");
+        Bool32ToJson(jdata, bEnable, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnCategory(
@@ -9252,14 +11431,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnCategory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnCategory");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnCategory");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Category"], Category, options);
+        jdata.Key("Category");
+        FieldToJson(jdata, Category, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnSeverity(
@@ -9270,14 +11453,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnSeverity(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnSeverity");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnSeverity");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["Severity"], Severity, options);
+        jdata.Key("Severity");
+        FieldToJson(jdata, Severity, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnID(
@@ -9288,14 +11475,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnID");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnID");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["ID"], ID, options);
+        jdata.Key("ID");
+        FieldToJson(jdata, ID, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMuteDebugOutput(
@@ -9305,13 +11496,16 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMuteDebugOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMuteDebugOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMuteDebugOutput");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        Bool32ToJson(args["bMute"], bMute, options);
+        jdata.Key("bMute");
+        Bool32ToJson(jdata, bMute, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMuteDebugOutput(
@@ -9321,10 +11515,11 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMuteDebugOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMuteDebugOutput");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMuteDebugOutput");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    Bool32ToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue1_RegisterMessageCallback(
@@ -9338,17 +11533,24 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue1_RegisterMessageCallback(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "RegisterMessageCallback");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "RegisterMessageCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["CallbackFunc"], CallbackFunc, options);
-        FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(args["CallbackFilterFlags"], CallbackFilterFlags, options);
-        FieldToJson(args["pContext"], pContext, options);
-        FieldToJson(args["pCallbackCookie"], pCallbackCookie, options);
+        jdata.Key("CallbackFunc");
+        FieldToJson(jdata, CallbackFunc, options);
+        jdata.Key("CallbackFilterFlags");
+        FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(jdata, CallbackFilterFlags, options);
+        jdata.Key("pContext");
+        FieldToJson(jdata, pContext, options);
+        jdata.Key("pCallbackCookie");
+        FieldToJson(jdata, pCallbackCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_ID3D12InfoQueue1_UnregisterMessageCallback(
@@ -9359,14 +11561,18 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue1_UnregisterMessageCallback(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "UnregisterMessageCallback");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "UnregisterMessageCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["CallbackCookie"], CallbackCookie, options);
+        jdata.Key("CallbackCookie");
+        FieldToJson(jdata, CallbackCookie, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 /*
@@ -9382,15 +11588,20 @@ void Dx12JsonConsumer::Process_IUnknown_QueryInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "QueryInterface");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IUnknown", object_id, "QueryInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    jdata.Key(format::kNameReturn);
+    HresultToJson(jdata, return_value, options);
+    jdata.Key(format::kNameArgs);
+    jdata.BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvObject"], ppvObject, options);
+        jdata.Key("riid");
+        FieldToJson(jdata, riid, options);
+        jdata.Key("ppvObject");
+        FieldToJson(jdata, ppvObject, options);
     }
-    writer_->WriteBlockEnd();
+    jdata.EndObject();
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IUnknown_AddRef(
@@ -9400,10 +11611,11 @@ void Dx12JsonConsumer::Process_IUnknown_AddRef(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "AddRef");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IUnknown", object_id, "AddRef");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 void Dx12JsonConsumer::Process_IUnknown_Release(
@@ -9413,10 +11625,11 @@ void Dx12JsonConsumer::Process_IUnknown_Release(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "Release");
+    util::JsonStreamWriter& jdata = writer_->WriteStreamApiCallStart(call_info, "IUnknown", object_id, "Release");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    writer_->WriteBlockEnd();
+    jdata.Key(format::kNameReturn);
+    FieldToJson(jdata, return_value, options);
+    writer_->WriteStreamBlockEnd();
 }
 
 
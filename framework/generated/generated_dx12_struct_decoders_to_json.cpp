@@ -64,6 +64,38 @@ void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEPTH_STENCIL_VALUE&
     FieldToJson(jdata["Depth"], obj.Depth, options);
     FieldToJson(jdata["Stencil"], obj.Stencil, options);
 }
+
+static void FieldToJson(util::JsonStreamWriter& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+{
+    using namespace util;
+    jdata.BeginObject();
+    jdata.Key("AdditionalWidth");
+    FieldToJson(jdata, data.AdditionalWidth, options);
+    jdata.Key("AdditionalHeight");
+    FieldToJson(jdata, data.AdditionalHeight, options);
+    jdata.EndObject();
+}
+
+static void FieldToJson(util::JsonStreamWriter& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+{
+    using namespace util;
+    jdata.BeginObject();
+    jdata.Key("AdditionalWidth");
+    FieldToJson(jdata, data.AdditionalWidth, options);
+    jdata.Key("AdditionalHeight");
+    FieldToJson(jdata, data.AdditionalHeight, options);
+    jdata.EndObject();
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
+{
+    jdata.BeginObject();
+    jdata.Key("Depth");
+    FieldToJson(jdata, obj.Depth, options);
+    jdata.Key("Stencil");
+    FieldToJson(jdata, obj.Stencil, options);
+    jdata.EndObject();
+}
 /** @} */
 
 inline bool RepresentBinaryFile(const util::JsonOptions& json_options, nlohmann::ordered_json& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
@@ -71,6 +103,11 @@ inline bool RepresentBinaryFile(const util::JsonOptions& json_options, nlohmann:
     return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
 }
 
+inline bool RepresentBinaryFile(const util::JsonOptions& json_options, util::JsonStreamWriter& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
+{
+    return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATISTICS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -86,6 +123,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATIST
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_FRAME_STATISTICS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_FRAME_STATISTICS& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_FRAME_STATISTICS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("PresentCount");
+        FieldToJson(jdata, decoded_value.PresentCount, options);
+        jdata.Key("PresentRefreshCount");
+        FieldToJson(jdata, decoded_value.PresentRefreshCount, options);
+        jdata.Key("SyncRefreshCount");
+        FieldToJson(jdata, decoded_value.SyncRefreshCount, options);
+        jdata.Key("SyncQPCTime");
+        FieldToJson(jdata, meta_struct.SyncQPCTime, options);
+        jdata.Key("SyncGPUTime");
+        FieldToJson(jdata, meta_struct.SyncGPUTime, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MAPPED_RECT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -98,6 +161,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MAPPED_RECT*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_MAPPED_RECT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_MAPPED_RECT& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_MAPPED_RECT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Pitch");
+        FieldToJson(jdata, decoded_value.Pitch, options);
+        jdata.Key("pBits");
+        FieldToJson(jdata, meta_struct.pBits, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LUID* data, const JsonOptions& options)
 {
     using namespace util;
@@ -110,6 +193,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LUID* data, const
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_LUID* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const LUID& decoded_value = *data->decoded_value;
+        const Decoded_LUID& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("LowPart");
+        FieldToJson(jdata, decoded_value.LowPart, options);
+        jdata.Key("HighPart");
+        FieldToJson(jdata, decoded_value.HighPart, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -129,6 +232,40 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_ADAPTER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_ADAPTER_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_ADAPTER_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Description");
+        FieldToJson(jdata, meta_struct.Description, options);
+        jdata.Key("VendorId");
+        FieldToJson(jdata, decoded_value.VendorId, options);
+        jdata.Key("DeviceId");
+        FieldToJson(jdata, decoded_value.DeviceId, options);
+        jdata.Key("SubSysId");
+        FieldToJson(jdata, decoded_value.SubSysId, options);
+        jdata.Key("Revision");
+        FieldToJson(jdata, decoded_value.Revision, options);
+        jdata.Key("DedicatedVideoMemory");
+        FieldToJson(jdata, decoded_value.DedicatedVideoMemory, options);
+        jdata.Key("DedicatedSystemMemory");
+        FieldToJson(jdata, decoded_value.DedicatedSystemMemory, options);
+        jdata.Key("SharedSystemMemory");
+        FieldToJson(jdata, decoded_value.SharedSystemMemory, options);
+        jdata.Key("AdapterLuid");
+        FieldToJson(jdata, meta_struct.AdapterLuid, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -144,6 +281,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTPUT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTPUT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTPUT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DeviceName");
+        FieldToJson(jdata, meta_struct.DeviceName, options);
+        jdata.Key("DesktopCoordinates");
+        FieldToJson(jdata, meta_struct.DesktopCoordinates, options);
+        jdata.Key("AttachedToDesktop");
+        Bool32ToJson(jdata, decoded_value.AttachedToDesktop, options);
+        jdata.Key("Rotation");
+        FieldToJson(jdata, decoded_value.Rotation, options);
+        jdata.Key("Monitor");
+        FieldToJson(jdata, meta_struct.Monitor, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SHARED_RESOURCE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -155,6 +318,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SHARED_RESOUR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_SHARED_RESOURCE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_SHARED_RESOURCE& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_SHARED_RESOURCE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Handle");
+        FieldToJson(jdata, meta_struct.Handle, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SURFACE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -169,6 +350,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SURFACE_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_SURFACE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_SURFACE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_SURFACE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("SampleDesc");
+        FieldToJson(jdata, meta_struct.SampleDesc, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -187,6 +392,38 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_SWAP_CHAIN_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_SWAP_CHAIN_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BufferDesc");
+        FieldToJson(jdata, meta_struct.BufferDesc, options);
+        jdata.Key("SampleDesc");
+        FieldToJson(jdata, meta_struct.SampleDesc, options);
+        jdata.Key("BufferUsage");
+        FieldToJson(jdata, decoded_value.BufferUsage, options);
+        jdata.Key("BufferCount");
+        FieldToJson(jdata, decoded_value.BufferCount, options);
+        jdata.Key("OutputWindow");
+        FieldToJson(jdata, meta_struct.OutputWindow, options);
+        jdata.Key("Windowed");
+        Bool32ToJson(jdata, decoded_value.Windowed, options);
+        jdata.Key("SwapEffect");
+        FieldToJson(jdata, decoded_value.SwapEffect, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -207,6 +444,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC1
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_ADAPTER_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_ADAPTER_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_ADAPTER_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Description");
+        FieldToJson(jdata, meta_struct.Description, options);
+        jdata.Key("VendorId");
+        FieldToJson(jdata, decoded_value.VendorId, options);
+        jdata.Key("DeviceId");
+        FieldToJson(jdata, decoded_value.DeviceId, options);
+        jdata.Key("SubSysId");
+        FieldToJson(jdata, decoded_value.SubSysId, options);
+        jdata.Key("Revision");
+        FieldToJson(jdata, decoded_value.Revision, options);
+        jdata.Key("DedicatedVideoMemory");
+        FieldToJson(jdata, decoded_value.DedicatedVideoMemory, options);
+        jdata.Key("DedicatedSystemMemory");
+        FieldToJson(jdata, decoded_value.DedicatedSystemMemory, options);
+        jdata.Key("SharedSystemMemory");
+        FieldToJson(jdata, decoded_value.SharedSystemMemory, options);
+        jdata.Key("AdapterLuid");
+        FieldToJson(jdata, meta_struct.AdapterLuid, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DISPLAY_COLOR_SPACE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -219,6 +492,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DISPLAY_COLOR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_DISPLAY_COLOR_SPACE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_DISPLAY_COLOR_SPACE& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_DISPLAY_COLOR_SPACE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("PrimaryCoordinates");
+        FieldToJson(jdata, meta_struct.PrimaryCoordinates, options);
+        jdata.Key("WhitePoints");
+        FieldToJson(jdata, meta_struct.WhitePoints, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_MOVE_RECT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -231,6 +524,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_MOVE_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTDUPL_MOVE_RECT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTDUPL_MOVE_RECT& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTDUPL_MOVE_RECT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SourcePoint");
+        FieldToJson(jdata, meta_struct.SourcePoint, options);
+        jdata.Key("DestinationRect");
+        FieldToJson(jdata, meta_struct.DestinationRect, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -244,6 +557,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTDUPL_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTDUPL_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTDUPL_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ModeDesc");
+        FieldToJson(jdata, meta_struct.ModeDesc, options);
+        jdata.Key("Rotation");
+        FieldToJson(jdata, decoded_value.Rotation, options);
+        jdata.Key("DesktopImageInSystemMemory");
+        Bool32ToJson(jdata, decoded_value.DesktopImageInSystemMemory, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINTER_POSITION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -256,6 +591,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTDUPL_POINTER_POSITION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTDUPL_POINTER_POSITION& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTDUPL_POINTER_POSITION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Position");
+        FieldToJson(jdata, meta_struct.Position, options);
+        jdata.Key("Visible");
+        Bool32ToJson(jdata, decoded_value.Visible, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINTER_SHAPE_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -271,6 +626,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTDUPL_POINTER_SHAPE_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTDUPL_POINTER_SHAPE_INFO& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTDUPL_POINTER_SHAPE_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Pitch");
+        FieldToJson(jdata, decoded_value.Pitch, options);
+        jdata.Key("HotSpot");
+        FieldToJson(jdata, meta_struct.HotSpot, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_FRAME_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -289,6 +670,38 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_FRAME
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTDUPL_FRAME_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTDUPL_FRAME_INFO& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTDUPL_FRAME_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("LastPresentTime");
+        FieldToJson(jdata, meta_struct.LastPresentTime, options);
+        jdata.Key("LastMouseUpdateTime");
+        FieldToJson(jdata, meta_struct.LastMouseUpdateTime, options);
+        jdata.Key("AccumulatedFrames");
+        FieldToJson(jdata, decoded_value.AccumulatedFrames, options);
+        jdata.Key("RectsCoalesced");
+        Bool32ToJson(jdata, decoded_value.RectsCoalesced, options);
+        jdata.Key("ProtectedContentMaskedOut");
+        Bool32ToJson(jdata, decoded_value.ProtectedContentMaskedOut, options);
+        jdata.Key("PointerPosition");
+        FieldToJson(jdata, meta_struct.PointerPosition, options);
+        jdata.Key("TotalMetadataBufferSize");
+        FieldToJson(jdata, decoded_value.TotalMetadataBufferSize, options);
+        jdata.Key("PointerShapeBufferSize");
+        FieldToJson(jdata, decoded_value.PointerShapeBufferSize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -306,6 +719,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC1* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_MODE_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_MODE_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_MODE_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("RefreshRate");
+        FieldToJson(jdata, meta_struct.RefreshRate, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ScanlineOrdering");
+        FieldToJson(jdata, decoded_value.ScanlineOrdering, options);
+        jdata.Key("Scaling");
+        FieldToJson(jdata, decoded_value.Scaling, options);
+        jdata.Key("Stereo");
+        Bool32ToJson(jdata, decoded_value.Stereo, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -327,6 +770,44 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_SWAP_CHAIN_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_SWAP_CHAIN_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("Stereo");
+        Bool32ToJson(jdata, decoded_value.Stereo, options);
+        jdata.Key("SampleDesc");
+        FieldToJson(jdata, meta_struct.SampleDesc, options);
+        jdata.Key("BufferUsage");
+        FieldToJson(jdata, decoded_value.BufferUsage, options);
+        jdata.Key("BufferCount");
+        FieldToJson(jdata, decoded_value.BufferCount, options);
+        jdata.Key("Scaling");
+        FieldToJson(jdata, decoded_value.Scaling, options);
+        jdata.Key("SwapEffect");
+        FieldToJson(jdata, decoded_value.SwapEffect, options);
+        jdata.Key("AlphaMode");
+        FieldToJson(jdata, decoded_value.AlphaMode, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_FULLSCREEN_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -341,6 +822,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_FU
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_SWAP_CHAIN_FULLSCREEN_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_SWAP_CHAIN_FULLSCREEN_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_SWAP_CHAIN_FULLSCREEN_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RefreshRate");
+        FieldToJson(jdata, meta_struct.RefreshRate, options);
+        jdata.Key("ScanlineOrdering");
+        FieldToJson(jdata, decoded_value.ScanlineOrdering, options);
+        jdata.Key("Scaling");
+        FieldToJson(jdata, decoded_value.Scaling, options);
+        jdata.Key("Windowed");
+        Bool32ToJson(jdata, decoded_value.Windowed, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_PRESENT_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -355,6 +860,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_PRESENT_PARAM
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_PRESENT_PARAMETERS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_PRESENT_PARAMETERS& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_PRESENT_PARAMETERS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DirtyRectsCount");
+        FieldToJson(jdata, decoded_value.DirtyRectsCount, options);
+        jdata.Key("pDirtyRects");
+        FieldToJson(jdata, meta_struct.pDirtyRects, options);
+        jdata.Key("pScrollRect");
+        FieldToJson(jdata, meta_struct.pScrollRect, options);
+        jdata.Key("pScrollOffset");
+        FieldToJson(jdata, meta_struct.pScrollOffset, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -377,6 +906,46 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC2
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_ADAPTER_DESC2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_ADAPTER_DESC2& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_ADAPTER_DESC2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Description");
+        FieldToJson(jdata, meta_struct.Description, options);
+        jdata.Key("VendorId");
+        FieldToJson(jdata, decoded_value.VendorId, options);
+        jdata.Key("DeviceId");
+        FieldToJson(jdata, decoded_value.DeviceId, options);
+        jdata.Key("SubSysId");
+        FieldToJson(jdata, decoded_value.SubSysId, options);
+        jdata.Key("Revision");
+        FieldToJson(jdata, decoded_value.Revision, options);
+        jdata.Key("DedicatedVideoMemory");
+        FieldToJson(jdata, decoded_value.DedicatedVideoMemory, options);
+        jdata.Key("DedicatedSystemMemory");
+        FieldToJson(jdata, decoded_value.DedicatedSystemMemory, options);
+        jdata.Key("SharedSystemMemory");
+        FieldToJson(jdata, decoded_value.SharedSystemMemory, options);
+        jdata.Key("AdapterLuid");
+        FieldToJson(jdata, meta_struct.AdapterLuid, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.Key("GraphicsPreemptionGranularity");
+        FieldToJson(jdata, decoded_value.GraphicsPreemptionGranularity, options);
+        jdata.Key("ComputePreemptionGranularity");
+        FieldToJson(jdata, decoded_value.ComputePreemptionGranularity, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MATRIX_3X2_F* data, const JsonOptions& options)
 {
     using namespace util;
@@ -393,6 +962,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MATRIX_3X2_F*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_MATRIX_3X2_F* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_MATRIX_3X2_F& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_MATRIX_3X2_F& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("_11");
+        FieldToJson(jdata, decoded_value._11, options);
+        jdata.Key("_12");
+        FieldToJson(jdata, decoded_value._12, options);
+        jdata.Key("_21");
+        FieldToJson(jdata, decoded_value._21, options);
+        jdata.Key("_22");
+        FieldToJson(jdata, decoded_value._22, options);
+        jdata.Key("_31");
+        FieldToJson(jdata, decoded_value._31, options);
+        jdata.Key("_32");
+        FieldToJson(jdata, decoded_value._32, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DECODE_SWAP_CHAIN_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -404,6 +1001,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DECODE_SWAP_C
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_DECODE_SWAP_CHAIN_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_DECODE_SWAP_CHAIN_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_DECODE_SWAP_CHAIN_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATISTICS_MEDIA* data, const JsonOptions& options)
 {
     using namespace util;
@@ -421,6 +1036,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATIST
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_FRAME_STATISTICS_MEDIA* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_FRAME_STATISTICS_MEDIA& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_FRAME_STATISTICS_MEDIA& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("PresentCount");
+        FieldToJson(jdata, decoded_value.PresentCount, options);
+        jdata.Key("PresentRefreshCount");
+        FieldToJson(jdata, decoded_value.PresentRefreshCount, options);
+        jdata.Key("SyncRefreshCount");
+        FieldToJson(jdata, decoded_value.SyncRefreshCount, options);
+        jdata.Key("SyncQPCTime");
+        FieldToJson(jdata, meta_struct.SyncQPCTime, options);
+        jdata.Key("SyncGPUTime");
+        FieldToJson(jdata, meta_struct.SyncGPUTime, options);
+        jdata.Key("CompositionMode");
+        FieldToJson(jdata, decoded_value.CompositionMode, options);
+        jdata.Key("ApprovedPresentDuration");
+        FieldToJson(jdata, decoded_value.ApprovedPresentDuration, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_QUERY_VIDEO_MEMORY_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -435,6 +1080,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_QUERY_VIDEO_M
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_QUERY_VIDEO_MEMORY_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_QUERY_VIDEO_MEMORY_INFO& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_QUERY_VIDEO_MEMORY_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Budget");
+        FieldToJson(jdata, decoded_value.Budget, options);
+        jdata.Key("CurrentUsage");
+        FieldToJson(jdata, decoded_value.CurrentUsage, options);
+        jdata.Key("AvailableForReservation");
+        FieldToJson(jdata, decoded_value.AvailableForReservation, options);
+        jdata.Key("CurrentReservation");
+        FieldToJson(jdata, decoded_value.CurrentReservation, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_HDR10* data, const JsonOptions& options)
 {
     using namespace util;
@@ -453,6 +1122,38 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_HDR_METADATA_HDR10* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_HDR_METADATA_HDR10& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_HDR_METADATA_HDR10& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RedPrimary");
+        FieldToJson(jdata, meta_struct.RedPrimary, options);
+        jdata.Key("GreenPrimary");
+        FieldToJson(jdata, meta_struct.GreenPrimary, options);
+        jdata.Key("BluePrimary");
+        FieldToJson(jdata, meta_struct.BluePrimary, options);
+        jdata.Key("WhitePoint");
+        FieldToJson(jdata, meta_struct.WhitePoint, options);
+        jdata.Key("MaxMasteringLuminance");
+        FieldToJson(jdata, decoded_value.MaxMasteringLuminance, options);
+        jdata.Key("MinMasteringLuminance");
+        FieldToJson(jdata, decoded_value.MinMasteringLuminance, options);
+        jdata.Key("MaxContentLightLevel");
+        FieldToJson(jdata, decoded_value.MaxContentLightLevel, options);
+        jdata.Key("MaxFrameAverageLightLevel");
+        FieldToJson(jdata, decoded_value.MaxFrameAverageLightLevel, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_HDR10PLUS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -464,6 +1165,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_HDR_METADATA_HDR10PLUS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_HDR_METADATA_HDR10PLUS& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_HDR_METADATA_HDR10PLUS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Data");
+        FieldToJson(jdata, meta_struct.Data, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC3* data, const JsonOptions& options)
 {
     using namespace util;
@@ -486,6 +1205,46 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC3
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_ADAPTER_DESC3* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_ADAPTER_DESC3& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_ADAPTER_DESC3& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Description");
+        FieldToJson(jdata, meta_struct.Description, options);
+        jdata.Key("VendorId");
+        FieldToJson(jdata, decoded_value.VendorId, options);
+        jdata.Key("DeviceId");
+        FieldToJson(jdata, decoded_value.DeviceId, options);
+        jdata.Key("SubSysId");
+        FieldToJson(jdata, decoded_value.SubSysId, options);
+        jdata.Key("Revision");
+        FieldToJson(jdata, decoded_value.Revision, options);
+        jdata.Key("DedicatedVideoMemory");
+        FieldToJson(jdata, decoded_value.DedicatedVideoMemory, options);
+        jdata.Key("DedicatedSystemMemory");
+        FieldToJson(jdata, decoded_value.DedicatedSystemMemory, options);
+        jdata.Key("SharedSystemMemory");
+        FieldToJson(jdata, decoded_value.SharedSystemMemory, options);
+        jdata.Key("AdapterLuid");
+        FieldToJson(jdata, meta_struct.AdapterLuid, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.Key("GraphicsPreemptionGranularity");
+        FieldToJson(jdata, decoded_value.GraphicsPreemptionGranularity, options);
+        jdata.Key("ComputePreemptionGranularity");
+        FieldToJson(jdata, decoded_value.ComputePreemptionGranularity, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -510,6 +1269,50 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC1*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_OUTPUT_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_OUTPUT_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_OUTPUT_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DeviceName");
+        FieldToJson(jdata, meta_struct.DeviceName, options);
+        jdata.Key("DesktopCoordinates");
+        FieldToJson(jdata, meta_struct.DesktopCoordinates, options);
+        jdata.Key("AttachedToDesktop");
+        Bool32ToJson(jdata, decoded_value.AttachedToDesktop, options);
+        jdata.Key("Rotation");
+        FieldToJson(jdata, decoded_value.Rotation, options);
+        jdata.Key("Monitor");
+        FieldToJson(jdata, meta_struct.Monitor, options);
+        jdata.Key("BitsPerColor");
+        FieldToJson(jdata, decoded_value.BitsPerColor, options);
+        jdata.Key("ColorSpace");
+        FieldToJson(jdata, decoded_value.ColorSpace, options);
+        jdata.Key("RedPrimary");
+        FieldToJson(jdata, meta_struct.RedPrimary, options);
+        jdata.Key("GreenPrimary");
+        FieldToJson(jdata, meta_struct.GreenPrimary, options);
+        jdata.Key("BluePrimary");
+        FieldToJson(jdata, meta_struct.BluePrimary, options);
+        jdata.Key("WhitePoint");
+        FieldToJson(jdata, meta_struct.WhitePoint, options);
+        jdata.Key("MinLuminance");
+        FieldToJson(jdata, decoded_value.MinLuminance, options);
+        jdata.Key("MaxLuminance");
+        FieldToJson(jdata, decoded_value.MaxLuminance, options);
+        jdata.Key("MaxFullFrameLuminance");
+        FieldToJson(jdata, decoded_value.MaxFullFrameLuminance, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RATIONAL* data, const JsonOptions& options)
 {
     using namespace util;
@@ -522,6 +1325,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RATIONAL* dat
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_RATIONAL* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_RATIONAL& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_RATIONAL& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Numerator");
+        FieldToJson(jdata, decoded_value.Numerator, options);
+        jdata.Key("Denominator");
+        FieldToJson(jdata, decoded_value.Denominator, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SAMPLE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -534,6 +1357,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SAMPLE_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_SAMPLE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_SAMPLE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_SAMPLE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Count");
+        FieldToJson(jdata, decoded_value.Count, options);
+        jdata.Key("Quality");
+        FieldToJson(jdata, decoded_value.Quality, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RGB* data, const JsonOptions& options)
 {
     using namespace util;
@@ -547,6 +1390,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RGB* data, co
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_RGB* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_RGB& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_RGB& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Red");
+        FieldToJson(jdata, decoded_value.Red, options);
+        jdata.Key("Green");
+        FieldToJson(jdata, decoded_value.Green, options);
+        jdata.Key("Blue");
+        FieldToJson(jdata, decoded_value.Blue, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3DCOLORVALUE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -561,6 +1426,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3DCOLORVALUE* dat
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3DCOLORVALUE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3DCOLORVALUE& decoded_value = *data->decoded_value;
+        const Decoded_D3DCOLORVALUE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("r");
+        FieldToJson(jdata, decoded_value.r, options);
+        jdata.Key("g");
+        FieldToJson(jdata, decoded_value.g, options);
+        jdata.Key("b");
+        FieldToJson(jdata, decoded_value.b, options);
+        jdata.Key("a");
+        FieldToJson(jdata, decoded_value.a, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL* data, const JsonOptions& options)
 {
     using namespace util;
@@ -574,6 +1463,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_GAMMA_CONTROL* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_GAMMA_CONTROL& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_GAMMA_CONTROL& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Scale");
+        FieldToJson(jdata, meta_struct.Scale, options);
+        jdata.Key("Offset");
+        FieldToJson(jdata, meta_struct.Offset, options);
+        jdata.Key("GammaCurve");
+        FieldToJson(jdata, meta_struct.GammaCurve, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL_CAPABILITIES* data, const JsonOptions& options)
 {
     using namespace util;
@@ -589,6 +1500,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_GAMMA_CONTROL_CAPABILITIES* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_GAMMA_CONTROL_CAPABILITIES& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_GAMMA_CONTROL_CAPABILITIES& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ScaleAndOffsetSupported");
+        Bool32ToJson(jdata, decoded_value.ScaleAndOffsetSupported, options);
+        jdata.Key("MaxConvertedValue");
+        FieldToJson(jdata, decoded_value.MaxConvertedValue, options);
+        jdata.Key("MinConvertedValue");
+        FieldToJson(jdata, decoded_value.MinConvertedValue, options);
+        jdata.Key("NumGammaControlPoints");
+        FieldToJson(jdata, decoded_value.NumGammaControlPoints, options);
+        jdata.Key("ControlPointPositions");
+        FieldToJson(jdata, meta_struct.ControlPointPositions, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -605,6 +1542,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC* da
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_MODE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_MODE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_MODE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("RefreshRate");
+        FieldToJson(jdata, meta_struct.RefreshRate, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ScanlineOrdering");
+        FieldToJson(jdata, decoded_value.ScanlineOrdering, options);
+        jdata.Key("Scaling");
+        FieldToJson(jdata, decoded_value.Scaling, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_DC_HUFFMAN_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -617,6 +1582,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_DC_HUFFM
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_JPEG_DC_HUFFMAN_TABLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_JPEG_DC_HUFFMAN_TABLE& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_JPEG_DC_HUFFMAN_TABLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CodeCounts");
+        FieldToJson(jdata, meta_struct.CodeCounts, options);
+        jdata.Key("CodeValues");
+        FieldToJson(jdata, meta_struct.CodeValues, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_AC_HUFFMAN_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -629,6 +1614,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_AC_HUFFM
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_JPEG_AC_HUFFMAN_TABLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_JPEG_AC_HUFFMAN_TABLE& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_JPEG_AC_HUFFMAN_TABLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CodeCounts");
+        FieldToJson(jdata, meta_struct.CodeCounts, options);
+        jdata.Key("CodeValues");
+        FieldToJson(jdata, meta_struct.CodeValues, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_QUANTIZATION_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -640,6 +1645,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_QUANTIZA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_DXGI_JPEG_QUANTIZATION_TABLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const DXGI_JPEG_QUANTIZATION_TABLE& decoded_value = *data->decoded_value;
+        const Decoded_DXGI_JPEG_QUANTIZATION_TABLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Elements");
+        FieldToJson(jdata, meta_struct.Elements, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_QUEUE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -654,6 +1677,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_QUEU
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_COMMAND_QUEUE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_COMMAND_QUEUE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_COMMAND_QUEUE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Priority");
+        FieldToJson(jdata, decoded_value.Priority, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_COMMAND_QUEUE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_ELEMENT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -671,6 +1718,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_ELEMEN
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_INPUT_ELEMENT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_INPUT_ELEMENT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SemanticName");
+        FieldToJson(jdata, meta_struct.SemanticName, options);
+        jdata.Key("SemanticIndex");
+        FieldToJson(jdata, decoded_value.SemanticIndex, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("InputSlot");
+        FieldToJson(jdata, decoded_value.InputSlot, options);
+        jdata.Key("AlignedByteOffset");
+        FieldToJson(jdata, decoded_value.AlignedByteOffset, options);
+        jdata.Key("InputSlotClass");
+        FieldToJson(jdata, decoded_value.InputSlotClass, options);
+        jdata.Key("InstanceDataStepRate");
+        FieldToJson(jdata, decoded_value.InstanceDataStepRate, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SO_DECLARATION_ENTRY* data, const JsonOptions& options)
 {
     using namespace util;
@@ -687,6 +1764,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SO_DECLARATI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SO_DECLARATION_ENTRY* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SO_DECLARATION_ENTRY& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SO_DECLARATION_ENTRY& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Stream");
+        FieldToJson(jdata, decoded_value.Stream, options);
+        jdata.Key("SemanticName");
+        FieldToJson(jdata, meta_struct.SemanticName, options);
+        jdata.Key("SemanticIndex");
+        FieldToJson(jdata, decoded_value.SemanticIndex, options);
+        jdata.Key("StartComponent");
+        FieldToJson(jdata, decoded_value.StartComponent, options);
+        jdata.Key("ComponentCount");
+        FieldToJson(jdata, decoded_value.ComponentCount, options);
+        jdata.Key("OutputSlot");
+        FieldToJson(jdata, decoded_value.OutputSlot, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEWPORT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -703,6 +1808,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEWPORT* da
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_VIEWPORT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_VIEWPORT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_VIEWPORT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("TopLeftX");
+        FieldToJson(jdata, decoded_value.TopLeftX, options);
+        jdata.Key("TopLeftY");
+        FieldToJson(jdata, decoded_value.TopLeftY, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("MinDepth");
+        FieldToJson(jdata, decoded_value.MinDepth, options);
+        jdata.Key("MaxDepth");
+        FieldToJson(jdata, decoded_value.MaxDepth, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BOX* data, const JsonOptions& options)
 {
     using namespace util;
@@ -719,6 +1852,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BOX* data, c
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BOX* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BOX& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BOX& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("left");
+        FieldToJson(jdata, decoded_value.left, options);
+        jdata.Key("top");
+        FieldToJson(jdata, decoded_value.top, options);
+        jdata.Key("front");
+        FieldToJson(jdata, decoded_value.front, options);
+        jdata.Key("right");
+        FieldToJson(jdata, decoded_value.right, options);
+        jdata.Key("bottom");
+        FieldToJson(jdata, decoded_value.bottom, options);
+        jdata.Key("back");
+        FieldToJson(jdata, decoded_value.back, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -733,6 +1894,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEPTH_STENCILOP_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCILOP_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("StencilFailOp");
+        FieldToJson(jdata, decoded_value.StencilFailOp, options);
+        jdata.Key("StencilDepthFailOp");
+        FieldToJson(jdata, decoded_value.StencilDepthFailOp, options);
+        jdata.Key("StencilPassOp");
+        FieldToJson(jdata, decoded_value.StencilPassOp, options);
+        jdata.Key("StencilFunc");
+        FieldToJson(jdata, decoded_value.StencilFunc, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -751,6 +1936,38 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEPTH_STENCIL_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCIL_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DepthEnable");
+        Bool32ToJson(jdata, decoded_value.DepthEnable, options);
+        jdata.Key("DepthWriteMask");
+        FieldToJson(jdata, decoded_value.DepthWriteMask, options);
+        jdata.Key("DepthFunc");
+        FieldToJson(jdata, decoded_value.DepthFunc, options);
+        jdata.Key("StencilEnable");
+        Bool32ToJson(jdata, decoded_value.StencilEnable, options);
+        jdata.Key("StencilReadMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.StencilReadMask, options);
+        jdata.Key("StencilWriteMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.StencilWriteMask, options);
+        jdata.Key("FrontFace");
+        FieldToJson(jdata, meta_struct.FrontFace, options);
+        jdata.Key("BackFace");
+        FieldToJson(jdata, meta_struct.BackFace, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -770,6 +1987,40 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEPTH_STENCIL_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCIL_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DepthEnable");
+        Bool32ToJson(jdata, decoded_value.DepthEnable, options);
+        jdata.Key("DepthWriteMask");
+        FieldToJson(jdata, decoded_value.DepthWriteMask, options);
+        jdata.Key("DepthFunc");
+        FieldToJson(jdata, decoded_value.DepthFunc, options);
+        jdata.Key("StencilEnable");
+        Bool32ToJson(jdata, decoded_value.StencilEnable, options);
+        jdata.Key("StencilReadMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.StencilReadMask, options);
+        jdata.Key("StencilWriteMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.StencilWriteMask, options);
+        jdata.Key("FrontFace");
+        FieldToJson(jdata, meta_struct.FrontFace, options);
+        jdata.Key("BackFace");
+        FieldToJson(jdata, meta_struct.BackFace, options);
+        jdata.Key("DepthBoundsTestEnable");
+        Bool32ToJson(jdata, decoded_value.DepthBoundsTestEnable, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -786,6 +2037,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEPTH_STENCILOP_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCILOP_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("StencilFailOp");
+        FieldToJson(jdata, decoded_value.StencilFailOp, options);
+        jdata.Key("StencilDepthFailOp");
+        FieldToJson(jdata, decoded_value.StencilDepthFailOp, options);
+        jdata.Key("StencilPassOp");
+        FieldToJson(jdata, decoded_value.StencilPassOp, options);
+        jdata.Key("StencilFunc");
+        FieldToJson(jdata, decoded_value.StencilFunc, options);
+        jdata.Key("StencilReadMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.StencilReadMask, options);
+        jdata.Key("StencilWriteMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.StencilWriteMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -803,12 +2082,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGET_BLEND_DESC* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
-        const D3D12_RENDER_TARGET_BLEND_DESC& decoded_value = *data->decoded_value;
+        const D3D12_DEPTH_STENCIL_DESC2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCIL_DESC2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DepthEnable");
+        Bool32ToJson(jdata, decoded_value.DepthEnable, options);
+        jdata.Key("DepthWriteMask");
+        FieldToJson(jdata, decoded_value.DepthWriteMask, options);
+        jdata.Key("DepthFunc");
+        FieldToJson(jdata, decoded_value.DepthFunc, options);
+        jdata.Key("StencilEnable");
+        Bool32ToJson(jdata, decoded_value.StencilEnable, options);
+        jdata.Key("FrontFace");
+        FieldToJson(jdata, meta_struct.FrontFace, options);
+        jdata.Key("BackFace");
+        FieldToJson(jdata, meta_struct.BackFace, options);
+        jdata.Key("DepthBoundsTestEnable");
+        Bool32ToJson(jdata, decoded_value.DepthBoundsTestEnable, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGET_BLEND_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_TARGET_BLEND_DESC& decoded_value = *data->decoded_value;
         const Decoded_D3D12_RENDER_TARGET_BLEND_DESC& meta_struct = *data;
         Bool32ToJson(jdata["BlendEnable"], decoded_value.BlendEnable, options);
         Bool32ToJson(jdata["LogicOpEnable"], decoded_value.LogicOpEnable, options);
@@ -823,6 +2132,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_TARGET_BLEND_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_TARGET_BLEND_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_TARGET_BLEND_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BlendEnable");
+        Bool32ToJson(jdata, decoded_value.BlendEnable, options);
+        jdata.Key("LogicOpEnable");
+        Bool32ToJson(jdata, decoded_value.LogicOpEnable, options);
+        jdata.Key("SrcBlend");
+        FieldToJson(jdata, decoded_value.SrcBlend, options);
+        jdata.Key("DestBlend");
+        FieldToJson(jdata, decoded_value.DestBlend, options);
+        jdata.Key("BlendOp");
+        FieldToJson(jdata, decoded_value.BlendOp, options);
+        jdata.Key("SrcBlendAlpha");
+        FieldToJson(jdata, decoded_value.SrcBlendAlpha, options);
+        jdata.Key("DestBlendAlpha");
+        FieldToJson(jdata, decoded_value.DestBlendAlpha, options);
+        jdata.Key("BlendOpAlpha");
+        FieldToJson(jdata, decoded_value.BlendOpAlpha, options);
+        jdata.Key("LogicOp");
+        FieldToJson(jdata, decoded_value.LogicOp, options);
+        jdata.Key("RenderTargetWriteMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.RenderTargetWriteMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BLEND_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -836,6 +2181,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BLEND_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BLEND_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BLEND_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BLEND_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AlphaToCoverageEnable");
+        Bool32ToJson(jdata, decoded_value.AlphaToCoverageEnable, options);
+        jdata.Key("IndependentBlendEnable");
+        Bool32ToJson(jdata, decoded_value.IndependentBlendEnable, options);
+        jdata.Key("RenderTarget");
+        FieldToJson(jdata, meta_struct.RenderTarget, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -857,6 +2224,44 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_D
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RASTERIZER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RASTERIZER_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RASTERIZER_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FillMode");
+        FieldToJson(jdata, decoded_value.FillMode, options);
+        jdata.Key("CullMode");
+        FieldToJson(jdata, decoded_value.CullMode, options);
+        jdata.Key("FrontCounterClockwise");
+        Bool32ToJson(jdata, decoded_value.FrontCounterClockwise, options);
+        jdata.Key("DepthBias");
+        FieldToJson(jdata, decoded_value.DepthBias, options);
+        jdata.Key("DepthBiasClamp");
+        FieldToJson(jdata, decoded_value.DepthBiasClamp, options);
+        jdata.Key("SlopeScaledDepthBias");
+        FieldToJson(jdata, decoded_value.SlopeScaledDepthBias, options);
+        jdata.Key("DepthClipEnable");
+        Bool32ToJson(jdata, decoded_value.DepthClipEnable, options);
+        jdata.Key("MultisampleEnable");
+        Bool32ToJson(jdata, decoded_value.MultisampleEnable, options);
+        jdata.Key("AntialiasedLineEnable");
+        Bool32ToJson(jdata, decoded_value.AntialiasedLineEnable, options);
+        jdata.Key("ForcedSampleCount");
+        FieldToJson(jdata, decoded_value.ForcedSampleCount, options);
+        jdata.Key("ConservativeRaster");
+        FieldToJson(jdata, decoded_value.ConservativeRaster, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -878,6 +2283,44 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_D
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RASTERIZER_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RASTERIZER_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RASTERIZER_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FillMode");
+        FieldToJson(jdata, decoded_value.FillMode, options);
+        jdata.Key("CullMode");
+        FieldToJson(jdata, decoded_value.CullMode, options);
+        jdata.Key("FrontCounterClockwise");
+        Bool32ToJson(jdata, decoded_value.FrontCounterClockwise, options);
+        jdata.Key("DepthBias");
+        FieldToJson(jdata, decoded_value.DepthBias, options);
+        jdata.Key("DepthBiasClamp");
+        FieldToJson(jdata, decoded_value.DepthBiasClamp, options);
+        jdata.Key("SlopeScaledDepthBias");
+        FieldToJson(jdata, decoded_value.SlopeScaledDepthBias, options);
+        jdata.Key("DepthClipEnable");
+        Bool32ToJson(jdata, decoded_value.DepthClipEnable, options);
+        jdata.Key("MultisampleEnable");
+        Bool32ToJson(jdata, decoded_value.MultisampleEnable, options);
+        jdata.Key("AntialiasedLineEnable");
+        Bool32ToJson(jdata, decoded_value.AntialiasedLineEnable, options);
+        jdata.Key("ForcedSampleCount");
+        FieldToJson(jdata, decoded_value.ForcedSampleCount, options);
+        jdata.Key("ConservativeRaster");
+        FieldToJson(jdata, decoded_value.ConservativeRaster, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -898,6 +2341,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_D
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RASTERIZER_DESC2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RASTERIZER_DESC2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RASTERIZER_DESC2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FillMode");
+        FieldToJson(jdata, decoded_value.FillMode, options);
+        jdata.Key("CullMode");
+        FieldToJson(jdata, decoded_value.CullMode, options);
+        jdata.Key("FrontCounterClockwise");
+        Bool32ToJson(jdata, decoded_value.FrontCounterClockwise, options);
+        jdata.Key("DepthBias");
+        FieldToJson(jdata, decoded_value.DepthBias, options);
+        jdata.Key("DepthBiasClamp");
+        FieldToJson(jdata, decoded_value.DepthBiasClamp, options);
+        jdata.Key("SlopeScaledDepthBias");
+        FieldToJson(jdata, decoded_value.SlopeScaledDepthBias, options);
+        jdata.Key("DepthClipEnable");
+        Bool32ToJson(jdata, decoded_value.DepthClipEnable, options);
+        jdata.Key("LineRasterizationMode");
+        FieldToJson(jdata, decoded_value.LineRasterizationMode, options);
+        jdata.Key("ForcedSampleCount");
+        FieldToJson(jdata, decoded_value.ForcedSampleCount, options);
+        jdata.Key("ConservativeRaster");
+        FieldToJson(jdata, decoded_value.ConservativeRaster, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_BYTECODE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -913,6 +2392,29 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_BYTEC
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SHADER_BYTECODE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SHADER_BYTECODE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SHADER_BYTECODE& meta_struct = *data;
+        jdata.BeginObject();
+        static thread_local uint64_t D3D12_SHADER_BYTECODE_pShaderBytecode_counter{ 0 };
+        jdata.Key("pShaderBytecode");
+        const bool written = RepresentBinaryFile(options, jdata, "D3D12_SHADER_BYTECODE.pShaderBytecode", D3D12_SHADER_BYTECODE_pShaderBytecode_counter, meta_struct.pShaderBytecode);
+        D3D12_SHADER_BYTECODE_pShaderBytecode_counter += written;
+
+        jdata.Key("BytecodeLength");
+        FieldToJson(jdata, decoded_value.BytecodeLength, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPUT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -928,6 +2430,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPU
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STREAM_OUTPUT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STREAM_OUTPUT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STREAM_OUTPUT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pSODeclaration");
+        FieldToJson(jdata, meta_struct.pSODeclaration, options);
+        jdata.Key("NumEntries");
+        FieldToJson(jdata, decoded_value.NumEntries, options);
+        jdata.Key("pBufferStrides");
+        FieldToJson(jdata, meta_struct.pBufferStrides, options);
+        jdata.Key("NumStrides");
+        FieldToJson(jdata, decoded_value.NumStrides, options);
+        jdata.Key("RasterizedStream");
+        FieldToJson(jdata, decoded_value.RasterizedStream, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_LAYOUT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -940,6 +2468,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_LAYOUT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_INPUT_LAYOUT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_INPUT_LAYOUT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_INPUT_LAYOUT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pInputElementDescs");
+        FieldToJson(jdata, meta_struct.pInputElementDescs, options);
+        jdata.Key("NumElements");
+        FieldToJson(jdata, decoded_value.NumElements, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CACHED_PIPELINE_STATE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -952,6 +2500,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CACHED_PIPEL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_CACHED_PIPELINE_STATE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_CACHED_PIPELINE_STATE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_CACHED_PIPELINE_STATE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pCachedBlob");
+        FieldToJson(jdata, meta_struct.pCachedBlob, options);
+        jdata.Key("CachedBlobSizeInBytes");
+        FieldToJson(jdata, decoded_value.CachedBlobSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GRAPHICS_PIPELINE_STATE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -983,6 +2551,64 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GRAPHICS_PIP
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GRAPHICS_PIPELINE_STATE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GRAPHICS_PIPELINE_STATE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GRAPHICS_PIPELINE_STATE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, meta_struct.pRootSignature, options);
+        jdata.Key("VS");
+        FieldToJson(jdata, meta_struct.VS, options);
+        jdata.Key("PS");
+        FieldToJson(jdata, meta_struct.PS, options);
+        jdata.Key("DS");
+        FieldToJson(jdata, meta_struct.DS, options);
+        jdata.Key("HS");
+        FieldToJson(jdata, meta_struct.HS, options);
+        jdata.Key("GS");
+        FieldToJson(jdata, meta_struct.GS, options);
+        jdata.Key("StreamOutput");
+        FieldToJson(jdata, meta_struct.StreamOutput, options);
+        jdata.Key("BlendState");
+        FieldToJson(jdata, meta_struct.BlendState, options);
+        jdata.Key("SampleMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.SampleMask, options);
+        jdata.Key("RasterizerState");
+        FieldToJson(jdata, meta_struct.RasterizerState, options);
+        jdata.Key("DepthStencilState");
+        FieldToJson(jdata, meta_struct.DepthStencilState, options);
+        jdata.Key("InputLayout");
+        FieldToJson(jdata, meta_struct.InputLayout, options);
+        jdata.Key("IBStripCutValue");
+        FieldToJson(jdata, decoded_value.IBStripCutValue, options);
+        jdata.Key("PrimitiveTopologyType");
+        FieldToJson(jdata, decoded_value.PrimitiveTopologyType, options);
+        jdata.Key("NumRenderTargets");
+        FieldToJson(jdata, decoded_value.NumRenderTargets, options);
+        jdata.Key("RTVFormats");
+        FieldToJson(jdata, meta_struct.RTVFormats, options);
+        jdata.Key("DSVFormat");
+        FieldToJson(jdata, decoded_value.DSVFormat, options);
+        jdata.Key("SampleDesc");
+        FieldToJson(jdata, meta_struct.SampleDesc, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.Key("CachedPSO");
+        FieldToJson(jdata, meta_struct.CachedPSO, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_PIPELINE_STATE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMPUTE_PIPELINE_STATE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -998,6 +2624,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMPUTE_PIPE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_COMPUTE_PIPELINE_STATE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_COMPUTE_PIPELINE_STATE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_COMPUTE_PIPELINE_STATE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pRootSignature");
+        FieldToJson(jdata, meta_struct.pRootSignature, options);
+        jdata.Key("CS");
+        FieldToJson(jdata, meta_struct.CS, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.Key("CachedPSO");
+        FieldToJson(jdata, meta_struct.CachedPSO, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_PIPELINE_STATE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RT_FORMAT_ARRAY* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1010,6 +2662,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RT_FORMAT_AR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RT_FORMAT_ARRAY* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RT_FORMAT_ARRAY& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RT_FORMAT_ARRAY& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RTFormats");
+        FieldToJson(jdata, meta_struct.RTFormats, options);
+        jdata.Key("NumRenderTargets");
+        FieldToJson(jdata, decoded_value.NumRenderTargets, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1035,6 +2707,52 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DoublePrecisionFloatShaderOps");
+        Bool32ToJson(jdata, decoded_value.DoublePrecisionFloatShaderOps, options);
+        jdata.Key("OutputMergerLogicOp");
+        Bool32ToJson(jdata, decoded_value.OutputMergerLogicOp, options);
+        jdata.Key("MinPrecisionSupport");
+        FieldToJson_D3D12_SHADER_MIN_PRECISION_SUPPORT(jdata, decoded_value.MinPrecisionSupport, options);
+        jdata.Key("TiledResourcesTier");
+        FieldToJson(jdata, decoded_value.TiledResourcesTier, options);
+        jdata.Key("ResourceBindingTier");
+        FieldToJson(jdata, decoded_value.ResourceBindingTier, options);
+        jdata.Key("PSSpecifiedStencilRefSupported");
+        Bool32ToJson(jdata, decoded_value.PSSpecifiedStencilRefSupported, options);
+        jdata.Key("TypedUAVLoadAdditionalFormats");
+        Bool32ToJson(jdata, decoded_value.TypedUAVLoadAdditionalFormats, options);
+        jdata.Key("ROVsSupported");
+        Bool32ToJson(jdata, decoded_value.ROVsSupported, options);
+        jdata.Key("ConservativeRasterizationTier");
+        FieldToJson(jdata, decoded_value.ConservativeRasterizationTier, options);
+        jdata.Key("MaxGPUVirtualAddressBitsPerResource");
+        FieldToJson(jdata, decoded_value.MaxGPUVirtualAddressBitsPerResource, options);
+        jdata.Key("StandardSwizzle64KBSupported");
+        Bool32ToJson(jdata, decoded_value.StandardSwizzle64KBSupported, options);
+        jdata.Key("CrossNodeSharingTier");
+        FieldToJson(jdata, decoded_value.CrossNodeSharingTier, options);
+        jdata.Key("CrossAdapterRowMajorTextureSupported");
+        Bool32ToJson(jdata, decoded_value.CrossAdapterRowMajorTextureSupported, options);
+        jdata.Key("VPAndRTArrayIndexFromAnyShaderFeedingRasterizerSupportedWithoutGSEmulation");
+        Bool32ToJson(jdata, decoded_value.VPAndRTArrayIndexFromAnyShaderFeedingRasterizerSupportedWithoutGSEmulation, options);
+        jdata.Key("ResourceHeapTier");
+        FieldToJson(jdata, decoded_value.ResourceHeapTier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1051,6 +2769,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("WaveOps");
+        Bool32ToJson(jdata, decoded_value.WaveOps, options);
+        jdata.Key("WaveLaneCountMin");
+        FieldToJson(jdata, decoded_value.WaveLaneCountMin, options);
+        jdata.Key("WaveLaneCountMax");
+        FieldToJson(jdata, decoded_value.WaveLaneCountMax, options);
+        jdata.Key("TotalLaneCount");
+        FieldToJson(jdata, decoded_value.TotalLaneCount, options);
+        jdata.Key("ExpandedComputeResourceStates");
+        Bool32ToJson(jdata, decoded_value.ExpandedComputeResourceStates, options);
+        jdata.Key("Int64ShaderOps");
+        Bool32ToJson(jdata, decoded_value.Int64ShaderOps, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1063,6 +2809,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DepthBoundsTestSupported");
+        Bool32ToJson(jdata, decoded_value.DepthBoundsTestSupported, options);
+        jdata.Key("ProgrammableSamplePositionsTier");
+        FieldToJson(jdata, decoded_value.ProgrammableSamplePositionsTier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_ROOT_SIGNATURE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1074,6 +2840,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_ROOT_SIGNATURE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_ROOT_SIGNATURE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_ROOT_SIGNATURE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("HighestVersion");
+        FieldToJson(jdata, decoded_value.HighestVersion, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1088,6 +2872,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_ARCHITECTURE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, decoded_value.NodeIndex, options);
+        jdata.Key("TileBasedRenderer");
+        Bool32ToJson(jdata, decoded_value.TileBasedRenderer, options);
+        jdata.Key("UMA");
+        Bool32ToJson(jdata, decoded_value.UMA, options);
+        jdata.Key("CacheCoherentUMA");
+        Bool32ToJson(jdata, decoded_value.CacheCoherentUMA, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1103,6 +2911,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_ARCHITECTURE1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, decoded_value.NodeIndex, options);
+        jdata.Key("TileBasedRenderer");
+        Bool32ToJson(jdata, decoded_value.TileBasedRenderer, options);
+        jdata.Key("UMA");
+        Bool32ToJson(jdata, decoded_value.UMA, options);
+        jdata.Key("CacheCoherentUMA");
+        Bool32ToJson(jdata, decoded_value.CacheCoherentUMA, options);
+        jdata.Key("IsolatedMMU");
+        Bool32ToJson(jdata, decoded_value.IsolatedMMU, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_FEATURE_LEVELS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1116,6 +2950,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_FEATURE_LEVELS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_FEATURE_LEVELS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_FEATURE_LEVELS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumFeatureLevels");
+        FieldToJson(jdata, decoded_value.NumFeatureLevels, options);
+        jdata.Key("pFeatureLevelsRequested");
+        FieldToJson(jdata, meta_struct.pFeatureLevelsRequested, options);
+        jdata.Key("MaxSupportedFeatureLevel");
+        FieldToJson(jdata, decoded_value.MaxSupportedFeatureLevel, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_MODEL* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1127,6 +2983,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_MODEL* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_SHADER_MODEL& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_SHADER_MODEL& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("HighestShaderModel");
+        FieldToJson(jdata, decoded_value.HighestShaderModel, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_SUPPORT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1140,6 +3014,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_SUPPORT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_FORMAT_SUPPORT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_FORMAT_SUPPORT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("Support1");
+        FieldToJson_D3D12_FORMAT_SUPPORT1(jdata, decoded_value.Support1, options);
+        jdata.Key("Support2");
+        FieldToJson_D3D12_FORMAT_SUPPORT2(jdata, decoded_value.Support2, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1154,6 +3050,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("SampleCount");
+        FieldToJson(jdata, decoded_value.SampleCount, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("NumQualityLevels");
+        FieldToJson(jdata, decoded_value.NumQualityLevels, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1166,19 +3086,59 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
-        const D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT& decoded_value = *data->decoded_value;
-        const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT& meta_struct = *data;
-        FieldToJson(jdata["MaxGPUVirtualAddressBitsPerResource"], decoded_value.MaxGPUVirtualAddressBitsPerResource, options);
-        FieldToJson(jdata["MaxGPUVirtualAddressBitsPerProcess"], decoded_value.MaxGPUVirtualAddressBitsPerProcess, options);
+        const D3D12_FEATURE_DATA_FORMAT_INFO& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_FORMAT_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("PlaneCount");
+        FieldToJson(jdata, decoded_value.PlaneCount, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_CACHE* data, const JsonOptions& options)
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT& meta_struct = *data;
+        FieldToJson(jdata["MaxGPUVirtualAddressBitsPerResource"], decoded_value.MaxGPUVirtualAddressBitsPerResource, options);
+        FieldToJson(jdata["MaxGPUVirtualAddressBitsPerProcess"], decoded_value.MaxGPUVirtualAddressBitsPerProcess, options);
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MaxGPUVirtualAddressBitsPerResource");
+        FieldToJson(jdata, decoded_value.MaxGPUVirtualAddressBitsPerResource, options);
+        jdata.Key("MaxGPUVirtualAddressBitsPerProcess");
+        FieldToJson(jdata, decoded_value.MaxGPUVirtualAddressBitsPerProcess, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_CACHE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1189,6 +3149,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_CACHE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_SHADER_CACHE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_SHADER_CACHE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SupportFlags");
+        FieldToJson_D3D12_SHADER_CACHE_SUPPORT_FLAGS(jdata, decoded_value.SupportFlags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1202,6 +3180,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CommandListType");
+        FieldToJson(jdata, decoded_value.CommandListType, options);
+        jdata.Key("Priority");
+        FieldToJson(jdata, decoded_value.Priority, options);
+        jdata.Key("PriorityForTypeIsSupported");
+        Bool32ToJson(jdata, decoded_value.PriorityForTypeIsSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS3* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1217,6 +3217,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS3* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS3& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS3& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CopyQueueTimestampQueriesSupported");
+        Bool32ToJson(jdata, decoded_value.CopyQueueTimestampQueriesSupported, options);
+        jdata.Key("CastingFullyTypedFormatSupported");
+        Bool32ToJson(jdata, decoded_value.CastingFullyTypedFormatSupported, options);
+        jdata.Key("WriteBufferImmediateSupportFlags");
+        FieldToJson_D3D12_COMMAND_LIST_SUPPORT_FLAGS(jdata, decoded_value.WriteBufferImmediateSupportFlags, options);
+        jdata.Key("ViewInstancingTier");
+        FieldToJson(jdata, decoded_value.ViewInstancingTier, options);
+        jdata.Key("BarycentricsSupported");
+        Bool32ToJson(jdata, decoded_value.BarycentricsSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_EXISTING_HEAPS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1228,6 +3254,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_EXISTING_HEAPS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_EXISTING_HEAPS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_EXISTING_HEAPS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Supported");
+        Bool32ToJson(jdata, decoded_value.Supported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_DISPLAYABLE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1240,6 +3284,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_DISPLAYABLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_DISPLAYABLE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_DISPLAYABLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DisplayableTexture");
+        Bool32ToJson(jdata, decoded_value.DisplayableTexture, options);
+        jdata.Key("SharedResourceCompatibilityTier");
+        FieldToJson(jdata, decoded_value.SharedResourceCompatibilityTier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS4* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1253,6 +3317,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS4* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS4& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS4& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MSAA64KBAlignedTextureSupported");
+        Bool32ToJson(jdata, decoded_value.MSAA64KBAlignedTextureSupported, options);
+        jdata.Key("SharedResourceCompatibilityTier");
+        FieldToJson(jdata, decoded_value.SharedResourceCompatibilityTier, options);
+        jdata.Key("Native16BitShaderOpsSupported");
+        Bool32ToJson(jdata, decoded_value.Native16BitShaderOpsSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SERIALIZATION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1265,6 +3351,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_SERIALIZATION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_SERIALIZATION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_SERIALIZATION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, decoded_value.NodeIndex, options);
+        jdata.Key("HeapSerializationTier");
+        FieldToJson(jdata, decoded_value.HeapSerializationTier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_CROSS_NODE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1277,6 +3383,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_CROSS_NODE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_CROSS_NODE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_CROSS_NODE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SharingTier");
+        FieldToJson(jdata, decoded_value.SharingTier, options);
+        jdata.Key("AtomicShaderInstructions");
+        Bool32ToJson(jdata, decoded_value.AtomicShaderInstructions, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS5* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1290,6 +3416,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS5* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS5& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS5& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SRVOnlyTiledResourceTier3");
+        Bool32ToJson(jdata, decoded_value.SRVOnlyTiledResourceTier3, options);
+        jdata.Key("RenderPassesTier");
+        FieldToJson(jdata, decoded_value.RenderPassesTier, options);
+        jdata.Key("RaytracingTier");
+        FieldToJson(jdata, decoded_value.RaytracingTier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS6* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1305,6 +3453,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS6* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS6& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS6& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AdditionalShadingRatesSupported");
+        Bool32ToJson(jdata, decoded_value.AdditionalShadingRatesSupported, options);
+        jdata.Key("PerPrimitiveShadingRateSupportedWithViewportIndexing");
+        Bool32ToJson(jdata, decoded_value.PerPrimitiveShadingRateSupportedWithViewportIndexing, options);
+        jdata.Key("VariableShadingRateTier");
+        FieldToJson(jdata, decoded_value.VariableShadingRateTier, options);
+        jdata.Key("ShadingRateImageTileSize");
+        FieldToJson(jdata, decoded_value.ShadingRateImageTileSize, options);
+        jdata.Key("BackgroundProcessingSupported");
+        Bool32ToJson(jdata, decoded_value.BackgroundProcessingSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS7* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1317,6 +3491,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS7* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS7& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS7& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MeshShaderTier");
+        FieldToJson(jdata, decoded_value.MeshShaderTier, options);
+        jdata.Key("SamplerFeedbackTier");
+        FieldToJson(jdata, decoded_value.SamplerFeedbackTier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_QUERY_META_COMMAND* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1333,6 +3527,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_QUERY_META_COMMAND* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_QUERY_META_COMMAND& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_QUERY_META_COMMAND& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CommandId");
+        FieldToJson(jdata, meta_struct.CommandId, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.Key("pQueryInputData");
+        FieldToJson(jdata, meta_struct.pQueryInputData, options);
+        jdata.Key("QueryInputDataSizeInBytes");
+        FieldToJson(jdata, decoded_value.QueryInputDataSizeInBytes, options);
+        jdata.Key("pQueryOutputData");
+        FieldToJson(jdata, meta_struct.pQueryOutputData, options);
+        jdata.Key("QueryOutputDataSizeInBytes");
+        FieldToJson(jdata, decoded_value.QueryOutputDataSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS8* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1344,6 +3566,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS8* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS8& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS8& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("UnalignedBlockTexturesSupported");
+        Bool32ToJson(jdata, decoded_value.UnalignedBlockTexturesSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS9* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1360,6 +3600,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS9* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS9& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS9& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MeshShaderPipelineStatsSupported");
+        Bool32ToJson(jdata, decoded_value.MeshShaderPipelineStatsSupported, options);
+        jdata.Key("MeshShaderSupportsFullRangeRenderTargetArrayIndex");
+        Bool32ToJson(jdata, decoded_value.MeshShaderSupportsFullRangeRenderTargetArrayIndex, options);
+        jdata.Key("AtomicInt64OnTypedResourceSupported");
+        Bool32ToJson(jdata, decoded_value.AtomicInt64OnTypedResourceSupported, options);
+        jdata.Key("AtomicInt64OnGroupSharedSupported");
+        Bool32ToJson(jdata, decoded_value.AtomicInt64OnGroupSharedSupported, options);
+        jdata.Key("DerivativesInMeshAndAmplificationShadersSupported");
+        Bool32ToJson(jdata, decoded_value.DerivativesInMeshAndAmplificationShadersSupported, options);
+        jdata.Key("WaveMMATier");
+        FieldToJson(jdata, decoded_value.WaveMMATier, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS10* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1372,6 +3640,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS10* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS10& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS10& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("VariableRateShadingSumCombinerSupported");
+        Bool32ToJson(jdata, decoded_value.VariableRateShadingSumCombinerSupported, options);
+        jdata.Key("MeshShaderPerPrimitiveShadingRateSupported");
+        Bool32ToJson(jdata, decoded_value.MeshShaderPerPrimitiveShadingRateSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS11* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1383,6 +3671,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS11* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS11& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS11& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AtomicInt64OnDescriptorHeapResourceSupported");
+        Bool32ToJson(jdata, decoded_value.AtomicInt64OnDescriptorHeapResourceSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS12* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1396,6 +3702,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS12* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS12& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS12& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MSPrimitivesPipelineStatisticIncludesCulledPrimitives");
+        FieldToJson(jdata, decoded_value.MSPrimitivesPipelineStatisticIncludesCulledPrimitives, options);
+        jdata.Key("EnhancedBarriersSupported");
+        Bool32ToJson(jdata, decoded_value.EnhancedBarriersSupported, options);
+        jdata.Key("RelaxedFormatCastingSupported");
+        Bool32ToJson(jdata, decoded_value.RelaxedFormatCastingSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS13* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1412,6 +3740,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS13* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS13& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS13& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("UnrestrictedBufferTextureCopyPitchSupported");
+        Bool32ToJson(jdata, decoded_value.UnrestrictedBufferTextureCopyPitchSupported, options);
+        jdata.Key("UnrestrictedVertexElementAlignmentSupported");
+        Bool32ToJson(jdata, decoded_value.UnrestrictedVertexElementAlignmentSupported, options);
+        jdata.Key("InvertedViewportHeightFlipsYSupported");
+        Bool32ToJson(jdata, decoded_value.InvertedViewportHeightFlipsYSupported, options);
+        jdata.Key("InvertedViewportDepthFlipsZSupported");
+        Bool32ToJson(jdata, decoded_value.InvertedViewportDepthFlipsZSupported, options);
+        jdata.Key("TextureCopyBetweenDimensionsSupported");
+        Bool32ToJson(jdata, decoded_value.TextureCopyBetweenDimensionsSupported, options);
+        jdata.Key("AlphaBlendFactorSupported");
+        Bool32ToJson(jdata, decoded_value.AlphaBlendFactorSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS14* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1425,6 +3781,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS14* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS14& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS14& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AdvancedTextureOpsSupported");
+        Bool32ToJson(jdata, decoded_value.AdvancedTextureOpsSupported, options);
+        jdata.Key("WriteableMSAATexturesSupported");
+        Bool32ToJson(jdata, decoded_value.WriteableMSAATexturesSupported, options);
+        jdata.Key("IndependentFrontAndBackStencilRefMaskSupported");
+        Bool32ToJson(jdata, decoded_value.IndependentFrontAndBackStencilRefMaskSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS15* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1437,6 +3815,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS15* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS15& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS15& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("TriangleFanSupported");
+        Bool32ToJson(jdata, decoded_value.TriangleFanSupported, options);
+        jdata.Key("DynamicIndexBufferStripCutSupported");
+        Bool32ToJson(jdata, decoded_value.DynamicIndexBufferStripCutSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS16* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1449,6 +3847,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS16* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS16& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS16& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DynamicDepthBiasSupported");
+        Bool32ToJson(jdata, decoded_value.DynamicDepthBiasSupported, options);
+        jdata.Key("GPUUploadHeapSupported");
+        Bool32ToJson(jdata, decoded_value.GPUUploadHeapSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS17* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1461,7 +3879,27 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS17* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS17& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS17& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NonNormalizedCoordinateSamplersSupported");
+        Bool32ToJson(jdata, decoded_value.NonNormalizedCoordinateSamplersSupported, options);
+        jdata.Key("ManualWriteTrackingResourceSupported");
+        Bool32ToJson(jdata, decoded_value.ManualWriteTrackingResourceSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1472,6 +3910,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS18& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RenderPassesValid");
+        Bool32ToJson(jdata, decoded_value.RenderPassesValid, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS19* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1492,6 +3948,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS19* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_D3D12_OPTIONS19& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS19& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MismatchingOutputDimensionsSupported");
+        Bool32ToJson(jdata, decoded_value.MismatchingOutputDimensionsSupported, options);
+        jdata.Key("SupportedSampleCountsWithNoOutputs");
+        FieldToJson(jdata, decoded_value.SupportedSampleCountsWithNoOutputs, options);
+        jdata.Key("PointSamplingAddressesNeverRoundUp");
+        Bool32ToJson(jdata, decoded_value.PointSamplingAddressesNeverRoundUp, options);
+        jdata.Key("RasterizerDesc2Supported");
+        Bool32ToJson(jdata, decoded_value.RasterizerDesc2Supported, options);
+        jdata.Key("NarrowQuadrilateralLinesSupported");
+        Bool32ToJson(jdata, decoded_value.NarrowQuadrilateralLinesSupported, options);
+        jdata.Key("AnisoFilterWithPointMipSupported");
+        Bool32ToJson(jdata, decoded_value.AnisoFilterWithPointMipSupported, options);
+        jdata.Key("MaxSamplerDescriptorHeapSize");
+        FieldToJson(jdata, decoded_value.MaxSamplerDescriptorHeapSize, options);
+        jdata.Key("MaxSamplerDescriptorHeapSizeWithStaticSamplers");
+        FieldToJson(jdata, decoded_value.MaxSamplerDescriptorHeapSizeWithStaticSamplers, options);
+        jdata.Key("MaxViewDescriptorHeapSize");
+        FieldToJson(jdata, decoded_value.MaxViewDescriptorHeapSize, options);
+        jdata.Key("ComputeOnlyCustomHeapSupported");
+        Bool32ToJson(jdata, decoded_value.ComputeOnlyCustomHeapSupported, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1504,6 +3996,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_ALLOCATION_INFO& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_ALLOCATION_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key("Alignment");
+        FieldToJson(jdata, decoded_value.Alignment, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1517,6 +4029,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_ALLOCATION_INFO1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_ALLOCATION_INFO1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Offset");
+        FieldToJson(jdata, decoded_value.Offset, options);
+        jdata.Key("Alignment");
+        FieldToJson(jdata, decoded_value.Alignment, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_PROPERTIES* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1532,6 +4066,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_PROPERT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_HEAP_PROPERTIES* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_HEAP_PROPERTIES& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_HEAP_PROPERTIES& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("CPUPageProperty");
+        FieldToJson(jdata, decoded_value.CPUPageProperty, options);
+        jdata.Key("MemoryPoolPreference");
+        FieldToJson(jdata, decoded_value.MemoryPoolPreference, options);
+        jdata.Key("CreationNodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.CreationNodeMask, options);
+        jdata.Key("VisibleNodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.VisibleNodeMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1546,6 +4106,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_DESC* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_HEAP_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_HEAP_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_HEAP_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key("Properties");
+        FieldToJson(jdata, meta_struct.Properties, options);
+        jdata.Key("Alignment");
+        FieldToJson(jdata, decoded_value.Alignment, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_HEAP_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MIP_REGION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1559,6 +4143,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MIP_REGION*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_MIP_REGION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_MIP_REGION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_MIP_REGION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Depth");
+        FieldToJson(jdata, decoded_value.Depth, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1579,6 +4185,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DES
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Dimension");
+        FieldToJson(jdata, decoded_value.Dimension, options);
+        jdata.Key("Alignment");
+        FieldToJson(jdata, decoded_value.Alignment, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("DepthOrArraySize");
+        FieldToJson(jdata, decoded_value.DepthOrArraySize, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("SampleDesc");
+        FieldToJson(jdata, meta_struct.SampleDesc, options);
+        jdata.Key("Layout");
+        FieldToJson(jdata, decoded_value.Layout, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RESOURCE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1600,6 +4242,44 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DES
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Dimension");
+        FieldToJson(jdata, decoded_value.Dimension, options);
+        jdata.Key("Alignment");
+        FieldToJson(jdata, decoded_value.Alignment, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("DepthOrArraySize");
+        FieldToJson(jdata, decoded_value.DepthOrArraySize, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("SampleDesc");
+        FieldToJson(jdata, meta_struct.SampleDesc, options);
+        jdata.Key("Layout");
+        FieldToJson(jdata, decoded_value.Layout, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RESOURCE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("SamplerFeedbackMipRegion");
+        FieldToJson(jdata, meta_struct.SamplerFeedbackMipRegion, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_VALUE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1612,6 +4292,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCIL_VALUE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEPTH_STENCIL_VALUE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCIL_VALUE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Depth");
+        FieldToJson(jdata, decoded_value.Depth, options);
+        jdata.Key("Stencil");
+        FieldToJson(jdata, decoded_value.Stencil, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CLEAR_VALUE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1631,6 +4331,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CLEAR_VALUE*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_CLEAR_VALUE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_CLEAR_VALUE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_CLEAR_VALUE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        if(graphics::dx12::IsDepthStencilFormat(decoded_value.Format))
+        {
+            jdata.Key("DepthStencil");
+            FieldToJson(jdata, decoded_value.DepthStencil, options);
+        }
+        else
+        {
+            jdata.Key("Color");
+            FieldToJson(jdata, decoded_value.Color, options);
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1643,6 +4371,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE* data,
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RANGE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RANGE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RANGE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Begin");
+        FieldToJson(jdata, decoded_value.Begin, options);
+        jdata.Key("End");
+        FieldToJson(jdata, decoded_value.End, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE_UINT64* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1655,6 +4403,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE_UINT64
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RANGE_UINT64* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RANGE_UINT64& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RANGE_UINT64& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Begin");
+        FieldToJson(jdata, decoded_value.Begin, options);
+        jdata.Key("End");
+        FieldToJson(jdata, decoded_value.End, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_RANGE_UINT64* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1667,6 +4435,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SUBRESOURCE_RANGE_UINT64* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SUBRESOURCE_RANGE_UINT64& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SUBRESOURCE_RANGE_UINT64& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Subresource");
+        FieldToJson(jdata, decoded_value.Subresource, options);
+        jdata.Key("Range");
+        FieldToJson(jdata, meta_struct.Range, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1680,6 +4468,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SUBRESOURCE_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SUBRESOURCE_INFO& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SUBRESOURCE_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Offset");
+        FieldToJson(jdata, decoded_value.Offset, options);
+        jdata.Key("RowPitch");
+        FieldToJson(jdata, decoded_value.RowPitch, options);
+        jdata.Key("DepthPitch");
+        FieldToJson(jdata, decoded_value.DepthPitch, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILED_RESOURCE_COORDINATE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1694,6 +4504,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILED_RESOUR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TILED_RESOURCE_COORDINATE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TILED_RESOURCE_COORDINATE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TILED_RESOURCE_COORDINATE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("X");
+        FieldToJson(jdata, decoded_value.X, options);
+        jdata.Key("Y");
+        FieldToJson(jdata, decoded_value.Y, options);
+        jdata.Key("Z");
+        FieldToJson(jdata, decoded_value.Z, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, decoded_value.Subresource, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_REGION_SIZE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1709,6 +4543,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_REGION_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TILE_REGION_SIZE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TILE_REGION_SIZE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TILE_REGION_SIZE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumTiles");
+        FieldToJson(jdata, decoded_value.NumTiles, options);
+        jdata.Key("UseBox");
+        Bool32ToJson(jdata, decoded_value.UseBox, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Depth");
+        FieldToJson(jdata, decoded_value.Depth, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_TILING* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1723,6 +4583,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SUBRESOURCE_TILING* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SUBRESOURCE_TILING& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SUBRESOURCE_TILING& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("WidthInTiles");
+        FieldToJson(jdata, decoded_value.WidthInTiles, options);
+        jdata.Key("HeightInTiles");
+        FieldToJson(jdata, decoded_value.HeightInTiles, options);
+        jdata.Key("DepthInTiles");
+        FieldToJson(jdata, decoded_value.DepthInTiles, options);
+        jdata.Key("StartTileIndexInOverallResource");
+        FieldToJson(jdata, decoded_value.StartTileIndexInOverallResource, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_SHAPE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1736,6 +4620,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_SHAPE*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TILE_SHAPE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TILE_SHAPE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TILE_SHAPE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("WidthInTexels");
+        FieldToJson(jdata, decoded_value.WidthInTexels, options);
+        jdata.Key("HeightInTexels");
+        FieldToJson(jdata, decoded_value.HeightInTexels, options);
+        jdata.Key("DepthInTexels");
+        FieldToJson(jdata, decoded_value.DepthInTexels, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PACKED_MIP_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1750,6 +4656,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PACKED_MIP_I
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_PACKED_MIP_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_PACKED_MIP_INFO& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_PACKED_MIP_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumStandardMips");
+        FieldToJson(jdata, decoded_value.NumStandardMips, options);
+        jdata.Key("NumPackedMips");
+        FieldToJson(jdata, decoded_value.NumPackedMips, options);
+        jdata.Key("NumTilesForPackedMips");
+        FieldToJson(jdata, decoded_value.NumTilesForPackedMips, options);
+        jdata.Key("StartTileIndexInOverallResource");
+        FieldToJson(jdata, decoded_value.StartTileIndexInOverallResource, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_TRANSITION_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1764,6 +4694,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_TRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_TRANSITION_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_TRANSITION_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_TRANSITION_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pResource");
+        FieldToJson(jdata, meta_struct.pResource, options);
+        jdata.Key("Subresource");
+        FieldToJson(jdata, decoded_value.Subresource, options);
+        jdata.Key("StateBefore");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, decoded_value.StateBefore, options);
+        jdata.Key("StateAfter");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, decoded_value.StateAfter, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALIASING_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1776,6 +4730,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_ALIASING_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_ALIASING_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_ALIASING_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pResourceBefore");
+        FieldToJson(jdata, meta_struct.pResourceBefore, options);
+        jdata.Key("pResourceAfter");
+        FieldToJson(jdata, meta_struct.pResourceAfter, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_UAV_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1787,12 +4761,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_UAV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_BARRIER* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_UAV_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
-        const D3D12_RESOURCE_BARRIER& decoded_value = *data->decoded_value;
+        const D3D12_RESOURCE_UAV_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_UAV_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pResource");
+        FieldToJson(jdata, meta_struct.pResource, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_BARRIER& decoded_value = *data->decoded_value;
         const Decoded_D3D12_RESOURCE_BARRIER& meta_struct = *data;
         FieldToJson(jdata["Type"], decoded_value.Type, options);
         FieldToJson_D3D12_RESOURCE_BARRIER_FLAGS(jdata["Flags"], decoded_value.Flags, options);
@@ -1822,6 +4814,53 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_BAR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RESOURCE_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RESOURCE_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RESOURCE_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RESOURCE_BARRIER_FLAGS(jdata, decoded_value.Flags, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
+            {
+                jdata.Key("Transition");
+                FieldToJson(jdata, meta_struct.Transition, options);
+                break;
+            }
+            case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:
+            {
+                jdata.Key("Aliasing");
+                FieldToJson(jdata, meta_struct.Aliasing, options);
+                break;
+            }
+            case D3D12_RESOURCE_BARRIER_TYPE_UAV:
+            {
+                jdata.Key("UAV");
+                FieldToJson(jdata, meta_struct.UAV, options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_RESOURCE_BARRIER_TYPE in D3D12_RESOURCE_BARRIER.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1837,6 +4876,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SUBRESOURCE_FOOTPRINT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SUBRESOURCE_FOOTPRINT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Depth");
+        FieldToJson(jdata, decoded_value.Depth, options);
+        jdata.Key("RowPitch");
+        FieldToJson(jdata, decoded_value.RowPitch, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PLACED_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1849,6 +4914,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PLACED_SUBRE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_PLACED_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_PLACED_SUBRESOURCE_FOOTPRINT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Offset");
+        FieldToJson(jdata, decoded_value.Offset, options);
+        jdata.Key("Footprint");
+        FieldToJson(jdata, meta_struct.Footprint, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_COPY_LOCATION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1879,6 +4964,47 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_COPY
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEXTURE_COPY_LOCATION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEXTURE_COPY_LOCATION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEXTURE_COPY_LOCATION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pResource");
+        FieldToJson(jdata, meta_struct.pResource, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX:
+            {
+                jdata.Key("SubresourceIndex");
+                FieldToJson(jdata, decoded_value.SubresourceIndex, options);
+                break;
+            }
+            case D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT:
+            {
+                jdata.Key("PlacedFootprint");
+                FieldToJson(jdata, meta_struct.PlacedFootprint, options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_TEXTURE_COPY_TYPE in D3D12_TEXTURE_COPY_LOCATION.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLE_POSITION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1891,6 +5017,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLE_POSIT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SAMPLE_POSITION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SAMPLE_POSITION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SAMPLE_POSITION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("X");
+        FieldToJson(jdata, decoded_value.X, options);
+        jdata.Key("Y");
+        FieldToJson(jdata, decoded_value.Y, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANCE_LOCATION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1903,6 +5049,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANC
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_VIEW_INSTANCE_LOCATION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_VIEW_INSTANCE_LOCATION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_VIEW_INSTANCE_LOCATION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ViewportArrayIndex");
+        FieldToJson(jdata, decoded_value.ViewportArrayIndex, options);
+        jdata.Key("RenderTargetArrayIndex");
+        FieldToJson(jdata, decoded_value.RenderTargetArrayIndex, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANCING_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1916,6 +5082,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANC
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_VIEW_INSTANCING_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_VIEW_INSTANCING_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_VIEW_INSTANCING_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ViewInstanceCount");
+        FieldToJson(jdata, decoded_value.ViewInstanceCount, options);
+        jdata.Key("pViewInstanceLocations");
+        FieldToJson(jdata, meta_struct.pViewInstanceLocations, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_VIEW_INSTANCING_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1930,6 +5118,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_SRV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUFFER_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUFFER_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUFFER_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstElement");
+        FieldToJson(jdata, decoded_value.FirstElement, options);
+        jdata.Key("NumElements");
+        FieldToJson(jdata, decoded_value.NumElements, options);
+        jdata.Key("StructureByteStride");
+        FieldToJson(jdata, decoded_value.StructureByteStride, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_BUFFER_SRV_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1943,6 +5155,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_SRV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1958,6 +5192,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_ARRAY_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_ARRAY_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_ARRAY_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1972,6 +5232,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_SRV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("PlaneSlice");
+        FieldToJson(jdata, decoded_value.PlaneSlice, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -1988,6 +5272,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_ARRAY_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_ARRAY_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_ARRAY_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.Key("PlaneSlice");
+        FieldToJson(jdata, decoded_value.PlaneSlice, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2001,6 +5313,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_SRV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX3D_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX3D_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX3D_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2014,6 +5348,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_SRV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEXCUBE_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEXCUBE_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEXCUBE_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2029,6 +5385,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_ARRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEXCUBE_ARRAY_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEXCUBE_ARRAY_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEXCUBE_ARRAY_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MostDetailedMip");
+        FieldToJson(jdata, decoded_value.MostDetailedMip, options);
+        jdata.Key("MipLevels");
+        FieldToJson(jdata, decoded_value.MipLevels, options);
+        jdata.Key("First2DArrayFace");
+        FieldToJson(jdata, decoded_value.First2DArrayFace, options);
+        jdata.Key("NumCubes");
+        FieldToJson(jdata, decoded_value.NumCubes, options);
+        jdata.Key("ResourceMinLODClamp");
+        FieldToJson(jdata, decoded_value.ResourceMinLODClamp, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2040,6 +5422,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_SRV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("UnusedField_NothingToDefine");
+        FieldToJson(jdata, decoded_value.UnusedField_NothingToDefine, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2052,6 +5452,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_ARRAY_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_ARRAY_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2063,6 +5483,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Location");
+        FieldToJsonAsHex(jdata, decoded_value.Location, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2134,21 +5572,132 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_RESOU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
-        const D3D12_CONSTANT_BUFFER_VIEW_DESC& decoded_value = *data->decoded_value;
-        const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC& meta_struct = *data;
-        FieldToJsonAsHex(jdata["BufferLocation"], decoded_value.BufferLocation, options);
-        FieldToJson(jdata["SizeInBytes"], decoded_value.SizeInBytes, options);
-    }
-}
-
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC* data, const JsonOptions& options)
-{
-    using namespace util;
+        const D3D12_SHADER_RESOURCE_VIEW_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ViewDimension");
+        FieldToJson(jdata, decoded_value.ViewDimension, options);
+        jdata.Key("Shader4ComponentMapping");
+        FieldToJson(jdata, decoded_value.Shader4ComponentMapping, options);
+        switch(decoded_value.ViewDimension)
+        {
+            case D3D12_SRV_DIMENSION_BUFFER:
+            {
+                jdata.Key("Buffer");
+                FieldToJson(jdata, meta_struct.Buffer, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE1D:
+            {
+                jdata.Key("Texture1D");
+                FieldToJson(jdata, meta_struct.Texture1D, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE1DARRAY:
+            {
+                jdata.Key("Texture1DArray");
+                FieldToJson(jdata, meta_struct.Texture1DArray, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE2D:
+            {
+                jdata.Key("Texture2D");
+                FieldToJson(jdata, meta_struct.Texture2D, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:
+            {
+                jdata.Key("Texture2DArray");
+                FieldToJson(jdata, meta_struct.Texture2DArray, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE2DMS:
+            {
+                jdata.Key("Texture2DMS");
+                FieldToJson(jdata, meta_struct.Texture2DMS, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY:
+            {
+                jdata.Key("Texture2DMSArray");
+                FieldToJson(jdata, meta_struct.Texture2DMSArray, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURE3D:
+            {
+                jdata.Key("Texture3D");
+                FieldToJson(jdata, meta_struct.Texture3D, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURECUBE:
+            {
+                jdata.Key("TextureCube");
+                FieldToJson(jdata, meta_struct.TextureCube, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY:
+            {
+                jdata.Key("TextureCubeArray");
+                FieldToJson(jdata, meta_struct.TextureCubeArray, options);
+                break;
+            }
+            case D3D12_SRV_DIMENSION_RAYTRACING_ACCELERATION_STRUCTURE:
+            {
+                jdata.Key("RaytracingAccelerationStructure");
+                FieldToJson(jdata, meta_struct.RaytracingAccelerationStructure, options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_CONSTANT_BUFFER_VIEW_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC& meta_struct = *data;
+        FieldToJsonAsHex(jdata["BufferLocation"], decoded_value.BufferLocation, options);
+        FieldToJson(jdata["SizeInBytes"], decoded_value.SizeInBytes, options);
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_CONSTANT_BUFFER_VIEW_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, decoded_value.BufferLocation, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_SAMPLER_DESC& decoded_value = *data->decoded_value;
@@ -2166,6 +5715,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SAMPLER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SAMPLER_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SAMPLER_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Filter");
+        FieldToJson(jdata, decoded_value.Filter, options);
+        jdata.Key("AddressU");
+        FieldToJson(jdata, decoded_value.AddressU, options);
+        jdata.Key("AddressV");
+        FieldToJson(jdata, decoded_value.AddressV, options);
+        jdata.Key("AddressW");
+        FieldToJson(jdata, decoded_value.AddressW, options);
+        jdata.Key("MipLODBias");
+        FieldToJson(jdata, decoded_value.MipLODBias, options);
+        jdata.Key("MaxAnisotropy");
+        FieldToJson(jdata, decoded_value.MaxAnisotropy, options);
+        jdata.Key("ComparisonFunc");
+        FieldToJson(jdata, decoded_value.ComparisonFunc, options);
+        jdata.Key("BorderColor");
+        FieldToJson(jdata, meta_struct.BorderColor, options);
+        jdata.Key("MinLOD");
+        FieldToJson(jdata, decoded_value.MinLOD, options);
+        jdata.Key("MaxLOD");
+        FieldToJson(jdata, decoded_value.MaxLOD, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2194,6 +5779,52 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SAMPLER_DESC2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SAMPLER_DESC2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SAMPLER_DESC2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Filter");
+        FieldToJson(jdata, decoded_value.Filter, options);
+        jdata.Key("AddressU");
+        FieldToJson(jdata, decoded_value.AddressU, options);
+        jdata.Key("AddressV");
+        FieldToJson(jdata, decoded_value.AddressV, options);
+        jdata.Key("AddressW");
+        FieldToJson(jdata, decoded_value.AddressW, options);
+        jdata.Key("MipLODBias");
+        FieldToJson(jdata, decoded_value.MipLODBias, options);
+        jdata.Key("MaxAnisotropy");
+        FieldToJson(jdata, decoded_value.MaxAnisotropy, options);
+        jdata.Key("ComparisonFunc");
+        FieldToJson(jdata, decoded_value.ComparisonFunc, options);
+        if(decoded_value.Flags & D3D12_SAMPLER_FLAG_UINT_BORDER_COLOR)
+        {
+            jdata.Key("UintBorderColor");
+            FieldToJson(jdata, decoded_value.UintBorderColor, options);
+        }
+        else
+        {
+            jdata.Key("FloatBorderColor");
+            FieldToJson(jdata, decoded_value.FloatBorderColor, options);
+        }
+        jdata.Key("MinLOD");
+        FieldToJson(jdata, decoded_value.MinLOD, options);
+        jdata.Key("MaxLOD");
+        FieldToJson(jdata, decoded_value.MaxLOD, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_SAMPLER_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2209,6 +5840,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_UAV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUFFER_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUFFER_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUFFER_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstElement");
+        FieldToJson(jdata, decoded_value.FirstElement, options);
+        jdata.Key("NumElements");
+        FieldToJson(jdata, decoded_value.NumElements, options);
+        jdata.Key("StructureByteStride");
+        FieldToJson(jdata, decoded_value.StructureByteStride, options);
+        jdata.Key("CounterOffsetInBytes");
+        FieldToJson(jdata, decoded_value.CounterOffsetInBytes, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_BUFFER_UAV_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2220,6 +5877,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_UAV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2233,6 +5908,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_ARRAY_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_ARRAY_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_ARRAY_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2245,6 +5942,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_UAV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("PlaneSlice");
+        FieldToJson(jdata, decoded_value.PlaneSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2259,6 +5976,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_ARRAY_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_ARRAY_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_ARRAY_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.Key("PlaneSlice");
+        FieldToJson(jdata, decoded_value.PlaneSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2270,6 +6011,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_UAV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("UnusedField_NothingToDefine");
+        FieldToJson(jdata, decoded_value.UnusedField_NothingToDefine, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2282,6 +6041,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_ARRAY_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_ARRAY_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_UAV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2295,6 +6074,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_UAV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX3D_UAV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX3D_UAV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX3D_UAV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstWSlice");
+        FieldToJson(jdata, decoded_value.FirstWSlice, options);
+        jdata.Key("WSize");
+        FieldToJson(jdata, decoded_value.WSize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2361,6 +6162,91 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_UNORDERED_AC
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_UNORDERED_ACCESS_VIEW_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ViewDimension");
+        FieldToJson(jdata, decoded_value.ViewDimension, options);
+        switch(decoded_value.ViewDimension)
+        {
+            case D3D12_UAV_DIMENSION_UNKNOWN:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Zero-valued ViewDimension is meaningless. Is struct corrupted?", options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_BUFFER:
+            {
+                jdata.Key("Buffer");
+                FieldToJson(jdata, meta_struct.Buffer, options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE1D:
+            {
+                jdata.Key("Texture1D");
+                FieldToJson(jdata, meta_struct.Texture1D, options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE1DARRAY:
+            {
+                jdata.Key("Texture1DArray");
+                FieldToJson(jdata, meta_struct.Texture1DArray, options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE2D:
+            {
+                jdata.Key("Texture2D");
+                FieldToJson(jdata, meta_struct.Texture2D, options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE2DARRAY:
+            {
+                jdata.Key("Texture2DArray");
+                FieldToJson(jdata, meta_struct.Texture2DArray, options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE2DMS:
+            {
+                jdata.Key("Texture2DMS");
+                FieldToJson(jdata, "Field missing from Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC.", options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE2DMSARRAY:
+            {
+                jdata.Key("Texture2DMSArray");
+                FieldToJson(jdata, "Field missing from Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC.", options);
+                break;
+            }
+            case D3D12_UAV_DIMENSION_TEXTURE3D:
+            {
+                jdata.Key("Texture3D");
+                FieldToJson(jdata, meta_struct.Texture3D, options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "ViewDimension with unknown value. Is struct corrupted?", options);
+                jdata.Key("Unknown value");
+                FieldToJson(jdata, uint32_t(decoded_value.ViewDimension), options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2373,6 +6259,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_RTV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUFFER_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUFFER_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUFFER_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstElement");
+        FieldToJson(jdata, decoded_value.FirstElement, options);
+        jdata.Key("NumElements");
+        FieldToJson(jdata, decoded_value.NumElements, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2384,6 +6290,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_RTV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2397,6 +6321,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_ARRAY_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_ARRAY_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_ARRAY_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2409,6 +6355,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_RTV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("PlaneSlice");
+        FieldToJson(jdata, decoded_value.PlaneSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2420,6 +6386,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_RTV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("UnusedField_NothingToDefine");
+        FieldToJson(jdata, decoded_value.UnusedField_NothingToDefine, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2434,6 +6418,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_ARRAY_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_ARRAY_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_ARRAY_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.Key("PlaneSlice");
+        FieldToJson(jdata, decoded_value.PlaneSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2446,6 +6454,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_ARRAY_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_ARRAY_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_RTV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2459,69 +6487,176 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_RTV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGET_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX3D_RTV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX3D_RTV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX3D_RTV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstWSlice");
+        FieldToJson(jdata, decoded_value.FirstWSlice, options);
+        jdata.Key("WSize");
+        FieldToJson(jdata, decoded_value.WSize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGET_VIEW_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_TARGET_VIEW_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_TARGET_VIEW_DESC& meta_struct = *data;
+        FieldToJson(jdata["Format"], decoded_value.Format, options);
+        FieldToJson(jdata["ViewDimension"], decoded_value.ViewDimension, options);
+        switch(decoded_value.ViewDimension)
+        {
+            case D3D12_RTV_DIMENSION_UNKNOWN:
+            {
+                FieldToJson(jdata[format::kNameWarning], "Zero D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC.", options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_BUFFER:
+            {
+                FieldToJson(jdata["Buffer"], meta_struct.Buffer, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE1D:
+            {
+                FieldToJson(jdata["Texture1D"], meta_struct.Texture1D, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE1DARRAY:
+            {
+                FieldToJson(jdata["Texture1DArray"], meta_struct.Texture1DArray, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE2D:
+            {
+                FieldToJson(jdata["Texture2D"], meta_struct.Texture2D, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE2DARRAY:
+            {
+                FieldToJson(jdata["Texture2DArray"], meta_struct.Texture2DArray, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE2DMS:
+            {
+                FieldToJson(jdata["Texture2DMS"], meta_struct.Texture2DMS, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY:
+            {
+                FieldToJson(jdata["Texture2DMSArray"], meta_struct.Texture2DMSArray, options);
+                break;
+            }
+            case D3D12_RTV_DIMENSION_TEXTURE3D:
+            {
+                FieldToJson(jdata["Texture3D"], meta_struct.Texture3D, options);
+                break;
+            }
+            default:
+            {
+                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC. Corrupt struct?", options);
+                FieldToJson(jdata["Unknown value"], uint32_t(decoded_value.ViewDimension), options);
+                break;
+            }
+        }
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_TARGET_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_RENDER_TARGET_VIEW_DESC& decoded_value = *data->decoded_value;
         const Decoded_D3D12_RENDER_TARGET_VIEW_DESC& meta_struct = *data;
-        FieldToJson(jdata["Format"], decoded_value.Format, options);
-        FieldToJson(jdata["ViewDimension"], decoded_value.ViewDimension, options);
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ViewDimension");
+        FieldToJson(jdata, decoded_value.ViewDimension, options);
         switch(decoded_value.ViewDimension)
         {
             case D3D12_RTV_DIMENSION_UNKNOWN:
             {
-                FieldToJson(jdata[format::kNameWarning], "Zero D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC.", options);
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Zero D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC.", options);
                 break;
             }
             case D3D12_RTV_DIMENSION_BUFFER:
             {
-                FieldToJson(jdata["Buffer"], meta_struct.Buffer, options);
+                jdata.Key("Buffer");
+                FieldToJson(jdata, meta_struct.Buffer, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE1D:
             {
-                FieldToJson(jdata["Texture1D"], meta_struct.Texture1D, options);
+                jdata.Key("Texture1D");
+                FieldToJson(jdata, meta_struct.Texture1D, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE1DARRAY:
             {
-                FieldToJson(jdata["Texture1DArray"], meta_struct.Texture1DArray, options);
+                jdata.Key("Texture1DArray");
+                FieldToJson(jdata, meta_struct.Texture1DArray, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE2D:
             {
-                FieldToJson(jdata["Texture2D"], meta_struct.Texture2D, options);
+                jdata.Key("Texture2D");
+                FieldToJson(jdata, meta_struct.Texture2D, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE2DARRAY:
             {
-                FieldToJson(jdata["Texture2DArray"], meta_struct.Texture2DArray, options);
+                jdata.Key("Texture2DArray");
+                FieldToJson(jdata, meta_struct.Texture2DArray, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE2DMS:
             {
-                FieldToJson(jdata["Texture2DMS"], meta_struct.Texture2DMS, options);
+                jdata.Key("Texture2DMS");
+                FieldToJson(jdata, meta_struct.Texture2DMS, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY:
             {
-                FieldToJson(jdata["Texture2DMSArray"], meta_struct.Texture2DMSArray, options);
+                jdata.Key("Texture2DMSArray");
+                FieldToJson(jdata, meta_struct.Texture2DMSArray, options);
                 break;
             }
             case D3D12_RTV_DIMENSION_TEXTURE3D:
             {
-                FieldToJson(jdata["Texture3D"], meta_struct.Texture3D, options);
+                jdata.Key("Texture3D");
+                FieldToJson(jdata, meta_struct.Texture3D, options);
                 break;
             }
             default:
             {
-                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC. Corrupt struct?", options);
-                FieldToJson(jdata["Unknown value"], uint32_t(decoded_value.ViewDimension), options);
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC. Corrupt struct?", options);
+                jdata.Key("Unknown value");
+                FieldToJson(jdata, uint32_t(decoded_value.ViewDimension), options);
                 break;
             }
         }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
@@ -2536,6 +6671,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_DSV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_DSV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_DSV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_DSV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_DSV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2549,6 +6702,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX1D_ARRAY_DSV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX1D_ARRAY_DSV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX1D_ARRAY_DSV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_DSV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2560,6 +6735,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_DSV* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_DSV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_DSV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_DSV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_DSV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2573,6 +6766,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2D_ARRAY_DSV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2D_ARRAY_DSV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2D_ARRAY_DSV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MipSlice");
+        FieldToJson(jdata, decoded_value.MipSlice, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_DSV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2584,6 +6799,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_DSV*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_DSV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_DSV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_DSV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("UnusedField_NothingToDefine");
+        FieldToJson(jdata, decoded_value.UnusedField_NothingToDefine, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_DSV* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2596,6 +6829,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_DSV* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEX2DMS_ARRAY_DSV& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEX2DMS_ARRAY_DSV& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("ArraySize");
+        FieldToJson(jdata, decoded_value.ArraySize, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2653,6 +6906,81 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEPTH_STENCIL_VIEW_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ViewDimension");
+        FieldToJson(jdata, decoded_value.ViewDimension, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_DSV_FLAGS(jdata, decoded_value.Flags, options);
+        switch(decoded_value.ViewDimension)
+        {
+            case D3D12_DSV_DIMENSION_UNKNOWN:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Zero D3D12_DSV_DIMENSION in D3D12_DEPTH_STENCIL_VIEW_DESC.", options);
+                break;
+            }
+            case D3D12_DSV_DIMENSION_TEXTURE1D:
+            {
+                jdata.Key("Texture1D");
+                FieldToJson(jdata, meta_struct.Texture1D, options);
+                break;
+            }
+            case D3D12_DSV_DIMENSION_TEXTURE1DARRAY:
+            {
+                jdata.Key("Texture1DArray");
+                FieldToJson(jdata, meta_struct.Texture1DArray, options);
+                break;
+            }
+            case D3D12_DSV_DIMENSION_TEXTURE2D:
+            {
+                jdata.Key("Texture2D");
+                FieldToJson(jdata, meta_struct.Texture2D, options);
+                break;
+            }
+            case D3D12_DSV_DIMENSION_TEXTURE2DARRAY:
+            {
+                jdata.Key("Texture2DArray");
+                FieldToJson(jdata, meta_struct.Texture2DArray, options);
+                break;
+            }
+            case D3D12_DSV_DIMENSION_TEXTURE2DMS:
+            {
+                jdata.Key("Texture2DMS");
+                FieldToJson(jdata, meta_struct.Texture2DMS, options);
+                break;
+            }
+            case D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY:
+            {
+                jdata.Key("Texture2DMSArray");
+                FieldToJson(jdata, meta_struct.Texture2DMSArray, options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_DSV_DIMENSION in D3D12_DEPTH_STENCIL_VIEW_DESC. Corrupt struct?", options);
+                jdata.Key("Unknown value");
+                FieldToJson(jdata, uint32_t(decoded_value.ViewDimension), options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_HEAP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2667,6 +6995,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_H
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DESCRIPTOR_HEAP_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DESCRIPTOR_HEAP_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DESCRIPTOR_HEAP_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("NumDescriptors");
+        FieldToJson(jdata, decoded_value.NumDescriptors, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_DESCRIPTOR_HEAP_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2682,6 +7034,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_R
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DESCRIPTOR_RANGE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DESCRIPTOR_RANGE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RangeType");
+        FieldToJson(jdata, decoded_value.RangeType, options);
+        jdata.Key("NumDescriptors");
+        FieldToJson(jdata, decoded_value.NumDescriptors, options);
+        jdata.Key("BaseShaderRegister");
+        FieldToJson(jdata, decoded_value.BaseShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.Key("OffsetInDescriptorsFromTableStart");
+        FieldToJson(jdata, decoded_value.OffsetInDescriptorsFromTableStart, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2694,6 +7072,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_DESCRIPTOR_TABLE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumDescriptorRanges");
+        FieldToJson(jdata, decoded_value.NumDescriptorRanges, options);
+        jdata.Key("pDescriptorRanges");
+        FieldToJson(jdata, meta_struct.pDescriptorRanges, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_CONSTANTS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2707,6 +7105,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_CONSTAN
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_CONSTANTS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_CONSTANTS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_CONSTANTS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ShaderRegister");
+        FieldToJson(jdata, decoded_value.ShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.Key("Num32BitValues");
+        FieldToJson(jdata, decoded_value.Num32BitValues, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2719,6 +7139,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_DESCRIPTOR& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_DESCRIPTOR& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ShaderRegister");
+        FieldToJson(jdata, decoded_value.ShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMETER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2751,6 +7191,49 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMET
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_PARAMETER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_PARAMETER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_PARAMETER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ParameterType");
+        FieldToJson(jdata, decoded_value.ParameterType, options);
+        switch(decoded_value.ParameterType)
+        {
+            case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+            {
+                jdata.Key("DescriptorTable");
+                FieldToJson(jdata, meta_struct.DescriptorTable, options);
+                break;
+            }
+            case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+            {
+                jdata.Key("Constants");
+                FieldToJson(jdata, meta_struct.Constants, options);
+                break;
+            }
+            case D3D12_ROOT_PARAMETER_TYPE_CBV:
+            case D3D12_ROOT_PARAMETER_TYPE_SRV:
+            case D3D12_ROOT_PARAMETER_TYPE_UAV:
+            {
+                jdata.Key("Descriptor");
+                FieldToJson(jdata, meta_struct.Descriptor, options);
+                break;
+            }
+        }
+        jdata.Key("ShaderVisibility");
+        FieldToJson(jdata, decoded_value.ShaderVisibility, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2774,6 +7257,48 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STATIC_SAMPLER_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STATIC_SAMPLER_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Filter");
+        FieldToJson(jdata, decoded_value.Filter, options);
+        jdata.Key("AddressU");
+        FieldToJson(jdata, decoded_value.AddressU, options);
+        jdata.Key("AddressV");
+        FieldToJson(jdata, decoded_value.AddressV, options);
+        jdata.Key("AddressW");
+        FieldToJson(jdata, decoded_value.AddressW, options);
+        jdata.Key("MipLODBias");
+        FieldToJson(jdata, decoded_value.MipLODBias, options);
+        jdata.Key("MaxAnisotropy");
+        FieldToJson(jdata, decoded_value.MaxAnisotropy, options);
+        jdata.Key("ComparisonFunc");
+        FieldToJson(jdata, decoded_value.ComparisonFunc, options);
+        jdata.Key("BorderColor");
+        FieldToJson(jdata, decoded_value.BorderColor, options);
+        jdata.Key("MinLOD");
+        FieldToJson(jdata, decoded_value.MinLOD, options);
+        jdata.Key("MaxLOD");
+        FieldToJson(jdata, decoded_value.MaxLOD, options);
+        jdata.Key("ShaderRegister");
+        FieldToJson(jdata, decoded_value.ShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.Key("ShaderVisibility");
+        FieldToJson(jdata, decoded_value.ShaderVisibility, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2798,18 +7323,88 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STATIC_SAMPLER_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STATIC_SAMPLER_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Filter");
+        FieldToJson(jdata, decoded_value.Filter, options);
+        jdata.Key("AddressU");
+        FieldToJson(jdata, decoded_value.AddressU, options);
+        jdata.Key("AddressV");
+        FieldToJson(jdata, decoded_value.AddressV, options);
+        jdata.Key("AddressW");
+        FieldToJson(jdata, decoded_value.AddressW, options);
+        jdata.Key("MipLODBias");
+        FieldToJson(jdata, decoded_value.MipLODBias, options);
+        jdata.Key("MaxAnisotropy");
+        FieldToJson(jdata, decoded_value.MaxAnisotropy, options);
+        jdata.Key("ComparisonFunc");
+        FieldToJson(jdata, decoded_value.ComparisonFunc, options);
+        jdata.Key("BorderColor");
+        FieldToJson(jdata, decoded_value.BorderColor, options);
+        jdata.Key("MinLOD");
+        FieldToJson(jdata, decoded_value.MinLOD, options);
+        jdata.Key("MaxLOD");
+        FieldToJson(jdata, decoded_value.MaxLOD, options);
+        jdata.Key("ShaderRegister");
+        FieldToJson(jdata, decoded_value.ShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.Key("ShaderVisibility");
+        FieldToJson(jdata, decoded_value.ShaderVisibility, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_SAMPLER_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_SIGNATURE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_SIGNATURE_DESC& meta_struct = *data;
+        FieldToJson(jdata["NumParameters"], decoded_value.NumParameters, options);
+        FieldToJson(jdata["pParameters"], meta_struct.pParameters, options);
+        FieldToJson(jdata["NumStaticSamplers"], decoded_value.NumStaticSamplers, options);
+        FieldToJson(jdata["pStaticSamplers"], meta_struct.pStaticSamplers, options);
+        FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(jdata["Flags"], decoded_value.Flags, options);
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_ROOT_SIGNATURE_DESC& decoded_value = *data->decoded_value;
         const Decoded_D3D12_ROOT_SIGNATURE_DESC& meta_struct = *data;
-        FieldToJson(jdata["NumParameters"], decoded_value.NumParameters, options);
-        FieldToJson(jdata["pParameters"], meta_struct.pParameters, options);
-        FieldToJson(jdata["NumStaticSamplers"], decoded_value.NumStaticSamplers, options);
-        FieldToJson(jdata["pStaticSamplers"], meta_struct.pStaticSamplers, options);
-        FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(jdata["Flags"], decoded_value.Flags, options);
+        jdata.BeginObject();
+        jdata.Key("NumParameters");
+        FieldToJson(jdata, decoded_value.NumParameters, options);
+        jdata.Key("pParameters");
+        FieldToJson(jdata, meta_struct.pParameters, options);
+        jdata.Key("NumStaticSamplers");
+        FieldToJson(jdata, decoded_value.NumStaticSamplers, options);
+        jdata.Key("pStaticSamplers");
+        FieldToJson(jdata, meta_struct.pStaticSamplers, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
@@ -2829,6 +7424,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_R
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DESCRIPTOR_RANGE1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DESCRIPTOR_RANGE1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RangeType");
+        FieldToJson(jdata, decoded_value.RangeType, options);
+        jdata.Key("NumDescriptors");
+        FieldToJson(jdata, decoded_value.NumDescriptors, options);
+        jdata.Key("BaseShaderRegister");
+        FieldToJson(jdata, decoded_value.BaseShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_DESCRIPTOR_RANGE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("OffsetInDescriptorsFromTableStart");
+        FieldToJson(jdata, decoded_value.OffsetInDescriptorsFromTableStart, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2841,6 +7464,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_DESCRIPTOR_TABLE1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumDescriptorRanges");
+        FieldToJson(jdata, decoded_value.NumDescriptorRanges, options);
+        jdata.Key("pDescriptorRanges");
+        FieldToJson(jdata, meta_struct.pDescriptorRanges, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2854,6 +7497,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_DESCRIPTOR1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_DESCRIPTOR1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ShaderRegister");
+        FieldToJson(jdata, decoded_value.ShaderRegister, options);
+        jdata.Key("RegisterSpace");
+        FieldToJson(jdata, decoded_value.RegisterSpace, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_ROOT_DESCRIPTOR_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMETER1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2892,6 +7557,57 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMET
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_PARAMETER1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_PARAMETER1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_PARAMETER1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ParameterType");
+        FieldToJson(jdata, decoded_value.ParameterType, options);
+        switch (decoded_value.ParameterType)
+        {
+            case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+            {
+                jdata.Key("DescriptorTable");
+                FieldToJson(jdata, meta_struct.DescriptorTable, options);
+                break;
+            }
+            case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+            {
+                jdata.Key("Constants");
+                FieldToJson(jdata, meta_struct.Constants, options);
+                break;
+            }
+            case D3D12_ROOT_PARAMETER_TYPE_CBV:
+            case D3D12_ROOT_PARAMETER_TYPE_SRV:
+            case D3D12_ROOT_PARAMETER_TYPE_UAV:
+            {
+                jdata.Key("Descriptor");
+                FieldToJson(jdata, meta_struct.Descriptor, options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_ROOT_PARAMETER_TYPE in D3D12_ROOT_PARAMETER1.", options);
+                jdata.Key("Unknown value");
+                FieldToJson(jdata, uint32_t(decoded_value.ParameterType), options);
+                break;
+            }
+        }
+        jdata.Key("ShaderVisibility");
+        FieldToJson(jdata, decoded_value.ShaderVisibility, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2907,6 +7623,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATU
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_SIGNATURE_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_SIGNATURE_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumParameters");
+        FieldToJson(jdata, decoded_value.NumParameters, options);
+        jdata.Key("pParameters");
+        FieldToJson(jdata, meta_struct.pParameters, options);
+        jdata.Key("NumStaticSamplers");
+        FieldToJson(jdata, decoded_value.NumStaticSamplers, options);
+        jdata.Key("pStaticSamplers");
+        FieldToJson(jdata, meta_struct.pStaticSamplers, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2922,6 +7664,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATU
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_ROOT_SIGNATURE_DESC2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_ROOT_SIGNATURE_DESC2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumParameters");
+        FieldToJson(jdata, decoded_value.NumParameters, options);
+        jdata.Key("pParameters");
+        FieldToJson(jdata, meta_struct.pParameters, options);
+        jdata.Key("NumStaticSamplers");
+        FieldToJson(jdata, decoded_value.NumStaticSamplers, options);
+        jdata.Key("pStaticSamplers");
+        FieldToJson(jdata, meta_struct.pStaticSamplers, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2957,6 +7725,51 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_RO
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_VERSIONED_ROOT_SIGNATURE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Version");
+        FieldToJson(jdata, decoded_value.Version, options);
+        switch (decoded_value.Version)
+        {
+            case D3D_ROOT_SIGNATURE_VERSION_1_0:
+            {
+                jdata.Key("Desc_1_0");
+                FieldToJson(jdata, meta_struct.Desc_1_0, options);
+                break;
+            }
+            case D3D_ROOT_SIGNATURE_VERSION_1_1:
+            {
+                jdata.Key("Desc_1_1");
+                FieldToJson(jdata, meta_struct.Desc_1_1, options);
+                break;
+            }
+            case D3D_ROOT_SIGNATURE_VERSION_1_2:
+            {
+                /// @todo Uncomment this once the union member is added to the decoded struct: FieldToJson(jdata["Desc_1_2"], meta_struct.Desc_1_2, options);
+                GFXRECON_LOG_ERROR("Unknown D3D_ROOT_SIGNATURE_VERSION_1_2 in D3D12_VERSIONED_ROOT_SIGNATURE_DESC.");
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D_ROOT_SIGNATURE_VERSION in D3D12_VERSIONED_ROOT_SIGNATURE_DESC.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2968,6 +7781,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_DESCRIPT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GPU_DESCRIPTOR_HANDLE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GPU_DESCRIPTOR_HANDLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ptr");
+        FieldToJson(jdata, decoded_value.ptr, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISCARD_REGION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2982,6 +7813,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISCARD_REGI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DISCARD_REGION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DISCARD_REGION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DISCARD_REGION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumRects");
+        FieldToJson(jdata, decoded_value.NumRects, options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, meta_struct.pRects, options);
+        jdata.Key("FirstSubresource");
+        FieldToJson(jdata, decoded_value.FirstSubresource, options);
+        jdata.Key("NumSubresources");
+        FieldToJson(jdata, decoded_value.NumSubresources, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_HEAP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -2995,6 +7850,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_HEAP_D
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_QUERY_HEAP_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_QUERY_HEAP_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_QUERY_HEAP_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Count");
+        FieldToJson(jdata, decoded_value.Count, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3016,6 +7893,44 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_P
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_QUERY_DATA_PIPELINE_STATISTICS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("IAVertices");
+        FieldToJson(jdata, decoded_value.IAVertices, options);
+        jdata.Key("IAPrimitives");
+        FieldToJson(jdata, decoded_value.IAPrimitives, options);
+        jdata.Key("VSInvocations");
+        FieldToJson(jdata, decoded_value.VSInvocations, options);
+        jdata.Key("GSInvocations");
+        FieldToJson(jdata, decoded_value.GSInvocations, options);
+        jdata.Key("GSPrimitives");
+        FieldToJson(jdata, decoded_value.GSPrimitives, options);
+        jdata.Key("CInvocations");
+        FieldToJson(jdata, decoded_value.CInvocations, options);
+        jdata.Key("CPrimitives");
+        FieldToJson(jdata, decoded_value.CPrimitives, options);
+        jdata.Key("PSInvocations");
+        FieldToJson(jdata, decoded_value.PSInvocations, options);
+        jdata.Key("HSInvocations");
+        FieldToJson(jdata, decoded_value.HSInvocations, options);
+        jdata.Key("DSInvocations");
+        FieldToJson(jdata, decoded_value.DSInvocations, options);
+        jdata.Key("CSInvocations");
+        FieldToJson(jdata, decoded_value.CSInvocations, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3040,6 +7955,50 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_P
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_QUERY_DATA_PIPELINE_STATISTICS1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("IAVertices");
+        FieldToJson(jdata, decoded_value.IAVertices, options);
+        jdata.Key("IAPrimitives");
+        FieldToJson(jdata, decoded_value.IAPrimitives, options);
+        jdata.Key("VSInvocations");
+        FieldToJson(jdata, decoded_value.VSInvocations, options);
+        jdata.Key("GSInvocations");
+        FieldToJson(jdata, decoded_value.GSInvocations, options);
+        jdata.Key("GSPrimitives");
+        FieldToJson(jdata, decoded_value.GSPrimitives, options);
+        jdata.Key("CInvocations");
+        FieldToJson(jdata, decoded_value.CInvocations, options);
+        jdata.Key("CPrimitives");
+        FieldToJson(jdata, decoded_value.CPrimitives, options);
+        jdata.Key("PSInvocations");
+        FieldToJson(jdata, decoded_value.PSInvocations, options);
+        jdata.Key("HSInvocations");
+        FieldToJson(jdata, decoded_value.HSInvocations, options);
+        jdata.Key("DSInvocations");
+        FieldToJson(jdata, decoded_value.DSInvocations, options);
+        jdata.Key("CSInvocations");
+        FieldToJson(jdata, decoded_value.CSInvocations, options);
+        jdata.Key("ASInvocations");
+        FieldToJson(jdata, decoded_value.ASInvocations, options);
+        jdata.Key("MSInvocations");
+        FieldToJson(jdata, decoded_value.MSInvocations, options);
+        jdata.Key("MSPrimitives");
+        FieldToJson(jdata, decoded_value.MSPrimitives, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_SO_STATISTICS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3052,6 +8011,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_S
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_QUERY_DATA_SO_STATISTICS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_QUERY_DATA_SO_STATISTICS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_QUERY_DATA_SO_STATISTICS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumPrimitivesWritten");
+        FieldToJson(jdata, decoded_value.NumPrimitivesWritten, options);
+        jdata.Key("PrimitivesStorageNeeded");
+        FieldToJson(jdata, decoded_value.PrimitivesStorageNeeded, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPUT_BUFFER_VIEW* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3065,6 +8044,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPU
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STREAM_OUTPUT_BUFFER_VIEW* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STREAM_OUTPUT_BUFFER_VIEW& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STREAM_OUTPUT_BUFFER_VIEW& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, decoded_value.BufferLocation, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key("BufferFilledSizeLocation");
+        FieldToJsonAsHex(jdata, decoded_value.BufferFilledSizeLocation, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3079,6 +8080,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_ARGUMEN
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRAW_ARGUMENTS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRAW_ARGUMENTS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRAW_ARGUMENTS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("VertexCountPerInstance");
+        FieldToJson(jdata, decoded_value.VertexCountPerInstance, options);
+        jdata.Key("InstanceCount");
+        FieldToJson(jdata, decoded_value.InstanceCount, options);
+        jdata.Key("StartVertexLocation");
+        FieldToJson(jdata, decoded_value.StartVertexLocation, options);
+        jdata.Key("StartInstanceLocation");
+        FieldToJson(jdata, decoded_value.StartInstanceLocation, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_INDEXED_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3094,6 +8119,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_INDEXED
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRAW_INDEXED_ARGUMENTS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRAW_INDEXED_ARGUMENTS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRAW_INDEXED_ARGUMENTS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("IndexCountPerInstance");
+        FieldToJson(jdata, decoded_value.IndexCountPerInstance, options);
+        jdata.Key("InstanceCount");
+        FieldToJson(jdata, decoded_value.InstanceCount, options);
+        jdata.Key("StartIndexLocation");
+        FieldToJson(jdata, decoded_value.StartIndexLocation, options);
+        jdata.Key("BaseVertexLocation");
+        FieldToJson(jdata, decoded_value.BaseVertexLocation, options);
+        jdata.Key("StartInstanceLocation");
+        FieldToJson(jdata, decoded_value.StartInstanceLocation, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3107,6 +8158,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_ARG
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DISPATCH_ARGUMENTS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DISPATCH_ARGUMENTS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DISPATCH_ARGUMENTS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ThreadGroupCountX");
+        FieldToJson(jdata, decoded_value.ThreadGroupCountX, options);
+        jdata.Key("ThreadGroupCountY");
+        FieldToJson(jdata, decoded_value.ThreadGroupCountY, options);
+        jdata.Key("ThreadGroupCountZ");
+        FieldToJson(jdata, decoded_value.ThreadGroupCountZ, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERTEX_BUFFER_VIEW* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3120,6 +8193,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERTEX_BUFFE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_VERTEX_BUFFER_VIEW* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_VERTEX_BUFFER_VIEW& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_VERTEX_BUFFER_VIEW& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, decoded_value.BufferLocation, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key("StrideInBytes");
+        FieldToJson(jdata, decoded_value.StrideInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDEX_BUFFER_VIEW* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3133,6 +8228,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDEX_BUFFER
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_INDEX_BUFFER_VIEW* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_INDEX_BUFFER_VIEW& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_INDEX_BUFFER_VIEW& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BufferLocation");
+        FieldToJsonAsHex(jdata, decoded_value.BufferLocation, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDIRECT_ARGUMENT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3203,6 +8320,102 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDIRECT_ARG
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_INDIRECT_ARGUMENT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_INDIRECT_ARGUMENT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_INDIRECT_ARGUMENT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        switch (decoded_value.Type)
+        {
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DRAW:
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED:
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH:
+            {
+                // No data to output for draws and dispatches, they are parameterless tags.
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW:
+            {
+                jdata.Key("VertexBuffer");
+                jdata.BeginObject();
+                jdata.Key("Slot");
+                FieldToJson(jdata, decoded_value.VertexBuffer.Slot, options);
+                jdata.EndObject();
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW:
+            {
+                // No parameters to output.
+                jdata.Key("comment");
+                FieldToJson(jdata, "There must be a D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED in the same sequence.", options);
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT:
+            {
+                jdata.Key("Constant");
+                jdata.BeginObject();
+                jdata.Key("RootParameterIndex");
+                FieldToJson(jdata, decoded_value.Constant.RootParameterIndex, options);
+                jdata.Key("DestOffsetIn32BitValues");
+                FieldToJson(jdata, decoded_value.Constant.DestOffsetIn32BitValues, options);
+                jdata.Key("Num32BitValuesToSet");
+                FieldToJson(jdata, decoded_value.Constant.Num32BitValuesToSet, options);
+                jdata.EndObject();
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW:
+            {
+                jdata.Key("ConstantBufferView");
+                jdata.BeginObject();
+                jdata.Key("RootParameterIndex");
+                FieldToJson(jdata, decoded_value.ConstantBufferView.RootParameterIndex, options);
+                jdata.EndObject();
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_SHADER_RESOURCE_VIEW:
+            {
+                jdata.Key("ShaderResourceView");
+                jdata.BeginObject();
+                jdata.Key("RootParameterIndex");
+                FieldToJson(jdata, decoded_value.ShaderResourceView.RootParameterIndex, options);
+                jdata.EndObject();
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_UNORDERED_ACCESS_VIEW:
+            {
+                jdata.Key("UnorderedAccessView");
+                jdata.BeginObject();
+                jdata.Key("RootParameterIndex");
+                FieldToJson(jdata, decoded_value.UnorderedAccessView.RootParameterIndex, options);
+                jdata.EndObject();
+                break;
+            }
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_RAYS:
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH:
+            {
+                // No data to output for draws and dispatches, they are parameterless tags.
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_INDIRECT_ARGUMENT_TYPE in D3D12_INDIRECT_ARGUMENT_DESC.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_SIGNATURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3217,6 +8430,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_SIGN
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_COMMAND_SIGNATURE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_COMMAND_SIGNATURE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_COMMAND_SIGNATURE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ByteStride");
+        FieldToJson(jdata, decoded_value.ByteStride, options);
+        jdata.Key("NumArgumentDescs");
+        FieldToJson(jdata, decoded_value.NumArgumentDescs, options);
+        jdata.Key("pArgumentDescs");
+        FieldToJson(jdata, meta_struct.pArgumentDescs, options);
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_WRITEBUFFERIMMEDIATE_PARAMETER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3229,6 +8466,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_WRITEBUFFERI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_WRITEBUFFERIMMEDIATE_PARAMETER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_WRITEBUFFERIMMEDIATE_PARAMETER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_WRITEBUFFERIMMEDIATE_PARAMETER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Dest");
+        FieldToJsonAsHex(jdata, decoded_value.Dest, options);
+        jdata.Key("Value");
+        FieldToJson(jdata, decoded_value.Value, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3241,6 +8498,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, decoded_value.NodeIndex, options);
+        jdata.Key("Support");
+        FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS(jdata, decoded_value.Support, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3253,6 +8530,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_PROTECTED_RESOURCE_SESSION_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND_PARAMETER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3268,6 +8565,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_META_COMMAND_PARAMETER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_META_COMMAND_PARAMETER_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_META_COMMAND_PARAMETER_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Name");
+        FieldToJson(jdata, meta_struct.Name, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_META_COMMAND_PARAMETER_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("RequiredResourceState");
+        FieldToJson_D3D12_RESOURCE_STATES(jdata, decoded_value.RequiredResourceState, options);
+        jdata.Key("StructureOffset");
+        FieldToJson(jdata, decoded_value.StructureOffset, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3282,6 +8605,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_META_COMMAND_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_META_COMMAND_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_META_COMMAND_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Id");
+        FieldToJson(jdata, meta_struct.Id, options);
+        jdata.Key("Name");
+        FieldToJson(jdata, meta_struct.Name, options);
+        jdata.Key("InitializationDirtyState");
+        FieldToJson_D3D12_GRAPHICS_STATES(jdata, decoded_value.InitializationDirtyState, options);
+        jdata.Key("ExecutionDirtyState");
+        FieldToJson_D3D12_GRAPHICS_STATES(jdata, decoded_value.ExecutionDirtyState, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT_CONFIG* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3293,6 +8640,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STATE_OBJECT_CONFIG* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STATE_OBJECT_CONFIG& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STATE_OBJECT_CONFIG& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Flags");
+        FieldToJson_D3D12_STATE_OBJECT_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_ROOT_SIGNATURE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3304,6 +8669,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_ROOT_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GLOBAL_ROOT_SIGNATURE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GLOBAL_ROOT_SIGNATURE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GLOBAL_ROOT_SIGNATURE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pGlobalRootSignature");
+        FieldToJson(jdata, meta_struct.pGlobalRootSignature, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_LOCAL_ROOT_SIGNATURE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3315,6 +8698,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_LOCAL_ROOT_S
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_LOCAL_ROOT_SIGNATURE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_LOCAL_ROOT_SIGNATURE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_LOCAL_ROOT_SIGNATURE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pLocalRootSignature");
+        FieldToJson(jdata, meta_struct.pLocalRootSignature, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_NODE_MASK* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3326,6 +8727,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_NODE_MASK* d
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_NODE_MASK* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_NODE_MASK& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_NODE_MASK& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXPORT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3339,6 +8758,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXPORT_DESC*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_EXPORT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_EXPORT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_EXPORT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Name");
+        FieldToJson(jdata, meta_struct.Name, options);
+        jdata.Key("ExportToRename");
+        FieldToJson(jdata, meta_struct.ExportToRename, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_EXPORT_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_LIBRARY_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3352,6 +8793,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_LIBRARY
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DXIL_LIBRARY_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DXIL_LIBRARY_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DXIL_LIBRARY_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DXILLibrary");
+        FieldToJson(jdata, meta_struct.DXILLibrary, options);
+        jdata.Key("NumExports");
+        FieldToJson(jdata, decoded_value.NumExports, options);
+        jdata.Key("pExports");
+        FieldToJson(jdata, meta_struct.pExports, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXISTING_COLLECTION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3365,6 +8828,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXISTING_COL
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_EXISTING_COLLECTION_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_EXISTING_COLLECTION_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_EXISTING_COLLECTION_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pExistingCollection");
+        FieldToJson(jdata, meta_struct.pExistingCollection, options);
+        jdata.Key("NumExports");
+        FieldToJson(jdata, decoded_value.NumExports, options);
+        jdata.Key("pExports");
+        FieldToJson(jdata, meta_struct.pExports, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3378,6 +8863,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBOBJECT_TO
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pSubobjectToAssociate");
+        FieldToJson(jdata, meta_struct.pSubobjectToAssociate, options);
+        jdata.Key("NumExports");
+        FieldToJson(jdata, decoded_value.NumExports, options);
+        jdata.Key("pExports");
+        FieldToJson(jdata, meta_struct.pExports, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3391,6 +8898,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_SUBOBJE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SubobjectToAssociate");
+        FieldToJson(jdata, meta_struct.SubobjectToAssociate, options);
+        jdata.Key("NumExports");
+        FieldToJson(jdata, decoded_value.NumExports, options);
+        jdata.Key("pExports");
+        FieldToJson(jdata, meta_struct.pExports, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HIT_GROUP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3406,26 +8935,90 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HIT_GROUP_DE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_HIT_GROUP_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_HIT_GROUP_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_HIT_GROUP_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("HitGroupExport");
+        FieldToJson(jdata, meta_struct.HitGroupExport, options);
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("AnyHitShaderImport");
+        FieldToJson(jdata, meta_struct.AnyHitShaderImport, options);
+        jdata.Key("ClosestHitShaderImport");
+        FieldToJson(jdata, meta_struct.ClosestHitShaderImport, options);
+        jdata.Key("IntersectionShaderImport");
+        FieldToJson(jdata, meta_struct.IntersectionShaderImport, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_SHADER_CONFIG* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
-        const D3D12_RAYTRACING_SHADER_CONFIG& decoded_value = *data->decoded_value;
-        const Decoded_D3D12_RAYTRACING_SHADER_CONFIG& meta_struct = *data;
-        FieldToJson(jdata["MaxPayloadSizeInBytes"], decoded_value.MaxPayloadSizeInBytes, options);
-        FieldToJson(jdata["MaxAttributeSizeInBytes"], decoded_value.MaxAttributeSizeInBytes, options);
+        const D3D12_RAYTRACING_SHADER_CONFIG& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_SHADER_CONFIG& meta_struct = *data;
+        FieldToJson(jdata["MaxPayloadSizeInBytes"], decoded_value.MaxPayloadSizeInBytes, options);
+        FieldToJson(jdata["MaxAttributeSizeInBytes"], decoded_value.MaxAttributeSizeInBytes, options);
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_SHADER_CONFIG* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_SHADER_CONFIG& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_SHADER_CONFIG& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MaxPayloadSizeInBytes");
+        FieldToJson(jdata, decoded_value.MaxPayloadSizeInBytes, options);
+        jdata.Key("MaxAttributeSizeInBytes");
+        FieldToJson(jdata, decoded_value.MaxAttributeSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_PIPELINE_CONFIG& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG& meta_struct = *data;
+        FieldToJson(jdata["MaxTraceRecursionDepth"], decoded_value.MaxTraceRecursionDepth, options);
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_RAYTRACING_PIPELINE_CONFIG& decoded_value = *data->decoded_value;
         const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG& meta_struct = *data;
-        FieldToJson(jdata["MaxTraceRecursionDepth"], decoded_value.MaxTraceRecursionDepth, options);
+        jdata.BeginObject();
+        jdata.Key("MaxTraceRecursionDepth");
+        FieldToJson(jdata, decoded_value.MaxTraceRecursionDepth, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
@@ -3441,6 +9034,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_P
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_PIPELINE_CONFIG1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MaxTraceRecursionDepth");
+        FieldToJson(jdata, decoded_value.MaxTraceRecursionDepth, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RAYTRACING_PIPELINE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3454,6 +9067,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STATE_OBJECT_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STATE_OBJECT_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STATE_OBJECT_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("NumSubobjects");
+        FieldToJson(jdata, decoded_value.NumSubobjects, options);
+        jdata.Key("pSubobjects");
+        FieldToJson(jdata, meta_struct.pSubobjects, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_AND_STRIDE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3466,6 +9101,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_AND_STRIDE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GPU_VIRTUAL_ADDRESS_AND_STRIDE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_AND_STRIDE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("StartAddress");
+        FieldToJsonAsHex(jdata, decoded_value.StartAddress, options);
+        jdata.Key("StrideInBytes");
+        FieldToJson(jdata, decoded_value.StrideInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3478,6 +9133,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GPU_VIRTUAL_ADDRESS_RANGE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("StartAddress");
+        FieldToJsonAsHex(jdata, decoded_value.StartAddress, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3491,6 +9166,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("StartAddress");
+        FieldToJsonAsHex(jdata, decoded_value.StartAddress, options);
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key("StrideInBytes");
+        FieldToJson(jdata, decoded_value.StrideInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3508,6 +9205,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_G
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Transform3x4");
+        FieldToJsonAsHex(jdata, decoded_value.Transform3x4, options);
+        jdata.Key("IndexFormat");
+        FieldToJson(jdata, decoded_value.IndexFormat, options);
+        jdata.Key("VertexFormat");
+        FieldToJson(jdata, decoded_value.VertexFormat, options);
+        jdata.Key("IndexCount");
+        FieldToJson(jdata, decoded_value.IndexCount, options);
+        jdata.Key("VertexCount");
+        FieldToJson(jdata, decoded_value.VertexCount, options);
+        jdata.Key("IndexBuffer");
+        FieldToJsonAsHex(jdata, decoded_value.IndexBuffer, options);
+        jdata.Key("VertexBuffer");
+        FieldToJson(jdata, meta_struct.VertexBuffer, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_AABB* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3524,6 +9251,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_AABB* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_AABB& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_AABB& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MinX");
+        FieldToJson(jdata, decoded_value.MinX, options);
+        jdata.Key("MinY");
+        FieldToJson(jdata, decoded_value.MinY, options);
+        jdata.Key("MinZ");
+        FieldToJson(jdata, decoded_value.MinZ, options);
+        jdata.Key("MaxX");
+        FieldToJson(jdata, decoded_value.MaxX, options);
+        jdata.Key("MaxY");
+        FieldToJson(jdata, decoded_value.MaxY, options);
+        jdata.Key("MaxZ");
+        FieldToJson(jdata, decoded_value.MaxZ, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_AABBS_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3536,6 +9291,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_G
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_AABBS_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_GEOMETRY_AABBS_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_GEOMETRY_AABBS_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AABBCount");
+        FieldToJson(jdata, decoded_value.AABBCount, options);
+        jdata.Key("AABBs");
+        FieldToJson(jdata, meta_struct.AABBs, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3548,6 +9323,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DestBuffer");
+        FieldToJsonAsHex(jdata, decoded_value.DestBuffer, options);
+        jdata.Key("InfoType");
+        FieldToJson(jdata, decoded_value.InfoType, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3559,6 +9354,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CompactedSizeInBytes");
+        FieldToJson(jdata, decoded_value.CompactedSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TOOLS_VISUALIZATION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3570,6 +9383,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TOOLS_VISUALIZATION_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TOOLS_VISUALIZATION_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TOOLS_VISUALIZATION_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DecodedSizeInBytes");
+        FieldToJson(jdata, decoded_value.DecodedSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_TOOLS_VISUALIZATION_HEADER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3582,6 +9413,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_TOOLS_VISUALIZATION_HEADER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_TOOLS_VISUALIZATION_HEADER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_TOOLS_VISUALIZATION_HEADER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("NumDescs");
+        FieldToJson(jdata, decoded_value.NumDescs, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3594,6 +9445,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SerializedSizeInBytes");
+        FieldToJson(jdata, decoded_value.SerializedSizeInBytes, options);
+        jdata.Key("NumBottomLevelAccelerationStructurePointers");
+        FieldToJson(jdata, decoded_value.NumBottomLevelAccelerationStructurePointers, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3606,6 +9477,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_D
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DriverOpaqueGUID");
+        FieldToJson(jdata, meta_struct.DriverOpaqueGUID, options);
+        jdata.Key("DriverOpaqueVersioningData");
+        FieldToJson(jdata, meta_struct.DriverOpaqueVersioningData, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3620,6 +9511,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_R
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DriverMatchingIdentifier");
+        FieldToJson(jdata, meta_struct.DriverMatchingIdentifier, options);
+        jdata.Key("SerializedSizeInBytesIncludingHeader");
+        FieldToJson(jdata, decoded_value.SerializedSizeInBytesIncludingHeader, options);
+        jdata.Key("DeserializedSizeInBytes");
+        FieldToJson(jdata, decoded_value.DeserializedSizeInBytes, options);
+        jdata.Key("NumBottomLevelAccelerationStructurePointersAfterHeader");
+        FieldToJson(jdata, decoded_value.NumBottomLevelAccelerationStructurePointersAfterHeader, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_CURRENT_SIZE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3631,6 +9546,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_CURRENT_SIZE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_CURRENT_SIZE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_CURRENT_SIZE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("CurrentSizeInBytes");
+        FieldToJson(jdata, decoded_value.CurrentSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_INSTANCE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3647,6 +9580,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_I
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_INSTANCE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_INSTANCE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_INSTANCE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Transform");
+        FieldToJson(jdata, meta_struct.Transform, options);
+        jdata.Key("InstanceID");
+        FieldToJson(jdata, decoded_value.InstanceID, options);
+        jdata.Key("InstanceMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.InstanceMask, options);
+        jdata.Key("InstanceContributionToHitGroupIndex");
+        FieldToJson(jdata, decoded_value.InstanceContributionToHitGroupIndex, options);
+        jdata.Key("Flags");
+        FieldToJson(jdata, decoded_value.Flags, options);
+        jdata.Key("AccelerationStructure");
+        FieldToJsonAsHex(jdata, decoded_value.AccelerationStructure, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3670,29 +9631,120 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_G
             }
             default:
             {
-                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RAYTRACING_GEOMETRY_TYPE in D3D12_RAYTRACING_GEOMETRY_DESC.", options);
+                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RAYTRACING_GEOMETRY_TYPE in D3D12_RAYTRACING_GEOMETRY_DESC.", options);
+                break;
+            }
+        }
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_GEOMETRY_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_GEOMETRY_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RAYTRACING_GEOMETRY_FLAGS(jdata, decoded_value.Flags, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES:
+            {
+                jdata.Key("Triangles");
+                FieldToJson(jdata, meta_struct.Triangles, options);
+                break;
+            }
+            case D3D12_RAYTRACING_GEOMETRY_TYPE_PROCEDURAL_PRIMITIVE_AABBS:
+            {
+                jdata.Key("AABBs");
+                FieldToJson(jdata, meta_struct.AABBs, options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_RAYTRACING_GEOMETRY_TYPE in D3D12_RAYTRACING_GEOMETRY_DESC.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& meta_struct = *data;
+        FieldToJson(jdata["Type"], decoded_value.Type, options);
+        FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(jdata["Flags"], decoded_value.Flags, options);
+        FieldToJson(jdata["NumDescs"], decoded_value.NumDescs, options);
+        FieldToJson(jdata["DescsLayout"], decoded_value.DescsLayout, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL:
+            {
+                FieldToJsonAsHex(jdata["InstanceDescs"], decoded_value.InstanceDescs, options);
+                break;
+            }
+            case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL:
+            {
+                switch(decoded_value.DescsLayout)
+                {
+                    case D3D12_ELEMENTS_LAYOUT_ARRAY:
+                    {
+                        FieldToJson(jdata["pGeometryDescs"], meta_struct.pGeometryDescs, options);
+                        break;
+                    }
+                    case D3D12_ELEMENTS_LAYOUT_ARRAY_OF_POINTERS:
+                    {
+                        FieldToJson(jdata["ppGeometryDescs"], meta_struct.ppGeometryDescs, options);
+                        break;
+                    }
+                }
+                break;
+            }
+            default:
+            {
+                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE in D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS.", options);
                 break;
             }
         }
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& decoded_value = *data->decoded_value;
         const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& meta_struct = *data;
-        FieldToJson(jdata["Type"], decoded_value.Type, options);
-        FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(jdata["Flags"], decoded_value.Flags, options);
-        FieldToJson(jdata["NumDescs"], decoded_value.NumDescs, options);
-        FieldToJson(jdata["DescsLayout"], decoded_value.DescsLayout, options);
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("NumDescs");
+        FieldToJson(jdata, decoded_value.NumDescs, options);
+        jdata.Key("DescsLayout");
+        FieldToJson(jdata, decoded_value.DescsLayout, options);
         switch(decoded_value.Type)
         {
             case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL:
             {
-                FieldToJsonAsHex(jdata["InstanceDescs"], decoded_value.InstanceDescs, options);
+                jdata.Key("InstanceDescs");
+                FieldToJsonAsHex(jdata, decoded_value.InstanceDescs, options);
                 break;
             }
             case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL:
@@ -3701,12 +9753,14 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
                 {
                     case D3D12_ELEMENTS_LAYOUT_ARRAY:
                     {
-                        FieldToJson(jdata["pGeometryDescs"], meta_struct.pGeometryDescs, options);
+                        jdata.Key("pGeometryDescs");
+                        FieldToJson(jdata, meta_struct.pGeometryDescs, options);
                         break;
                     }
                     case D3D12_ELEMENTS_LAYOUT_ARRAY_OF_POINTERS:
                     {
-                        FieldToJson(jdata["ppGeometryDescs"], meta_struct.ppGeometryDescs, options);
+                        jdata.Key("ppGeometryDescs");
+                        FieldToJson(jdata, meta_struct.ppGeometryDescs, options);
                         break;
                     }
                 }
@@ -3714,10 +9768,16 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
             }
             default:
             {
-                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE in D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS.", options);
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE in D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS.", options);
                 break;
             }
         }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
@@ -3735,6 +9795,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DestAccelerationStructureData");
+        FieldToJsonAsHex(jdata, decoded_value.DestAccelerationStructureData, options);
+        jdata.Key("Inputs");
+        FieldToJson(jdata, meta_struct.Inputs, options);
+        jdata.Key("SourceAccelerationStructureData");
+        FieldToJsonAsHex(jdata, decoded_value.SourceAccelerationStructureData, options);
+        jdata.Key("ScratchAccelerationStructureData");
+        FieldToJsonAsHex(jdata, decoded_value.ScratchAccelerationStructureData, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3748,6 +9832,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ResultDataMaxSizeInBytes");
+        FieldToJson(jdata, decoded_value.ResultDataMaxSizeInBytes, options);
+        jdata.Key("ScratchDataSizeInBytes");
+        FieldToJson(jdata, decoded_value.ScratchDataSizeInBytes, options);
+        jdata.Key("UpdateScratchDataSizeInBytes");
+        FieldToJson(jdata, decoded_value.UpdateScratchDataSizeInBytes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3768,6 +9874,42 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_AUTO_BREADCRUMB_NODE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_AUTO_BREADCRUMB_NODE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pCommandListDebugNameA");
+        FieldToJson(jdata, meta_struct.pCommandListDebugNameA, options);
+        jdata.Key("pCommandListDebugNameW");
+        FieldToJson(jdata, meta_struct.pCommandListDebugNameW, options);
+        jdata.Key("pCommandQueueDebugNameA");
+        FieldToJson(jdata, meta_struct.pCommandQueueDebugNameA, options);
+        jdata.Key("pCommandQueueDebugNameW");
+        FieldToJson(jdata, meta_struct.pCommandQueueDebugNameW, options);
+        jdata.Key("pCommandList");
+        FieldToJson(jdata, meta_struct.pCommandList, options);
+        jdata.Key("pCommandQueue");
+        FieldToJson(jdata, meta_struct.pCommandQueue, options);
+        jdata.Key("BreadcrumbCount");
+        FieldToJson(jdata, decoded_value.BreadcrumbCount, options);
+        jdata.Key("pLastBreadcrumbValue");
+        FieldToJson(jdata, meta_struct.pLastBreadcrumbValue, options);
+        jdata.Key("pCommandHistory");
+        FieldToJson(jdata, meta_struct.pCommandHistory, options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_BREADCRUMB_CONTEXT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3780,6 +9922,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_BREADCR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_BREADCRUMB_CONTEXT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_BREADCRUMB_CONTEXT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_BREADCRUMB_CONTEXT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("BreadcrumbIndex");
+        FieldToJson(jdata, decoded_value.BreadcrumbIndex, options);
+        jdata.Key("pContextString");
+        FieldToJson(jdata, meta_struct.pContextString, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3802,6 +9964,46 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_AUTO_BREADCRUMB_NODE1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_AUTO_BREADCRUMB_NODE1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pCommandListDebugNameA");
+        FieldToJson(jdata, meta_struct.pCommandListDebugNameA, options);
+        jdata.Key("pCommandListDebugNameW");
+        FieldToJson(jdata, meta_struct.pCommandListDebugNameW, options);
+        jdata.Key("pCommandQueueDebugNameA");
+        FieldToJson(jdata, meta_struct.pCommandQueueDebugNameA, options);
+        jdata.Key("pCommandQueueDebugNameW");
+        FieldToJson(jdata, meta_struct.pCommandQueueDebugNameW, options);
+        jdata.Key("pCommandList");
+        FieldToJson(jdata, meta_struct.pCommandList, options);
+        jdata.Key("pCommandQueue");
+        FieldToJson(jdata, meta_struct.pCommandQueue, options);
+        jdata.Key("BreadcrumbCount");
+        FieldToJson(jdata, decoded_value.BreadcrumbCount, options);
+        jdata.Key("pLastBreadcrumbValue");
+        FieldToJson(jdata, meta_struct.pLastBreadcrumbValue, options);
+        jdata.Key("pCommandHistory");
+        FieldToJson(jdata, meta_struct.pCommandHistory, options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.Key("BreadcrumbContextsCount");
+        FieldToJson(jdata, decoded_value.BreadcrumbContextsCount, options);
+        jdata.Key("pBreadcrumbContexts");
+        FieldToJson(jdata, meta_struct.pBreadcrumbContexts, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3814,6 +10016,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEVICE_REMOVED_EXTENDED_DATA& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Flags");
+        FieldToJson_D3D12_DRED_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("pHeadAutoBreadcrumbNode");
+        FieldToJson(jdata, meta_struct.pHeadAutoBreadcrumbNode, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3828,6 +10050,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCAT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_ALLOCATION_NODE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_ALLOCATION_NODE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ObjectNameA");
+        FieldToJson(jdata, meta_struct.ObjectNameA, options);
+        jdata.Key("ObjectNameW");
+        FieldToJson(jdata, meta_struct.ObjectNameW, options);
+        jdata.Key("AllocationType");
+        FieldToJson(jdata, decoded_value.AllocationType, options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3843,6 +10089,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCAT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_ALLOCATION_NODE1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_ALLOCATION_NODE1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ObjectNameA");
+        FieldToJson(jdata, meta_struct.ObjectNameA, options);
+        jdata.Key("ObjectNameW");
+        FieldToJson(jdata, meta_struct.ObjectNameW, options);
+        jdata.Key("AllocationType");
+        FieldToJson(jdata, decoded_value.AllocationType, options);
+        jdata.Key("pNext");
+        FieldToJson(jdata, meta_struct.pNext, options);
+        jdata.Key("pObject");
+        FieldToJson(jdata, meta_struct.pObject, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3854,6 +10126,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pHeadAutoBreadcrumbNode");
+        FieldToJson(jdata, meta_struct.pHeadAutoBreadcrumbNode, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3865,6 +10155,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pHeadAutoBreadcrumbNode");
+        FieldToJson(jdata, meta_struct.pHeadAutoBreadcrumbNode, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3878,6 +10186,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_PAGE_FAULT_OUTPUT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("PageFaultVA");
+        FieldToJsonAsHex(jdata, decoded_value.PageFaultVA, options);
+        jdata.Key("pHeadExistingAllocationNode");
+        FieldToJson(jdata, meta_struct.pHeadExistingAllocationNode, options);
+        jdata.Key("pHeadRecentFreedAllocationNode");
+        FieldToJson(jdata, meta_struct.pHeadRecentFreedAllocationNode, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3891,6 +10221,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_PAGE_FAULT_OUTPUT1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("PageFaultVA");
+        FieldToJsonAsHex(jdata, decoded_value.PageFaultVA, options);
+        jdata.Key("pHeadExistingAllocationNode");
+        FieldToJson(jdata, meta_struct.pHeadExistingAllocationNode, options);
+        jdata.Key("pHeadRecentFreedAllocationNode");
+        FieldToJson(jdata, meta_struct.pHeadRecentFreedAllocationNode, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3905,6 +10257,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FA
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DRED_PAGE_FAULT_OUTPUT2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("PageFaultVA");
+        FieldToJsonAsHex(jdata, decoded_value.PageFaultVA, options);
+        jdata.Key("pHeadExistingAllocationNode");
+        FieldToJson(jdata, meta_struct.pHeadExistingAllocationNode, options);
+        jdata.Key("pHeadRecentFreedAllocationNode");
+        FieldToJson(jdata, meta_struct.pHeadRecentFreedAllocationNode, options);
+        jdata.Key("PageFaultFlags");
+        FieldToJson_D3D12_DRED_PAGE_FAULT_FLAGS(jdata, decoded_value.PageFaultFlags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA1* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3918,6 +10294,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEVICE_REMOVED_EXTENDED_DATA1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DeviceRemovedReason");
+        HresultToJson(jdata, decoded_value.DeviceRemovedReason, options);
+        jdata.Key("AutoBreadcrumbsOutput");
+        FieldToJson(jdata, meta_struct.AutoBreadcrumbsOutput, options);
+        jdata.Key("PageFaultOutput");
+        FieldToJson(jdata, meta_struct.PageFaultOutput, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA2* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3931,6 +10329,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA2* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEVICE_REMOVED_EXTENDED_DATA2& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA2& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DeviceRemovedReason");
+        HresultToJson(jdata, decoded_value.DeviceRemovedReason, options);
+        jdata.Key("AutoBreadcrumbsOutput");
+        FieldToJson(jdata, meta_struct.AutoBreadcrumbsOutput, options);
+        jdata.Key("PageFaultOutput");
+        FieldToJson(jdata, meta_struct.PageFaultOutput, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA3* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3945,6 +10365,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA3* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEVICE_REMOVED_EXTENDED_DATA3& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA3& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("DeviceRemovedReason");
+        HresultToJson(jdata, decoded_value.DeviceRemovedReason, options);
+        jdata.Key("AutoBreadcrumbsOutput");
+        FieldToJson(jdata, meta_struct.AutoBreadcrumbsOutput, options);
+        jdata.Key("PageFaultOutput");
+        FieldToJson(jdata, meta_struct.PageFaultOutput, options);
+        jdata.Key("DeviceState");
+        FieldToJson(jdata, decoded_value.DeviceState, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
 {
     using namespace util;
@@ -3988,6 +10432,61 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_DE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Version");
+        FieldToJson(jdata, decoded_value.Version, options);
+        switch(decoded_value.Version)
+        {
+            case D3D12_DRED_VERSION_1_0:
+            {
+                jdata.Key("Dred_1_0");
+                FieldToJson(jdata, meta_struct.Dred_1_0, options);
+                break;
+            }
+            case D3D12_DRED_VERSION_1_1:
+            {
+                jdata.Key("Dred_1_1");
+                FieldToJson(jdata, meta_struct.Dred_1_1, options);
+                break;
+            }
+            case D3D12_DRED_VERSION_1_2:
+            {
+                jdata.Key("Dred_1_2");
+                FieldToJson(jdata, meta_struct.Dred_1_2, options);
+                break;
+            }
+            case D3D12_DRED_VERSION_1_3:
+            {
+                // This field was missing in the custom struct at time of writing.
+                // See issue and revise this codegen by uncommenting line below when the issue
+                // is fixed <https://github.com/LunarG/gfxreconstruct/issues/1351>
+                // FieldToJson(jdata["Dred_1_3"], meta_struct.Dred_1_3, options);
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Dred_1_3 is not supported by GFXR at this time. Please file an issue quoting this text if this is a blocker for you.", options);
+                break;
+            }
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_DRED_VERSION in D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4000,16 +10499,58 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, decoded_value.NodeIndex, options);
+        jdata.Key("Count");
+        FieldToJson(jdata, decoded_value.Count, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES& meta_struct = *data;
+        FieldToJson(jdata["NodeIndex"], decoded_value.NodeIndex, options);
+        FieldToJson(jdata["Count"], decoded_value.Count, options);
+        FieldToJson(jdata["pTypes"], meta_struct.pTypes, options);
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES& decoded_value = *data->decoded_value;
         const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES& meta_struct = *data;
-        FieldToJson(jdata["NodeIndex"], decoded_value.NodeIndex, options);
-        FieldToJson(jdata["Count"], decoded_value.Count, options);
-        FieldToJson(jdata["pTypes"], meta_struct.pTypes, options);
+        jdata.BeginObject();
+        jdata.Key("NodeIndex");
+        FieldToJson(jdata, decoded_value.NodeIndex, options);
+        jdata.Key("Count");
+        FieldToJson(jdata, decoded_value.Count, options);
+        jdata.Key("pTypes");
+        FieldToJson(jdata, meta_struct.pTypes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
@@ -4026,6 +10567,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC1* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_PROTECTED_RESOURCE_SESSION_DESC1& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC1& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NodeMask");
+        FieldToJsonAsFixedWidthBinary(jdata, decoded_value.NodeMask, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("ProtectionType");
+        FieldToJson(jdata, meta_struct.ProtectionType, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4037,6 +10600,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ClearValue");
+        FieldToJson(jdata, meta_struct.ClearValue, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4049,6 +10630,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AdditionalWidth");
+        FieldToJson(jdata, decoded_value.AdditionalWidth, options);
+        jdata.Key("AdditionalHeight");
+        FieldToJson(jdata, decoded_value.AdditionalHeight, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4090,6 +10691,58 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_BEGINNING_ACCESS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR:
+            {
+                jdata.Key("Clear");
+                FieldToJson(jdata, meta_struct.Clear, options);
+                break;
+            }
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_RENDER:
+            if(decoded_value.PreserveLocal.AdditionalWidth != 0U || decoded_value.PreserveLocal.AdditionalHeight != 0U)
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Additional width and height should be zero (see DirectX Specs).", options);
+            }
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_SRV:
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_UAV:
+            {
+                jdata.Key("PreserveLocal");
+                FieldToJson(jdata, decoded_value.PreserveLocal, options);
+                break;
+            }
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD:
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE:
+            case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS:
+            // No parameters to these cases.
+            break;
+
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE in D3D12_RENDER_PASS_BEGINNING_ACCESS.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4105,6 +10758,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SrcSubresource");
+        FieldToJson(jdata, decoded_value.SrcSubresource, options);
+        jdata.Key("DstSubresource");
+        FieldToJson(jdata, decoded_value.DstSubresource, options);
+        jdata.Key("DstX");
+        FieldToJson(jdata, decoded_value.DstX, options);
+        jdata.Key("DstY");
+        FieldToJson(jdata, decoded_value.DstY, options);
+        jdata.Key("SrcRect");
+        FieldToJson(jdata, meta_struct.SrcRect, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4122,6 +10801,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pSrcResource");
+        FieldToJson(jdata, meta_struct.pSrcResource, options);
+        jdata.Key("pDstResource");
+        FieldToJson(jdata, meta_struct.pDstResource, options);
+        jdata.Key("SubresourceCount");
+        FieldToJson(jdata, decoded_value.SubresourceCount, options);
+        jdata.Key("pSubresourceParameters");
+        FieldToJson(jdata, meta_struct.pSubresourceParameters, options);
+        jdata.Key("Format");
+        FieldToJson(jdata, decoded_value.Format, options);
+        jdata.Key("ResolveMode");
+        FieldToJson(jdata, decoded_value.ResolveMode, options);
+        jdata.Key("PreserveResolveSource");
+        Bool32ToJson(jdata, decoded_value.PreserveResolveSource, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4134,6 +10843,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AdditionalWidth");
+        FieldToJson(jdata, decoded_value.AdditionalWidth, options);
+        jdata.Key("AdditionalHeight");
+        FieldToJson(jdata, decoded_value.AdditionalHeight, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4172,6 +10901,54 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_ENDING_ACCESS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_DISCARD:
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE:
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS:
+            // No parameters to these cases.
+            break;
+
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_RESOLVE:
+            {
+                jdata.Key("Resolve");
+                FieldToJson(jdata, meta_struct.Resolve, options);
+                break;
+            }
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_RENDER:
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_SRV:
+            case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_UAV:
+            {
+                jdata.Key("PreserveLocal");
+                FieldToJson(jdata, decoded_value.PreserveLocal, options);
+                break;
+            }
+
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_RENDER_PASS_ENDING_ACCESS_TYPE in D3D12_RENDER_PASS_ENDING_ACCESS.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_RENDER_TARGET_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4185,6 +10962,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_RENDER_TARGET_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_RENDER_TARGET_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_RENDER_TARGET_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("cpuDescriptor");
+        FieldToJson(jdata, meta_struct.cpuDescriptor, options);
+        jdata.Key("BeginningAccess");
+        FieldToJson(jdata, meta_struct.BeginningAccess, options);
+        jdata.Key("EndingAccess");
+        FieldToJson(jdata, meta_struct.EndingAccess, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4200,6 +10999,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_RENDER_PASS_DEPTH_STENCIL_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_RENDER_PASS_DEPTH_STENCIL_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("cpuDescriptor");
+        FieldToJson(jdata, meta_struct.cpuDescriptor, options);
+        jdata.Key("DepthBeginningAccess");
+        FieldToJson(jdata, meta_struct.DepthBeginningAccess, options);
+        jdata.Key("StencilBeginningAccess");
+        FieldToJson(jdata, meta_struct.StencilBeginningAccess, options);
+        jdata.Key("DepthEndingAccess");
+        FieldToJson(jdata, meta_struct.DepthEndingAccess, options);
+        jdata.Key("StencilEndingAccess");
+        FieldToJson(jdata, meta_struct.StencilEndingAccess, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_RAYS_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4217,6 +11042,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_RAY
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DISPATCH_RAYS_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DISPATCH_RAYS_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DISPATCH_RAYS_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("RayGenerationShaderRecord");
+        FieldToJson(jdata, meta_struct.RayGenerationShaderRecord, options);
+        jdata.Key("MissShaderTable");
+        FieldToJson(jdata, meta_struct.MissShaderTable, options);
+        jdata.Key("HitGroupTable");
+        FieldToJson(jdata, meta_struct.HitGroupTable, options);
+        jdata.Key("CallableShaderTable");
+        FieldToJson(jdata, meta_struct.CallableShaderTable, options);
+        jdata.Key("Width");
+        FieldToJson(jdata, decoded_value.Width, options);
+        jdata.Key("Height");
+        FieldToJson(jdata, decoded_value.Height, options);
+        jdata.Key("Depth");
+        FieldToJson(jdata, decoded_value.Depth, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_CACHE_SESSION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4234,6 +11089,36 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_CACHE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SHADER_CACHE_SESSION_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SHADER_CACHE_SESSION_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SHADER_CACHE_SESSION_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Identifier");
+        FieldToJson(jdata, meta_struct.Identifier, options);
+        jdata.Key("Mode");
+        FieldToJson(jdata, decoded_value.Mode, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_SHADER_CACHE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("MaximumInMemoryCacheSizeBytes");
+        FieldToJson(jdata, decoded_value.MaximumInMemoryCacheSizeBytes, options);
+        jdata.Key("MaximumInMemoryCacheEntries");
+        FieldToJson(jdata, decoded_value.MaximumInMemoryCacheEntries, options);
+        jdata.Key("MaximumValueFileSizeBytes");
+        FieldToJson(jdata, decoded_value.MaximumValueFileSizeBytes, options);
+        jdata.Key("Version");
+        FieldToJson(jdata, decoded_value.Version, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_SUBRESOURCE_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4250,6 +11135,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_SUBR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BARRIER_SUBRESOURCE_RANGE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BARRIER_SUBRESOURCE_RANGE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BARRIER_SUBRESOURCE_RANGE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("IndexOrFirstMipLevel");
+        FieldToJson(jdata, decoded_value.IndexOrFirstMipLevel, options);
+        jdata.Key("NumMipLevels");
+        FieldToJson(jdata, decoded_value.NumMipLevels, options);
+        jdata.Key("FirstArraySlice");
+        FieldToJson(jdata, decoded_value.FirstArraySlice, options);
+        jdata.Key("NumArraySlices");
+        FieldToJson(jdata, decoded_value.NumArraySlices, options);
+        jdata.Key("FirstPlane");
+        FieldToJson(jdata, decoded_value.FirstPlane, options);
+        jdata.Key("NumPlanes");
+        FieldToJson(jdata, decoded_value.NumPlanes, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4264,6 +11177,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_BARRI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_GLOBAL_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_GLOBAL_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_GLOBAL_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SyncBefore");
+        FieldToJson(jdata, decoded_value.SyncBefore, options);
+        jdata.Key("SyncAfter");
+        FieldToJson(jdata, decoded_value.SyncAfter, options);
+        jdata.Key("AccessBefore");
+        FieldToJson(jdata, decoded_value.AccessBefore, options);
+        jdata.Key("AccessAfter");
+        FieldToJson(jdata, decoded_value.AccessAfter, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4283,6 +11220,40 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_BARR
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_TEXTURE_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_TEXTURE_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_TEXTURE_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SyncBefore");
+        FieldToJson(jdata, decoded_value.SyncBefore, options);
+        jdata.Key("SyncAfter");
+        FieldToJson(jdata, decoded_value.SyncAfter, options);
+        jdata.Key("AccessBefore");
+        FieldToJson(jdata, decoded_value.AccessBefore, options);
+        jdata.Key("AccessAfter");
+        FieldToJson(jdata, decoded_value.AccessAfter, options);
+        jdata.Key("LayoutBefore");
+        FieldToJson(jdata, decoded_value.LayoutBefore, options);
+        jdata.Key("LayoutAfter");
+        FieldToJson(jdata, decoded_value.LayoutAfter, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, meta_struct.pResource, options);
+        jdata.Key("Subresources");
+        FieldToJson(jdata, meta_struct.Subresources, options);
+        jdata.Key("Flags");
+        FieldToJson_D3D12_TEXTURE_BARRIER_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4300,38 +11271,115 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_BARRI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_GROUP* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BUFFER_BARRIER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BUFFER_BARRIER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BUFFER_BARRIER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SyncBefore");
+        FieldToJson(jdata, decoded_value.SyncBefore, options);
+        jdata.Key("SyncAfter");
+        FieldToJson(jdata, decoded_value.SyncAfter, options);
+        jdata.Key("AccessBefore");
+        FieldToJson(jdata, decoded_value.AccessBefore, options);
+        jdata.Key("AccessAfter");
+        FieldToJson(jdata, decoded_value.AccessAfter, options);
+        jdata.Key("pResource");
+        FieldToJson(jdata, meta_struct.pResource, options);
+        jdata.Key("Offset");
+        FieldToJson(jdata, decoded_value.Offset, options);
+        jdata.Key("Size");
+        FieldToJson(jdata, decoded_value.Size, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_GROUP* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_BARRIER_GROUP& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_BARRIER_GROUP& meta_struct = *data;
+        FieldToJson(jdata["Type"], decoded_value.Type, options);
+        FieldToJson(jdata["NumBarriers"], decoded_value.NumBarriers, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_BARRIER_TYPE_GLOBAL:
+            {
+                FieldToJson(jdata["pGlobalBarriers"], meta_struct.global_barriers, options);
+                break;
+            }
+            case D3D12_BARRIER_TYPE_TEXTURE:
+            {
+                FieldToJson(jdata["pTextureBarriers"], meta_struct.texture_barriers, options);
+                break;
+            }
+            case D3D12_BARRIER_TYPE_BUFFER:
+            {
+                FieldToJson(jdata["pBufferBarriers"], meta_struct.buffer_barriers, options);
+                break;
+            }
+            default:
+            {
+                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_BARRIER_TYPE in D3D12_BARRIER_GROUP.", options);
+                break;
+            }
+        }
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_BARRIER_GROUP* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
     {
         const D3D12_BARRIER_GROUP& decoded_value = *data->decoded_value;
         const Decoded_D3D12_BARRIER_GROUP& meta_struct = *data;
-        FieldToJson(jdata["Type"], decoded_value.Type, options);
-        FieldToJson(jdata["NumBarriers"], decoded_value.NumBarriers, options);
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        jdata.Key("NumBarriers");
+        FieldToJson(jdata, decoded_value.NumBarriers, options);
         switch(decoded_value.Type)
         {
             case D3D12_BARRIER_TYPE_GLOBAL:
             {
-                FieldToJson(jdata["pGlobalBarriers"], meta_struct.global_barriers, options);
+                jdata.Key("pGlobalBarriers");
+                FieldToJson(jdata, meta_struct.global_barriers, options);
                 break;
             }
             case D3D12_BARRIER_TYPE_TEXTURE:
             {
-                FieldToJson(jdata["pTextureBarriers"], meta_struct.texture_barriers, options);
+                jdata.Key("pTextureBarriers");
+                FieldToJson(jdata, meta_struct.texture_barriers, options);
                 break;
             }
             case D3D12_BARRIER_TYPE_BUFFER:
             {
-                FieldToJson(jdata["pBufferBarriers"], meta_struct.buffer_barriers, options);
+                jdata.Key("pBufferBarriers");
+                FieldToJson(jdata, meta_struct.buffer_barriers, options);
                 break;
             }
             default:
             {
-                FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_BARRIER_TYPE in D3D12_BARRIER_GROUP.", options);
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_BARRIER_TYPE in D3D12_BARRIER_GROUP.", options);
                 break;
             }
         }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
     }
 }
 
@@ -4348,6 +11396,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_SUBRESOURCE_DATA* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_SUBRESOURCE_DATA& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_SUBRESOURCE_DATA& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pData");
+        FieldToJson(jdata, meta_struct.pData, options);
+        jdata.Key("RowPitch");
+        FieldToJson(jdata, decoded_value.RowPitch, options);
+        jdata.Key("SlicePitch");
+        FieldToJson(jdata, decoded_value.SlicePitch, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MEMCPY_DEST* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4361,6 +11431,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MEMCPY_DEST*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_MEMCPY_DEST* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_MEMCPY_DEST& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_MEMCPY_DEST& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("pData");
+        FieldToJson(jdata, meta_struct.pData, options);
+        jdata.Key("RowPitch");
+        FieldToJson(jdata, decoded_value.RowPitch, options);
+        jdata.Key("SlicePitch");
+        FieldToJson(jdata, decoded_value.SlicePitch, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_CONFIGURATION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4375,6 +11467,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_CONFI
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEVICE_CONFIGURATION_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEVICE_CONFIGURATION_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEVICE_CONFIGURATION_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Flags");
+        FieldToJson_D3D12_DEVICE_FLAGS(jdata, decoded_value.Flags, options);
+        jdata.Key("GpuBasedValidationFlags");
+        FieldToJson(jdata, decoded_value.GpuBasedValidationFlags, options);
+        jdata.Key("SDKVersion");
+        FieldToJson(jdata, decoded_value.SDKVersion, options);
+        jdata.Key("NumEnabledExperimentalFeatures");
+        FieldToJson(jdata, decoded_value.NumEnabledExperimentalFeatures, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_MESH_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4388,6 +11504,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_MES
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DISPATCH_MESH_ARGUMENTS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DISPATCH_MESH_ARGUMENTS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DISPATCH_MESH_ARGUMENTS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ThreadGroupCountX");
+        FieldToJson(jdata, decoded_value.ThreadGroupCountX, options);
+        jdata.Key("ThreadGroupCountY");
+        FieldToJson(jdata, decoded_value.ThreadGroupCountY, options);
+        jdata.Key("ThreadGroupCountZ");
+        FieldToJson(jdata, decoded_value.ThreadGroupCountZ, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D_SHADER_MACRO* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4400,6 +11538,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D_SHADER_MACRO*
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D_SHADER_MACRO* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D_SHADER_MACRO& decoded_value = *data->decoded_value;
+        const Decoded_D3D_SHADER_MACRO& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Name");
+        FieldToJson(jdata, meta_struct.Name, options);
+        jdata.Key("Definition");
+        FieldToJson(jdata, meta_struct.Definition, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4413,6 +11571,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEBUG_DEVICE_GPU_BASED_VALIDATION_SETTINGS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEBUG_DEVICE_GPU_BASED_VALIDATION_SETTINGS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("MaxMessagesPerCommandList");
+        FieldToJson(jdata, decoded_value.MaxMessagesPerCommandList, options);
+        jdata.Key("DefaultShaderPatchMode");
+        FieldToJson(jdata, decoded_value.DefaultShaderPatchMode, options);
+        jdata.Key("PipelineStateCreateFlags");
+        FieldToJson_D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS(jdata, decoded_value.PipelineStateCreateFlags, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_SLOWDOWN_PERFORMANCE_FACTOR* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4424,6 +11604,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_SLOWDOWN_PERFORMANCE_FACTOR* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEBUG_DEVICE_GPU_SLOWDOWN_PERFORMANCE_FACTOR& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEBUG_DEVICE_GPU_SLOWDOWN_PERFORMANCE_FACTOR& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SlowdownFactor");
+        FieldToJson(jdata, decoded_value.SlowdownFactor, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_COMMAND_LIST_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4435,6 +11633,24 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_COMMAN
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_DEBUG_COMMAND_LIST_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_DEBUG_COMMAND_LIST_GPU_BASED_VALIDATION_SETTINGS& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_DEBUG_COMMAND_LIST_GPU_BASED_VALIDATION_SETTINGS& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("ShaderPatchMode");
+        FieldToJson(jdata, decoded_value.ShaderPatchMode, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MESSAGE* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4450,6 +11666,32 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MESSAGE* dat
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_MESSAGE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_MESSAGE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_MESSAGE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Category");
+        FieldToJson(jdata, decoded_value.Category, options);
+        jdata.Key("Severity");
+        FieldToJson(jdata, decoded_value.Severity, options);
+        jdata.Key("ID");
+        FieldToJson(jdata, decoded_value.ID, options);
+        jdata.Key("pDescription");
+        FieldToJson(jdata, meta_struct.pDescription, options);
+        jdata.Key("DescriptionByteLength");
+        FieldToJson(jdata, decoded_value.DescriptionByteLength, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4466,6 +11708,34 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_F
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_INFO_QUEUE_FILTER_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_INFO_QUEUE_FILTER_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("NumCategories");
+        FieldToJson(jdata, decoded_value.NumCategories, options);
+        jdata.Key("pCategoryList");
+        FieldToJson(jdata, meta_struct.pCategoryList, options);
+        jdata.Key("NumSeverities");
+        FieldToJson(jdata, decoded_value.NumSeverities, options);
+        jdata.Key("pSeverityList");
+        FieldToJson(jdata, meta_struct.pSeverityList, options);
+        jdata.Key("NumIDs");
+        FieldToJson(jdata, decoded_value.NumIDs, options);
+        jdata.Key("pIDList");
+        FieldToJson(jdata, meta_struct.pIDList, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4478,6 +11748,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_F
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_INFO_QUEUE_FILTER& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_INFO_QUEUE_FILTER& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("AllowList");
+        FieldToJson(jdata, meta_struct.AllowList, options);
+        jdata.Key("DenyList");
+        FieldToJson(jdata, meta_struct.DenyList, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagRECT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4492,6 +11782,30 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagRECT* data, con
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_tagRECT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const tagRECT& decoded_value = *data->decoded_value;
+        const Decoded_tagRECT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("left");
+        FieldToJson(jdata, decoded_value.left, options);
+        jdata.Key("top");
+        FieldToJson(jdata, decoded_value.top, options);
+        jdata.Key("right");
+        FieldToJson(jdata, decoded_value.right, options);
+        jdata.Key("bottom");
+        FieldToJson(jdata, decoded_value.bottom, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagPOINT* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4504,6 +11818,26 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagPOINT* data, co
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_tagPOINT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const tagPOINT& decoded_value = *data->decoded_value;
+        const Decoded_tagPOINT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("x");
+        FieldToJson(jdata, decoded_value.x, options);
+        jdata.Key("y");
+        FieldToJson(jdata, decoded_value.y, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const Decoded__SECURITY_ATTRIBUTES* data, const JsonOptions& options)
 {
     using namespace util;
@@ -4517,6 +11851,28 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded__SECURITY_ATTRIBUT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded__SECURITY_ATTRIBUTES* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const _SECURITY_ATTRIBUTES& decoded_value = *data->decoded_value;
+        const Decoded__SECURITY_ATTRIBUTES& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("nLength");
+        FieldToJson(jdata, decoded_value.nLength, options);
+        jdata.Key("lpSecurityDescriptor");
+        FieldToJson(jdata, meta_struct.lpSecurityDescriptor, options);
+        jdata.Key("bInheritHandle");
+        Bool32ToJson(jdata, decoded_value.bInheritHandle, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 // TODO Move all these manual functions out of the generator and into a .cpp file.
 
 /// @defgroup custom_dx12_struct_decoders_to_json_bodies Custom implementations for
@@ -4653,6 +12009,187 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CPU_DESCRIPT
     }
 }
 
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const LARGE_INTEGER& decoded_value = *data->decoded_value;
+        FieldToJson(jdata, decoded_value.QuadPart, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_GUID* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const GUID& decoded_value = *data->decoded_value;
+        FieldToJson(jdata, decoded_value, options);
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_PIPELINE_STATE_STREAM_DESC& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("SizeInBytes");
+        FieldToJson(jdata, decoded_value.SizeInBytes, options);
+        jdata.Key(format::kNameWarning);
+        FieldToJson(jdata, "D3D12_PIPELINE_STATE_STREAM_DESC.root_signature_ptr is not supported.", options);
+        jdata.Key("root_signature_ptr");
+        FieldToJson(jdata, "@todo Get this field to convert cleanly.", options);
+        jdata.Key("vs_bytecode");
+        FieldToJson(jdata, meta_struct.vs_bytecode, options);
+        jdata.Key("ps_bytecode");
+        FieldToJson(jdata, meta_struct.ps_bytecode, options);
+        jdata.Key("ds_bytecode");
+        FieldToJson(jdata, meta_struct.ds_bytecode, options);
+        jdata.Key("hs_bytecode");
+        FieldToJson(jdata, meta_struct.hs_bytecode, options);
+        jdata.Key("gs_bytecode");
+        FieldToJson(jdata, meta_struct.gs_bytecode, options);
+        jdata.Key("cs_bytecode");
+        FieldToJson(jdata, meta_struct.cs_bytecode, options);
+        jdata.Key("as_bytecode");
+        FieldToJson(jdata, meta_struct.as_bytecode, options);
+        jdata.Key("ms_bytecode");
+        FieldToJson(jdata, meta_struct.ms_bytecode, options);
+        jdata.Key("stream_output");
+        FieldToJson(jdata, meta_struct.stream_output, options);
+        jdata.Key("blend");
+        FieldToJson(jdata, meta_struct.blend, options);
+        jdata.Key("rasterizer");
+        FieldToJson(jdata, meta_struct.rasterizer, options);
+        jdata.Key("depth_stencil");
+        FieldToJson(jdata, meta_struct.depth_stencil, options);
+        jdata.Key("input_layout");
+        FieldToJson(jdata, meta_struct.input_layout, options);
+        jdata.Key("render_target_formats");
+        FieldToJson(jdata, meta_struct.render_target_formats, options);
+        jdata.Key("sample_desc");
+        FieldToJson(jdata, meta_struct.sample_desc, options);
+        jdata.Key("cached_pso");
+        FieldToJson(jdata, meta_struct.cached_pso, options);
+        jdata.Key("depth_stencil1");
+        FieldToJson(jdata, meta_struct.depth_stencil1, options);
+        jdata.Key("view_instancing");
+        FieldToJson(jdata, meta_struct.view_instancing, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_STATE_SUBOBJECT& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_STATE_SUBOBJECT& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("Type");
+        FieldToJson(jdata, decoded_value.Type, options);
+        switch(decoded_value.Type)
+        {
+            case D3D12_STATE_SUBOBJECT_TYPE_STATE_OBJECT_CONFIG:
+            jdata.Key("state_object_config");
+            FieldToJson(jdata, meta_struct.state_object_config, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_GLOBAL_ROOT_SIGNATURE:
+            jdata.Key("global_root_signature");
+            FieldToJson(jdata, meta_struct.global_root_signature, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_LOCAL_ROOT_SIGNATURE:
+            jdata.Key("local_root_signature");
+            FieldToJson(jdata, meta_struct.local_root_signature, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_NODE_MASK:
+            jdata.Key("node_mask");
+            FieldToJson(jdata, meta_struct.node_mask, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY:
+            jdata.Key("dxil_library_desc");
+            FieldToJson(jdata, meta_struct.dxil_library_desc, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_EXISTING_COLLECTION:
+            jdata.Key("existing_collection_desc");
+            FieldToJson(jdata, meta_struct.existing_collection_desc, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
+            jdata.Key("subobject_to_exports_association");
+            FieldToJson(jdata, meta_struct.subobject_to_exports_association, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
+            jdata.Key("dxil_subobject_to_exports_association");
+            FieldToJson(jdata, meta_struct.dxil_subobject_to_exports_association, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_SHADER_CONFIG:
+            jdata.Key("raytracing_shader_config");
+            FieldToJson(jdata, meta_struct.raytracing_shader_config, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG:
+            jdata.Key("raytracing_pipeline_config");
+            FieldToJson(jdata, meta_struct.raytracing_pipeline_config, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP:
+            jdata.Key("hit_group_desc");
+            FieldToJson(jdata, meta_struct.hit_group_desc, options);
+            break;
+            case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG1:
+            jdata.Key("raytracing_pipeline_config1");
+            FieldToJson(jdata, meta_struct.raytracing_pipeline_config1, options);
+            break;
+            default:
+            {
+                jdata.Key(format::kNameWarning);
+                FieldToJson(jdata, "Unknown D3D12_STATE_SUBOBJECT_TYPE in D3D12_STATE_SUBOBJECT.", options);
+                break;
+            }
+        }
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
+void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+{
+    using namespace util;
+    if (data && data->decoded_value)
+    {
+        const D3D12_CPU_DESCRIPTOR_HANDLE& decoded_value = *data->decoded_value;
+        const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE& meta_struct = *data;
+        jdata.BeginObject();
+        jdata.Key("heap_id");
+        FieldToJson(jdata, meta_struct.heap_id, options);
+        jdata.Key("index");
+        FieldToJson(jdata, meta_struct.index, options);
+        jdata.EndObject();
+    }
+    else
+    {
+        jdata.Null();
+    }
+}
+
 /** @} */
 
 GFXRECON_END_NAMESPACE(decode)
@@ -51,14 +51,20 @@ void VulkanExportJsonConsumer::Process_vkCreateInstance(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkInstance>*           pInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateInstance");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pInstance"], pInstance, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateInstance");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pInstance");
+        HandleToJson(jdata, pInstance, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyInstance(
@@ -66,12 +72,16 @@ void VulkanExportJsonConsumer::Process_vkDestroyInstance(
     format::HandleId                            instance,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyInstance");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyInstance");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDevices(
@@ -81,14 +91,20 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDevices(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceCount,
     HandlePointerDecoder<VkPhysicalDevice>*     pPhysicalDevices)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDevices");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkEnumeratePhysicalDevices");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pPhysicalDeviceCount"], pPhysicalDeviceCount, json_options);
-        HandleToJson(args["pPhysicalDevices"], pPhysicalDevices, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pPhysicalDeviceCount");
+        FieldToJson(jdata, pPhysicalDeviceCount, json_options);
+        jdata.Key("pPhysicalDevices");
+        HandleToJson(jdata, pPhysicalDevices, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures(
@@ -96,12 +112,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFeatures");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFeatures"], pFeatures, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pFeatures");
+        FieldToJson(jdata, pFeatures, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties(
@@ -110,13 +130,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["pFormatProperties"], pFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("format");
+        FieldToJson(jdata, format, json_options);
+        jdata.Key("pFormatProperties");
+        FieldToJson(jdata, pFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
@@ -130,18 +155,28 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
     VkImageCreateFlags                          flags,
     StructPointerDecoder<Decoded_VkImageFormatProperties>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["type"], type, json_options);
-        FieldToJson(args["tiling"], tiling, json_options);
-        FieldToJson(VkImageUsageFlags_t(), args["usage"], usage, json_options);
-        FieldToJson(VkImageCreateFlags_t(), args["flags"], flags, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("format");
+        FieldToJson(jdata, format, json_options);
+        jdata.Key("type");
+        FieldToJson(jdata, type, json_options);
+        jdata.Key("tiling");
+        FieldToJson(jdata, tiling, json_options);
+        jdata.Key("usage");
+        FieldToJson(VkImageUsageFlags_t(), jdata, usage, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkImageCreateFlags_t(), jdata, flags, json_options);
+        jdata.Key("pImageFormatProperties");
+        FieldToJson(jdata, pImageFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties(
@@ -149,12 +184,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
@@ -163,13 +202,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQueueFamilyPropertyCount"], pQueueFamilyPropertyCount, json_options);
-        FieldToJson(args["pQueueFamilyProperties"], pQueueFamilyProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pQueueFamilyPropertyCount");
+        FieldToJson(jdata, pQueueFamilyPropertyCount, json_options);
+        jdata.Key("pQueueFamilyProperties");
+        FieldToJson(jdata, pQueueFamilyProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
@@ -177,12 +221,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pMemoryProperties"], pMemoryProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pMemoryProperties");
+        FieldToJson(jdata, pMemoryProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDevice(
@@ -193,15 +241,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDevice(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDevice>*             pDevice)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDevice");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDevice");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDevice"], pDevice, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pDevice");
+        HandleToJson(jdata, pDevice, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDevice(
@@ -209,12 +264,16 @@ void VulkanExportJsonConsumer::Process_vkDestroyDevice(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDevice");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDevice");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceQueue(
@@ -224,14 +283,20 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceQueue(
     uint32_t                                    queueIndex,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceQueue");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["queueIndex"], queueIndex, json_options);
-        HandleToJson(args["pQueue"], pQueue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("queueIndex");
+        FieldToJson(jdata, queueIndex, json_options);
+        jdata.Key("pQueue");
+        HandleToJson(jdata, pQueue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueSubmit(
@@ -242,16 +307,24 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit(
     StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["submitCount"], submitCount, json_options);
-        FieldToJson(args["pSubmits"], pSubmits, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueSubmit");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameSubmitIndex());
+    FieldToJson(jdata, ++submit_index_, json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("submitCount");
+        FieldToJson(jdata, submitCount, json_options);
+        jdata.Key("pSubmits");
+        FieldToJson(jdata, pSubmits, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueWaitIdle(
@@ -259,12 +332,16 @@ void VulkanExportJsonConsumer::Process_vkQueueWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            queue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueWaitIdle");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueWaitIdle");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDeviceWaitIdle(
@@ -272,12 +349,16 @@ void VulkanExportJsonConsumer::Process_vkDeviceWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDeviceWaitIdle");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDeviceWaitIdle");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAllocateMemory(
@@ -288,15 +369,22 @@ void VulkanExportJsonConsumer::Process_vkAllocateMemory(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeviceMemory>*       pMemory)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateMemory");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAllocateMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocateInfo"], pAllocateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMemory"], pMemory, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAllocateInfo");
+        FieldToJson(jdata, pAllocateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pMemory");
+        HandleToJson(jdata, pMemory, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkFreeMemory(
@@ -305,13 +393,18 @@ void VulkanExportJsonConsumer::Process_vkFreeMemory(
     format::HandleId                            memory,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeMemory");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkFreeMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkMapMemory(
@@ -324,17 +417,26 @@ void VulkanExportJsonConsumer::Process_vkMapMemory(
     VkMemoryMapFlags                            flags,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMapMemory");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(VkMemoryMapFlags_t(), args["flags"], flags, json_options);
-        FieldToJsonAsHex(args["ppData"], ppData, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkMapMemory");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("size");
+        FieldToJson(jdata, size, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkMemoryMapFlags_t(), jdata, flags, json_options);
+        jdata.Key("ppData");
+        FieldToJsonAsHex(jdata, ppData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkUnmapMemory(
@@ -342,12 +444,16 @@ void VulkanExportJsonConsumer::Process_vkUnmapMemory(
     format::HandleId                            device,
     format::HandleId                            memory)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUnmapMemory");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkUnmapMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkFlushMappedMemoryRanges(
@@ -357,14 +463,20 @@ void VulkanExportJsonConsumer::Process_vkFlushMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFlushMappedMemoryRanges");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkFlushMappedMemoryRanges");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["memoryRangeCount"], memoryRangeCount, json_options);
-        FieldToJson(args["pMemoryRanges"], pMemoryRanges, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memoryRangeCount");
+        FieldToJson(jdata, memoryRangeCount, json_options);
+        jdata.Key("pMemoryRanges");
+        FieldToJson(jdata, pMemoryRanges, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkInvalidateMappedMemoryRanges(
@@ -374,14 +486,20 @@ void VulkanExportJsonConsumer::Process_vkInvalidateMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkInvalidateMappedMemoryRanges");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkInvalidateMappedMemoryRanges");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["memoryRangeCount"], memoryRangeCount, json_options);
-        FieldToJson(args["pMemoryRanges"], pMemoryRanges, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memoryRangeCount");
+        FieldToJson(jdata, memoryRangeCount, json_options);
+        jdata.Key("pMemoryRanges");
+        FieldToJson(jdata, pMemoryRanges, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryCommitment(
@@ -390,13 +508,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryCommitment(
     format::HandleId                            memory,
     PointerDecoder<VkDeviceSize>*               pCommittedMemoryInBytes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryCommitment");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceMemoryCommitment");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["pCommittedMemoryInBytes"], pCommittedMemoryInBytes, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("pCommittedMemoryInBytes");
+        FieldToJson(jdata, pCommittedMemoryInBytes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindBufferMemory(
@@ -407,15 +530,22 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindBufferMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["memoryOffset"], memoryOffset, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("memoryOffset");
+        FieldToJson(jdata, memoryOffset, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindImageMemory(
@@ -426,15 +556,22 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindImageMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["memoryOffset"], memoryOffset, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("memoryOffset");
+        FieldToJson(jdata, memoryOffset, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements(
@@ -443,13 +580,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements(
@@ -458,13 +600,18 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements(
@@ -474,14 +621,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageSparseMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pSparseMemoryRequirementCount");
+        FieldToJson(jdata, pSparseMemoryRequirementCount, json_options);
+        jdata.Key("pSparseMemoryRequirements");
+        FieldToJson(jdata, pSparseMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties(
@@ -495,18 +648,28 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties");
-    const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["type"], type, json_options);
-        FieldToJson(args["samples"], samples, json_options);
-        FieldToJson(VkImageUsageFlags_t(), args["usage"], usage, json_options);
-        FieldToJson(args["tiling"], tiling, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("format");
+        FieldToJson(jdata, format, json_options);
+        jdata.Key("type");
+        FieldToJson(jdata, type, json_options);
+        jdata.Key("samples");
+        FieldToJson(jdata, samples, json_options);
+        jdata.Key("usage");
+        FieldToJson(VkImageUsageFlags_t(), jdata, usage, json_options);
+        jdata.Key("tiling");
+        FieldToJson(jdata, tiling, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueBindSparse(
@@ -517,15 +680,22 @@ void VulkanExportJsonConsumer::Process_vkQueueBindSparse(
     StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueBindSparse");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueBindSparse");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfo"], pBindInfo, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("bindInfoCount");
+        FieldToJson(jdata, bindInfoCount, json_options);
+        jdata.Key("pBindInfo");
+        FieldToJson(jdata, pBindInfo, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateFence(
@@ -536,15 +706,22 @@ void VulkanExportJsonConsumer::Process_vkCreateFence(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateFence");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateFence");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFence"], pFence, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pFence");
+        HandleToJson(jdata, pFence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyFence(
@@ -553,13 +730,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyFence(
     format::HandleId                            fence,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyFence");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyFence");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetFences(
@@ -569,14 +751,20 @@ void VulkanExportJsonConsumer::Process_vkResetFences(
     uint32_t                                    fenceCount,
     HandlePointerDecoder<VkFence>*              pFences)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetFences");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetFences");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["fenceCount"], fenceCount, json_options);
-        HandleToJson(args["pFences"], pFences, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("fenceCount");
+        FieldToJson(jdata, fenceCount, json_options);
+        jdata.Key("pFences");
+        HandleToJson(jdata, pFences, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetFenceStatus(
@@ -585,13 +773,18 @@ void VulkanExportJsonConsumer::Process_vkGetFenceStatus(
     format::HandleId                            device,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceStatus");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetFenceStatus");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkWaitForFences(
@@ -603,16 +796,24 @@ void VulkanExportJsonConsumer::Process_vkWaitForFences(
     VkBool32                                    waitAll,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitForFences");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["fenceCount"], fenceCount, json_options);
-        HandleToJson(args["pFences"], pFences, json_options);
-        Bool32ToJson(args["waitAll"], waitAll, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkWaitForFences");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("fenceCount");
+        FieldToJson(jdata, fenceCount, json_options);
+        jdata.Key("pFences");
+        HandleToJson(jdata, pFences, json_options);
+        jdata.Key("waitAll");
+        Bool32ToJson(jdata, waitAll, json_options);
+        jdata.Key("timeout");
+        FieldToJson(jdata, timeout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateSemaphore(
@@ -623,15 +824,22 @@ void VulkanExportJsonConsumer::Process_vkCreateSemaphore(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSemaphore>*          pSemaphore)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSemaphore");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateSemaphore");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSemaphore"], pSemaphore, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSemaphore");
+        HandleToJson(jdata, pSemaphore, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroySemaphore(
@@ -640,13 +848,18 @@ void VulkanExportJsonConsumer::Process_vkDestroySemaphore(
     format::HandleId                            semaphore,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySemaphore");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroySemaphore");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("semaphore");
+        HandleToJson(jdata, semaphore, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateEvent(
@@ -657,15 +870,22 @@ void VulkanExportJsonConsumer::Process_vkCreateEvent(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkEvent>*              pEvent)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateEvent");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pEvent"], pEvent, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pEvent");
+        HandleToJson(jdata, pEvent, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyEvent(
@@ -674,13 +894,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyEvent(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyEvent");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetEventStatus(
@@ -689,13 +914,18 @@ void VulkanExportJsonConsumer::Process_vkGetEventStatus(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetEventStatus");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetEventStatus");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetEvent(
@@ -704,13 +934,18 @@ void VulkanExportJsonConsumer::Process_vkSetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetEvent");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetEvent(
@@ -719,13 +954,18 @@ void VulkanExportJsonConsumer::Process_vkResetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetEvent");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateQueryPool(
@@ -736,15 +976,22 @@ void VulkanExportJsonConsumer::Process_vkCreateQueryPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkQueryPool>*          pQueryPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateQueryPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pQueryPool"], pQueryPool, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pQueryPool");
+        HandleToJson(jdata, pQueryPool, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyQueryPool(
@@ -753,13 +1000,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyQueryPool(
     format::HandleId                            queryPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyQueryPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetQueryPoolResults(
@@ -774,19 +1026,30 @@ void VulkanExportJsonConsumer::Process_vkGetQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueryPoolResults");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-        FieldToJson(VkQueryResultFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetQueryPoolResults");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+        jdata.Key("queryCount");
+        FieldToJson(jdata, queryCount, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkQueryResultFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateBuffer(
@@ -797,15 +1060,22 @@ void VulkanExportJsonConsumer::Process_vkCreateBuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBuffer>*             pBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateBuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pBuffer"], pBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pBuffer");
+        HandleToJson(jdata, pBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyBuffer(
@@ -814,13 +1084,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyBuffer(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyBuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateBufferView(
@@ -831,15 +1106,22 @@ void VulkanExportJsonConsumer::Process_vkCreateBufferView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBufferView>*         pView)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateBufferView");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateBufferView");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pView"], pView, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pView");
+        HandleToJson(jdata, pView, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyBufferView(
@@ -848,13 +1130,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyBufferView(
     format::HandleId                            bufferView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyBufferView");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyBufferView");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["bufferView"], bufferView, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("bufferView");
+        HandleToJson(jdata, bufferView, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateImage(
@@ -865,15 +1152,22 @@ void VulkanExportJsonConsumer::Process_vkCreateImage(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImage>*              pImage)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImage");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pImage"], pImage, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pImage");
+        HandleToJson(jdata, pImage, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyImage(
@@ -882,13 +1176,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyImage(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyImage");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyImage");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout(
@@ -898,14 +1197,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout(
     StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageSubresourceLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSubresource"], pSubresource, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pSubresource");
+        FieldToJson(jdata, pSubresource, json_options);
+        jdata.Key("pLayout");
+        FieldToJson(jdata, pLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateImageView(
@@ -916,15 +1221,22 @@ void VulkanExportJsonConsumer::Process_vkCreateImageView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImageView>*          pView)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImageView");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateImageView");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pView"], pView, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pView");
+        HandleToJson(jdata, pView, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyImageView(
@@ -933,13 +1245,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyImageView(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyImageView");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyImageView");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("imageView");
+        HandleToJson(jdata, imageView, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyShaderModule(
@@ -948,13 +1265,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyShaderModule(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyShaderModule");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyShaderModule");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shaderModule"], shaderModule, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("shaderModule");
+        HandleToJson(jdata, shaderModule, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyPipelineCache(
@@ -963,13 +1285,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineCache(
     format::HandleId                            pipelineCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineCache");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyPipelineCache");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipelineCache");
+        HandleToJson(jdata, pipelineCache, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkMergePipelineCaches(
@@ -980,15 +1307,22 @@ void VulkanExportJsonConsumer::Process_vkMergePipelineCaches(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkPipelineCache>*      pSrcCaches)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMergePipelineCaches");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkMergePipelineCaches");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["dstCache"], dstCache, json_options);
-        FieldToJson(args["srcCacheCount"], srcCacheCount, json_options);
-        HandleToJson(args["pSrcCaches"], pSrcCaches, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("dstCache");
+        HandleToJson(jdata, dstCache, json_options);
+        jdata.Key("srcCacheCount");
+        FieldToJson(jdata, srcCacheCount, json_options);
+        jdata.Key("pSrcCaches");
+        HandleToJson(jdata, pSrcCaches, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateGraphicsPipelines(
@@ -1001,17 +1335,26 @@ void VulkanExportJsonConsumer::Process_vkCreateGraphicsPipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateGraphicsPipelines");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateGraphicsPipelines");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipelineCache");
+        HandleToJson(jdata, pipelineCache, json_options);
+        jdata.Key("createInfoCount");
+        FieldToJson(jdata, createInfoCount, json_options);
+        jdata.Key("pCreateInfos");
+        FieldToJson(jdata, pCreateInfos, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPipelines");
+        HandleToJson(jdata, pPipelines, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateComputePipelines(
@@ -1024,17 +1367,26 @@ void VulkanExportJsonConsumer::Process_vkCreateComputePipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateComputePipelines");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateComputePipelines");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipelineCache");
+        HandleToJson(jdata, pipelineCache, json_options);
+        jdata.Key("createInfoCount");
+        FieldToJson(jdata, createInfoCount, json_options);
+        jdata.Key("pCreateInfos");
+        FieldToJson(jdata, pCreateInfos, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPipelines");
+        HandleToJson(jdata, pPipelines, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyPipeline(
@@ -1043,13 +1395,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipeline(
     format::HandleId                            pipeline,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipeline");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyPipeline");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreatePipelineLayout(
@@ -1060,15 +1417,22 @@ void VulkanExportJsonConsumer::Process_vkCreatePipelineLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineLayout>*     pPipelineLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePipelineLayout");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreatePipelineLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelineLayout"], pPipelineLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPipelineLayout");
+        HandleToJson(jdata, pPipelineLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyPipelineLayout(
@@ -1077,13 +1441,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineLayout(
     format::HandleId                            pipelineLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineLayout");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyPipelineLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineLayout"], pipelineLayout, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipelineLayout");
+        HandleToJson(jdata, pipelineLayout, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateSampler(
@@ -1094,15 +1463,22 @@ void VulkanExportJsonConsumer::Process_vkCreateSampler(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSampler>*            pSampler)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSampler");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateSampler");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSampler"], pSampler, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSampler");
+        HandleToJson(jdata, pSampler, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroySampler(
@@ -1111,13 +1487,18 @@ void VulkanExportJsonConsumer::Process_vkDestroySampler(
     format::HandleId                            sampler,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySampler");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroySampler");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["sampler"], sampler, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("sampler");
+        HandleToJson(jdata, sampler, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDescriptorSetLayout(
@@ -1128,15 +1509,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorSetLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorSetLayout>* pSetLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorSetLayout");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDescriptorSetLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSetLayout"], pSetLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSetLayout");
+        HandleToJson(jdata, pSetLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDescriptorSetLayout(
@@ -1145,13 +1533,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorSetLayout(
     format::HandleId                            descriptorSetLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorSetLayout");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDescriptorSetLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorSetLayout"], descriptorSetLayout, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorSetLayout");
+        HandleToJson(jdata, descriptorSetLayout, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDescriptorPool(
@@ -1162,15 +1555,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorPool>*     pDescriptorPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDescriptorPool"], pDescriptorPool, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pDescriptorPool");
+        HandleToJson(jdata, pDescriptorPool, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDescriptorPool(
@@ -1179,13 +1579,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorPool(
     format::HandleId                            descriptorPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorPool"], descriptorPool, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorPool");
+        HandleToJson(jdata, descriptorPool, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetDescriptorPool(
@@ -1195,14 +1600,20 @@ void VulkanExportJsonConsumer::Process_vkResetDescriptorPool(
     format::HandleId                            descriptorPool,
     VkDescriptorPoolResetFlags                  flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetDescriptorPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorPool"], descriptorPool, json_options);
-        FieldToJson(VkDescriptorPoolResetFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorPool");
+        HandleToJson(jdata, descriptorPool, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkDescriptorPoolResetFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAllocateDescriptorSets(
@@ -1212,14 +1623,20 @@ void VulkanExportJsonConsumer::Process_vkAllocateDescriptorSets(
     StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateDescriptorSets");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAllocateDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocateInfo"], pAllocateInfo, json_options);
-        HandleToJson(args["pDescriptorSets"], pDescriptorSets, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAllocateInfo");
+        FieldToJson(jdata, pAllocateInfo, json_options);
+        jdata.Key("pDescriptorSets");
+        HandleToJson(jdata, pDescriptorSets, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkFreeDescriptorSets(
@@ -1230,15 +1647,22 @@ void VulkanExportJsonConsumer::Process_vkFreeDescriptorSets(
     uint32_t                                    descriptorSetCount,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeDescriptorSets");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkFreeDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorPool"], descriptorPool, json_options);
-        FieldToJson(args["descriptorSetCount"], descriptorSetCount, json_options);
-        HandleToJson(args["pDescriptorSets"], pDescriptorSets, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorPool");
+        HandleToJson(jdata, descriptorPool, json_options);
+        jdata.Key("descriptorSetCount");
+        FieldToJson(jdata, descriptorSetCount, json_options);
+        jdata.Key("pDescriptorSets");
+        HandleToJson(jdata, pDescriptorSets, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkUpdateDescriptorSets(
@@ -1249,15 +1673,22 @@ void VulkanExportJsonConsumer::Process_vkUpdateDescriptorSets(
     uint32_t                                    descriptorCopyCount,
     StructPointerDecoder<Decoded_VkCopyDescriptorSet>* pDescriptorCopies)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateDescriptorSets");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkUpdateDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["descriptorWriteCount"], descriptorWriteCount, json_options);
-        FieldToJson(args["pDescriptorWrites"], pDescriptorWrites, json_options);
-        FieldToJson(args["descriptorCopyCount"], descriptorCopyCount, json_options);
-        FieldToJson(args["pDescriptorCopies"], pDescriptorCopies, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorWriteCount");
+        FieldToJson(jdata, descriptorWriteCount, json_options);
+        jdata.Key("pDescriptorWrites");
+        FieldToJson(jdata, pDescriptorWrites, json_options);
+        jdata.Key("descriptorCopyCount");
+        FieldToJson(jdata, descriptorCopyCount, json_options);
+        jdata.Key("pDescriptorCopies");
+        FieldToJson(jdata, pDescriptorCopies, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateFramebuffer(
@@ -1268,15 +1699,22 @@ void VulkanExportJsonConsumer::Process_vkCreateFramebuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFramebuffer>*        pFramebuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateFramebuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateFramebuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFramebuffer"], pFramebuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pFramebuffer");
+        HandleToJson(jdata, pFramebuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyFramebuffer(
@@ -1285,13 +1723,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyFramebuffer(
     format::HandleId                            framebuffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyFramebuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyFramebuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["framebuffer"], framebuffer, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("framebuffer");
+        HandleToJson(jdata, framebuffer, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateRenderPass(
@@ -1302,15 +1745,22 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pRenderPass"], pRenderPass, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pRenderPass");
+        HandleToJson(jdata, pRenderPass, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyRenderPass(
@@ -1319,13 +1769,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyRenderPass(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyRenderPass");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["renderPass"], renderPass, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("renderPass");
+        HandleToJson(jdata, renderPass, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRenderAreaGranularity(
@@ -1334,13 +1789,18 @@ void VulkanExportJsonConsumer::Process_vkGetRenderAreaGranularity(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRenderAreaGranularity");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRenderAreaGranularity");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["renderPass"], renderPass, json_options);
-        FieldToJson(args["pGranularity"], pGranularity, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("renderPass");
+        HandleToJson(jdata, renderPass, json_options);
+        jdata.Key("pGranularity");
+        FieldToJson(jdata, pGranularity, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateCommandPool(
@@ -1351,15 +1811,22 @@ void VulkanExportJsonConsumer::Process_vkCreateCommandPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkCommandPool>*        pCommandPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateCommandPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pCommandPool"], pCommandPool, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pCommandPool");
+        HandleToJson(jdata, pCommandPool, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyCommandPool(
@@ -1368,13 +1835,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyCommandPool(
     format::HandleId                            commandPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyCommandPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("commandPool");
+        HandleToJson(jdata, commandPool, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetCommandPool(
@@ -1384,14 +1856,20 @@ void VulkanExportJsonConsumer::Process_vkResetCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolResetFlags                     flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetCommandPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(VkCommandPoolResetFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("commandPool");
+        HandleToJson(jdata, commandPool, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkCommandPoolResetFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAllocateCommandBuffers(
@@ -1401,14 +1879,20 @@ void VulkanExportJsonConsumer::Process_vkAllocateCommandBuffers(
     StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateCommandBuffers");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAllocateCommandBuffers");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocateInfo"], pAllocateInfo, json_options);
-        HandleToJson(args["pCommandBuffers"], pCommandBuffers, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAllocateInfo");
+        FieldToJson(jdata, pAllocateInfo, json_options);
+        jdata.Key("pCommandBuffers");
+        HandleToJson(jdata, pCommandBuffers, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkFreeCommandBuffers(
@@ -1418,14 +1902,20 @@ void VulkanExportJsonConsumer::Process_vkFreeCommandBuffers(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeCommandBuffers");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkFreeCommandBuffers");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(args["commandBufferCount"], commandBufferCount, json_options);
-        HandleToJson(args["pCommandBuffers"], pCommandBuffers, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("commandPool");
+        HandleToJson(jdata, commandPool, json_options);
+        jdata.Key("commandBufferCount");
+        FieldToJson(jdata, commandBufferCount, json_options);
+        jdata.Key("pCommandBuffers");
+        HandleToJson(jdata, pCommandBuffers, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBeginCommandBuffer(
@@ -1434,13 +1924,18 @@ void VulkanExportJsonConsumer::Process_vkBeginCommandBuffer(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBeginCommandBuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBeginCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBeginInfo"], pBeginInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pBeginInfo");
+        FieldToJson(jdata, pBeginInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkEndCommandBuffer(
@@ -1448,12 +1943,16 @@ void VulkanExportJsonConsumer::Process_vkEndCommandBuffer(
     VkResult                                    returnValue,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEndCommandBuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkEndCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetCommandBuffer(
@@ -1462,13 +1961,18 @@ void VulkanExportJsonConsumer::Process_vkResetCommandBuffer(
     format::HandleId                            commandBuffer,
     VkCommandBufferResetFlags                   flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetCommandBuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkCommandBufferResetFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkCommandBufferResetFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindPipeline(
@@ -1477,14 +1981,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBindPipeline(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindPipeline");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindPipeline");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineBindPoint");
+        FieldToJson(jdata, pipelineBindPoint, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewport(
@@ -1494,15 +2004,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewport(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewport");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewport");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewports"], pViewports, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstViewport");
+        FieldToJson(jdata, firstViewport, json_options);
+        jdata.Key("viewportCount");
+        FieldToJson(jdata, viewportCount, json_options);
+        jdata.Key("pViewports");
+        FieldToJson(jdata, pViewports, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetScissor(
@@ -1512,15 +2029,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissor(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissor");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetScissor");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstScissor"], firstScissor, json_options);
-        FieldToJson(args["scissorCount"], scissorCount, json_options);
-        FieldToJson(args["pScissors"], pScissors, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstScissor");
+        FieldToJson(jdata, firstScissor, json_options);
+        jdata.Key("scissorCount");
+        FieldToJson(jdata, scissorCount, json_options);
+        jdata.Key("pScissors");
+        FieldToJson(jdata, pScissors, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLineWidth(
@@ -1528,13 +2052,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineWidth(
     format::HandleId                            commandBuffer,
     float                                       lineWidth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineWidth");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLineWidth");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineWidth"], lineWidth, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("lineWidth");
+        FieldToJson(jdata, lineWidth, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias(
@@ -1544,15 +2073,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias(
     float                                       depthBiasClamp,
     float                                       depthBiasSlopeFactor)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBias");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["depthBiasConstantFactor"], depthBiasConstantFactor, json_options);
-        FieldToJson(args["depthBiasClamp"], depthBiasClamp, json_options);
-        FieldToJson(args["depthBiasSlopeFactor"], depthBiasSlopeFactor, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthBiasConstantFactor");
+        FieldToJson(jdata, depthBiasConstantFactor, json_options);
+        jdata.Key("depthBiasClamp");
+        FieldToJson(jdata, depthBiasClamp, json_options);
+        jdata.Key("depthBiasSlopeFactor");
+        FieldToJson(jdata, depthBiasSlopeFactor, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetBlendConstants(
@@ -1560,13 +2096,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetBlendConstants(
     format::HandleId                            commandBuffer,
     PointerDecoder<float>*                      blendConstants)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetBlendConstants");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetBlendConstants");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["blendConstants"], blendConstants, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("blendConstants");
+        FieldToJson(jdata, blendConstants, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBounds(
@@ -1575,14 +2116,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBounds(
     float                                       minDepthBounds,
     float                                       maxDepthBounds)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBounds");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBounds");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["minDepthBounds"], minDepthBounds, json_options);
-        FieldToJson(args["maxDepthBounds"], maxDepthBounds, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("minDepthBounds");
+        FieldToJson(jdata, minDepthBounds, json_options);
+        jdata.Key("maxDepthBounds");
+        FieldToJson(jdata, maxDepthBounds, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilCompareMask(
@@ -1591,14 +2138,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilCompareMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    compareMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilCompareMask");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilCompareMask");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["compareMask"], compareMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("faceMask");
+        FieldToJson(VkStencilFaceFlags_t(), jdata, faceMask, json_options);
+        jdata.Key("compareMask");
+        FieldToJson(jdata, compareMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilWriteMask(
@@ -1607,14 +2160,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilWriteMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    writeMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilWriteMask");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilWriteMask");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["writeMask"], writeMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("faceMask");
+        FieldToJson(VkStencilFaceFlags_t(), jdata, faceMask, json_options);
+        jdata.Key("writeMask");
+        FieldToJson(jdata, writeMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilReference(
@@ -1623,14 +2182,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilReference(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    reference)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilReference");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilReference");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["reference"], reference, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("faceMask");
+        FieldToJson(VkStencilFaceFlags_t(), jdata, faceMask, json_options);
+        jdata.Key("reference");
+        FieldToJson(jdata, reference, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets(
@@ -1644,19 +2209,30 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets(
     uint32_t                                    dynamicOffsetCount,
     PointerDecoder<uint32_t>*                   pDynamicOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["layout"], layout, json_options);
-        FieldToJson(args["firstSet"], firstSet, json_options);
-        FieldToJson(args["descriptorSetCount"], descriptorSetCount, json_options);
-        HandleToJson(args["pDescriptorSets"], pDescriptorSets, json_options);
-        FieldToJson(args["dynamicOffsetCount"], dynamicOffsetCount, json_options);
-        FieldToJson(args["pDynamicOffsets"], pDynamicOffsets, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindDescriptorSets");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineBindPoint");
+        FieldToJson(jdata, pipelineBindPoint, json_options);
+        jdata.Key("layout");
+        HandleToJson(jdata, layout, json_options);
+        jdata.Key("firstSet");
+        FieldToJson(jdata, firstSet, json_options);
+        jdata.Key("descriptorSetCount");
+        FieldToJson(jdata, descriptorSetCount, json_options);
+        jdata.Key("pDescriptorSets");
+        HandleToJson(jdata, pDescriptorSets, json_options);
+        jdata.Key("dynamicOffsetCount");
+        FieldToJson(jdata, dynamicOffsetCount, json_options);
+        jdata.Key("pDynamicOffsets");
+        FieldToJson(jdata, pDynamicOffsets, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer(
@@ -1666,15 +2242,22 @@ void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer(
     VkDeviceSize                                offset,
     VkIndexType                                 indexType)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindIndexBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["indexType"], indexType, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("indexType");
+        FieldToJson(jdata, indexType, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers(
@@ -1685,16 +2268,24 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers(
     HandlePointerDecoder<VkBuffer>*             pBuffers,
     PointerDecoder<VkDeviceSize>*               pOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindVertexBuffers");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstBinding");
+        FieldToJson(jdata, firstBinding, json_options);
+        jdata.Key("bindingCount");
+        FieldToJson(jdata, bindingCount, json_options);
+        jdata.Key("pBuffers");
+        HandleToJson(jdata, pBuffers, json_options);
+        jdata.Key("pOffsets");
+        FieldToJson(jdata, pOffsets, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDraw(
@@ -1705,16 +2296,24 @@ void VulkanExportJsonConsumer::Process_vkCmdDraw(
     uint32_t                                    firstVertex,
     uint32_t                                    firstInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDraw");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["vertexCount"], vertexCount, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstVertex"], firstVertex, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDraw");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("vertexCount");
+        FieldToJson(jdata, vertexCount, json_options);
+        jdata.Key("instanceCount");
+        FieldToJson(jdata, instanceCount, json_options);
+        jdata.Key("firstVertex");
+        FieldToJson(jdata, firstVertex, json_options);
+        jdata.Key("firstInstance");
+        FieldToJson(jdata, firstInstance, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndexed(
@@ -1726,17 +2325,26 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexed(
     int32_t                                     vertexOffset,
     uint32_t                                    firstInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexed");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["indexCount"], indexCount, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstIndex"], firstIndex, json_options);
-        FieldToJson(args["vertexOffset"], vertexOffset, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndexed");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("indexCount");
+        FieldToJson(jdata, indexCount, json_options);
+        jdata.Key("instanceCount");
+        FieldToJson(jdata, instanceCount, json_options);
+        jdata.Key("firstIndex");
+        FieldToJson(jdata, firstIndex, json_options);
+        jdata.Key("vertexOffset");
+        FieldToJson(jdata, vertexOffset, json_options);
+        jdata.Key("firstInstance");
+        FieldToJson(jdata, firstInstance, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndirect(
@@ -1747,16 +2355,24 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirect");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndirect");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("drawCount");
+        FieldToJson(jdata, drawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirect(
@@ -1767,16 +2383,24 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirect");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndexedIndirect");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("drawCount");
+        FieldToJson(jdata, drawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDispatch(
@@ -1786,15 +2410,22 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatch(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatch");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDispatch");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("groupCountX");
+        FieldToJson(jdata, groupCountX, json_options);
+        jdata.Key("groupCountY");
+        FieldToJson(jdata, groupCountY, json_options);
+        jdata.Key("groupCountZ");
+        FieldToJson(jdata, groupCountZ, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDispatchIndirect(
@@ -1803,14 +2434,20 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchIndirect(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchIndirect");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDispatchIndirect");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer(
@@ -1821,16 +2458,24 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcBuffer"], srcBuffer, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyBuffer");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcBuffer");
+        HandleToJson(jdata, srcBuffer, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("regionCount");
+        FieldToJson(jdata, regionCount, json_options);
+        jdata.Key("pRegions");
+        FieldToJson(jdata, pRegions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyImage(
@@ -1843,18 +2488,28 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageCopy>*  pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyImage");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcImage");
+        HandleToJson(jdata, srcImage, json_options);
+        jdata.Key("srcImageLayout");
+        FieldToJson(jdata, srcImageLayout, json_options);
+        jdata.Key("dstImage");
+        HandleToJson(jdata, dstImage, json_options);
+        jdata.Key("dstImageLayout");
+        FieldToJson(jdata, dstImageLayout, json_options);
+        jdata.Key("regionCount");
+        FieldToJson(jdata, regionCount, json_options);
+        jdata.Key("pRegions");
+        FieldToJson(jdata, pRegions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBlitImage(
@@ -1868,19 +2523,30 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage(
     StructPointerDecoder<Decoded_VkImageBlit>*  pRegions,
     VkFilter                                    filter)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-        FieldToJson(args["filter"], filter, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBlitImage");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcImage");
+        HandleToJson(jdata, srcImage, json_options);
+        jdata.Key("srcImageLayout");
+        FieldToJson(jdata, srcImageLayout, json_options);
+        jdata.Key("dstImage");
+        HandleToJson(jdata, dstImage, json_options);
+        jdata.Key("dstImageLayout");
+        FieldToJson(jdata, dstImageLayout, json_options);
+        jdata.Key("regionCount");
+        FieldToJson(jdata, regionCount, json_options);
+        jdata.Key("pRegions");
+        FieldToJson(jdata, pRegions, json_options);
+        jdata.Key("filter");
+        FieldToJson(jdata, filter, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage(
@@ -1892,17 +2558,26 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcBuffer"], srcBuffer, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyBufferToImage");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcBuffer");
+        HandleToJson(jdata, srcBuffer, json_options);
+        jdata.Key("dstImage");
+        HandleToJson(jdata, dstImage, json_options);
+        jdata.Key("dstImageLayout");
+        FieldToJson(jdata, dstImageLayout, json_options);
+        jdata.Key("regionCount");
+        FieldToJson(jdata, regionCount, json_options);
+        jdata.Key("pRegions");
+        FieldToJson(jdata, pRegions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer(
@@ -1914,17 +2589,26 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyImageToBuffer");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcImage");
+        HandleToJson(jdata, srcImage, json_options);
+        jdata.Key("srcImageLayout");
+        FieldToJson(jdata, srcImageLayout, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("regionCount");
+        FieldToJson(jdata, regionCount, json_options);
+        jdata.Key("pRegions");
+        FieldToJson(jdata, pRegions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdUpdateBuffer(
@@ -1935,16 +2619,24 @@ void VulkanExportJsonConsumer::Process_vkCmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdUpdateBuffer");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdUpdateBuffer");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("dstOffset");
+        FieldToJson(jdata, dstOffset, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdFillBuffer(
@@ -1955,16 +2647,24 @@ void VulkanExportJsonConsumer::Process_vkCmdFillBuffer(
     VkDeviceSize                                size,
     uint32_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdFillBuffer");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(args["data"], data, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdFillBuffer");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("dstOffset");
+        FieldToJson(jdata, dstOffset, json_options);
+        jdata.Key("size");
+        FieldToJson(jdata, size, json_options);
+        jdata.Key("data");
+        FieldToJson(jdata, data, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdClearColorImage(
@@ -1976,17 +2676,26 @@ void VulkanExportJsonConsumer::Process_vkCmdClearColorImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearColorImage");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
-        FieldToJson(args["pColor"], pColor, json_options);
-        FieldToJson(args["rangeCount"], rangeCount, json_options);
-        FieldToJson(args["pRanges"], pRanges, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdClearColorImage");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("imageLayout");
+        FieldToJson(jdata, imageLayout, json_options);
+        jdata.Key("pColor");
+        FieldToJson(jdata, pColor, json_options);
+        jdata.Key("rangeCount");
+        FieldToJson(jdata, rangeCount, json_options);
+        jdata.Key("pRanges");
+        FieldToJson(jdata, pRanges, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdClearDepthStencilImage(
@@ -1998,17 +2707,26 @@ void VulkanExportJsonConsumer::Process_vkCmdClearDepthStencilImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearDepthStencilImage");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
-        FieldToJson(args["pDepthStencil"], pDepthStencil, json_options);
-        FieldToJson(args["rangeCount"], rangeCount, json_options);
-        FieldToJson(args["pRanges"], pRanges, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdClearDepthStencilImage");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("imageLayout");
+        FieldToJson(jdata, imageLayout, json_options);
+        jdata.Key("pDepthStencil");
+        FieldToJson(jdata, pDepthStencil, json_options);
+        jdata.Key("rangeCount");
+        FieldToJson(jdata, rangeCount, json_options);
+        jdata.Key("pRanges");
+        FieldToJson(jdata, pRanges, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdClearAttachments(
@@ -2019,16 +2737,24 @@ void VulkanExportJsonConsumer::Process_vkCmdClearAttachments(
     uint32_t                                    rectCount,
     StructPointerDecoder<Decoded_VkClearRect>*  pRects)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearAttachments");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pAttachments"], pAttachments, json_options);
-        FieldToJson(args["rectCount"], rectCount, json_options);
-        FieldToJson(args["pRects"], pRects, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdClearAttachments");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("attachmentCount");
+        FieldToJson(jdata, attachmentCount, json_options);
+        jdata.Key("pAttachments");
+        FieldToJson(jdata, pAttachments, json_options);
+        jdata.Key("rectCount");
+        FieldToJson(jdata, rectCount, json_options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResolveImage(
@@ -2041,18 +2767,28 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageResolve>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResolveImage");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcImage");
+        HandleToJson(jdata, srcImage, json_options);
+        jdata.Key("srcImageLayout");
+        FieldToJson(jdata, srcImageLayout, json_options);
+        jdata.Key("dstImage");
+        HandleToJson(jdata, dstImage, json_options);
+        jdata.Key("dstImageLayout");
+        FieldToJson(jdata, dstImageLayout, json_options);
+        jdata.Key("regionCount");
+        FieldToJson(jdata, regionCount, json_options);
+        jdata.Key("pRegions");
+        FieldToJson(jdata, pRegions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetEvent(
@@ -2061,14 +2797,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["stageMask"], stageMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("stageMask");
+        FieldToJson(VkPipelineStageFlags_t(), jdata, stageMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResetEvent(
@@ -2077,14 +2819,20 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["stageMask"], stageMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("stageMask");
+        FieldToJson(VkPipelineStageFlags_t(), jdata, stageMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWaitEvents(
@@ -2101,22 +2849,36 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["eventCount"], eventCount, json_options);
-        HandleToJson(args["pEvents"], pEvents, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["srcStageMask"], srcStageMask, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["dstStageMask"], dstStageMask, json_options);
-        FieldToJson(args["memoryBarrierCount"], memoryBarrierCount, json_options);
-        FieldToJson(args["pMemoryBarriers"], pMemoryBarriers, json_options);
-        FieldToJson(args["bufferMemoryBarrierCount"], bufferMemoryBarrierCount, json_options);
-        FieldToJson(args["pBufferMemoryBarriers"], pBufferMemoryBarriers, json_options);
-        FieldToJson(args["imageMemoryBarrierCount"], imageMemoryBarrierCount, json_options);
-        FieldToJson(args["pImageMemoryBarriers"], pImageMemoryBarriers, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWaitEvents");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("eventCount");
+        FieldToJson(jdata, eventCount, json_options);
+        jdata.Key("pEvents");
+        HandleToJson(jdata, pEvents, json_options);
+        jdata.Key("srcStageMask");
+        FieldToJson(VkPipelineStageFlags_t(), jdata, srcStageMask, json_options);
+        jdata.Key("dstStageMask");
+        FieldToJson(VkPipelineStageFlags_t(), jdata, dstStageMask, json_options);
+        jdata.Key("memoryBarrierCount");
+        FieldToJson(jdata, memoryBarrierCount, json_options);
+        jdata.Key("pMemoryBarriers");
+        FieldToJson(jdata, pMemoryBarriers, json_options);
+        jdata.Key("bufferMemoryBarrierCount");
+        FieldToJson(jdata, bufferMemoryBarrierCount, json_options);
+        jdata.Key("pBufferMemoryBarriers");
+        FieldToJson(jdata, pBufferMemoryBarriers, json_options);
+        jdata.Key("imageMemoryBarrierCount");
+        FieldToJson(jdata, imageMemoryBarrierCount, json_options);
+        jdata.Key("pImageMemoryBarriers");
+        FieldToJson(jdata, pImageMemoryBarriers, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier(
@@ -2132,21 +2894,34 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["srcStageMask"], srcStageMask, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["dstStageMask"], dstStageMask, json_options);
-        FieldToJson(VkDependencyFlags_t(), args["dependencyFlags"], dependencyFlags, json_options);
-        FieldToJson(args["memoryBarrierCount"], memoryBarrierCount, json_options);
-        FieldToJson(args["pMemoryBarriers"], pMemoryBarriers, json_options);
-        FieldToJson(args["bufferMemoryBarrierCount"], bufferMemoryBarrierCount, json_options);
-        FieldToJson(args["pBufferMemoryBarriers"], pBufferMemoryBarriers, json_options);
-        FieldToJson(args["imageMemoryBarrierCount"], imageMemoryBarrierCount, json_options);
-        FieldToJson(args["pImageMemoryBarriers"], pImageMemoryBarriers, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPipelineBarrier");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("srcStageMask");
+        FieldToJson(VkPipelineStageFlags_t(), jdata, srcStageMask, json_options);
+        jdata.Key("dstStageMask");
+        FieldToJson(VkPipelineStageFlags_t(), jdata, dstStageMask, json_options);
+        jdata.Key("dependencyFlags");
+        FieldToJson(VkDependencyFlags_t(), jdata, dependencyFlags, json_options);
+        jdata.Key("memoryBarrierCount");
+        FieldToJson(jdata, memoryBarrierCount, json_options);
+        jdata.Key("pMemoryBarriers");
+        FieldToJson(jdata, pMemoryBarriers, json_options);
+        jdata.Key("bufferMemoryBarrierCount");
+        FieldToJson(jdata, bufferMemoryBarrierCount, json_options);
+        jdata.Key("pBufferMemoryBarriers");
+        FieldToJson(jdata, pBufferMemoryBarriers, json_options);
+        jdata.Key("imageMemoryBarrierCount");
+        FieldToJson(jdata, imageMemoryBarrierCount, json_options);
+        jdata.Key("pImageMemoryBarriers");
+        FieldToJson(jdata, pImageMemoryBarriers, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginQuery(
@@ -2156,15 +2931,22 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginQuery(
     uint32_t                                    query,
     VkQueryControlFlags                         flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginQuery");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginQuery");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-        FieldToJson(VkQueryControlFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkQueryControlFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndQuery(
@@ -2173,14 +2955,20 @@ void VulkanExportJsonConsumer::Process_vkCmdEndQuery(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndQuery");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndQuery");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResetQueryPool(
@@ -2190,15 +2978,22 @@ void VulkanExportJsonConsumer::Process_vkCmdResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetQueryPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResetQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+        jdata.Key("queryCount");
+        FieldToJson(jdata, queryCount, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp(
@@ -2208,15 +3003,22 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteTimestamp");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineStage"], pipelineStage, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineStage");
+        FieldToJson(jdata, pipelineStage, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyQueryPoolResults(
@@ -2230,19 +3032,30 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyQueryPoolResults");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-        FieldToJson(VkQueryResultFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyQueryPoolResults");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+        jdata.Key("queryCount");
+        FieldToJson(jdata, queryCount, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("dstOffset");
+        FieldToJson(jdata, dstOffset, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkQueryResultFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass(
@@ -2251,14 +3064,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     VkSubpassContents                           contents)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderPassBegin"], pRenderPassBegin, json_options);
-        FieldToJson(args["contents"], contents, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRenderPassBegin");
+        FieldToJson(jdata, pRenderPassBegin, json_options);
+        jdata.Key("contents");
+        FieldToJson(jdata, contents, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdNextSubpass(
@@ -2266,25 +3085,34 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass(
     format::HandleId                            commandBuffer,
     VkSubpassContents                           contents)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdNextSubpass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["contents"], contents, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("contents");
+        FieldToJson(jdata, contents, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdExecuteCommands(
@@ -2293,14 +3121,20 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteCommands(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteCommands");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdExecuteCommands");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["commandBufferCount"], commandBufferCount, json_options);
-        HandleToJson(args["pCommandBuffers"], pCommandBuffers, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("commandBufferCount");
+        FieldToJson(jdata, commandBufferCount, json_options);
+        jdata.Key("pCommandBuffers");
+        HandleToJson(jdata, pCommandBuffers, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindBufferMemory2(
@@ -2310,14 +3144,20 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindBufferMemory2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("bindInfoCount");
+        FieldToJson(jdata, bindInfoCount, json_options);
+        jdata.Key("pBindInfos");
+        FieldToJson(jdata, pBindInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindImageMemory2(
@@ -2327,14 +3167,20 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindImageMemory2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("bindInfoCount");
+        FieldToJson(jdata, bindInfoCount, json_options);
+        jdata.Key("pBindInfos");
+        FieldToJson(jdata, pBindInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
@@ -2345,15 +3191,22 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeatures");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeatures");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["heapIndex"], heapIndex, json_options);
-        FieldToJson(args["localDeviceIndex"], localDeviceIndex, json_options);
-        FieldToJson(args["remoteDeviceIndex"], remoteDeviceIndex, json_options);
-        FieldToJson(args["pPeerMemoryFeatures"], pPeerMemoryFeatures, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("heapIndex");
+        FieldToJson(jdata, heapIndex, json_options);
+        jdata.Key("localDeviceIndex");
+        FieldToJson(jdata, localDeviceIndex, json_options);
+        jdata.Key("remoteDeviceIndex");
+        FieldToJson(jdata, remoteDeviceIndex, json_options);
+        jdata.Key("pPeerMemoryFeatures");
+        FieldToJson(jdata, pPeerMemoryFeatures, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMask(
@@ -2361,13 +3214,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMask(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMask");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDeviceMask");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["deviceMask"], deviceMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("deviceMask");
+        FieldToJson(jdata, deviceMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDispatchBase(
@@ -2380,18 +3238,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchBase(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBase");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["baseGroupX"], baseGroupX, json_options);
-        FieldToJson(args["baseGroupY"], baseGroupY, json_options);
-        FieldToJson(args["baseGroupZ"], baseGroupZ, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDispatchBase");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("baseGroupX");
+        FieldToJson(jdata, baseGroupX, json_options);
+        jdata.Key("baseGroupY");
+        FieldToJson(jdata, baseGroupY, json_options);
+        jdata.Key("baseGroupZ");
+        FieldToJson(jdata, baseGroupZ, json_options);
+        jdata.Key("groupCountX");
+        FieldToJson(jdata, groupCountX, json_options);
+        jdata.Key("groupCountY");
+        FieldToJson(jdata, groupCountY, json_options);
+        jdata.Key("groupCountZ");
+        FieldToJson(jdata, groupCountZ, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroups(
@@ -2401,14 +3269,20 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroups(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroups");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroups");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupCount"], pPhysicalDeviceGroupCount, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupProperties"], pPhysicalDeviceGroupProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pPhysicalDeviceGroupCount");
+        FieldToJson(jdata, pPhysicalDeviceGroupCount, json_options);
+        jdata.Key("pPhysicalDeviceGroupProperties");
+        FieldToJson(jdata, pPhysicalDeviceGroupProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2(
@@ -2417,13 +3291,18 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2(
@@ -2432,13 +3311,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2(
@@ -2448,14 +3332,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pSparseMemoryRequirementCount");
+        FieldToJson(jdata, pSparseMemoryRequirementCount, json_options);
+        jdata.Key("pSparseMemoryRequirements");
+        FieldToJson(jdata, pSparseMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2(
@@ -2463,12 +3353,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFeatures"], pFeatures, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pFeatures");
+        FieldToJson(jdata, pFeatures, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2(
@@ -2476,12 +3370,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
@@ -2490,13 +3388,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["pFormatProperties"], pFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("format");
+        FieldToJson(jdata, format, json_options);
+        jdata.Key("pFormatProperties");
+        FieldToJson(jdata, pFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2(
@@ -2506,14 +3409,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pImageFormatInfo"], pImageFormatInfo, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pImageFormatInfo");
+        FieldToJson(jdata, pImageFormatInfo, json_options);
+        jdata.Key("pImageFormatProperties");
+        FieldToJson(jdata, pImageFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2(
@@ -2522,13 +3431,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQueueFamilyPropertyCount"], pQueueFamilyPropertyCount, json_options);
-        FieldToJson(args["pQueueFamilyProperties"], pQueueFamilyProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pQueueFamilyPropertyCount");
+        FieldToJson(jdata, pQueueFamilyPropertyCount, json_options);
+        jdata.Key("pQueueFamilyProperties");
+        FieldToJson(jdata, pQueueFamilyProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
@@ -2536,12 +3450,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pMemoryProperties"], pMemoryProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pMemoryProperties");
+        FieldToJson(jdata, pMemoryProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2(
@@ -2551,14 +3469,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFormatInfo"], pFormatInfo, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pFormatInfo");
+        FieldToJson(jdata, pFormatInfo, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkTrimCommandPool(
@@ -2567,13 +3491,18 @@ void VulkanExportJsonConsumer::Process_vkTrimCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTrimCommandPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkTrimCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(VkCommandPoolTrimFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("commandPool");
+        HandleToJson(jdata, commandPool, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkCommandPoolTrimFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceQueue2(
@@ -2582,13 +3511,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceQueue2(
     StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceQueue2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pQueueInfo"], pQueueInfo, json_options);
-        HandleToJson(args["pQueue"], pQueue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pQueueInfo");
+        FieldToJson(jdata, pQueueInfo, json_options);
+        jdata.Key("pQueue");
+        HandleToJson(jdata, pQueue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversion(
@@ -2599,15 +3533,22 @@ void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversion(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversion");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateSamplerYcbcrConversion");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pYcbcrConversion"], pYcbcrConversion, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pYcbcrConversion");
+        HandleToJson(jdata, pYcbcrConversion, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversion(
@@ -2616,13 +3557,18 @@ void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversion(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversion");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroySamplerYcbcrConversion");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["ycbcrConversion"], ycbcrConversion, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("ycbcrConversion");
+        HandleToJson(jdata, ycbcrConversion, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplate(
@@ -2633,15 +3579,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplate(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplate");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDescriptorUpdateTemplate");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDescriptorUpdateTemplate"], pDescriptorUpdateTemplate, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pDescriptorUpdateTemplate");
+        HandleToJson(jdata, pDescriptorUpdateTemplate, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplate(
@@ -2650,13 +3603,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplate(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplate");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplate");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorUpdateTemplate"], descriptorUpdateTemplate, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorUpdateTemplate");
+        HandleToJson(jdata, descriptorUpdateTemplate, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperties(
@@ -2665,13 +3623,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperti
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalBufferInfo"], pExternalBufferInfo, json_options);
-        FieldToJson(args["pExternalBufferProperties"], pExternalBufferProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pExternalBufferInfo");
+        FieldToJson(jdata, pExternalBufferInfo, json_options);
+        jdata.Key("pExternalBufferProperties");
+        FieldToJson(jdata, pExternalBufferProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFenceProperties(
@@ -2680,13 +3643,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertie
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFenceProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalFenceProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalFenceInfo"], pExternalFenceInfo, json_options);
-        FieldToJson(args["pExternalFenceProperties"], pExternalFenceProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pExternalFenceInfo");
+        FieldToJson(jdata, pExternalFenceInfo, json_options);
+        jdata.Key("pExternalFenceProperties");
+        FieldToJson(jdata, pExternalFenceProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties(
@@ -2695,13 +3663,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePrope
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphoreProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphoreProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalSemaphoreInfo"], pExternalSemaphoreInfo, json_options);
-        FieldToJson(args["pExternalSemaphoreProperties"], pExternalSemaphoreProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pExternalSemaphoreInfo");
+        FieldToJson(jdata, pExternalSemaphoreInfo, json_options);
+        jdata.Key("pExternalSemaphoreProperties");
+        FieldToJson(jdata, pExternalSemaphoreProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupport(
@@ -2710,13 +3683,18 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupport(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupport");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDescriptorSetLayoutSupport");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pSupport"], pSupport, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pSupport");
+        FieldToJson(jdata, pSupport, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCount(
@@ -2729,18 +3707,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCount");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndirectCount");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCount(
@@ -2753,18 +3741,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCount");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndexedIndirectCount");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateRenderPass2(
@@ -2775,15 +3773,22 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass2(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pRenderPass"], pRenderPass, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pRenderPass");
+        HandleToJson(jdata, pRenderPass, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2(
@@ -2792,14 +3797,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderPassBegin"], pRenderPassBegin, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRenderPassBegin");
+        FieldToJson(jdata, pRenderPassBegin, json_options);
+        jdata.Key("pSubpassBeginInfo");
+        FieldToJson(jdata, pSubpassBeginInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2(
@@ -2808,14 +3819,20 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdNextSubpass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pSubpassBeginInfo");
+        FieldToJson(jdata, pSubpassBeginInfo, json_options);
+        jdata.Key("pSubpassEndInfo");
+        FieldToJson(jdata, pSubpassEndInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2(
@@ -2823,13 +3840,18 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pSubpassEndInfo");
+        FieldToJson(jdata, pSubpassEndInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetQueryPool(
@@ -2839,14 +3861,20 @@ void VulkanExportJsonConsumer::Process_vkResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetQueryPool");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+        jdata.Key("queryCount");
+        FieldToJson(jdata, queryCount, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValue(
@@ -2856,14 +3884,20 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValue(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValue");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSemaphoreCounterValue");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        FieldToJson(args["pValue"], pValue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("semaphore");
+        HandleToJson(jdata, semaphore, json_options);
+        jdata.Key("pValue");
+        FieldToJson(jdata, pValue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkWaitSemaphores(
@@ -2873,14 +3907,20 @@ void VulkanExportJsonConsumer::Process_vkWaitSemaphores(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitSemaphores");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkWaitSemaphores");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pWaitInfo"], pWaitInfo, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pWaitInfo");
+        FieldToJson(jdata, pWaitInfo, json_options);
+        jdata.Key("timeout");
+        FieldToJson(jdata, timeout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSignalSemaphore(
@@ -2889,13 +3929,18 @@ void VulkanExportJsonConsumer::Process_vkSignalSemaphore(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSignalSemaphore");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSignalSemaphore");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pSignalInfo"], pSignalInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pSignalInfo");
+        FieldToJson(jdata, pSignalInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddress(
@@ -2904,13 +3949,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddress");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferDeviceAddress");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJsonAsHex(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddress(
@@ -2919,13 +3969,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddress");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddress");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
@@ -2934,13 +3989,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddress");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddress");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolProperties(
@@ -2950,14 +4010,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolProperties(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolProperties");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceToolProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pToolCount"], pToolCount, json_options);
-        FieldToJson(args["pToolProperties"], pToolProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pToolCount");
+        FieldToJson(jdata, pToolCount, json_options);
+        jdata.Key("pToolProperties");
+        FieldToJson(jdata, pToolProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlot(
@@ -2968,15 +4034,22 @@ void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlot(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlot");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreatePrivateDataSlot");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPrivateDataSlot"], pPrivateDataSlot, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPrivateDataSlot");
+        HandleToJson(jdata, pPrivateDataSlot, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlot(
@@ -2985,13 +4058,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlot(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlot");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyPrivateDataSlot");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("privateDataSlot");
+        HandleToJson(jdata, privateDataSlot, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetPrivateData(
@@ -3003,16 +4081,24 @@ void VulkanExportJsonConsumer::Process_vkSetPrivateData(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetPrivateData");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["data"], data, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetPrivateData");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("objectType");
+        FieldToJson(jdata, objectType, json_options);
+        jdata.Key("objectHandle");
+        HandleToJson(jdata, objectHandle, json_options);
+        jdata.Key("privateDataSlot");
+        HandleToJson(jdata, privateDataSlot, json_options);
+        jdata.Key("data");
+        FieldToJson(jdata, data, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPrivateData(
@@ -3023,15 +4109,22 @@ void VulkanExportJsonConsumer::Process_vkGetPrivateData(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPrivateData");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPrivateData");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("objectType");
+        FieldToJson(jdata, objectType, json_options);
+        jdata.Key("objectHandle");
+        HandleToJson(jdata, objectHandle, json_options);
+        jdata.Key("privateDataSlot");
+        HandleToJson(jdata, privateDataSlot, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetEvent2(
@@ -3040,14 +4133,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent2(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetEvent2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("pDependencyInfo");
+        FieldToJson(jdata, pDependencyInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResetEvent2(
@@ -3056,14 +4155,20 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent2(
     format::HandleId                            event,
     VkPipelineStageFlags2                       stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResetEvent2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stageMask"], stageMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("stageMask");
+        FieldToJson(VkPipelineStageFlags2_t(), jdata, stageMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2(
@@ -3073,15 +4178,22 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWaitEvents2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["eventCount"], eventCount, json_options);
-        HandleToJson(args["pEvents"], pEvents, json_options);
-        FieldToJson(args["pDependencyInfos"], pDependencyInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("eventCount");
+        FieldToJson(jdata, eventCount, json_options);
+        jdata.Key("pEvents");
+        HandleToJson(jdata, pEvents, json_options);
+        jdata.Key("pDependencyInfos");
+        FieldToJson(jdata, pDependencyInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2(
@@ -3089,13 +4201,18 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPipelineBarrier2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pDependencyInfo");
+        FieldToJson(jdata, pDependencyInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2(
@@ -3105,15 +4222,22 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteTimestamp2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stage"], stage, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stage");
+        FieldToJson(VkPipelineStageFlags2_t(), jdata, stage, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueSubmit2(
@@ -3124,16 +4248,24 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit2(
     StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["submitCount"], submitCount, json_options);
-        FieldToJson(args["pSubmits"], pSubmits, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueSubmit2");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameSubmitIndex());
+    FieldToJson(jdata, ++submit_index_, json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("submitCount");
+        FieldToJson(jdata, submitCount, json_options);
+        jdata.Key("pSubmits");
+        FieldToJson(jdata, pSubmits, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2(
@@ -3141,13 +4273,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyBuffer2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferInfo"], pCopyBufferInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyBufferInfo");
+        FieldToJson(jdata, pCopyBufferInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyImage2(
@@ -3155,13 +4292,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageInfo"], pCopyImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyImageInfo");
+        FieldToJson(jdata, pCopyImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2(
@@ -3169,13 +4311,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyBufferToImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferToImageInfo"], pCopyBufferToImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyBufferToImageInfo");
+        FieldToJson(jdata, pCopyBufferToImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2(
@@ -3183,13 +4330,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyImageToBuffer2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageToBufferInfo"], pCopyImageToBufferInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyImageToBufferInfo");
+        FieldToJson(jdata, pCopyImageToBufferInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBlitImage2(
@@ -3197,13 +4349,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBlitImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBlitImageInfo"], pBlitImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pBlitImageInfo");
+        FieldToJson(jdata, pBlitImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResolveImage2(
@@ -3211,13 +4368,18 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResolveImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pResolveImageInfo"], pResolveImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pResolveImageInfo");
+        FieldToJson(jdata, pResolveImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginRendering(
@@ -3225,25 +4387,34 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRendering(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRendering");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginRendering");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderingInfo"], pRenderingInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRenderingInfo");
+        FieldToJson(jdata, pRenderingInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndRendering(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRendering");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndRendering");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCullMode(
@@ -3251,13 +4422,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCullMode(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCullMode");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCullMode");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkCullModeFlags_t(), args["cullMode"], cullMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("cullMode");
+        FieldToJson(VkCullModeFlags_t(), jdata, cullMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetFrontFace(
@@ -3265,13 +4441,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFrontFace(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFace");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetFrontFace");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["frontFace"], frontFace, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("frontFace");
+        FieldToJson(jdata, frontFace, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopology(
@@ -3279,13 +4460,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopology(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopology");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPrimitiveTopology");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["primitiveTopology"], primitiveTopology, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("primitiveTopology");
+        FieldToJson(jdata, primitiveTopology, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCount(
@@ -3294,14 +4480,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCount(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCount");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewportWithCount");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewports"], pViewports, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("viewportCount");
+        FieldToJson(jdata, viewportCount, json_options);
+        jdata.Key("pViewports");
+        FieldToJson(jdata, pViewports, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCount(
@@ -3310,14 +4502,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCount(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCount");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetScissorWithCount");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["scissorCount"], scissorCount, json_options);
-        FieldToJson(args["pScissors"], pScissors, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("scissorCount");
+        FieldToJson(jdata, scissorCount, json_options);
+        jdata.Key("pScissors");
+        FieldToJson(jdata, pScissors, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2(
@@ -3330,18 +4528,28 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-        FieldToJson(args["pSizes"], pSizes, json_options);
-        FieldToJson(args["pStrides"], pStrides, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindVertexBuffers2");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstBinding");
+        FieldToJson(jdata, firstBinding, json_options);
+        jdata.Key("bindingCount");
+        FieldToJson(jdata, bindingCount, json_options);
+        jdata.Key("pBuffers");
+        HandleToJson(jdata, pBuffers, json_options);
+        jdata.Key("pOffsets");
+        FieldToJson(jdata, pOffsets, json_options);
+        jdata.Key("pSizes");
+        FieldToJson(jdata, pSizes, json_options);
+        jdata.Key("pStrides");
+        FieldToJson(jdata, pStrides, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnable(
@@ -3349,13 +4557,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthTestEnable"], depthTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthTestEnable");
+        Bool32ToJson(jdata, depthTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnable(
@@ -3363,13 +4576,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthWriteEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthWriteEnable"], depthWriteEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthWriteEnable");
+        Bool32ToJson(jdata, depthWriteEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOp(
@@ -3377,13 +4595,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOp(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOp");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthCompareOp");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["depthCompareOp"], depthCompareOp, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthCompareOp");
+        FieldToJson(jdata, depthCompareOp, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnable(
@@ -3391,13 +4614,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBoundsTestEnable"], depthBoundsTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthBoundsTestEnable");
+        Bool32ToJson(jdata, depthBoundsTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnable(
@@ -3405,13 +4633,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["stencilTestEnable"], stencilTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stencilTestEnable");
+        Bool32ToJson(jdata, stencilTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilOp(
@@ -3423,17 +4656,26 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilOp(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOp");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["failOp"], failOp, json_options);
-        FieldToJson(args["passOp"], passOp, json_options);
-        FieldToJson(args["depthFailOp"], depthFailOp, json_options);
-        FieldToJson(args["compareOp"], compareOp, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilOp");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("faceMask");
+        FieldToJson(VkStencilFaceFlags_t(), jdata, faceMask, json_options);
+        jdata.Key("failOp");
+        FieldToJson(jdata, failOp, json_options);
+        jdata.Key("passOp");
+        FieldToJson(jdata, passOp, json_options);
+        jdata.Key("depthFailOp");
+        FieldToJson(jdata, depthFailOp, json_options);
+        jdata.Key("compareOp");
+        FieldToJson(jdata, compareOp, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnable(
@@ -3441,13 +4683,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["rasterizerDiscardEnable"], rasterizerDiscardEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("rasterizerDiscardEnable");
+        Bool32ToJson(jdata, rasterizerDiscardEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnable(
@@ -3455,13 +4702,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBiasEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBiasEnable"], depthBiasEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthBiasEnable");
+        Bool32ToJson(jdata, depthBiasEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnable(
@@ -3469,13 +4721,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnable");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["primitiveRestartEnable"], primitiveRestartEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("primitiveRestartEnable");
+        Bool32ToJson(jdata, primitiveRestartEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirements(
@@ -3484,13 +4741,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirements(
     StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirements");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirements(
@@ -3499,13 +4761,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirements(
     StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirements");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceImageMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirements(
@@ -3515,14 +4782,20 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirements");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pSparseMemoryRequirementCount");
+        FieldToJson(jdata, pSparseMemoryRequirementCount, json_options);
+        jdata.Key("pSparseMemoryRequirements");
+        FieldToJson(jdata, pSparseMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroySurfaceKHR(
@@ -3531,13 +4804,18 @@ void VulkanExportJsonConsumer::Process_vkDestroySurfaceKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroySurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
@@ -3548,15 +4826,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
     format::HandleId                            surface,
     PointerDecoder<VkBool32>*                   pSupported)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceSupportKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        Bool32ToJson(args["pSupported"], pSupported, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pSupported");
+        Bool32ToJson(jdata, pSupported, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
@@ -3566,14 +4851,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilitiesKHR>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pSurfaceCapabilities"], pSurfaceCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pSurfaceCapabilities");
+        FieldToJson(jdata, pSurfaceCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
@@ -3584,15 +4875,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormatKHR>* pSurfaceFormats)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormatsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pSurfaceFormatCount"], pSurfaceFormatCount, json_options);
-        FieldToJson(args["pSurfaceFormats"], pSurfaceFormats, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pSurfaceFormatCount");
+        FieldToJson(jdata, pSurfaceFormatCount, json_options);
+        jdata.Key("pSurfaceFormats");
+        FieldToJson(jdata, pSurfaceFormats, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR(
@@ -3603,15 +4901,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pPresentModeCount"], pPresentModeCount, json_options);
-        FieldToJson(args["pPresentModes"], pPresentModes, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pPresentModeCount");
+        FieldToJson(jdata, pPresentModeCount, json_options);
+        jdata.Key("pPresentModes");
+        FieldToJson(jdata, pPresentModes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateSwapchainKHR(
@@ -3622,15 +4927,22 @@ void VulkanExportJsonConsumer::Process_vkCreateSwapchainKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSwapchainKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateSwapchainKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSwapchain"], pSwapchain, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSwapchain");
+        HandleToJson(jdata, pSwapchain, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroySwapchainKHR(
@@ -3639,13 +4951,18 @@ void VulkanExportJsonConsumer::Process_vkDestroySwapchainKHR(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySwapchainKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroySwapchainKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSwapchainImagesKHR(
@@ -3656,15 +4973,22 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainImagesKHR(
     PointerDecoder<uint32_t>*                   pSwapchainImageCount,
     HandlePointerDecoder<VkImage>*              pSwapchainImages)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainImagesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSwapchainImagesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pSwapchainImageCount"], pSwapchainImageCount, json_options);
-        HandleToJson(args["pSwapchainImages"], pSwapchainImages, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pSwapchainImageCount");
+        FieldToJson(jdata, pSwapchainImageCount, json_options);
+        jdata.Key("pSwapchainImages");
+        HandleToJson(jdata, pSwapchainImages, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireNextImageKHR(
@@ -3677,17 +5001,26 @@ void VulkanExportJsonConsumer::Process_vkAcquireNextImageKHR(
     format::HandleId                            fence,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireNextImageKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-        FieldToJson(args["pImageIndex"], pImageIndex, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireNextImageKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("timeout");
+        FieldToJson(jdata, timeout, json_options);
+        jdata.Key("semaphore");
+        HandleToJson(jdata, semaphore, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+        jdata.Key("pImageIndex");
+        FieldToJson(jdata, pImageIndex, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueuePresentKHR(
@@ -3696,14 +5029,20 @@ void VulkanExportJsonConsumer::Process_vkQueuePresentKHR(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueuePresentKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueuePresentKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pPresentInfo"], pPresentInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameSubmitIndex());
+    FieldToJson(jdata, ++submit_index_, json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("pPresentInfo");
+        FieldToJson(jdata, pPresentInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
@@ -3712,13 +5051,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceGroupPresentCapabilitiesKHR>* pDeviceGroupPresentCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPresentCapabilitiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceGroupPresentCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pDeviceGroupPresentCapabilities"], pDeviceGroupPresentCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pDeviceGroupPresentCapabilities");
+        FieldToJson(jdata, pDeviceGroupPresentCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
@@ -3728,14 +5072,20 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
     format::HandleId                            surface,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pModes"], pModes, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pModes");
+        FieldToJson(jdata, pModes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
@@ -3746,15 +5096,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
     PointerDecoder<uint32_t>*                   pRectCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pRects)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDevicePresentRectanglesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDevicePresentRectanglesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pRectCount"], pRectCount, json_options);
-        FieldToJson(args["pRects"], pRects, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pRectCount");
+        FieldToJson(jdata, pRectCount, json_options);
+        jdata.Key("pRects");
+        FieldToJson(jdata, pRects, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireNextImage2KHR(
@@ -3764,14 +5121,20 @@ void VulkanExportJsonConsumer::Process_vkAcquireNextImage2KHR(
     StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireNextImage2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireNextImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAcquireInfo"], pAcquireInfo, json_options);
-        FieldToJson(args["pImageIndex"], pImageIndex, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAcquireInfo");
+        FieldToJson(jdata, pAcquireInfo, json_options);
+        jdata.Key("pImageIndex");
+        FieldToJson(jdata, pImageIndex, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
@@ -3781,14 +5144,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
@@ -3798,14 +5167,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlanePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
@@ -3816,15 +5191,22 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
     PointerDecoder<uint32_t>*                   pDisplayCount,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplays)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneSupportedDisplaysKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDisplayPlaneSupportedDisplaysKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["planeIndex"], planeIndex, json_options);
-        FieldToJson(args["pDisplayCount"], pDisplayCount, json_options);
-        HandleToJson(args["pDisplays"], pDisplays, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("planeIndex");
+        FieldToJson(jdata, planeIndex, json_options);
+        jdata.Key("pDisplayCount");
+        FieldToJson(jdata, pDisplayCount, json_options);
+        jdata.Key("pDisplays");
+        HandleToJson(jdata, pDisplays, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDisplayModePropertiesKHR(
@@ -3835,15 +5217,22 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayModePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayModePropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDisplayModePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDisplayModeKHR(
@@ -3855,16 +5244,24 @@ void VulkanExportJsonConsumer::Process_vkCreateDisplayModeKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDisplayModeKHR>*     pMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDisplayModeKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMode"], pMode, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDisplayModeKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pMode");
+        HandleToJson(jdata, pMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
@@ -3875,15 +5272,22 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
     uint32_t                                    planeIndex,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilitiesKHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilitiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDisplayPlaneCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["mode"], mode, json_options);
-        FieldToJson(args["planeIndex"], planeIndex, json_options);
-        FieldToJson(args["pCapabilities"], pCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("mode");
+        HandleToJson(jdata, mode, json_options);
+        jdata.Key("planeIndex");
+        FieldToJson(jdata, planeIndex, json_options);
+        jdata.Key("pCapabilities");
+        FieldToJson(jdata, pCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
@@ -3894,15 +5298,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDisplayPlaneSurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDisplayPlaneSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateSharedSwapchainsKHR(
@@ -3914,16 +5325,24 @@ void VulkanExportJsonConsumer::Process_vkCreateSharedSwapchainsKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSharedSwapchainsKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["swapchainCount"], swapchainCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSwapchains"], pSwapchains, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateSharedSwapchainsKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchainCount");
+        FieldToJson(jdata, swapchainCount, json_options);
+        jdata.Key("pCreateInfos");
+        FieldToJson(jdata, pCreateInfos, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSwapchains");
+        HandleToJson(jdata, pSwapchains, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateXlibSurfaceKHR(
@@ -3934,15 +5353,22 @@ void VulkanExportJsonConsumer::Process_vkCreateXlibSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateXlibSurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateXlibSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(
@@ -3953,15 +5379,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXlibPresentationSuppor
     uint64_t                                    dpy,
     size_t                                      visualID)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["dpy"], dpy, json_options);
-        FieldToJson(args["visualID"], visualID, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    Bool32ToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("dpy");
+        FieldToJson(jdata, dpy, json_options);
+        jdata.Key("visualID");
+        FieldToJson(jdata, visualID, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateXcbSurfaceKHR(
@@ -3972,15 +5405,22 @@ void VulkanExportJsonConsumer::Process_vkCreateXcbSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateXcbSurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateXcbSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(
@@ -3991,15 +5431,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupport
     uint64_t                                    connection,
     uint32_t                                    visual_id)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["connection"], connection, json_options);
-        FieldToJson(args["visual_id"], visual_id, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    Bool32ToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("connection");
+        FieldToJson(jdata, connection, json_options);
+        jdata.Key("visual_id");
+        FieldToJson(jdata, visual_id, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateWaylandSurfaceKHR(
@@ -4010,15 +5457,22 @@ void VulkanExportJsonConsumer::Process_vkCreateWaylandSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateWaylandSurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateWaylandSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
@@ -4028,14 +5482,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSup
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["display"], display, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    Bool32ToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("display");
+        FieldToJson(jdata, display, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateAndroidSurfaceKHR(
@@ -4046,15 +5506,22 @@ void VulkanExportJsonConsumer::Process_vkCreateAndroidSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAndroidSurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateAndroidSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateWin32SurfaceKHR(
@@ -4065,15 +5532,22 @@ void VulkanExportJsonConsumer::Process_vkCreateWin32SurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateWin32SurfaceKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateWin32SurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWin32PresentationSupportKHR(
@@ -4082,13 +5556,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWin32PresentationSuppo
     format::HandleId                            physicalDevice,
     uint32_t                                    queueFamilyIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    Bool32ToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoCapabilitiesKHR(
@@ -4098,14 +5577,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoCapabilitiesKHR(
     StructPointerDecoder<Decoded_VkVideoProfileInfoKHR>* pVideoProfile,
     StructPointerDecoder<Decoded_VkVideoCapabilitiesKHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pVideoProfile"], pVideoProfile, json_options);
-        FieldToJson(args["pCapabilities"], pCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pVideoProfile");
+        FieldToJson(jdata, pVideoProfile, json_options);
+        jdata.Key("pCapabilities");
+        FieldToJson(jdata, pCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoFormatPropertiesKHR(
@@ -4116,15 +5601,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoFormatPropertiesK
     PointerDecoder<uint32_t>*                   pVideoFormatPropertyCount,
     StructPointerDecoder<Decoded_VkVideoFormatPropertiesKHR>* pVideoFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pVideoFormatInfo"], pVideoFormatInfo, json_options);
-        FieldToJson(args["pVideoFormatPropertyCount"], pVideoFormatPropertyCount, json_options);
-        FieldToJson(args["pVideoFormatProperties"], pVideoFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pVideoFormatInfo");
+        FieldToJson(jdata, pVideoFormatInfo, json_options);
+        jdata.Key("pVideoFormatPropertyCount");
+        FieldToJson(jdata, pVideoFormatPropertyCount, json_options);
+        jdata.Key("pVideoFormatProperties");
+        FieldToJson(jdata, pVideoFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateVideoSessionKHR(
@@ -4135,15 +5627,22 @@ void VulkanExportJsonConsumer::Process_vkCreateVideoSessionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkVideoSessionKHR>*    pVideoSession)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateVideoSessionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pVideoSession"], pVideoSession, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pVideoSession");
+        HandleToJson(jdata, pVideoSession, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionKHR(
@@ -4152,13 +5651,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionKHR(
     format::HandleId                            videoSession,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyVideoSessionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSession"], videoSession, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("videoSession");
+        HandleToJson(jdata, videoSession, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetVideoSessionMemoryRequirementsKHR(
@@ -4169,15 +5673,22 @@ void VulkanExportJsonConsumer::Process_vkGetVideoSessionMemoryRequirementsKHR(
     PointerDecoder<uint32_t>*                   pMemoryRequirementsCount,
     StructPointerDecoder<Decoded_VkVideoSessionMemoryRequirementsKHR>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetVideoSessionMemoryRequirementsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetVideoSessionMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSession"], videoSession, json_options);
-        FieldToJson(args["pMemoryRequirementsCount"], pMemoryRequirementsCount, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("videoSession");
+        HandleToJson(jdata, videoSession, json_options);
+        jdata.Key("pMemoryRequirementsCount");
+        FieldToJson(jdata, pMemoryRequirementsCount, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindVideoSessionMemoryKHR(
@@ -4188,15 +5699,22 @@ void VulkanExportJsonConsumer::Process_vkBindVideoSessionMemoryKHR(
     uint32_t                                    bindSessionMemoryInfoCount,
     StructPointerDecoder<Decoded_VkBindVideoSessionMemoryInfoKHR>* pBindSessionMemoryInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindVideoSessionMemoryKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindVideoSessionMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSession"], videoSession, json_options);
-        FieldToJson(args["bindSessionMemoryInfoCount"], bindSessionMemoryInfoCount, json_options);
-        FieldToJson(args["pBindSessionMemoryInfos"], pBindSessionMemoryInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("videoSession");
+        HandleToJson(jdata, videoSession, json_options);
+        jdata.Key("bindSessionMemoryInfoCount");
+        FieldToJson(jdata, bindSessionMemoryInfoCount, json_options);
+        jdata.Key("pBindSessionMemoryInfos");
+        FieldToJson(jdata, pBindSessionMemoryInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateVideoSessionParametersKHR(
@@ -4207,15 +5725,22 @@ void VulkanExportJsonConsumer::Process_vkCreateVideoSessionParametersKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkVideoSessionParametersKHR>* pVideoSessionParameters)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionParametersKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pVideoSessionParameters"], pVideoSessionParameters, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pVideoSessionParameters");
+        HandleToJson(jdata, pVideoSessionParameters, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkUpdateVideoSessionParametersKHR(
@@ -4225,14 +5750,20 @@ void VulkanExportJsonConsumer::Process_vkUpdateVideoSessionParametersKHR(
     format::HandleId                            videoSessionParameters,
     StructPointerDecoder<Decoded_VkVideoSessionParametersUpdateInfoKHR>* pUpdateInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateVideoSessionParametersKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkUpdateVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSessionParameters"], videoSessionParameters, json_options);
-        FieldToJson(args["pUpdateInfo"], pUpdateInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("videoSessionParameters");
+        HandleToJson(jdata, videoSessionParameters, json_options);
+        jdata.Key("pUpdateInfo");
+        FieldToJson(jdata, pUpdateInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionParametersKHR(
@@ -4241,13 +5772,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionParametersKHR(
     format::HandleId                            videoSessionParameters,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionParametersKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSessionParameters"], videoSessionParameters, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("videoSessionParameters");
+        HandleToJson(jdata, videoSessionParameters, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginVideoCodingKHR(
@@ -4255,13 +5791,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoBeginCodingInfoKHR>* pBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginVideoCodingKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBeginInfo"], pBeginInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pBeginInfo");
+        FieldToJson(jdata, pBeginInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndVideoCodingKHR(
@@ -4269,13 +5810,18 @@ void VulkanExportJsonConsumer::Process_vkCmdEndVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoEndCodingInfoKHR>* pEndCodingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndVideoCodingKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pEndCodingInfo"], pEndCodingInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pEndCodingInfo");
+        FieldToJson(jdata, pEndCodingInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdControlVideoCodingKHR(
@@ -4283,13 +5829,18 @@ void VulkanExportJsonConsumer::Process_vkCmdControlVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoCodingControlInfoKHR>* pCodingControlInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdControlVideoCodingKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdControlVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCodingControlInfo"], pCodingControlInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCodingControlInfo");
+        FieldToJson(jdata, pCodingControlInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDecodeVideoKHR(
@@ -4297,13 +5848,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDecodeVideoKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoDecodeInfoKHR>* pDecodeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDecodeVideoKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDecodeVideoKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDecodeInfo"], pDecodeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pDecodeInfo");
+        FieldToJson(jdata, pDecodeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginRenderingKHR(
@@ -4311,25 +5867,34 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderingKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginRenderingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderingInfo"], pRenderingInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRenderingInfo");
+        FieldToJson(jdata, pRenderingInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndRenderingKHR(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderingKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndRenderingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
@@ -4337,12 +5902,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFeatures"], pFeatures, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pFeatures");
+        FieldToJson(jdata, pFeatures, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
@@ -4350,12 +5919,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
@@ -4364,13 +5937,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["pFormatProperties"], pFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("format");
+        FieldToJson(jdata, format, json_options);
+        jdata.Key("pFormatProperties");
+        FieldToJson(jdata, pFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2KHR(
@@ -4380,14 +5958,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pImageFormatInfo"], pImageFormatInfo, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pImageFormatInfo");
+        FieldToJson(jdata, pImageFormatInfo, json_options);
+        jdata.Key("pImageFormatProperties");
+        FieldToJson(jdata, pImageFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
@@ -4396,13 +5980,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQueueFamilyPropertyCount"], pQueueFamilyPropertyCount, json_options);
-        FieldToJson(args["pQueueFamilyProperties"], pQueueFamilyProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pQueueFamilyPropertyCount");
+        FieldToJson(jdata, pQueueFamilyPropertyCount, json_options);
+        jdata.Key("pQueueFamilyProperties");
+        FieldToJson(jdata, pQueueFamilyProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
@@ -4410,12 +5999,16 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pMemoryProperties"], pMemoryProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pMemoryProperties");
+        FieldToJson(jdata, pMemoryProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
@@ -4425,14 +6018,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFormatInfo"], pFormatInfo, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pFormatInfo");
+        FieldToJson(jdata, pFormatInfo, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
@@ -4443,15 +6042,22 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["heapIndex"], heapIndex, json_options);
-        FieldToJson(args["localDeviceIndex"], localDeviceIndex, json_options);
-        FieldToJson(args["remoteDeviceIndex"], remoteDeviceIndex, json_options);
-        FieldToJson(args["pPeerMemoryFeatures"], pPeerMemoryFeatures, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("heapIndex");
+        FieldToJson(jdata, heapIndex, json_options);
+        jdata.Key("localDeviceIndex");
+        FieldToJson(jdata, localDeviceIndex, json_options);
+        jdata.Key("remoteDeviceIndex");
+        FieldToJson(jdata, remoteDeviceIndex, json_options);
+        jdata.Key("pPeerMemoryFeatures");
+        FieldToJson(jdata, pPeerMemoryFeatures, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMaskKHR(
@@ -4459,13 +6065,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMaskKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMaskKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDeviceMaskKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["deviceMask"], deviceMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("deviceMask");
+        FieldToJson(jdata, deviceMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDispatchBaseKHR(
@@ -4478,18 +6089,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchBaseKHR(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBaseKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["baseGroupX"], baseGroupX, json_options);
-        FieldToJson(args["baseGroupY"], baseGroupY, json_options);
-        FieldToJson(args["baseGroupZ"], baseGroupZ, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDispatchBaseKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("baseGroupX");
+        FieldToJson(jdata, baseGroupX, json_options);
+        jdata.Key("baseGroupY");
+        FieldToJson(jdata, baseGroupY, json_options);
+        jdata.Key("baseGroupZ");
+        FieldToJson(jdata, baseGroupZ, json_options);
+        jdata.Key("groupCountX");
+        FieldToJson(jdata, groupCountX, json_options);
+        jdata.Key("groupCountY");
+        FieldToJson(jdata, groupCountY, json_options);
+        jdata.Key("groupCountZ");
+        FieldToJson(jdata, groupCountZ, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkTrimCommandPoolKHR(
@@ -4498,13 +6119,18 @@ void VulkanExportJsonConsumer::Process_vkTrimCommandPoolKHR(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTrimCommandPoolKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkTrimCommandPoolKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(VkCommandPoolTrimFlags_t(), args["flags"], flags, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("commandPool");
+        HandleToJson(jdata, commandPool, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkCommandPoolTrimFlags_t(), jdata, flags, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
@@ -4514,14 +6140,20 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroupsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroupsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupCount"], pPhysicalDeviceGroupCount, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupProperties"], pPhysicalDeviceGroupProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pPhysicalDeviceGroupCount");
+        FieldToJson(jdata, pPhysicalDeviceGroupCount, json_options);
+        jdata.Key("pPhysicalDeviceGroupProperties");
+        FieldToJson(jdata, pPhysicalDeviceGroupProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
@@ -4530,13 +6162,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperti
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalBufferInfo"], pExternalBufferInfo, json_options);
-        FieldToJson(args["pExternalBufferProperties"], pExternalBufferProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pExternalBufferInfo");
+        FieldToJson(jdata, pExternalBufferInfo, json_options);
+        jdata.Key("pExternalBufferProperties");
+        FieldToJson(jdata, pExternalBufferProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleKHR(
@@ -4546,14 +6183,20 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleKHR(
     StructPointerDecoder<Decoded_VkMemoryGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetWin32HandleInfo"], pGetWin32HandleInfo, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetWin32HandleInfo");
+        FieldToJson(jdata, pGetWin32HandleInfo, json_options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
@@ -4564,15 +6207,22 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
     uint64_t                                    handle,
     StructPointerDecoder<Decoded_VkMemoryWin32HandlePropertiesKHR>* pMemoryWin32HandleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandlePropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryWin32HandlePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["handle"], handle, json_options);
-        FieldToJson(args["pMemoryWin32HandleProperties"], pMemoryWin32HandleProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("handleType");
+        FieldToJson(jdata, handleType, json_options);
+        jdata.Key("handle");
+        FieldToJson(jdata, handle, json_options);
+        jdata.Key("pMemoryWin32HandleProperties");
+        FieldToJson(jdata, pMemoryWin32HandleProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryFdKHR(
@@ -4582,14 +6232,20 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryFdKHR(
     StructPointerDecoder<Decoded_VkMemoryGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetFdInfo"], pGetFdInfo, json_options);
-        FieldToJson(args["pFd"], pFd, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetFdInfo");
+        FieldToJson(jdata, pGetFdInfo, json_options);
+        jdata.Key("pFd");
+        FieldToJson(jdata, pFd, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryFdPropertiesKHR(
@@ -4600,15 +6256,22 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryFdPropertiesKHR(
     int                                         fd,
     StructPointerDecoder<Decoded_VkMemoryFdPropertiesKHR>* pMemoryFdProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdPropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryFdPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["fd"], fd, json_options);
-        FieldToJson(args["pMemoryFdProperties"], pMemoryFdProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("handleType");
+        FieldToJson(jdata, handleType, json_options);
+        jdata.Key("fd");
+        FieldToJson(jdata, fd, json_options);
+        jdata.Key("pMemoryFdProperties");
+        FieldToJson(jdata, pMemoryFdProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
@@ -4617,13 +6280,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePrope
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalSemaphoreInfo"], pExternalSemaphoreInfo, json_options);
-        FieldToJson(args["pExternalSemaphoreProperties"], pExternalSemaphoreProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pExternalSemaphoreInfo");
+        FieldToJson(jdata, pExternalSemaphoreInfo, json_options);
+        jdata.Key("pExternalSemaphoreProperties");
+        FieldToJson(jdata, pExternalSemaphoreProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkImportSemaphoreWin32HandleKHR(
@@ -4632,13 +6300,18 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreWin32HandleKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkImportSemaphoreWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportSemaphoreWin32HandleInfo"], pImportSemaphoreWin32HandleInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pImportSemaphoreWin32HandleInfo");
+        FieldToJson(jdata, pImportSemaphoreWin32HandleInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSemaphoreWin32HandleKHR(
@@ -4648,14 +6321,20 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreWin32HandleKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreWin32HandleKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSemaphoreWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetWin32HandleInfo"], pGetWin32HandleInfo, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetWin32HandleInfo");
+        FieldToJson(jdata, pGetWin32HandleInfo, json_options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkImportSemaphoreFdKHR(
@@ -4664,13 +6343,18 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreFdKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkImportSemaphoreFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportSemaphoreFdInfo"], pImportSemaphoreFdInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pImportSemaphoreFdInfo");
+        FieldToJson(jdata, pImportSemaphoreFdInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSemaphoreFdKHR(
@@ -4680,14 +6364,20 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreFdKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreFdKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSemaphoreFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetFdInfo"], pGetFdInfo, json_options);
-        FieldToJson(args["pFd"], pFd, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetFdInfo");
+        FieldToJson(jdata, pGetFdInfo, json_options);
+        jdata.Key("pFd");
+        FieldToJson(jdata, pFd, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSetKHR(
@@ -4699,17 +6389,26 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSetKHR(
     uint32_t                                    descriptorWriteCount,
     StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["layout"], layout, json_options);
-        FieldToJson(args["set"], set, json_options);
-        FieldToJson(args["descriptorWriteCount"], descriptorWriteCount, json_options);
-        FieldToJson(args["pDescriptorWrites"], pDescriptorWrites, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPushDescriptorSetKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineBindPoint");
+        FieldToJson(jdata, pipelineBindPoint, json_options);
+        jdata.Key("layout");
+        HandleToJson(jdata, layout, json_options);
+        jdata.Key("set");
+        FieldToJson(jdata, set, json_options);
+        jdata.Key("descriptorWriteCount");
+        FieldToJson(jdata, descriptorWriteCount, json_options);
+        jdata.Key("pDescriptorWrites");
+        FieldToJson(jdata, pDescriptorWrites, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
@@ -4720,15 +6419,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplateKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDescriptorUpdateTemplateKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDescriptorUpdateTemplate"], pDescriptorUpdateTemplate, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pDescriptorUpdateTemplate");
+        HandleToJson(jdata, pDescriptorUpdateTemplate, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
@@ -4737,13 +6443,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplateKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplateKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorUpdateTemplate"], descriptorUpdateTemplate, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorUpdateTemplate");
+        HandleToJson(jdata, descriptorUpdateTemplate, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateRenderPass2KHR(
@@ -4754,15 +6465,22 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass2KHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pRenderPass"], pRenderPass, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pRenderPass");
+        HandleToJson(jdata, pRenderPass, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2KHR(
@@ -4771,14 +6489,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2KHR(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderPassBegin"], pRenderPassBegin, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRenderPassBegin");
+        FieldToJson(jdata, pRenderPassBegin, json_options);
+        jdata.Key("pSubpassBeginInfo");
+        FieldToJson(jdata, pSubpassBeginInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2KHR(
@@ -4787,14 +6511,20 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2KHR(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdNextSubpass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pSubpassBeginInfo");
+        FieldToJson(jdata, pSubpassBeginInfo, json_options);
+        jdata.Key("pSubpassEndInfo");
+        FieldToJson(jdata, pSubpassEndInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2KHR(
@@ -4802,13 +6532,18 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pSubpassEndInfo");
+        FieldToJson(jdata, pSubpassEndInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSwapchainStatusKHR(
@@ -4817,13 +6552,18 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainStatusKHR(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainStatusKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSwapchainStatusKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(
@@ -4832,13 +6572,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertie
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalFenceInfo"], pExternalFenceInfo, json_options);
-        FieldToJson(args["pExternalFenceProperties"], pExternalFenceProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pExternalFenceInfo");
+        FieldToJson(jdata, pExternalFenceInfo, json_options);
+        jdata.Key("pExternalFenceProperties");
+        FieldToJson(jdata, pExternalFenceProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkImportFenceWin32HandleKHR(
@@ -4847,13 +6592,18 @@ void VulkanExportJsonConsumer::Process_vkImportFenceWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceWin32HandleInfoKHR>* pImportFenceWin32HandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportFenceWin32HandleKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkImportFenceWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportFenceWin32HandleInfo"], pImportFenceWin32HandleInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pImportFenceWin32HandleInfo");
+        FieldToJson(jdata, pImportFenceWin32HandleInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetFenceWin32HandleKHR(
@@ -4863,14 +6613,20 @@ void VulkanExportJsonConsumer::Process_vkGetFenceWin32HandleKHR(
     StructPointerDecoder<Decoded_VkFenceGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceWin32HandleKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetFenceWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetWin32HandleInfo"], pGetWin32HandleInfo, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetWin32HandleInfo");
+        FieldToJson(jdata, pGetWin32HandleInfo, json_options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkImportFenceFdKHR(
@@ -4879,13 +6635,18 @@ void VulkanExportJsonConsumer::Process_vkImportFenceFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceFdInfoKHR>* pImportFenceFdInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportFenceFdKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkImportFenceFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportFenceFdInfo"], pImportFenceFdInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pImportFenceFdInfo");
+        FieldToJson(jdata, pImportFenceFdInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetFenceFdKHR(
@@ -4895,14 +6656,20 @@ void VulkanExportJsonConsumer::Process_vkGetFenceFdKHR(
     StructPointerDecoder<Decoded_VkFenceGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceFdKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetFenceFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetFdInfo"], pGetFdInfo, json_options);
-        FieldToJson(args["pFd"], pFd, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetFdInfo");
+        FieldToJson(jdata, pGetFdInfo, json_options);
+        jdata.Key("pFd");
+        FieldToJson(jdata, pFd, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
@@ -4914,16 +6681,24 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerfo
     StructPointerDecoder<Decoded_VkPerformanceCounterKHR>* pCounters,
     StructPointerDecoder<Decoded_VkPerformanceCounterDescriptionKHR>* pCounterDescriptions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["pCounterCount"], pCounterCount, json_options);
-        FieldToJson(args["pCounters"], pCounters, json_options);
-        FieldToJson(args["pCounterDescriptions"], pCounterDescriptions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("pCounterCount");
+        FieldToJson(jdata, pCounterCount, json_options);
+        jdata.Key("pCounters");
+        FieldToJson(jdata, pCounters, json_options);
+        jdata.Key("pCounterDescriptions");
+        FieldToJson(jdata, pCounterDescriptions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
@@ -4932,13 +6707,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformance
     StructPointerDecoder<Decoded_VkQueryPoolPerformanceCreateInfoKHR>* pPerformanceQueryCreateInfo,
     PointerDecoder<uint32_t>*                   pNumPasses)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPerformanceQueryCreateInfo"], pPerformanceQueryCreateInfo, json_options);
-        FieldToJson(args["pNumPasses"], pNumPasses, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPerformanceQueryCreateInfo");
+        FieldToJson(jdata, pPerformanceQueryCreateInfo, json_options);
+        jdata.Key("pNumPasses");
+        FieldToJson(jdata, pNumPasses, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireProfilingLockKHR(
@@ -4947,24 +6727,32 @@ void VulkanExportJsonConsumer::Process_vkAcquireProfilingLockKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAcquireProfilingLockInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireProfilingLockKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireProfilingLockKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkReleaseProfilingLockKHR(
     const ApiCallInfo&                          call_info,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseProfilingLockKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkReleaseProfilingLockKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
@@ -4974,14 +6762,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KH
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2KHR>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pSurfaceCapabilities"], pSurfaceCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pSurfaceInfo");
+        FieldToJson(jdata, pSurfaceInfo, json_options);
+        jdata.Key("pSurfaceCapabilities");
+        FieldToJson(jdata, pSurfaceCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
@@ -4992,15 +6786,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormat2KHR>* pSurfaceFormats)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormats2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormats2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pSurfaceFormatCount"], pSurfaceFormatCount, json_options);
-        FieldToJson(args["pSurfaceFormats"], pSurfaceFormats, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pSurfaceInfo");
+        FieldToJson(jdata, pSurfaceInfo, json_options);
+        jdata.Key("pSurfaceFormatCount");
+        FieldToJson(jdata, pSurfaceFormatCount, json_options);
+        jdata.Key("pSurfaceFormats");
+        FieldToJson(jdata, pSurfaceFormats, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
@@ -5010,14 +6811,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceDisplayProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
@@ -5027,14 +6834,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlaneProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDisplayModeProperties2KHR(
@@ -5045,15 +6858,22 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayModeProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModeProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayModeProperties2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDisplayModeProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
@@ -5063,14 +6883,20 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
     StructPointerDecoder<Decoded_VkDisplayPlaneInfo2KHR>* pDisplayPlaneInfo,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilities2KHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilities2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDisplayPlaneCapabilities2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pDisplayPlaneInfo"], pDisplayPlaneInfo, json_options);
-        FieldToJson(args["pCapabilities"], pCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pDisplayPlaneInfo");
+        FieldToJson(jdata, pDisplayPlaneInfo, json_options);
+        jdata.Key("pCapabilities");
+        FieldToJson(jdata, pCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2KHR(
@@ -5079,13 +6905,18 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2KHR(
@@ -5094,13 +6925,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
@@ -5110,14 +6946,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pSparseMemoryRequirementCount");
+        FieldToJson(jdata, pSparseMemoryRequirementCount, json_options);
+        jdata.Key("pSparseMemoryRequirements");
+        FieldToJson(jdata, pSparseMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
@@ -5128,15 +6970,22 @@ void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversionKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateSamplerYcbcrConversionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pYcbcrConversion"], pYcbcrConversion, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pYcbcrConversion");
+        HandleToJson(jdata, pYcbcrConversion, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
@@ -5145,13 +6994,18 @@ void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversionKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroySamplerYcbcrConversionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["ycbcrConversion"], ycbcrConversion, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("ycbcrConversion");
+        HandleToJson(jdata, ycbcrConversion, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindBufferMemory2KHR(
@@ -5161,14 +7015,20 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindBufferMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("bindInfoCount");
+        FieldToJson(jdata, bindInfoCount, json_options);
+        jdata.Key("pBindInfos");
+        FieldToJson(jdata, pBindInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindImageMemory2KHR(
@@ -5178,14 +7038,20 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindImageMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("bindInfoCount");
+        FieldToJson(jdata, bindInfoCount, json_options);
+        jdata.Key("pBindInfos");
+        FieldToJson(jdata, pBindInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
@@ -5194,13 +7060,18 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupportKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDescriptorSetLayoutSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pSupport"], pSupport, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pSupport");
+        FieldToJson(jdata, pSupport, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountKHR(
@@ -5213,18 +7084,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndirectCountKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
@@ -5237,18 +7118,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValueKHR(
@@ -5258,14 +7149,20 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValueKHR(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValueKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSemaphoreCounterValueKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        FieldToJson(args["pValue"], pValue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("semaphore");
+        HandleToJson(jdata, semaphore, json_options);
+        jdata.Key("pValue");
+        FieldToJson(jdata, pValue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkWaitSemaphoresKHR(
@@ -5275,14 +7172,20 @@ void VulkanExportJsonConsumer::Process_vkWaitSemaphoresKHR(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitSemaphoresKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkWaitSemaphoresKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pWaitInfo"], pWaitInfo, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pWaitInfo");
+        FieldToJson(jdata, pWaitInfo, json_options);
+        jdata.Key("timeout");
+        FieldToJson(jdata, timeout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSignalSemaphoreKHR(
@@ -5291,13 +7194,18 @@ void VulkanExportJsonConsumer::Process_vkSignalSemaphoreKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSignalSemaphoreKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSignalSemaphoreKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pSignalInfo"], pSignalInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pSignalInfo");
+        FieldToJson(jdata, pSignalInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(
@@ -5307,14 +7215,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKH
     PointerDecoder<uint32_t>*                   pFragmentShadingRateCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFragmentShadingRateKHR>* pFragmentShadingRates)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFragmentShadingRateCount"], pFragmentShadingRateCount, json_options);
-        FieldToJson(args["pFragmentShadingRates"], pFragmentShadingRates, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pFragmentShadingRateCount");
+        FieldToJson(jdata, pFragmentShadingRateCount, json_options);
+        jdata.Key("pFragmentShadingRates");
+        FieldToJson(jdata, pFragmentShadingRates, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateKHR(
@@ -5323,14 +7237,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateKHR(
     StructPointerDecoder<Decoded_VkExtent2D>*   pFragmentSize,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetFragmentShadingRateKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pFragmentSize"], pFragmentSize, json_options);
-        FieldToJson(args["combinerOps"], combinerOps, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pFragmentSize");
+        FieldToJson(jdata, pFragmentSize, json_options);
+        jdata.Key("combinerOps");
+        FieldToJson(jdata, combinerOps, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRenderingAttachmentLocationsKHR(
@@ -5338,13 +7258,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRenderingAttachmentLocationsKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingAttachmentLocationInfoKHR>* pLocationInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingAttachmentLocationsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRenderingAttachmentLocationsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLocationInfo"], pLocationInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pLocationInfo");
+        FieldToJson(jdata, pLocationInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRenderingInputAttachmentIndicesKHR(
@@ -5352,13 +7277,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRenderingInputAttachmentIndicesKH
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInputAttachmentIndexInfoKHR>* pLocationInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingInputAttachmentIndicesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRenderingInputAttachmentIndicesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLocationInfo"], pLocationInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pLocationInfo");
+        FieldToJson(jdata, pLocationInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkWaitForPresentKHR(
@@ -5369,15 +7299,22 @@ void VulkanExportJsonConsumer::Process_vkWaitForPresentKHR(
     uint64_t                                    presentId,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitForPresentKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkWaitForPresentKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["presentId"], presentId, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("presentId");
+        FieldToJson(jdata, presentId, json_options);
+        jdata.Key("timeout");
+        FieldToJson(jdata, timeout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressKHR(
@@ -5386,13 +7323,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferDeviceAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJsonAsHex(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
@@ -5401,13 +7343,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddressKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
@@ -5416,13 +7363,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDeferredOperationKHR(
@@ -5432,14 +7384,20 @@ void VulkanExportJsonConsumer::Process_vkCreateDeferredOperationKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeferredOperationKHR>* pDeferredOperation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDeferredOperationKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDeferredOperationKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDeferredOperation"], pDeferredOperation, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pDeferredOperation");
+        HandleToJson(jdata, pDeferredOperation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDeferredOperationKHR(
@@ -5448,13 +7406,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDeferredOperationKHR(
     format::HandleId                            operation,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDeferredOperationKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDeferredOperationKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("operation");
+        HandleToJson(jdata, operation, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
@@ -5463,13 +7426,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationMaxConcurrencyKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeferredOperationMaxConcurrencyKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("operation");
+        HandleToJson(jdata, operation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeferredOperationResultKHR(
@@ -5478,13 +7446,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeferredOperationResultKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationResultKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeferredOperationResultKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("operation");
+        HandleToJson(jdata, operation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDeferredOperationJoinKHR(
@@ -5493,13 +7466,18 @@ void VulkanExportJsonConsumer::Process_vkDeferredOperationJoinKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDeferredOperationJoinKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDeferredOperationJoinKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("operation");
+        HandleToJson(jdata, operation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
@@ -5510,15 +7488,22 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
     PointerDecoder<uint32_t>*                   pExecutableCount,
     StructPointerDecoder<Decoded_VkPipelineExecutablePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutablePropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPipelineExecutablePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pPipelineInfo"], pPipelineInfo, json_options);
-        FieldToJson(args["pExecutableCount"], pExecutableCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pPipelineInfo");
+        FieldToJson(jdata, pPipelineInfo, json_options);
+        jdata.Key("pExecutableCount");
+        FieldToJson(jdata, pExecutableCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
@@ -5529,15 +7514,22 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
     PointerDecoder<uint32_t>*                   pStatisticCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableStatisticKHR>* pStatistics)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableStatisticsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPipelineExecutableStatisticsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pExecutableInfo"], pExecutableInfo, json_options);
-        FieldToJson(args["pStatisticCount"], pStatisticCount, json_options);
-        FieldToJson(args["pStatistics"], pStatistics, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pExecutableInfo");
+        FieldToJson(jdata, pExecutableInfo, json_options);
+        jdata.Key("pStatisticCount");
+        FieldToJson(jdata, pStatisticCount, json_options);
+        jdata.Key("pStatistics");
+        FieldToJson(jdata, pStatistics, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableInternalRepresentationsKHR(
@@ -5548,15 +7540,22 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableInternalRepresenta
     PointerDecoder<uint32_t>*                   pInternalRepresentationCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableInternalRepresentationKHR>* pInternalRepresentations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableInternalRepresentationsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPipelineExecutableInternalRepresentationsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pExecutableInfo"], pExecutableInfo, json_options);
-        FieldToJson(args["pInternalRepresentationCount"], pInternalRepresentationCount, json_options);
-        FieldToJson(args["pInternalRepresentations"], pInternalRepresentations, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pExecutableInfo");
+        FieldToJson(jdata, pExecutableInfo, json_options);
+        jdata.Key("pInternalRepresentationCount");
+        FieldToJson(jdata, pInternalRepresentationCount, json_options);
+        jdata.Key("pInternalRepresentations");
+        FieldToJson(jdata, pInternalRepresentations, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkMapMemory2KHR(
@@ -5566,14 +7565,20 @@ void VulkanExportJsonConsumer::Process_vkMapMemory2KHR(
     StructPointerDecoder<Decoded_VkMemoryMapInfoKHR>* pMemoryMapInfo,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMapMemory2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkMapMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pMemoryMapInfo"], pMemoryMapInfo, json_options);
-        FieldToJsonAsHex(args["ppData"], ppData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pMemoryMapInfo");
+        FieldToJson(jdata, pMemoryMapInfo, json_options);
+        jdata.Key("ppData");
+        FieldToJsonAsHex(jdata, ppData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkUnmapMemory2KHR(
@@ -5582,13 +7587,18 @@ void VulkanExportJsonConsumer::Process_vkUnmapMemory2KHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkMemoryUnmapInfoKHR>* pMemoryUnmapInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUnmapMemory2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkUnmapMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pMemoryUnmapInfo"], pMemoryUnmapInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pMemoryUnmapInfo");
+        FieldToJson(jdata, pMemoryUnmapInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(
@@ -5598,14 +7608,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoEncodeQualityLeve
     StructPointerDecoder<Decoded_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>* pQualityLevelInfo,
     StructPointerDecoder<Decoded_VkVideoEncodeQualityLevelPropertiesKHR>* pQualityLevelProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQualityLevelInfo"], pQualityLevelInfo, json_options);
-        FieldToJson(args["pQualityLevelProperties"], pQualityLevelProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pQualityLevelInfo");
+        FieldToJson(jdata, pQualityLevelInfo, json_options);
+        jdata.Key("pQualityLevelProperties");
+        FieldToJson(jdata, pQualityLevelProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetEncodedVideoSessionParametersKHR(
@@ -5617,16 +7633,24 @@ void VulkanExportJsonConsumer::Process_vkGetEncodedVideoSessionParametersKHR(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetEncodedVideoSessionParametersKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pVideoSessionParametersInfo"], pVideoSessionParametersInfo, json_options);
-        FieldToJson(args["pFeedbackInfo"], pFeedbackInfo, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetEncodedVideoSessionParametersKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pVideoSessionParametersInfo");
+        FieldToJson(jdata, pVideoSessionParametersInfo, json_options);
+        jdata.Key("pFeedbackInfo");
+        FieldToJson(jdata, pFeedbackInfo, json_options);
+        jdata.Key("pDataSize");
+        FieldToJson(jdata, pDataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEncodeVideoKHR(
@@ -5634,13 +7658,18 @@ void VulkanExportJsonConsumer::Process_vkCmdEncodeVideoKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoEncodeInfoKHR>* pEncodeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEncodeVideoKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEncodeVideoKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pEncodeInfo"], pEncodeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pEncodeInfo");
+        FieldToJson(jdata, pEncodeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetEvent2KHR(
@@ -5649,14 +7678,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent2KHR(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetEvent2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("pDependencyInfo");
+        FieldToJson(jdata, pDependencyInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResetEvent2KHR(
@@ -5665,14 +7700,20 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent2KHR(
     format::HandleId                            event,
     VkPipelineStageFlags2                       stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResetEvent2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stageMask"], stageMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("event");
+        HandleToJson(jdata, event, json_options);
+        jdata.Key("stageMask");
+        FieldToJson(VkPipelineStageFlags2_t(), jdata, stageMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2KHR(
@@ -5682,15 +7723,22 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2KHR(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWaitEvents2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["eventCount"], eventCount, json_options);
-        HandleToJson(args["pEvents"], pEvents, json_options);
-        FieldToJson(args["pDependencyInfos"], pDependencyInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("eventCount");
+        FieldToJson(jdata, eventCount, json_options);
+        jdata.Key("pEvents");
+        HandleToJson(jdata, pEvents, json_options);
+        jdata.Key("pDependencyInfos");
+        FieldToJson(jdata, pDependencyInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2KHR(
@@ -5698,13 +7746,18 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPipelineBarrier2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pDependencyInfo");
+        FieldToJson(jdata, pDependencyInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2KHR(
@@ -5714,15 +7767,22 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2KHR(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteTimestamp2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stage"], stage, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stage");
+        FieldToJson(VkPipelineStageFlags2_t(), jdata, stage, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueSubmit2KHR(
@@ -5733,16 +7793,24 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit2KHR(
     StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2KHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["submitCount"], submitCount, json_options);
-        FieldToJson(args["pSubmits"], pSubmits, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueSubmit2KHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameSubmitIndex());
+    FieldToJson(jdata, ++submit_index_, json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("submitCount");
+        FieldToJson(jdata, submitCount, json_options);
+        jdata.Key("pSubmits");
+        FieldToJson(jdata, pSubmits, json_options);
+        jdata.Key("fence");
+        HandleToJson(jdata, fence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarker2AMD(
@@ -5753,16 +7821,24 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarker2AMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarker2AMD");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stage"], stage, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["marker"], marker, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteBufferMarker2AMD");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stage");
+        FieldToJson(VkPipelineStageFlags2_t(), jdata, stage, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("dstOffset");
+        FieldToJson(jdata, dstOffset, json_options);
+        jdata.Key("marker");
+        FieldToJson(jdata, marker, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointData2NV(
@@ -5771,13 +7847,18 @@ void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointData2NV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointData2NV>* pCheckpointData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointData2NV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetQueueCheckpointData2NV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pCheckpointDataCount"], pCheckpointDataCount, json_options);
-        FieldToJson(args["pCheckpointData"], pCheckpointData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("pCheckpointDataCount");
+        FieldToJson(jdata, pCheckpointDataCount, json_options);
+        jdata.Key("pCheckpointData");
+        FieldToJson(jdata, pCheckpointData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2KHR(
@@ -5785,13 +7866,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferInfo"], pCopyBufferInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyBufferInfo");
+        FieldToJson(jdata, pCopyBufferInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyImage2KHR(
@@ -5799,13 +7885,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageInfo"], pCopyImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyImageInfo");
+        FieldToJson(jdata, pCopyImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2KHR(
@@ -5813,13 +7904,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyBufferToImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferToImageInfo"], pCopyBufferToImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyBufferToImageInfo");
+        FieldToJson(jdata, pCopyBufferToImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2KHR(
@@ -5827,13 +7923,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyImageToBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageToBufferInfo"], pCopyImageToBufferInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCopyImageToBufferInfo");
+        FieldToJson(jdata, pCopyImageToBufferInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBlitImage2KHR(
@@ -5841,13 +7942,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBlitImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBlitImageInfo"], pBlitImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pBlitImageInfo");
+        FieldToJson(jdata, pBlitImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdResolveImage2KHR(
@@ -5855,13 +7961,18 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdResolveImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pResolveImageInfo"], pResolveImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pResolveImageInfo");
+        FieldToJson(jdata, pResolveImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirect2KHR(
@@ -5869,13 +7980,18 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirect2KHR(
     format::HandleId                            commandBuffer,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirect2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdTraceRaysIndirect2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJsonAsHex(args["indirectDeviceAddress"], indirectDeviceAddress, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("indirectDeviceAddress");
+        FieldToJsonAsHex(jdata, indirectDeviceAddress, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirementsKHR(
@@ -5884,13 +8000,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirementsKHR(
     StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirementsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirementsKHR(
@@ -5899,13 +8020,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirementsKHR(
     StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirementsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceImageMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirementsKHR(
@@ -5915,14 +8041,20 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirementsK
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirementsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pSparseMemoryRequirementCount");
+        FieldToJson(jdata, pSparseMemoryRequirementCount, json_options);
+        jdata.Key("pSparseMemoryRequirements");
+        FieldToJson(jdata, pSparseMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer2KHR(
@@ -5933,16 +8065,24 @@ void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer2KHR(
     VkDeviceSize                                size,
     VkIndexType                                 indexType)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer2KHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(args["indexType"], indexType, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindIndexBuffer2KHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("size");
+        FieldToJson(jdata, size, json_options);
+        jdata.Key("indexType");
+        FieldToJson(jdata, indexType, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRenderingAreaGranularityKHR(
@@ -5951,13 +8091,18 @@ void VulkanExportJsonConsumer::Process_vkGetRenderingAreaGranularityKHR(
     StructPointerDecoder<Decoded_VkRenderingAreaInfoKHR>* pRenderingAreaInfo,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRenderingAreaGranularityKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRenderingAreaGranularityKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pRenderingAreaInfo"], pRenderingAreaInfo, json_options);
-        FieldToJson(args["pGranularity"], pGranularity, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pRenderingAreaInfo");
+        FieldToJson(jdata, pRenderingAreaInfo, json_options);
+        jdata.Key("pGranularity");
+        FieldToJson(jdata, pGranularity, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceImageSubresourceLayoutKHR(
@@ -5966,13 +8111,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSubresourceLayoutKHR(
     StructPointerDecoder<Decoded_VkDeviceImageSubresourceInfoKHR>* pInfo,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSubresourceLayoutKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceImageSubresourceLayoutKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pLayout");
+        FieldToJson(jdata, pLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2KHR(
@@ -5982,14 +8132,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2KHR(
     StructPointerDecoder<Decoded_VkImageSubresource2KHR>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageSubresourceLayout2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSubresource"], pSubresource, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pSubresource");
+        FieldToJson(jdata, pSubresource, json_options);
+        jdata.Key("pLayout");
+        FieldToJson(jdata, pLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR(
@@ -5999,14 +8155,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleKHR(
@@ -6015,14 +8177,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleKHR(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLineStippleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineStippleFactor"], lineStippleFactor, json_options);
-        FieldToJson(args["lineStipplePattern"], lineStipplePattern, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("lineStippleFactor");
+        FieldToJson(jdata, lineStippleFactor, json_options);
+        jdata.Key("lineStipplePattern");
+        FieldToJson(jdata, lineStipplePattern, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR(
@@ -6032,14 +8200,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomai
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainKHR>*            pTimeDomains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pTimeDomainCount"], pTimeDomainCount, json_options);
-        FieldToJson(args["pTimeDomains"], pTimeDomains, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pTimeDomainCount");
+        FieldToJson(jdata, pTimeDomainCount, json_options);
+        jdata.Key("pTimeDomains");
+        FieldToJson(jdata, pTimeDomains, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsKHR(
@@ -6051,16 +8225,24 @@ void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsKHR(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["timestampCount"], timestampCount, json_options);
-        FieldToJson(args["pTimestampInfos"], pTimestampInfos, json_options);
-        FieldToJson(args["pTimestamps"], pTimestamps, json_options);
-        FieldToJson(args["pMaxDeviation"], pMaxDeviation, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetCalibratedTimestampsKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("timestampCount");
+        FieldToJson(jdata, timestampCount, json_options);
+        jdata.Key("pTimestampInfos");
+        FieldToJson(jdata, pTimestampInfos, json_options);
+        jdata.Key("pTimestamps");
+        FieldToJson(jdata, pTimestamps, json_options);
+        jdata.Key("pMaxDeviation");
+        FieldToJson(jdata, pMaxDeviation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets2KHR(
@@ -6068,13 +8250,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBindDescriptorSetsInfoKHR>* pBindDescriptorSetsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindDescriptorSets2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBindDescriptorSetsInfo"], pBindDescriptorSetsInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pBindDescriptorSetsInfo");
+        FieldToJson(jdata, pBindDescriptorSetsInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPushConstants2KHR(
@@ -6082,13 +8269,18 @@ void VulkanExportJsonConsumer::Process_vkCmdPushConstants2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushConstantsInfoKHR>* pPushConstantsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushConstants2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPushConstants2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pPushConstantsInfo"], pPushConstantsInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pPushConstantsInfo");
+        FieldToJson(jdata, pPushConstantsInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSet2KHR(
@@ -6096,13 +8288,18 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSet2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushDescriptorSetInfoKHR>* pPushDescriptorSetInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSet2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPushDescriptorSet2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pPushDescriptorSetInfo"], pPushDescriptorSetInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pPushDescriptorSetInfo");
+        FieldToJson(jdata, pPushDescriptorSetInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSetWithTemplate2KHR(
@@ -6110,13 +8307,18 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSetWithTemplate2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushDescriptorSetWithTemplateInfoKHR>* pPushDescriptorSetWithTemplateInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetWithTemplate2KHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPushDescriptorSetWithTemplate2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pPushDescriptorSetWithTemplateInfo"], pPushDescriptorSetWithTemplateInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pPushDescriptorSetWithTemplateInfo");
+        FieldToJson(jdata, pPushDescriptorSetWithTemplateInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDescriptorBufferOffsets2EXT(
@@ -6124,13 +8326,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDescriptorBufferOffsets2EXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSetDescriptorBufferOffsetsInfoEXT>* pSetDescriptorBufferOffsetsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDescriptorBufferOffsets2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDescriptorBufferOffsets2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSetDescriptorBufferOffsetsInfo"], pSetDescriptorBufferOffsetsInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pSetDescriptorBufferOffsetsInfo");
+        FieldToJson(jdata, pSetDescriptorBufferOffsetsInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(
@@ -6138,13 +8345,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorBufferEmbeddedSamplers
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBindDescriptorBufferEmbeddedSamplersInfoEXT>* pBindDescriptorBufferEmbeddedSamplersInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBindDescriptorBufferEmbeddedSamplersInfo"], pBindDescriptorBufferEmbeddedSamplersInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pBindDescriptorBufferEmbeddedSamplersInfo");
+        FieldToJson(jdata, pBindDescriptorBufferEmbeddedSamplersInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkFrameBoundaryANDROID(
@@ -6153,13 +8365,18 @@ void VulkanExportJsonConsumer::Process_vkFrameBoundaryANDROID(
     format::HandleId                            semaphore,
     format::HandleId                            image)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFrameBoundaryANDROID");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkFrameBoundaryANDROID");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        HandleToJson(args["image"], image, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("semaphore");
+        HandleToJson(jdata, semaphore, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDebugReportCallbackEXT(
@@ -6170,15 +8387,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDebugReportCallbackEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugReportCallbackEXT>* pCallback)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDebugReportCallbackEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDebugReportCallbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pCallback"], pCallback, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pCallback");
+        HandleToJson(jdata, pCallback, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDebugReportCallbackEXT(
@@ -6187,13 +8411,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDebugReportCallbackEXT(
     format::HandleId                            callback,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDebugReportCallbackEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDebugReportCallbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        HandleToJson(args["callback"], callback, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("callback");
+        HandleToJson(jdata, callback, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDebugReportMessageEXT(
@@ -6207,18 +8436,28 @@ void VulkanExportJsonConsumer::Process_vkDebugReportMessageEXT(
     StringDecoder*                              pLayerPrefix,
     StringDecoder*                              pMessage)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugReportMessageEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(VkDebugReportFlagsEXT_t(), args["flags"], flags, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        FieldToJson(args["object"], object, json_options);
-        FieldToJson(args["location"], location, json_options);
-        FieldToJson(args["messageCode"], messageCode, json_options);
-        FieldToJson(args["pLayerPrefix"], pLayerPrefix, json_options);
-        FieldToJson(args["pMessage"], pMessage, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDebugReportMessageEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkDebugReportFlagsEXT_t(), jdata, flags, json_options);
+        jdata.Key("objectType");
+        FieldToJson(jdata, objectType, json_options);
+        jdata.Key("object");
+        FieldToJson(jdata, object, json_options);
+        jdata.Key("location");
+        FieldToJson(jdata, location, json_options);
+        jdata.Key("messageCode");
+        FieldToJson(jdata, messageCode, json_options);
+        jdata.Key("pLayerPrefix");
+        FieldToJson(jdata, pLayerPrefix, json_options);
+        jdata.Key("pMessage");
+        FieldToJson(jdata, pMessage, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectTagEXT(
@@ -6227,13 +8466,18 @@ void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectTagInfoEXT>* pTagInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectTagEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDebugMarkerSetObjectTagEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pTagInfo"], pTagInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pTagInfo");
+        FieldToJson(jdata, pTagInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectNameEXT(
@@ -6242,13 +8486,18 @@ void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectNameInfoEXT>* pNameInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectNameEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDebugMarkerSetObjectNameEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pNameInfo"], pNameInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pNameInfo");
+        FieldToJson(jdata, pNameInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerBeginEXT(
@@ -6256,25 +8505,34 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerBeginEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerBeginEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDebugMarkerBeginEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pMarkerInfo");
+        FieldToJson(jdata, pMarkerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerEndEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerEndEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDebugMarkerEndEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerInsertEXT(
@@ -6282,13 +8540,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerInsertEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerInsertEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDebugMarkerInsertEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pMarkerInfo");
+        FieldToJson(jdata, pMarkerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
@@ -6300,17 +8563,26 @@ void VulkanExportJsonConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
     PointerDecoder<VkDeviceSize>*               pOffsets,
     PointerDecoder<VkDeviceSize>*               pSizes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindTransformFeedbackBuffersEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-        FieldToJson(args["pSizes"], pSizes, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindTransformFeedbackBuffersEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstBinding");
+        FieldToJson(jdata, firstBinding, json_options);
+        jdata.Key("bindingCount");
+        FieldToJson(jdata, bindingCount, json_options);
+        jdata.Key("pBuffers");
+        HandleToJson(jdata, pBuffers, json_options);
+        jdata.Key("pOffsets");
+        FieldToJson(jdata, pOffsets, json_options);
+        jdata.Key("pSizes");
+        FieldToJson(jdata, pSizes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginTransformFeedbackEXT(
@@ -6321,16 +8593,24 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginTransformFeedbackEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstCounterBuffer"], firstCounterBuffer, json_options);
-        FieldToJson(args["counterBufferCount"], counterBufferCount, json_options);
-        HandleToJson(args["pCounterBuffers"], pCounterBuffers, json_options);
-        FieldToJson(args["pCounterBufferOffsets"], pCounterBufferOffsets, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginTransformFeedbackEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstCounterBuffer");
+        FieldToJson(jdata, firstCounterBuffer, json_options);
+        jdata.Key("counterBufferCount");
+        FieldToJson(jdata, counterBufferCount, json_options);
+        jdata.Key("pCounterBuffers");
+        HandleToJson(jdata, pCounterBuffers, json_options);
+        jdata.Key("pCounterBufferOffsets");
+        FieldToJson(jdata, pCounterBufferOffsets, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndTransformFeedbackEXT(
@@ -6341,16 +8621,24 @@ void VulkanExportJsonConsumer::Process_vkCmdEndTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndTransformFeedbackEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstCounterBuffer"], firstCounterBuffer, json_options);
-        FieldToJson(args["counterBufferCount"], counterBufferCount, json_options);
-        HandleToJson(args["pCounterBuffers"], pCounterBuffers, json_options);
-        FieldToJson(args["pCounterBufferOffsets"], pCounterBufferOffsets, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndTransformFeedbackEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstCounterBuffer");
+        FieldToJson(jdata, firstCounterBuffer, json_options);
+        jdata.Key("counterBufferCount");
+        FieldToJson(jdata, counterBufferCount, json_options);
+        jdata.Key("pCounterBuffers");
+        HandleToJson(jdata, pCounterBuffers, json_options);
+        jdata.Key("pCounterBufferOffsets");
+        FieldToJson(jdata, pCounterBufferOffsets, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginQueryIndexedEXT(
@@ -6361,16 +8649,24 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginQueryIndexedEXT(
     VkQueryControlFlags                         flags,
     uint32_t                                    index)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginQueryIndexedEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-        FieldToJson(VkQueryControlFlags_t(), args["flags"], flags, json_options);
-        FieldToJson(args["index"], index, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginQueryIndexedEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkQueryControlFlags_t(), jdata, flags, json_options);
+        jdata.Key("index");
+        FieldToJson(jdata, index, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndQueryIndexedEXT(
@@ -6380,15 +8676,22 @@ void VulkanExportJsonConsumer::Process_vkCmdEndQueryIndexedEXT(
     uint32_t                                    query,
     uint32_t                                    index)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndQueryIndexedEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndQueryIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-        FieldToJson(args["index"], index, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("query");
+        FieldToJson(jdata, query, json_options);
+        jdata.Key("index");
+        FieldToJson(jdata, index, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectByteCountEXT(
@@ -6401,18 +8704,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectByteCountEXT(
     uint32_t                                    counterOffset,
     uint32_t                                    vertexStride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectByteCountEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-        HandleToJson(args["counterBuffer"], counterBuffer, json_options);
-        FieldToJson(args["counterBufferOffset"], counterBufferOffset, json_options);
-        FieldToJson(args["counterOffset"], counterOffset, json_options);
-        FieldToJson(args["vertexStride"], vertexStride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndirectByteCountEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("instanceCount");
+        FieldToJson(jdata, instanceCount, json_options);
+        jdata.Key("firstInstance");
+        FieldToJson(jdata, firstInstance, json_options);
+        jdata.Key("counterBuffer");
+        HandleToJson(jdata, counterBuffer, json_options);
+        jdata.Key("counterBufferOffset");
+        FieldToJson(jdata, counterBufferOffset, json_options);
+        jdata.Key("counterOffset");
+        FieldToJson(jdata, counterOffset, json_options);
+        jdata.Key("vertexStride");
+        FieldToJson(jdata, vertexStride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageViewHandleNVX(
@@ -6421,13 +8734,18 @@ void VulkanExportJsonConsumer::Process_vkGetImageViewHandleNVX(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImageViewHandleInfoNVX>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageViewHandleNVX");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageViewHandleNVX");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageViewAddressNVX(
@@ -6437,14 +8755,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageViewAddressNVX(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkImageViewAddressPropertiesNVX>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageViewAddressNVX");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageViewAddressNVX");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("imageView");
+        HandleToJson(jdata, imageView, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountAMD(
@@ -6457,18 +8781,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountAMD");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndirectCountAMD");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
@@ -6481,18 +8815,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountAMD");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountAMD");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetShaderInfoAMD(
@@ -6505,17 +8849,26 @@ void VulkanExportJsonConsumer::Process_vkGetShaderInfoAMD(
     PointerDecoder<size_t>*                     pInfoSize,
     PointerDecoder<uint8_t>*                    pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderInfoAMD");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["shaderStage"], shaderStage, json_options);
-        FieldToJson(args["infoType"], infoType, json_options);
-        FieldToJson(args["pInfoSize"], pInfoSize, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetShaderInfoAMD");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("shaderStage");
+        FieldToJson(jdata, shaderStage, json_options);
+        jdata.Key("infoType");
+        FieldToJson(jdata, infoType, json_options);
+        jdata.Key("pInfoSize");
+        FieldToJson(jdata, pInfoSize, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
@@ -6526,15 +8879,22 @@ void VulkanExportJsonConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateStreamDescriptorSurfaceGGP");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateStreamDescriptorSurfaceGGP");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
@@ -6549,19 +8909,30 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPro
     VkExternalMemoryHandleTypeFlagsNV           externalHandleType,
     StructPointerDecoder<Decoded_VkExternalImageFormatPropertiesNV>* pExternalImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["type"], type, json_options);
-        FieldToJson(args["tiling"], tiling, json_options);
-        FieldToJson(VkImageUsageFlags_t(), args["usage"], usage, json_options);
-        FieldToJson(VkImageCreateFlags_t(), args["flags"], flags, json_options);
-        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), args["externalHandleType"], externalHandleType, json_options);
-        FieldToJson(args["pExternalImageFormatProperties"], pExternalImageFormatProperties, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("format");
+        FieldToJson(jdata, format, json_options);
+        jdata.Key("type");
+        FieldToJson(jdata, type, json_options);
+        jdata.Key("tiling");
+        FieldToJson(jdata, tiling, json_options);
+        jdata.Key("usage");
+        FieldToJson(VkImageUsageFlags_t(), jdata, usage, json_options);
+        jdata.Key("flags");
+        FieldToJson(VkImageCreateFlags_t(), jdata, flags, json_options);
+        jdata.Key("externalHandleType");
+        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), jdata, externalHandleType, json_options);
+        jdata.Key("pExternalImageFormatProperties");
+        FieldToJson(jdata, pExternalImageFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleNV(
@@ -6572,15 +8943,22 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleNV(
     VkExternalMemoryHandleTypeFlagsNV           handleType,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryWin32HandleNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), args["handleType"], handleType, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("handleType");
+        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), jdata, handleType, json_options);
+        jdata.Key("pHandle");
+        FieldToJson(jdata, pHandle, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateViSurfaceNN(
@@ -6591,15 +8969,22 @@ void VulkanExportJsonConsumer::Process_vkCreateViSurfaceNN(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateViSurfaceNN");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateViSurfaceNN");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginConditionalRenderingEXT(
@@ -6607,25 +8992,34 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginConditionalRenderingEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkConditionalRenderingBeginInfoEXT>* pConditionalRenderingBegin)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginConditionalRenderingEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginConditionalRenderingEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pConditionalRenderingBegin"], pConditionalRenderingBegin, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pConditionalRenderingBegin");
+        FieldToJson(jdata, pConditionalRenderingBegin, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndConditionalRenderingEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndConditionalRenderingEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndConditionalRenderingEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingNV(
@@ -6635,15 +9029,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportWScalingNV>* pViewportWScalings)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewportWScalingNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewportWScalings"], pViewportWScalings, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstViewport");
+        FieldToJson(jdata, firstViewport, json_options);
+        jdata.Key("viewportCount");
+        FieldToJson(jdata, viewportCount, json_options);
+        jdata.Key("pViewportWScalings");
+        FieldToJson(jdata, pViewportWScalings, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkReleaseDisplayEXT(
@@ -6652,13 +9053,18 @@ void VulkanExportJsonConsumer::Process_vkReleaseDisplayEXT(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseDisplayEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkReleaseDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireXlibDisplayEXT(
@@ -6668,14 +9074,20 @@ void VulkanExportJsonConsumer::Process_vkAcquireXlibDisplayEXT(
     uint64_t                                    dpy,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireXlibDisplayEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireXlibDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["dpy"], dpy, json_options);
-        HandleToJson(args["display"], display, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("dpy");
+        FieldToJson(jdata, dpy, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRandROutputDisplayEXT(
@@ -6686,15 +9098,22 @@ void VulkanExportJsonConsumer::Process_vkGetRandROutputDisplayEXT(
     size_t                                      rrOutput,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRandROutputDisplayEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRandROutputDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["dpy"], dpy, json_options);
-        FieldToJson(args["rrOutput"], rrOutput, json_options);
-        HandleToJson(args["pDisplay"], pDisplay, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("dpy");
+        FieldToJson(jdata, dpy, json_options);
+        jdata.Key("rrOutput");
+        FieldToJson(jdata, rrOutput, json_options);
+        jdata.Key("pDisplay");
+        HandleToJson(jdata, pDisplay, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
@@ -6704,14 +9123,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EX
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2EXT>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pSurfaceCapabilities"], pSurfaceCapabilities, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("surface");
+        HandleToJson(jdata, surface, json_options);
+        jdata.Key("pSurfaceCapabilities");
+        FieldToJson(jdata, pSurfaceCapabilities, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDisplayPowerControlEXT(
@@ -6721,14 +9146,20 @@ void VulkanExportJsonConsumer::Process_vkDisplayPowerControlEXT(
     format::HandleId                            display,
     StructPointerDecoder<Decoded_VkDisplayPowerInfoEXT>* pDisplayPowerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDisplayPowerControlEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDisplayPowerControlEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pDisplayPowerInfo"], pDisplayPowerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+        jdata.Key("pDisplayPowerInfo");
+        FieldToJson(jdata, pDisplayPowerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkRegisterDeviceEventEXT(
@@ -6739,15 +9170,22 @@ void VulkanExportJsonConsumer::Process_vkRegisterDeviceEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkRegisterDeviceEventEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkRegisterDeviceEventEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pDeviceEventInfo"], pDeviceEventInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFence"], pFence, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pDeviceEventInfo");
+        FieldToJson(jdata, pDeviceEventInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pFence");
+        HandleToJson(jdata, pFence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkRegisterDisplayEventEXT(
@@ -6759,16 +9197,24 @@ void VulkanExportJsonConsumer::Process_vkRegisterDisplayEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkRegisterDisplayEventEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pDisplayEventInfo"], pDisplayEventInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFence"], pFence, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkRegisterDisplayEventEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+        jdata.Key("pDisplayEventInfo");
+        FieldToJson(jdata, pDisplayEventInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pFence");
+        HandleToJson(jdata, pFence, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSwapchainCounterEXT(
@@ -6779,15 +9225,22 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainCounterEXT(
     VkSurfaceCounterFlagBitsEXT                 counter,
     PointerDecoder<uint64_t>*                   pCounterValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainCounterEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSwapchainCounterEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["counter"], counter, json_options);
-        FieldToJson(args["pCounterValue"], pCounterValue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("counter");
+        FieldToJson(jdata, counter, json_options);
+        jdata.Key("pCounterValue");
+        FieldToJson(jdata, pCounterValue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
@@ -6797,14 +9250,20 @@ void VulkanExportJsonConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRefreshCycleDurationGOOGLE");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRefreshCycleDurationGOOGLE");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pDisplayTimingProperties"], pDisplayTimingProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pDisplayTimingProperties");
+        FieldToJson(jdata, pDisplayTimingProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPastPresentationTimingGOOGLE(
@@ -6815,15 +9274,22 @@ void VulkanExportJsonConsumer::Process_vkGetPastPresentationTimingGOOGLE(
     PointerDecoder<uint32_t>*                   pPresentationTimingCount,
     StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPastPresentationTimingGOOGLE");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPastPresentationTimingGOOGLE");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pPresentationTimingCount"], pPresentationTimingCount, json_options);
-        FieldToJson(args["pPresentationTimings"], pPresentationTimings, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pPresentationTimingCount");
+        FieldToJson(jdata, pPresentationTimingCount, json_options);
+        jdata.Key("pPresentationTimings");
+        FieldToJson(jdata, pPresentationTimings, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEXT(
@@ -6833,15 +9299,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEXT(
     uint32_t                                    discardRectangleCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pDiscardRectangles)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDiscardRectangleEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstDiscardRectangle"], firstDiscardRectangle, json_options);
-        FieldToJson(args["discardRectangleCount"], discardRectangleCount, json_options);
-        FieldToJson(args["pDiscardRectangles"], pDiscardRectangles, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstDiscardRectangle");
+        FieldToJson(jdata, firstDiscardRectangle, json_options);
+        jdata.Key("discardRectangleCount");
+        FieldToJson(jdata, discardRectangleCount, json_options);
+        jdata.Key("pDiscardRectangles");
+        FieldToJson(jdata, pDiscardRectangles, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEnableEXT(
@@ -6849,13 +9322,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    discardRectangleEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDiscardRectangleEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["discardRectangleEnable"], discardRectangleEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("discardRectangleEnable");
+        Bool32ToJson(jdata, discardRectangleEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleModeEXT(
@@ -6863,13 +9341,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleModeEXT(
     format::HandleId                            commandBuffer,
     VkDiscardRectangleModeEXT                   discardRectangleMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDiscardRectangleModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["discardRectangleMode"], discardRectangleMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("discardRectangleMode");
+        FieldToJson(jdata, discardRectangleMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetHdrMetadataEXT(
@@ -6879,14 +9362,20 @@ void VulkanExportJsonConsumer::Process_vkSetHdrMetadataEXT(
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains,
     StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetHdrMetadataEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetHdrMetadataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["swapchainCount"], swapchainCount, json_options);
-        HandleToJson(args["pSwapchains"], pSwapchains, json_options);
-        FieldToJson(args["pMetadata"], pMetadata, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchainCount");
+        FieldToJson(jdata, swapchainCount, json_options);
+        jdata.Key("pSwapchains");
+        HandleToJson(jdata, pSwapchains, json_options);
+        jdata.Key("pMetadata");
+        FieldToJson(jdata, pMetadata, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateIOSSurfaceMVK(
@@ -6897,15 +9386,22 @@ void VulkanExportJsonConsumer::Process_vkCreateIOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIOSSurfaceMVK");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateIOSSurfaceMVK");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateMacOSSurfaceMVK(
@@ -6916,15 +9412,22 @@ void VulkanExportJsonConsumer::Process_vkCreateMacOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMacOSSurfaceMVK");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateMacOSSurfaceMVK");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectNameEXT(
@@ -6933,13 +9436,18 @@ void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectNameInfoEXT>* pNameInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectNameEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetDebugUtilsObjectNameEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pNameInfo"], pNameInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pNameInfo");
+        FieldToJson(jdata, pNameInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectTagEXT(
@@ -6948,13 +9456,18 @@ void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectTagInfoEXT>* pTagInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectTagEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetDebugUtilsObjectTagEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pTagInfo"], pTagInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pTagInfo");
+        FieldToJson(jdata, pTagInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
@@ -6962,23 +9475,30 @@ void VulkanExportJsonConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueBeginDebugUtilsLabelEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueBeginDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("pLabelInfo");
+        FieldToJson(jdata, pLabelInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueEndDebugUtilsLabelEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            queue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueEndDebugUtilsLabelEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueEndDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
@@ -6986,12 +9506,16 @@ void VulkanExportJsonConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueInsertDebugUtilsLabelEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueInsertDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("pLabelInfo");
+        FieldToJson(jdata, pLabelInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
@@ -6999,25 +9523,34 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginDebugUtilsLabelEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBeginDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pLabelInfo");
+        FieldToJson(jdata, pLabelInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdEndDebugUtilsLabelEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndDebugUtilsLabelEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdEndDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
@@ -7025,13 +9558,18 @@ void VulkanExportJsonConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdInsertDebugUtilsLabelEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdInsertDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pLabelInfo");
+        FieldToJson(jdata, pLabelInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDebugUtilsMessengerEXT(
@@ -7042,15 +9580,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDebugUtilsMessengerEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugUtilsMessengerEXT>* pMessenger)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDebugUtilsMessengerEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDebugUtilsMessengerEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMessenger"], pMessenger, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pMessenger");
+        HandleToJson(jdata, pMessenger, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
@@ -7059,13 +9604,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
     format::HandleId                            messenger,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDebugUtilsMessengerEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyDebugUtilsMessengerEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        HandleToJson(args["messenger"], messenger, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("messenger");
+        HandleToJson(jdata, messenger, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSubmitDebugUtilsMessageEXT(
@@ -7075,14 +9625,20 @@ void VulkanExportJsonConsumer::Process_vkSubmitDebugUtilsMessageEXT(
     VkDebugUtilsMessageTypeFlagsEXT             messageTypes,
     StructPointerDecoder<Decoded_VkDebugUtilsMessengerCallbackDataEXT>* pCallbackData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSubmitDebugUtilsMessageEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSubmitDebugUtilsMessageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["messageSeverity"], messageSeverity, json_options);
-        FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t(), args["messageTypes"], messageTypes, json_options);
-        FieldToJson(args["pCallbackData"], pCallbackData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("messageSeverity");
+        FieldToJson(jdata, messageSeverity, json_options);
+        jdata.Key("messageTypes");
+        FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t(), jdata, messageTypes, json_options);
+        jdata.Key("pCallbackData");
+        FieldToJson(jdata, pCallbackData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDROID(
@@ -7092,14 +9648,20 @@ void VulkanExportJsonConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDRO
     uint64_t                                    buffer,
     StructPointerDecoder<Decoded_VkAndroidHardwareBufferPropertiesANDROID>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAndroidHardwareBufferPropertiesANDROID");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetAndroidHardwareBufferPropertiesANDROID");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("buffer");
+        FieldToJson(jdata, buffer, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
@@ -7109,14 +9671,20 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
     StructPointerDecoder<Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID>* pInfo,
     PointerDecoder<uint64_t, void*>*            pBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryAndroidHardwareBufferANDROID");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryAndroidHardwareBufferANDROID");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pBuffer"], pBuffer, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pBuffer");
+        FieldToJson(jdata, pBuffer, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEXT(
@@ -7124,13 +9692,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSampleLocationsInfoEXT>* pSampleLocationsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetSampleLocationsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSampleLocationsInfo"], pSampleLocationsInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pSampleLocationsInfo");
+        FieldToJson(jdata, pSampleLocationsInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(
@@ -7139,13 +9712,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesE
     VkSampleCountFlagBits                       samples,
     StructPointerDecoder<Decoded_VkMultisamplePropertiesEXT>* pMultisampleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["samples"], samples, json_options);
-        FieldToJson(args["pMultisampleProperties"], pMultisampleProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("samples");
+        FieldToJson(jdata, samples, json_options);
+        jdata.Key("pMultisampleProperties");
+        FieldToJson(jdata, pMultisampleProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
@@ -7155,14 +9733,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkImageDrmFormatModifierPropertiesEXT>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageDrmFormatModifierPropertiesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageDrmFormatModifierPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateValidationCacheEXT(
@@ -7173,15 +9757,22 @@ void VulkanExportJsonConsumer::Process_vkCreateValidationCacheEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkValidationCacheEXT>* pValidationCache)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateValidationCacheEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateValidationCacheEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pValidationCache"], pValidationCache, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pValidationCache");
+        HandleToJson(jdata, pValidationCache, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyValidationCacheEXT(
@@ -7190,13 +9781,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyValidationCacheEXT(
     format::HandleId                            validationCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyValidationCacheEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyValidationCacheEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["validationCache"], validationCache, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("validationCache");
+        HandleToJson(jdata, validationCache, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkMergeValidationCachesEXT(
@@ -7207,15 +9803,22 @@ void VulkanExportJsonConsumer::Process_vkMergeValidationCachesEXT(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkValidationCacheEXT>* pSrcCaches)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMergeValidationCachesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkMergeValidationCachesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["dstCache"], dstCache, json_options);
-        FieldToJson(args["srcCacheCount"], srcCacheCount, json_options);
-        HandleToJson(args["pSrcCaches"], pSrcCaches, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("dstCache");
+        HandleToJson(jdata, dstCache, json_options);
+        jdata.Key("srcCacheCount");
+        FieldToJson(jdata, srcCacheCount, json_options);
+        jdata.Key("pSrcCaches");
+        HandleToJson(jdata, pSrcCaches, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetValidationCacheDataEXT(
@@ -7226,15 +9829,22 @@ void VulkanExportJsonConsumer::Process_vkGetValidationCacheDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetValidationCacheDataEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetValidationCacheDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["validationCache"], validationCache, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("validationCache");
+        HandleToJson(jdata, validationCache, json_options);
+        jdata.Key("pDataSize");
+        FieldToJson(jdata, pDataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindShadingRateImageNV(
@@ -7243,14 +9853,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBindShadingRateImageNV(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindShadingRateImageNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindShadingRateImageNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("imageView");
+        HandleToJson(jdata, imageView, json_options);
+        jdata.Key("imageLayout");
+        FieldToJson(jdata, imageLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
@@ -7260,15 +9876,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkShadingRatePaletteNV>* pShadingRatePalettes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportShadingRatePaletteNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewportShadingRatePaletteNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pShadingRatePalettes"], pShadingRatePalettes, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstViewport");
+        FieldToJson(jdata, firstViewport, json_options);
+        jdata.Key("viewportCount");
+        FieldToJson(jdata, viewportCount, json_options);
+        jdata.Key("pShadingRatePalettes");
+        FieldToJson(jdata, pShadingRatePalettes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoarseSampleOrderNV(
@@ -7278,15 +9901,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoarseSampleOrderNV(
     uint32_t                                    customSampleOrderCount,
     StructPointerDecoder<Decoded_VkCoarseSampleOrderCustomNV>* pCustomSampleOrders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoarseSampleOrderNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoarseSampleOrderNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["sampleOrderType"], sampleOrderType, json_options);
-        FieldToJson(args["customSampleOrderCount"], customSampleOrderCount, json_options);
-        FieldToJson(args["pCustomSampleOrders"], pCustomSampleOrders, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("sampleOrderType");
+        FieldToJson(jdata, sampleOrderType, json_options);
+        jdata.Key("customSampleOrderCount");
+        FieldToJson(jdata, customSampleOrderCount, json_options);
+        jdata.Key("pCustomSampleOrders");
+        FieldToJson(jdata, pCustomSampleOrders, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureNV(
@@ -7297,15 +9927,22 @@ void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructure)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pAccelerationStructure"], pAccelerationStructure, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pAccelerationStructure");
+        HandleToJson(jdata, pAccelerationStructure, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureNV(
@@ -7314,13 +9951,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureNV(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["accelerationStructure"], accelerationStructure, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("accelerationStructure");
+        HandleToJson(jdata, accelerationStructure, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureMemoryRequirementsNV(
@@ -7329,13 +9971,18 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureMemoryRequireme
     StructPointerDecoder<Decoded_VkAccelerationStructureMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2KHR>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureMemoryRequirementsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetAccelerationStructureMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindAccelerationStructureMemoryNV(
@@ -7345,14 +9992,20 @@ void VulkanExportJsonConsumer::Process_vkBindAccelerationStructureMemoryNV(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindAccelerationStructureMemoryInfoNV>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindAccelerationStructureMemoryNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindAccelerationStructureMemoryNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("bindInfoCount");
+        FieldToJson(jdata, bindInfoCount, json_options);
+        jdata.Key("pBindInfos");
+        FieldToJson(jdata, pBindInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructureNV(
@@ -7367,20 +10020,32 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructureNV(
     format::HandleId                            scratch,
     VkDeviceSize                                scratchOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructureNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        HandleToJson(args["instanceData"], instanceData, json_options);
-        FieldToJson(args["instanceOffset"], instanceOffset, json_options);
-        Bool32ToJson(args["update"], update, json_options);
-        HandleToJson(args["dst"], dst, json_options);
-        HandleToJson(args["src"], src, json_options);
-        HandleToJson(args["scratch"], scratch, json_options);
-        FieldToJson(args["scratchOffset"], scratchOffset, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBuildAccelerationStructureNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("instanceData");
+        HandleToJson(jdata, instanceData, json_options);
+        jdata.Key("instanceOffset");
+        FieldToJson(jdata, instanceOffset, json_options);
+        jdata.Key("update");
+        Bool32ToJson(jdata, update, json_options);
+        jdata.Key("dst");
+        HandleToJson(jdata, dst, json_options);
+        jdata.Key("src");
+        HandleToJson(jdata, src, json_options);
+        jdata.Key("scratch");
+        HandleToJson(jdata, scratch, json_options);
+        jdata.Key("scratchOffset");
+        FieldToJson(jdata, scratchOffset, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureNV(
@@ -7390,15 +10055,22 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureNV(
     format::HandleId                            src,
     VkCopyAccelerationStructureModeKHR          mode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["dst"], dst, json_options);
-        HandleToJson(args["src"], src, json_options);
-        FieldToJson(args["mode"], mode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("dst");
+        HandleToJson(jdata, dst, json_options);
+        jdata.Key("src");
+        HandleToJson(jdata, src, json_options);
+        jdata.Key("mode");
+        FieldToJson(jdata, mode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdTraceRaysNV(
@@ -7419,26 +10091,44 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysNV(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["raygenShaderBindingTableBuffer"], raygenShaderBindingTableBuffer, json_options);
-        FieldToJson(args["raygenShaderBindingOffset"], raygenShaderBindingOffset, json_options);
-        HandleToJson(args["missShaderBindingTableBuffer"], missShaderBindingTableBuffer, json_options);
-        FieldToJson(args["missShaderBindingOffset"], missShaderBindingOffset, json_options);
-        FieldToJson(args["missShaderBindingStride"], missShaderBindingStride, json_options);
-        HandleToJson(args["hitShaderBindingTableBuffer"], hitShaderBindingTableBuffer, json_options);
-        FieldToJson(args["hitShaderBindingOffset"], hitShaderBindingOffset, json_options);
-        FieldToJson(args["hitShaderBindingStride"], hitShaderBindingStride, json_options);
-        HandleToJson(args["callableShaderBindingTableBuffer"], callableShaderBindingTableBuffer, json_options);
-        FieldToJson(args["callableShaderBindingOffset"], callableShaderBindingOffset, json_options);
-        FieldToJson(args["callableShaderBindingStride"], callableShaderBindingStride, json_options);
-        FieldToJson(args["width"], width, json_options);
-        FieldToJson(args["height"], height, json_options);
-        FieldToJson(args["depth"], depth, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdTraceRaysNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("raygenShaderBindingTableBuffer");
+        HandleToJson(jdata, raygenShaderBindingTableBuffer, json_options);
+        jdata.Key("raygenShaderBindingOffset");
+        FieldToJson(jdata, raygenShaderBindingOffset, json_options);
+        jdata.Key("missShaderBindingTableBuffer");
+        HandleToJson(jdata, missShaderBindingTableBuffer, json_options);
+        jdata.Key("missShaderBindingOffset");
+        FieldToJson(jdata, missShaderBindingOffset, json_options);
+        jdata.Key("missShaderBindingStride");
+        FieldToJson(jdata, missShaderBindingStride, json_options);
+        jdata.Key("hitShaderBindingTableBuffer");
+        HandleToJson(jdata, hitShaderBindingTableBuffer, json_options);
+        jdata.Key("hitShaderBindingOffset");
+        FieldToJson(jdata, hitShaderBindingOffset, json_options);
+        jdata.Key("hitShaderBindingStride");
+        FieldToJson(jdata, hitShaderBindingStride, json_options);
+        jdata.Key("callableShaderBindingTableBuffer");
+        HandleToJson(jdata, callableShaderBindingTableBuffer, json_options);
+        jdata.Key("callableShaderBindingOffset");
+        FieldToJson(jdata, callableShaderBindingOffset, json_options);
+        jdata.Key("callableShaderBindingStride");
+        FieldToJson(jdata, callableShaderBindingStride, json_options);
+        jdata.Key("width");
+        FieldToJson(jdata, width, json_options);
+        jdata.Key("height");
+        FieldToJson(jdata, height, json_options);
+        jdata.Key("depth");
+        FieldToJson(jdata, depth, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesNV(
@@ -7451,17 +10141,26 @@ void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateRayTracingPipelinesNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipelineCache");
+        HandleToJson(jdata, pipelineCache, json_options);
+        jdata.Key("createInfoCount");
+        FieldToJson(jdata, createInfoCount, json_options);
+        jdata.Key("pCreateInfos");
+        FieldToJson(jdata, pCreateInfos, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPipelines");
+        HandleToJson(jdata, pPipelines, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
@@ -7474,17 +10173,26 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["firstGroup"], firstGroup, json_options);
-        FieldToJson(args["groupCount"], groupCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("firstGroup");
+        FieldToJson(jdata, firstGroup, json_options);
+        jdata.Key("groupCount");
+        FieldToJson(jdata, groupCount, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
@@ -7497,17 +10205,26 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["firstGroup"], firstGroup, json_options);
-        FieldToJson(args["groupCount"], groupCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("firstGroup");
+        FieldToJson(jdata, firstGroup, json_options);
+        jdata.Key("groupCount");
+        FieldToJson(jdata, groupCount, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureHandleNV(
@@ -7518,15 +10235,22 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureHandleNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureHandleNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetAccelerationStructureHandleNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["accelerationStructure"], accelerationStructure, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("accelerationStructure");
+        HandleToJson(jdata, accelerationStructure, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesNV(
@@ -7538,17 +10262,26 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertie
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["accelerationStructureCount"], accelerationStructureCount, json_options);
-        HandleToJson(args["pAccelerationStructures"], pAccelerationStructures, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("accelerationStructureCount");
+        FieldToJson(jdata, accelerationStructureCount, json_options);
+        jdata.Key("pAccelerationStructures");
+        HandleToJson(jdata, pAccelerationStructures, json_options);
+        jdata.Key("queryType");
+        FieldToJson(jdata, queryType, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCompileDeferredNV(
@@ -7558,14 +10291,20 @@ void VulkanExportJsonConsumer::Process_vkCompileDeferredNV(
     format::HandleId                            pipeline,
     uint32_t                                    shader)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCompileDeferredNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCompileDeferredNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["shader"], shader, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("shader");
+        FieldToJson(jdata, shader, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
@@ -7576,15 +10315,22 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
     uint64_t                                    pHostPointer,
     StructPointerDecoder<Decoded_VkMemoryHostPointerPropertiesEXT>* pMemoryHostPointerProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryHostPointerPropertiesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryHostPointerPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["pHostPointer"], pHostPointer, json_options);
-        FieldToJson(args["pMemoryHostPointerProperties"], pMemoryHostPointerProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("handleType");
+        FieldToJson(jdata, handleType, json_options);
+        jdata.Key("pHostPointer");
+        FieldToJson(jdata, pHostPointer, json_options);
+        jdata.Key("pMemoryHostPointerProperties");
+        FieldToJson(jdata, pMemoryHostPointerProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarkerAMD(
@@ -7595,16 +10341,24 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarkerAMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarkerAMD");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineStage"], pipelineStage, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["marker"], marker, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteBufferMarkerAMD");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineStage");
+        FieldToJson(jdata, pipelineStage, json_options);
+        jdata.Key("dstBuffer");
+        HandleToJson(jdata, dstBuffer, json_options);
+        jdata.Key("dstOffset");
+        FieldToJson(jdata, dstOffset, json_options);
+        jdata.Key("marker");
+        FieldToJson(jdata, marker, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(
@@ -7614,14 +10368,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomai
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainKHR>*            pTimeDomains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pTimeDomainCount"], pTimeDomainCount, json_options);
-        FieldToJson(args["pTimeDomains"], pTimeDomains, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pTimeDomainCount");
+        FieldToJson(jdata, pTimeDomainCount, json_options);
+        jdata.Key("pTimeDomains");
+        FieldToJson(jdata, pTimeDomains, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsEXT(
@@ -7633,16 +10393,24 @@ void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsEXT(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["timestampCount"], timestampCount, json_options);
-        FieldToJson(args["pTimestampInfos"], pTimestampInfos, json_options);
-        FieldToJson(args["pTimestamps"], pTimestamps, json_options);
-        FieldToJson(args["pMaxDeviation"], pMaxDeviation, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetCalibratedTimestampsEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("timestampCount");
+        FieldToJson(jdata, timestampCount, json_options);
+        jdata.Key("pTimestampInfos");
+        FieldToJson(jdata, pTimestampInfos, json_options);
+        jdata.Key("pTimestamps");
+        FieldToJson(jdata, pTimestamps, json_options);
+        jdata.Key("pMaxDeviation");
+        FieldToJson(jdata, pMaxDeviation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksNV(
@@ -7651,14 +10419,20 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksNV(
     uint32_t                                    taskCount,
     uint32_t                                    firstTask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMeshTasksNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["taskCount"], taskCount, json_options);
-        FieldToJson(args["firstTask"], firstTask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("taskCount");
+        FieldToJson(jdata, taskCount, json_options);
+        jdata.Key("firstTask");
+        FieldToJson(jdata, firstTask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
@@ -7669,16 +10443,24 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("drawCount");
+        FieldToJson(jdata, drawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
@@ -7691,18 +10473,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorEnableNV(
@@ -7712,15 +10504,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorEnableNV(
     uint32_t                                    exclusiveScissorCount,
     PointerDecoder<VkBool32>*                   pExclusiveScissorEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorEnableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetExclusiveScissorEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstExclusiveScissor"], firstExclusiveScissor, json_options);
-        FieldToJson(args["exclusiveScissorCount"], exclusiveScissorCount, json_options);
-        Bool32ToJson(args["pExclusiveScissorEnables"], pExclusiveScissorEnables, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstExclusiveScissor");
+        FieldToJson(jdata, firstExclusiveScissor, json_options);
+        jdata.Key("exclusiveScissorCount");
+        FieldToJson(jdata, exclusiveScissorCount, json_options);
+        jdata.Key("pExclusiveScissorEnables");
+        Bool32ToJson(jdata, pExclusiveScissorEnables, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorNV(
@@ -7730,15 +10529,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorNV(
     uint32_t                                    exclusiveScissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pExclusiveScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetExclusiveScissorNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstExclusiveScissor"], firstExclusiveScissor, json_options);
-        FieldToJson(args["exclusiveScissorCount"], exclusiveScissorCount, json_options);
-        FieldToJson(args["pExclusiveScissors"], pExclusiveScissors, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstExclusiveScissor");
+        FieldToJson(jdata, firstExclusiveScissor, json_options);
+        jdata.Key("exclusiveScissorCount");
+        FieldToJson(jdata, exclusiveScissorCount, json_options);
+        jdata.Key("pExclusiveScissors");
+        FieldToJson(jdata, pExclusiveScissors, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCheckpointNV(
@@ -7746,13 +10552,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCheckpointNV(
     format::HandleId                            commandBuffer,
     uint64_t                                    pCheckpointMarker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCheckpointNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCheckpointNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCheckpointMarker"], pCheckpointMarker, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pCheckpointMarker");
+        FieldToJson(jdata, pCheckpointMarker, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointDataNV(
@@ -7761,13 +10572,18 @@ void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointDataNV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointDataNV>* pCheckpointData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointDataNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetQueueCheckpointDataNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pCheckpointDataCount"], pCheckpointDataCount, json_options);
-        FieldToJson(args["pCheckpointData"], pCheckpointData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("pCheckpointDataCount");
+        FieldToJson(jdata, pCheckpointDataCount, json_options);
+        jdata.Key("pCheckpointData");
+        FieldToJson(jdata, pCheckpointData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkInitializePerformanceApiINTEL(
@@ -7776,24 +10592,32 @@ void VulkanExportJsonConsumer::Process_vkInitializePerformanceApiINTEL(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkInitializePerformanceApiInfoINTEL>* pInitializeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkInitializePerformanceApiINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkInitializePerformanceApiINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInitializeInfo"], pInitializeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInitializeInfo");
+        FieldToJson(jdata, pInitializeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkUninitializePerformanceApiINTEL(
     const ApiCallInfo&                          call_info,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUninitializePerformanceApiINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkUninitializePerformanceApiINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
@@ -7802,14 +10626,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceMarkerInfoINTEL>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceMarkerINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPerformanceMarkerINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pMarkerInfo");
+        FieldToJson(jdata, pMarkerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
@@ -7818,14 +10648,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceStreamMarkerInfoINTEL>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceStreamMarkerINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPerformanceStreamMarkerINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pMarkerInfo");
+        FieldToJson(jdata, pMarkerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
@@ -7834,14 +10670,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceOverrideInfoINTEL>* pOverrideInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceOverrideINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPerformanceOverrideINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pOverrideInfo"], pOverrideInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pOverrideInfo");
+        FieldToJson(jdata, pOverrideInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
@@ -7851,14 +10693,20 @@ void VulkanExportJsonConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
     StructPointerDecoder<Decoded_VkPerformanceConfigurationAcquireInfoINTEL>* pAcquireInfo,
     HandlePointerDecoder<VkPerformanceConfigurationINTEL>* pConfiguration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquirePerformanceConfigurationINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquirePerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAcquireInfo"], pAcquireInfo, json_options);
-        HandleToJson(args["pConfiguration"], pConfiguration, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pAcquireInfo");
+        FieldToJson(jdata, pAcquireInfo, json_options);
+        jdata.Key("pConfiguration");
+        HandleToJson(jdata, pConfiguration, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkReleasePerformanceConfigurationINTEL(
@@ -7867,13 +10715,18 @@ void VulkanExportJsonConsumer::Process_vkReleasePerformanceConfigurationINTEL(
     format::HandleId                            device,
     format::HandleId                            configuration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleasePerformanceConfigurationINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkReleasePerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["configuration"], configuration, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("configuration");
+        HandleToJson(jdata, configuration, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
@@ -7882,13 +10735,18 @@ void VulkanExportJsonConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
     format::HandleId                            queue,
     format::HandleId                            configuration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSetPerformanceConfigurationINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueSetPerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        HandleToJson(args["configuration"], configuration, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("configuration");
+        HandleToJson(jdata, configuration, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPerformanceParameterINTEL(
@@ -7898,14 +10756,20 @@ void VulkanExportJsonConsumer::Process_vkGetPerformanceParameterINTEL(
     VkPerformanceParameterTypeINTEL             parameter,
     StructPointerDecoder<Decoded_VkPerformanceValueINTEL>* pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPerformanceParameterINTEL");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPerformanceParameterINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["parameter"], parameter, json_options);
-        FieldToJson(args["pValue"], pValue, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("parameter");
+        FieldToJson(jdata, parameter, json_options);
+        jdata.Key("pValue");
+        FieldToJson(jdata, pValue, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetLocalDimmingAMD(
@@ -7914,13 +10778,18 @@ void VulkanExportJsonConsumer::Process_vkSetLocalDimmingAMD(
     format::HandleId                            swapChain,
     VkBool32                                    localDimmingEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLocalDimmingAMD");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetLocalDimmingAMD");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapChain"], swapChain, json_options);
-        Bool32ToJson(args["localDimmingEnable"], localDimmingEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapChain");
+        HandleToJson(jdata, swapChain, json_options);
+        jdata.Key("localDimmingEnable");
+        Bool32ToJson(jdata, localDimmingEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
@@ -7931,15 +10800,22 @@ void VulkanExportJsonConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImagePipeSurfaceFUCHSIA");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateImagePipeSurfaceFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateMetalSurfaceEXT(
@@ -7950,15 +10826,22 @@ void VulkanExportJsonConsumer::Process_vkCreateMetalSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMetalSurfaceEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateMetalSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressEXT(
@@ -7967,13 +10850,18 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetBufferDeviceAddressEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJsonAsHex(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
@@ -7983,14 +10871,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolPropertiesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceToolPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pToolCount"], pToolCount, json_options);
-        FieldToJson(args["pToolProperties"], pToolProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pToolCount");
+        FieldToJson(jdata, pToolCount, json_options);
+        jdata.Key("pToolProperties");
+        FieldToJson(jdata, pToolProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(
@@ -8000,14 +10894,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesNV>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pPropertyCount");
+        FieldToJson(jdata, pPropertyCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(
@@ -8017,14 +10917,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMi
     PointerDecoder<uint32_t>*                   pCombinationCount,
     StructPointerDecoder<Decoded_VkFramebufferMixedSamplesCombinationNV>* pCombinations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pCombinationCount"], pCombinationCount, json_options);
-        FieldToJson(args["pCombinations"], pCombinations, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pCombinationCount");
+        FieldToJson(jdata, pCombinationCount, json_options);
+        jdata.Key("pCombinations");
+        FieldToJson(jdata, pCombinations, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(
@@ -8035,15 +10941,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EX
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pPresentModeCount"], pPresentModeCount, json_options);
-        FieldToJson(args["pPresentModes"], pPresentModes, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pSurfaceInfo");
+        FieldToJson(jdata, pSurfaceInfo, json_options);
+        jdata.Key("pPresentModeCount");
+        FieldToJson(jdata, pPresentModeCount, json_options);
+        jdata.Key("pPresentModes");
+        FieldToJson(jdata, pPresentModes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
@@ -8052,13 +10965,18 @@ void VulkanExportJsonConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireFullScreenExclusiveModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireFullScreenExclusiveModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
@@ -8067,13 +10985,18 @@ void VulkanExportJsonConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseFullScreenExclusiveModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkReleaseFullScreenExclusiveModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
@@ -8083,14 +11006,20 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModes2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModes2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pModes"], pModes, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pSurfaceInfo");
+        FieldToJson(jdata, pSurfaceInfo, json_options);
+        jdata.Key("pModes");
+        FieldToJson(jdata, pModes, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateHeadlessSurfaceEXT(
@@ -8101,15 +11030,22 @@ void VulkanExportJsonConsumer::Process_vkCreateHeadlessSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateHeadlessSurfaceEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateHeadlessSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEXT(
@@ -8118,14 +11054,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEXT(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLineStippleEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineStippleFactor"], lineStippleFactor, json_options);
-        FieldToJson(args["lineStipplePattern"], lineStipplePattern, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("lineStippleFactor");
+        FieldToJson(jdata, lineStippleFactor, json_options);
+        jdata.Key("lineStipplePattern");
+        FieldToJson(jdata, lineStipplePattern, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkResetQueryPoolEXT(
@@ -8135,14 +11077,20 @@ void VulkanExportJsonConsumer::Process_vkResetQueryPoolEXT(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetQueryPoolEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkResetQueryPoolEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+        jdata.Key("queryCount");
+        FieldToJson(jdata, queryCount, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCullModeEXT(
@@ -8150,13 +11098,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCullModeEXT(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCullModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCullModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkCullModeFlags_t(), args["cullMode"], cullMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("cullMode");
+        FieldToJson(VkCullModeFlags_t(), jdata, cullMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetFrontFaceEXT(
@@ -8164,13 +11117,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFrontFaceEXT(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFaceEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetFrontFaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["frontFace"], frontFace, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("frontFace");
+        FieldToJson(jdata, frontFace, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
@@ -8178,13 +11136,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopologyEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPrimitiveTopologyEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["primitiveTopology"], primitiveTopology, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("primitiveTopology");
+        FieldToJson(jdata, primitiveTopology, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCountEXT(
@@ -8193,14 +11156,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCountEXT(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCountEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewportWithCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewports"], pViewports, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("viewportCount");
+        FieldToJson(jdata, viewportCount, json_options);
+        jdata.Key("pViewports");
+        FieldToJson(jdata, pViewports, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCountEXT(
@@ -8209,14 +11178,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCountEXT(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCountEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetScissorWithCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["scissorCount"], scissorCount, json_options);
-        FieldToJson(args["pScissors"], pScissors, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("scissorCount");
+        FieldToJson(jdata, scissorCount, json_options);
+        jdata.Key("pScissors");
+        FieldToJson(jdata, pScissors, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2EXT(
@@ -8229,18 +11204,28 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2EXT(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2EXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-        FieldToJson(args["pSizes"], pSizes, json_options);
-        FieldToJson(args["pStrides"], pStrides, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindVertexBuffers2EXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstBinding");
+        FieldToJson(jdata, firstBinding, json_options);
+        jdata.Key("bindingCount");
+        FieldToJson(jdata, bindingCount, json_options);
+        jdata.Key("pBuffers");
+        HandleToJson(jdata, pBuffers, json_options);
+        jdata.Key("pOffsets");
+        FieldToJson(jdata, pOffsets, json_options);
+        jdata.Key("pSizes");
+        FieldToJson(jdata, pSizes, json_options);
+        jdata.Key("pStrides");
+        FieldToJson(jdata, pStrides, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnableEXT(
@@ -8248,13 +11233,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthTestEnable"], depthTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthTestEnable");
+        Bool32ToJson(jdata, depthTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnableEXT(
@@ -8262,13 +11252,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthWriteEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthWriteEnable"], depthWriteEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthWriteEnable");
+        Bool32ToJson(jdata, depthWriteEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOpEXT(
@@ -8276,13 +11271,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOpEXT(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOpEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthCompareOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["depthCompareOp"], depthCompareOp, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthCompareOp");
+        FieldToJson(jdata, depthCompareOp, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
@@ -8290,13 +11290,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBoundsTestEnable"], depthBoundsTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthBoundsTestEnable");
+        Bool32ToJson(jdata, depthBoundsTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnableEXT(
@@ -8304,13 +11309,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["stencilTestEnable"], stencilTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stencilTestEnable");
+        Bool32ToJson(jdata, stencilTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetStencilOpEXT(
@@ -8322,17 +11332,26 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilOpEXT(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOpEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["failOp"], failOp, json_options);
-        FieldToJson(args["passOp"], passOp, json_options);
-        FieldToJson(args["depthFailOp"], depthFailOp, json_options);
-        FieldToJson(args["compareOp"], compareOp, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetStencilOpEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("faceMask");
+        FieldToJson(VkStencilFaceFlags_t(), jdata, faceMask, json_options);
+        jdata.Key("failOp");
+        FieldToJson(jdata, failOp, json_options);
+        jdata.Key("passOp");
+        FieldToJson(jdata, passOp, json_options);
+        jdata.Key("depthFailOp");
+        FieldToJson(jdata, depthFailOp, json_options);
+        jdata.Key("compareOp");
+        FieldToJson(jdata, compareOp, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyMemoryToImageEXT(
@@ -8341,13 +11360,18 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToImageEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyMemoryToImageInfoEXT>* pCopyMemoryToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToImageEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyMemoryToImageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCopyMemoryToImageInfo"], pCopyMemoryToImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCopyMemoryToImageInfo");
+        FieldToJson(jdata, pCopyMemoryToImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyImageToMemoryEXT(
@@ -8356,13 +11380,18 @@ void VulkanExportJsonConsumer::Process_vkCopyImageToMemoryEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyImageToMemoryInfoEXT>* pCopyImageToMemoryInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyImageToMemoryEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyImageToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCopyImageToMemoryInfo"], pCopyImageToMemoryInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCopyImageToMemoryInfo");
+        FieldToJson(jdata, pCopyImageToMemoryInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyImageToImageEXT(
@@ -8371,13 +11400,18 @@ void VulkanExportJsonConsumer::Process_vkCopyImageToImageEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyImageToImageInfoEXT>* pCopyImageToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyImageToImageEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyImageToImageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCopyImageToImageInfo"], pCopyImageToImageInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCopyImageToImageInfo");
+        FieldToJson(jdata, pCopyImageToImageInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkTransitionImageLayoutEXT(
@@ -8387,14 +11421,20 @@ void VulkanExportJsonConsumer::Process_vkTransitionImageLayoutEXT(
     uint32_t                                    transitionCount,
     StructPointerDecoder<Decoded_VkHostImageLayoutTransitionInfoEXT>* pTransitions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTransitionImageLayoutEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkTransitionImageLayoutEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["transitionCount"], transitionCount, json_options);
-        FieldToJson(args["pTransitions"], pTransitions, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("transitionCount");
+        FieldToJson(jdata, transitionCount, json_options);
+        jdata.Key("pTransitions");
+        FieldToJson(jdata, pTransitions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2EXT(
@@ -8404,14 +11444,20 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2EXT(
     StructPointerDecoder<Decoded_VkImageSubresource2KHR>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetImageSubresourceLayout2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSubresource"], pSubresource, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("image");
+        HandleToJson(jdata, image, json_options);
+        jdata.Key("pSubresource");
+        FieldToJson(jdata, pSubresource, json_options);
+        jdata.Key("pLayout");
+        FieldToJson(jdata, pLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkReleaseSwapchainImagesEXT(
@@ -8420,13 +11466,18 @@ void VulkanExportJsonConsumer::Process_vkReleaseSwapchainImagesEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkReleaseSwapchainImagesInfoEXT>* pReleaseInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseSwapchainImagesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkReleaseSwapchainImagesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pReleaseInfo"], pReleaseInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pReleaseInfo");
+        FieldToJson(jdata, pReleaseInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsNV(
@@ -8435,13 +11486,18 @@ void VulkanExportJsonConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsN
     StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
@@ -8449,13 +11505,18 @@ void VulkanExportJsonConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pGeneratedCommandsInfo"], pGeneratedCommandsInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pGeneratedCommandsInfo");
+        FieldToJson(jdata, pGeneratedCommandsInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
@@ -8464,14 +11525,20 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
     VkBool32                                    isPreprocessed,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["isPreprocessed"], isPreprocessed, json_options);
-        FieldToJson(args["pGeneratedCommandsInfo"], pGeneratedCommandsInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("isPreprocessed");
+        Bool32ToJson(jdata, isPreprocessed, json_options);
+        jdata.Key("pGeneratedCommandsInfo");
+        FieldToJson(jdata, pGeneratedCommandsInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindPipelineShaderGroupNV(
@@ -8481,15 +11548,22 @@ void VulkanExportJsonConsumer::Process_vkCmdBindPipelineShaderGroupNV(
     format::HandleId                            pipeline,
     uint32_t                                    groupIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindPipelineShaderGroupNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindPipelineShaderGroupNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["groupIndex"], groupIndex, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineBindPoint");
+        FieldToJson(jdata, pipelineBindPoint, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("groupIndex");
+        FieldToJson(jdata, groupIndex, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateIndirectCommandsLayoutNV(
@@ -8500,15 +11574,22 @@ void VulkanExportJsonConsumer::Process_vkCreateIndirectCommandsLayoutNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectCommandsLayoutNV>* pIndirectCommandsLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateIndirectCommandsLayoutNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pIndirectCommandsLayout"], pIndirectCommandsLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pIndirectCommandsLayout");
+        HandleToJson(jdata, pIndirectCommandsLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
@@ -8517,13 +11598,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
     format::HandleId                            indirectCommandsLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["indirectCommandsLayout"], indirectCommandsLayout, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("indirectCommandsLayout");
+        HandleToJson(jdata, indirectCommandsLayout, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias2EXT(
@@ -8531,13 +11617,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias2EXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDepthBiasInfoEXT>* pDepthBiasInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias2EXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBias2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDepthBiasInfo"], pDepthBiasInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pDepthBiasInfo");
+        FieldToJson(jdata, pDepthBiasInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireDrmDisplayEXT(
@@ -8547,14 +11638,20 @@ void VulkanExportJsonConsumer::Process_vkAcquireDrmDisplayEXT(
     int32_t                                     drmFd,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireDrmDisplayEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireDrmDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["drmFd"], drmFd, json_options);
-        HandleToJson(args["display"], display, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("drmFd");
+        FieldToJson(jdata, drmFd, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDrmDisplayEXT(
@@ -8565,15 +11662,22 @@ void VulkanExportJsonConsumer::Process_vkGetDrmDisplayEXT(
     uint32_t                                    connectorId,
     HandlePointerDecoder<VkDisplayKHR>*         display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDrmDisplayEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDrmDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["drmFd"], drmFd, json_options);
-        FieldToJson(args["connectorId"], connectorId, json_options);
-        HandleToJson(args["display"], display, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("drmFd");
+        FieldToJson(jdata, drmFd, json_options);
+        jdata.Key("connectorId");
+        FieldToJson(jdata, connectorId, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlotEXT(
@@ -8584,15 +11688,22 @@ void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlotEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlotEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreatePrivateDataSlotEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPrivateDataSlot"], pPrivateDataSlot, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPrivateDataSlot");
+        HandleToJson(jdata, pPrivateDataSlot, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlotEXT(
@@ -8601,13 +11712,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlotEXT(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlotEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyPrivateDataSlotEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("privateDataSlot");
+        HandleToJson(jdata, privateDataSlot, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetPrivateDataEXT(
@@ -8619,16 +11735,24 @@ void VulkanExportJsonConsumer::Process_vkSetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetPrivateDataEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["data"], data, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetPrivateDataEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("objectType");
+        FieldToJson(jdata, objectType, json_options);
+        jdata.Key("objectHandle");
+        HandleToJson(jdata, objectHandle, json_options);
+        jdata.Key("privateDataSlot");
+        HandleToJson(jdata, privateDataSlot, json_options);
+        jdata.Key("data");
+        FieldToJson(jdata, data, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPrivateDataEXT(
@@ -8639,15 +11763,22 @@ void VulkanExportJsonConsumer::Process_vkGetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPrivateDataEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPrivateDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("objectType");
+        FieldToJson(jdata, objectType, json_options);
+        jdata.Key("objectHandle");
+        HandleToJson(jdata, objectHandle, json_options);
+        jdata.Key("privateDataSlot");
+        HandleToJson(jdata, privateDataSlot, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
@@ -8656,14 +11787,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
     VkFragmentShadingRateNV                     shadingRate,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateEnumNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetFragmentShadingRateEnumNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["shadingRate"], shadingRate, json_options);
-        FieldToJson(args["combinerOps"], combinerOps, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("shadingRate");
+        FieldToJson(jdata, shadingRate, json_options);
+        jdata.Key("combinerOps");
+        FieldToJson(jdata, combinerOps, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceFaultInfoEXT(
@@ -8673,14 +11810,20 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceFaultInfoEXT(
     StructPointerDecoder<Decoded_VkDeviceFaultCountsEXT>* pFaultCounts,
     StructPointerDecoder<Decoded_VkDeviceFaultInfoEXT>* pFaultInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceFaultInfoEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceFaultInfoEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pFaultCounts"], pFaultCounts, json_options);
-        FieldToJson(args["pFaultInfo"], pFaultInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pFaultCounts");
+        FieldToJson(jdata, pFaultCounts, json_options);
+        jdata.Key("pFaultInfo");
+        FieldToJson(jdata, pFaultInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkAcquireWinrtDisplayNV(
@@ -8689,13 +11832,18 @@ void VulkanExportJsonConsumer::Process_vkAcquireWinrtDisplayNV(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireWinrtDisplayNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkAcquireWinrtDisplayNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("display");
+        HandleToJson(jdata, display, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetWinrtDisplayNV(
@@ -8705,14 +11853,20 @@ void VulkanExportJsonConsumer::Process_vkGetWinrtDisplayNV(
     uint32_t                                    deviceRelativeId,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetWinrtDisplayNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetWinrtDisplayNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["deviceRelativeId"], deviceRelativeId, json_options);
-        HandleToJson(args["pDisplay"], pDisplay, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("deviceRelativeId");
+        FieldToJson(jdata, deviceRelativeId, json_options);
+        jdata.Key("pDisplay");
+        HandleToJson(jdata, pDisplay, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateDirectFBSurfaceEXT(
@@ -8723,15 +11877,22 @@ void VulkanExportJsonConsumer::Process_vkCreateDirectFBSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDirectFBSurfaceEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateDirectFBSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(
@@ -8741,14 +11902,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSu
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    dfb)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["dfb"], dfb, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    Bool32ToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("dfb");
+        FieldToJson(jdata, dfb, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetVertexInputEXT(
@@ -8759,16 +11926,24 @@ void VulkanExportJsonConsumer::Process_vkCmdSetVertexInputEXT(
     uint32_t                                    vertexAttributeDescriptionCount,
     StructPointerDecoder<Decoded_VkVertexInputAttributeDescription2EXT>* pVertexAttributeDescriptions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetVertexInputEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["vertexBindingDescriptionCount"], vertexBindingDescriptionCount, json_options);
-        FieldToJson(args["pVertexBindingDescriptions"], pVertexBindingDescriptions, json_options);
-        FieldToJson(args["vertexAttributeDescriptionCount"], vertexAttributeDescriptionCount, json_options);
-        FieldToJson(args["pVertexAttributeDescriptions"], pVertexAttributeDescriptions, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetVertexInputEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("vertexBindingDescriptionCount");
+        FieldToJson(jdata, vertexBindingDescriptionCount, json_options);
+        jdata.Key("pVertexBindingDescriptions");
+        FieldToJson(jdata, pVertexBindingDescriptions, json_options);
+        jdata.Key("vertexAttributeDescriptionCount");
+        FieldToJson(jdata, vertexAttributeDescriptionCount, json_options);
+        jdata.Key("pVertexAttributeDescriptions");
+        FieldToJson(jdata, pVertexAttributeDescriptions, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
@@ -8778,14 +11953,20 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkMemoryGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandleFUCHSIA");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetZirconHandleInfo"], pGetZirconHandleInfo, json_options);
-        FieldToJson(args["pZirconHandle"], pZirconHandle, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetZirconHandleInfo");
+        FieldToJson(jdata, pGetZirconHandleInfo, json_options);
+        jdata.Key("pZirconHandle");
+        FieldToJson(jdata, pZirconHandle, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
@@ -8796,15 +11977,22 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
     uint32_t                                    zirconHandle,
     StructPointerDecoder<Decoded_VkMemoryZirconHandlePropertiesFUCHSIA>* pMemoryZirconHandleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["zirconHandle"], zirconHandle, json_options);
-        FieldToJson(args["pMemoryZirconHandleProperties"], pMemoryZirconHandleProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("handleType");
+        FieldToJson(jdata, handleType, json_options);
+        jdata.Key("zirconHandle");
+        FieldToJson(jdata, zirconHandle, json_options);
+        jdata.Key("pMemoryZirconHandleProperties");
+        FieldToJson(jdata, pMemoryZirconHandleProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
@@ -8813,13 +12001,18 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA>* pImportSemaphoreZirconHandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreZirconHandleFUCHSIA");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkImportSemaphoreZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportSemaphoreZirconHandleInfo"], pImportSemaphoreZirconHandleInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pImportSemaphoreZirconHandleInfo");
+        FieldToJson(jdata, pImportSemaphoreZirconHandleInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
@@ -8829,14 +12022,20 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreZirconHandleFUCHSIA");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetSemaphoreZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetZirconHandleInfo"], pGetZirconHandleInfo, json_options);
-        FieldToJson(args["pZirconHandle"], pZirconHandle, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pGetZirconHandleInfo");
+        FieldToJson(jdata, pGetZirconHandleInfo, json_options);
+        jdata.Key("pZirconHandle");
+        FieldToJson(jdata, pZirconHandle, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindInvocationMaskHUAWEI(
@@ -8845,14 +12044,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBindInvocationMaskHUAWEI(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindInvocationMaskHUAWEI");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindInvocationMaskHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("imageView");
+        HandleToJson(jdata, imageView, json_options);
+        jdata.Key("imageLayout");
+        FieldToJson(jdata, imageLayout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMemoryRemoteAddressNV(
@@ -8862,14 +12067,20 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryRemoteAddressNV(
     StructPointerDecoder<Decoded_VkMemoryGetRemoteAddressInfoNV>* pMemoryGetRemoteAddressInfo,
     PointerDecoder<uint64_t, void*>*            pAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryRemoteAddressNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMemoryRemoteAddressNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pMemoryGetRemoteAddressInfo"], pMemoryGetRemoteAddressInfo, json_options);
-        FieldToJson(args["pAddress"], pAddress, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pMemoryGetRemoteAddressInfo");
+        FieldToJson(jdata, pMemoryGetRemoteAddressInfo, json_options);
+        jdata.Key("pAddress");
+        FieldToJson(jdata, pAddress, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPatchControlPointsEXT(
@@ -8877,13 +12088,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPatchControlPointsEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    patchControlPoints)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPatchControlPointsEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPatchControlPointsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["patchControlPoints"], patchControlPoints, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("patchControlPoints");
+        FieldToJson(jdata, patchControlPoints, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnableEXT(
@@ -8891,13 +12107,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["rasterizerDiscardEnable"], rasterizerDiscardEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("rasterizerDiscardEnable");
+        Bool32ToJson(jdata, rasterizerDiscardEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnableEXT(
@@ -8905,13 +12126,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthBiasEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBiasEnable"], depthBiasEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthBiasEnable");
+        Bool32ToJson(jdata, depthBiasEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEXT(
@@ -8919,13 +12145,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEXT(
     format::HandleId                            commandBuffer,
     VkLogicOp                                   logicOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLogicOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["logicOp"], logicOp, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("logicOp");
+        FieldToJson(jdata, logicOp, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnableEXT(
@@ -8933,13 +12164,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["primitiveRestartEnable"], primitiveRestartEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("primitiveRestartEnable");
+        Bool32ToJson(jdata, primitiveRestartEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateScreenSurfaceQNX(
@@ -8950,15 +12186,22 @@ void VulkanExportJsonConsumer::Process_vkCreateScreenSurfaceQNX(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateScreenSurfaceQNX");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateScreenSurfaceQNX");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("instance");
+        HandleToJson(jdata, instance, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSurface");
+        HandleToJson(jdata, pSurface, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupportQNX(
@@ -8968,14 +12211,20 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupp
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    window)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["window"], window, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    Bool32ToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("queueFamilyIndex");
+        FieldToJson(jdata, queueFamilyIndex, json_options);
+        jdata.Key("window");
+        FieldToJson(jdata, window, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteEnableEXT(
@@ -8984,14 +12233,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorWriteEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetColorWriteEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        Bool32ToJson(args["pColorWriteEnables"], pColorWriteEnables, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("attachmentCount");
+        FieldToJson(jdata, attachmentCount, json_options);
+        jdata.Key("pColorWriteEnables");
+        Bool32ToJson(jdata, pColorWriteEnables, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMultiEXT(
@@ -9003,17 +12258,26 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMultiEXT(
     uint32_t                                    firstInstance,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["pVertexInfo"], pVertexInfo, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMultiEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("drawCount");
+        FieldToJson(jdata, drawCount, json_options);
+        jdata.Key("pVertexInfo");
+        FieldToJson(jdata, pVertexInfo, json_options);
+        jdata.Key("instanceCount");
+        FieldToJson(jdata, instanceCount, json_options);
+        jdata.Key("firstInstance");
+        FieldToJson(jdata, firstInstance, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMultiIndexedEXT(
@@ -9026,18 +12290,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMultiIndexedEXT(
     uint32_t                                    stride,
     PointerDecoder<int32_t>*                    pVertexOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiIndexedEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["pIndexInfo"], pIndexInfo, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-        FieldToJson(args["pVertexOffset"], pVertexOffset, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMultiIndexedEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("drawCount");
+        FieldToJson(jdata, drawCount, json_options);
+        jdata.Key("pIndexInfo");
+        FieldToJson(jdata, pIndexInfo, json_options);
+        jdata.Key("instanceCount");
+        FieldToJson(jdata, instanceCount, json_options);
+        jdata.Key("firstInstance");
+        FieldToJson(jdata, firstInstance, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+        jdata.Key("pVertexOffset");
+        FieldToJson(jdata, pVertexOffset, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateMicromapEXT(
@@ -9048,15 +12322,22 @@ void VulkanExportJsonConsumer::Process_vkCreateMicromapEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkMicromapEXT>*        pMicromap)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMicromapEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMicromap"], pMicromap, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pMicromap");
+        HandleToJson(jdata, pMicromap, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyMicromapEXT(
@@ -9065,13 +12346,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyMicromapEXT(
     format::HandleId                            micromap,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyMicromapEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["micromap"], micromap, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("micromap");
+        HandleToJson(jdata, micromap, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBuildMicromapsEXT(
@@ -9080,14 +12366,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildMicromapsEXT(
     uint32_t                                    infoCount,
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildMicromapsEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBuildMicromapsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("infoCount");
+        FieldToJson(jdata, infoCount, json_options);
+        jdata.Key("pInfos");
+        FieldToJson(jdata, pInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBuildMicromapsEXT(
@@ -9098,15 +12390,22 @@ void VulkanExportJsonConsumer::Process_vkBuildMicromapsEXT(
     uint32_t                                    infoCount,
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBuildMicromapsEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBuildMicromapsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("infoCount");
+        FieldToJson(jdata, infoCount, json_options);
+        jdata.Key("pInfos");
+        FieldToJson(jdata, pInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyMicromapEXT(
@@ -9116,14 +12415,20 @@ void VulkanExportJsonConsumer::Process_vkCopyMicromapEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMicromapEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyMicromapToMemoryEXT(
@@ -9133,14 +12438,20 @@ void VulkanExportJsonConsumer::Process_vkCopyMicromapToMemoryEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMicromapToMemoryInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMicromapToMemoryEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyMicromapToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyMemoryToMicromapEXT(
@@ -9150,14 +12461,20 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToMicromapEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToMicromapEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyMemoryToMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkWriteMicromapsPropertiesEXT(
@@ -9171,18 +12488,28 @@ void VulkanExportJsonConsumer::Process_vkWriteMicromapsPropertiesEXT(
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWriteMicromapsPropertiesEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["micromapCount"], micromapCount, json_options);
-        HandleToJson(args["pMicromaps"], pMicromaps, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkWriteMicromapsPropertiesEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("micromapCount");
+        FieldToJson(jdata, micromapCount, json_options);
+        jdata.Key("pMicromaps");
+        HandleToJson(jdata, pMicromaps, json_options);
+        jdata.Key("queryType");
+        FieldToJson(jdata, queryType, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapEXT(
@@ -9190,13 +12517,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapToMemoryEXT(
@@ -9204,13 +12536,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapToMemoryEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMicromapToMemoryInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapToMemoryEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyMicromapToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToMicromapEXT(
@@ -9218,13 +12555,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToMicromapEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToMicromapEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyMemoryToMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteMicromapsPropertiesEXT(
@@ -9236,17 +12578,26 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteMicromapsPropertiesEXT(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteMicromapsPropertiesEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["micromapCount"], micromapCount, json_options);
-        HandleToJson(args["pMicromaps"], pMicromaps, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteMicromapsPropertiesEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("micromapCount");
+        FieldToJson(jdata, micromapCount, json_options);
+        jdata.Key("pMicromaps");
+        HandleToJson(jdata, pMicromaps, json_options);
+        jdata.Key("queryType");
+        FieldToJson(jdata, queryType, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceMicromapCompatibilityEXT(
@@ -9255,13 +12606,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMicromapCompatibilityEXT(
     StructPointerDecoder<Decoded_VkMicromapVersionInfoEXT>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMicromapCompatibilityEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceMicromapCompatibilityEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pVersionInfo"], pVersionInfo, json_options);
-        FieldToJson(args["pCompatibility"], pCompatibility, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pVersionInfo");
+        FieldToJson(jdata, pVersionInfo, json_options);
+        jdata.Key("pCompatibility");
+        FieldToJson(jdata, pCompatibility, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetMicromapBuildSizesEXT(
@@ -9271,14 +12627,20 @@ void VulkanExportJsonConsumer::Process_vkGetMicromapBuildSizesEXT(
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pBuildInfo,
     StructPointerDecoder<Decoded_VkMicromapBuildSizesInfoEXT>* pSizeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMicromapBuildSizesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetMicromapBuildSizesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["buildType"], buildType, json_options);
-        FieldToJson(args["pBuildInfo"], pBuildInfo, json_options);
-        FieldToJson(args["pSizeInfo"], pSizeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("buildType");
+        FieldToJson(jdata, buildType, json_options);
+        jdata.Key("pBuildInfo");
+        FieldToJson(jdata, pBuildInfo, json_options);
+        jdata.Key("pSizeInfo");
+        FieldToJson(jdata, pSizeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawClusterHUAWEI(
@@ -9288,15 +12650,22 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawClusterHUAWEI(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterHUAWEI");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawClusterHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("groupCountX");
+        FieldToJson(jdata, groupCountX, json_options);
+        jdata.Key("groupCountY");
+        FieldToJson(jdata, groupCountY, json_options);
+        jdata.Key("groupCountZ");
+        FieldToJson(jdata, groupCountZ, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawClusterIndirectHUAWEI(
@@ -9305,14 +12674,20 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawClusterIndirectHUAWEI(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterIndirectHUAWEI");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawClusterIndirectHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetDeviceMemoryPriorityEXT(
@@ -9321,13 +12696,18 @@ void VulkanExportJsonConsumer::Process_vkSetDeviceMemoryPriorityEXT(
     format::HandleId                            memory,
     float                                       priority)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDeviceMemoryPriorityEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetDeviceMemoryPriorityEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["priority"], priority, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("memory");
+        HandleToJson(jdata, memory, json_options);
+        jdata.Key("priority");
+        FieldToJson(jdata, priority, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutHostMappingInfoVALVE(
@@ -9336,13 +12716,18 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutHostMappingInfoVA
     StructPointerDecoder<Decoded_VkDescriptorSetBindingReferenceVALVE>* pBindingReference,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutHostMappingInfoVALVE>* pHostMapping)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pBindingReference"], pBindingReference, json_options);
-        FieldToJson(args["pHostMapping"], pHostMapping, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pBindingReference");
+        FieldToJson(jdata, pBindingReference, json_options);
+        jdata.Key("pHostMapping");
+        FieldToJson(jdata, pHostMapping, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDescriptorSetHostMappingVALVE(
@@ -9351,13 +12736,18 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetHostMappingVALVE(
     format::HandleId                            descriptorSet,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetHostMappingVALVE");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDescriptorSetHostMappingVALVE");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorSet"], descriptorSet, json_options);
-        FieldToJsonAsHex(args["ppData"], ppData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("descriptorSet");
+        HandleToJson(jdata, descriptorSet, json_options);
+        jdata.Key("ppData");
+        FieldToJsonAsHex(jdata, ppData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectMemoryRequirementsNV(
@@ -9366,13 +12756,18 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectMemoryRequirementsNV
     StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectMemoryRequirementsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPipelineIndirectMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pMemoryRequirements");
+        FieldToJson(jdata, pMemoryRequirements, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdUpdatePipelineIndirectBufferNV(
@@ -9381,14 +12776,20 @@ void VulkanExportJsonConsumer::Process_vkCmdUpdatePipelineIndirectBufferNV(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdUpdatePipelineIndirectBufferNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdUpdatePipelineIndirectBufferNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineBindPoint");
+        FieldToJson(jdata, pipelineBindPoint, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectDeviceAddressNV(
@@ -9397,13 +12798,18 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectDeviceAddressNV(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkPipelineIndirectDeviceAddressInfoNV>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectDeviceAddressNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPipelineIndirectDeviceAddressNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJsonAsHex(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthClampEnableEXT(
@@ -9411,13 +12817,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClampEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthClampEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClampEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthClampEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthClampEnable"], depthClampEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthClampEnable");
+        Bool32ToJson(jdata, depthClampEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetPolygonModeEXT(
@@ -9425,13 +12836,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPolygonModeEXT(
     format::HandleId                            commandBuffer,
     VkPolygonMode                               polygonMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPolygonModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetPolygonModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["polygonMode"], polygonMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("polygonMode");
+        FieldToJson(jdata, polygonMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationSamplesEXT(
@@ -9439,13 +12855,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationSamplesEXT(
     format::HandleId                            commandBuffer,
     VkSampleCountFlagBits                       rasterizationSamples)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationSamplesEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRasterizationSamplesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["rasterizationSamples"], rasterizationSamples, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("rasterizationSamples");
+        FieldToJson(jdata, rasterizationSamples, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetSampleMaskEXT(
@@ -9454,14 +12875,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleMaskEXT(
     VkSampleCountFlagBits                       samples,
     PointerDecoder<VkSampleMask>*               pSampleMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleMaskEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetSampleMaskEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["samples"], samples, json_options);
-        FieldToJson(args["pSampleMask"], pSampleMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("samples");
+        FieldToJson(jdata, samples, json_options);
+        jdata.Key("pSampleMask");
+        FieldToJson(jdata, pSampleMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToCoverageEnableEXT(
@@ -9469,13 +12896,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToCoverageEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    alphaToCoverageEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToCoverageEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetAlphaToCoverageEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["alphaToCoverageEnable"], alphaToCoverageEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("alphaToCoverageEnable");
+        Bool32ToJson(jdata, alphaToCoverageEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToOneEnableEXT(
@@ -9483,13 +12915,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToOneEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    alphaToOneEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToOneEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetAlphaToOneEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["alphaToOneEnable"], alphaToOneEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("alphaToOneEnable");
+        Bool32ToJson(jdata, alphaToOneEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEnableEXT(
@@ -9497,13 +12934,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    logicOpEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLogicOpEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["logicOpEnable"], logicOpEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("logicOpEnable");
+        Bool32ToJson(jdata, logicOpEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEnableEXT(
@@ -9513,15 +12955,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorBlendEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetColorBlendEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        Bool32ToJson(args["pColorBlendEnables"], pColorBlendEnables, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstAttachment");
+        FieldToJson(jdata, firstAttachment, json_options);
+        jdata.Key("attachmentCount");
+        FieldToJson(jdata, attachmentCount, json_options);
+        jdata.Key("pColorBlendEnables");
+        Bool32ToJson(jdata, pColorBlendEnables, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEquationEXT(
@@ -9531,15 +12980,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEquationEXT(
     uint32_t                                    attachmentCount,
     StructPointerDecoder<Decoded_VkColorBlendEquationEXT>* pColorBlendEquations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEquationEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetColorBlendEquationEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pColorBlendEquations"], pColorBlendEquations, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstAttachment");
+        FieldToJson(jdata, firstAttachment, json_options);
+        jdata.Key("attachmentCount");
+        FieldToJson(jdata, attachmentCount, json_options);
+        jdata.Key("pColorBlendEquations");
+        FieldToJson(jdata, pColorBlendEquations, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteMaskEXT(
@@ -9549,15 +13005,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteMaskEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkColorComponentFlags>*      pColorWriteMasks)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteMaskEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetColorWriteMaskEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pColorWriteMasks"], pColorWriteMasks, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstAttachment");
+        FieldToJson(jdata, firstAttachment, json_options);
+        jdata.Key("attachmentCount");
+        FieldToJson(jdata, attachmentCount, json_options);
+        jdata.Key("pColorWriteMasks");
+        FieldToJson(jdata, pColorWriteMasks, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetTessellationDomainOriginEXT(
@@ -9565,13 +13028,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetTessellationDomainOriginEXT(
     format::HandleId                            commandBuffer,
     VkTessellationDomainOrigin                  domainOrigin)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetTessellationDomainOriginEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetTessellationDomainOriginEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["domainOrigin"], domainOrigin, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("domainOrigin");
+        FieldToJson(jdata, domainOrigin, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationStreamEXT(
@@ -9579,13 +13047,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationStreamEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    rasterizationStream)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationStreamEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRasterizationStreamEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["rasterizationStream"], rasterizationStream, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("rasterizationStream");
+        FieldToJson(jdata, rasterizationStream, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetConservativeRasterizationModeEXT(
@@ -9593,13 +13066,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetConservativeRasterizationModeEXT(
     format::HandleId                            commandBuffer,
     VkConservativeRasterizationModeEXT          conservativeRasterizationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetConservativeRasterizationModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetConservativeRasterizationModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["conservativeRasterizationMode"], conservativeRasterizationMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("conservativeRasterizationMode");
+        FieldToJson(jdata, conservativeRasterizationMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetExtraPrimitiveOverestimationSizeEXT(
@@ -9607,13 +13085,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExtraPrimitiveOverestimationSizeE
     format::HandleId                            commandBuffer,
     float                                       extraPrimitiveOverestimationSize)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["extraPrimitiveOverestimationSize"], extraPrimitiveOverestimationSize, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("extraPrimitiveOverestimationSize");
+        FieldToJson(jdata, extraPrimitiveOverestimationSize, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipEnableEXT(
@@ -9621,13 +13104,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthClipEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthClipEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthClipEnable"], depthClipEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("depthClipEnable");
+        Bool32ToJson(jdata, depthClipEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEnableEXT(
@@ -9635,13 +13123,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    sampleLocationsEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetSampleLocationsEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["sampleLocationsEnable"], sampleLocationsEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("sampleLocationsEnable");
+        Bool32ToJson(jdata, sampleLocationsEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendAdvancedEXT(
@@ -9651,15 +13144,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendAdvancedEXT(
     uint32_t                                    attachmentCount,
     StructPointerDecoder<Decoded_VkColorBlendAdvancedEXT>* pColorBlendAdvanced)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendAdvancedEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetColorBlendAdvancedEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pColorBlendAdvanced"], pColorBlendAdvanced, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstAttachment");
+        FieldToJson(jdata, firstAttachment, json_options);
+        jdata.Key("attachmentCount");
+        FieldToJson(jdata, attachmentCount, json_options);
+        jdata.Key("pColorBlendAdvanced");
+        FieldToJson(jdata, pColorBlendAdvanced, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetProvokingVertexModeEXT(
@@ -9667,13 +13167,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetProvokingVertexModeEXT(
     format::HandleId                            commandBuffer,
     VkProvokingVertexModeEXT                    provokingVertexMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetProvokingVertexModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetProvokingVertexModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["provokingVertexMode"], provokingVertexMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("provokingVertexMode");
+        FieldToJson(jdata, provokingVertexMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLineRasterizationModeEXT(
@@ -9681,13 +13186,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineRasterizationModeEXT(
     format::HandleId                            commandBuffer,
     VkLineRasterizationModeEXT                  lineRasterizationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineRasterizationModeEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLineRasterizationModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineRasterizationMode"], lineRasterizationMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("lineRasterizationMode");
+        FieldToJson(jdata, lineRasterizationMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEnableEXT(
@@ -9695,13 +13205,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stippledLineEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetLineStippleEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["stippledLineEnable"], stippledLineEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stippledLineEnable");
+        Bool32ToJson(jdata, stippledLineEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipNegativeOneToOneEXT(
@@ -9709,13 +13224,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipNegativeOneToOneEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    negativeOneToOne)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipNegativeOneToOneEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetDepthClipNegativeOneToOneEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["negativeOneToOne"], negativeOneToOne, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("negativeOneToOne");
+        Bool32ToJson(jdata, negativeOneToOne, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingEnableNV(
@@ -9723,13 +13243,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    viewportWScalingEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingEnableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewportWScalingEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["viewportWScalingEnable"], viewportWScalingEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("viewportWScalingEnable");
+        Bool32ToJson(jdata, viewportWScalingEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetViewportSwizzleNV(
@@ -9739,15 +13264,22 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportSwizzleNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportSwizzleNV>* pViewportSwizzles)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportSwizzleNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetViewportSwizzleNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewportSwizzles"], pViewportSwizzles, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("firstViewport");
+        FieldToJson(jdata, firstViewport, json_options);
+        jdata.Key("viewportCount");
+        FieldToJson(jdata, viewportCount, json_options);
+        jdata.Key("pViewportSwizzles");
+        FieldToJson(jdata, pViewportSwizzles, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorEnableNV(
@@ -9755,13 +13287,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    coverageToColorEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorEnableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoverageToColorEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["coverageToColorEnable"], coverageToColorEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("coverageToColorEnable");
+        Bool32ToJson(jdata, coverageToColorEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorLocationNV(
@@ -9769,13 +13306,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorLocationNV(
     format::HandleId                            commandBuffer,
     uint32_t                                    coverageToColorLocation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorLocationNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoverageToColorLocationNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageToColorLocation"], coverageToColorLocation, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("coverageToColorLocation");
+        FieldToJson(jdata, coverageToColorLocation, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationModeNV(
@@ -9783,13 +13325,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationModeNV(
     format::HandleId                            commandBuffer,
     VkCoverageModulationModeNV                  coverageModulationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationModeNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoverageModulationModeNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageModulationMode"], coverageModulationMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("coverageModulationMode");
+        FieldToJson(jdata, coverageModulationMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableEnableNV(
@@ -9797,13 +13344,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    coverageModulationTableEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableEnableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoverageModulationTableEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["coverageModulationTableEnable"], coverageModulationTableEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("coverageModulationTableEnable");
+        Bool32ToJson(jdata, coverageModulationTableEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableNV(
@@ -9812,14 +13364,20 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableNV(
     uint32_t                                    coverageModulationTableCount,
     PointerDecoder<float>*                      pCoverageModulationTable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoverageModulationTableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageModulationTableCount"], coverageModulationTableCount, json_options);
-        FieldToJson(args["pCoverageModulationTable"], pCoverageModulationTable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("coverageModulationTableCount");
+        FieldToJson(jdata, coverageModulationTableCount, json_options);
+        jdata.Key("pCoverageModulationTable");
+        FieldToJson(jdata, pCoverageModulationTable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetShadingRateImageEnableNV(
@@ -9827,13 +13385,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetShadingRateImageEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    shadingRateImageEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetShadingRateImageEnableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetShadingRateImageEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["shadingRateImageEnable"], shadingRateImageEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("shadingRateImageEnable");
+        Bool32ToJson(jdata, shadingRateImageEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRepresentativeFragmentTestEnableNV(
@@ -9841,13 +13404,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRepresentativeFragmentTestEnableN
     format::HandleId                            commandBuffer,
     VkBool32                                    representativeFragmentTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRepresentativeFragmentTestEnableNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRepresentativeFragmentTestEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["representativeFragmentTestEnable"], representativeFragmentTestEnable, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("representativeFragmentTestEnable");
+        Bool32ToJson(jdata, representativeFragmentTestEnable, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetCoverageReductionModeNV(
@@ -9855,13 +13423,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageReductionModeNV(
     format::HandleId                            commandBuffer,
     VkCoverageReductionModeNV                   coverageReductionMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageReductionModeNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetCoverageReductionModeNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageReductionMode"], coverageReductionMode, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("coverageReductionMode");
+        FieldToJson(jdata, coverageReductionMode, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetShaderModuleIdentifierEXT(
@@ -9870,13 +13443,18 @@ void VulkanExportJsonConsumer::Process_vkGetShaderModuleIdentifierEXT(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkShaderModuleIdentifierEXT>* pIdentifier)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleIdentifierEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetShaderModuleIdentifierEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shaderModule"], shaderModule, json_options);
-        FieldToJson(args["pIdentifier"], pIdentifier, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("shaderModule");
+        HandleToJson(jdata, shaderModule, json_options);
+        jdata.Key("pIdentifier");
+        FieldToJson(jdata, pIdentifier, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetShaderModuleCreateInfoIdentifierEXT(
@@ -9885,13 +13463,18 @@ void VulkanExportJsonConsumer::Process_vkGetShaderModuleCreateInfoIdentifierEXT(
     StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkShaderModuleIdentifierEXT>* pIdentifier)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleCreateInfoIdentifierEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetShaderModuleCreateInfoIdentifierEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pIdentifier"], pIdentifier, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pIdentifier");
+        FieldToJson(jdata, pIdentifier, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceOpticalFlowImageFormatsNV(
@@ -9902,15 +13485,22 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceOpticalFlowImageFormat
     PointerDecoder<uint32_t>*                   pFormatCount,
     StructPointerDecoder<Decoded_VkOpticalFlowImageFormatPropertiesNV>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pOpticalFlowImageFormatInfo"], pOpticalFlowImageFormatInfo, json_options);
-        FieldToJson(args["pFormatCount"], pFormatCount, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("physicalDevice");
+        HandleToJson(jdata, physicalDevice, json_options);
+        jdata.Key("pOpticalFlowImageFormatInfo");
+        FieldToJson(jdata, pOpticalFlowImageFormatInfo, json_options);
+        jdata.Key("pFormatCount");
+        FieldToJson(jdata, pFormatCount, json_options);
+        jdata.Key("pImageFormatProperties");
+        FieldToJson(jdata, pImageFormatProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateOpticalFlowSessionNV(
@@ -9921,15 +13511,22 @@ void VulkanExportJsonConsumer::Process_vkCreateOpticalFlowSessionNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkOpticalFlowSessionNV>* pSession)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateOpticalFlowSessionNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateOpticalFlowSessionNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSession"], pSession, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pSession");
+        HandleToJson(jdata, pSession, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyOpticalFlowSessionNV(
@@ -9938,13 +13535,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyOpticalFlowSessionNV(
     format::HandleId                            session,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyOpticalFlowSessionNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyOpticalFlowSessionNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["session"], session, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("session");
+        HandleToJson(jdata, session, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkBindOpticalFlowSessionImageNV(
@@ -9956,16 +13558,24 @@ void VulkanExportJsonConsumer::Process_vkBindOpticalFlowSessionImageNV(
     format::HandleId                            view,
     VkImageLayout                               layout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindOpticalFlowSessionImageNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["session"], session, json_options);
-        FieldToJson(args["bindingPoint"], bindingPoint, json_options);
-        HandleToJson(args["view"], view, json_options);
-        FieldToJson(args["layout"], layout, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkBindOpticalFlowSessionImageNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("session");
+        HandleToJson(jdata, session, json_options);
+        jdata.Key("bindingPoint");
+        FieldToJson(jdata, bindingPoint, json_options);
+        jdata.Key("view");
+        HandleToJson(jdata, view, json_options);
+        jdata.Key("layout");
+        FieldToJson(jdata, layout, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdOpticalFlowExecuteNV(
@@ -9974,14 +13584,20 @@ void VulkanExportJsonConsumer::Process_vkCmdOpticalFlowExecuteNV(
     format::HandleId                            session,
     StructPointerDecoder<Decoded_VkOpticalFlowExecuteInfoNV>* pExecuteInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdOpticalFlowExecuteNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdOpticalFlowExecuteNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["session"], session, json_options);
-        FieldToJson(args["pExecuteInfo"], pExecuteInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("session");
+        HandleToJson(jdata, session, json_options);
+        jdata.Key("pExecuteInfo");
+        FieldToJson(jdata, pExecuteInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateShadersEXT(
@@ -9993,16 +13609,24 @@ void VulkanExportJsonConsumer::Process_vkCreateShadersEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkShaderEXT>*          pShaders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateShadersEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pShaders"], pShaders, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateShadersEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("createInfoCount");
+        FieldToJson(jdata, createInfoCount, json_options);
+        jdata.Key("pCreateInfos");
+        FieldToJson(jdata, pCreateInfos, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pShaders");
+        HandleToJson(jdata, pShaders, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyShaderEXT(
@@ -10011,13 +13635,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyShaderEXT(
     format::HandleId                            shader,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyShaderEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyShaderEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shader"], shader, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("shader");
+        HandleToJson(jdata, shader, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetShaderBinaryDataEXT(
@@ -10028,15 +13657,22 @@ void VulkanExportJsonConsumer::Process_vkGetShaderBinaryDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderBinaryDataEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetShaderBinaryDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shader"], shader, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("shader");
+        HandleToJson(jdata, shader, json_options);
+        jdata.Key("pDataSize");
+        FieldToJson(jdata, pDataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBindShadersEXT(
@@ -10046,15 +13682,22 @@ void VulkanExportJsonConsumer::Process_vkCmdBindShadersEXT(
     PointerDecoder<VkShaderStageFlagBits>*      pStages,
     HandlePointerDecoder<VkShaderEXT>*          pShaders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindShadersEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBindShadersEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["stageCount"], stageCount, json_options);
-        FieldToJson(args["pStages"], pStages, json_options);
-        HandleToJson(args["pShaders"], pShaders, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("stageCount");
+        FieldToJson(jdata, stageCount, json_options);
+        jdata.Key("pStages");
+        FieldToJson(jdata, pStages, json_options);
+        jdata.Key("pShaders");
+        HandleToJson(jdata, pShaders, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetFramebufferTilePropertiesQCOM(
@@ -10065,15 +13708,22 @@ void VulkanExportJsonConsumer::Process_vkGetFramebufferTilePropertiesQCOM(
     PointerDecoder<uint32_t>*                   pPropertiesCount,
     StructPointerDecoder<Decoded_VkTilePropertiesQCOM>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFramebufferTilePropertiesQCOM");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetFramebufferTilePropertiesQCOM");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["framebuffer"], framebuffer, json_options);
-        FieldToJson(args["pPropertiesCount"], pPropertiesCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("framebuffer");
+        HandleToJson(jdata, framebuffer, json_options);
+        jdata.Key("pPropertiesCount");
+        FieldToJson(jdata, pPropertiesCount, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDynamicRenderingTilePropertiesQCOM(
@@ -10083,14 +13733,20 @@ void VulkanExportJsonConsumer::Process_vkGetDynamicRenderingTilePropertiesQCOM(
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo,
     StructPointerDecoder<Decoded_VkTilePropertiesQCOM>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDynamicRenderingTilePropertiesQCOM");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDynamicRenderingTilePropertiesQCOM");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pRenderingInfo"], pRenderingInfo, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pRenderingInfo");
+        FieldToJson(jdata, pRenderingInfo, json_options);
+        jdata.Key("pProperties");
+        FieldToJson(jdata, pProperties, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetLatencySleepModeNV(
@@ -10100,14 +13756,20 @@ void VulkanExportJsonConsumer::Process_vkSetLatencySleepModeNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkLatencySleepModeInfoNV>* pSleepModeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLatencySleepModeNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetLatencySleepModeNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pSleepModeInfo"], pSleepModeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pSleepModeInfo");
+        FieldToJson(jdata, pSleepModeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkLatencySleepNV(
@@ -10117,14 +13779,20 @@ void VulkanExportJsonConsumer::Process_vkLatencySleepNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkLatencySleepInfoNV>* pSleepInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkLatencySleepNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkLatencySleepNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pSleepInfo"], pSleepInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pSleepInfo");
+        FieldToJson(jdata, pSleepInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkSetLatencyMarkerNV(
@@ -10133,13 +13801,18 @@ void VulkanExportJsonConsumer::Process_vkSetLatencyMarkerNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkSetLatencyMarkerInfoNV>* pLatencyMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLatencyMarkerNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkSetLatencyMarkerNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pLatencyMarkerInfo"], pLatencyMarkerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pLatencyMarkerInfo");
+        FieldToJson(jdata, pLatencyMarkerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetLatencyTimingsNV(
@@ -10148,13 +13821,18 @@ void VulkanExportJsonConsumer::Process_vkGetLatencyTimingsNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkGetLatencyMarkerInfoNV>* pLatencyMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetLatencyTimingsNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetLatencyTimingsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pLatencyMarkerInfo"], pLatencyMarkerInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("swapchain");
+        HandleToJson(jdata, swapchain, json_options);
+        jdata.Key("pLatencyMarkerInfo");
+        FieldToJson(jdata, pLatencyMarkerInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkQueueNotifyOutOfBandNV(
@@ -10162,12 +13840,16 @@ void VulkanExportJsonConsumer::Process_vkQueueNotifyOutOfBandNV(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkOutOfBandQueueTypeInfoNV>* pQueueTypeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueNotifyOutOfBandNV");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkQueueNotifyOutOfBandNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pQueueTypeInfo"], pQueueTypeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("queue");
+        HandleToJson(jdata, queue, json_options);
+        jdata.Key("pQueueTypeInfo");
+        FieldToJson(jdata, pQueueTypeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetAttachmentFeedbackLoopEnableEXT(
@@ -10175,13 +13857,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAttachmentFeedbackLoopEnableEXT(
     format::HandleId                            commandBuffer,
     VkImageAspectFlags                          aspectMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkImageAspectFlags_t(), args["aspectMask"], aspectMask, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("aspectMask");
+        FieldToJson(VkImageAspectFlags_t(), jdata, aspectMask, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureKHR(
@@ -10192,15 +13879,22 @@ void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructure)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pAccelerationStructure"], pAccelerationStructure, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pCreateInfo");
+        FieldToJson(jdata, pCreateInfo, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pAccelerationStructure");
+        HandleToJson(jdata, pAccelerationStructure, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureKHR(
@@ -10209,13 +13903,18 @@ void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureKHR(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkDestroyAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["accelerationStructure"], accelerationStructure, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("accelerationStructure");
+        HandleToJson(jdata, accelerationStructure, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
@@ -10225,15 +13924,22 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>* ppBuildRangeInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructuresKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdBuildAccelerationStructuresKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
-        FieldToJson(args["ppBuildRangeInfos"], ppBuildRangeInfos, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("infoCount");
+        FieldToJson(jdata, infoCount, json_options);
+        jdata.Key("pInfos");
+        FieldToJson(jdata, pInfos, json_options);
+        jdata.Key("ppBuildRangeInfos");
+        FieldToJson(jdata, ppBuildRangeInfos, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
@@ -10243,14 +13949,20 @@ void VulkanExportJsonConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyAccelerationStructureToMemoryKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyAccelerationStructureToMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
@@ -10260,14 +13972,20 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToAccelerationStructureKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCopyMemoryToAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkWriteAccelerationStructuresPropertiesKHR(
@@ -10281,18 +13999,28 @@ void VulkanExportJsonConsumer::Process_vkWriteAccelerationStructuresPropertiesKH
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWriteAccelerationStructuresPropertiesKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["accelerationStructureCount"], accelerationStructureCount, json_options);
-        HandleToJson(args["pAccelerationStructures"], pAccelerationStructures, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkWriteAccelerationStructuresPropertiesKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("accelerationStructureCount");
+        FieldToJson(jdata, accelerationStructureCount, json_options);
+        jdata.Key("pAccelerationStructures");
+        HandleToJson(jdata, pAccelerationStructures, json_options);
+        jdata.Key("queryType");
+        FieldToJson(jdata, queryType, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureKHR(
@@ -10300,13 +14028,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR(
@@ -10314,13 +14047,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureToMemoryKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyAccelerationStructureToMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR(
@@ -10328,13 +14066,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToAccelerationStructureKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdCopyMemoryToAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureDeviceAddressKHR(
@@ -10343,13 +14086,18 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureDeviceAddressKH
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureDeviceAddressKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetAccelerationStructureDeviceAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJsonAsHex(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pInfo");
+        FieldToJson(jdata, pInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesKHR(
@@ -10361,17 +14109,26 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertie
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["accelerationStructureCount"], accelerationStructureCount, json_options);
-        HandleToJson(args["pAccelerationStructures"], pAccelerationStructures, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("accelerationStructureCount");
+        FieldToJson(jdata, accelerationStructureCount, json_options);
+        jdata.Key("pAccelerationStructures");
+        HandleToJson(jdata, pAccelerationStructures, json_options);
+        jdata.Key("queryType");
+        FieldToJson(jdata, queryType, json_options);
+        jdata.Key("queryPool");
+        HandleToJson(jdata, queryPool, json_options);
+        jdata.Key("firstQuery");
+        FieldToJson(jdata, firstQuery, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetDeviceAccelerationStructureCompatibilityKHR(
@@ -10380,13 +14137,18 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceAccelerationStructureCompatibi
     StructPointerDecoder<Decoded_VkAccelerationStructureVersionInfoKHR>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceAccelerationStructureCompatibilityKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetDeviceAccelerationStructureCompatibilityKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pVersionInfo"], pVersionInfo, json_options);
-        FieldToJson(args["pCompatibility"], pCompatibility, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pVersionInfo");
+        FieldToJson(jdata, pVersionInfo, json_options);
+        jdata.Key("pCompatibility");
+        FieldToJson(jdata, pCompatibility, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
@@ -10397,15 +14159,22 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
     PointerDecoder<uint32_t>*                   pMaxPrimitiveCounts,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildSizesInfoKHR>* pSizeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureBuildSizesKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetAccelerationStructureBuildSizesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["buildType"], buildType, json_options);
-        FieldToJson(args["pBuildInfo"], pBuildInfo, json_options);
-        FieldToJson(args["pMaxPrimitiveCounts"], pMaxPrimitiveCounts, json_options);
-        FieldToJson(args["pSizeInfo"], pSizeInfo, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("buildType");
+        FieldToJson(jdata, buildType, json_options);
+        jdata.Key("pBuildInfo");
+        FieldToJson(jdata, pBuildInfo, json_options);
+        jdata.Key("pMaxPrimitiveCounts");
+        FieldToJson(jdata, pMaxPrimitiveCounts, json_options);
+        jdata.Key("pSizeInfo");
+        FieldToJson(jdata, pSizeInfo, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdTraceRaysKHR(
@@ -10419,19 +14188,30 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysKHR(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRaygenShaderBindingTable"], pRaygenShaderBindingTable, json_options);
-        FieldToJson(args["pMissShaderBindingTable"], pMissShaderBindingTable, json_options);
-        FieldToJson(args["pHitShaderBindingTable"], pHitShaderBindingTable, json_options);
-        FieldToJson(args["pCallableShaderBindingTable"], pCallableShaderBindingTable, json_options);
-        FieldToJson(args["width"], width, json_options);
-        FieldToJson(args["height"], height, json_options);
-        FieldToJson(args["depth"], depth, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdTraceRaysKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRaygenShaderBindingTable");
+        FieldToJson(jdata, pRaygenShaderBindingTable, json_options);
+        jdata.Key("pMissShaderBindingTable");
+        FieldToJson(jdata, pMissShaderBindingTable, json_options);
+        jdata.Key("pHitShaderBindingTable");
+        FieldToJson(jdata, pHitShaderBindingTable, json_options);
+        jdata.Key("pCallableShaderBindingTable");
+        FieldToJson(jdata, pCallableShaderBindingTable, json_options);
+        jdata.Key("width");
+        FieldToJson(jdata, width, json_options);
+        jdata.Key("height");
+        FieldToJson(jdata, height, json_options);
+        jdata.Key("depth");
+        FieldToJson(jdata, depth, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesKHR(
@@ -10445,18 +14225,28 @@ void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCreateRayTracingPipelinesKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("deferredOperation");
+        HandleToJson(jdata, deferredOperation, json_options);
+        jdata.Key("pipelineCache");
+        HandleToJson(jdata, pipelineCache, json_options);
+        jdata.Key("createInfoCount");
+        FieldToJson(jdata, createInfoCount, json_options);
+        jdata.Key("pCreateInfos");
+        FieldToJson(jdata, pCreateInfos, json_options);
+        jdata.Key("pAllocator");
+        FieldToJson(jdata, pAllocator, json_options);
+        jdata.Key("pPipelines");
+        HandleToJson(jdata, pPipelines, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(
@@ -10469,17 +14259,26 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHa
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["firstGroup"], firstGroup, json_options);
-        FieldToJson(args["groupCount"], groupCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("firstGroup");
+        FieldToJson(jdata, firstGroup, json_options);
+        jdata.Key("groupCount");
+        FieldToJson(jdata, groupCount, json_options);
+        jdata.Key("dataSize");
+        FieldToJson(jdata, dataSize, json_options);
+        jdata.Key("pData");
+        FieldToJson(jdata, pData, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirectKHR(
@@ -10491,17 +14290,26 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirectKHR(
     StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirectKHR");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRaygenShaderBindingTable"], pRaygenShaderBindingTable, json_options);
-        FieldToJson(args["pMissShaderBindingTable"], pMissShaderBindingTable, json_options);
-        FieldToJson(args["pHitShaderBindingTable"], pHitShaderBindingTable, json_options);
-        FieldToJson(args["pCallableShaderBindingTable"], pCallableShaderBindingTable, json_options);
-        FieldToJsonAsHex(args["indirectDeviceAddress"], indirectDeviceAddress, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdTraceRaysIndirectKHR");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pRaygenShaderBindingTable");
+        FieldToJson(jdata, pRaygenShaderBindingTable, json_options);
+        jdata.Key("pMissShaderBindingTable");
+        FieldToJson(jdata, pMissShaderBindingTable, json_options);
+        jdata.Key("pHitShaderBindingTable");
+        FieldToJson(jdata, pHitShaderBindingTable, json_options);
+        jdata.Key("pCallableShaderBindingTable");
+        FieldToJson(jdata, pCallableShaderBindingTable, json_options);
+        jdata.Key("indirectDeviceAddress");
+        FieldToJsonAsHex(jdata, indirectDeviceAddress, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
@@ -10512,15 +14320,22 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
     uint32_t                                    group,
     VkShaderGroupShaderKHR                      groupShader)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupStackSizeKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkGetRayTracingShaderGroupStackSizeKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["group"], group, json_options);
-        FieldToJson(args["groupShader"], groupShader, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameReturn());
+    FieldToJson(jdata, returnValue, json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("device");
+        HandleToJson(jdata, device, json_options);
+        jdata.Key("pipeline");
+        HandleToJson(jdata, pipeline, json_options);
+        jdata.Key("group");
+        FieldToJson(jdata, group, json_options);
+        jdata.Key("groupShader");
+        FieldToJson(jdata, groupShader, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
@@ -10528,13 +14343,18 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    pipelineStackSize)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRayTracingPipelineStackSizeKHR");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdSetRayTracingPipelineStackSizeKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineStackSize"], pipelineStackSize, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("pipelineStackSize");
+        FieldToJson(jdata, pipelineStackSize, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksEXT(
@@ -10544,15 +14364,22 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksEXT(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksEXT");
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMeshTasksEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
-    WriteBlockEnd();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("groupCountX");
+        FieldToJson(jdata, groupCountX, json_options);
+        jdata.Key("groupCountY");
+        FieldToJson(jdata, groupCountY, json_options);
+        jdata.Key("groupCountZ");
+        FieldToJson(jdata, groupCountZ, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectEXT(
@@ -10563,16 +14390,24 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectEXT(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("drawCount");
+        FieldToJson(jdata, drawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 
 void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountEXT(
@@ -10585,18 +14420,28 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountEXT(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-    WriteBlockEnd();
+    util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    jdata.Key(NameCommandIndex());
+    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);
+    jdata.Key(NameArgs());
+    jdata.BeginObject();
+        jdata.Key("commandBuffer");
+        HandleToJson(jdata, commandBuffer, json_options);
+        jdata.Key("buffer");
+        HandleToJson(jdata, buffer, json_options);
+        jdata.Key("offset");
+        FieldToJson(jdata, offset, json_options);
+        jdata.Key("countBuffer");
+        HandleToJson(jdata, countBuffer, json_options);
+        jdata.Key("countBufferOffset");
+        FieldToJson(jdata, countBufferOffset, json_options);
+        jdata.Key("maxDrawCount");
+        FieldToJson(jdata, maxDrawCount, json_options);
+        jdata.Key("stride");
+        FieldToJson(jdata, stride, json_options);
+    jdata.EndObject();
+    WriteStreamBlockEnd();
 }
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
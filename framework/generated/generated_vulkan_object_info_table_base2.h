@@ -273,51 +273,51 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void VisitVideoSessionParametersKHRInfo(std::function<void(const VideoSessionParametersKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionParametersKHR_map_) { visitor(&entry.second); }  }
 
   protected:
-     std::unordered_map<format::HandleId, AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
-     std::unordered_map<format::HandleId, AccelerationStructureNVInfo> accelerationStructureNV_map_;
-     std::unordered_map<format::HandleId, BufferInfo> buffer_map_;
-     std::unordered_map<format::HandleId, BufferViewInfo> bufferView_map_;
-     std::unordered_map<format::HandleId, CommandBufferInfo> commandBuffer_map_;
-     std::unordered_map<format::HandleId, CommandPoolInfo> commandPool_map_;
-     std::unordered_map<format::HandleId, DebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
-     std::unordered_map<format::HandleId, DebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
-     std::unordered_map<format::HandleId, DeferredOperationKHRInfo> deferredOperationKHR_map_;
-     std::unordered_map<format::HandleId, DescriptorPoolInfo> descriptorPool_map_;
-     std::unordered_map<format::HandleId, DescriptorSetInfo> descriptorSet_map_;
-     std::unordered_map<format::HandleId, DescriptorSetLayoutInfo> descriptorSetLayout_map_;
-     std::unordered_map<format::HandleId, DescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
-     std::unordered_map<format::HandleId, DeviceInfo> device_map_;
-     std::unordered_map<format::HandleId, DeviceMemoryInfo> deviceMemory_map_;
-     std::unordered_map<format::HandleId, DisplayKHRInfo> displayKHR_map_;
-     std::unordered_map<format::HandleId, DisplayModeKHRInfo> displayModeKHR_map_;
-     std::unordered_map<format::HandleId, EventInfo> event_map_;
-     std::unordered_map<format::HandleId, FenceInfo> fence_map_;
-     std::unordered_map<format::HandleId, FramebufferInfo> framebuffer_map_;
-     std::unordered_map<format::HandleId, ImageInfo> image_map_;
-     std::unordered_map<format::HandleId, ImageViewInfo> imageView_map_;
-     std::unordered_map<format::HandleId, IndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
-     std::unordered_map<format::HandleId, InstanceInfo> instance_map_;
-     std::unordered_map<format::HandleId, MicromapEXTInfo> micromapEXT_map_;
-     std::unordered_map<format::HandleId, OpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
-     std::unordered_map<format::HandleId, PerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
-     std::unordered_map<format::HandleId, PhysicalDeviceInfo> physicalDevice_map_;
-     std::unordered_map<format::HandleId, PipelineInfo> pipeline_map_;
-     std::unordered_map<format::HandleId, PipelineCacheInfo> pipelineCache_map_;
-     std::unordered_map<format::HandleId, PipelineLayoutInfo> pipelineLayout_map_;
-     std::unordered_map<format::HandleId, PrivateDataSlotInfo> privateDataSlot_map_;
-     std::unordered_map<format::HandleId, QueryPoolInfo> queryPool_map_;
-     std::unordered_map<format::HandleId, QueueInfo> queue_map_;
-     std::unordered_map<format::HandleId, RenderPassInfo> renderPass_map_;
-     std::unordered_map<format::HandleId, SamplerInfo> sampler_map_;
-     std::unordered_map<format::HandleId, SamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
-     std::unordered_map<format::HandleId, SemaphoreInfo> semaphore_map_;
-     std::unordered_map<format::HandleId, ShaderEXTInfo> shaderEXT_map_;
-     std::unordered_map<format::HandleId, ShaderModuleInfo> shaderModule_map_;
-     std::unordered_map<format::HandleId, SurfaceKHRInfo> surfaceKHR_map_;
-     std::unordered_map<format::HandleId, SwapchainKHRInfo> swapchainKHR_map_;
-     std::unordered_map<format::HandleId, ValidationCacheEXTInfo> validationCacheEXT_map_;
-     std::unordered_map<format::HandleId, VideoSessionKHRInfo> videoSessionKHR_map_;
-     std::unordered_map<format::HandleId, VideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
+     VulkanObjectInfoMap<AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
+     VulkanObjectInfoMap<AccelerationStructureNVInfo> accelerationStructureNV_map_;
+     VulkanObjectInfoMap<BufferInfo> buffer_map_;
+     VulkanObjectInfoMap<BufferViewInfo> bufferView_map_;
+     VulkanObjectInfoMap<CommandBufferInfo> commandBuffer_map_;
+     VulkanObjectInfoMap<CommandPoolInfo> commandPool_map_;
+     VulkanObjectInfoMap<DebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
+     VulkanObjectInfoMap<DebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
+     VulkanObjectInfoMap<DeferredOperationKHRInfo> deferredOperationKHR_map_;
+     VulkanObjectInfoMap<DescriptorPoolInfo> descriptorPool_map_;
+     VulkanObjectInfoMap<DescriptorSetInfo> descriptorSet_map_;
+     VulkanObjectInfoMap<DescriptorSetLayoutInfo> descriptorSetLayout_map_;
+     VulkanObjectInfoMap<DescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
+     VulkanObjectInfoMap<DeviceInfo> device_map_;
+     VulkanObjectInfoMap<DeviceMemoryInfo> deviceMemory_map_;
+     VulkanObjectInfoMap<DisplayKHRInfo> displayKHR_map_;
+     VulkanObjectInfoMap<DisplayModeKHRInfo> displayModeKHR_map_;
+     VulkanObjectInfoMap<EventInfo> event_map_;
+     VulkanObjectInfoMap<FenceInfo> fence_map_;
+     VulkanObjectInfoMap<FramebufferInfo> framebuffer_map_;
+     VulkanObjectInfoMap<ImageInfo> image_map_;
+     VulkanObjectInfoMap<ImageViewInfo> imageView_map_;
+     VulkanObjectInfoMap<IndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
+     VulkanObjectInfoMap<InstanceInfo> instance_map_;
+     VulkanObjectInfoMap<MicromapEXTInfo> micromapEXT_map_;
+     VulkanObjectInfoMap<OpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
+     VulkanObjectInfoMap<PerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
+     VulkanObjectInfoMap<PhysicalDeviceInfo> physicalDevice_map_;
+     VulkanObjectInfoMap<PipelineInfo> pipeline_map_;
+     VulkanObjectInfoMap<PipelineCacheInfo> pipelineCache_map_;
+     VulkanObjectInfoMap<PipelineLayoutInfo> pipelineLayout_map_;
+     VulkanObjectInfoMap<PrivateDataSlotInfo> privateDataSlot_map_;
+     VulkanObjectInfoMap<QueryPoolInfo> queryPool_map_;
+     VulkanObjectInfoMap<QueueInfo> queue_map_;
+     VulkanObjectInfoMap<RenderPassInfo> renderPass_map_;
+     VulkanObjectInfoMap<SamplerInfo> sampler_map_;
+     VulkanObjectInfoMap<SamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
+     VulkanObjectInfoMap<SemaphoreInfo> semaphore_map_;
+     VulkanObjectInfoMap<ShaderEXTInfo> shaderEXT_map_;
+     VulkanObjectInfoMap<ShaderModuleInfo> shaderModule_map_;
+     VulkanObjectInfoMap<SurfaceKHRInfo> surfaceKHR_map_;
+     VulkanObjectInfoMap<SwapchainKHRInfo> swapchainKHR_map_;
+     VulkanObjectInfoMap<ValidationCacheEXTInfo> validationCacheEXT_map_;
+     VulkanObjectInfoMap<VideoSessionKHRInfo> videoSessionKHR_map_;
+     VulkanObjectInfoMap<VideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -61,6 +61,12 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
     SKIP_ENUM = [
     ]
 
+    # The type each function is generated for and how it stores a string in it.
+    JSON_TARGETS = [
+        ('nlohmann::ordered_json', 'jdata = {0}'),
+        ('util::JsonStreamWriter', 'jdata.String({0})'),
+    ]
+
     def __init__(
         self, err_file=sys.stderr, warn_file=sys.stderr, diag_file=sys.stdout
     ):
@@ -173,58 +179,62 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
                 self.processedEnums.add(enum)
                 bitwidth = 'VkFlags'
 
-                if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
-                    body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {0}& value, const JsonOptions& options)\n'
-                else:
-                    body = 'void FieldToJson(nlohmann::ordered_json& jdata, const {0}& value, const JsonOptions& options)\n'
+                # The tree version assigns the name to its node and the stream version writes it as a string.
+                for json_type, assign in self.JSON_TARGETS:
+                    if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
+                        body = 'void FieldToJson({0}_t, ' + json_type + '& jdata, const {0}& value, const JsonOptions& options)\n'
+                    else:
+                        body = 'void FieldToJson(' + json_type + '& jdata, const {0}& value, const JsonOptions& options)\n'
+                    body += '{{\n'
+                    if len(self.enumEnumerants[enum]):
+                        body += '    switch (value) {{\n'
+                        for enumerant in self.enumEnumerants[enum]:
+                            body += textwrap.indent(prefix='        ', text=textwrap.dedent('''\
+                            case {0}:
+                                {1};
+                                break;
+                            '''.format(enumerant, assign.format('"' + enumerant + '"'))))
+                        body += '        default:\n'
+                        body += '            ' + assign.format('to_hex_fixed_width(value)') + ';\n'
+                        body += '            break;\n'
+                        body += '    }}\n'
+                    else:
+                        body += '    ' + assign.format('to_hex_fixed_width(value)') + ';\n'
+
+                    body += '}}\n'
+                    body = body.format(enum, bitwidth)
+                    write(body, file=self.outFile)
+
+        for enum in sorted(self.flagsType):
+            bittype = None
+            if enum in self.flagEnumBitsType:
+                bittype = self.flagEnumBitsType[enum]
+            for json_type, assign in self.JSON_TARGETS:
+                body = 'void FieldToJson({0}_t, ' + json_type + '& jdata, const {1} flags, const JsonOptions& options)\n'
                 body += '{{\n'
-                if len(self.enumEnumerants[enum]):
-                    body += '    switch (value) {{\n'
-                    for enumerant in self.enumEnumerants[enum]:
-                        body += textwrap.indent(prefix='        ', text=textwrap.dedent('''\
+                if bittype is not None and bittype in self.enum_names and len(self.enumEnumerants[bittype]):
+                    body += "    if (!options.expand_flags)\n"
+                    body += "    {{\n"
+                    body += "        " + assign.format('to_hex_fixed_width(flags)') + ";\n"
+                    body += "        return;\n"
+                    body += "    }}\n"
+                    expand = "ExpandFlags(flags, []({1} flags)\n"
+                    expand += "    {{\n"
+                    expand += '        switch (flags)\n'
+                    expand += '        {{\n'
+                    for enumerant in self.enumEnumerants[bittype]:
+                        expand += textwrap.indent(prefix='            ', text=textwrap.dedent('''\
                         case {0}:
-                            jdata = "{0}";
-                            break;
+                            return std::string("{0}");
                         '''.format(enumerant)))
-                    body += '        default:\n'
-                    body += '            jdata = to_hex_fixed_width(value);\n'
-                    body += '            break;\n'
-                    body += '    }}\n'
+                    expand += '        }}\n'
+                    expand += '        return to_hex_fixed_width(flags);\n'
+                    expand += '    }})'
+                    body += '    ' + assign.format(expand) + ';\n'
                 else:
-                    body += '    jdata = to_hex_fixed_width(value);\n'
+                    body += '    ' + assign.format('to_hex_fixed_width(flags)') + ';\n'
 
                 body += '}}\n'
-                body = body.format(enum, bitwidth)
-                write(body, file=self.outFile)
-
-        for enum in sorted(self.flagsType):
-            bittype = None
-            if enum in self.flagEnumBitsType:
-                bittype = self.flagEnumBitsType[enum]
-            body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {1} flags, const JsonOptions& options)\n'
-            body += '{{\n'
-            if bittype is not None and bittype in self.enum_names and len(self.enumEnumerants[bittype]):
-                body += "    if (!options.expand_flags)\n"
-                body += "    {{\n"
-                body += "        jdata = to_hex_fixed_width(flags);\n"
-                body += "        return;\n"
-                body += "    }}\n"
-                body += "    jdata = ExpandFlags(flags, []({1} flags)\n"
-                body += "    {{\n"
-                body += '        switch (flags)\n'
-                body += '        {{\n'
-                for enumerant in self.enumEnumerants[bittype]:
-                    body += textwrap.indent(prefix='            ', text=textwrap.dedent('''\
-                    case {0}:
-                        return std::string("{0}");
-                    '''.format(enumerant)))
-                body += '        }}\n'
-                body += '        return to_hex_fixed_width(flags);\n'
-                body += '    }});\n'
-            else:
-                body += '    jdata = to_hex_fixed_width(flags);\n'
-
-            body += '}}\n'
-            write(body.format(enum, self.flags_types[enum]), file=self.outFile)
+                write(body.format(enum, self.flags_types[enum]), file=self.outFile)
 
     # yapf: enable
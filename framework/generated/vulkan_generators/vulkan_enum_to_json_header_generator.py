@@ -163,12 +163,14 @@ class VulkanEnumToJsonHeaderGenerator(BaseGenerator):
             if not enum in self.processedEnums and not enum in self.SKIP_ENUM:
                 self.processedEnums.add(enum)
                 if not enum in self.enumAliases:
-                    if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
-                        body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
-                    else:
-                        body = 'void FieldToJson(nlohmann::ordered_json& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
-                    write(body.format(enum), file=self.outFile)
+                    for json_type in ['nlohmann::ordered_json', 'util::JsonStreamWriter']:
+                        if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
+                            body = 'void FieldToJson({0}_t, {1}& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
+                        else:
+                            body = 'void FieldToJson({1}& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
+                        write(body.format(enum, json_type), file=self.outFile)
 
         for flag in sorted(self.flagsType):
-            body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {1} flags, const util::JsonOptions& options = util::JsonOptions());'
-            write(body.format(flag, self.flagsType[flag]), file=self.outFile)
+            for json_type in ['nlohmann::ordered_json', 'util::JsonStreamWriter']:
+                body = 'void FieldToJson({0}_t, {2}& jdata, const {1} flags, const util::JsonOptions& options = util::JsonOptions());'
+                write(body.format(flag, self.flagsType[flag], json_type), file=self.outFile)
@@ -159,7 +159,7 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
                 ) + '\n'
                 cmddef += format_cpp_code('''
                     {{
-                        nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "{0}");
+                        util::JsonStreamWriter& jdata = WriteStreamApiCallStart(call_info, "{0}");
                         const JsonOptions& json_options = GetJsonOptions();
                     '''.format(cmd)
                 )
@@ -168,7 +168,7 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
                     return_type, cmd, values
                 )
                 cmddef += format_cpp_code('''
-                        WriteBlockEnd();
+                        WriteStreamBlockEnd();
                     }
                 ''', 1)
                 write(cmddef, file=self.outFile)
@@ -181,28 +181,36 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
 
     # yapf: disable
     def make_consumer_func_body(self, return_type, name, values):
-        """Return VulkanExportJsonConsumer class member function definition."""
+        """Return VulkanExportJsonConsumer class member function definition.
+        Each value is written to the block's JsonStreamWriter straight after its key."""
         body = ''
 
         if name in self.queueSubmit:
-            body += '    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);\n'
+            body += '    jdata.Key(NameSubmitIndex());\n'
+            body += '    FieldToJson(jdata, ++submit_index_, json_options);\n'
         elif self.is_command_buffer_cmd(name):
-            body += '    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);\n'
+            body += '    jdata.Key(NameCommandIndex());\n'
+            body += '    FieldToJson(jdata, GetCommandBufferRecordIndex(commandBuffer), json_options);\n'
 
         # Handle function return value
         if return_type in self.formatAsHex:
-            body += '    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);\n'
+            body += '    jdata.Key(NameReturn());\n'
+            body += '    FieldToJsonAsHex(jdata, returnValue, json_options);\n'
         elif 'VkBool32' == return_type:
             # Output as JSON boolean type true/false without quotes:
-            body += '            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);\n'
+            body += '    jdata.Key(NameReturn());\n'
+            body += '    Bool32ToJson(jdata, returnValue, json_options);\n'
         elif self.is_handle(return_type):
-            body += '    HandleToJson(jdata[NameReturn()], returnValue, json_options);\n'
+            body += '    jdata.Key(NameReturn());\n'
+            body += '    HandleToJson(jdata, returnValue, json_options);\n'
         # Enums, ints, etc. handled by default and static dispatch based on C++ type:
         elif not 'void' in return_type:
-            body += '    FieldToJson(jdata[NameReturn()], returnValue, json_options);\n'
+            body += '    jdata.Key(NameReturn());\n'
+            body += '    FieldToJson(jdata, returnValue, json_options);\n'
 
         if len(values) > 0:
-            body += '    auto& args = jdata[NameArgs()];\n'
+            body += '    jdata.Key(NameArgs());\n'
+            body += '    jdata.BeginObject();\n'
             # Handle function arguments
             for value in values:
                 flagsEnumType = value.base_type
@@ -210,26 +218,28 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
                 # Default to letting the right function overload to be resolved based on argument types,
                 # including enums, strings ints, floats etc.:
                 # Note there are overloads for scalars and pointers/arrays.
-                to_json = 'FieldToJson(args["{0}"], {0}, json_options)'
+                to_json = 'FieldToJson(jdata, {0}, json_options)'
 
                 # Special cases:
                 if 'VkBool32' == value.base_type:
-                    to_json = 'Bool32ToJson(args["{0}"], {0}, json_options)'
+                    to_json = 'Bool32ToJson(jdata, {0}, json_options)'
                 elif value.name == 'ppData' or (value.base_type in self.formatAsHex):
-                    to_json = 'FieldToJsonAsHex(args["{0}"], {0}, json_options)'
+                    to_json = 'FieldToJsonAsHex(jdata, {0}, json_options)'
                 elif self.is_handle(value.base_type) or value.name in self.formatAsHandle:
-                    to_json = 'HandleToJson(args["{0}"], {0}, json_options)'
+                    to_json = 'HandleToJson(jdata, {0}, json_options)'
                 elif self.is_flags(value.base_type):
                     if value.base_type in self.flagsTypeAlias:
                             flagsEnumType = self.flagsTypeAlias[value.base_type]
                     if not (value.is_pointer or value.is_array):
-                        to_json = 'FieldToJson({2}_t(), args["{0}"], {0}, json_options)'
+                        to_json = 'FieldToJson({2}_t(), jdata, {0}, json_options)'
                     else:
                         # Default to outputting as the raw type but warn:
                         print("Missing conversion of pointers to", flagsEnumType, "in", name,  file=sys.stderr)
 
                 to_json = to_json.format(value.name, value.base_type, flagsEnumType)
+                body += '        jdata.Key("{0}");\n'.format(value.name)
                 body += '        {0};\n'.format(to_json)
+            body += '    jdata.EndObject();\n'
         return body
     # yapf: enable
 
@@ -136,6 +136,25 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
                 }
             }
 
+            void FieldToJson(util::JsonStreamWriter& jdata, const PNextNode* data, const JsonOptions& options)
+            {
+                if (data && data->GetPointer())
+                {
+                    const auto s_type = reinterpret_cast<const VkBaseInStructure*>(data->GetPointer())->sType;
+                    switch (s_type)
+                    {'''
+        body += self.make_pnext_body(stream=True)
+        body += '''
+                        default:
+                        {
+                            GFXRECON_LOG_WARNING("Unknown pnext node type: %u.", (unsigned) s_type);
+                        }
+                    }
+                }
+
+                jdata.Null();
+            }
+
             GFXRECON_END_NAMESPACE(decode)
             GFXRECON_END_NAMESPACE(gfxrecon)
         '''
@@ -176,12 +195,36 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
                     ''')
                 body = remove_trailing_newlines(indent_cpp_code(body))
                 write(body, file=self.outFile)
+
+                # The same text written straight to a JsonStreamWriter without building a tree.
+                body = '''
+                    void FieldToJson(util::JsonStreamWriter& jdata, const Decoded_{0}* data, const JsonOptions& options)
+                    {{
+                        if (data && data->decoded_value)
+                        {{
+                            const {0}& decoded_value = *data->decoded_value;
+                            const Decoded_{0}& meta_struct = *data;
+
+                            jdata.BeginObject();
+                    '''.format(struct)
+                body += self.makeStructBody(struct, self.feature_struct_members[struct], stream=True)
+                body += remove_leading_empty_lines('''
+                            jdata.EndObject();
+                        }
+                        else
+                        {
+                            jdata.Null();
+                        }
+                    }
+                    ''')
+                body = remove_trailing_newlines(indent_cpp_code(body))
+                write(body, file=self.outFile)
     # yapf: enable
 
     #
     # Command definition
     # yapf: disable
-    def makeStructBody(self, name, values):
+    def makeStructBody(self, name, values, stream=False):
         body = ''
         has_pnext = False
         for value in values:
@@ -241,14 +284,29 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
                         to_json = 'jdata["{0}"] = static_cast<bool>(decoded_value.{0})'
 
             to_json = to_json.format(value.name, value.base_type, flagsEnumType)
+            if stream:
+                body += '        jdata.Key("{0}");\n'.format(value.name)
+                to_json = self.make_stream_to_json(value.name, to_json)
             body += '        {0};\n'.format(to_json)
         # Save pnext as last member
         if has_pnext:
-            body += '        FieldToJson(jdata["pNext"], meta_struct.pNext, options);\n'
+            if stream:
+                body += '        jdata.Key("pNext");\n'
+                body += '        FieldToJson(jdata, meta_struct.pNext, options);\n'
+            else:
+                body += '        FieldToJson(jdata["pNext"], meta_struct.pNext, options);\n'
 
         return body
     # yapf: enable
 
+    def make_stream_to_json(self, value_name, to_json):
+        """Turn the tree conversion of a member into one writing its value to a JsonStreamWriter"""
+        node = 'jdata["{0}"]'.format(value_name)
+        assignment = node + ' = '
+        if to_json.startswith(assignment):
+            return 'jdata.Bool({0})'.format(to_json[len(assignment):])
+        return to_json.replace(node, 'jdata')
+
     def genStruct(self, typeinfo, typename, alias):
         super().genStruct(typeinfo, typename, alias)
 
@@ -271,7 +329,9 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
             else:
                 self.flagsTypeAlias[name] = alias
 
-    def make_pnext_body(self):
+    def make_pnext_body(self, stream=False):
+        # The stream version returns from each case so that only unknown types fall through to its null.
+        end_case = 'return' if stream else 'break'
         body = ''
         for struct in self.pnext_extension_structs:
             body += '''
@@ -279,7 +339,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
             {{
                const auto* pnext = reinterpret_cast<const Decoded_{0}*>(data->GetMetaStructPointer());
                FieldToJson(jdata, pnext, options);
-               break;
+               {2};
             }}
-            '''.format(struct, self.pnext_extension_structs[struct])
+            '''.format(struct, self.pnext_extension_structs[struct], end_case)
         return body
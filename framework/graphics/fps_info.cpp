@@ -29,7 +29,9 @@
 #include "util/json_util.h"
 
 #include "nlohmann/json.hpp"
+#include <algorithm>
 #include <cinttypes>
+#include <cmath>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -57,17 +59,54 @@ WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame,
                            end_frame);
 }
 
+struct FrameTimeStatistics
+{
+    double min{ 0.0 };
+    double average{ 0.0 };
+    double p99{ 0.0 };
+};
+
+// Returns the minimum, average, and 99th percentile frame times in seconds.
+static FrameTimeStatistics GetFrameTimeStatistics(const std::vector<int64_t>& frame_durations)
+{
+    FrameTimeStatistics statistics;
+
+    if (!frame_durations.empty())
+    {
+        std::vector<int64_t> sorted_durations(frame_durations);
+        std::sort(sorted_durations.begin(), sorted_durations.end());
+
+        int64_t total_duration = 0;
+        for (int64_t duration : sorted_durations)
+        {
+            total_duration += duration;
+        }
+
+        size_t p99_index = static_cast<size_t>(std::ceil(sorted_durations.size() * 0.99)) - 1;
+
+        statistics.min     = util::datetime::ConvertTimestampToSeconds(sorted_durations.front());
+        statistics.average = util::datetime::ConvertTimestampToSeconds(total_duration) / sorted_durations.size();
+        statistics.p99     = util::datetime::ConvertTimestampToSeconds(sorted_durations[p99_index]);
+    }
+
+    return statistics;
+}
+
 FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  uint64_t               measurement_end_frame,
                  bool                   has_measurement_range,
                  bool                   quit_after_range,
                  bool                   flush_measurement_range,
                  bool                   flush_inside_measurement_range,
-                 const std::string_view measurement_file_name) :
+                 const std::string_view measurement_file_name,
+                 bool                   preload_measurement_range,
+                 uint32_t               measurement_loop_count) :
     measurement_start_frame_(measurement_start_frame),
     measurement_end_frame_(measurement_end_frame), measurement_start_time_(0), measurement_end_time_(0),
     quit_after_range_(quit_after_range), flush_measurement_range_(flush_measurement_range),
-    flush_inside_measurement_range_(flush_inside_measurement_range), has_measurement_range_(has_measurement_range),
+    flush_inside_measurement_range_(flush_inside_measurement_range),
+    preload_measurement_range_(preload_measurement_range), measurement_loop_count_(measurement_loop_count),
+    completed_measurement_loops_(0), has_measurement_range_(has_measurement_range),
     started_measurement_(false), ended_measurement_(false), frame_start_time_(0), frame_durations_(),
     measurement_file_name_(measurement_file_name)
 {
@@ -94,6 +133,14 @@ bool FpsInfo::ShouldQuit(uint64_t frame)
     return quit_after_range_ && (frame > measurement_end_frame_);
 }
 
+bool FpsInfo::ShouldPreloadFrames(uint64_t frame) const
+{
+    // Looping the measurement range requires it to be preloaded. When the range is looped, the frame numbers repeat,
+    // so the range is only preloaded before the first measured frame.
+    return (preload_measurement_range_ || (measurement_loop_count_ > 1)) && has_measurement_range_ &&
+           !started_measurement_ && (frame == measurement_start_frame_);
+}
+
 void FpsInfo::BeginFrame(uint64_t frame)
 {
     if (!started_measurement_)
@@ -116,7 +163,7 @@ void FpsInfo::EndFrame(uint64_t frame)
         frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, util::datetime::GetTimestamp()));
 
         // Measurement frame range end is non-inclusive, as opposed to trim frame range
-        if (frame >= measurement_end_frame_ - 1)
+        if ((frame >= measurement_end_frame_ - 1) && (++completed_measurement_loops_ >= measurement_loop_count_))
         {
             measurement_end_time_ = util::datetime::GetTimestamp();
             ended_measurement_    = true;
@@ -127,17 +174,23 @@ void FpsInfo::EndFrame(uint64_t frame)
                 double   start_time   = util::datetime::ConvertTimestampToSeconds(measurement_start_time_);
                 double   end_time     = util::datetime::ConvertTimestampToSeconds(measurement_end_time_);
                 double   diff_time    = GetElapsedSeconds(measurement_start_time_, measurement_end_time_);
-                uint64_t total_frames = measurement_end_frame_ - measurement_start_frame_;
+                uint64_t total_frames = (measurement_end_frame_ - measurement_start_frame_) * measurement_loop_count_;
                 double   fps          = static_cast<double>(total_frames) / diff_time;
 
+                const FrameTimeStatistics frame_times = GetFrameTimeStatistics(frame_durations_);
+
                 nlohmann::json file_content = { { "frame_range",
                                                   { { "start_frame", measurement_start_frame_ },
                                                     { "end_frame", measurement_end_frame_ },
                                                     { "frame_count", total_frames },
+                                                    { "loop_count", measurement_loop_count_ },
                                                     { "start_time_monotonic", start_time },
                                                     { "end_time_monotonic", end_time },
                                                     { "duration", diff_time },
                                                     { "fps", fps },
+                                                    { "frame_time_min", frame_times.min },
+                                                    { "frame_time_average", frame_times.average },
+                                                    { "frame_time_p99", frame_times.p99 },
                                                     { "frame_durations", frame_durations_ } } } };
 
                 FILE*   file_pointer = nullptr;
@@ -188,8 +241,9 @@ void FpsInfo::EndFile(uint64_t frame)
 {
     if (!ended_measurement_)
     {
-        measurement_end_time_  = gfxrecon::util::datetime::GetTimestamp();
-        measurement_end_frame_ = frame;
+        measurement_end_time_   = gfxrecon::util::datetime::GetTimestamp();
+        measurement_end_frame_  = frame;
+        measurement_loop_count_ = std::max(completed_measurement_loops_, 1u);
     }
 }
 
@@ -223,15 +277,27 @@ void FpsInfo::LogToConsole()
         // There was a measurement range, emit only statistics about the
         // measurement range
         double   diff_time_sec = GetElapsedSeconds(measurement_start_time_, measurement_end_time_);
-        uint64_t total_frames  = measurement_end_frame_ - measurement_start_frame_;
+        uint64_t total_frames  = (measurement_end_frame_ - measurement_start_frame_) * measurement_loop_count_;
         double   fps           = static_cast<double>(total_frames) / diff_time_sec;
-        GFXRECON_WRITE_CONSOLE("Measurement range FPS: %f fps, %f seconds, %lu frame%s, 1 loop, framerange [%lu-%lu)",
-                               fps,
-                               diff_time_sec,
-                               total_frames,
-                               total_frames > 1 ? "s" : "",
-                               measurement_start_frame_,
-                               measurement_end_frame_);
+        GFXRECON_WRITE_CONSOLE(
+            "Measurement range FPS: %f fps, %f seconds, %lu frame%s, %u loop%s, framerange [%lu-%lu)",
+            fps,
+            diff_time_sec,
+            total_frames,
+            total_frames > 1 ? "s" : "",
+            measurement_loop_count_,
+            measurement_loop_count_ > 1 ? "s" : "",
+            measurement_start_frame_,
+            measurement_end_frame_);
+
+        if (!frame_durations_.empty())
+        {
+            const FrameTimeStatistics frame_times = GetFrameTimeStatistics(frame_durations_);
+            GFXRECON_WRITE_CONSOLE("Measurement range frame times: min %f ms, average %f ms, p99 %f ms",
+                                   frame_times.min * 1000.0,
+                                   frame_times.average * 1000.0,
+                                   frame_times.p99 * 1000.0);
+        }
     }
 }
 
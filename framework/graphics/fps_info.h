@@ -42,7 +42,9 @@ class FpsInfo
             bool                   quit_after_range               = false,
             bool                   flush_measurement_range        = false,
             bool                   flush_inside_measurement_range = false,
-            const std::string_view measurement_file_name          = "");
+            const std::string_view measurement_file_name          = "",
+            bool                   preload_measurement_range      = false,
+            uint32_t               measurement_loop_count         = 1);
 
     void LogToConsole();
 
@@ -50,6 +52,9 @@ class FpsInfo
     bool ShouldWaitIdleBeforeFrame(uint64_t file_processor_frame);
     bool ShouldWaitIdleAfterFrame(uint64_t file_processor_frame);
     bool ShouldQuit(uint64_t file_processor_frame);
+    bool ShouldPreloadFrames(uint64_t file_processor_frame) const;
+    uint64_t GetMeasurementFrameCount() const { return measurement_end_frame_ - measurement_start_frame_; }
+    uint32_t GetMeasurementLoopCount() const { return measurement_loop_count_; }
     void BeginFrame(uint64_t file_processor_frame);
     void EndFrame(uint64_t file_processor_frame);
     void EndFile(uint64_t end_file_processor_frame);
@@ -71,6 +76,10 @@ class FpsInfo
     bool quit_after_range_;
     bool flush_measurement_range_;
     bool flush_inside_measurement_range_;
+    bool preload_measurement_range_;
+
+    uint32_t measurement_loop_count_;
+    uint32_t completed_measurement_loops_;
 
     bool started_measurement_;
     bool ended_measurement_;
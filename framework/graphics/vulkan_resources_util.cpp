@@ -23,8 +23,11 @@
 #include "vulkan_resources_util.h"
 #include "Vulkan-Utility-Libraries/vk_format_utils.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <limits>
 #include <math.h>
+#include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -427,13 +430,18 @@ uint64_t VulkanResourcesUtil::GetImageResourceSizesLinear(VkImage
 
 VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 {
-    assert(size);
+    return CreateStagingBuffer(size, &staging_buffer_);
+}
+
+VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size, StagingBufferContext* staging_buffer)
+{
+    assert(size && (staging_buffer != nullptr));
 
-    if (staging_buffer_.buffer != VK_NULL_HANDLE)
+    if (staging_buffer->buffer != VK_NULL_HANDLE)
     {
-        if (staging_buffer_.size < size)
+        if (staging_buffer->size < size)
         {
-            DestroyStagingBuffer();
+            DestroyStagingBuffer(staging_buffer);
         }
         else
         {
@@ -441,7 +449,7 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
         }
     }
 
-    assert(staging_buffer_.buffer == VK_NULL_HANDLE && staging_buffer_.size == 0);
+    assert(staging_buffer->buffer == VK_NULL_HANDLE && staging_buffer->size == 0);
 
     VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
     create_info.pNext                 = nullptr;
@@ -452,19 +460,19 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
     create_info.queueFamilyIndexCount = 0;
     create_info.pQueueFamilyIndices   = nullptr;
 
-    VkResult result = device_table_.CreateBuffer(device_, &create_info, nullptr, &staging_buffer_.buffer);
+    VkResult result = device_table_.CreateBuffer(device_, &create_info, nullptr, &staging_buffer->buffer);
     if (result == VK_SUCCESS)
     {
         uint32_t             memory_type_index = std::numeric_limits<uint32_t>::max();
         VkMemoryRequirements memory_requirements;
 
-        device_table_.GetBufferMemoryRequirements(device_, staging_buffer_.buffer, &memory_requirements);
+        device_table_.GetBufferMemoryRequirements(device_, staging_buffer->buffer, &memory_requirements);
 
         bool found = FindMemoryTypeIndex(memory_properties_,
                                          memory_requirements.memoryTypeBits,
                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
                                          &memory_type_index,
-                                         &staging_buffer_.memory_property_flags);
+                                         &staging_buffer->memory_property_flags);
         if (!found)
         {
             // If we are here it is likely that we lack support for HOST_CACHED, fallback to COHERENT
@@ -472,7 +480,7 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
                                         memory_requirements.memoryTypeBits,
                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                                         &memory_type_index,
-                                        &staging_buffer_.memory_property_flags);
+                                        &staging_buffer->memory_property_flags);
         }
 
         if (found)
@@ -482,17 +490,17 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
             alloc_info.allocationSize       = memory_requirements.size;
             alloc_info.memoryTypeIndex      = memory_type_index;
 
-            result = device_table_.AllocateMemory(device_, &alloc_info, nullptr, &staging_buffer_.memory);
+            result = device_table_.AllocateMemory(device_, &alloc_info, nullptr, &staging_buffer->memory);
             if (result == VK_SUCCESS)
             {
-                device_table_.BindBufferMemory(device_, staging_buffer_.buffer, staging_buffer_.memory, 0);
+                device_table_.BindBufferMemory(device_, staging_buffer->buffer, staging_buffer->memory, 0);
             }
             else
             {
                 GFXRECON_LOG_ERROR("Failed to allocate staging buffer memory for resource memory snapshot");
 
-                device_table_.DestroyBuffer(device_, staging_buffer_.buffer, nullptr);
-                staging_buffer_.buffer = VK_NULL_HANDLE;
+                device_table_.DestroyBuffer(device_, staging_buffer->buffer, nullptr);
+                staging_buffer->buffer = VK_NULL_HANDLE;
             }
         }
         else
@@ -505,8 +513,8 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 
         if (result == VK_SUCCESS)
         {
-            staging_buffer_.size       = size;
-            staging_buffer_.mapped_ptr = nullptr;
+            staging_buffer->size       = size;
+            staging_buffer->mapped_ptr = nullptr;
         }
     }
     else
@@ -519,16 +527,22 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 
 VkResult VulkanResourcesUtil::MapStagingBuffer()
 {
-    assert(staging_buffer_.buffer != VK_NULL_HANDLE);
-    assert(staging_buffer_.memory != VK_NULL_HANDLE);
-    assert(staging_buffer_.size);
+    return MapStagingBuffer(&staging_buffer_);
+}
+
+VkResult VulkanResourcesUtil::MapStagingBuffer(StagingBufferContext* staging_buffer)
+{
+    assert(staging_buffer != nullptr);
+    assert(staging_buffer->buffer != VK_NULL_HANDLE);
+    assert(staging_buffer->memory != VK_NULL_HANDLE);
+    assert(staging_buffer->size);
 
     VkResult result = VK_SUCCESS;
 
-    if (staging_buffer_.mapped_ptr == nullptr)
+    if (staging_buffer->mapped_ptr == nullptr)
     {
         result =
-            device_table_.MapMemory(device_, staging_buffer_.memory, 0, VK_WHOLE_SIZE, 0, &staging_buffer_.mapped_ptr);
+            device_table_.MapMemory(device_, staging_buffer->memory, 0, VK_WHOLE_SIZE, 0, &staging_buffer->mapped_ptr);
 
         if (result != VK_SUCCESS)
         {
@@ -541,29 +555,41 @@ VkResult VulkanResourcesUtil::MapStagingBuffer()
 
 void VulkanResourcesUtil::UnmapStagingBuffer()
 {
-    if (staging_buffer_.mapped_ptr != nullptr)
+    UnmapStagingBuffer(&staging_buffer_);
+}
+
+void VulkanResourcesUtil::UnmapStagingBuffer(StagingBufferContext* staging_buffer)
+{
+    assert(staging_buffer != nullptr);
+
+    if (staging_buffer->mapped_ptr != nullptr)
     {
-        assert(staging_buffer_.buffer != VK_NULL_HANDLE);
-        assert(staging_buffer_.memory != VK_NULL_HANDLE);
-        assert(staging_buffer_.size);
+        assert(staging_buffer->buffer != VK_NULL_HANDLE);
+        assert(staging_buffer->memory != VK_NULL_HANDLE);
+        assert(staging_buffer->size);
 
-        device_table_.UnmapMemory(device_, staging_buffer_.memory);
-        staging_buffer_.mapped_ptr = nullptr;
+        device_table_.UnmapMemory(device_, staging_buffer->memory);
+        staging_buffer->mapped_ptr = nullptr;
     }
 }
 
 void VulkanResourcesUtil::InvalidateStagingBuffer()
 {
-    assert(staging_buffer_.buffer != VK_NULL_HANDLE);
-    assert(staging_buffer_.memory != VK_NULL_HANDLE);
-    assert(staging_buffer_.size);
+    InvalidateStagingBuffer(staging_buffer_);
+}
 
-    if (!IsMemoryCoherent(staging_buffer_.memory_property_flags))
+void VulkanResourcesUtil::InvalidateStagingBuffer(const StagingBufferContext& staging_buffer)
+{
+    assert(staging_buffer.buffer != VK_NULL_HANDLE);
+    assert(staging_buffer.memory != VK_NULL_HANDLE);
+    assert(staging_buffer.size);
+
+    if (!IsMemoryCoherent(staging_buffer.memory_property_flags))
     {
-        assert(staging_buffer_.mapped_ptr != nullptr);
+        assert(staging_buffer.mapped_ptr != nullptr);
 
         const VkMappedMemoryRange range{
-            VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, staging_buffer_.memory, 0, staging_buffer_.size
+            VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, staging_buffer.memory, 0, staging_buffer.size
         };
 
         device_table_.InvalidateMappedMemoryRanges(device_, 1, &range);
@@ -572,22 +598,29 @@ void VulkanResourcesUtil::InvalidateStagingBuffer()
 
 void VulkanResourcesUtil::DestroyStagingBuffer()
 {
-    UnmapStagingBuffer();
+    DestroyStagingBuffer(&staging_buffer_);
+}
+
+void VulkanResourcesUtil::DestroyStagingBuffer(StagingBufferContext* staging_buffer)
+{
+    assert(staging_buffer != nullptr);
+
+    UnmapStagingBuffer(staging_buffer);
 
-    if (staging_buffer_.buffer != VK_NULL_HANDLE)
+    if (staging_buffer->buffer != VK_NULL_HANDLE)
     {
-        device_table_.DestroyBuffer(device_, staging_buffer_.buffer, nullptr);
-        staging_buffer_.buffer = VK_NULL_HANDLE;
+        device_table_.DestroyBuffer(device_, staging_buffer->buffer, nullptr);
+        staging_buffer->buffer = VK_NULL_HANDLE;
     }
 
-    if (staging_buffer_.memory != VK_NULL_HANDLE)
+    if (staging_buffer->memory != VK_NULL_HANDLE)
     {
-        device_table_.FreeMemory(device_, staging_buffer_.memory, nullptr);
-        staging_buffer_.memory = VK_NULL_HANDLE;
+        device_table_.FreeMemory(device_, staging_buffer->memory, nullptr);
+        staging_buffer->memory = VK_NULL_HANDLE;
     }
 
-    staging_buffer_.memory_property_flags = VkMemoryPropertyFlags(0);
-    staging_buffer_.size                  = 0;
+    staging_buffer->memory_property_flags = VkMemoryPropertyFlags(0);
+    staging_buffer->size                  = 0;
 }
 
 void VulkanResourcesUtil::InvalidateMappedMemoryRange(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size)
@@ -739,13 +772,14 @@ void VulkanResourcesUtil::DestroyCommandBuffer()
     }
 }
 
-void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkImage            image,
+void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkCommandBuffer    command_buffer,
+                                                           VkImage            image,
                                                            VkImageLayout      current_layout,
                                                            VkImageLayout      destination_layout,
                                                            VkImageAspectFlags aspect)
 {
     assert(image != VK_NULL_HANDLE);
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     VkImageMemoryBarrier memory_barrier;
     memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -763,7 +797,7 @@ void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkImage            im
     memory_barrier.subresourceRange.baseArrayLayer = 0;
     memory_barrier.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
 
-    device_table_.CmdPipelineBarrier(command_buffer_,
+    device_table_.CmdPipelineBarrier(command_buffer,
                                      VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
                                      0,
@@ -775,13 +809,14 @@ void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkImage            im
                                      &memory_barrier);
 }
 
-void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkImage            image,
+void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkCommandBuffer    command_buffer,
+                                                             VkImage            image,
                                                              VkImageLayout      old_layout,
                                                              VkImageLayout      new_layout,
                                                              VkImageAspectFlags aspect)
 {
     assert(image != VK_NULL_HANDLE);
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     VkImageMemoryBarrier memory_barrier;
     memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -800,7 +835,7 @@ void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkImage
     memory_barrier.oldLayout     = old_layout;
     memory_barrier.newLayout     = new_layout;
 
-    device_table_.CmdPipelineBarrier(command_buffer_,
+    device_table_.CmdPipelineBarrier(command_buffer,
                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
                                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
                                      0,
@@ -812,8 +847,10 @@ void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkImage
                                      &memory_barrier);
 }
 
-void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
+void VulkanResourcesUtil::CopyImageBuffer(VkCommandBuffer              command_buffer,
+                                          VkImage                      image,
                                           VkBuffer                     buffer,
+                                          VkDeviceSize                 buffer_offset,
                                           const VkExtent3D&            extent,
                                           uint32_t                     mip_levels,
                                           uint32_t                     array_layers,
@@ -822,7 +859,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
                                           bool                         all_layers_per_level,
                                           CopyBufferImageDirection     copy_direction)
 {
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     const uint32_t n_subresources = all_layers_per_level ? mip_levels : mip_levels * array_layers;
 
@@ -833,7 +870,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
     VkBufferImageCopy copy_region;
     copy_region.bufferRowLength             = 0; // Request tightly packed data.
     copy_region.bufferImageHeight           = 0; // Request tightly packed data.
-    copy_region.bufferOffset                = 0;
+    copy_region.bufferOffset                = buffer_offset;
     copy_region.imageOffset.x               = 0;
     copy_region.imageOffset.y               = 0;
     copy_region.imageOffset.z               = 0;
@@ -866,7 +903,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
 
     if (copy_direction == kImageToBuffer)
     {
-        device_table_.CmdCopyImageToBuffer(command_buffer_,
+        device_table_.CmdCopyImageToBuffer(command_buffer,
                                            image,
                                            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                            buffer,
@@ -877,7 +914,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
     {
         assert(copy_direction == kBufferToImage);
 
-        device_table_.CmdCopyBufferToImage(command_buffer_,
+        device_table_.CmdCopyBufferToImage(command_buffer,
                                            buffer,
                                            image,
                                            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -1258,11 +1295,14 @@ VkResult VulkanResourcesUtil::ReadFromImageResourceStaging(VkImage
     }
     else
     {
-        TransitionImageToTransferOptimal(image, layout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, transition_aspect);
+        TransitionImageToTransferOptimal(
+            command_buffer_, image, layout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, transition_aspect);
     }
 
-    CopyImageBuffer(copy_image,
+    CopyImageBuffer(command_buffer_,
+                    copy_image,
                     staging_buffer_.buffer,
+                    0,
                     extent,
                     mip_levels,
                     array_layers,
@@ -1274,7 +1314,8 @@ VkResult VulkanResourcesUtil::ReadFromImageResourceStaging(VkImage
     if ((samples == VK_SAMPLE_COUNT_1_BIT) && (layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
         (layout != VK_IMAGE_LAYOUT_PREINITIALIZED) && (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL))
     {
-        TransitionImageFromTransferOptimal(image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, layout, transition_aspect);
+        TransitionImageFromTransferOptimal(
+            command_buffer_, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, layout, transition_aspect);
     }
 
     result = SubmitCommandBuffer(queue);
@@ -1411,6 +1452,345 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(VkBuffer              buffe
     return result;
 }
 
+VkResult VulkanResourcesUtil::CreateReadbackBatches(uint32_t queue_family_index, VkDeviceSize batch_size)
+{
+    assert(batch_size);
+
+    DestroyReadbackBatches();
+
+    readback_queue_ = GetQueue(queue_family_index, 0);
+    if (readback_queue_ == VK_NULL_HANDLE)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_create_info.pNext                   = nullptr;
+    pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_create_info.queueFamilyIndex        = queue_family_index;
+
+    VkResult result = device_table_.CreateCommandPool(device_, &pool_create_info, nullptr, &readback_command_pool_);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to create a command pool for resource memory snapshot");
+        readback_queue_ = VK_NULL_HANDLE;
+        return result;
+    }
+
+    for (ReadbackBatchContext& batch : readback_batches_)
+    {
+        result = CreateStagingBuffer(batch_size, &batch.staging_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            result = MapStagingBuffer(&batch.staging_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            alloc_info.pNext                       = nullptr;
+            alloc_info.commandPool                 = readback_command_pool_;
+            alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc_info.commandBufferCount          = 1;
+
+            result = device_table_.AllocateCommandBuffers(device_, &alloc_info, &batch.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                // Because this command buffer was not allocated through the loader, it must be assigned a dispatch
+                // table.
+                *reinterpret_cast<void**>(batch.command_buffer) = *reinterpret_cast<void**>(device_);
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to create a command buffer for resource memory snapshot");
+            }
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_create_info.pNext             = nullptr;
+            fence_create_info.flags             = 0;
+
+            result = device_table_.CreateFence(device_, &fence_create_info, nullptr, &batch.fence);
+
+            if (result != VK_SUCCESS)
+            {
+                GFXRECON_LOG_ERROR("Failed to create a fence for resource memory snapshot");
+            }
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            DestroyReadbackBatches();
+            return result;
+        }
+    }
+
+    current_readback_batch_ = 0;
+
+    return VK_SUCCESS;
+}
+
+void VulkanResourcesUtil::DestroyReadbackBatches()
+{
+    for (ReadbackBatchContext& batch : readback_batches_)
+    {
+        if (batch.submitted)
+        {
+            device_table_.WaitForFences(device_, 1, &batch.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
+
+        if (batch.fence != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyFence(device_, batch.fence, nullptr);
+        }
+
+        DestroyStagingBuffer(&batch.staging_buffer);
+
+        // Command buffers are freed with the command pool.
+        batch.command_buffer = VK_NULL_HANDLE;
+        batch.fence          = VK_NULL_HANDLE;
+        batch.recorded_size  = 0;
+        batch.recording      = false;
+        batch.submitted      = false;
+    }
+
+    if (readback_command_pool_ != VK_NULL_HANDLE)
+    {
+        device_table_.DestroyCommandPool(device_, readback_command_pool_, nullptr);
+        readback_command_pool_ = VK_NULL_HANDLE;
+    }
+
+    readback_queue_         = VK_NULL_HANDLE;
+    current_readback_batch_ = 0;
+}
+
+bool VulkanResourcesUtil::IsReadbackBatchSupported(VkFormat              format,
+                                                   VkSampleCountFlags    samples,
+                                                   VkImageAspectFlagBits aspect)
+{
+    // Multisampled images must be resolved before they are copied. The depth and stencil aspects of a combined
+    // depth/stencil image are transitioned together, and the transitions for the two aspects would not be ordered
+    // within a batch.
+    return (samples == VK_SAMPLE_COUNT_1_BIT) &&
+           (((aspect != VK_IMAGE_ASPECT_DEPTH_BIT) && (aspect != VK_IMAGE_ASPECT_STENCIL_BIT)) ||
+            (GetFormatAspectMask(format) == static_cast<VkImageAspectFlags>(aspect)));
+}
+
+VkResult VulkanResourcesUtil::BeginReadbackCopy(VkDeviceSize size, VkDeviceSize alignment, uint64_t* staging_offset)
+{
+    assert((readback_command_pool_ != VK_NULL_HANDLE) && (alignment > 0) && (staging_offset != nullptr));
+
+    ReadbackBatchContext& batch = readback_batches_[current_readback_batch_];
+
+    // The data from the previous submission of this batch must be retrieved with WaitReadbackBatch() first.
+    assert(!batch.submitted);
+
+    if (!batch.recording)
+    {
+        batch.recorded_size = 0;
+    }
+
+    const VkDeviceSize offset = ((batch.recorded_size + alignment - 1) / alignment) * alignment;
+
+    if ((offset + size) > batch.staging_buffer.size)
+    {
+        return VK_INCOMPLETE;
+    }
+
+    if (!batch.recording)
+    {
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        VkResult result = device_table_.BeginCommandBuffer(batch.command_buffer, &begin_info);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to begin a command buffer for resource memory snapshot");
+            return result;
+        }
+
+        batch.recording = true;
+    }
+
+    batch.recorded_size = offset + size;
+    (*staging_offset)   = offset;
+
+    return VK_SUCCESS;
+}
+
+VkResult VulkanResourcesUtil::RecordBufferReadback(VkBuffer buffer, uint64_t size, uint64_t* staging_offset)
+{
+    assert(buffer != VK_NULL_HANDLE);
+    assert(size);
+
+    VkResult result = BeginReadbackCopy(size, 1, staging_offset);
+
+    if (result == VK_SUCCESS)
+    {
+        const ReadbackBatchContext& batch = readback_batches_[current_readback_batch_];
+
+        VkBufferCopy copy_region;
+        copy_region.srcOffset = 0;
+        copy_region.dstOffset = *staging_offset;
+        copy_region.size      = size;
+
+        device_table_.CmdCopyBuffer(batch.command_buffer, buffer, batch.staging_buffer.buffer, 1, &copy_region);
+    }
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::RecordImageReadback(VkImage                      image,
+                                                  VkFormat                     format,
+                                                  const VkExtent3D&            extent,
+                                                  uint32_t                     mip_levels,
+                                                  uint32_t                     array_layers,
+                                                  VkImageLayout                layout,
+                                                  VkImageAspectFlagBits        aspect,
+                                                  const std::vector<uint64_t>& level_sizes,
+                                                  uint64_t*                    staging_offset)
+{
+    assert(image != VK_NULL_HANDLE);
+    assert(level_sizes.size() == mip_levels);
+
+    uint64_t resource_size = 0;
+    for (uint64_t level_size : level_sizes)
+    {
+        resource_size += level_size;
+    }
+
+    // Buffer offsets for image copies must be a multiple of the texel block size, and a multiple of 4 for depth and
+    // stencil aspects.
+    const VkDeviceSize alignment =
+        std::lcm(static_cast<VkDeviceSize>(std::max(1u, vkuFormatElementSizeWithAspect(format, aspect))),
+                 static_cast<VkDeviceSize>(4));
+
+    VkResult result = BeginReadbackCopy(resource_size, alignment, staging_offset);
+
+    if (result == VK_SUCCESS)
+    {
+        const ReadbackBatchContext& batch = readback_batches_[current_readback_batch_];
+
+        VkImageAspectFlags transition_aspect = aspect;
+        if ((transition_aspect == VK_IMAGE_ASPECT_DEPTH_BIT) || (transition_aspect == VK_IMAGE_ASPECT_STENCIL_BIT))
+        {
+            // Depth and stencil aspects need to be transitioned together, so get full aspect
+            // mask for image.
+            transition_aspect = GetFormatAspectMask(format);
+        }
+
+        TransitionImageToTransferOptimal(
+            batch.command_buffer, image, layout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, transition_aspect);
+
+        CopyImageBuffer(batch.command_buffer,
+                        image,
+                        batch.staging_buffer.buffer,
+                        *staging_offset,
+                        extent,
+                        mip_levels,
+                        array_layers,
+                        aspect,
+                        level_sizes,
+                        true,
+                        kImageToBuffer);
+
+        if ((layout != VK_IMAGE_LAYOUT_UNDEFINED) && (layout != VK_IMAGE_LAYOUT_PREINITIALIZED) &&
+            (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL))
+        {
+            TransitionImageFromTransferOptimal(
+                batch.command_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, layout, transition_aspect);
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::SubmitReadbackBatch()
+{
+    assert(readback_queue_ != VK_NULL_HANDLE);
+
+    ReadbackBatchContext& batch  = readback_batches_[current_readback_batch_];
+    VkResult              result = VK_SUCCESS;
+
+    assert(!batch.submitted);
+
+    if (batch.recording)
+    {
+        batch.recording = false;
+
+        result = device_table_.EndCommandBuffer(batch.command_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submit_info.pNext                = nullptr;
+            submit_info.waitSemaphoreCount   = 0;
+            submit_info.pWaitSemaphores      = nullptr;
+            submit_info.pWaitDstStageMask    = nullptr;
+            submit_info.commandBufferCount   = 1;
+            submit_info.pCommandBuffers      = &batch.command_buffer;
+            submit_info.signalSemaphoreCount = 0;
+            submit_info.pSignalSemaphores    = nullptr;
+
+            result = device_table_.QueueSubmit(readback_queue_, 1, &submit_info, batch.fence);
+
+            if (result == VK_SUCCESS)
+            {
+                batch.submitted = true;
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR(
+                    "Failed to submit command buffer for execution while taking a resource memory snapshot");
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to end a command buffer for resource memory snapshot");
+        }
+    }
+
+    current_readback_batch_ = (current_readback_batch_ + 1) % kReadbackBatchCount;
+
+    return result;
+}
+
+const uint8_t* VulkanResourcesUtil::WaitReadbackBatch()
+{
+    ReadbackBatchContext& batch = readback_batches_[current_readback_batch_];
+
+    if (!batch.submitted)
+    {
+        return nullptr;
+    }
+
+    batch.submitted = false;
+
+    VkResult result =
+        device_table_.WaitForFences(device_, 1, &batch.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table_.ResetFences(device_, 1, &batch.fence);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("WaitForFences returned %d while taking a resource memory snapshot", result);
+        return nullptr;
+    }
+
+    InvalidateStagingBuffer(batch.staging_buffer);
+
+    return static_cast<const uint8_t*>(batch.staging_buffer.mapped_ptr);
+}
+
 VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage                      image,
                                                           VkFormat                     format,
                                                           VkImageType                  type,
@@ -1488,11 +1868,14 @@ VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage
 
     if (layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
     {
-        TransitionImageToTransferOptimal(image, layout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, transition_aspect);
+        TransitionImageToTransferOptimal(
+            command_buffer_, image, layout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, transition_aspect);
     }
 
-    CopyImageBuffer(image,
+    CopyImageBuffer(command_buffer_,
+                    image,
                     staging_buffer_.buffer,
+                    0,
                     extent,
                     mip_levels,
                     array_layers,
@@ -1503,7 +1886,8 @@ VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage
 
     if (layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
     {
-        TransitionImageFromTransferOptimal(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, layout, transition_aspect);
+        TransitionImageFromTransferOptimal(
+            command_buffer_, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, layout, transition_aspect);
     }
 
     result = SubmitCommandBuffer(queue);
@@ -49,7 +49,8 @@ class VulkanResourcesUtil
                         const VkPhysicalDeviceMemoryProperties& memory_properties) :
         device_(device),
         device_table_(device_table), memory_properties_(memory_properties), queue_family_index_(UINT32_MAX),
-        command_pool_(VK_NULL_HANDLE), command_buffer_(VK_NULL_HANDLE)
+        command_pool_(VK_NULL_HANDLE), command_buffer_(VK_NULL_HANDLE), current_readback_batch_(0),
+        readback_queue_(VK_NULL_HANDLE), readback_command_pool_(VK_NULL_HANDLE)
     {
         assert(device != VK_NULL_HANDLE);
         assert(memory_properties.memoryHeapCount <= VK_MAX_MEMORY_HEAPS);
@@ -58,6 +59,7 @@ class VulkanResourcesUtil
 
     ~VulkanResourcesUtil()
     {
+        DestroyReadbackBatches();
         DestroyStagingBuffer();
         DestroyCommandBuffer();
         DestroyCommandPool();
@@ -169,7 +171,75 @@ class VulkanResourcesUtil
     VkResult
     ReadFromBufferResource(VkBuffer buffer, uint64_t size, uint32_t queue_family_index, std::vector<uint8_t>& data);
 
+    // The readback batch functions copy many resources to a staging buffer with a single submission, instead of the
+    // submit and wait performed for each resource by ReadFromBufferResource() and ReadFromImageResourceStaging().
+    // Two batches are created, so that the copies for one batch can execute while the data from the other batch is
+    // being processed:
+    //
+    //    CreateReadbackBatches()
+    //    Record copies with RecordBufferReadback() and RecordImageReadback() until they return VK_INCOMPLETE.
+    //    SubmitReadbackBatch()
+    //    WaitReadbackBatch() to retrieve the data for the copies recorded before the previous submit.
+    //    Repeat until all copies have been recorded, then submit and wait twice to retrieve the remaining data.
+    VkResult CreateReadbackBatches(uint32_t queue_family_index, VkDeviceSize batch_size);
+
+    void DestroyReadbackBatches();
+
+    // Records a copy to the current batch, returning the offset of the data in the batch through staging_offset.
+    // Returns VK_INCOMPLETE when the current batch does not have enough space remaining, in which case the batch should
+    // be submitted and the copy recorded again. Resources larger than the batch size must be read individually.
+    VkResult RecordBufferReadback(VkBuffer buffer, uint64_t size, uint64_t* staging_offset);
+
+    // Returns true if the image aspect can be copied with RecordImageReadback().
+    static bool IsReadbackBatchSupported(VkFormat format, VkSampleCountFlags samples, VkImageAspectFlagBits aspect);
+
+    // Images must be supported by IsReadbackBatchSupported(). level_sizes contains the combined size of all array layers
+    // for each mip level, as returned by GetImageResourceSizesOptimal() with all_layers_per_level.
+    VkResult RecordImageReadback(VkImage                      image,
+                                 VkFormat                     format,
+                                 const VkExtent3D&            extent,
+                                 uint32_t                     mip_levels,
+                                 uint32_t                     array_layers,
+                                 VkImageLayout                layout,
+                                 VkImageAspectFlagBits        aspect,
+                                 const std::vector<uint64_t>& level_sizes,
+                                 uint64_t*                    staging_offset);
+
+    // Submits the copies recorded to the current batch, if any, and makes the other batch current.
+    VkResult SubmitReadbackBatch();
+
+    // Waits for the copies to the current batch to complete, and returns a pointer to the batch data. Returns nullptr
+    // if no copies were submitted for the current batch or the wait failed. The data remains valid until the next copy
+    // is recorded.
+    const uint8_t* WaitReadbackBatch();
+
+  private:
+    struct StagingBufferContext
+    {
+        StagingBufferContext() = default;
+
+        VkBuffer              buffer                = VK_NULL_HANDLE;
+        VkDeviceMemory        memory                = VK_NULL_HANDLE;
+        VkDeviceSize          size                  = 0;
+        VkMemoryPropertyFlags memory_property_flags = VkMemoryPropertyFlags(0);
+        void*                 mapped_ptr            = nullptr;
+    };
+
+    struct ReadbackBatchContext
+    {
+        StagingBufferContext staging_buffer;
+        VkCommandBuffer      command_buffer = VK_NULL_HANDLE;
+        VkFence              fence          = VK_NULL_HANDLE;
+        VkDeviceSize         recorded_size  = 0;
+        bool                 recording      = false;
+        bool                 submitted      = false;
+    };
+
+    static const size_t kReadbackBatchCount = 2;
+
   private:
+    VkResult CreateStagingBuffer(VkDeviceSize size, StagingBufferContext* staging_buffer);
+
     VkResult CreateCommandPool(uint32_t queue_family_index);
 
     void DestroyCommandPool();
@@ -186,24 +256,39 @@ class VulkanResourcesUtil
 
     VkResult MapStagingBuffer();
 
+    VkResult MapStagingBuffer(StagingBufferContext* staging_buffer);
+
     void UnmapStagingBuffer();
 
+    void UnmapStagingBuffer(StagingBufferContext* staging_buffer);
+
     void InvalidateStagingBuffer();
 
+    void InvalidateStagingBuffer(const StagingBufferContext& staging_buffer);
+
     void DestroyStagingBuffer();
 
-    void TransitionImageToTransferOptimal(VkImage            image,
+    void DestroyStagingBuffer(StagingBufferContext* staging_buffer);
+
+    // Reserves space for a copy in the current readback batch, beginning the batch command buffer if necessary.
+    VkResult BeginReadbackCopy(VkDeviceSize size, VkDeviceSize alignment, uint64_t* staging_offset);
+
+    void TransitionImageToTransferOptimal(VkCommandBuffer    command_buffer,
+                                          VkImage            image,
                                           VkImageLayout      current_layout,
                                           VkImageLayout      destination_layout,
                                           VkImageAspectFlags aspect);
 
-    void TransitionImageFromTransferOptimal(VkImage            image,
+    void TransitionImageFromTransferOptimal(VkCommandBuffer    command_buffer,
+                                            VkImage            image,
                                             VkImageLayout      old_layout,
                                             VkImageLayout      new_layout,
                                             VkImageAspectFlags aspect);
 
-    void CopyImageBuffer(VkImage                      image,
+    void CopyImageBuffer(VkCommandBuffer              command_buffer,
+                         VkImage                      image,
                          VkBuffer                     buffer,
+                         VkDeviceSize                 buffer_offset,
                          const VkExtent3D&            extent,
                          uint32_t                     mip_levels,
                          uint32_t                     array_layers,
@@ -231,17 +316,6 @@ class VulkanResourcesUtil
 
     void InvalidateMappedMemoryRange(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size);
 
-    struct StagingBufferContext
-    {
-        StagingBufferContext() = default;
-
-        VkBuffer              buffer                = VK_NULL_HANDLE;
-        VkDeviceMemory        memory                = VK_NULL_HANDLE;
-        VkDeviceSize          size                  = 0;
-        VkMemoryPropertyFlags memory_property_flags = VkMemoryPropertyFlags(0);
-        void*                 mapped_ptr            = nullptr;
-    };
-
     VkDevice                                device_;
     const encode::VulkanDeviceTable&        device_table_;
     const VkPhysicalDeviceMemoryProperties& memory_properties_;
@@ -249,6 +323,10 @@ class VulkanResourcesUtil
     VkCommandPool                           command_pool_;
     VkCommandBuffer                         command_buffer_;
     StagingBufferContext                    staging_buffer_;
+    ReadbackBatchContext                    readback_batches_[kReadbackBatchCount];
+    size_t                                  current_readback_batch_;
+    VkQueue                                 readback_queue_;
+    VkCommandPool                           readback_command_pool_;
 };
 
 void GetFormatAspects(VkFormat format, std::vector<VkImageAspectFlagBits>* aspects, bool* combined_depth_stencil);
@@ -0,0 +1,647 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/async_file_output_stream.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Limits on the entries retained for reuse by each writing thread, to avoid holding on to the memory from occasional
+// large blocks such as fill memory commands.
+const size_t kMaxFreeBuffers        = 64;
+const size_t kMaxFreeBufferCapacity = 1024 * 1024;
+
+std::atomic<uint64_t> AsyncFileOutputStream::instance_count_{ 0 };
+
+// Marks the buffers of a thread as exited when the thread exits, so that the writer threads can reclaim them. The
+// buffers are shared with the streams, which may be destroyed before or after the thread exits.
+struct AsyncFileOutputStream::ThreadExitNotifier
+{
+    ~ThreadExitNotifier()
+    {
+        for (auto& buffer : buffers)
+        {
+            buffer->exited.store(true, std::memory_order_release);
+        }
+    }
+
+    void Add(const std::shared_ptr<ThreadBuffer>& buffer)
+    {
+        // Release the buffers of streams that have been destroyed.
+        buffers.erase(std::remove_if(buffers.begin(),
+                                     buffers.end(),
+                                     [](const std::shared_ptr<ThreadBuffer>& entry) { return entry.use_count() == 1; }),
+                      buffers.end());
+
+        buffers.push_back(buffer);
+    }
+
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+AsyncFileOutputStream::AsyncFileOutputStream(const std::string& filename,
+                                             size_t             buffer_size,
+                                             size_t             max_queue_bytes,
+                                             bool               append) :
+    FileOutputStream(filename, buffer_size, append),
+    instance_id_(++instance_count_), next_sequence_(0), queued_bytes_(0), writer_waiting_(false), thread_count_(0),
+    merged_sequence_(0), max_queue_bytes_(max_queue_bytes), writer_busy_(false), writer_stopped_(false), stop_(false)
+{
+    if (file_ != nullptr)
+    {
+        Start();
+    }
+}
+
+AsyncFileOutputStream::~AsyncFileOutputStream()
+{
+    Stop();
+
+    if (file_ != nullptr)
+    {
+        platform::FileFlush(file_);
+
+        GFXRECON_LOG_INFO("Asynchronous capture file writer: wrote %" PRIu64 " blocks (%" PRIu64
+                          " bytes) from %" PRIuPTR " threads, peak queue depth %" PRIuPTR " blocks (%" PRIuPTR
+                          " bytes), writing threads stalled %" PRIu64 " times for %.3f ms",
+                          statistics_.blocks_written,
+                          statistics_.bytes_written,
+                          thread_count_,
+                          statistics_.peak_queue_depth,
+                          statistics_.peak_queue_bytes,
+                          statistics_.stall_count,
+                          datetime::ConvertTimestampToMilliseconds(statistics_.stall_time));
+
+        if (statistics_.blocks_processed > 0)
+        {
+            GFXRECON_LOG_INFO("Asynchronous capture file writer: %" PRIuPTR " worker threads processed %" PRIu64
+                              " blocks (%" PRIu64 " bytes in, %" PRIu64 " bytes out)",
+                              processors_.size(),
+                              statistics_.blocks_processed,
+                              statistics_.processed_input_bytes,
+                              statistics_.processed_output_bytes);
+        }
+    }
+
+    // Buffers of threads that are still running are kept by their ThreadExitNotifier, without their entries.
+    for (auto& buffer : thread_buffers_)
+    {
+        DeleteEntries(buffer.get());
+    }
+}
+
+void AsyncFileOutputStream::Reset(FILE* file)
+{
+    Stop();
+    FileOutputStream::Reset(file);
+
+    if (file_ != nullptr)
+    {
+        Start();
+    }
+}
+
+size_t AsyncFileOutputStream::Write(const void* data, size_t len)
+{
+    return QueueWrite(data, len, false);
+}
+
+void AsyncFileOutputStream::EnableBlockProcessing(uint32_t worker_count, const BlockProcessorFactory& factory)
+{
+    GFXRECON_ASSERT(processors_.empty() && (next_sequence_ == 0));
+
+    if ((file_ != nullptr) && processors_.empty())
+    {
+        for (uint32_t i = 0; i < worker_count; ++i)
+        {
+            processors_.emplace_back(factory());
+            worker_threads_.emplace_back(&AsyncFileOutputStream::WorkerThreadMain, this, processors_.back().get());
+        }
+    }
+}
+
+size_t AsyncFileOutputStream::WriteAndProcess(const void* data, size_t len)
+{
+    return QueueWrite(data, len, !processors_.empty());
+}
+
+size_t AsyncFileOutputStream::QueueWrite(const void* data, size_t len, bool process)
+{
+    if ((file_ == nullptr) || (len == 0))
+    {
+        return 0;
+    }
+
+    WaitForQueueSpace(len);
+
+    const uint8_t* bytes  = reinterpret_cast<const uint8_t*>(data);
+    ThreadBuffer*  buffer = GetThreadBuffer();
+    Entry*         entry  = AcquireEntry(buffer);
+
+    entry->data.assign(bytes, bytes + len);
+    entry->flush   = false;
+    entry->process = process;
+
+    queued_bytes_ += len;
+    SubmitEntry(buffer, entry);
+
+    return len;
+}
+
+void AsyncFileOutputStream::WaitForQueueSpace(size_t len)
+{
+    size_t queued_bytes = queued_bytes_.load();
+
+    if ((queued_bytes > 0) && ((queued_bytes + len) > max_queue_bytes_))
+    {
+        // Apply backpressure. A single write larger than the queue limit is accepted once the queue has drained.
+        int64_t start_time = datetime::GetTimestamp();
+
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+
+        queue_not_full_.wait(lock, [this, len]() {
+            size_t queued_bytes = queued_bytes_.load();
+            return (queued_bytes == 0) || ((queued_bytes + len) <= max_queue_bytes_);
+        });
+
+        ++statistics_.stall_count;
+        statistics_.stall_time += datetime::DiffTimestamps(start_time, datetime::GetTimestamp());
+    }
+}
+
+AsyncFileOutputStream::ThreadBuffer* AsyncFileOutputStream::GetThreadBuffer()
+{
+    // Each thread caches its buffer for the stream that it most recently wrote to.
+    thread_local uint64_t           cached_instance_id = 0;
+    thread_local ThreadBuffer*      cached_buffer      = nullptr;
+    thread_local ThreadExitNotifier exit_notifier;
+
+    if (cached_instance_id != instance_id_)
+    {
+        const std::thread::id thread_id = std::this_thread::get_id();
+
+        std::lock_guard<std::mutex> lock(thread_buffers_mutex_);
+
+        // A thread that has exited may have had the same ID, so its buffer is skipped until it is reclaimed.
+        auto entry = std::find_if(
+            thread_buffers_.begin(), thread_buffers_.end(), [thread_id](const std::shared_ptr<ThreadBuffer>& buffer) {
+                return (buffer->thread_id == thread_id) && !buffer->exited.load(std::memory_order_relaxed);
+            });
+
+        if (entry != thread_buffers_.end())
+        {
+            cached_buffer = entry->get();
+        }
+        else
+        {
+            thread_buffers_.emplace_back(std::make_shared<ThreadBuffer>());
+            cached_buffer            = thread_buffers_.back().get();
+            cached_buffer->thread_id = thread_id;
+            exit_notifier.Add(thread_buffers_.back());
+            ++thread_count_;
+        }
+
+        cached_instance_id = instance_id_;
+    }
+
+    return cached_buffer;
+}
+
+AsyncFileOutputStream::Entry* AsyncFileOutputStream::AcquireEntry(ThreadBuffer* buffer)
+{
+    if (buffer->free_entries == nullptr)
+    {
+        buffer->free_entries = buffer->returned.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    Entry* entry = buffer->free_entries;
+
+    if (entry != nullptr)
+    {
+        buffer->free_entries = entry->next;
+    }
+    else
+    {
+        entry        = new Entry;
+        entry->owner = buffer;
+    }
+
+    entry->next = nullptr;
+
+    return entry;
+}
+
+void AsyncFileOutputStream::SubmitEntry(ThreadBuffer* buffer, Entry* entry)
+{
+    // The sequence number determines the position of the entry in the file.
+    entry->sequence = next_sequence_++;
+    entry->next     = buffer->submitted.load(std::memory_order_relaxed);
+
+    while (!buffer->submitted.compare_exchange_weak(entry->next, entry))
+    {
+    }
+
+    // The writer thread sets writer_waiting_ before its final check for submitted entries, so it is either woken here
+    // or finds this entry before it waits.
+    if (writer_waiting_.load())
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_not_empty_.notify_one();
+    }
+}
+
+void AsyncFileOutputStream::ReturnEntry(Entry* entry)
+{
+    ThreadBuffer* owner = entry->owner;
+
+    GFXRECON_ASSERT(owner->pending_count > 0);
+    --owner->pending_count;
+
+    // The returned list is empty after the submitting thread has taken it for reuse.
+    if (owner->returned.load(std::memory_order_relaxed) == nullptr)
+    {
+        owner->returned_count = 0;
+    }
+
+    if ((owner->returned_count >= kMaxFreeBuffers) || (entry->data.capacity() > kMaxFreeBufferCapacity))
+    {
+        delete entry;
+    }
+    else
+    {
+        entry->data.clear();
+        entry->next = owner->returned.load(std::memory_order_relaxed);
+
+        while (!owner->returned.compare_exchange_weak(
+            entry->next, entry, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+
+        ++owner->returned_count;
+    }
+}
+
+void AsyncFileOutputStream::DeleteEntries(Entry* entry)
+{
+    while (entry != nullptr)
+    {
+        Entry* next = entry->next;
+        delete entry;
+        entry = next;
+    }
+}
+
+void AsyncFileOutputStream::DeleteEntries(ThreadBuffer* buffer)
+{
+    DeleteEntries(buffer->submitted.exchange(nullptr));
+    DeleteEntries(buffer->returned.exchange(nullptr));
+    DeleteEntries(buffer->free_entries);
+    DeleteEntries(buffer->received_head);
+
+    buffer->free_entries  = nullptr;
+    buffer->received_head = nullptr;
+    buffer->received_tail = nullptr;
+}
+
+bool AsyncFileOutputStream::HasSubmittedEntries()
+{
+    std::lock_guard<std::mutex> lock(thread_buffers_mutex_);
+
+    for (const auto& buffer : thread_buffers_)
+    {
+        if (buffer->submitted.load() != nullptr)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AsyncFileOutputStream::MergeSubmittedEntries()
+{
+    std::lock_guard<std::mutex> lock(thread_buffers_mutex_);
+
+    // Take the entries submitted by each thread, which are linked in reverse order, and append them to the thread's
+    // list of received entries in submission order.
+    for (auto& buffer : thread_buffers_)
+    {
+        Entry* entry = buffer->submitted.exchange(nullptr, std::memory_order_acquire);
+        Entry* head  = nullptr;
+        Entry* tail  = entry;
+
+        while (entry != nullptr)
+        {
+            Entry* next = entry->next;
+            entry->next = head;
+            head        = entry;
+            entry       = next;
+
+            ++buffer->pending_count;
+        }
+
+        if (head != nullptr)
+        {
+            if (buffer->received_tail != nullptr)
+            {
+                buffer->received_tail->next = head;
+            }
+            else
+            {
+                buffer->received_head = head;
+            }
+
+            buffer->received_tail = tail;
+        }
+    }
+
+    // Move entries to the write queue in sequence order. Merging stops at a sequence number that was taken by a thread
+    // that has not submitted its entry yet.
+    bool merged = true;
+
+    while (merged)
+    {
+        merged = false;
+
+        for (auto& buffer : thread_buffers_)
+        {
+            while ((buffer->received_head != nullptr) && (buffer->received_head->sequence == merged_sequence_))
+            {
+                Entry* entry          = buffer->received_head;
+                buffer->received_head = entry->next;
+
+                if (buffer->received_head == nullptr)
+                {
+                    buffer->received_tail = nullptr;
+                }
+
+                entry->next  = nullptr;
+                entry->ready = !entry->process;
+                queue_.push_back(entry);
+
+                if (entry->process)
+                {
+                    work_queue_.push_back(entry);
+                    work_available_.notify_one();
+                }
+
+                ++merged_sequence_;
+                merged = true;
+            }
+        }
+    }
+
+    // Reclaim the buffers of threads that have exited, after their entries have been written. The submitted list is
+    // checked after the exited flag, which is set after the thread's last submission.
+    thread_buffers_.erase(std::remove_if(thread_buffers_.begin(),
+                                         thread_buffers_.end(),
+                                         [](const std::shared_ptr<ThreadBuffer>& buffer) {
+                                             if (buffer->exited.load(std::memory_order_acquire) &&
+                                                 (buffer->submitted.load() == nullptr) &&
+                                                 (buffer->pending_count == 0))
+                                             {
+                                                 DeleteEntries(buffer.get());
+                                                 return true;
+                                             }
+
+                                             return false;
+                                         }),
+                          thread_buffers_.end());
+
+    statistics_.thread_buffers   = thread_buffers_.size();
+    statistics_.queue_depth      = queue_.size();
+    statistics_.peak_queue_depth = std::max(statistics_.peak_queue_depth, queue_.size());
+    statistics_.peak_queue_bytes = std::max(statistics_.peak_queue_bytes, queued_bytes_.load());
+}
+
+void AsyncFileOutputStream::Flush()
+{
+    if (file_ != nullptr)
+    {
+        // Flush requests are ordered with the writes, so the file is flushed after all writes that were submitted
+        // before this call.
+        ThreadBuffer* buffer = GetThreadBuffer();
+        Entry*        entry  = AcquireEntry(buffer);
+
+        entry->flush   = true;
+        entry->process = false;
+        SubmitEntry(buffer, entry);
+    }
+}
+
+void AsyncFileOutputStream::WaitForIdle()
+{
+    if (file_ != nullptr)
+    {
+        const uint64_t sequence = next_sequence_.load();
+
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        queue_idle_.wait(lock, [this, sequence]() {
+            return (merged_sequence_ >= sequence) && queue_.empty() && !writer_busy_;
+        });
+
+        platform::FileFlush(file_);
+    }
+}
+
+AsyncFileOutputStream::Statistics AsyncFileOutputStream::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return statistics_;
+}
+
+void AsyncFileOutputStream::Start()
+{
+    stop_           = false;
+    writer_stopped_ = false;
+    writer_thread_  = std::thread(&AsyncFileOutputStream::WriterThreadMain, this);
+
+    for (auto& processor : processors_)
+    {
+        worker_threads_.emplace_back(&AsyncFileOutputStream::WorkerThreadMain, this, processor.get());
+    }
+}
+
+void AsyncFileOutputStream::Stop()
+{
+    if (writer_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            stop_ = true;
+        }
+
+        queue_not_empty_.notify_one();
+        writer_thread_.join();
+
+        // Worker threads exit after the writer thread, which waits for all blocks to be processed and written.
+        for (auto& worker_thread : worker_threads_)
+        {
+            worker_thread.join();
+        }
+        worker_threads_.clear();
+    }
+}
+
+void AsyncFileOutputStream::WriterThreadMain()
+{
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+
+    for (;;)
+    {
+        MergeSubmittedEntries();
+
+        // Blocks are written strictly in sequence order, so wait for the oldest block to finish processing even if
+        // later blocks are already complete.
+        if (queue_.empty() || !queue_.front()->ready)
+        {
+            if (stop_ && queue_.empty() && (merged_sequence_ == next_sequence_.load()))
+            {
+                // Stop was requested and all pending writes have completed.
+                break;
+            }
+
+            writer_waiting_ = true;
+
+            if (!HasSubmittedEntries())
+            {
+                queue_not_empty_.wait(lock);
+            }
+
+            writer_waiting_ = false;
+            continue;
+        }
+
+        Entry* entry = queue_.front();
+        queue_.pop_front();
+        writer_busy_ = true;
+
+        // Consecutive flush requests are combined, for when the application presents faster than the writer can
+        // keep up.
+        const bool flush = entry->flush && (queue_.empty() || !queue_.front()->flush);
+
+        lock.unlock();
+
+        const size_t size         = entry->data.size();
+        bool         write_failed = false;
+        if (size > 0)
+        {
+            // This thread is the only one writing to the file, so the stream lock can be skipped.
+            size_t written = platform::FileWriteNoLock(entry->data.data(), 1, size, file_);
+            if (written != size)
+            {
+                GFXRECON_LOG_ERROR_ONCE("Asynchronous capture file writer failed to write %" PRIuPTR " bytes", size);
+                write_failed = true;
+            }
+        }
+
+        if (flush)
+        {
+            platform::FileFlush(file_);
+        }
+
+        ReturnEntry(entry);
+
+        lock.lock();
+
+        writer_busy_ = false;
+        queued_bytes_ -= size;
+
+        if (size > 0)
+        {
+            ++statistics_.blocks_written;
+            statistics_.bytes_written += size;
+        }
+        if (write_failed)
+        {
+            ++statistics_.write_errors;
+        }
+        statistics_.queue_depth = queue_.size();
+
+        queue_not_full_.notify_all();
+
+        if (queue_.empty())
+        {
+            queue_idle_.notify_all();
+        }
+    }
+
+    writer_stopped_ = true;
+    work_available_.notify_all();
+}
+
+void AsyncFileOutputStream::WorkerThreadMain(BlockProcessor* processor)
+{
+    GFXRECON_ASSERT(processor != nullptr);
+
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+
+    for (;;)
+    {
+        work_available_.wait(lock, [this]() { return writer_stopped_ || !work_queue_.empty(); });
+
+        if (work_queue_.empty())
+        {
+            // The writer thread has stopped, so all pending blocks have been processed.
+            break;
+        }
+
+        Entry* entry = work_queue_.front();
+        work_queue_.pop_front();
+
+        lock.unlock();
+
+        const size_t input_size = entry->data.size();
+        processor->Process(&entry->data);
+        const size_t output_size = entry->data.size();
+
+        lock.lock();
+
+        queued_bytes_ += output_size;
+        queued_bytes_ -= input_size;
+        entry->ready = true;
+
+        ++statistics_.blocks_processed;
+        statistics_.processed_input_bytes += input_size;
+        statistics_.processed_output_bytes += output_size;
+
+        if (entry == queue_.front())
+        {
+            queue_not_empty_.notify_one();
+        }
+
+        if (output_size < input_size)
+        {
+            queue_not_full_.notify_all();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
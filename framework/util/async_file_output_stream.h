@@ -0,0 +1,214 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+/// @file Streaming into a file from a dedicated writer thread.
+
+#ifndef GFXRECON_UTIL_ASYNC_FILE_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_ASYNC_FILE_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/file_output_stream.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+/// @brief A FileOutputStream that copies each write into a bounded queue and
+/// performs the actual file I/O on a dedicated writer thread.
+///
+/// Writes are committed to the file in the order that Write() was called. When
+/// the amount of queued data exceeds the configured limit, Write() blocks until
+/// the writer thread has made room, so memory use stays bounded when the disk
+/// cannot keep up with the application.
+///
+/// Each writing thread appends its writes to its own buffer, without taking a
+/// lock. A write is ordered by a sequence number from a shared atomic counter,
+/// and the writer thread merges the thread buffers in sequence order. The buffer
+/// of a thread that has exited is reclaimed once its writes have been written.
+///
+/// Writes submitted with WriteAndProcess() are additionally passed through a
+/// BlockProcessor, such as a compressor, on a pool of worker threads. The
+/// writer thread waits for each block to finish processing before writing it,
+/// so the file contents remain in submission order.
+class AsyncFileOutputStream : public FileOutputStream
+{
+  public:
+    class BlockProcessor
+    {
+      public:
+        virtual ~BlockProcessor() {}
+
+        /// @brief Transform the block contents in place. Called from a worker thread.
+        virtual void Process(std::vector<uint8_t>* block) = 0;
+    };
+
+    typedef std::function<std::unique_ptr<BlockProcessor>()> BlockProcessorFactory;
+
+    struct Statistics
+    {
+        uint64_t blocks_written{ 0 };
+        uint64_t bytes_written{ 0 };
+        size_t   queue_depth{ 0 };
+        size_t   peak_queue_depth{ 0 };
+        size_t   peak_queue_bytes{ 0 };
+        uint64_t stall_count{ 0 };
+        int64_t  stall_time{ 0 }; // Nanoseconds spent by writing threads waiting for queue space.
+        uint64_t blocks_processed{ 0 };
+        uint64_t processed_input_bytes{ 0 };
+        uint64_t processed_output_bytes{ 0 };
+        uint64_t write_errors{ 0 };
+        size_t   thread_buffers{ 0 }; // Buffers of writing threads that have not been reclaimed.
+    };
+
+    static const size_t kDefaultMaxQueueBytes = 64 * 1024 * 1024;
+
+    /// @param buffer_size Controls the size of file stream buffer used by the writer thread.
+    /// @param max_queue_bytes Maximum amount of data that may be pending before Write() blocks.
+    AsyncFileOutputStream(const std::string& filename,
+                          size_t             buffer_size,
+                          size_t             max_queue_bytes = kDefaultMaxQueueBytes,
+                          bool               append          = false);
+
+    virtual ~AsyncFileOutputStream() override;
+
+    /// @brief Wait for all pending writes to complete before switching to the new file.
+    virtual void Reset(FILE* file) override;
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    /// @brief Create worker threads for WriteAndProcess(), each with its own processor from the factory. Must be
+    /// called before any data is written.
+    void EnableBlockProcessing(uint32_t worker_count, const BlockProcessorFactory& factory);
+
+    /// @brief Queue a write that will be transformed by a BlockProcessor before it is written to the file. Behaves
+    /// like Write() when block processing has not been enabled.
+    size_t WriteAndProcess(const void* data, size_t len);
+
+    /// @brief Request a flush of the file after all currently queued writes. Does not wait.
+    virtual void Flush() override;
+
+    /// @brief Block until the writer thread has written and flushed all queued data.
+    void WaitForIdle();
+
+    Statistics GetStatistics();
+
+  private:
+    struct ThreadBuffer;
+    struct ThreadExitNotifier;
+
+    struct Entry
+    {
+        std::vector<uint8_t> data;
+        uint64_t             sequence{ 0 };
+        bool                 flush{ false };
+        bool                 process{ false };
+        bool                 ready{ true };
+        ThreadBuffer*        owner{ nullptr }; // Buffer of the thread that submitted the entry.
+        Entry*               next{ nullptr };
+    };
+
+    // Entries submitted by one thread. The submitting thread pushes entries onto the submitted list and the writer
+    // thread takes the whole list at once, so neither needs a lock. The writer thread returns written entries to the
+    // submitting thread for reuse through the returned list.
+    struct ThreadBuffer
+    {
+        std::thread::id     thread_id;
+        std::atomic<bool>   exited{ false }; // Set when the submitting thread exits.
+        std::atomic<Entry*> submitted{ nullptr };
+        std::atomic<Entry*> returned{ nullptr };
+        Entry*              free_entries{ nullptr };  // Only accessed by the submitting thread.
+        Entry*              received_head{ nullptr }; // Only accessed by the writer thread.
+        Entry*              received_tail{ nullptr }; // Only accessed by the writer thread.
+        size_t              returned_count{ 0 };      // Only accessed by the writer thread.
+        size_t              pending_count{ 0 };       // Entries taken by the writer thread and not yet returned.
+    };
+
+  private:
+    size_t QueueWrite(const void* data, size_t len, bool process);
+
+    void WaitForQueueSpace(size_t len);
+
+    ThreadBuffer* GetThreadBuffer();
+
+    Entry* AcquireEntry(ThreadBuffer* buffer);
+
+    void SubmitEntry(ThreadBuffer* buffer, Entry* entry);
+
+    void ReturnEntry(Entry* entry);
+
+    static void DeleteEntries(Entry* entry);
+
+    static void DeleteEntries(ThreadBuffer* buffer);
+
+    bool HasSubmittedEntries();
+
+    void MergeSubmittedEntries();
+
+    void Start();
+
+    void Stop();
+
+    void WriterThreadMain();
+
+    void WorkerThreadMain(BlockProcessor* processor);
+
+  private:
+    static std::atomic<uint64_t> instance_count_;
+
+    const uint64_t                               instance_id_; // Identifies the stream in per-thread buffer caches.
+    std::atomic<uint64_t>                        next_sequence_;
+    std::atomic<size_t>                          queued_bytes_;
+    std::atomic<bool>                            writer_waiting_;
+    std::mutex                                   thread_buffers_mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>>   thread_buffers_; // Shared with the ThreadExitNotifier of each thread.
+    size_t                                       thread_count_;   // Number of threads that have written to the stream.
+    std::mutex                                   queue_mutex_;
+    std::condition_variable                      queue_not_empty_;
+    std::condition_variable                      queue_not_full_;
+    std::condition_variable                      queue_idle_;
+    std::condition_variable                      work_available_;
+    std::deque<Entry*>                           queue_;      // Entries merged in sequence order.
+    std::deque<Entry*>                           work_queue_; // Entries waiting for a BlockProcessor.
+    uint64_t                                     merged_sequence_;
+    size_t                                       max_queue_bytes_;
+    bool                                         writer_busy_;
+    bool                                         writer_stopped_;
+    bool                                         stop_;
+    std::thread                                  writer_thread_;
+    std::vector<std::thread>                     worker_threads_;
+    std::vector<std::unique_ptr<BlockProcessor>> processors_;
+    Statistics                                   statistics_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_ASYNC_FILE_OUTPUT_STREAM_H
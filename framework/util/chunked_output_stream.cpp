@@ -0,0 +1,206 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/chunked_output_stream.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+std::atomic<uint64_t> MemoryChunkArena::total_retained_bytes_{ 0 };
+
+MemoryChunkArena::~MemoryChunkArena()
+{
+    // All streams should have returned their chunks before the arena is destroyed.
+    assert(retained_bytes_ == (free_chunks_.size() * chunk_size_));
+    Trim();
+}
+
+uint8_t* MemoryChunkArena::AcquireChunk()
+{
+    if (!free_chunks_.empty())
+    {
+        uint8_t* chunk = free_chunks_.back();
+        free_chunks_.pop_back();
+        return chunk;
+    }
+
+    retained_bytes_ += chunk_size_;
+    total_retained_bytes_.fetch_add(chunk_size_, std::memory_order_relaxed);
+
+    return new uint8_t[chunk_size_];
+}
+
+void MemoryChunkArena::ReleaseChunk(uint8_t* chunk)
+{
+    assert(chunk != nullptr);
+    free_chunks_.push_back(chunk);
+}
+
+void MemoryChunkArena::Trim()
+{
+    const uint64_t freed_bytes = free_chunks_.size() * chunk_size_;
+
+    for (uint8_t* chunk : free_chunks_)
+    {
+        delete[] chunk;
+    }
+
+    free_chunks_.clear();
+    free_chunks_.shrink_to_fit();
+
+    retained_bytes_ -= freed_bytes;
+    total_retained_bytes_.fetch_sub(freed_bytes, std::memory_order_relaxed);
+}
+
+ChunkedOutputStream::~ChunkedOutputStream()
+{
+    Clear();
+}
+
+void ChunkedOutputStream::SetArena(MemoryChunkArena* arena)
+{
+    Clear();
+    arena_ = arena;
+    private_arena_.reset();
+}
+
+void ChunkedOutputStream::Clear()
+{
+    if (!chunks_.empty())
+    {
+        MemoryChunkArena* arena = GetArena();
+        for (uint8_t* chunk : chunks_)
+        {
+            arena->ReleaseChunk(chunk);
+        }
+
+        chunks_.clear();
+    }
+
+    data_size_ = 0;
+}
+
+size_t ChunkedOutputStream::Write(const void* data, size_t len)
+{
+    MemoryChunkArena* arena      = GetArena();
+    const size_t      chunk_size = arena->GetChunkSize();
+    const uint8_t*    bytes      = reinterpret_cast<const uint8_t*>(data);
+    size_t            remaining  = len;
+
+    while (remaining > 0)
+    {
+        if (data_size_ == (chunks_.size() * chunk_size))
+        {
+            chunks_.push_back(arena->AcquireChunk());
+        }
+
+        size_t chunk_offset = data_size_ % chunk_size;
+        size_t copy_size    = std::min(remaining, chunk_size - chunk_offset);
+        memcpy(chunks_.back() + chunk_offset, bytes, copy_size);
+
+        bytes += copy_size;
+        remaining -= copy_size;
+        data_size_ += copy_size;
+    }
+
+    return len;
+}
+
+size_t ChunkedOutputStream::Read(size_t offset, void* data, size_t len) const
+{
+    if (offset >= data_size_)
+    {
+        return 0;
+    }
+
+    const size_t chunk_size = GetChunkSize();
+    uint8_t*     bytes      = reinterpret_cast<uint8_t*>(data);
+    size_t       remaining  = std::min(len, data_size_ - offset);
+
+    while (remaining > 0)
+    {
+        size_t chunk_offset = offset % chunk_size;
+        size_t copy_size    = std::min(remaining, chunk_size - chunk_offset);
+        memcpy(bytes, chunks_[offset / chunk_size] + chunk_offset, copy_size);
+
+        bytes += copy_size;
+        offset += copy_size;
+        remaining -= copy_size;
+    }
+
+    return bytes - reinterpret_cast<uint8_t*>(data);
+}
+
+size_t ChunkedOutputStream::WriteTo(size_t offset, size_t len, OutputStream* stream) const
+{
+    assert(stream != nullptr);
+
+    if (offset >= data_size_)
+    {
+        return 0;
+    }
+
+    const size_t chunk_size = GetChunkSize();
+    size_t       remaining  = std::min(len, data_size_ - offset);
+    size_t       written    = 0;
+
+    while (remaining > 0)
+    {
+        size_t chunk_offset = offset % chunk_size;
+        size_t copy_size    = std::min(remaining, chunk_size - chunk_offset);
+        stream->Write(chunks_[offset / chunk_size] + chunk_offset, copy_size);
+
+        written += copy_size;
+        offset += copy_size;
+        remaining -= copy_size;
+    }
+
+    return written;
+}
+
+size_t ChunkedOutputStream::GetChunkSize() const
+{
+    assert((arena_ != nullptr) || (private_arena_ != nullptr));
+    return (arena_ != nullptr) ? arena_->GetChunkSize() : private_arena_->GetChunkSize();
+}
+
+MemoryChunkArena* ChunkedOutputStream::GetArena()
+{
+    if (arena_ == nullptr)
+    {
+        if (private_arena_ == nullptr)
+        {
+            private_arena_ = std::make_unique<MemoryChunkArena>();
+        }
+
+        return private_arena_.get();
+    }
+
+    return arena_;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
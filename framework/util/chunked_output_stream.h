@@ -0,0 +1,126 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_CHUNKED_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_CHUNKED_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Source of fixed size memory chunks for ChunkedOutputStream. Chunks that are released by a stream are kept for reuse
+// until Trim is called, so streams that are cleared and rewritten repeatedly do not allocate from the system heap once
+// the arena holds enough chunks for the largest set of streams that are filled at the same time. The arena does not
+// synchronize access; all streams drawing from one arena must be written from one thread at a time.
+class MemoryChunkArena
+{
+  public:
+    static const size_t kDefaultChunkSize = 4096;
+
+  public:
+    MemoryChunkArena(size_t chunk_size = kDefaultChunkSize) : chunk_size_(chunk_size) {}
+
+    ~MemoryChunkArena();
+
+    MemoryChunkArena(const MemoryChunkArena&) = delete;
+
+    MemoryChunkArena& operator=(const MemoryChunkArena&) = delete;
+
+    size_t GetChunkSize() const { return chunk_size_; }
+
+    uint8_t* AcquireChunk();
+
+    void ReleaseChunk(uint8_t* chunk);
+
+    // Free the chunks that are not currently in use by a stream.
+    void Trim();
+
+    // Bytes of system memory held by this arena, including chunks that are in use and chunks that are free for reuse.
+    uint64_t GetRetainedBytes() const { return retained_bytes_; }
+
+    // Bytes of system memory held by all arenas.
+    static uint64_t GetTotalRetainedBytes() { return total_retained_bytes_.load(std::memory_order_relaxed); }
+
+  private:
+    std::vector<uint8_t*> free_chunks_;
+    const size_t          chunk_size_;
+    uint64_t              retained_bytes_{ 0 };
+
+    static std::atomic<uint64_t> total_retained_bytes_;
+};
+
+// Output stream that stores the written data in a list of chunks drawn from a MemoryChunkArena, instead of one
+// contiguous buffer. Writes never move data that has already been written, and Clear returns the chunks to the arena
+// for reuse by other streams. The arena must outlive the stream. A stream without an arena allocates its chunks from
+// a private arena.
+class ChunkedOutputStream : public OutputStream
+{
+  public:
+    ChunkedOutputStream(MemoryChunkArena* arena = nullptr) : arena_(arena) {}
+
+    virtual ~ChunkedOutputStream() override;
+
+    ChunkedOutputStream(const ChunkedOutputStream&) = delete;
+
+    ChunkedOutputStream& operator=(const ChunkedOutputStream&) = delete;
+
+    // Change the arena that chunks are drawn from. Any data that was written to the stream is discarded.
+    void SetArena(MemoryChunkArena* arena);
+
+    virtual bool IsValid() override { return true; }
+
+    virtual void Clear();
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    size_t GetDataSize() const { return data_size_; }
+
+    // Copy len bytes starting at offset into data. Returns the number of bytes copied, which is less than len when
+    // the range extends past the end of the written data.
+    size_t Read(size_t offset, void* data, size_t len) const;
+
+    // Write len bytes starting at offset to another stream. Returns the number of bytes written.
+    size_t WriteTo(size_t offset, size_t len, OutputStream* stream) const;
+
+  private:
+    size_t GetChunkSize() const;
+
+    MemoryChunkArena* GetArena();
+
+  private:
+    MemoryChunkArena*                 arena_;
+    std::unique_ptr<MemoryChunkArena> private_arena_;
+    std::vector<uint8_t*>             chunks_;
+    size_t                            data_size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CHUNKED_OUTPUT_STREAM_H
@@ -46,10 +46,33 @@ class Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) = 0;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) = 0;
+    virtual size_t Decompress(const size_t          compressed_size,
+                              const uint8_t*        compressed_data,
+                              const size_t          expected_uncompressed_size,
+                              std::vector<uint8_t>* uncompressed_data) = 0;
+
+    // Create a dictionary of up to dictionary_capacity bytes from sample buffers, which are stored consecutively in
+    // samples. Returns false if the compression format does not support dictionaries or training failed.
+    virtual bool TrainDictionary(const std::vector<uint8_t>& samples,
+                                 const std::vector<size_t>&  sample_sizes,
+                                 size_t                      dictionary_capacity,
+                                 std::vector<uint8_t>*       dictionary) const
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(samples);
+        GFXRECON_UNREFERENCED_PARAMETER(sample_sizes);
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary_capacity);
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary);
+        return false;
+    }
+
+    // Use a dictionary for all following compression and decompression. Returns false if the compression format does
+    // not support dictionaries or the dictionary could not be loaded.
+    virtual bool SetDictionary(const uint8_t* dictionary, size_t dictionary_size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary);
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary_size);
+        return false;
+    }
 };
 
 GFXRECON_END_NAMESPACE(util)
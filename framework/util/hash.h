@@ -26,6 +26,8 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -61,6 +63,104 @@ Type GenerateCheckSum(const uint8_t* code, size_t code_size)
     return current_sum;
 }
 
+struct Hash128
+{
+    uint64_t low{ 0 };
+    uint64_t high{ 0 };
+
+    bool operator==(const Hash128& other) const { return (low == other.low) && (high == other.high); }
+    bool operator!=(const Hash128& other) const { return !(*this == other); }
+};
+
+inline uint64_t RotateLeft64(uint64_t value, uint32_t shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+inline uint64_t FinalizeHash64(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+// Non-cryptographic 128-bit hash for identifying duplicate data, based on the MurmurHash3 x64 128-bit hash. Data is
+// processed 16 bytes at a time and read in the host byte order, so hash values must not be written to capture files.
+inline Hash128 GenerateHash128(const uint8_t* data, size_t size, uint64_t seed = 0)
+{
+    const uint64_t c1 = 0x87c37b91114253d5ull;
+    const uint64_t c2 = 0x4cf5ad432745937full;
+
+    uint64_t h1         = seed;
+    uint64_t h2         = seed;
+    size_t   block_size = size & ~static_cast<size_t>(15);
+
+    for (size_t i = 0; i < block_size; i += 16)
+    {
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
+        memcpy(&k1, data + i, sizeof(k1));
+        memcpy(&k2, data + i + sizeof(k1), sizeof(k2));
+
+        k1 *= c1;
+        k1 = RotateLeft64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = RotateLeft64(h1, 27);
+        h1 += h2;
+        h1 = (h1 * 5) + 0x52dce729;
+
+        k2 *= c2;
+        k2 = RotateLeft64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = RotateLeft64(h2, 31);
+        h2 += h1;
+        h2 = (h2 * 5) + 0x38495ab5;
+    }
+
+    size_t tail_size = size - block_size;
+    if (tail_size > 0)
+    {
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
+
+        if (tail_size > sizeof(k1))
+        {
+            memcpy(&k1, data + block_size, sizeof(k1));
+            memcpy(&k2, data + block_size + sizeof(k1), tail_size - sizeof(k1));
+
+            k2 *= c2;
+            k2 = RotateLeft64(k2, 33);
+            k2 *= c1;
+            h2 ^= k2;
+        }
+        else
+        {
+            memcpy(&k1, data + block_size, tail_size);
+        }
+
+        k1 *= c1;
+        k1 = RotateLeft64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+
+    h1 ^= static_cast<uint64_t>(size);
+    h2 ^= static_cast<uint64_t>(size);
+    h1 += h2;
+    h2 += h1;
+    h1 = FinalizeHash64(h1);
+    h2 = FinalizeHash64(h2);
+    h1 += h2;
+    h2 += h1;
+
+    return { h1, h2 };
+}
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
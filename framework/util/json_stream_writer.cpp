@@ -0,0 +1,318 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/json_stream_writer.h"
+
+#include <cassert>
+#include <cmath>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+JsonStreamWriter::JsonStreamWriter(int indent) : indent_(indent) {}
+
+void JsonStreamWriter::Clear()
+{
+    buffer_.clear();
+    scopes_.clear();
+    has_key_ = false;
+}
+
+void JsonStreamWriter::BeginObject()
+{
+    BeginValue();
+    buffer_.push_back('{');
+    scopes_.push_back({ true, true });
+}
+
+void JsonStreamWriter::EndObject()
+{
+    assert(!scopes_.empty() && scopes_.back().is_object && !has_key_);
+
+    bool empty = scopes_.back().empty;
+    scopes_.pop_back();
+
+    if (!empty)
+    {
+        WriteNewLine(scopes_.size());
+    }
+    buffer_.push_back('}');
+}
+
+void JsonStreamWriter::BeginArray()
+{
+    BeginValue();
+    buffer_.push_back('[');
+    scopes_.push_back({ false, true });
+}
+
+void JsonStreamWriter::EndArray()
+{
+    assert(!scopes_.empty() && !scopes_.back().is_object);
+
+    bool empty = scopes_.back().empty;
+    scopes_.pop_back();
+
+    if (!empty)
+    {
+        WriteNewLine(scopes_.size());
+    }
+    buffer_.push_back(']');
+}
+
+void JsonStreamWriter::EndScopes()
+{
+    while (!scopes_.empty())
+    {
+        if (scopes_.back().is_object)
+        {
+            EndObject();
+        }
+        else
+        {
+            EndArray();
+        }
+    }
+}
+
+void JsonStreamWriter::Key(std::string_view key)
+{
+    assert(!scopes_.empty() && scopes_.back().is_object && !has_key_);
+
+    Scope& scope = scopes_.back();
+    if (!scope.empty)
+    {
+        buffer_.push_back(',');
+    }
+    scope.empty = false;
+
+    WriteNewLine(scopes_.size());
+    buffer_.push_back('"');
+    WriteEscaped(key);
+    buffer_.append((indent_ >= 0) ? "\": " : "\":");
+
+    has_key_ = true;
+}
+
+void JsonStreamWriter::Null()
+{
+    BeginValue();
+    buffer_.append("null");
+}
+
+void JsonStreamWriter::Bool(bool value)
+{
+    BeginValue();
+    buffer_.append(value ? "true" : "false");
+}
+
+void JsonStreamWriter::Int(int64_t value)
+{
+    BeginValue();
+
+    // Negate as unsigned, so that the minimum value does not overflow.
+    uint64_t magnitude = static_cast<uint64_t>(value);
+    if (value < 0)
+    {
+        buffer_.push_back('-');
+        magnitude = ~magnitude + 1;
+    }
+
+    char  digits[20];
+    char* end   = digits + sizeof(digits);
+    char* first = end;
+    do
+    {
+        *--first = static_cast<char>('0' + (magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    buffer_.append(first, end);
+}
+
+void JsonStreamWriter::Uint(uint64_t value)
+{
+    BeginValue();
+
+    char  digits[20];
+    char* end   = digits + sizeof(digits);
+    char* first = end;
+    do
+    {
+        *--first = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    buffer_.append(first, end);
+}
+
+void JsonStreamWriter::Double(double value)
+{
+    BeginValue();
+
+    if (!std::isfinite(value))
+    {
+        buffer_.append("null");
+    }
+    else
+    {
+        // The same shortest round-trip formatting that nlohmann::json uses when serializing numbers.
+        char  digits[64];
+        char* end = nlohmann::detail::to_chars(digits, digits + sizeof(digits), value);
+        buffer_.append(digits, end);
+    }
+}
+
+void JsonStreamWriter::String(std::string_view value)
+{
+    BeginValue();
+    buffer_.push_back('"');
+    WriteEscaped(value);
+    buffer_.push_back('"');
+}
+
+void JsonStreamWriter::Json(const nlohmann::ordered_json& value)
+{
+    switch (value.type())
+    {
+        case nlohmann::ordered_json::value_t::object:
+            BeginObject();
+            for (const auto& entry : value.items())
+            {
+                Key(entry.key());
+                Json(entry.value());
+            }
+            EndObject();
+            break;
+        case nlohmann::ordered_json::value_t::array:
+            BeginArray();
+            for (const auto& element : value)
+            {
+                Json(element);
+            }
+            EndArray();
+            break;
+        case nlohmann::ordered_json::value_t::string:
+            String(value.get_ref<const std::string&>());
+            break;
+        case nlohmann::ordered_json::value_t::boolean:
+            Bool(value.get<bool>());
+            break;
+        case nlohmann::ordered_json::value_t::number_integer:
+            Int(value.get<int64_t>());
+            break;
+        case nlohmann::ordered_json::value_t::number_unsigned:
+            Uint(value.get<uint64_t>());
+            break;
+        case nlohmann::ordered_json::value_t::number_float:
+            Double(value.get<double>());
+            break;
+        case nlohmann::ordered_json::value_t::null:
+        case nlohmann::ordered_json::value_t::discarded:
+            Null();
+            break;
+        default:
+            // Binary values are not produced by the JSON consumers, and are left to the library to format.
+            BeginValue();
+            buffer_.append(value.dump(indent_));
+            break;
+    }
+}
+
+void JsonStreamWriter::BeginValue()
+{
+    if (has_key_)
+    {
+        // The separator was written with the key.
+        has_key_ = false;
+    }
+    else if (!scopes_.empty())
+    {
+        Scope& scope = scopes_.back();
+        assert(!scope.is_object);
+
+        if (!scope.empty)
+        {
+            buffer_.push_back(',');
+        }
+        scope.empty = false;
+
+        WriteNewLine(scopes_.size());
+    }
+}
+
+void JsonStreamWriter::WriteNewLine(size_t depth)
+{
+    if (indent_ >= 0)
+    {
+        buffer_.push_back('\n');
+        buffer_.append(depth * static_cast<size_t>(indent_), ' ');
+    }
+}
+
+void JsonStreamWriter::WriteEscaped(std::string_view value)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '\b':
+                buffer_.append("\\b");
+                break;
+            case '\t':
+                buffer_.append("\\t");
+                break;
+            case '\n':
+                buffer_.append("\\n");
+                break;
+            case '\f':
+                buffer_.append("\\f");
+                break;
+            case '\r':
+                buffer_.append("\\r");
+                break;
+            case '"':
+                buffer_.append("\\\"");
+                break;
+            case '\\':
+                buffer_.append("\\\\");
+                break;
+            default:
+                if (static_cast<uint8_t>(c) <= 0x1f)
+                {
+                    buffer_.append("\\u00");
+                    buffer_.push_back(kHexDigits[static_cast<uint8_t>(c) >> 4]);
+                    buffer_.push_back(kHexDigits[static_cast<uint8_t>(c) & 0xf]);
+                }
+                else
+                {
+                    buffer_.push_back(c);
+                }
+                break;
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
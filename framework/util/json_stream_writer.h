@@ -0,0 +1,112 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Streaming JSON output which writes tokens straight into a character
+/// buffer, as an alternative to building a nlohmann::ordered_json tree.
+
+#ifndef GFXRECON_UTIL_JSON_STREAM_WRITER_H
+#define GFXRECON_UTIL_JSON_STREAM_WRITER_H
+
+#include "util/defines.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+/// @brief Writes JSON tokens in document order to a growing character buffer.
+///
+/// The text is byte-identical to the result of nlohmann::ordered_json::dump()
+/// with the same indent for the equivalent tree, so a block can be produced
+/// either way without changing the output. The buffer and the scope stack keep
+/// their capacity across Clear(), so writing a stream of similar blocks does
+/// not allocate once the buffer has grown to the size of the largest block.
+///
+/// Unlike dump(), strings are not validated as UTF-8. Invalid sequences, which
+/// make dump() throw, are copied to the output unchanged.
+class JsonStreamWriter
+{
+  public:
+    /// @param indent Indentation width for pretty printing, or -1 for compact
+    /// output, matching the argument to nlohmann::ordered_json::dump().
+    explicit JsonStreamWriter(int indent = -1);
+
+    void SetIndent(int indent) { indent_ = indent; }
+
+    /// @brief Discard the written text and any open scopes, retaining the allocated memory.
+    void Clear();
+
+    const std::string& GetText() const { return buffer_; }
+
+    bool IsComplete() const { return scopes_.empty() && !buffer_.empty(); }
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    /// @brief Close all open objects and arrays.
+    void EndScopes();
+
+    /// @brief Write the key for the next value of the current object.
+    void Key(std::string_view key);
+
+    void Null();
+    void Bool(bool value);
+    void Int(int64_t value);
+    void Uint(uint64_t value);
+    void Double(double value);
+    void String(std::string_view value);
+
+    /// @brief Write an existing tree as the next value.
+    void Json(const nlohmann::ordered_json& value);
+
+  private:
+    struct Scope
+    {
+        bool is_object;
+        bool empty;
+    };
+
+  private:
+    void BeginValue();
+
+    void WriteNewLine(size_t depth);
+
+    void WriteEscaped(std::string_view value);
+
+  private:
+    std::string        buffer_;
+    std::vector<Scope> scopes_;
+    int                indent_;
+    bool               has_key_{ false };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_JSON_STREAM_WRITER_H
@@ -28,6 +28,7 @@
 #include "format/format_json.h"
 
 #include <codecvt> // For encoding wstring_view to utf8.
+#include <optional>
 
 #if defined(D3D12_SUPPORT)
 #include <winerror.h> // D3D12 and DXGI HRESULT return values.
@@ -143,7 +144,8 @@ void FieldToJson(nlohmann::ordered_json& jdata, const std::nullptr_t data, const
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& options)
+/// Adjust floats with no JSON number type representation, logging the information loss.
+static float AdjustUnrepresentableFloat(float data)
 {
     if (std::isnan(data))
     {
@@ -164,7 +166,12 @@ void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& o
     }
     // Normal and denormal/subnormal numbers pass through unchanged and unremarked.
 
-    jdata = data;
+    return data;
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& options)
+{
+    jdata = AdjustUnrepresentableFloat(data);
 }
 
 void FieldToJson(nlohmann::ordered_json& jdata, double data, const util::JsonOptions& options)
@@ -177,6 +184,118 @@ void FieldToJson(nlohmann::ordered_json& jdata, const std::string_view data, con
     jdata = data;
 }
 
+void FieldToJson(JsonStreamWriter& stream, short data, const JsonOptions& options)
+{
+    stream.Int(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, int data, const JsonOptions& options)
+{
+    stream.Int(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, long data, const JsonOptions& options)
+{
+    stream.Int(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, long long data, const JsonOptions& options)
+{
+    stream.Int(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, unsigned short data, const JsonOptions& options)
+{
+    stream.Uint(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, unsigned int data, const JsonOptions& options)
+{
+    stream.Uint(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, unsigned long data, const JsonOptions& options)
+{
+    stream.Uint(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, unsigned long long data, const JsonOptions& options)
+{
+    stream.Uint(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, const std::nullptr_t data, const JsonOptions& options)
+{
+    stream.Null();
+}
+
+void FieldToJson(JsonStreamWriter& stream, float data, const JsonOptions& options)
+{
+    stream.Double(AdjustUnrepresentableFloat(data));
+}
+
+void FieldToJson(JsonStreamWriter& stream, double data, const JsonOptions& options)
+{
+    stream.Double(data);
+}
+
+void FieldToJson(JsonStreamWriter& stream, const std::string_view data, const JsonOptions& options)
+{
+    stream.String(data);
+}
+
+void HandleToJson(JsonStreamWriter& stream, const format::HandleId handle, const JsonOptions& options)
+{
+    if (options.hex_handles)
+    {
+        stream.String(util::to_hex_variable_width(handle));
+    }
+    else
+    {
+        stream.Uint(handle);
+    }
+}
+
+void Bool32ToJson(JsonStreamWriter& stream, const uint32_t data, const JsonOptions& options)
+{
+    stream.Bool(static_cast<bool>(data));
+}
+
+void FieldToJson(JsonStreamWriter& stream, const float data[4], const JsonOptions& options)
+{
+    FieldToJson(stream, data, 4, options);
+}
+
+void FieldToJson(JsonStreamWriter& stream, const uint32_t data[4], const JsonOptions& options)
+{
+    FieldToJson(stream, data, 4, options);
+}
+
+void FieldToJson(JsonStreamWriter& stream, const uint64_t data[4], const JsonOptions& options)
+{
+    FieldToJson(stream, data, 4, options);
+}
+
+void HandleToJson(JsonStreamWriter&       stream,
+                  const format::HandleId* data,
+                  size_t                  num_elements,
+                  const JsonOptions&      options)
+{
+    if (data && (num_elements > 0))
+    {
+        stream.BeginArray();
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            HandleToJson(stream, data[i], options);
+        }
+        stream.EndArray();
+    }
+    else
+    {
+        stream.Null();
+    }
+}
+
 void FieldToJson(nlohmann::ordered_json& jdata, const std::wstring_view data, const util::JsonOptions& options)
 {
 #if defined(__clang__)
@@ -190,6 +309,19 @@ void FieldToJson(nlohmann::ordered_json& jdata, const std::wstring_view data, co
     jdata = utf8_conv.to_bytes(data.data(), data.data() + data.length());
 }
 
+void FieldToJson(JsonStreamWriter& stream, const std::wstring_view data, const JsonOptions& options)
+{
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+#endif
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> utf8_conv;
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+    stream.String(utf8_conv.to_bytes(data.data(), data.data() + data.length()));
+}
+
 #if defined(D3D12_SUPPORT)
 
 // const char * might be better to avoid two copies of each string in the process at runtime (one in the static data
@@ -275,6 +407,11 @@ void HresultToJson(nlohmann::ordered_json& jdata, const HRESULT hresult, const u
     FieldToJson(jdata, HresultToString(hresult), options);
 }
 
+void HresultToJson(JsonStreamWriter& stream, const HRESULT hresult, const util::JsonOptions& options)
+{
+    FieldToJson(stream, HresultToString(hresult), options);
+}
+
 void FieldToJson(nlohmann::ordered_json&                                  jdata,
                  const format::InitDx12AccelerationStructureGeometryDesc& data,
                  const util::JsonOptions&                                 options)
@@ -371,6 +508,34 @@ static bool WriteBinaryFile(const std::string& filename, uint64_t data_size, con
     return written_all;
 }
 
+/// Write the binary file if requested and return the text which represents it, or nullopt for null or empty data.
+static std::optional<std::string> RepresentBinaryFileText(const util::JsonOptions& json_options,
+                                                          std::string_view         filename_base,
+                                                          const uint64_t           instance_counter,
+                                                          const uint64_t           data_size,
+                                                          const uint8_t* const     data,
+                                                          bool&                    written)
+{
+    written = false;
+    if (data_size < 1 || nullptr == data)
+    {
+        return std::nullopt;
+    }
+    if (json_options.dump_binaries)
+    {
+        std::string filename = GenerateFilename(filename_base, instance_counter);
+        std::string basename = gfxrecon::util::filepath::Join(json_options.data_sub_dir, filename);
+        std::string filepath = gfxrecon::util::filepath::Join(json_options.root_dir, basename);
+        if (WriteBinaryFile(filepath, data_size, data))
+        {
+            written = true;
+            return basename;
+        }
+        return std::string(format::kValWriteFailed);
+    }
+    return std::string(format::kValBinary);
+}
+
 bool RepresentBinaryFile(const util::JsonOptions& json_options,
                          nlohmann::ordered_json&  jdata,
                          std::string_view         filename_base,
@@ -380,31 +545,37 @@ bool RepresentBinaryFile(const util::JsonOptions& json_options,
 {
     bool written = false;
     // If the data is null or empty, put a null in the JSON.
-    if (data_size < 1 || nullptr == data)
+    const auto text =
+        RepresentBinaryFileText(json_options, filename_base, instance_counter, data_size, data, written);
+    if (text)
+    {
+        FieldToJson(jdata, *text, json_options);
+    }
+    else
     {
         FieldToJson(jdata, nullptr, json_options);
     }
+    return written;
+}
+
+bool RepresentBinaryFile(const util::JsonOptions& json_options,
+                         JsonStreamWriter&        stream,
+                         std::string_view         filename_base,
+                         const uint64_t           instance_counter,
+                         const uint64_t           data_size,
+                         const uint8_t* const     data)
+{
+    bool written = false;
+    // If the data is null or empty, write a null.
+    const auto text =
+        RepresentBinaryFileText(json_options, filename_base, instance_counter, data_size, data, written);
+    if (text)
+    {
+        FieldToJson(stream, *text, json_options);
+    }
     else
     {
-        if (json_options.dump_binaries)
-        {
-            std::string filename = GenerateFilename(filename_base, instance_counter);
-            std::string basename = gfxrecon::util::filepath::Join(json_options.data_sub_dir, filename);
-            std::string filepath = gfxrecon::util::filepath::Join(json_options.root_dir, basename);
-            if (WriteBinaryFile(filepath, data_size, data))
-            {
-                FieldToJson(jdata, basename, json_options);
-                written = true;
-            }
-            else
-            {
-                FieldToJson(jdata, format::kValWriteFailed, json_options);
-            }
-        }
-        else
-        {
-            FieldToJson(jdata, format::kValBinary, json_options);
-        }
+        FieldToJson(stream, nullptr, json_options);
     }
     return written;
 }
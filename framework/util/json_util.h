@@ -29,6 +29,7 @@
 #define GFXRECON_UTIL_JSON_UTIL_H
 
 #include "util/defines.h"
+#include "util/json_stream_writer.h"
 #include "util/to_string.h"
 #include "format/format.h"
 
@@ -42,7 +43,8 @@ static constexpr int kJsonIndentWidth = 2;
 /// This selects between outputting an array of objects (JSON) or individual
 /// top-level objects separated by newlines (JSONL). A top-level component
 /// like Convert's main() needs to look at this but the FieldToJson functions
-/// ignore it. They build a nlohmann tree in memory.
+/// ignore it. They either build a nlohmann tree in memory or write tokens to a
+/// JsonStreamWriter.
 enum class JsonFormat : uint8_t
 {
     JSON,
@@ -158,6 +160,70 @@ void HandleToJson(nlohmann::ordered_json&  jdata,
                   size_t                   num_elements,
                   const util::JsonOptions& options = util::JsonOptions());
 
+/// @defgroup JsonStreamFieldToJson Conversions which write straight to a JsonStreamWriter rather
+/// than assigning to a tree. The text produced is identical to that of the overloads above. Each
+/// conversion writes exactly one value, writing a null where the tree version leaves its node
+/// untouched, so that a key written before the call is always given a value.
+/// @{
+void FieldToJson(JsonStreamWriter& stream, short data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, int data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, long data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, long long data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, unsigned short data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, unsigned int data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, unsigned long data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, unsigned long long data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, const std::nullptr_t data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, float data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, double data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, const std::string_view data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, const std::wstring_view data, const JsonOptions& options = JsonOptions());
+void HandleToJson(JsonStreamWriter& stream, const format::HandleId handle, const JsonOptions& options);
+void Bool32ToJson(JsonStreamWriter& stream, const uint32_t data, const JsonOptions& options = JsonOptions());
+
+template <typename T>
+void FieldToJsonAsHex(JsonStreamWriter& stream, const T data, const JsonOptions& options = JsonOptions())
+{
+    stream.String(to_hex_variable_width(data));
+}
+
+template <typename T>
+void FieldToJsonAsFixedWidthBinary(JsonStreamWriter& stream, const T data, const JsonOptions& options = JsonOptions())
+{
+    stream.String(to_binary_fixed_width(data));
+}
+
+template <typename T>
+void FieldToJson(JsonStreamWriter&  stream,
+                 const T*           data,
+                 size_t             num_elements,
+                 const JsonOptions& options = JsonOptions())
+{
+    // The tree version leaves the node null for an empty array.
+    if (data && (num_elements > 0))
+    {
+        stream.BeginArray();
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            FieldToJson(stream, data[i], options);
+        }
+        stream.EndArray();
+    }
+    else
+    {
+        stream.Null();
+    }
+}
+
+void FieldToJson(JsonStreamWriter& stream, const float data[4], const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, const uint32_t data[4], const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& stream, const uint64_t data[4], const JsonOptions& options = JsonOptions());
+void HandleToJson(JsonStreamWriter&       stream,
+                  const format::HandleId* data,
+                  size_t                  num_elements,
+                  const JsonOptions&      options = JsonOptions());
+/// @}
+
 #if defined(D3D12_SUPPORT)
 /// @brief Turn a D3D12 or DXGI HRESULT into a string with the same character
 /// sequence as the identifier of the C macro defining it in a header like
@@ -165,6 +231,7 @@ void HandleToJson(nlohmann::ordered_json&  jdata,
 /// @param hresult A D3D12 or DXGI result code.
 std::string HresultToString(const HRESULT hresult);
 void        HresultToJson(nlohmann::ordered_json& jdata, const HRESULT hresult, const util::JsonOptions& options);
+void        HresultToJson(JsonStreamWriter& stream, const HRESULT hresult, const util::JsonOptions& options);
 
 void FieldToJson(nlohmann::ordered_json&                                  jdata,
                  const format::InitDx12AccelerationStructureGeometryDesc& data,
@@ -184,6 +251,14 @@ bool RepresentBinaryFile(const util::JsonOptions& json_options,
                          const uint64_t           data_size,
                          const uint8_t* const     data);
 
+/// Stream version of RepresentBinaryFile() writing the filename, placeholder text or null as the next value.
+bool RepresentBinaryFile(const util::JsonOptions& json_options,
+                         JsonStreamWriter&        stream,
+                         std::string_view         filename_base,
+                         const uint64_t           instance_counter,
+                         const uint64_t           data_size,
+                         const uint8_t* const     data);
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -29,6 +29,16 @@
 
 #include "lz4.h"
 
+// The high compression API is not included with all of the precompiled LZ4 packages.
+#if defined(__has_include)
+#if __has_include("lz4hc.h")
+#include "lz4hc.h"
+#define GFXRECON_ENABLE_LZ4_HC_COMPRESSION
+#endif
+#endif
+
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
@@ -51,12 +61,31 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
         compressed_data->resize(compressed_data_offset + lz4_compressed_size);
     }
 
-    int compressed_size_generated =
-        LZ4_compress_fast(reinterpret_cast<const char*>(uncompressed_data),
-                          reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                          static_cast<const int32_t>(uncompressed_size),
-                          static_cast<int32_t>(lz4_compressed_size),
-                          1);
+    int compressed_size_generated = 0;
+
+    if (compression_level_ > 0)
+    {
+#if defined(GFXRECON_ENABLE_LZ4_HC_COMPRESSION)
+        compressed_size_generated =
+            LZ4_compress_HC(reinterpret_cast<const char*>(uncompressed_data),
+                            reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                            static_cast<const int32_t>(uncompressed_size),
+                            static_cast<int32_t>(lz4_compressed_size),
+                            std::min(compression_level_, LZ4HC_CLEVEL_MAX));
+#else
+        GFXRECON_LOG_WARNING_ONCE("LZ4 high compression mode is not available; using the fast compression mode");
+#endif
+    }
+
+    if (compressed_size_generated <= 0)
+    {
+        compressed_size_generated =
+            LZ4_compress_fast(reinterpret_cast<const char*>(uncompressed_data),
+                              reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                              static_cast<const int32_t>(uncompressed_size),
+                              static_cast<int32_t>(lz4_compressed_size),
+                              1);
+    }
 
     if (compressed_size_generated > 0)
     {
@@ -66,10 +95,10 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t Lz4Compressor::Decompress(const size_t                compressed_size,
-                                 const std::vector<uint8_t>& compressed_data,
-                                 const size_t                expected_uncompressed_size,
-                                 std::vector<uint8_t>*       uncompressed_data)
+size_t Lz4Compressor::Decompress(const size_t          compressed_size,
+                                 const uint8_t*        compressed_data,
+                                 const size_t          expected_uncompressed_size,
+                                 std::vector<uint8_t>* uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -78,7 +107,7 @@ size_t Lz4Compressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data.data()),
+    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data),
                                                           reinterpret_cast<char*>(uncompressed_data->data()),
                                                           static_cast<int32_t>(compressed_size),
                                                           static_cast<int32_t>(expected_uncompressed_size));
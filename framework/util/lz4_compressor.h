@@ -32,7 +32,13 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class Lz4Compressor : public Compressor
 {
   public:
-    Lz4Compressor() {}
+    // A compression level of 0 uses the fast compression mode. Levels greater than 0 select the high compression mode
+    // with the given level.
+    static const int32_t kDefaultCompressionLevel = 0;
+
+    explicit Lz4Compressor(int32_t compression_level = kDefaultCompressionLevel) :
+        compression_level_(compression_level)
+    {}
 
     virtual ~Lz4Compressor() override {}
 
@@ -41,10 +47,13 @@ class Lz4Compressor : public Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    virtual size_t Decompress(const size_t          compressed_size,
+                              const uint8_t*        compressed_data,
+                              const size_t          expected_uncompressed_size,
+                              std::vector<uint8_t>* uncompressed_data) override;
+
+  private:
+    int32_t compression_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
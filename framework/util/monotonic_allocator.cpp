@@ -23,6 +23,8 @@
 
 #include "util/monotonic_allocator.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
@@ -31,10 +33,27 @@ void MonotonicAllocator::Clear(bool free_system_memory)
     // Call destructors of allocated objects
     for (auto destructor : destructors_)
     {
-        destructor.destroy(destructor.obj);
+        destructor.destroy(destructor.obj, destructor.count);
     }
     destructors_.clear();
 
+    // Grow the block size to fit the memory allocated since the last Clear in one block, up to the maximum size.
+    if ((allocated_bytes_ > block_size_) && (block_size_ < max_block_size_))
+    {
+        size_t block_size = block_size_;
+        while ((block_size < allocated_bytes_) && (block_size < max_block_size_))
+        {
+            block_size *= 2;
+        }
+
+        block_size_ = std::min(block_size, max_block_size_);
+
+        // Existing blocks are smaller than the new size.
+        free_system_memory = true;
+    }
+
+    allocated_bytes_ = 0;
+
     // Free memory blocks
     if (free_system_memory)
     {
@@ -59,6 +78,9 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
         return nullptr;
     }
 
+    // Include the worst case alignment padding, so that the total is enough to fit the allocations in one block.
+    allocated_bytes_ += object_bytes + alignment_bytes;
+
     if (object_bytes <= block_size_)
     {
         // Try to allocate to an existing block
@@ -26,7 +26,9 @@
 
 #include "util/defines.h"
 
+#include <cassert>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -38,9 +40,12 @@ class MonotonicAllocator
   public:
     // block_size is the size of the individual memory blocks allocated. The number of blocks increases as needed to
     // fit requested allocations, and blocks are freed using an appropriate call to Clear or upon destruction of this
-    // MonotonicAllocator
-    MonotonicAllocator(size_t block_size) :
-        block_size_(block_size), current_block_(0), current_block_free_bytes_(block_size)
+    // MonotonicAllocator. If max_block_size is greater than block_size, Clear increases the block size, up to
+    // max_block_size, when the memory allocated since the previous Clear did not fit in one block, so that a
+    // repeating pattern of allocations is served from a single block without oversized allocations.
+    MonotonicAllocator(size_t block_size, size_t max_block_size = 0) :
+        block_size_(block_size), max_block_size_(max_block_size), current_block_(0),
+        current_block_free_bytes_(block_size), allocated_bytes_(0)
     {}
 
     ~MonotonicAllocator() { Clear(true); }
@@ -55,13 +60,14 @@ class MonotonicAllocator
         assert(result != nullptr);
         if ((result != nullptr) && initialize)
         {
-            for (size_t i = 0; i < count; ++i)
+            // Value-initialize the whole array at once, which is a single fill for trivial types.
+            std::uninitialized_value_construct_n(result, count);
+
+            if constexpr (!std::is_trivially_destructible<T>::value)
             {
-                T* obj = new (result + i) T();
-                if (!std::is_trivially_destructible<T>())
-                {
-                    destructors_.push_back({ obj, [](const void* x) { static_cast<const T*>(x)->~T(); } });
-                }
+                // A single record destroys the whole array.
+                destructors_.push_back(
+                    { result, count, [](void* x, size_t n) { std::destroy_n(static_cast<T*>(x), n); } });
             }
         }
         assert(!(reinterpret_cast<uintptr_t>(result) % std::alignment_of<T>::value) &&
@@ -69,6 +75,8 @@ class MonotonicAllocator
         return result;
     }
 
+    size_t GetBlockSize() const { return block_size_; }
+
     // "Frees" all previously allocated objects. Depending on free_system_memory, system memory blocks are either
     // reused for new calls to Allocate or freed and re-created as needed. Oversized allocations are freed from system
     // memory
@@ -81,17 +89,20 @@ class MonotonicAllocator
   private:
     struct Destructor
     {
-        void* obj;
-        void (*destroy)(const void*);
+        void*  obj;
+        size_t count;
+        void (*destroy)(void*, size_t);
     };
 
   private:
     std::vector<std::unique_ptr<unsigned char[]>> memory_blocks_;
     std::vector<std::unique_ptr<unsigned char[]>> oversized_allocations_;
     std::vector<Destructor>                       destructors_;
-    const size_t                                  block_size_;
+    size_t                                        block_size_;
+    const size_t                                  max_block_size_;
     size_t                                        current_block_;
     size_t                                        current_block_free_bytes_;
+    size_t                                        allocated_bytes_; // Bytes allocated since the last call to Clear.
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -27,12 +27,20 @@
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstring>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Page diffing compares modified pages with their snapshot in chunks of this size. Unchanged gaps smaller than the
+// minimum gap size are written with the surrounding changes, because a separate fill memory command for each side of
+// the gap would add more header data than the gap contains.
+const size_t kPageDiffChunkSize  = 64;
+const size_t kPageDiffMinGapSize = 128;
+
 #if defined(WIN32)
 #if !defined(WIN32_LEAN_AND_MEAN)
 #define WIN32_LEAN_AND_MEAN
@@ -222,6 +230,7 @@ PageGuardManager::PageGuardManager() :
                      kDefaultEnableSignalHandlerWatcher,
                      kDefaultSignalHandlerWatcherMaxRestores,
                      kDefaultEnableReadWriteSamePage,
+                     kDefaultEnablePageDiffing,
                      kDefaultMemoryProtMode)
 {}
 
@@ -231,12 +240,13 @@ PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
                                    bool                 unblock_SIGSEGV,
                                    bool                 enable_signal_handler_watcher,
                                    int                  signal_handler_watcher_max_restores,
+                                   bool                 enable_page_diffing,
                                    MemoryProtectionMode protection_mode) :
     exception_handler_(nullptr),
     exception_handler_count_(0), system_page_size_(util::platform::GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(enable_copy_on_map),
     enable_separate_read_(enable_separate_read), unblock_sigsegv_(unblock_SIGSEGV),
-    enable_signal_handler_watcher_(enable_signal_handler_watcher),
+    enable_page_diffing_(enable_page_diffing), enable_signal_handler_watcher_(enable_signal_handler_watcher),
     signal_handler_watcher_max_restores_(signal_handler_watcher_max_restores),
     enable_read_write_same_page_(expect_read_write_same_page), protection_mode_(protection_mode)
 {
@@ -360,6 +370,7 @@ void PageGuardManager::Create(bool                 enable_copy_on_map,
                               bool                 unblock_SIGSEGV,
                               bool                 enable_signal_handler_watcher,
                               int                  signal_handler_watcher_max_restores,
+                              bool                 enable_page_diffing,
                               MemoryProtectionMode protection_mode)
 {
     if (instance_ == nullptr)
@@ -370,6 +381,7 @@ void PageGuardManager::Create(bool                 enable_copy_on_map,
                                          unblock_SIGSEGV,
                                          enable_signal_handler_watcher,
                                          signal_handler_watcher_max_restores,
+                                         enable_page_diffing,
                                          protection_mode);
 
 #if !defined(WIN32)
@@ -867,7 +879,8 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
 
         // The shadow memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
-        handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
+        ProcessModifiedRange(
+            memory_id, memory_info, memory_info->shadow_memory, page_offset, page_range, handle_modified);
 
         if (kMProtectMode == protection_mode_)
         {
@@ -908,7 +921,82 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
 
         // The mapped memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
-        handle_modified(memory_id, memory_info->mapped_memory, page_offset, page_range);
+        ProcessModifiedRange(
+            memory_id, memory_info, memory_info->mapped_memory, page_offset, page_range, handle_modified);
+    }
+}
+
+void PageGuardManager::ProcessModifiedRange(uint64_t                  memory_id,
+                                            MemoryInfo*               memory_info,
+                                            void*                     memory,
+                                            size_t                    offset,
+                                            size_t                    size,
+                                            const ModifiedMemoryFunc& handle_modified)
+{
+    assert((memory_info != nullptr) && (memory != nullptr));
+
+    if (memory_info->snapshot == nullptr)
+    {
+        handle_modified(memory_id, memory, offset, size);
+        return;
+    }
+
+    // Only the parts of the modified pages that differ from the snapshot are passed to the callback. Pages that have
+    // not been written before are passed in full. The snapshot is updated before the callback is invoked, so that a
+    // write that is made while the data is being processed is detected by the next comparison.
+    const uint8_t* current     = static_cast<const uint8_t*>(memory);
+    uint8_t*       snapshot    = memory_info->snapshot.get();
+    const size_t   end         = offset + size;
+    size_t         position    = offset;
+    size_t         range_start = 0;
+    size_t         range_end   = 0;
+    bool           in_range    = false;
+
+    while (position < end)
+    {
+        // Offsets are relative to the start of the tracked memory, which is aligned_offset bytes into its first page.
+        const size_t page_index = (position + memory_info->aligned_offset) >> system_page_pot_shift_;
+        const size_t page_end =
+            std::min(((page_index + 1) << system_page_pot_shift_) - memory_info->aligned_offset, end);
+
+        size_t chunk_end = page_end;
+        bool   changed   = true;
+
+        if (memory_info->snapshot_loaded[page_index])
+        {
+            chunk_end = std::min(position + kPageDiffChunkSize, page_end);
+            changed   = (memcmp(current + position, snapshot + position, chunk_end - position) != 0);
+        }
+        else
+        {
+            memory_info->snapshot_loaded[page_index] = true;
+        }
+
+        if (changed)
+        {
+            if (!in_range)
+            {
+                in_range    = true;
+                range_start = position;
+            }
+
+            range_end = chunk_end;
+        }
+        else if (in_range && ((chunk_end - range_end) >= kPageDiffMinGapSize))
+        {
+            in_range = false;
+
+            MemoryCopy(snapshot + range_start, current + range_start, range_end - range_start);
+            handle_modified(memory_id, memory, range_start, range_end - range_start);
+        }
+
+        position = chunk_end;
+    }
+
+    if (in_range)
+    {
+        MemoryCopy(snapshot + range_start, current + range_start, range_end - range_start);
+        handle_modified(memory_id, memory, range_start, range_end - range_start);
     }
 }
 
@@ -1134,6 +1222,13 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                                                            use_write_watch,
                                                            shadow_memory_handle == kNullShadowHandle));
 
+            if (entry.second && enable_page_diffing_)
+            {
+                // The snapshot is loaded as pages are written to the capture file.
+                entry.first->second.snapshot        = std::make_unique<uint8_t[]>(mapped_range);
+                entry.first->second.snapshot_loaded = std::vector<bool>(total_pages, false);
+            }
+
             if (!entry.second)
             {
                 if (!use_write_watch)
@@ -1276,6 +1371,21 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     }
 }
 
+void PageGuardManager::InvalidatePageSnapshots()
+{
+    if (!enable_page_diffing_)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    for (auto& entry : memory_info_)
+    {
+        std::fill(entry.second.snapshot_loaded.begin(), entry.second.snapshot_loaded.end(), false);
+    }
+}
+
 bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bool clear_guard)
 {
     assert(protection_mode_ == kMProtectMode);
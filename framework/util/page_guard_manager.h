@@ -73,6 +73,7 @@ class PageGuardManager
     static const bool                 kDefaultUnblockSIGSEGV                  = false;
     static const bool                 kDefaultEnableSignalHandlerWatcher      = false;
     static const int                  kDefaultSignalHandlerWatcherMaxRestores = 1;
+    static const bool                 kDefaultEnablePageDiffing               = false;
     static const MemoryProtectionMode kDefaultMemoryProtMode                  = kMProtectMode;
 
     static const uintptr_t kNullShadowHandle = 0;
@@ -90,6 +91,7 @@ class PageGuardManager
                        bool                 unblock_SIGSEGV,
                        bool                 enable_signal_handler_watcher,
                        int                  signal_handler_watcher_max_restores,
+                       bool                 enable_page_diffing,
                        MemoryProtectionMode protection_mode);
 
     static void Destroy();
@@ -126,6 +128,11 @@ class PageGuardManager
 
     void ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified);
 
+    // Marks the page diffing snapshots of all tracked memory as not loaded, so that the next modification of each page
+    // is passed to the callback in full. Used when the data processed since the snapshots were loaded was not written
+    // to the current capture file.
+    void InvalidatePageSnapshots();
+
     bool HandleGuardPageViolation(void* address, bool is_write, bool clear_guard);
 
     size_t GetAlignedSize(size_t size) const;
@@ -154,6 +161,7 @@ class PageGuardManager
                      bool                 unblock_SIGSEGV,
                      bool                 enable_signal_handler_watcher,
                      int                  signal_handler_watcher_max_restores,
+                     bool                 enable_page_diffing,
                      MemoryProtectionMode protection_mode);
 
     ~PageGuardManager();
@@ -204,6 +212,11 @@ class PageGuardManager
         bool        is_modified;
         bool        own_shadow_memory;
 
+        // Copy of the tracked memory as it was last written to the capture file, for page diffing. A page is only
+        // compared with the snapshot after it has been written once, as indicated by snapshot_loaded.
+        std::unique_ptr<uint8_t[]> snapshot;
+        std::vector<bool>          snapshot_loaded;
+
 #if USERFAULTFD_SUPPORTED == 1
         // Keep a list of all the threads that accessed this region. Only useful for Userfaultfd method
         std::unordered_set<uint64_t> uffd_fault_causing_threads;
@@ -250,6 +263,12 @@ class PageGuardManager
                               size_t                    start_index,
                               size_t                    end_index,
                               const ModifiedMemoryFunc& handle_modified);
+    void   ProcessModifiedRange(uint64_t                  memory_id,
+                                MemoryInfo*               memory_info,
+                                void*                     memory,
+                                size_t                    offset,
+                                size_t                    size,
+                                const ModifiedMemoryFunc& handle_modified);
 
     size_t GetOffsetFromPageStart(void* address) const
     {
@@ -273,6 +292,7 @@ class PageGuardManager
     const bool               enable_copy_on_map_;
     const bool               enable_separate_read_;
     const bool               unblock_sigsegv_;
+    const bool               enable_page_diffing_;
     bool                     enable_signal_handler_watcher_;
     int                      signal_handler_watcher_max_restores_;
 
@@ -216,6 +216,12 @@ inline int32_t MakeDirectory(const char* filename)
     return _mkdir(filename);
 }
 
+// Renames a file, replacing any existing file with the new name.
+inline bool FileReplace(const char* old_filename, const char* new_filename)
+{
+    return MoveFileExA(old_filename, new_filename, MOVEFILE_REPLACE_EXISTING) != FALSE;
+}
+
 inline size_t GetSystemPageSize()
 {
     SYSTEM_INFO sSysInfo;
@@ -250,6 +256,41 @@ inline void FreeRawMemory(void* memory, size_t aligned_size)
     VirtualFree(memory, 0, MEM_RELEASE);
 }
 
+// Memory mapping of files for reading is not currently implemented for Windows; callers fall back to FileRead().
+inline void* MapFile(FILE* stream, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(stream);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return nullptr;
+}
+
+inline void UnmapFile(void* memory, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+}
+
+inline void AdviseSequentialAccess(void* memory, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+}
+
+inline void AdviseWillNeed(void* memory, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+}
+
+// In-kernel file copies are not currently implemented for Windows; callers fall back to FileRead() and FileWrite().
+inline uint64_t FileCopyRange(FILE* source, FILE* destination, uint64_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(source);
+    GFXRECON_UNREFERENCED_PARAMETER(destination);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return 0;
+}
+
 inline int GetSystemLastErrorCode()
 {
     return GetLastError();
@@ -506,6 +547,12 @@ inline int32_t MakeDirectory(const char* filename)
     return mkdir(filename, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
 }
 
+// Renames a file, replacing any existing file with the new name. The replacement is atomic.
+inline bool FileReplace(const char* old_filename, const char* new_filename)
+{
+    return rename(old_filename, new_filename) == 0;
+}
+
 inline size_t GetSystemPageSize()
 {
     return getpagesize();
@@ -539,6 +586,92 @@ inline void FreeRawMemory(void* memory, size_t aligned_size)
     munmap(memory, aligned_size);
 }
 
+// Map an entire file for reading. The mapping is private and copy-on-write, so the file is never modified.
+inline void* MapFile(FILE* stream, size_t size)
+{
+    assert((stream != nullptr) && (size > 0));
+
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(stream), 0);
+
+    if (memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    return memory;
+}
+
+inline void UnmapFile(void* memory, size_t size)
+{
+    assert(memory != nullptr);
+
+    munmap(memory, size);
+}
+
+inline void AdviseSequentialAccess(void* memory, size_t size)
+{
+    madvise(memory, size, MADV_SEQUENTIAL);
+}
+
+// Request read-ahead for a range of a mapping. The start of the range is rounded down to a page boundary.
+inline void AdviseWillNeed(void* memory, size_t size)
+{
+    const uintptr_t page_mask = static_cast<uintptr_t>(getpagesize()) - 1;
+    const uintptr_t address   = reinterpret_cast<uintptr_t>(memory);
+    const uintptr_t start     = address & ~page_mask;
+
+    madvise(reinterpret_cast<void*>(start), size + (address - start), MADV_WILLNEED);
+}
+
+// Copy up to size bytes from the current position of source to the current position of destination without passing
+// the data through user space, and advance both streams past the copied data. Returns the number of bytes copied,
+// which is less than size if the end of the source is reached, or if the copy cannot be performed by the kernel. Only
+// implemented for Linux; callers fall back to FileRead() and FileWrite() to copy any remaining bytes.
+inline uint64_t FileCopyRange(FILE* source, FILE* destination, uint64_t size)
+{
+    uint64_t copied = 0;
+
+#if defined(__linux__) && !defined(__ANDROID__)
+    // Synchronize the file descriptors with the buffered stream positions.
+    off_t source_offset = ftello(source);
+    if ((source_offset >= 0) && (fflush(destination) == 0))
+    {
+        const int source_fd          = fileno(source);
+        const int destination_fd     = fileno(destination);
+        off_t     destination_offset = ftello(destination);
+
+        if ((destination_offset >= 0) && (lseek(destination_fd, destination_offset, SEEK_SET) == destination_offset))
+        {
+            // The length of a single copy is limited, as lengths past the maximum file offset are rejected.
+            const uint64_t kMaxCopySize = 1ull << 30;
+
+            while (copied < size)
+            {
+                const uint64_t remaining = size - copied;
+                const size_t   length    = static_cast<size_t>((remaining < kMaxCopySize) ? remaining : kMaxCopySize);
+                ssize_t        result = copy_file_range(source_fd, &source_offset, destination_fd, nullptr, length, 0);
+                if (result <= 0)
+                {
+                    break;
+                }
+
+                copied += static_cast<uint64_t>(result);
+            }
+
+            // The kernel advanced the destination descriptor; reposition the streams to match.
+            fseeko(source, source_offset, SEEK_SET);
+            fseeko(destination, lseek(destination_fd, 0, SEEK_CUR), SEEK_SET);
+        }
+    }
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(source);
+    GFXRECON_UNREFERENCED_PARAMETER(destination);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+#endif
+
+    return copied;
+}
+
 inline int GetSystemLastErrorCode()
 {
     return errno;
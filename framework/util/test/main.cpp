@@ -25,14 +25,31 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
 #include "util/to_string.h"
+#include "util/async_file_output_stream.h"
+#include "util/chunked_output_stream.h"
 #include "util/strings.h"
 #include "util/date_time.h"
+#include "util/hash.h"
+#include "util/json_stream_writer.h"
 #include "util/logging.h"
+#include "util/memory_output_stream.h"
+#include "util/monotonic_allocator.h"
 #include "generated/generated_vulkan_enum_to_string.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace gfxrecon::util::strings;
 using namespace gfxrecon::util::datetime;
 
@@ -403,3 +420,480 @@ TEST_CASE("UtcString", "[datetime]")
 
     gfxrecon::util::Log::Release();
 }
+
+TEST_CASE("JsonStreamWriter", "[json]")
+{
+    using gfxrecon::util::JsonStreamWriter;
+
+    nlohmann::ordered_json tree;
+    tree["index"]            = 42u;
+    tree["negative"]         = -9223372036854775807ll - 1;
+    tree["max"]              = 18446744073709551615ull;
+    tree["float"]            = 0.1f;
+    tree["double"]           = 1e-300;
+    tree["infinity"]         = std::numeric_limits<double>::infinity();
+    tree["flag"]             = false;
+    tree["none"]             = nullptr;
+    tree["escapes"]          = "\"\\\b\f\n\r\t\x01\x1f\x7f £";
+    tree["empty_object"]     = nlohmann::ordered_json::object();
+    tree["empty_array"]      = nlohmann::ordered_json::array();
+    tree["nested"]["array"]  = { 1, "two", { { "three", 3.5 } }, nlohmann::ordered_json::array({ true }) };
+    tree["nested"]["object"] = { { "k\n", "v" } };
+
+    for (int indent : { -1, 2, 4 })
+    {
+        JsonStreamWriter stream(indent);
+        stream.Json(tree);
+        REQUIRE(stream.IsComplete());
+        REQUIRE(stream.GetText() == tree.dump(indent));
+
+        // Writing the same document token by token, leaving the final scopes for EndScopes().
+        stream.Clear();
+        stream.BeginObject();
+        stream.Key("index");
+        stream.Uint(42);
+        stream.Key("values");
+        stream.BeginArray();
+        stream.Int(-1);
+        stream.Double(0.5);
+        stream.String("s");
+        stream.BeginObject();
+        stream.EndObject();
+        stream.BeginObject();
+        stream.Key("meta");
+        stream.Null();
+        stream.EndScopes();
+
+        nlohmann::ordered_json expected;
+        expected["index"]  = 42;
+        expected["values"] = { -1, 0.5, "s", nlohmann::ordered_json::object(), { { "meta", nullptr } } };
+        REQUIRE(stream.GetText() == expected.dump(indent));
+    }
+}
+
+namespace
+{
+
+// Stands in for a decoded struct with PointerDecoder members, which are not trivially destructible.
+struct TestDecodedStruct
+{
+    TestDecodedStruct() { ++constructed; }
+    ~TestDecodedStruct() { ++destroyed; }
+
+    std::unique_ptr<uint8_t[]> data;
+    uint64_t                   values[6];
+
+    static size_t constructed;
+    static size_t destroyed;
+};
+
+size_t TestDecodedStruct::constructed = 0;
+size_t TestDecodedStruct::destroyed   = 0;
+
+} // namespace
+
+TEST_CASE("MonotonicAllocator", "[allocator]")
+{
+    SECTION("Arrays are value-initialized and destroyed by Clear")
+    {
+        gfxrecon::util::MonotonicAllocator allocator(1024);
+
+        uint32_t* values = allocator.Allocate<uint32_t>(16);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            REQUIRE(values[i] == 0);
+        }
+
+        TestDecodedStruct::constructed = 0;
+        TestDecodedStruct::destroyed   = 0;
+
+        TestDecodedStruct* structs = allocator.Allocate<TestDecodedStruct>(8);
+        REQUIRE(structs[7].data == nullptr);
+        REQUIRE(TestDecodedStruct::constructed == 8);
+        REQUIRE(TestDecodedStruct::destroyed == 0);
+
+        allocator.Allocate<TestDecodedStruct>(4, false);
+        REQUIRE(TestDecodedStruct::constructed == 8);
+
+        allocator.Clear(false);
+        REQUIRE(TestDecodedStruct::destroyed == 8);
+    }
+
+    SECTION("Block size grows to fit the allocations made between calls to Clear")
+    {
+        gfxrecon::util::MonotonicAllocator allocator(64, 1024);
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            allocator.Allocate<uint64_t>(4);
+        }
+        REQUIRE(allocator.GetBlockSize() == 64);
+
+        allocator.Clear(false);
+        REQUIRE(allocator.GetBlockSize() == 512);
+
+        allocator.Allocate<uint8_t>(4096);
+        allocator.Clear(false);
+        REQUIRE(allocator.GetBlockSize() == 1024);
+    }
+
+    SECTION("Block size is fixed without a maximum block size")
+    {
+        gfxrecon::util::MonotonicAllocator allocator(64);
+
+        allocator.Allocate<uint8_t>(4096);
+        allocator.Clear(false);
+        REQUIRE(allocator.GetBlockSize() == 64);
+    }
+}
+
+// Not run by default. Run with: gfxrecon_util_test "[benchmark]"
+TEST_CASE("MonotonicAllocator decode allocation benchmark", "[.][benchmark]")
+{
+    const size_t kArraysPerBlock = 16;
+    const size_t kArrayLength    = 64;
+
+    gfxrecon::util::MonotonicAllocator allocator(64 * 1024);
+
+    BENCHMARK("Per-element destructor records")
+    {
+        // The allocation pattern before arrays were constructed and destroyed in bulk.
+        struct Destructor
+        {
+            void* obj;
+            void (*destroy)(const void*);
+        };
+        std::vector<Destructor> destructors;
+
+        for (size_t i = 0; i < kArraysPerBlock; ++i)
+        {
+            TestDecodedStruct* structs = allocator.Allocate<TestDecodedStruct>(kArrayLength, false);
+            for (size_t j = 0; j < kArrayLength; ++j)
+            {
+                TestDecodedStruct* obj = new (structs + j) TestDecodedStruct();
+                destructors.push_back(
+                    { obj, [](const void* x) { static_cast<const TestDecodedStruct*>(x)->~TestDecodedStruct(); } });
+            }
+        }
+
+        for (auto destructor : destructors)
+        {
+            destructor.destroy(destructor.obj);
+        }
+        allocator.Clear(false);
+    };
+
+    BENCHMARK("Array destructor records")
+    {
+        for (size_t i = 0; i < kArraysPerBlock; ++i)
+        {
+            allocator.Allocate<TestDecodedStruct>(kArrayLength);
+        }
+        allocator.Clear(false);
+    };
+
+    const size_t kLargeArraySize = 256 * 1024;
+
+    gfxrecon::util::MonotonicAllocator fixed_allocator(64 * 1024);
+    gfxrecon::util::MonotonicAllocator growing_allocator(64 * 1024, 4 * 1024 * 1024);
+
+    BENCHMARK("Oversized allocations with fixed block size")
+    {
+        fixed_allocator.Allocate<uint8_t>(kLargeArraySize, false);
+        fixed_allocator.Clear(false);
+    };
+
+    BENCHMARK("Oversized allocations with growing block size")
+    {
+        growing_allocator.Allocate<uint8_t>(kLargeArraySize, false);
+        growing_allocator.Clear(false);
+    };
+}
+
+TEST_CASE("ChunkedOutputStream", "[stream]")
+{
+    const size_t kChunkSize = 64;
+
+    gfxrecon::util::MemoryChunkArena    arena(kChunkSize);
+    gfxrecon::util::ChunkedOutputStream stream(&arena);
+
+    // Write records of varying size, some of which are split between chunks or span several chunks.
+    std::vector<uint8_t> expected;
+    for (size_t i = 0; i < 40; ++i)
+    {
+        std::vector<uint8_t> record(i * 7 % 150, static_cast<uint8_t>(i));
+        stream.Write(record.data(), record.size());
+        expected.insert(expected.end(), record.begin(), record.end());
+    }
+
+    REQUIRE(stream.GetDataSize() == expected.size());
+
+    const uint64_t retained_bytes = arena.GetRetainedBytes();
+    REQUIRE(retained_bytes == ((expected.size() + kChunkSize - 1) / kChunkSize) * kChunkSize);
+    REQUIRE(gfxrecon::util::MemoryChunkArena::GetTotalRetainedBytes() >= retained_bytes);
+
+    std::vector<uint8_t> data(expected.size() + 10);
+    REQUIRE(stream.Read(0, data.data(), data.size()) == expected.size());
+    data.resize(expected.size());
+    REQUIRE(data == expected);
+
+    uint8_t value = 0;
+    REQUIRE(stream.Read(100, &value, 1) == 1);
+    REQUIRE(value == expected[100]);
+    REQUIRE(stream.Read(expected.size(), &value, 1) == 0);
+
+    gfxrecon::util::MemoryOutputStream copy;
+    REQUIRE(stream.WriteTo(kChunkSize - 3, 200, &copy) == 200);
+    REQUIRE(std::equal(copy.GetData(), copy.GetData() + 200, expected.begin() + (kChunkSize - 3)));
+
+    // Rewriting after Clear reuses the chunks instead of allocating more memory.
+    stream.Clear();
+    REQUIRE(stream.GetDataSize() == 0);
+
+    gfxrecon::util::ChunkedOutputStream other(&arena);
+    other.Write(expected.data(), expected.size() / 2);
+    stream.Write(expected.data(), expected.size() / 2);
+    REQUIRE(arena.GetRetainedBytes() == retained_bytes);
+
+    // Only chunks that are not in use are freed by Trim.
+    other.Clear();
+    arena.Trim();
+    REQUIRE(arena.GetRetainedBytes() == ((expected.size() / 2 + kChunkSize - 1) / kChunkSize) * kChunkSize);
+
+    stream.Clear();
+    arena.Trim();
+    REQUIRE(arena.GetRetainedBytes() == 0);
+}
+
+TEST_CASE("GenerateHash128", "[hash]")
+{
+    using gfxrecon::util::hash::GenerateHash128;
+    using gfxrecon::util::hash::Hash128;
+
+    // SMHasher verification for MurmurHash3 x64 128-bit: hash keys {}, {0}, {0, 1}, ... {0, ..., 254} with seed
+    // 256 - length, then hash the concatenated results with seed 0. Hash values are in host byte order, so the expected
+    // value assumes a little-endian host.
+    uint8_t key[256];
+    uint8_t hashes[256 * sizeof(Hash128)];
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        key[i] = static_cast<uint8_t>(i);
+
+        Hash128 hash = GenerateHash128(key, i, 256 - i);
+        memcpy(&hashes[i * sizeof(Hash128)], &hash.low, sizeof(hash.low));
+        memcpy(&hashes[i * sizeof(Hash128) + sizeof(hash.low)], &hash.high, sizeof(hash.high));
+    }
+
+    Hash128 verification = GenerateHash128(hashes, sizeof(hashes));
+    REQUIRE(static_cast<uint32_t>(verification.low) == 0x6384ba69);
+
+    REQUIRE(GenerateHash128(nullptr, 0) == Hash128{});
+    REQUIRE(GenerateHash128(key, sizeof(key)) == GenerateHash128(key, sizeof(key)));
+    REQUIRE(GenerateHash128(key, sizeof(key)) != GenerateHash128(key, sizeof(key), 1));
+
+    // Every bit of full 16-byte blocks and of partial tails contributes to the hash, as does the length of data that
+    // only differs by trailing zeros.
+    std::vector<uint8_t> data(40, 0);
+    Hash128              zero_hash = GenerateHash128(data.data(), data.size());
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        for (uint32_t bit = 0; bit < 8; ++bit)
+        {
+            data[i] = static_cast<uint8_t>(1u << bit);
+            REQUIRE(GenerateHash128(data.data(), data.size()) != zero_hash);
+            data[i] = 0;
+        }
+
+        REQUIRE(GenerateHash128(data.data(), i) != zero_hash);
+    }
+}
+
+// Test records for AsyncFileOutputStream, identified by the writing thread and a ticket.
+struct AsyncTestRecord
+{
+    uint32_t thread_index;
+    uint32_t payload_size;
+    uint64_t ticket;
+};
+
+static std::vector<uint8_t> MakeAsyncTestRecord(uint32_t thread_index, uint64_t ticket, bool inverted)
+{
+    AsyncTestRecord record{ thread_index, static_cast<uint32_t>((ticket * 37) % 301), ticket };
+
+    std::vector<uint8_t> data(sizeof(record) + record.payload_size, static_cast<uint8_t>(ticket));
+    memcpy(data.data(), &record, sizeof(record));
+
+    if (inverted)
+    {
+        for (auto& value : data)
+        {
+            value = ~value;
+        }
+    }
+
+    return data;
+}
+
+static std::vector<AsyncTestRecord> ReadAsyncTestRecords(const char* filename)
+{
+    std::ifstream        file(filename, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::vector<AsyncTestRecord> records;
+    size_t                       offset = 0;
+
+    while ((data.size() - offset) >= sizeof(AsyncTestRecord))
+    {
+        AsyncTestRecord record;
+        memcpy(&record, &data[offset], sizeof(record));
+        offset += sizeof(record);
+
+        REQUIRE((data.size() - offset) >= record.payload_size);
+        REQUIRE(std::all_of(data.begin() + offset,
+                            data.begin() + offset + record.payload_size,
+                            [&record](uint8_t value) { return value == static_cast<uint8_t>(record.ticket); }));
+        offset += record.payload_size;
+
+        records.push_back(record);
+    }
+
+    REQUIRE(offset == data.size());
+    return records;
+}
+
+// Restores the records that were inverted by MakeAsyncTestRecord().
+class InvertingProcessor : public gfxrecon::util::AsyncFileOutputStream::BlockProcessor
+{
+  public:
+    virtual void Process(std::vector<uint8_t>* block) override
+    {
+        for (auto& value : *block)
+        {
+            value = ~value;
+        }
+    }
+};
+
+TEST_CASE("AsyncFileOutputStream writes records in submission order", "[stream]")
+{
+    const char*    kFilename         = "gfxrecon_util_test_async_stream.bin";
+    const uint32_t kThreadCount      = 8;
+    const uint32_t kRecordsPerThread = 2000;
+
+    for (bool process : { false, true })
+    {
+        std::vector<std::thread> threads;
+        std::mutex               ticket_mutex;
+        uint64_t                 next_ticket = 0;
+
+        {
+            // A small queue makes the writing threads wait for the writer thread.
+            gfxrecon::util::AsyncFileOutputStream stream(kFilename, 4096, 64 * 1024);
+
+            if (process)
+            {
+                stream.EnableBlockProcessing(3, []() { return std::make_unique<InvertingProcessor>(); });
+            }
+
+            // Records written while holding the ticket lock must be written to the file in ticket order.
+            for (uint32_t i = 0; i < kThreadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (uint32_t j = 0; j < kRecordsPerThread; ++j)
+                    {
+                        std::lock_guard<std::mutex> lock(ticket_mutex);
+                        const uint64_t              ticket = next_ticket++;
+                        const bool                  invert = process && ((ticket % 2) != 0);
+                        std::vector<uint8_t>        record = MakeAsyncTestRecord(i, ticket, invert);
+
+                        if (invert)
+                        {
+                            stream.WriteAndProcess(record.data(), record.size());
+                        }
+                        else
+                        {
+                            stream.Write(record.data(), record.size());
+                        }
+
+                        if ((j % 500) == 0)
+                        {
+                            stream.Flush();
+                        }
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            threads.clear();
+
+            // Records written concurrently must be written in the order that each thread wrote them. These threads
+            // write after the earlier threads have exited, whose buffers are then reclaimed.
+            for (uint32_t i = 0; i < kThreadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (uint32_t j = 0; j < kRecordsPerThread; ++j)
+                    {
+                        const bool           invert = process && ((j % 3) == 0);
+                        std::vector<uint8_t> record = MakeAsyncTestRecord(kThreadCount + i, j, invert);
+
+                        if (invert)
+                        {
+                            stream.WriteAndProcess(record.data(), record.size());
+                        }
+                        else
+                        {
+                            stream.Write(record.data(), record.size());
+                        }
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::vector<uint8_t> record = MakeAsyncTestRecord(2 * kThreadCount, 0, false);
+            stream.Write(record.data(), record.size());
+            stream.WaitForIdle();
+
+            auto statistics = stream.GetStatistics();
+            REQUIRE(statistics.blocks_written == ((2 * kThreadCount * kRecordsPerThread) + 1));
+            REQUIRE(statistics.thread_buffers == 1);
+            REQUIRE(statistics.write_errors == 0);
+        }
+
+        std::vector<AsyncTestRecord> records = ReadAsyncTestRecords(kFilename);
+        std::remove(kFilename);
+
+        REQUIRE(records.size() == ((2 * kThreadCount * kRecordsPerThread) + 1));
+
+        std::vector<uint64_t> next_tickets(kThreadCount, 0);
+
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            const AsyncTestRecord& record = records[i];
+
+            if (i < (kThreadCount * kRecordsPerThread))
+            {
+                REQUIRE(record.thread_index < kThreadCount);
+                REQUIRE(record.ticket == i);
+            }
+            else if (i < (2 * kThreadCount * kRecordsPerThread))
+            {
+                REQUIRE(record.thread_index >= kThreadCount);
+                REQUIRE(record.thread_index < (2 * kThreadCount));
+                REQUIRE(record.ticket == next_tickets[record.thread_index - kThreadCount]++);
+            }
+            else
+            {
+                REQUIRE(record.thread_index == (2 * kThreadCount));
+            }
+        }
+    }
+}
@@ -32,7 +32,11 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class ZlibCompressor : public Compressor
 {
   public:
-    ZlibCompressor() {}
+    static const int32_t kDefaultCompressionLevel = 9; // Z_BEST_COMPRESSION
+
+    explicit ZlibCompressor(int32_t compression_level = kDefaultCompressionLevel) :
+        compression_level_(compression_level)
+    {}
 
     virtual ~ZlibCompressor() override {}
 
@@ -41,10 +45,13 @@ class ZlibCompressor : public Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    virtual size_t Decompress(const size_t          compressed_size,
+                              const uint8_t*        compressed_data,
+                              const size_t          expected_uncompressed_size,
+                              std::vector<uint8_t>* uncompressed_data) override;
+
+  private:
+    int32_t compression_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
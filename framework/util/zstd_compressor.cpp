@@ -28,11 +28,27 @@
 
 #include "zstd.h"
 
+// The dictionary builder API is not included with all of the precompiled Zstandard packages.
+#if defined(__has_include)
+#if __has_include("zdict.h")
+#include "zdict.h"
+#define GFXRECON_ENABLE_ZSTD_DICTIONARY_TRAINING
+#endif
+#endif
+
+#include <algorithm>
 #include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+ZstdCompressor::~ZstdCompressor()
+{
+    ReleaseDictionaries();
+    ZSTD_freeCCtx(compression_context_);
+    ZSTD_freeDCtx(decompression_context_);
+}
+
 size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
                                 const uint8_t*        uncompressed_data,
                                 std::vector<uint8_t>* compressed_data,
@@ -45,6 +61,25 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
         return 0;
     }
 
+    // The context is reused for each block, which avoids reallocating the compression state for small blocks.
+    if (compression_context_ == nullptr)
+    {
+        compression_context_ = ZSTD_createCCtx();
+    }
+
+    const int32_t compression_level = std::max(std::min(compression_level_, ZSTD_maxCLevel()), ZSTD_minCLevel());
+
+    if (!dictionary_.empty() && (compression_dictionary_ == nullptr))
+    {
+        compression_dictionary_ = ZSTD_createCDict(dictionary_.data(), dictionary_.size(), compression_level);
+    }
+
+    if ((compression_context_ == nullptr) || (!dictionary_.empty() && (compression_dictionary_ == nullptr)))
+    {
+        GFXRECON_LOG_ERROR_ONCE("Zstandard compression failed to initialize");
+        return 0;
+    }
+
     size_t zstd_compressed_size = ZSTD_compressBound(uncompressed_size);
 
     if ((compressed_data_offset + zstd_compressed_size) > compressed_data->size())
@@ -52,12 +87,28 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
         compressed_data->resize(compressed_data_offset + zstd_compressed_size);
     }
 
-    size_t compressed_size_generated =
-        ZSTD_compress(reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                      zstd_compressed_size,
-                      reinterpret_cast<const char*>(uncompressed_data),
-                      uncompressed_size,
-                      1);
+    size_t compressed_size_generated = 0;
+
+    if (compression_dictionary_ != nullptr)
+    {
+        compressed_size_generated =
+            ZSTD_compress_usingCDict(compression_context_,
+                                     reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                                     zstd_compressed_size,
+                                     reinterpret_cast<const char*>(uncompressed_data),
+                                     uncompressed_size,
+                                     compression_dictionary_);
+    }
+    else
+    {
+        compressed_size_generated =
+            ZSTD_compressCCtx(compression_context_,
+                              reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                              zstd_compressed_size,
+                              reinterpret_cast<const char*>(uncompressed_data),
+                              uncompressed_size,
+                              compression_level);
+    }
 
     if (!ZSTD_isError(compressed_size_generated))
     {
@@ -71,10 +122,10 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t ZstdCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZstdCompressor::Decompress(const size_t          compressed_size,
+                                  const uint8_t*        compressed_data,
+                                  const size_t          expected_uncompressed_size,
+                                  std::vector<uint8_t>* uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -83,10 +134,41 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data->data()),
-                                                         expected_uncompressed_size,
-                                                         reinterpret_cast<const char*>(compressed_data.data()),
-                                                         compressed_size);
+    if (decompression_context_ == nullptr)
+    {
+        decompression_context_ = ZSTD_createDCtx();
+    }
+
+    if (!dictionary_.empty() && (decompression_dictionary_ == nullptr))
+    {
+        decompression_dictionary_ = ZSTD_createDDict(dictionary_.data(), dictionary_.size());
+    }
+
+    if ((decompression_context_ == nullptr) || (!dictionary_.empty() && (decompression_dictionary_ == nullptr)))
+    {
+        GFXRECON_LOG_ERROR_ONCE("Zstandard decompression failed to initialize");
+        return 0;
+    }
+
+    size_t uncompressed_size_generated = 0;
+
+    if (decompression_dictionary_ != nullptr)
+    {
+        uncompressed_size_generated = ZSTD_decompress_usingDDict(decompression_context_,
+                                                                 reinterpret_cast<char*>(uncompressed_data->data()),
+                                                                 expected_uncompressed_size,
+                                                                 reinterpret_cast<const char*>(compressed_data),
+                                                                 compressed_size,
+                                                                 decompression_dictionary_);
+    }
+    else
+    {
+        uncompressed_size_generated = ZSTD_decompressDCtx(decompression_context_,
+                                                          reinterpret_cast<char*>(uncompressed_data->data()),
+                                                          expected_uncompressed_size,
+                                                          reinterpret_cast<const char*>(compressed_data),
+                                                          compressed_size);
+    }
 
     if (!ZSTD_isError(uncompressed_size_generated))
     {
@@ -100,6 +182,70 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
     return data_size;
 }
 
+bool ZstdCompressor::TrainDictionary(const std::vector<uint8_t>& samples,
+                                     const std::vector<size_t>&  sample_sizes,
+                                     size_t                      dictionary_capacity,
+                                     std::vector<uint8_t>*       dictionary) const
+{
+#if defined(GFXRECON_ENABLE_ZSTD_DICTIONARY_TRAINING)
+    if ((dictionary == nullptr) || sample_sizes.empty() || (dictionary_capacity == 0))
+    {
+        return false;
+    }
+
+    dictionary->resize(dictionary_capacity);
+
+    size_t dictionary_size = ZDICT_trainFromBuffer(dictionary->data(),
+                                                   dictionary_capacity,
+                                                   samples.data(),
+                                                   sample_sizes.data(),
+                                                   static_cast<unsigned>(sample_sizes.size()));
+
+    if (ZDICT_isError(dictionary_size))
+    {
+        GFXRECON_LOG_ERROR("Zstandard dictionary training failed: %s", ZDICT_getErrorName(dictionary_size));
+        dictionary->clear();
+        return false;
+    }
+
+    dictionary->resize(dictionary_size);
+
+    return true;
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(samples);
+    GFXRECON_UNREFERENCED_PARAMETER(sample_sizes);
+    GFXRECON_UNREFERENCED_PARAMETER(dictionary_capacity);
+    GFXRECON_UNREFERENCED_PARAMETER(dictionary);
+
+    GFXRECON_LOG_ERROR("Zstandard dictionary training is not supported by this build");
+    return false;
+#endif
+}
+
+bool ZstdCompressor::SetDictionary(const uint8_t* dictionary, size_t dictionary_size)
+{
+    if ((dictionary == nullptr) || (dictionary_size == 0))
+    {
+        return false;
+    }
+
+    ReleaseDictionaries();
+
+    // The dictionary objects for compression and decompression are created when they are first needed, so that a
+    // reader does not need to prepare the dictionary for compression.
+    dictionary_.assign(dictionary, dictionary + dictionary_size);
+
+    return true;
+}
+
+void ZstdCompressor::ReleaseDictionaries()
+{
+    ZSTD_freeCDict(compression_dictionary_);
+    ZSTD_freeDDict(decompression_dictionary_);
+    compression_dictionary_   = nullptr;
+    decompression_dictionary_ = nullptr;
+}
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
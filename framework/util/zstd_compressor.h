@@ -25,25 +25,56 @@
 
 #include "util/compressor.h"
 
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
 class ZstdCompressor : public Compressor
 {
   public:
-    ZstdCompressor() {}
+    static const int32_t kDefaultCompressionLevel = 1;
+
+    explicit ZstdCompressor(int32_t compression_level = kDefaultCompressionLevel) :
+        compression_level_(compression_level), compression_context_(nullptr), decompression_context_(nullptr),
+        compression_dictionary_(nullptr), decompression_dictionary_(nullptr)
+    {}
 
-    virtual ~ZstdCompressor() override {}
+    virtual ~ZstdCompressor() override;
 
     virtual size_t Compress(const size_t          uncompressed_size,
                             const uint8_t*        uncompressed_data,
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    virtual size_t Decompress(const size_t          compressed_size,
+                              const uint8_t*        compressed_data,
+                              const size_t          expected_uncompressed_size,
+                              std::vector<uint8_t>* uncompressed_data) override;
+
+    virtual bool TrainDictionary(const std::vector<uint8_t>& samples,
+                                 const std::vector<size_t>&  sample_sizes,
+                                 size_t                      dictionary_capacity,
+                                 std::vector<uint8_t>*       dictionary) const override;
+
+    virtual bool SetDictionary(const uint8_t* dictionary, size_t dictionary_size) override;
+
+  private:
+    ZstdCompressor(const ZstdCompressor&)            = delete;
+    ZstdCompressor& operator=(const ZstdCompressor&) = delete;
+
+    void ReleaseDictionaries();
+
+  private:
+    int32_t              compression_level_;
+    ZSTD_CCtx_s*         compression_context_;
+    ZSTD_DCtx_s*         decompression_context_;
+    std::vector<uint8_t> dictionary_;
+    ZSTD_CDict_s*        compression_dictionary_;   // Created from dictionary_ on first use.
+    ZSTD_DDict_s*        decompression_dictionary_; // Created from dictionary_ on first use.
 };
 
 GFXRECON_END_NAMESPACE(util)
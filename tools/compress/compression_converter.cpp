@@ -27,22 +27,67 @@
 #include "format/format_util.h"
 #include "util/logging.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+const size_t kDictionarySampleFactor  = 100;
+const size_t kMaxDictionarySampleSize = 64 * 1024;
+
+// Compresses the uncompressed blocks written by the converter on the output file's worker threads.
+class BlockCompressor : public util::AsyncFileOutputStream::BlockProcessor
+{
+  public:
+    // The dictionary is not loaded until the first block is processed, because it is trained after the block
+    // compressors have been created. Blocks are not submitted for processing until training has completed.
+    BlockCompressor(format::CompressionType type, int32_t compression_level, const std::vector<uint8_t>* dictionary) :
+        compressor_(format::CreateCompressor(type, compression_level)), dictionary_(dictionary),
+        dictionary_loaded_(false)
+    {}
+
+    virtual void Process(std::vector<uint8_t>* block) override
+    {
+        if (compressor_ != nullptr)
+        {
+            if (!dictionary_loaded_)
+            {
+                if ((dictionary_ != nullptr) && !dictionary_->empty())
+                {
+                    compressor_->SetDictionary(dictionary_->data(), dictionary_->size());
+                }
+
+                dictionary_loaded_ = true;
+            }
+
+            format::CompressBlock(compressor_.get(), block, &compressed_block_);
+        }
+    }
+
+  private:
+    std::unique_ptr<util::Compressor> compressor_;
+    std::vector<uint8_t>              compressed_block_;
+    const std::vector<uint8_t>*       dictionary_;
+    bool                              dictionary_loaded_;
+};
+
 CompressionConverter::CompressionConverter() :
-    decompressing_(true), target_compression_type_(format::CompressionType::kNone)
+    decompressing_(true), target_compression_type_(format::CompressionType::kNone), thread_count_(0),
+    dictionary_size_(0)
 {}
 
 CompressionConverter::~CompressionConverter() {}
 
 bool CompressionConverter::Initialize(const std::string&      input_filename,
                                       const std::string&      output_filename,
-                                      format::CompressionType target_compression_type)
+                                      format::CompressionType target_compression_type,
+                                      int32_t                 compression_level,
+                                      uint32_t                thread_count,
+                                      size_t                  dictionary_size)
 {
-    bool success = CreateCompressor(target_compression_type, &target_compressor_);
+    bool success = CreateCompressor(target_compression_type, compression_level, &target_compressor_);
 
     if (success)
     {
@@ -50,7 +95,26 @@ bool CompressionConverter::Initialize(const std::string&      input_filename,
         // WriteFileHeader, which depends on a valid target compression type.
         target_compression_type_ = target_compression_type;
         decompressing_           = (target_compression_type == format::CompressionType::kNone);
-        success                  = FileTransformer::Initialize(input_filename, output_filename);
+
+        if (!decompressing_ && (thread_count > 0))
+        {
+            // Blocks are converted to their uncompressed form on this thread and compressed by the worker threads. The
+            // output file retains the block order of the input file.
+            thread_count_ = thread_count;
+            EnableBlockProcessing(thread_count, [this, target_compression_type, compression_level]() {
+                return std::make_unique<BlockCompressor>(target_compression_type, compression_level, &dictionary_);
+            });
+        }
+
+        success = FileTransformer::Initialize(input_filename, output_filename);
+
+        if (success && !decompressing_ && (dictionary_size > 0))
+        {
+            // The dictionary is trained from the blocks at the start of the file, which are held until training has
+            // completed. Training works best with a sample that is about 100 times the size of the dictionary.
+            dictionary_size_ = dictionary_size;
+            HoldOutputBlocks(dictionary_size * kDictionarySampleFactor);
+        }
     }
 
     return success;
@@ -217,6 +281,10 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     {
         return WriteFillMemoryMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryBlobCommand)
+    {
+        return WriteFillMemoryBlobMetaData(block_header, meta_data_id);
+    }
     else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
         return WriteInitBufferMetaData(block_header, meta_data_id);
@@ -252,9 +320,98 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     }
 }
 
+bool CompressionConverter::ProcessCompressionDictionary(const format::BlockHeader& block_header,
+                                                        format::MetaDataId         meta_data_id)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(block_header);
+    GFXRECON_UNREFERENCED_PARAMETER(meta_data_id);
+
+    // The input file's dictionary is only needed to decompress the input file. It is not written to the output file,
+    // which is either uncompressed or compressed with its own dictionary.
+    format::SetCompressionDictionaryCommandHeader header;
+    std::vector<uint8_t>                          dictionary;
+
+    return ReadCompressionDictionary(&header, &dictionary);
+}
+
+bool CompressionConverter::ProcessHeldBlocks(std::vector<std::vector<uint8_t>>* blocks)
+{
+    assert(blocks != nullptr);
+
+    bool success = true;
+
+    if (TrainDictionary(*blocks))
+    {
+        // The dictionary must be the first block after the file header, because it is needed to decompress all of the
+        // blocks that follow it.
+        format::SetCompressionDictionaryCommandHeader header;
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + dictionary_.size();
+        header.meta_header.meta_data_id      = format::MakeMetaDataId(
+            format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kSetCompressionDictionaryCommand);
+        header.thread_id       = 0;
+        header.dictionary_size = dictionary_.size();
+
+        success = WriteBytes(&header, sizeof(header)) && WriteBytes(dictionary_.data(), dictionary_.size());
+
+        if (!success)
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write set compression dictionary meta-data block");
+        }
+    }
+
+    if (success && (thread_count_ == 0))
+    {
+        // The held blocks were written uncompressed.
+        std::vector<uint8_t> compressed_block;
+
+        for (auto& block : *blocks)
+        {
+            format::CompressBlock(target_compressor_.get(), &block, &compressed_block);
+        }
+    }
+
+    return success;
+}
+
+bool CompressionConverter::TrainDictionary(const std::vector<std::vector<uint8_t>>& blocks)
+{
+    std::vector<uint8_t> samples;
+    std::vector<size_t>  sample_sizes;
+
+    for (const auto& block : blocks)
+    {
+        size_t header_size = format::GetCompressibleBlockHeaderSize(block);
+
+        if ((header_size > 0) && (block.size() > header_size))
+        {
+            // Large blocks are truncated, so that a few large resource uploads do not dominate the sample.
+            size_t sample_size = std::min(block.size() - header_size, kMaxDictionarySampleSize);
+            samples.insert(samples.end(), block.begin() + header_size, block.begin() + header_size + sample_size);
+            sample_sizes.push_back(sample_size);
+        }
+    }
+
+    if (!target_compressor_->TrainDictionary(samples, sample_sizes, dictionary_size_, &dictionary_) ||
+        !target_compressor_->SetDictionary(dictionary_.data(), dictionary_.size()))
+    {
+        GFXRECON_LOG_WARNING("Failed to create a compression dictionary from %" PRIuPTR
+                             " blocks; the file will be compressed without a dictionary",
+                             sample_sizes.size());
+        dictionary_.clear();
+        return false;
+    }
+
+    GFXRECON_LOG_INFO("Created a %" PRIuPTR " byte compression dictionary from %" PRIuPTR " blocks",
+                      dictionary_.size(),
+                      sample_sizes.size());
+
+    return true;
+}
+
 bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
 {
-    bool        write_uncompressed = decompressing_;
+    bool        write_uncompressed = !IsCompressingInline();
     const auto& buffer             = GetParameterBuffer();
 
     if (!write_uncompressed)
@@ -336,7 +493,7 @@ bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
                                            format::ThreadId  thread_id,
                                            size_t            buffer_size)
 {
-    bool        write_uncompressed = decompressing_;
+    bool        write_uncompressed = !IsCompressingInline();
     const auto& buffer             = GetParameterBuffer();
 
     if (!write_uncompressed)
@@ -487,6 +644,78 @@ bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& bl
     return true;
 }
 
+bool CompressionConverter::WriteFillMemoryBlobMetaData(const format::BlockHeader& block_header,
+                                                       format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryBlobCommand);
+
+    format::FillMemoryBlobCommandHeader blob_cmd;
+
+    bool success = ReadBytes(&blob_cmd.thread_id, sizeof(blob_cmd.thread_id));
+    success      = success && ReadBytes(&blob_cmd.blob_id, sizeof(blob_cmd.blob_id));
+    success      = success && ReadBytes(&blob_cmd.memory_id, sizeof(blob_cmd.memory_id));
+    success      = success && ReadBytes(&blob_cmd.memory_offset, sizeof(blob_cmd.memory_offset));
+    success      = success && ReadBytes(&blob_cmd.memory_size, sizeof(blob_cmd.memory_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, blob_cmd.memory_size);
+
+        size_t data_size = static_cast<size_t>(blob_cmd.memory_size);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            size_t compressed_size =
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(blob_cmd));
+
+            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            {
+                HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                     "Failed to read fill memory blob meta-data block");
+                return false;
+            }
+
+            assert(uncompressed_size == data_size);
+        }
+        else
+        {
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory blob meta-data block");
+                return false;
+            }
+        }
+
+        const auto&    buffer       = GetParameterBuffer();
+        const uint8_t* data_address = buffer.data();
+
+        PrepMetadataBlock(blob_cmd.meta_header, meta_data_id, data_address, data_size);
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        blob_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(blob_cmd) + data_size;
+
+        if (!WriteBytes(&blob_cmd, sizeof(blob_cmd)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory blob meta-data block header");
+            return false;
+        }
+
+        if (!WriteBytes(data_address, data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory blob meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory blob meta-data block header");
+        return false;
+    }
+
+    return true;
+}
+
 bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& block_header,
                                                    format::MetaDataId         meta_data_id)
 {
@@ -932,7 +1161,7 @@ void CompressionConverter::PrepMetadataBlock(format::MetaDataHeader& meta_data_h
     meta_data_header.block_header.type = format::kMetaDataBlock;
     meta_data_header.meta_data_id      = meta_data_id;
 
-    if (!decompressing_)
+    if (IsCompressingInline())
     {
         assert(target_compressor_ != nullptr);
 
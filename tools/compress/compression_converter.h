@@ -31,6 +31,7 @@
 #include "util/defines.h"
 
 #include <memory>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
@@ -41,9 +42,15 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual ~CompressionConverter() override;
 
+    // When thread_count is greater than 0, blocks are compressed in parallel by thread_count worker threads. When
+    // dictionary_size is greater than 0, a compression dictionary of up to dictionary_size bytes is trained from the
+    // first blocks of the file and written to the output file, for compression types that support dictionaries.
     bool Initialize(const std::string&      input_filename,
                     const std::string&      output_filename,
-                    format::CompressionType target_compression_type);
+                    format::CompressionType target_compression_type,
+                    int32_t                 compression_level,
+                    uint32_t                thread_count,
+                    size_t                  dictionary_size);
 
   protected:
     virtual bool WriteFileHeader(const format::FileHeader&                  header,
@@ -56,7 +63,17 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
+    virtual bool ProcessCompressionDictionary(const format::BlockHeader& block_header,
+                                              format::MetaDataId         meta_data_id) override;
+
+    virtual bool ProcessHeldBlocks(std::vector<std::vector<uint8_t>>* blocks) override;
+
   private:
+    // Blocks that are held for dictionary training are compressed after the dictionary has been created.
+    bool IsCompressingInline() const { return !decompressing_ && (thread_count_ == 0) && !IsHoldingOutputBlocks(); }
+
+    bool TrainDictionary(const std::vector<std::vector<uint8_t>>& blocks);
+
     bool WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size);
 
     bool WriteMethodCall(format::ApiCallId call_id,
@@ -66,6 +83,8 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool WriteFillMemoryBlobMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
     bool WriteInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
@@ -86,6 +105,9 @@ class CompressionConverter : public decode::FileTransformer
     bool                              decompressing_;
     format::CompressionType           target_compression_type_;
     std::unique_ptr<util::Compressor> target_compressor_;
+    uint32_t                          thread_count_;
+    size_t                            dictionary_size_;
+    std::vector<uint8_t>              dictionary_; // Read by the worker threads after it has been trained.
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -26,6 +26,7 @@
 
 #include "decode/file_processor.h"
 #include "format/format.h"
+#include "format/format_util.h"
 #include "util/argument_parser.h"
 #include "util/compressor.h"
 #include "util/logging.h"
@@ -34,13 +35,19 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <exception>
+#include <string>
 
-const char kHelpShortOption[] = "-h";
-const char kHelpLongOption[]  = "--help";
-const char kVersionOption[]   = "--version";
-const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kHelpShortOption[]    = "-h";
+const char kHelpLongOption[]     = "--help";
+const char kVersionOption[]      = "--version";
+const char kNoDebugPopup[]       = "--no-debug-popup";
+const char kThreadsArgument[]    = "--threads";
+const char kLevelArgument[]      = "--level";
+const char kDictionaryArgument[] = "--dictionary";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--threads,--level,--dictionary";
 
 const char kArgNone[]    = "NONE";
 const char kArgLz4[]     = "LZ4";
@@ -58,8 +65,9 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to compress/decompress GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input_file> <output_file> <compression_format>\n",
-                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--threads <N>] [--level <N>]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  \t\t\t[--dictionary <KiB>]");
+    GFXRECON_WRITE_CONSOLE("  \t\t\t<input_file> <output_file> <compression_format>\n");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process.");
     GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the output file to generate.");
@@ -78,6 +86,17 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tCompress blocks in parallel on N worker threads. Blocks");
+    GFXRECON_WRITE_CONSOLE("          \t\tare written to the output file in their original order.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is 0, which compresses blocks on the main thread.");
+    GFXRECON_WRITE_CONSOLE("  --level <N>\t\tCompression level for the selected compression format.");
+    GFXRECON_WRITE_CONSOLE("          \t\tLZ4: 0 selects fast compression (default), 1-12 select");
+    GFXRECON_WRITE_CONSOLE("          \t\thigh compression. ZLIB: 0-9 (default 9). ZSTD: negative");
+    GFXRECON_WRITE_CONSOLE("          \t\tlevels for faster compression up to 22 (default 1).");
+    GFXRECON_WRITE_CONSOLE("  --dictionary <KiB>\tTrain a compression dictionary of up to KiB kibibytes");
+    GFXRECON_WRITE_CONSOLE("          \t\tfrom the blocks at the start of the file and store it in");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe output file. Improves the compression of small blocks.");
+    GFXRECON_WRITE_CONSOLE("          \t\tOnly supported by ZSTD. Default is 0 (no dictionary).");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -143,7 +162,7 @@ int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -196,9 +215,62 @@ int main(int argc, const char** argv)
         }
     }
 
+    int32_t compression_level = gfxrecon::format::GetDefaultCompressionLevel(compression_type);
+    int32_t thread_count      = 0;
+    int32_t dictionary_size   = 0;
+
+    try
+    {
+        const std::string& level_value = arg_parser.GetArgumentValue(kLevelArgument);
+        if (!level_value.empty())
+        {
+            compression_level = std::stoi(level_value);
+        }
+
+        const std::string& threads_value = arg_parser.GetArgumentValue(kThreadsArgument);
+        if (!threads_value.empty())
+        {
+            thread_count = std::stoi(threads_value);
+        }
+
+        const std::string& dictionary_value = arg_parser.GetArgumentValue(kDictionaryArgument);
+        if (!dictionary_value.empty())
+        {
+            dictionary_size = std::stoi(dictionary_value);
+        }
+    }
+    catch (std::exception&)
+    {
+        thread_count = -1;
+    }
+
+    if ((thread_count < 0) || (dictionary_size < 0))
+    {
+        GFXRECON_LOG_ERROR("Invalid value specified for the %s, %s, or %s option",
+                           kLevelArgument,
+                           kThreadsArgument,
+                           kDictionaryArgument);
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    if ((dictionary_size > 0) && (compression_type != gfxrecon::format::CompressionType::kZstd))
+    {
+        GFXRECON_LOG_ERROR("The %s option is only supported with ZSTD compression", kDictionaryArgument);
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
     gfxrecon::CompressionConverter file_converter;
 
-    if (file_converter.Initialize(input_filename, output_filename, compression_type))
+    if (file_converter.Initialize(input_filename,
+                                  output_filename,
+                                  compression_type,
+                                  compression_level,
+                                  static_cast<uint32_t>(thread_count),
+                                  static_cast<size_t>(dictionary_size) * 1024))
     {
         if (file_converter.Process())
         {
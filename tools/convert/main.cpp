@@ -25,6 +25,7 @@
 #include "tool_settings.h"
 #include "decode/json_writer.h" /// @todo move to util?
 #include "decode/decode_api_detection.h"
+#include "decode/file_index.h"
 #include "format/format.h"
 #include "util/file_output_stream.h"
 #include "util/file_path.h"
@@ -37,6 +38,12 @@
 #include "generated/generated_dx12_json_consumer.h"
 #endif
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <vector>
+
 using gfxrecon::util::JsonFormat;
 using VulkanJsonConsumer = gfxrecon::decode::MetadataJsonConsumer<
     gfxrecon::decode::MarkerJsonConsumer<gfxrecon::decode::VulkanExportJsonConsumer>>;
@@ -44,9 +51,14 @@ using VulkanJsonConsumer = gfxrecon::decode::MetadataJsonConsumer<
 using Dx12JsonConsumer =
     gfxrecon::decode::MetadataJsonConsumer<gfxrecon::decode::MarkerJsonConsumer<gfxrecon::decode::Dx12JsonConsumer>>;
 #endif
-const char kOptions[] = "-h|--help,--version,--no-debug-popup,--file-per-frame,--include-binaries,--expand-flags";
+const char kOptions[] = "-h|--help,--version,--no-debug-popup,--file-per-frame,--include-binaries,--expand-flags,--mmap-input";
+
+const char kArguments[] = "--output,--format,--frame-range,--threads,--frame-workers";
 
-const char kArguments[] = "--output,--format";
+const char kFrameRangeArgument[]   = "--frame-range";
+const char kThreadsArgument[]      = "--threads";
+const char kFrameWorkersArgument[] = "--frame-workers";
+const char kMmapInputOption[]      = "--mmap-input";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -81,6 +93,23 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE(
         "  --file-per-frame\tCreates a new file for every frame processed. Frame number is added as a suffix");
     GFXRECON_WRITE_CONSOLE("                  \tto the output file name.");
+    GFXRECON_WRITE_CONSOLE("  --frame-range <first>-<last>");
+    GFXRECON_WRITE_CONSOLE("                  \tOnly convert the frames from <first> to <last>, inclusive, using the");
+    GFXRECON_WRITE_CONSOLE("                  \tsame frame numbering as --file-per-frame. Frames before <first> are");
+    GFXRECON_WRITE_CONSOLE("                  \tskipped without decoding, using the capture file index created by");
+    GFXRECON_WRITE_CONSOLE("                  \tgfxrecon-index when available.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tSerialize and write the JSON for each block on N background");
+    GFXRECON_WRITE_CONSOLE("          \t\tthreads while the capture file is decoded. Blocks are written");
+    GFXRECON_WRITE_CONSOLE("          \t\tin their original order. Default is 0, which serializes");
+    GFXRECON_WRITE_CONSOLE("          \t\tblocks on the main thread.");
+    GFXRECON_WRITE_CONSOLE("  --frame-workers <N>\tWith --file-per-frame, split the frames into N chunks of");
+    GFXRECON_WRITE_CONSOLE("                  \tconsecutive frames and convert the chunks in parallel, each");
+    GFXRECON_WRITE_CONSOLE("                  \ton its own thread, using the capture file index created by");
+    GFXRECON_WRITE_CONSOLE("                  \tgfxrecon-index when available. With --include-binaries, the");
+    GFXRECON_WRITE_CONSOLE("                  \tbinary files of each chunk are dumped in a subdirectory named");
+    GFXRECON_WRITE_CONSOLE("                  \tafter the chunk's first frame. Default is 1.");
+    GFXRECON_WRITE_CONSOLE("  --mmap-input\t\tMap the capture file into memory and decode blocks directly");
+    GFXRECON_WRITE_CONSOLE("          \t\tfrom the mapping instead of reading them into a buffer.");
 
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
@@ -142,6 +171,65 @@ static gfxrecon::util::JsonFormat GetOutputFormat(const gfxrecon::util::Argument
     return JsonFormat::JSON;
 }
 
+static bool GetFrameRange(const gfxrecon::util::ArgumentParser& arg_parser, uint32_t& first_frame, uint32_t& last_frame)
+{
+    const std::string& value = arg_parser.GetArgumentValue(kFrameRangeArgument);
+    if (value.empty())
+    {
+        return false;
+    }
+
+    std::vector<std::string> values = gfxrecon::util::strings::SplitString(value, '-');
+    bool                     valid  = (values.size() == 2);
+
+    for (std::string& num : values)
+    {
+        gfxrecon::util::strings::RemoveWhitespace(num);
+
+        // Check that the range string only contains numbers.
+        const size_t count = std::count_if(num.begin(), num.end(), ::isdigit);
+        valid              = valid && !num.empty() && (count == num.length());
+    }
+
+    if (valid)
+    {
+        first_frame = static_cast<uint32_t>(std::stoul(values[0]));
+        last_frame  = static_cast<uint32_t>(std::stoul(values[1]));
+        valid       = (first_frame <= last_frame);
+    }
+
+    if (!valid)
+    {
+        GFXRECON_LOG_WARNING(
+            "Ignoring invalid frame range \"%s\". Must have format: <first>-<last>, with <first> <= <last>",
+            value.c_str());
+    }
+
+    return valid;
+}
+
+static bool GetCountArgument(const gfxrecon::util::ArgumentParser& arg_parser,
+                             const char*                           argument,
+                             uint32_t                              default_count,
+                             uint32_t&                             result)
+{
+    const std::string& value = arg_parser.GetArgumentValue(argument);
+    if (value.empty())
+    {
+        result = default_count;
+        return true;
+    }
+
+    const size_t count = std::count_if(value.begin(), value.end(), ::isdigit);
+    if (count != value.length())
+    {
+        return false;
+    }
+
+    result = static_cast<uint32_t>(std::stoul(value));
+    return true;
+}
+
 std::string FormatFrameNumber(uint32_t frame_number)
 {
     std::ostringstream stream;
@@ -149,6 +237,225 @@ std::string FormatFrameNumber(uint32_t frame_number)
     return stream.str();
 }
 
+static std::string GetVulkanVersion()
+{
+    return std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+           std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+           std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+}
+
+struct FrameChunk
+{
+    uint32_t first_frame;
+    uint32_t last_frame;
+    bool     success;
+};
+
+// Convert the frames of one chunk of the capture file to a file per frame. Conversion only needs the decoded
+// parameters of each block, so chunks are converted independently with their own processor, decoders, and consumers.
+static void ConvertFrameChunk(const std::string&                 input_filename,
+                              const std::string&                 output_filename,
+                              const gfxrecon::util::JsonOptions& json_options,
+                              const gfxrecon::decode::FileIndex& file_index,
+                              uint32_t                           thread_count,
+                              bool                               use_file_mapping,
+                              FrameChunk&                        chunk)
+{
+    gfxrecon::decode::FileProcessor file_processor;
+
+    chunk.success = false;
+    file_processor.SetUseFileMapping(use_file_mapping);
+
+    if (!file_processor.Initialize(input_filename))
+    {
+        return;
+    }
+
+    file_processor.SetFileIndex(file_index);
+
+    if (!file_processor.SeekToFrame(chunk.first_frame))
+    {
+        return;
+    }
+
+    FILE*       out_file_handle = nullptr;
+    std::string json_filename =
+        gfxrecon::util::filepath::InsertFilenamePostfix(output_filename, "_" + FormatFrameNumber(chunk.first_frame));
+    gfxrecon::util::platform::FileOpen(&out_file_handle, json_filename.c_str(), "w");
+
+    if (!out_file_handle)
+    {
+        GFXRECON_LOG_ERROR("Failed to create file: '%s'.", json_filename.c_str());
+        return;
+    }
+
+    gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, false };
+    VulkanJsonConsumer                     json_consumer;
+    gfxrecon::decode::VulkanDecoder        decoder;
+    decoder.AddConsumer(&json_consumer);
+    file_processor.AddDecoder(&decoder);
+
+    gfxrecon::decode::JsonWriter json_writer{ json_options, GFXRECON_PROJECT_VERSION_STRING, input_filename };
+    file_processor.SetAnnotationProcessor(&json_writer);
+    json_writer.EnableSerializerThreads(thread_count);
+
+    json_consumer.Initialize(&json_writer, GetVulkanVersion());
+    json_writer.StartStream(&out_stream);
+
+#ifdef CONVERT_EXPERIMENTAL_D3D12
+    Dx12JsonConsumer              dx12_json_consumer;
+    gfxrecon::decode::Dx12Decoder dx12_decoder;
+
+    dx12_decoder.AddConsumer(&dx12_json_consumer);
+    file_processor.AddDecoder(&dx12_decoder);
+    dx12_json_consumer.Initialize(&json_writer);
+#endif
+
+    bool success = true;
+    bool failed  = false;
+
+    while (success)
+    {
+        success = file_processor.ProcessNextFrame();
+        if (success && (file_processor.GetCurrentFrameNumber() > chunk.last_frame))
+        {
+            break;
+        }
+        if (success)
+        {
+            json_writer.EndStream();
+            gfxrecon::util::platform::FileClose(out_file_handle);
+            json_filename = gfxrecon::util::filepath::InsertFilenamePostfix(
+                output_filename, "_" + FormatFrameNumber(file_processor.GetCurrentFrameNumber()));
+            gfxrecon::util::platform::FileOpen(&out_file_handle, json_filename.c_str(), "w");
+            success = out_file_handle != nullptr;
+            if (success)
+            {
+                out_stream.Reset(out_file_handle);
+                json_writer.StartStream(&out_stream);
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to create file: '%s'.", json_filename.c_str());
+                failed = true;
+            }
+        }
+    }
+
+    json_consumer.Destroy();
+#ifdef CONVERT_EXPERIMENTAL_D3D12
+    dx12_json_consumer.Destroy();
+#endif
+
+    if (out_file_handle != nullptr)
+    {
+        gfxrecon::util::platform::FileClose(out_file_handle);
+    }
+
+    chunk.success = !failed && (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
+// Split the frames to convert into chunks of consecutive frames with similar amounts of capture data, and convert the
+// chunks on worker threads. Each frame is written to the same file, with the same content, as a serial conversion.
+static bool ConvertFramesInParallel(const std::string&                 input_filename,
+                                    const std::string&                 output_filename,
+                                    const gfxrecon::util::JsonOptions& json_options,
+                                    uint32_t                           first_frame,
+                                    uint32_t                           last_frame,
+                                    uint32_t                           worker_count,
+                                    uint32_t                           thread_count,
+                                    bool                               use_file_mapping)
+{
+    gfxrecon::decode::FileIndex file_index;
+
+    if (!file_index.Load(gfxrecon::decode::FileIndex::GetIndexFilename(input_filename), input_filename))
+    {
+        GFXRECON_LOG_INFO("Building capture file index for %s", input_filename.c_str());
+
+        if (!file_index.Build(input_filename))
+        {
+            GFXRECON_LOG_ERROR("Failed to build capture file index for %s", input_filename.c_str());
+            return false;
+        }
+    }
+
+    const uint32_t frame_count = file_index.GetFrameCount();
+    if (first_frame >= frame_count)
+    {
+        GFXRECON_LOG_ERROR("Cannot convert from frame %u, which is past the last frame (%u)", first_frame, frame_count);
+        return false;
+    }
+
+    // The last chunk keeps the requested last frame, so that it ends the same way as a serial conversion.
+    const uint32_t split_last_frame = std::min(last_frame, frame_count - 1);
+    worker_count                    = std::min(worker_count, split_last_frame - first_frame + 1);
+
+    // Without a following frame, the last index entry approximates the end of the frames to convert.
+    const auto*    end_entry    = file_index.FindFrame(split_last_frame + 1);
+    const uint64_t begin_offset = file_index.FindFrame(first_frame)->file_offset;
+    const uint64_t end_offset =
+        (end_entry != nullptr) ? end_entry->file_offset : file_index.GetEntries().back().file_offset;
+
+    std::vector<FrameChunk> chunks;
+    uint32_t                chunk_first_frame = first_frame;
+
+    for (uint32_t i = 1; (i < worker_count) && (chunk_first_frame < split_last_frame); ++i)
+    {
+        // Start the next chunk at the first frame past this chunk's share of the capture data.
+        const uint64_t target_offset = begin_offset + ((end_offset - begin_offset) * i) / worker_count;
+        uint32_t       next_frame    = chunk_first_frame + 1;
+        while ((next_frame < split_last_frame) && (file_index.FindFrame(next_frame)->file_offset < target_offset))
+        {
+            ++next_frame;
+        }
+
+        chunks.push_back({ chunk_first_frame, next_frame - 1, false });
+        chunk_first_frame = next_frame;
+    }
+
+    chunks.push_back({ chunk_first_frame, last_frame, false });
+
+    GFXRECON_LOG_INFO("Converting frames %u to %u in %zu chunks", first_frame, split_last_frame, chunks.size());
+
+    std::vector<gfxrecon::util::JsonOptions> chunk_options(chunks.size(), json_options);
+    std::vector<std::thread>                 workers;
+
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        if (json_options.dump_binaries)
+        {
+            // Binary file names are numbered per writer, so each chunk needs its own directory.
+            chunk_options[i].data_sub_dir =
+                gfxrecon::util::filepath::Join(json_options.data_sub_dir, FormatFrameNumber(chunks[i].first_frame));
+            gfxrecon::util::filepath::MakeDirectory(
+                gfxrecon::util::filepath::Join(json_options.root_dir, chunk_options[i].data_sub_dir));
+        }
+
+        workers.emplace_back(ConvertFrameChunk,
+                             std::cref(input_filename),
+                             std::cref(output_filename),
+                             std::cref(chunk_options[i]),
+                             std::cref(file_index),
+                             thread_count,
+                             use_file_mapping,
+                             std::ref(chunks[i]));
+    }
+
+    bool success = true;
+    for (size_t i = 0; i < workers.size(); ++i)
+    {
+        workers[i].join();
+
+        if (!chunks[i].success)
+        {
+            GFXRECON_LOG_ERROR("Failed to convert frames %u to %u.", chunks[i].first_frame, chunks[i].last_frame);
+            success = false;
+        }
+    }
+
+    return success;
+}
+
 int main(int argc, const char** argv)
 {
     int ret_code = 0;
@@ -192,8 +499,32 @@ int main(int argc, const char** argv)
     bool        expand_flags         = arg_parser.IsOptionSet(kExpandFlagsOption);
     bool        file_per_frame       = arg_parser.IsOptionSet(kFilePerFrameOption);
     bool        output_to_stdout     = output_filename == "stdout";
+    uint32_t    first_frame          = 0;
+    uint32_t    last_frame           = 0;
+    bool        has_frame_range      = GetFrameRange(arg_parser, first_frame, last_frame);
+    uint32_t    thread_count         = 0;
+    uint32_t    frame_worker_count   = 1;
+
+    if (!GetCountArgument(arg_parser, kThreadsArgument, 0, thread_count))
+    {
+        GFXRECON_LOG_ERROR("Invalid value specified for the %s option", kThreadsArgument);
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        return 1;
+    }
+
+    if (!GetCountArgument(arg_parser, kFrameWorkersArgument, 1, frame_worker_count))
+    {
+        GFXRECON_LOG_ERROR("Invalid value specified for the %s option", kFrameWorkersArgument);
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        return 1;
+    }
+
+    const bool use_file_mapping = arg_parser.IsOptionSet(kMmapInputOption);
 
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.SetUseFileMapping(use_file_mapping);
 
 #ifndef CONVERT_EXPERIMENTAL_D3D12
     bool detected_d3d12  = false;
@@ -219,11 +550,49 @@ int main(int argc, const char** argv)
         gfxrecon::util::filepath::MakeDirectory(data_dir);
     }
 
-    if (file_processor.Initialize(input_filename))
+    if (!file_per_frame && (frame_worker_count > 1))
+    {
+        GFXRECON_LOG_WARNING("The %s option requires --file-per-frame and is ignored.", kFrameWorkersArgument);
+    }
+
+    if (file_per_frame && (frame_worker_count > 1))
+    {
+        gfxrecon::util::JsonOptions json_options;
+        json_options.root_dir      = output_dir;
+        json_options.data_sub_dir  = filename_stem;
+        json_options.format        = output_format;
+        json_options.dump_binaries = dump_binaries;
+        json_options.expand_flags  = expand_flags;
+
+        if (!has_frame_range)
+        {
+            first_frame = 0;
+            last_frame  = std::numeric_limits<uint32_t>::max();
+        }
+
+        if (!ConvertFramesInParallel(input_filename,
+                                     output_filename,
+                                     json_options,
+                                     first_frame,
+                                     last_frame,
+                                     frame_worker_count,
+                                     thread_count,
+                                     use_file_mapping))
+        {
+            ret_code = 1;
+        }
+    }
+    else if (file_processor.Initialize(input_filename))
     {
         std::string json_filename;
         FILE*       out_file_handle = nullptr;
 
+        if (has_frame_range && !file_processor.SeekToFrame(first_frame))
+        {
+            ret_code = 1;
+            goto exit;
+        }
+
         if (file_per_frame)
         {
             json_filename = gfxrecon::util::filepath::InsertFilenamePostfix(
@@ -264,12 +633,10 @@ int main(int argc, const char** argv)
 
             gfxrecon::decode::JsonWriter json_writer{ json_options, GFXRECON_PROJECT_VERSION_STRING, input_filename };
             file_processor.SetAnnotationProcessor(&json_writer);
+            json_writer.EnableSerializerThreads(thread_count);
 
-            bool              success = true;
-            const std::string vulkan_version{ std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
-                                              std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
-                                              std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE)) };
-            json_consumer.Initialize(&json_writer, vulkan_version);
+            bool success = true;
+            json_consumer.Initialize(&json_writer, GetVulkanVersion());
             json_writer.StartStream(&out_stream);
 
             // If CONVERT_EXPERIMENTAL_D3D12 was set, then add DX12 consumer/decoder
@@ -287,6 +654,10 @@ int main(int argc, const char** argv)
             while (success)
             {
                 success = file_processor.ProcessNextFrame();
+                if (success && has_frame_range && (file_processor.GetCurrentFrameNumber() > last_frame))
+                {
+                    break;
+                }
                 if (success && file_per_frame)
                 {
                     json_writer.EndStream();
@@ -0,0 +1,157 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "project_version.h"
+#include "tool_settings.h"
+
+#include "decode/file_index.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+
+#include <cinttypes>
+#include <cstdlib>
+#include <string>
+
+const char kPrintOption[] = "--print";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--print";
+const char kArguments[] = "--output";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Create a frame index for a GFXReconstruct capture file.\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--output <file>] [--print] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be indexed.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --output <file>\tWrite the index to <file>. Default is <file>.index, which is");
+    GFXRECON_WRITE_CONSOLE("                 \tloaded automatically by tools that process the capture file.");
+    GFXRECON_WRITE_CONSOLE("  --print\t\tPrint the frame and state snapshot offsets from the index.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static void PrintIndex(const gfxrecon::decode::FileIndex& file_index)
+{
+    GFXRECON_WRITE_CONSOLE("Frames: %u", file_index.GetFrameCount());
+    GFXRECON_WRITE_CONSOLE("Blocks: %" PRIu64, file_index.GetBlockCount());
+    GFXRECON_WRITE_CONSOLE("Fill memory blobs: %" PRIuPTR, file_index.GetFillMemoryBlobs().size());
+
+    for (const auto& entry : file_index.GetEntries())
+    {
+        const char* type_name = nullptr;
+
+        switch (entry.type)
+        {
+            case gfxrecon::decode::FileIndex::kFrameStart:
+                type_name = "frame";
+                break;
+            case gfxrecon::decode::FileIndex::kStateBegin:
+                type_name = "state begin";
+                break;
+            case gfxrecon::decode::FileIndex::kStateEnd:
+                type_name = "state end";
+                break;
+            default:
+                // Block checkpoints are only used for lookups.
+                break;
+        }
+
+        if (type_name != nullptr)
+        {
+            GFXRECON_WRITE_CONSOLE("  %-12s frame %-8u block %-12" PRIu64 " offset %" PRIu64,
+                                   type_name,
+                                   entry.frame_number,
+                                   entry.block_index,
+                                   entry.file_offset);
+        }
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    int return_code = 0;
+
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 1))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+        ProcessDisableDebugPopup(arg_parser);
+    }
+
+    const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+    std::string                     input_filename       = positional_arguments[0];
+    std::string                     output_filename      = arg_parser.GetArgumentValue(kOutput);
+
+    if (output_filename.empty())
+    {
+        output_filename = gfxrecon::decode::FileIndex::GetIndexFilename(input_filename);
+    }
+
+    gfxrecon::decode::FileIndex file_index;
+
+    if (!file_index.Build(input_filename))
+    {
+        return_code = -1;
+    }
+    else if (!file_index.Write(output_filename))
+    {
+        return_code = -1;
+    }
+    else
+    {
+        GFXRECON_WRITE_CONSOLE("Wrote index of %u frames to %s", file_index.GetFrameCount(), output_filename.c_str());
+
+        if (arg_parser.IsOptionSet(kPrintOption))
+        {
+            PrintIndex(file_index);
+        }
+    }
+
+    gfxrecon::util::Log::Release();
+
+    return return_code;
+}
@@ -131,6 +131,8 @@ bool Dx12FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header,
 
     // If needed, add a FillMemoryResourceValueCommand before the fill memory command.
     if ((meta_data_type == format::MetaDataType::kFillMemoryCommand) ||
+        (meta_data_type == format::MetaDataType::kFillMemoryBlobCommand) ||
+        (meta_data_type == format::MetaDataType::kFillMemoryFromBlobCommand) ||
         (meta_data_type == format::MetaDataType::kInitSubresourceCommand))
     {
         if ((fill_command_resource_values_ != nullptr) && (!fill_command_resource_values_->empty()))
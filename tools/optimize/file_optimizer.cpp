@@ -23,6 +23,7 @@
 #include "file_optimizer.h"
 
 #include "format/format_util.h"
+#include "util/hash.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
@@ -59,6 +60,12 @@ bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, for
     {
         return FilterInitImageMetaData(block_header, meta_data_id);
     }
+    else if (dedup_fill_memory_ && ((meta_data_type == format::MetaDataType::kFillMemoryCommand) ||
+                                    (meta_data_type == format::MetaDataType::kFillMemoryBlobCommand) ||
+                                    (meta_data_type == format::MetaDataType::kFillMemoryFromBlobCommand)))
+    {
+        return DeduplicateFillMemoryMetaData(block_header, meta_data_id);
+    }
     else
     {
         // Copy the meta data block, if it was not filtered.
@@ -195,6 +202,151 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
     return true;
 }
 
+bool FileOptimizer::DeduplicateFillMemoryMetaData(const format::BlockHeader& block_header,
+                                                  format::MetaDataId         meta_data_id)
+{
+    format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+
+    // The input blob IDs are replaced, because the output file assigns blob IDs to a different set of blobs.
+    format::FillMemoryBlobCommandHeader header;
+    header.blob_id = 0;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    if (meta_data_type != format::MetaDataType::kFillMemoryCommand)
+    {
+        success = success && ReadBytes(&header.blob_id, sizeof(header.blob_id));
+    }
+    success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+    success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+    success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
+
+    size_t         data_size       = static_cast<size_t>(header.memory_size);
+    const uint8_t* data            = nullptr; // Uncompressed data, used to identify duplicates.
+    const uint8_t* block_data      = nullptr; // Data as it was stored in the input block.
+    size_t         block_data_size = data_size;
+
+    if (meta_data_type == format::MetaDataType::kFillMemoryFromBlobCommand)
+    {
+        const std::vector<uint8_t>* blob = input_fill_memory_blobs_.GetBlob(header.blob_id);
+        if ((blob == nullptr) || (blob->size() != data_size))
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Fill memory meta-data block references an unknown blob");
+            return false;
+        }
+
+        data       = blob->data();
+        block_data = data;
+    }
+    else
+    {
+        uint64_t base_size = (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+                                 ? format::GetMetaDataBlockBaseSize(format::FillMemoryCommandHeader{})
+                                 : format::GetMetaDataBlockBaseSize(header);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            block_data_size          = static_cast<size_t>(block_header.size - base_size);
+
+            if (!ReadCompressedParameterBuffer(block_data_size, data_size, &uncompressed_size))
+            {
+                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block");
+                return false;
+            }
+
+            data       = GetParameterBuffer().data();
+            block_data = GetCompressedParameterBuffer().data();
+        }
+        else
+        {
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory meta-data block");
+                return false;
+            }
+
+            data       = GetParameterBuffer().data();
+            block_data = data;
+        }
+
+        if (meta_data_type == format::MetaDataType::kFillMemoryBlobCommand)
+        {
+            input_fill_memory_blobs_.AddBlob(header.blob_id, data, data_size);
+        }
+    }
+
+    bool use_blob = format::FillMemoryBlobWriter::IsBlobSize(data_size);
+    bool is_new   = true;
+
+    if (use_blob)
+    {
+        util::hash::Hash128 hash = util::hash::GenerateHash128(data, data_size);
+        header.blob_id           = output_fill_memory_blobs_.AddBlob(hash, data_size, &is_new);
+    }
+
+    format::ApiFamilyId api_family = format::GetMetaDataApi(meta_data_id);
+
+    if (use_blob && !is_new)
+    {
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header);
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryFromBlobCommand);
+
+        if (!WriteBytes(&header, sizeof(header)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
+            return false;
+        }
+
+        ++deduplicated_fill_count_;
+        deduplicated_fill_size_ += data_size;
+    }
+    else if (use_blob)
+    {
+        header.meta_header.block_header.type = block_header.type;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + block_data_size;
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryBlobCommand);
+
+        if (!WriteBytes(&header, sizeof(header)) || !WriteBytes(block_data, block_data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        // The data is too small to be worth tracking, so it is written with a regular fill memory command.
+        format::FillMemoryCommandHeader fill_cmd;
+        fill_cmd.meta_header.block_header.type = block_header.type;
+        fill_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryCommand);
+        fill_cmd.thread_id     = header.thread_id;
+        fill_cmd.memory_id     = header.memory_id;
+        fill_cmd.memory_offset = header.memory_offset;
+        fill_cmd.memory_size   = header.memory_size;
+
+        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + block_data_size;
+
+        if (!WriteBytes(&fill_cmd, sizeof(fill_cmd)) || !WriteBytes(block_data, block_data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool FileOptimizer::FilterMethodCall(const format::BlockHeader& block_header,
                                      format::ApiCallId          api_call_id,
                                      uint64_t                   block_index)
@@ -24,6 +24,7 @@
 #define GFXRECON_FILE_OPTIMIZER_H
 
 #include "decode/file_transformer.h"
+#include "format/fill_memory_blob.h"
 #include "util/defines.h"
 
 #include <unordered_set>
@@ -43,6 +44,13 @@ class FileOptimizer : public decode::FileTransformer
 
     uint64_t GetUnreferencedBlocksSize();
 
+    // Write data that was already written by an earlier fill memory command with kFillMemoryFromBlobCommand.
+    void SetDeduplicateFillMemory(bool dedup_fill_memory) { dedup_fill_memory_ = dedup_fill_memory; }
+
+    uint64_t GetDeduplicatedFillMemoryCount() const { return deduplicated_fill_count_; }
+
+    uint64_t GetDeduplicatedFillMemorySize() const { return deduplicated_fill_size_; }
+
   protected:
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
@@ -57,9 +65,16 @@ class FileOptimizer : public decode::FileTransformer
 
     bool FilterMethodCall(const format::BlockHeader& block_header, format::ApiCallId api_call_id, uint64_t block_index);
 
+    bool DeduplicateFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
   private:
     std::unordered_set<format::HandleId> unreferenced_ids_;
     std::unordered_set<uint64_t>         unreferenced_blocks_;
+    bool                                 dedup_fill_memory_{ false };
+    format::FillMemoryBlobCache          input_fill_memory_blobs_; // Blobs referenced by the input file.
+    format::FillMemoryBlobWriter         output_fill_memory_blobs_;
+    uint64_t                             deduplicated_fill_count_{ 0 };
+    uint64_t                             deduplicated_fill_size_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
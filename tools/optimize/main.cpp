@@ -60,12 +60,14 @@ extern "C"
 }
 #endif
 
-const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--d3d12-pso-removal,--dxr,--dxr-experimental";
+const char kOptions[] =
+    "-h|--help,--version,--no-debug-popup,--d3d12-pso-removal,--dxr,--dxr-experimental,--dedup-fill-memory";
 const char kArguments[] = "--gpu";
 
 const char kD3d12PsoRemoval[]             = "--d3d12-pso-removal";
 const char kDx12OptimizeDxr[]             = "--dxr";
 const char kDx12OptimizeDxrExperimental[] = "--dxr-experimental";
+const char kDedupFillMemory[]             = "--dedup-fill-memory";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -83,9 +85,9 @@ static void PrintUsage(const char* exe_name)
         "\t\t\tFor D3D12, the optimizer will improve DXR replay performance and remove unused PSOs (for all captures)");
     GFXRECON_WRITE_CONSOLE("");
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE(
-        "  %s [-h | --help] [--version] [--d3d12-pso-removal] [--dxr] [--gpu <index>] <input-file> <output-file>",
-        app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--d3d12-pso-removal] [--dxr] [--dedup-fill-memory]",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--gpu <index>] <input-file> <output-file>");
     GFXRECON_WRITE_CONSOLE("");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe path to input GFXReconstruct capture file to be processed.");
@@ -94,6 +96,9 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("Optional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --dedup-fill-memory\tStore each unique block of mapped memory data once, replacing");
+    GFXRECON_WRITE_CONSOLE("          \t\tlater copies with a reference to the first one. Cannot be");
+    GFXRECON_WRITE_CONSOLE("          \t\tcombined with other optimizations.");
 #if defined(WIN32)
 #if defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
@@ -161,6 +166,11 @@ void FilterUnreferencedResources(const std::string&
                                  std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
 {
     gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
+
+    // Resource initialization data is only written with the trimmed state snapshot, so the blocks that follow the
+    // snapshot are copied to the optimized file without being processed.
+    file_processor.SetCopyAfterStateSnapshot(true);
+
     if (file_processor.Initialize(input_filename, output_filename))
     {
         file_processor.Process();
@@ -198,6 +208,31 @@ void VkRemoveRedundantResources(std::string input_filename, std::string output_f
     }
 }
 
+void DeduplicateFillMemory(const std::string& input_filename, const std::string& output_filename)
+{
+    gfxrecon::FileOptimizer file_processor;
+    file_processor.SetDeduplicateFillMemory(true);
+
+    if (file_processor.Initialize(input_filename, output_filename))
+    {
+        file_processor.Process();
+
+        if (file_processor.GetErrorState() != gfxrecon::FileOptimizer::kErrorNone)
+        {
+            GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        GFXRECON_WRITE_CONSOLE("Fill memory deduplication complete.");
+        GFXRECON_WRITE_CONSOLE("\tDuplicate fill memory commands: %" PRIu64 " (%" PRIu64 " bytes)",
+                               file_processor.GetDeduplicatedFillMemoryCount(),
+                               file_processor.GetDeduplicatedFillMemorySize());
+        GFXRECON_WRITE_CONSOLE("\tOriginal file size: %" PRIu64 " bytes", file_processor.GetNumBytesRead());
+        GFXRECON_WRITE_CONSOLE("\tOptimized file size: %" PRIu64 " bytes", file_processor.GetNumBytesWritten());
+    }
+}
+
 void RunDx12Optimizations(const std::string&                        input_filename,
                           const std::string&                        output_filename,
                           gfxrecon::decode::Dx12OptimizationOptions dx12_options)
@@ -267,8 +302,19 @@ int main(int argc, const char** argv)
             dx12_options.optimize_resource_values = true;
         }
 
+        if (arg_parser.IsOptionSet(kDedupFillMemory))
+        {
+            if (dx12_options.optimize_resource_values || dx12_options.remove_redundant_psos)
+            {
+                GFXRECON_LOG_ERROR("The %s option cannot be combined with other optimizations.", kDedupFillMemory);
+                gfxrecon::util::Log::Release();
+                exit(-1);
+            }
+
+            DeduplicateFillMemory(input_filename, output_filename);
+        }
         // Automatic mode. User specified no options.
-        if ((dx12_options.optimize_resource_values == false) && (dx12_options.remove_redundant_psos == false))
+        else if ((dx12_options.optimize_resource_values == false) && (dx12_options.remove_redundant_psos == false))
         {
             bool detected_d3d12  = false;
             bool detected_vulkan = false;
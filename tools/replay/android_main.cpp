@@ -101,6 +101,8 @@ void android_main(struct android_app* app)
         try
         {
             gfxrecon::decode::FileProcessor file_processor;
+            file_processor.SetReadAheadSize(GetReadAheadSize(arg_parser));
+            file_processor.SetUseFileMapping(arg_parser.IsOptionSet(kMmapInputOption));
 
             if (!file_processor.Initialize(filename))
             {
@@ -132,13 +134,37 @@ void android_main(struct android_app* app)
                                                      replay_options.quit_after_measurement_frame_range,
                                                      replay_options.flush_measurement_frame_range,
                                                      replay_options.flush_inside_measurement_range,
-                                                     measurement_file_name);
+                                                     measurement_file_name,
+                                                     replay_options.preload_measurement_range,
+                                                     replay_options.measurement_range_loop_count);
 
                 replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
                 replay_consumer.SetFpsInfo(&fps_info);
 
                 decoder.AddConsumer(&replay_consumer);
                 file_processor.AddDecoder(&decoder);
+
+                if (replay_options.threaded_command_recording)
+                {
+                    file_processor.SetThreadedCallFilter(
+                        [&replay_consumer](gfxrecon::format::ApiCallId call_id,
+                                           const uint8_t*              parameter_buffer,
+                                           size_t                      buffer_size,
+                                           gfxrecon::format::HandleId* queue_key) {
+                            return replay_consumer.GetCommandBufferCallPool(
+                                call_id, parameter_buffer, buffer_size, queue_key);
+                        });
+                }
+
+                if (replay_options.pipeline_prefetch_distance > 0)
+                {
+                    replay_consumer.StartPipelinePrefetch(filename);
+                }
+
+                if (!replay_options.pipeline_cache_dir.empty())
+                {
+                    replay_consumer.EnablePipelineCacheFiles(filename);
+                }
                 application->SetPauseFrame(GetPauseFrame(arg_parser));
 
                 // Warn if the capture layer is active.
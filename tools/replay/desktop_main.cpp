@@ -125,6 +125,8 @@ int main(int argc, const char** argv)
         std::string                     filename             = positional_arguments[0];
 
         gfxrecon::decode::FileProcessor file_processor;
+        file_processor.SetReadAheadSize(GetReadAheadSize(arg_parser));
+        file_processor.SetUseFileMapping(arg_parser.IsOptionSet(kMmapInputOption));
         if (!file_processor.Initialize(filename))
         {
             return_code = -1;
@@ -147,6 +149,8 @@ int main(int argc, const char** argv)
             bool        quit_after_measurement_frame_range = false;
             bool        flush_measurement_frame_range      = false;
             bool        flush_inside_measurement_range     = false;
+            bool        preload_measurement_range          = false;
+            uint32_t    measurement_range_loop_count       = 1;
             std::string measurement_file_name;
 
             if (vulkan_replay_options.enable_vulkan)
@@ -155,6 +159,8 @@ int main(int argc, const char** argv)
                 quit_after_measurement_frame_range = vulkan_replay_options.quit_after_measurement_frame_range;
                 flush_measurement_frame_range      = vulkan_replay_options.flush_measurement_frame_range;
                 flush_inside_measurement_range     = vulkan_replay_options.flush_inside_measurement_range;
+                preload_measurement_range          = vulkan_replay_options.preload_measurement_range;
+                measurement_range_loop_count       = vulkan_replay_options.measurement_range_loop_count;
             }
 
             if (has_mfr)
@@ -168,7 +174,9 @@ int main(int argc, const char** argv)
                                                  quit_after_measurement_frame_range,
                                                  flush_measurement_frame_range,
                                                  flush_inside_measurement_range,
-                                                 measurement_file_name);
+                                                 measurement_file_name,
+                                                 preload_measurement_range,
+                                                 measurement_range_loop_count);
 
             gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, vulkan_replay_options);
             gfxrecon::decode::VulkanDecoder        vulkan_decoder;
@@ -181,6 +189,28 @@ int main(int argc, const char** argv)
 
                 vulkan_decoder.AddConsumer(&vulkan_replay_consumer);
                 file_processor.AddDecoder(&vulkan_decoder);
+
+                if (vulkan_replay_options.threaded_command_recording)
+                {
+                    file_processor.SetThreadedCallFilter(
+                        [&vulkan_replay_consumer](gfxrecon::format::ApiCallId call_id,
+                                                  const uint8_t*              parameter_buffer,
+                                                  size_t                      buffer_size,
+                                                  gfxrecon::format::HandleId* queue_key) {
+                            return vulkan_replay_consumer.GetCommandBufferCallPool(
+                                call_id, parameter_buffer, buffer_size, queue_key);
+                        });
+                }
+
+                if (vulkan_replay_options.pipeline_prefetch_distance > 0)
+                {
+                    vulkan_replay_consumer.StartPipelinePrefetch(filename);
+                }
+
+                if (!vulkan_replay_options.pipeline_cache_dir.empty())
+                {
+                    vulkan_replay_consumer.EnablePipelineCacheFiles(filename);
+                }
             }
 
 #if defined(D3D12_SUPPORT)
@@ -30,15 +30,16 @@ const char kOptions[] =
     "-h|--help,--version,--log-debugview,--no-debug-popup,--paused,--sync,--sfa|--skip-failed-allocations,--opcd|--"
     "omit-pipeline-cache-data,--remove-unsupported,--validate,--debug-device-lost,--create-dummy-allocations,--"
     "screenshot-all,--onhb|--omit-null-hardware-buffers,--qamr|--quit-after-measurement-range,--fmr|--flush-"
-    "measurement-range,--flush-inside-measurement-range,--vssb|--virtual-swapchain-skip-blit,--use-captured-swapchain-"
-    "indices,--dcp,--discard-cached-psos,--use-colorspace-fallback,--use-cached-psos,--dx12-override-object-names,--"
-    "offscreen-swapchain-frame-boundary";
+    "measurement-range,--flush-inside-measurement-range,--preload-measurement-range,--vssb|--virtual-swapchain-skip-"
+    "blit,--use-captured-swapchain-indices,--dcp,--discard-cached-psos,--use-colorspace-fallback,--use-cached-psos,--"
+    "dx12-override-object-names,--offscreen-swapchain-frame-boundary,--threaded-recording,--mmap-input";
 const char kArguments[] =
     "--log-level,--log-file,--gpu,--gpu-group,--pause-frame,--wsi,--surface-index,-m|--memory-translation,"
     "--replace-shaders,--screenshots,--denied-messages,--allowed-messages,--screenshot-format,--"
     "screenshot-dir,--screenshot-prefix,--screenshot-size,--screenshot-scale,--mfr|--measurement-frame-range,--fw|--"
     "force-windowed,--batching-memory-usage,--measurement-file,--swapchain,--sgfs|--skip-get-fence-status,--sgfr|--"
-    "skip-get-fence-ranges";
+    "skip-get-fence-ranges,--read-ahead,--loop-measurement-range,--prefetch-pipelines,--pipeline-"
+    "cache-dir";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -69,12 +70,16 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--use-captured-swapchain-indices]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--use-colorspace-fallback]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--offscreen-swapchain-frame-boundary]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--threaded-recording]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--prefetch-pipelines <blocks>] [--pipeline-cache-dir <dir>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--mfr|--measurement-frame-range <start-frame>-<end-frame>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--measurement-file <file>] [--quit-after-measurement-range]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range] [--preload-measurement-range]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--loop-measurement-range <count>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--fw <width,height> | --force-windowed <width,height>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--read-ahead <MiB>] [--mmap-input]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-debugview]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--batching-memory-usage <pct>]");
@@ -145,6 +150,16 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\treturned by vkEnumeratePhysicalDevices or IDXGIFactory1::EnumAdapters1.");
     GFXRECON_WRITE_CONSOLE("          \t\tReplay may fail if the specified device is not compatible with the");
     GFXRECON_WRITE_CONSOLE("          \t\toriginal capture devices.");
+    GFXRECON_WRITE_CONSOLE("  --read-ahead <MiB>\tRead and decompress up to the specified amount of capture");
+    GFXRECON_WRITE_CONSOLE("          \t\tfile data ahead of replay on a separate thread. When replay");
+    GFXRECON_WRITE_CONSOLE("          \t\tcompletes, the number of times that replay waited for the");
+    GFXRECON_WRITE_CONSOLE("          \t\tread-ahead thread is logged. Frequent waits indicate that");
+    GFXRECON_WRITE_CONSOLE("          \t\treplay is limited by file I/O rather than by the GPU.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is 0 (read on the replay thread).");
+    GFXRECON_WRITE_CONSOLE("  --mmap-input\t\tMap the capture file into memory and decode blocks directly");
+    GFXRECON_WRITE_CONSOLE("          \t\tfrom the mapping instead of reading them into a buffer. The");
+    GFXRECON_WRITE_CONSOLE("          \t\tmapping reserves address space for the whole capture file,");
+    GFXRECON_WRITE_CONSOLE("          \t\tso it is disabled by default.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("Windows-only:")
@@ -216,6 +231,28 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\twas called in the original capture.");
     GFXRECON_WRITE_CONSOLE("          \t\tThis allows preserving frames when capturing a replay that uses.");
     GFXRECON_WRITE_CONSOLE("          \t\toffscreen swapchain.");
+    GFXRECON_WRITE_CONSOLE("  --threaded-recording");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplay the calls that record command buffers on one thread");
+    GFXRECON_WRITE_CONSOLE("          \t\tfor each thread that recorded them during capture, up to the");
+    GFXRECON_WRITE_CONSOLE("          \t\tnumber of hardware threads. All other calls are replayed on the");
+    GFXRECON_WRITE_CONSOLE("          \t\tmain thread once the recording calls that precede them have");
+    GFXRECON_WRITE_CONSOLE("          \t\tcompleted. Can reduce CPU time for captures of applications");
+    GFXRECON_WRITE_CONSOLE("          \t\tthat recorded command buffers from several threads.");
+    GFXRECON_WRITE_CONSOLE("  --prefetch-pipelines <blocks>");
+    GFXRECON_WRITE_CONSOLE("          \t\tCompile the pipelines of vkCreateGraphicsPipelines and");
+    GFXRECON_WRITE_CONSOLE("          \t\tvkCreateComputePipelines calls on worker threads, up to the");
+    GFXRECON_WRITE_CONSOLE("          \t\tspecified number of capture file blocks ahead of replay. The");
+    GFXRECON_WRITE_CONSOLE("          \t\tcalls then retrieve their pipelines from a pipeline cache.");
+    GFXRECON_WRITE_CONSOLE("          \t\tThe number of calls that were compiled in time is logged when");
+    GFXRECON_WRITE_CONSOLE("          \t\treplay completes. Default is 0 (compile during replay).");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-cache-dir <dir>");
+    GFXRECON_WRITE_CONSOLE("          \t\tLoad the pipeline cache of each device from a file in the");
+    GFXRECON_WRITE_CONSOLE("          \t\tspecified directory when the device is created, and save it");
+    GFXRECON_WRITE_CONSOLE("          \t\twhen the device is destroyed, so later replays of the same");
+    GFXRECON_WRITE_CONSOLE("          \t\tcapture do not compile the pipelines again. The files are");
+    GFXRECON_WRITE_CONSOLE("          \t\tnamed by the pipeline cache UUID, driver version and device of");
+    GFXRECON_WRITE_CONSOLE("          \t\treplay, and a hash of the pipeline creation calls of the");
+    GFXRECON_WRITE_CONSOLE("          \t\tcapture, which are read from the file before replay starts.");
     GFXRECON_WRITE_CONSOLE("  --measurement-frame-range <start_frame>-<end_frame>");
     GFXRECON_WRITE_CONSOLE("          \t\tCustom framerange to measure FPS for.");
     GFXRECON_WRITE_CONSOLE("          \t\tThis range will include the start frame but not the end frame.");
@@ -243,6 +280,25 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tIf this is specified the replayer will flush")
     GFXRECON_WRITE_CONSOLE("          \t\tand wait for all current GPU work to finish at the");
     GFXRECON_WRITE_CONSOLE("          \t\tend of each frame inside the measurement range.");
+    GFXRECON_WRITE_CONSOLE("  --preload-measurement-range");
+    GFXRECON_WRITE_CONSOLE("          \t\tIf this is specified the replayer will read and");
+    GFXRECON_WRITE_CONSOLE("          \t\tdecompress all blocks of the measurement range into");
+    GFXRECON_WRITE_CONSOLE("          \t\tmemory before measuring the first frame, so that the");
+    GFXRECON_WRITE_CONSOLE("          \t\tmeasured frame times do not include file I/O.");
+    GFXRECON_WRITE_CONSOLE("  --loop-measurement-range <count>");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplay the measurement range <count> times, preloading");
+    GFXRECON_WRITE_CONSOLE("          \t\tit into memory. Before each repetition, the replayer");
+    GFXRECON_WRITE_CONSOLE("          \t\twaits for the GPU to be idle, restores the fence and");
+    GFXRECON_WRITE_CONSOLE("          \t\tevent state and re-applies the memory and resource");
+    GFXRECON_WRITE_CONSOLE("          \t\tcontents of a trimmed capture's state snapshot. For a");
+    GFXRECON_WRITE_CONSOLE("          \t\ttrimmed capture, the range must start with the first");
+    GFXRECON_WRITE_CONSOLE("          \t\tframe, so that the state snapshot restores the memory");
+    GFXRECON_WRITE_CONSOLE("          \t\tcontents that the range starts with. Other ranges are");
+    GFXRECON_WRITE_CONSOLE("          \t\trejected with an error and replayed once. Ranges that");
+    GFXRECON_WRITE_CONSOLE("          \t\tcreate or destroy objects, or that signal timeline");
+    GFXRECON_WRITE_CONSOLE("          \t\tsemaphores, cannot be repeated, and are replayed once");
+    GFXRECON_WRITE_CONSOLE("          \t\twith a warning. Frame times of all repetitions are");
+    GFXRECON_WRITE_CONSOLE("          \t\tmeasured. Default is 1.");
     GFXRECON_WRITE_CONSOLE("  --gpu-group <index>\tUse the specified device group for replay, where index");
     GFXRECON_WRITE_CONSOLE("          \t\tis the zero-based index to the array of physical device group");
     GFXRECON_WRITE_CONSOLE("          \t\treturned by vkEnumeratePhysicalDeviceGroups.  Replay may fail");
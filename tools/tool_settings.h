@@ -104,6 +104,8 @@ const char kMeasurementFileArgument[]            = "--measurement-file";
 const char kQuitAfterMeasurementRangeOption[]    = "--quit-after-measurement-range";
 const char kFlushMeasurementRangeOption[]        = "--flush-measurement-range";
 const char kFlushInsideMeasurementRangeOption[]  = "--flush-inside-measurement-range";
+const char kPreloadMeasurementRangeOption[]      = "--preload-measurement-range";
+const char kLoopMeasurementRangeArgument[]       = "--loop-measurement-range";
 const char kSwapchainOption[]                    = "--swapchain";
 const char kEnableUseCapturedSwapchainIndices[] =
     "--use-captured-swapchain-indices"; // The same: util::SwapchainOption::kCaptured
@@ -117,6 +119,11 @@ const char kExpandFlagsOption[]                   = "--expand-flags";
 const char kFilePerFrameOption[]                  = "--file-per-frame";
 const char kSkipGetFenceStatus[]                  = "--skip-get-fence-status";
 const char kSkipGetFenceRanges[]                  = "--skip-get-fence-ranges";
+const char kReadAheadArgument[]                   = "--read-ahead";
+const char kMmapInputOption[]                     = "--mmap-input";
+const char kThreadedRecordingOption[]             = "--threaded-recording";
+const char kPrefetchPipelinesArgument[]           = "--prefetch-pipelines";
+const char kPipelineCacheDirArgument[]            = "--pipeline-cache-dir";
 #if defined(WIN32)
 const char kApiFamilyOption[]             = "--api";
 const char kDxTwoPassReplay[]             = "--dx12-two-pass-replay";
@@ -478,6 +485,50 @@ static void GetMeasurementFilename(const gfxrecon::util::ArgumentParser& arg_par
     }
 }
 
+static size_t GetReadAheadSize(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& value = arg_parser.GetArgumentValue(kReadAheadArgument);
+
+    size_t read_ahead_size = 0;
+
+    if (!value.empty())
+    {
+        try
+        {
+            // The argument is specified in MiB.
+            read_ahead_size = static_cast<size_t>(std::stoul(value)) * 1024 * 1024;
+        }
+        catch (std::exception&)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid read-ahead option. Expected format is --read-ahead <MiB>");
+        }
+    }
+
+    return read_ahead_size;
+}
+
+static uint32_t GetPipelinePrefetchDistance(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& value = arg_parser.GetArgumentValue(kPrefetchPipelinesArgument);
+
+    uint32_t distance = 0;
+
+    if (!value.empty())
+    {
+        try
+        {
+            distance = static_cast<uint32_t>(std::stoul(value));
+        }
+        catch (std::exception&)
+        {
+            GFXRECON_LOG_WARNING(
+                "Ignoring invalid prefetch-pipelines option. Expected format is --prefetch-pipelines <blocks>");
+        }
+    }
+
+    return distance;
+}
+
 static gfxrecon::util::ScreenshotFormat GetScreenshotFormat(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     gfxrecon::util::ScreenshotFormat format = gfxrecon::util::ScreenshotFormat::kBmp;
@@ -821,6 +872,25 @@ static void GetReplayOptions(gfxrecon::decode::ReplayOptions& options, const gfx
         options.flush_inside_measurement_range = true;
     }
 
+    if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+    {
+        options.preload_measurement_range = true;
+    }
+
+    const auto& loop_count = arg_parser.GetArgumentValue(kLoopMeasurementRangeArgument);
+    if (!loop_count.empty())
+    {
+        try
+        {
+            options.measurement_range_loop_count = std::max(1u, static_cast<uint32_t>(std::stoul(loop_count)));
+        }
+        catch (std::exception&)
+        {
+            GFXRECON_LOG_WARNING(
+                "Ignoring invalid loop-measurement-range option. Expected format is --loop-measurement-range <count>");
+        }
+    }
+
     const auto& override_gpu = arg_parser.GetArgumentValue(kOverrideGpuArgument);
     if (!override_gpu.empty())
     {
@@ -915,7 +985,15 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
         replay_options.virtual_swapchain_skip_blit = true;
     }
 
-    replay_options.replace_dir = arg_parser.GetArgumentValue(kShaderReplaceArgument);
+    if (arg_parser.IsOptionSet(kThreadedRecordingOption))
+    {
+        replay_options.threaded_command_recording = true;
+    }
+
+    replay_options.pipeline_prefetch_distance = GetPipelinePrefetchDistance(arg_parser);
+
+    replay_options.replace_dir        = arg_parser.GetArgumentValue(kShaderReplaceArgument);
+    replay_options.pipeline_cache_dir = arg_parser.GetArgumentValue(kPipelineCacheDirArgument);
     replay_options.create_resource_allocator =
         GetCreateResourceAllocatorFunc(arg_parser, filename, replay_options, tracked_object_info_table);
 